@@ -70,6 +70,10 @@ int main(int argc, char* argv[])
     return result;
   }
 
+  if (!options.GetOption("no-resource-cache").as<bool>())
+    SetResourceCacheDirectory(options.GetOption("resource-cache").as<std::string>());
+  SetConversionThreads(options.GetOption("jobs").as<unsigned>());
+
   bool run = options.GetOption("run").as<bool>();
   if (!run) plugin.HandleGameLaunch();
 
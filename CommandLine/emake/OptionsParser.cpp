@@ -106,6 +106,9 @@ OptionsParser::OptionsParser() : _desc("Options")
     ("platform,p", opt::value<std::string>()->default_value(def_platform), "Target Platform (XLib, Win32, Cocoa)")
     ("workdir,d", opt::value<std::string>()->default_value(def_workdir), "Working Directory")
     ("codegen,k", opt::value<std::string>()->default_value(def_workdir), "Codegen Directory")
+    ("jobs,j", opt::value<unsigned>()->default_value(0), "Threads to convert images and load sounds on; 0 for one per core")
+    ("resource-cache", opt::value<std::string>()->default_value(def_workdir + "ResourceCache/"), "Directory to keep converted images in between builds")
+    ("no-resource-cache", opt::bool_switch()->default_value(false), "Convert every image afresh, without reading or writing the resource cache")
     ("mode,m", opt::value<std::string>()->default_value("Debug"), "Game Mode (Run, Release, Debug, Design)")
     ("graphics,g", opt::value<std::string>()->default_value("OpenGL1"), "Graphics System (OpenGL1, OpenGL3, DirectX)")
     ("audio,a", opt::value<std::string>()->default_value("None"), "Audio System (OpenAL, DirectSound, SFML, None)")
@@ -113,6 +116,9 @@ OptionsParser::OptionsParser() : _desc("Options")
     ("network,n", opt::value<std::string>()->default_value("None"), "Networking System (Async, Berkeley, DirectPlay)")
     ("collision,c", opt::value<std::string>()->default_value("None"), "Collision System")
     ("extensions,e", opt::value<std::string>()->default_value("None"), "Extensions (Paths, Timelines, Particles)")
+    ("parallel-step", opt::value<std::string>()->default_value(""), "Objects whose step events may run on the thread pool, separated by commas")
+    ("residency-budget", opt::value<unsigned>()->default_value(0), "Megabytes of sprite and background textures to keep before evicting unused ones; 0 for no limit")
+    ("preload-resources", opt::bool_switch()->default_value(false), "Unpack every sprite and background at startup, on the thread pool, rather than on first use")
     ("compiler,x", opt::value<std::string>()->default_value(def_compiler), "Compiler.ey Descriptor")
     ("run,r", opt::bool_switch()->default_value(false), "Automatically run the game after it is built")
   ;
@@ -229,6 +235,10 @@ std::string OptionsParser::APIyaml()
   yaml += "inherit-negatives-as: 0\n";
   yaml += "inherit-escapes-from: 0\n";
   yaml += "inherit-objects: true \n";
+  yaml += "batch-events: true\n";
+  yaml += "parallel-step-objects: " + _rawArgs["parallel-step"].as<std::string>() + "\n";
+  yaml += "residency-budget: " + std::to_string(_rawArgs["residency-budget"].as<unsigned>()) + "\n";
+  yaml += "preload-resources: " + std::string(_rawArgs["preload-resources"].as<bool>() ? "true" : "false") + "\n";
   yaml += "inherit-increment-from: 0\n";
   yaml += " \n";
   yaml += "target-audio: " + _rawArgs["audio"].as<std::string>() + "\n";
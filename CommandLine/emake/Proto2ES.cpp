@@ -16,7 +16,14 @@
 **/
 
 #include "Proto2ES.h"
+#include "ResourceCache.hpp"
 
+#include "general/parallel_for.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -249,9 +256,9 @@ inline unsigned int nlpo2dc(unsigned int x)  // Taking x, returns n such that n
 
 #include <zlib.h>
 
-unsigned char* zlib_compress(unsigned char* inbuffer,int actualsize)
+unsigned char* zlib_compress(unsigned char* inbuffer,int actualsize,uLongf &outsize)
 {
-    uLongf outsize=(int)(actualsize*1.1)+12;
+    outsize=(int)(actualsize*1.1)+12;
     Bytef* outbytef=new Bytef[outsize];
 
     compress(outbytef,&outsize,(Bytef*)inbuffer,actualsize);
@@ -259,14 +266,97 @@ unsigned char* zlib_compress(unsigned char* inbuffer,int actualsize)
     return (unsigned char*)outbytef;
 }
 
-Image AddImage(const std::string fname) {
+static ResourceCache resource_cache;
+
+void SetResourceCacheDirectory(const std::string &directory) {
+  resource_cache.SetDirectory(directory);
+}
+
+// Cached images are the Image fields followed by the compressed bitmap. An
+// Image's dataSize is the length of that zlib data, so a hit hands back an
+// Image the writers can copy in full, exactly as a miss does. Entries from
+// /1 recorded the bitmap's length instead and must not be read.
+// Rename this if ConvertImage ever produces something different.
+static const char kImageConversion[] = "png-to-zlib-bgra-pow2/2";
+struct CachedImageHeader {
+  int32_t width, height, dataSize;
+};
+
+static bool IsPowerOfTwo(int32_t n) { return n > 0 && !(n & (n - 1)); }
+
+static bool LoadCachedImage(const std::string &key, Image &i) {
+  std::string blob;
+  if (!resource_cache.Load(key, &blob) || blob.size() < sizeof(CachedImageHeader))
+    return false;
+  CachedImageHeader h;
+  memcpy(&h, blob.data(), sizeof(h));
+  if (h.dataSize < 0 || blob.size() - sizeof(h) != size_t(h.dataSize) ||
+      !IsPowerOfTwo(h.width) || !IsPowerOfTwo(h.height))
+    return false;
+  i.width = h.width;
+  i.height = h.height;
+  i.dataSize = h.dataSize;
+  i.data = new char[h.dataSize];
+  memcpy(i.data, blob.data() + sizeof(h), h.dataSize);
+  return true;
+}
+
+static void StoreCachedImage(const std::string &key, const Image &i) {
+  CachedImageHeader h = { i.width, i.height, i.dataSize };
+  std::string blob(reinterpret_cast<const char*>(&h), sizeof(h));
+  blob.append(i.data, i.dataSize);
+  resource_cache.Store(key, blob);
+}
+
+// Decoding images and reading sounds doesn't depend on anything else, so the Add* functions
+// only queue it, and Proto2ES runs the queue on a thread pool once every resource has its
+// slot. Each task fills in its own slot, so the result is the same on any number of threads.
+// Workers take one task at a time, which bounds the memory in flight to one image's
+// intermediate buffers per thread.
+static std::vector<std::function<void()>> conversions;
+static unsigned conversion_threads = 0;
+static size_t images_queued = 0;
+
+void SetConversionThreads(unsigned threads) {
+  conversion_threads = threads;
+}
+
+static void RunConversions() {
+  if (conversions.empty()) return;
+  auto start = std::chrono::steady_clock::now();
+  parallel_for(conversions.size(), [](size_t i) { conversions[i](); }, conversion_threads);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  unsigned threads = conversion_threads ? conversion_threads : std::thread::hardware_concurrency();
+  if (threads > conversions.size()) threads = conversions.size();
+  if (!threads) threads = 1;
+  printf("Converted %zu images and %zu other resources in %.3f s on %u threads (%.1f images/s)\n",
+         images_queued, conversions.size() - images_queued, elapsed.count(), threads,
+         elapsed.count() > 0 ? images_queued / elapsed.count() : 0.0);
+  conversions.clear();
+  images_queued = 0;
+}
+
+Image ConvertImage(const std::string &fname) {
   Image i = Image();
 
+  std::string png;
+  if (!ReadFileContents(fname, &png)) {
+    printf("error: cannot open image %s\n", fname.c_str());
+    return i;
+  }
+  std::string key;
+  if (resource_cache.Enabled()) {
+    key = ResourceCache::Key(png, kImageConversion);
+    if (LoadCachedImage(key, i)) return i;
+  }
+
   unsigned error;
   unsigned char* image;
   unsigned pngwidth, pngheight;
 
-  error = lodepng_decode32_file(&image, &pngwidth, &pngheight, fname.c_str());
+  error = lodepng_decode32(&image, &pngwidth, &pngheight,
+                           reinterpret_cast<const unsigned char*>(png.data()), png.size());
   if (error)
   {
     printf("error %u: %s\n", error, lodepng_error_text(error));
@@ -292,14 +382,23 @@ Image AddImage(const std::string fname) {
   }
 
   free(image);
+  uLongf compressed_size;
   i.width  = widfull;
   i.height = hgtfull;
-  i.data = reinterpret_cast<char*>(zlib_compress(bitmap, bitmap_size));
-  i.dataSize = bitmap_size;
+  i.data = reinterpret_cast<char*>(zlib_compress(bitmap, bitmap_size, compressed_size));
+  i.dataSize = compressed_size;  // Like LGM, and like a cache hit: the size of the zlib data.
+  delete[] bitmap;
 
+  if (resource_cache.Enabled()) StoreCachedImage(key, i);
   return i;
 }
 
+void AddImage(Image *image, const std::string &fname) {
+  *image = Image();
+  ++images_queued;
+  conversions.push_back([image, fname]() { *image = ConvertImage(fname); });
+}
+
 void AddResource(buffers::Game* protobuf, buffers::TreeNode* node) {
   for (int i = 0; i < node->child_size(); i++) {
     buffers::TreeNode* child = node->mutable_child(i);
@@ -385,6 +484,7 @@ EnigmaStruct* Proto2ES(buffers::Game* protobuf) {
   es->includes = AllocateGroup(&includes, es->includeCount, TypeCase::kInclude);
 
   AddResource(protobuf, root);
+  RunConversions();
 
   return es;
 }
@@ -415,7 +515,7 @@ void AddSprite(const char* name, const buffers::resources::Sprite& spr) {
   if (s.subImageCount > 0) {
     s.subImages = new SubImage[s.subImageCount];
     for (int i = 0; i < s.subImageCount; ++i) {
-      s.subImages[i].image = AddImage(spr.subimages(i));
+      AddImage(&s.subImages[i].image, spr.subimages(i));
     }
   }
 
@@ -436,22 +536,25 @@ void AddSound(const char* name, const buffers::resources::Sound& snd) {
   s.pan = snd.pan();
   s.preload = snd.preload();
 
-  // Open sound
-  FILE *afile = fopen(snd.data().c_str(),"rb");
-  if (!afile)
-    return;
-
-  // Buffer sound
-  fseek(afile,0,SEEK_END);
-  const size_t flen = ftell(afile);
-  unsigned char *fdata = new unsigned char[flen];
-  fseek(afile,0,SEEK_SET);
-  if (fread(fdata,1,flen,afile) != flen)
-    puts("WARNING: Resource stream cut short while loading sound data");
-  fclose(afile);
-
-  s.data = fdata;
-  s.size = flen;
+  const std::string fname = snd.data();
+  conversions.push_back([&s, fname]() {
+    // Open sound
+    FILE *afile = fopen(fname.c_str(),"rb");
+    if (!afile)
+      return;
+
+    // Buffer sound
+    fseek(afile,0,SEEK_END);
+    const size_t flen = ftell(afile);
+    unsigned char *fdata = new unsigned char[flen];
+    fseek(afile,0,SEEK_SET);
+    if (fread(fdata,1,flen,afile) != flen)
+      puts("WARNING: Resource stream cut short while loading sound data");
+    fclose(afile);
+
+    s.data = fdata;
+    s.size = flen;
+  });
 }
 
 void AddBackground(const char* name, const buffers::resources::Background& bkg) {
@@ -473,7 +576,7 @@ void AddBackground(const char* name, const buffers::resources::Background& bkg)
   b.hSep = bkg.horizontal_spacing();
   b.vSep = bkg.vertical_spacing();
 
-  b.backgroundImage = AddImage(bkg.image());
+  AddImage(&b.backgroundImage, bkg.image());
 }
 
 void AddPath(const char* name, const buffers::resources::Path& pth) {
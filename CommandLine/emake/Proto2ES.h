@@ -22,6 +22,12 @@
 
 #include "backend/EnigmaStruct.h"
 
+#include <string>
+
 EnigmaStruct* Proto2ES(buffers::Game* protobuf);
+// Where converted images are kept between builds; empty to convert them every time.
+void SetResourceCacheDirectory(const std::string &directory);
+// How many threads convert images and load sounds; zero for one per core.
+void SetConversionThreads(unsigned threads);
 
 #endif // ENIGMA_PROTO2ES_H
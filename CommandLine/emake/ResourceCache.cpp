@@ -0,0 +1,100 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "ResourceCache.hpp"
+
+#include <boost/filesystem.hpp>
+#include <zlib.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace fs = boost::filesystem;
+
+bool ReadFileContents(const std::string &fname, std::string *contents)
+{
+  FILE *f = fopen(fname.c_str(), "rb");
+  if (!f) return false;
+  fseek(f, 0, SEEK_END);
+  long len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  contents->resize(len > 0 ? len : 0);
+  size_t got = len > 0 ? fread(&(*contents)[0], 1, len, f) : 0;
+  fclose(f);
+  contents->resize(got);
+  return true;
+}
+
+void ResourceCache::SetDirectory(const std::string &directory)
+{
+  _directory = directory;
+  if (!_directory.empty() && _directory.back() != '/' && _directory.back() != '\\')
+    _directory += '/';
+}
+
+std::string ResourceCache::Key(const std::string &contents, const char *conversion)
+{
+  // Two unrelated hashes (FNV-1a and zlib's CRC-32) over the conversion name and
+  // the contents, plus the length; a false hit needs all three to collide.
+  uint64_t fnv = 0xcbf29ce484222325ULL;
+  for (const char *c = conversion; *c; ++c)
+    fnv = (fnv ^ (unsigned char) *c) * 0x100000001b3ULL;
+  fnv = (fnv ^ 0xFF) * 0x100000001b3ULL;
+  for (unsigned char c : contents)
+    fnv = (fnv ^ c) * 0x100000001b3ULL;
+
+  uLong crc = crc32(0L, Z_NULL, 0);
+  crc = crc32(crc, (const Bytef*) conversion, strlen(conversion));
+  crc = crc32(crc, (const Bytef*) contents.data(), contents.size());
+
+  char key[64];
+  snprintf(key, sizeof(key), "%016llx%08lx-%llx", (unsigned long long) fnv,
+           (unsigned long) crc, (unsigned long long) contents.size());
+  return key;
+}
+
+std::string ResourceCache::Path(const std::string &key) const
+{
+  // Fan out over the first byte of the hash to keep directories small.
+  return _directory + key.substr(0, 2) + "/" + key.substr(2);
+}
+
+bool ResourceCache::Load(const std::string &key, std::string *blob) const
+{
+  if (!Enabled()) return false;
+  return ReadFileContents(Path(key), blob);
+}
+
+void ResourceCache::Store(const std::string &key, const std::string &blob) const
+{
+  if (!Enabled()) return;
+  const fs::path path = Path(key);
+  boost::system::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+
+  // Write aside and rename into place, so a reader (or a build running at the
+  // same time) never sees half an entry.
+  const fs::path temp = fs::unique_path(path.string() + ".%%%%%%%%.tmp", ec);
+  if (ec) return;
+  FILE *f = fopen(temp.string().c_str(), "wb");
+  if (!f) return;
+  bool ok = fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+  ok = (fclose(f) == 0) && ok;
+  if (ok) fs::rename(temp, path, ec);
+  if (!ok || ec) fs::remove(temp, ec);
+}
@@ -0,0 +1,49 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef EMAKE_RESOURCECACHE_HPP
+#define EMAKE_RESOURCECACHE_HPP
+
+#include <string>
+
+// On-disk cache of converted resources, addressed by the contents of the
+// source file and the conversion applied to it. Entries never go stale, so
+// there is nothing to invalidate; deleting the directory is always safe.
+class ResourceCache
+{
+public:
+  // An empty directory disables the cache.
+  void SetDirectory(const std::string &directory);
+  bool Enabled() const { return !_directory.empty(); }
+
+  // Names the result of running the given conversion on the given file contents.
+  // Bump the conversion string whenever the converter's output changes.
+  static std::string Key(const std::string &contents, const char *conversion);
+
+  bool Load(const std::string &key, std::string *blob) const;
+  void Store(const std::string &key, const std::string &blob) const;
+
+private:
+  std::string Path(const std::string &key) const;
+
+  std::string _directory;
+};
+
+// Reads a whole file; returns false if it couldn't be opened.
+bool ReadFileContents(const std::string &fname, std::string *contents);
+
+#endif
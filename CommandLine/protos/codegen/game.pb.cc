@@ -0,0 +1,305 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: game.proto
+
+#include "game.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+PROTOBUF_CONSTEXPR Game::Game(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.root_)*/nullptr} {}
+struct GameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameDefaultTypeInternal() {}
+  union {
+    Game _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameDefaultTypeInternal _Game_default_instance_;
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_game_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_game_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_game_2eproto = nullptr;
+
+const uint32_t TableStruct_game_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::Game, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::Game, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::Game, _impl_.root_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::buffers::Game)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::_Game_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_game_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ngame.proto\022\007buffers\032\016treenode.proto\"\'\n"
+  "\004Game\022\037\n\004root\030\001 \001(\0132\021.buffers.TreeNode"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_game_2eproto_deps[1] = {
+  &::descriptor_table_treenode_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_game_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_game_2eproto = {
+    false, false, 78, descriptor_table_protodef_game_2eproto,
+    "game.proto",
+    &descriptor_table_game_2eproto_once, descriptor_table_game_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_game_2eproto::offsets,
+    file_level_metadata_game_2eproto, file_level_enum_descriptors_game_2eproto,
+    file_level_service_descriptors_game_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_game_2eproto_getter() {
+  return &descriptor_table_game_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_game_2eproto(&descriptor_table_game_2eproto);
+namespace buffers {
+
+// ===================================================================
+
+class Game::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Game>()._impl_._has_bits_);
+  static const ::buffers::TreeNode& root(const Game* msg);
+  static void set_has_root(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::buffers::TreeNode&
+Game::_Internal::root(const Game* msg) {
+  return *msg->_impl_.root_;
+}
+void Game::clear_root() {
+  if (_impl_.root_ != nullptr) _impl_.root_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+Game::Game(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.Game)
+}
+Game::Game(const Game& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Game* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.root_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_root()) {
+    _this->_impl_.root_ = new ::buffers::TreeNode(*from._impl_.root_);
+  }
+  // @@protoc_insertion_point(copy_constructor:buffers.Game)
+}
+
+inline void Game::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.root_){nullptr}
+  };
+}
+
+Game::~Game() {
+  // @@protoc_insertion_point(destructor:buffers.Game)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Game::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.root_;
+}
+
+void Game::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Game::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.Game)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.root_ != nullptr);
+    _impl_.root_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Game::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .buffers.TreeNode root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_root(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Game::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.Game)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .buffers.TreeNode root = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::root(this),
+        _Internal::root(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.Game)
+  return target;
+}
+
+size_t Game::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.Game)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .buffers.TreeNode root = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.root_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Game::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Game::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Game::GetClassData() const { return &_class_data_; }
+
+
+void Game::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Game*>(&to_msg);
+  auto& from = static_cast<const Game&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.Game)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_root()) {
+    _this->_internal_mutable_root()->::buffers::TreeNode::MergeFrom(
+        from._internal_root());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Game::CopyFrom(const Game& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.Game)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Game::IsInitialized() const {
+  return true;
+}
+
+void Game::InternalSwap(Game* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.root_, other->_impl_.root_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Game::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::Game*
+Arena::CreateMaybeMessage< ::buffers::Game >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::Game >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,332 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: game.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_game_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_game_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "treenode.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_game_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_game_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_game_2eproto;
+namespace buffers {
+class Game;
+struct GameDefaultTypeInternal;
+extern GameDefaultTypeInternal _Game_default_instance_;
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::Game* Arena::CreateMaybeMessage<::buffers::Game>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+
+// ===================================================================
+
+class Game final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.Game) */ {
+ public:
+  inline Game() : Game(nullptr) {}
+  ~Game() override;
+  explicit PROTOBUF_CONSTEXPR Game(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Game(const Game& from);
+  Game(Game&& from) noexcept
+    : Game() {
+    *this = ::std::move(from);
+  }
+
+  inline Game& operator=(const Game& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Game& operator=(Game&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Game& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Game* internal_default_instance() {
+    return reinterpret_cast<const Game*>(
+               &_Game_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Game& a, Game& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Game* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Game* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Game* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Game>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Game& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Game& from) {
+    Game::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Game* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.Game";
+  }
+  protected:
+  explicit Game(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRootFieldNumber = 1,
+  };
+  // optional .buffers.TreeNode root = 1;
+  bool has_root() const;
+  private:
+  bool _internal_has_root() const;
+  public:
+  void clear_root();
+  const ::buffers::TreeNode& root() const;
+  PROTOBUF_NODISCARD ::buffers::TreeNode* release_root();
+  ::buffers::TreeNode* mutable_root();
+  void set_allocated_root(::buffers::TreeNode* root);
+  private:
+  const ::buffers::TreeNode& _internal_root() const;
+  ::buffers::TreeNode* _internal_mutable_root();
+  public:
+  void unsafe_arena_set_allocated_root(
+      ::buffers::TreeNode* root);
+  ::buffers::TreeNode* unsafe_arena_release_root();
+
+  // @@protoc_insertion_point(class_scope:buffers.Game)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::buffers::TreeNode* root_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Game
+
+// optional .buffers.TreeNode root = 1;
+inline bool Game::_internal_has_root() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.root_ != nullptr);
+  return value;
+}
+inline bool Game::has_root() const {
+  return _internal_has_root();
+}
+inline const ::buffers::TreeNode& Game::_internal_root() const {
+  const ::buffers::TreeNode* p = _impl_.root_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::TreeNode&>(
+      ::buffers::_TreeNode_default_instance_);
+}
+inline const ::buffers::TreeNode& Game::root() const {
+  // @@protoc_insertion_point(field_get:buffers.Game.root)
+  return _internal_root();
+}
+inline void Game::unsafe_arena_set_allocated_root(
+    ::buffers::TreeNode* root) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.root_);
+  }
+  _impl_.root_ = root;
+  if (root) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.Game.root)
+}
+inline ::buffers::TreeNode* Game::release_root() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::TreeNode* temp = _impl_.root_;
+  _impl_.root_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::TreeNode* Game::unsafe_arena_release_root() {
+  // @@protoc_insertion_point(field_release:buffers.Game.root)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::TreeNode* temp = _impl_.root_;
+  _impl_.root_ = nullptr;
+  return temp;
+}
+inline ::buffers::TreeNode* Game::_internal_mutable_root() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::TreeNode>(GetArenaForAllocation());
+    _impl_.root_ = p;
+  }
+  return _impl_.root_;
+}
+inline ::buffers::TreeNode* Game::mutable_root() {
+  ::buffers::TreeNode* _msg = _internal_mutable_root();
+  // @@protoc_insertion_point(field_mutable:buffers.Game.root)
+  return _msg;
+}
+inline void Game::set_allocated_root(::buffers::TreeNode* root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.root_);
+  }
+  if (root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root));
+    if (message_arena != submessage_arena) {
+      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, root, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.root_ = root;
+  // @@protoc_insertion_point(field_set_allocated:buffers.Game.root)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_game_2eproto
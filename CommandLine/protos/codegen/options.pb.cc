@@ -0,0 +1,90 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: options.proto
+
+#include "options.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+}  // namespace buffers
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_options_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_options_2eproto = nullptr;
+const uint32_t TableStruct_options_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_options_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\roptions.proto\022\007buffers\032 google/protobu"
+  "f/descriptor.proto:1\n\010id_start\022\035.google."
+  "protobuf.FieldOptions\030\320\206\003 \001(\005:2\n\tfile_pa"
+  "th\022\035.google.protobuf.FieldOptions\030\321\206\003 \001("
+  "\010:,\n\003gmx\022\035.google.protobuf.FieldOptions\030"
+  "\322\206\003 \001(\t:/\n\006gmx_id\022\035.google.protobuf.Fiel"
+  "dOptions\030\323\206\003 \001(\t:,\n\003yyp\022\035.google.protobu"
+  "f.FieldOptions\030\324\206\003 \001(\t:/\n\006yyp_id\022\035.googl"
+  "e.protobuf.FieldOptions\030\325\206\003 \001(\t"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_options_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_options_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_options_2eproto = {
+    false, false, 351, descriptor_table_protodef_options_2eproto,
+    "options.proto",
+    &descriptor_table_options_2eproto_once, descriptor_table_options_2eproto_deps, 1, 0,
+    schemas, file_default_instances, TableStruct_options_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_options_2eproto,
+    file_level_service_descriptors_options_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_options_2eproto_getter() {
+  return &descriptor_table_options_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_options_2eproto(&descriptor_table_options_2eproto);
+namespace buffers {
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false>
+  id_start(kIdStartFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  file_path(kFilePathFieldNumber, false, nullptr);
+const std::string gmx_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  gmx(kGmxFieldNumber, gmx_default, nullptr);
+const std::string gmx_id_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  gmx_id(kGmxIdFieldNumber, gmx_id_default, nullptr);
+const std::string yyp_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  yyp(kYypFieldNumber, yyp_default, nullptr);
+const std::string yyp_id_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  yyp_id(kYypIdFieldNumber, yyp_id_default, nullptr);
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
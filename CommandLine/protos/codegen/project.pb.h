@@ -0,0 +1,332 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: project.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_project_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_project_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "game.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_project_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_project_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_project_2eproto;
+namespace buffers {
+class Project;
+struct ProjectDefaultTypeInternal;
+extern ProjectDefaultTypeInternal _Project_default_instance_;
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::Project* Arena::CreateMaybeMessage<::buffers::Project>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+
+// ===================================================================
+
+class Project final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.Project) */ {
+ public:
+  inline Project() : Project(nullptr) {}
+  ~Project() override;
+  explicit PROTOBUF_CONSTEXPR Project(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Project(const Project& from);
+  Project(Project&& from) noexcept
+    : Project() {
+    *this = ::std::move(from);
+  }
+
+  inline Project& operator=(const Project& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Project& operator=(Project&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Project& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Project* internal_default_instance() {
+    return reinterpret_cast<const Project*>(
+               &_Project_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Project& a, Project& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Project* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Project* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Project* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Project>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Project& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Project& from) {
+    Project::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Project* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.Project";
+  }
+  protected:
+  explicit Project(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGameFieldNumber = 1,
+  };
+  // optional .buffers.Game game = 1;
+  bool has_game() const;
+  private:
+  bool _internal_has_game() const;
+  public:
+  void clear_game();
+  const ::buffers::Game& game() const;
+  PROTOBUF_NODISCARD ::buffers::Game* release_game();
+  ::buffers::Game* mutable_game();
+  void set_allocated_game(::buffers::Game* game);
+  private:
+  const ::buffers::Game& _internal_game() const;
+  ::buffers::Game* _internal_mutable_game();
+  public:
+  void unsafe_arena_set_allocated_game(
+      ::buffers::Game* game);
+  ::buffers::Game* unsafe_arena_release_game();
+
+  // @@protoc_insertion_point(class_scope:buffers.Project)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::buffers::Game* game_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_project_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Project
+
+// optional .buffers.Game game = 1;
+inline bool Project::_internal_has_game() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.game_ != nullptr);
+  return value;
+}
+inline bool Project::has_game() const {
+  return _internal_has_game();
+}
+inline const ::buffers::Game& Project::_internal_game() const {
+  const ::buffers::Game* p = _impl_.game_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::Game&>(
+      ::buffers::_Game_default_instance_);
+}
+inline const ::buffers::Game& Project::game() const {
+  // @@protoc_insertion_point(field_get:buffers.Project.game)
+  return _internal_game();
+}
+inline void Project::unsafe_arena_set_allocated_game(
+    ::buffers::Game* game) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_);
+  }
+  _impl_.game_ = game;
+  if (game) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.Project.game)
+}
+inline ::buffers::Game* Project::release_game() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::Game* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::Game* Project::unsafe_arena_release_game() {
+  // @@protoc_insertion_point(field_release:buffers.Project.game)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::Game* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+  return temp;
+}
+inline ::buffers::Game* Project::_internal_mutable_game() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.game_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::Game>(GetArenaForAllocation());
+    _impl_.game_ = p;
+  }
+  return _impl_.game_;
+}
+inline ::buffers::Game* Project::mutable_game() {
+  ::buffers::Game* _msg = _internal_mutable_game();
+  // @@protoc_insertion_point(field_mutable:buffers.Project.game)
+  return _msg;
+}
+inline void Project::set_allocated_game(::buffers::Game* game) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_);
+  }
+  if (game) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(game));
+    if (message_arena != submessage_arena) {
+      game = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.game_ = game;
+  // @@protoc_insertion_point(field_set_allocated:buffers.Project.game)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_project_2eproto
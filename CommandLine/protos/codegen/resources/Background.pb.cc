@@ -0,0 +1,914 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Background.proto
+
+#include "resources/Background.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Background::Background(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.image_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.preload_)*/false
+  , /*decltype(_impl_.transparent_)*/false
+  , /*decltype(_impl_.smooth_edges_)*/false
+  , /*decltype(_impl_.use_as_tileset_)*/false
+  , /*decltype(_impl_.tile_width_)*/0
+  , /*decltype(_impl_.tile_height_)*/0
+  , /*decltype(_impl_.horizontal_offset_)*/0
+  , /*decltype(_impl_.vertical_offset_)*/0
+  , /*decltype(_impl_.horizontal_spacing_)*/0
+  , /*decltype(_impl_.vertical_spacing_)*/0
+  , /*decltype(_impl_.h_tile_)*/0
+  , /*decltype(_impl_.v_tile_)*/0
+  , /*decltype(_impl_.texture_group_)*/0
+  , /*decltype(_impl_.for3d_)*/false
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u} {}
+struct BackgroundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BackgroundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BackgroundDefaultTypeInternal() {}
+  union {
+    Background _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BackgroundDefaultTypeInternal _Background_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fBackground_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resources_2fBackground_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fBackground_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fBackground_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.preload_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.transparent_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.smooth_edges_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.use_as_tileset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.tile_width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.tile_height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.horizontal_offset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.vertical_offset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.horizontal_spacing_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.vertical_spacing_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.h_tile_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.v_tile_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.texture_group_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.for3d_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Background, _impl_.image_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 24, -1, sizeof(::buffers::resources::Background)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Background_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fBackground_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\032resources/Background.proto\022\021buffers.re"
+  "sources\032\roptions.proto\"\371\004\n\nBackground\022\036\n"
+  "\002id\030\002 \001(\005B\022\222\265\030\016GMX_DEPRECATED\022#\n\007preload"
+  "\030\004 \001(\010B\022\222\265\030\016GMX_DEPRECATED\022\'\n\013transparen"
+  "t\030\005 \001(\010B\022\222\265\030\016GMX_DEPRECATED\022(\n\014smooth_ed"
+  "ges\030\006 \001(\010B\022\222\265\030\016GMX_DEPRECATED\022%\n\016use_as_"
+  "tileset\030\007 \001(\010B\r\222\265\030\tistileset\022!\n\ntile_wid"
+  "th\030\013 \001(\005B\r\222\265\030\ttilewidth\022#\n\013tile_height\030\014"
+  " \001(\005B\016\222\265\030\ntileheight\022\'\n\021horizontal_offse"
+  "t\030\r \001(\005B\014\222\265\030\010tilexoff\022%\n\017vertical_offset"
+  "\030\016 \001(\005B\014\222\265\030\010tileyoff\022(\n\022horizontal_spaci"
+  "ng\030\017 \001(\005B\014\222\265\030\010tilehsep\022&\n\020vertical_spaci"
+  "ng\030\020 \001(\005B\014\222\265\030\010tilevsep\022\031\n\006h_tile\030\021 \001(\005B\t"
+  "\222\265\030\005HTile\022\031\n\006v_tile\030\022 \001(\005B\t\222\265\030\005VTile\0226\n\r"
+  "texture_group\030\023 \001(\005B\037\222\265\030\033TextureGroups/T"
+  "extureGroup0\022\030\n\005for3D\030\024 \001(\010B\t\222\265\030\005For3D\022\r"
+  "\n\005width\030\025 \001(\r\022\016\n\006height\030\026 \001(\r\022\033\n\005image\030\003"
+  " \001(\tB\014\222\265\030\004data\210\265\030\001"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fBackground_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fBackground_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fBackground_2eproto = {
+    false, false, 698, descriptor_table_protodef_resources_2fBackground_2eproto,
+    "resources/Background.proto",
+    &descriptor_table_resources_2fBackground_2eproto_once, descriptor_table_resources_2fBackground_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_resources_2fBackground_2eproto::offsets,
+    file_level_metadata_resources_2fBackground_2eproto, file_level_enum_descriptors_resources_2fBackground_2eproto,
+    file_level_service_descriptors_resources_2fBackground_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fBackground_2eproto_getter() {
+  return &descriptor_table_resources_2fBackground_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fBackground_2eproto(&descriptor_table_resources_2fBackground_2eproto);
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Background::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Background>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_preload(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_transparent(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_smooth_edges(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_use_as_tileset(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_tile_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_tile_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_horizontal_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_vertical_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_horizontal_spacing(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_vertical_spacing(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_h_tile(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_v_tile(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_texture_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_for3d(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_image(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Background::Background(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Background)
+}
+Background::Background(const Background& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Background* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.image_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.preload_){}
+    , decltype(_impl_.transparent_){}
+    , decltype(_impl_.smooth_edges_){}
+    , decltype(_impl_.use_as_tileset_){}
+    , decltype(_impl_.tile_width_){}
+    , decltype(_impl_.tile_height_){}
+    , decltype(_impl_.horizontal_offset_){}
+    , decltype(_impl_.vertical_offset_){}
+    , decltype(_impl_.horizontal_spacing_){}
+    , decltype(_impl_.vertical_spacing_){}
+    , decltype(_impl_.h_tile_){}
+    , decltype(_impl_.v_tile_){}
+    , decltype(_impl_.texture_group_){}
+    , decltype(_impl_.for3d_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.image_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_image()) {
+    _this->_impl_.image_.Set(from._internal_image(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Background)
+}
+
+inline void Background::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.image_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.preload_){false}
+    , decltype(_impl_.transparent_){false}
+    , decltype(_impl_.smooth_edges_){false}
+    , decltype(_impl_.use_as_tileset_){false}
+    , decltype(_impl_.tile_width_){0}
+    , decltype(_impl_.tile_height_){0}
+    , decltype(_impl_.horizontal_offset_){0}
+    , decltype(_impl_.vertical_offset_){0}
+    , decltype(_impl_.horizontal_spacing_){0}
+    , decltype(_impl_.vertical_spacing_){0}
+    , decltype(_impl_.h_tile_){0}
+    , decltype(_impl_.v_tile_){0}
+    , decltype(_impl_.texture_group_){0}
+    , decltype(_impl_.for3d_){false}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+  };
+  _impl_.image_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Background::~Background() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Background)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Background::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.image_.Destroy();
+}
+
+void Background::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Background::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Background)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.image_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tile_height_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.tile_height_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.horizontal_offset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.for3d_) -
+        reinterpret_cast<char*>(&_impl_.horizontal_offset_)) + sizeof(_impl_.for3d_));
+  }
+  if (cached_has_bits & 0x00030000u) {
+    ::memset(&_impl_.width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.height_) -
+        reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Background::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string image = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "data"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_image();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Background.image");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_preload(&has_bits);
+          _impl_.preload_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_transparent(&has_bits);
+          _impl_.transparent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_smooth_edges(&has_bits);
+          _impl_.smooth_edges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool use_as_tileset = 7 [(.buffers.gmx) = "istileset"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_use_as_tileset(&has_bits);
+          _impl_.use_as_tileset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 tile_width = 11 [(.buffers.gmx) = "tilewidth"];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_tile_width(&has_bits);
+          _impl_.tile_width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 tile_height = 12 [(.buffers.gmx) = "tileheight"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_tile_height(&has_bits);
+          _impl_.tile_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 horizontal_offset = 13 [(.buffers.gmx) = "tilexoff"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_horizontal_offset(&has_bits);
+          _impl_.horizontal_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 vertical_offset = 14 [(.buffers.gmx) = "tileyoff"];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_vertical_offset(&has_bits);
+          _impl_.vertical_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 horizontal_spacing = 15 [(.buffers.gmx) = "tilehsep"];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_horizontal_spacing(&has_bits);
+          _impl_.horizontal_spacing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 vertical_spacing = 16 [(.buffers.gmx) = "tilevsep"];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_vertical_spacing(&has_bits);
+          _impl_.vertical_spacing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 h_tile = 17 [(.buffers.gmx) = "HTile"];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_h_tile(&has_bits);
+          _impl_.h_tile_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 v_tile = 18 [(.buffers.gmx) = "VTile"];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_v_tile(&has_bits);
+          _impl_.v_tile_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 texture_group = 19 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_texture_group(&has_bits);
+          _impl_.texture_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool for3D = 20 [(.buffers.gmx) = "For3D"];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_for3d(&has_bits);
+          _impl_.for3d_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 width = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 height = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Background::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Background)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional string image = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "data"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_image().data(), static_cast<int>(this->_internal_image().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Background.image");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_image(), target);
+  }
+
+  // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_preload(), target);
+  }
+
+  // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_transparent(), target);
+  }
+
+  // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_smooth_edges(), target);
+  }
+
+  // optional bool use_as_tileset = 7 [(.buffers.gmx) = "istileset"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_use_as_tileset(), target);
+  }
+
+  // optional int32 tile_width = 11 [(.buffers.gmx) = "tilewidth"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_tile_width(), target);
+  }
+
+  // optional int32 tile_height = 12 [(.buffers.gmx) = "tileheight"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_tile_height(), target);
+  }
+
+  // optional int32 horizontal_offset = 13 [(.buffers.gmx) = "tilexoff"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_horizontal_offset(), target);
+  }
+
+  // optional int32 vertical_offset = 14 [(.buffers.gmx) = "tileyoff"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_vertical_offset(), target);
+  }
+
+  // optional int32 horizontal_spacing = 15 [(.buffers.gmx) = "tilehsep"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_horizontal_spacing(), target);
+  }
+
+  // optional int32 vertical_spacing = 16 [(.buffers.gmx) = "tilevsep"];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_vertical_spacing(), target);
+  }
+
+  // optional int32 h_tile = 17 [(.buffers.gmx) = "HTile"];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(17, this->_internal_h_tile(), target);
+  }
+
+  // optional int32 v_tile = 18 [(.buffers.gmx) = "VTile"];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_v_tile(), target);
+  }
+
+  // optional int32 texture_group = 19 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_texture_group(), target);
+  }
+
+  // optional bool for3D = 20 [(.buffers.gmx) = "For3D"];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(20, this->_internal_for3d(), target);
+  }
+
+  // optional uint32 width = 21;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(21, this->_internal_width(), target);
+  }
+
+  // optional uint32 height = 22;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(22, this->_internal_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Background)
+  return target;
+}
+
+size_t Background::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Background)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string image = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "data"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_image());
+    }
+
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool use_as_tileset = 7 [(.buffers.gmx) = "istileset"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 tile_width = 11 [(.buffers.gmx) = "tilewidth"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tile_width());
+    }
+
+    // optional int32 tile_height = 12 [(.buffers.gmx) = "tileheight"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tile_height());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional int32 horizontal_offset = 13 [(.buffers.gmx) = "tilexoff"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_horizontal_offset());
+    }
+
+    // optional int32 vertical_offset = 14 [(.buffers.gmx) = "tileyoff"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vertical_offset());
+    }
+
+    // optional int32 horizontal_spacing = 15 [(.buffers.gmx) = "tilehsep"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_horizontal_spacing());
+    }
+
+    // optional int32 vertical_spacing = 16 [(.buffers.gmx) = "tilevsep"];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_vertical_spacing());
+    }
+
+    // optional int32 h_tile = 17 [(.buffers.gmx) = "HTile"];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_h_tile());
+    }
+
+    // optional int32 v_tile = 18 [(.buffers.gmx) = "VTile"];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_v_tile());
+    }
+
+    // optional int32 texture_group = 19 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_texture_group());
+    }
+
+    // optional bool for3D = 20 [(.buffers.gmx) = "For3D"];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00030000u) {
+    // optional uint32 width = 21;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_width());
+    }
+
+    // optional uint32 height = 22;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_height());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Background::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Background::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Background::GetClassData() const { return &_class_data_; }
+
+
+void Background::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Background*>(&to_msg);
+  auto& from = static_cast<const Background&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Background)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_image(from._internal_image());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.preload_ = from._impl_.preload_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.transparent_ = from._impl_.transparent_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.smooth_edges_ = from._impl_.smooth_edges_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.use_as_tileset_ = from._impl_.use_as_tileset_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.tile_width_ = from._impl_.tile_width_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.tile_height_ = from._impl_.tile_height_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.horizontal_offset_ = from._impl_.horizontal_offset_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.vertical_offset_ = from._impl_.vertical_offset_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.horizontal_spacing_ = from._impl_.horizontal_spacing_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.vertical_spacing_ = from._impl_.vertical_spacing_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.h_tile_ = from._impl_.h_tile_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.v_tile_ = from._impl_.v_tile_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.texture_group_ = from._impl_.texture_group_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.for3d_ = from._impl_.for3d_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00030000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Background::CopyFrom(const Background& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Background)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Background::IsInitialized() const {
+  return true;
+}
+
+void Background::InternalSwap(Background* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_, lhs_arena,
+      &other->_impl_.image_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Background, _impl_.height_)
+      + sizeof(Background::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(Background, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Background::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fBackground_2eproto_getter, &descriptor_table_resources_2fBackground_2eproto_once,
+      file_level_metadata_resources_2fBackground_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Background*
+Arena::CreateMaybeMessage< ::buffers::resources::Background >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Background >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
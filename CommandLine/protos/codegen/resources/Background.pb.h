@@ -0,0 +1,1048 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Background.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fBackground_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fBackground_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fBackground_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fBackground_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fBackground_2eproto;
+namespace buffers {
+namespace resources {
+class Background;
+struct BackgroundDefaultTypeInternal;
+extern BackgroundDefaultTypeInternal _Background_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Background* Arena::CreateMaybeMessage<::buffers::resources::Background>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Background final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Background) */ {
+ public:
+  inline Background() : Background(nullptr) {}
+  ~Background() override;
+  explicit PROTOBUF_CONSTEXPR Background(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Background(const Background& from);
+  Background(Background&& from) noexcept
+    : Background() {
+    *this = ::std::move(from);
+  }
+
+  inline Background& operator=(const Background& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Background& operator=(Background&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Background& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Background* internal_default_instance() {
+    return reinterpret_cast<const Background*>(
+               &_Background_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Background& a, Background& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Background* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Background* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Background* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Background>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Background& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Background& from) {
+    Background::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Background* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Background";
+  }
+  protected:
+  explicit Background(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kImageFieldNumber = 3,
+    kIdFieldNumber = 2,
+    kPreloadFieldNumber = 4,
+    kTransparentFieldNumber = 5,
+    kSmoothEdgesFieldNumber = 6,
+    kUseAsTilesetFieldNumber = 7,
+    kTileWidthFieldNumber = 11,
+    kTileHeightFieldNumber = 12,
+    kHorizontalOffsetFieldNumber = 13,
+    kVerticalOffsetFieldNumber = 14,
+    kHorizontalSpacingFieldNumber = 15,
+    kVerticalSpacingFieldNumber = 16,
+    kHTileFieldNumber = 17,
+    kVTileFieldNumber = 18,
+    kTextureGroupFieldNumber = 19,
+    kFor3DFieldNumber = 20,
+    kWidthFieldNumber = 21,
+    kHeightFieldNumber = 22,
+  };
+  // optional string image = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "data"];
+  bool has_image() const;
+  private:
+  bool _internal_has_image() const;
+  public:
+  void clear_image();
+  const std::string& image() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_image(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_image();
+  PROTOBUF_NODISCARD std::string* release_image();
+  void set_allocated_image(std::string* image);
+  private:
+  const std::string& _internal_image() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_image(const std::string& value);
+  std::string* _internal_mutable_image();
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_preload() const;
+  private:
+  bool _internal_has_preload() const;
+  public:
+  void clear_preload();
+  bool preload() const;
+  void set_preload(bool value);
+  private:
+  bool _internal_preload() const;
+  void _internal_set_preload(bool value);
+  public:
+
+  // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_transparent() const;
+  private:
+  bool _internal_has_transparent() const;
+  public:
+  void clear_transparent();
+  bool transparent() const;
+  void set_transparent(bool value);
+  private:
+  bool _internal_transparent() const;
+  void _internal_set_transparent(bool value);
+  public:
+
+  // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_smooth_edges() const;
+  private:
+  bool _internal_has_smooth_edges() const;
+  public:
+  void clear_smooth_edges();
+  bool smooth_edges() const;
+  void set_smooth_edges(bool value);
+  private:
+  bool _internal_smooth_edges() const;
+  void _internal_set_smooth_edges(bool value);
+  public:
+
+  // optional bool use_as_tileset = 7 [(.buffers.gmx) = "istileset"];
+  bool has_use_as_tileset() const;
+  private:
+  bool _internal_has_use_as_tileset() const;
+  public:
+  void clear_use_as_tileset();
+  bool use_as_tileset() const;
+  void set_use_as_tileset(bool value);
+  private:
+  bool _internal_use_as_tileset() const;
+  void _internal_set_use_as_tileset(bool value);
+  public:
+
+  // optional int32 tile_width = 11 [(.buffers.gmx) = "tilewidth"];
+  bool has_tile_width() const;
+  private:
+  bool _internal_has_tile_width() const;
+  public:
+  void clear_tile_width();
+  int32_t tile_width() const;
+  void set_tile_width(int32_t value);
+  private:
+  int32_t _internal_tile_width() const;
+  void _internal_set_tile_width(int32_t value);
+  public:
+
+  // optional int32 tile_height = 12 [(.buffers.gmx) = "tileheight"];
+  bool has_tile_height() const;
+  private:
+  bool _internal_has_tile_height() const;
+  public:
+  void clear_tile_height();
+  int32_t tile_height() const;
+  void set_tile_height(int32_t value);
+  private:
+  int32_t _internal_tile_height() const;
+  void _internal_set_tile_height(int32_t value);
+  public:
+
+  // optional int32 horizontal_offset = 13 [(.buffers.gmx) = "tilexoff"];
+  bool has_horizontal_offset() const;
+  private:
+  bool _internal_has_horizontal_offset() const;
+  public:
+  void clear_horizontal_offset();
+  int32_t horizontal_offset() const;
+  void set_horizontal_offset(int32_t value);
+  private:
+  int32_t _internal_horizontal_offset() const;
+  void _internal_set_horizontal_offset(int32_t value);
+  public:
+
+  // optional int32 vertical_offset = 14 [(.buffers.gmx) = "tileyoff"];
+  bool has_vertical_offset() const;
+  private:
+  bool _internal_has_vertical_offset() const;
+  public:
+  void clear_vertical_offset();
+  int32_t vertical_offset() const;
+  void set_vertical_offset(int32_t value);
+  private:
+  int32_t _internal_vertical_offset() const;
+  void _internal_set_vertical_offset(int32_t value);
+  public:
+
+  // optional int32 horizontal_spacing = 15 [(.buffers.gmx) = "tilehsep"];
+  bool has_horizontal_spacing() const;
+  private:
+  bool _internal_has_horizontal_spacing() const;
+  public:
+  void clear_horizontal_spacing();
+  int32_t horizontal_spacing() const;
+  void set_horizontal_spacing(int32_t value);
+  private:
+  int32_t _internal_horizontal_spacing() const;
+  void _internal_set_horizontal_spacing(int32_t value);
+  public:
+
+  // optional int32 vertical_spacing = 16 [(.buffers.gmx) = "tilevsep"];
+  bool has_vertical_spacing() const;
+  private:
+  bool _internal_has_vertical_spacing() const;
+  public:
+  void clear_vertical_spacing();
+  int32_t vertical_spacing() const;
+  void set_vertical_spacing(int32_t value);
+  private:
+  int32_t _internal_vertical_spacing() const;
+  void _internal_set_vertical_spacing(int32_t value);
+  public:
+
+  // optional int32 h_tile = 17 [(.buffers.gmx) = "HTile"];
+  bool has_h_tile() const;
+  private:
+  bool _internal_has_h_tile() const;
+  public:
+  void clear_h_tile();
+  int32_t h_tile() const;
+  void set_h_tile(int32_t value);
+  private:
+  int32_t _internal_h_tile() const;
+  void _internal_set_h_tile(int32_t value);
+  public:
+
+  // optional int32 v_tile = 18 [(.buffers.gmx) = "VTile"];
+  bool has_v_tile() const;
+  private:
+  bool _internal_has_v_tile() const;
+  public:
+  void clear_v_tile();
+  int32_t v_tile() const;
+  void set_v_tile(int32_t value);
+  private:
+  int32_t _internal_v_tile() const;
+  void _internal_set_v_tile(int32_t value);
+  public:
+
+  // optional int32 texture_group = 19 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+  bool has_texture_group() const;
+  private:
+  bool _internal_has_texture_group() const;
+  public:
+  void clear_texture_group();
+  int32_t texture_group() const;
+  void set_texture_group(int32_t value);
+  private:
+  int32_t _internal_texture_group() const;
+  void _internal_set_texture_group(int32_t value);
+  public:
+
+  // optional bool for3D = 20 [(.buffers.gmx) = "For3D"];
+  bool has_for3d() const;
+  private:
+  bool _internal_has_for3d() const;
+  public:
+  void clear_for3d();
+  bool for3d() const;
+  void set_for3d(bool value);
+  private:
+  bool _internal_for3d() const;
+  void _internal_set_for3d(bool value);
+  public:
+
+  // optional uint32 width = 21;
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // optional uint32 height = 22;
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Background)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_;
+    int32_t id_;
+    bool preload_;
+    bool transparent_;
+    bool smooth_edges_;
+    bool use_as_tileset_;
+    int32_t tile_width_;
+    int32_t tile_height_;
+    int32_t horizontal_offset_;
+    int32_t vertical_offset_;
+    int32_t horizontal_spacing_;
+    int32_t vertical_spacing_;
+    int32_t h_tile_;
+    int32_t v_tile_;
+    int32_t texture_group_;
+    bool for3d_;
+    uint32_t width_;
+    uint32_t height_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fBackground_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Background
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Background::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Background::has_id() const {
+  return _internal_has_id();
+}
+inline void Background::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Background::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Background::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.id)
+  return _internal_id();
+}
+inline void Background::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void Background::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.id)
+}
+
+// optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Background::_internal_has_preload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Background::has_preload() const {
+  return _internal_has_preload();
+}
+inline void Background::clear_preload() {
+  _impl_.preload_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Background::_internal_preload() const {
+  return _impl_.preload_;
+}
+inline bool Background::preload() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.preload)
+  return _internal_preload();
+}
+inline void Background::_internal_set_preload(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.preload_ = value;
+}
+inline void Background::set_preload(bool value) {
+  _internal_set_preload(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.preload)
+}
+
+// optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Background::_internal_has_transparent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Background::has_transparent() const {
+  return _internal_has_transparent();
+}
+inline void Background::clear_transparent() {
+  _impl_.transparent_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool Background::_internal_transparent() const {
+  return _impl_.transparent_;
+}
+inline bool Background::transparent() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.transparent)
+  return _internal_transparent();
+}
+inline void Background::_internal_set_transparent(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.transparent_ = value;
+}
+inline void Background::set_transparent(bool value) {
+  _internal_set_transparent(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.transparent)
+}
+
+// optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Background::_internal_has_smooth_edges() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Background::has_smooth_edges() const {
+  return _internal_has_smooth_edges();
+}
+inline void Background::clear_smooth_edges() {
+  _impl_.smooth_edges_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Background::_internal_smooth_edges() const {
+  return _impl_.smooth_edges_;
+}
+inline bool Background::smooth_edges() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.smooth_edges)
+  return _internal_smooth_edges();
+}
+inline void Background::_internal_set_smooth_edges(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.smooth_edges_ = value;
+}
+inline void Background::set_smooth_edges(bool value) {
+  _internal_set_smooth_edges(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.smooth_edges)
+}
+
+// optional bool use_as_tileset = 7 [(.buffers.gmx) = "istileset"];
+inline bool Background::_internal_has_use_as_tileset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Background::has_use_as_tileset() const {
+  return _internal_has_use_as_tileset();
+}
+inline void Background::clear_use_as_tileset() {
+  _impl_.use_as_tileset_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Background::_internal_use_as_tileset() const {
+  return _impl_.use_as_tileset_;
+}
+inline bool Background::use_as_tileset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.use_as_tileset)
+  return _internal_use_as_tileset();
+}
+inline void Background::_internal_set_use_as_tileset(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.use_as_tileset_ = value;
+}
+inline void Background::set_use_as_tileset(bool value) {
+  _internal_set_use_as_tileset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.use_as_tileset)
+}
+
+// optional int32 tile_width = 11 [(.buffers.gmx) = "tilewidth"];
+inline bool Background::_internal_has_tile_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Background::has_tile_width() const {
+  return _internal_has_tile_width();
+}
+inline void Background::clear_tile_width() {
+  _impl_.tile_width_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Background::_internal_tile_width() const {
+  return _impl_.tile_width_;
+}
+inline int32_t Background::tile_width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.tile_width)
+  return _internal_tile_width();
+}
+inline void Background::_internal_set_tile_width(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.tile_width_ = value;
+}
+inline void Background::set_tile_width(int32_t value) {
+  _internal_set_tile_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.tile_width)
+}
+
+// optional int32 tile_height = 12 [(.buffers.gmx) = "tileheight"];
+inline bool Background::_internal_has_tile_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Background::has_tile_height() const {
+  return _internal_has_tile_height();
+}
+inline void Background::clear_tile_height() {
+  _impl_.tile_height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Background::_internal_tile_height() const {
+  return _impl_.tile_height_;
+}
+inline int32_t Background::tile_height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.tile_height)
+  return _internal_tile_height();
+}
+inline void Background::_internal_set_tile_height(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.tile_height_ = value;
+}
+inline void Background::set_tile_height(int32_t value) {
+  _internal_set_tile_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.tile_height)
+}
+
+// optional int32 horizontal_offset = 13 [(.buffers.gmx) = "tilexoff"];
+inline bool Background::_internal_has_horizontal_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Background::has_horizontal_offset() const {
+  return _internal_has_horizontal_offset();
+}
+inline void Background::clear_horizontal_offset() {
+  _impl_.horizontal_offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t Background::_internal_horizontal_offset() const {
+  return _impl_.horizontal_offset_;
+}
+inline int32_t Background::horizontal_offset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.horizontal_offset)
+  return _internal_horizontal_offset();
+}
+inline void Background::_internal_set_horizontal_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.horizontal_offset_ = value;
+}
+inline void Background::set_horizontal_offset(int32_t value) {
+  _internal_set_horizontal_offset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.horizontal_offset)
+}
+
+// optional int32 vertical_offset = 14 [(.buffers.gmx) = "tileyoff"];
+inline bool Background::_internal_has_vertical_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Background::has_vertical_offset() const {
+  return _internal_has_vertical_offset();
+}
+inline void Background::clear_vertical_offset() {
+  _impl_.vertical_offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t Background::_internal_vertical_offset() const {
+  return _impl_.vertical_offset_;
+}
+inline int32_t Background::vertical_offset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.vertical_offset)
+  return _internal_vertical_offset();
+}
+inline void Background::_internal_set_vertical_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.vertical_offset_ = value;
+}
+inline void Background::set_vertical_offset(int32_t value) {
+  _internal_set_vertical_offset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.vertical_offset)
+}
+
+// optional int32 horizontal_spacing = 15 [(.buffers.gmx) = "tilehsep"];
+inline bool Background::_internal_has_horizontal_spacing() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Background::has_horizontal_spacing() const {
+  return _internal_has_horizontal_spacing();
+}
+inline void Background::clear_horizontal_spacing() {
+  _impl_.horizontal_spacing_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t Background::_internal_horizontal_spacing() const {
+  return _impl_.horizontal_spacing_;
+}
+inline int32_t Background::horizontal_spacing() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.horizontal_spacing)
+  return _internal_horizontal_spacing();
+}
+inline void Background::_internal_set_horizontal_spacing(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.horizontal_spacing_ = value;
+}
+inline void Background::set_horizontal_spacing(int32_t value) {
+  _internal_set_horizontal_spacing(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.horizontal_spacing)
+}
+
+// optional int32 vertical_spacing = 16 [(.buffers.gmx) = "tilevsep"];
+inline bool Background::_internal_has_vertical_spacing() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Background::has_vertical_spacing() const {
+  return _internal_has_vertical_spacing();
+}
+inline void Background::clear_vertical_spacing() {
+  _impl_.vertical_spacing_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t Background::_internal_vertical_spacing() const {
+  return _impl_.vertical_spacing_;
+}
+inline int32_t Background::vertical_spacing() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.vertical_spacing)
+  return _internal_vertical_spacing();
+}
+inline void Background::_internal_set_vertical_spacing(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.vertical_spacing_ = value;
+}
+inline void Background::set_vertical_spacing(int32_t value) {
+  _internal_set_vertical_spacing(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.vertical_spacing)
+}
+
+// optional int32 h_tile = 17 [(.buffers.gmx) = "HTile"];
+inline bool Background::_internal_has_h_tile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Background::has_h_tile() const {
+  return _internal_has_h_tile();
+}
+inline void Background::clear_h_tile() {
+  _impl_.h_tile_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t Background::_internal_h_tile() const {
+  return _impl_.h_tile_;
+}
+inline int32_t Background::h_tile() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.h_tile)
+  return _internal_h_tile();
+}
+inline void Background::_internal_set_h_tile(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.h_tile_ = value;
+}
+inline void Background::set_h_tile(int32_t value) {
+  _internal_set_h_tile(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.h_tile)
+}
+
+// optional int32 v_tile = 18 [(.buffers.gmx) = "VTile"];
+inline bool Background::_internal_has_v_tile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Background::has_v_tile() const {
+  return _internal_has_v_tile();
+}
+inline void Background::clear_v_tile() {
+  _impl_.v_tile_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t Background::_internal_v_tile() const {
+  return _impl_.v_tile_;
+}
+inline int32_t Background::v_tile() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.v_tile)
+  return _internal_v_tile();
+}
+inline void Background::_internal_set_v_tile(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.v_tile_ = value;
+}
+inline void Background::set_v_tile(int32_t value) {
+  _internal_set_v_tile(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.v_tile)
+}
+
+// optional int32 texture_group = 19 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+inline bool Background::_internal_has_texture_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Background::has_texture_group() const {
+  return _internal_has_texture_group();
+}
+inline void Background::clear_texture_group() {
+  _impl_.texture_group_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t Background::_internal_texture_group() const {
+  return _impl_.texture_group_;
+}
+inline int32_t Background::texture_group() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.texture_group)
+  return _internal_texture_group();
+}
+inline void Background::_internal_set_texture_group(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.texture_group_ = value;
+}
+inline void Background::set_texture_group(int32_t value) {
+  _internal_set_texture_group(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.texture_group)
+}
+
+// optional bool for3D = 20 [(.buffers.gmx) = "For3D"];
+inline bool Background::_internal_has_for3d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Background::has_for3d() const {
+  return _internal_has_for3d();
+}
+inline void Background::clear_for3d() {
+  _impl_.for3d_ = false;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline bool Background::_internal_for3d() const {
+  return _impl_.for3d_;
+}
+inline bool Background::for3d() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.for3D)
+  return _internal_for3d();
+}
+inline void Background::_internal_set_for3d(bool value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.for3d_ = value;
+}
+inline void Background::set_for3d(bool value) {
+  _internal_set_for3d(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.for3D)
+}
+
+// optional uint32 width = 21;
+inline bool Background::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Background::has_width() const {
+  return _internal_has_width();
+}
+inline void Background::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint32_t Background::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t Background::width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.width)
+  return _internal_width();
+}
+inline void Background::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.width_ = value;
+}
+inline void Background::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.width)
+}
+
+// optional uint32 height = 22;
+inline bool Background::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Background::has_height() const {
+  return _internal_has_height();
+}
+inline void Background::clear_height() {
+  _impl_.height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint32_t Background::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t Background::height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.height)
+  return _internal_height();
+}
+inline void Background::_internal_set_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.height_ = value;
+}
+inline void Background::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.height)
+}
+
+// optional string image = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "data"];
+inline bool Background::_internal_has_image() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Background::has_image() const {
+  return _internal_has_image();
+}
+inline void Background::clear_image() {
+  _impl_.image_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Background::image() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Background.image)
+  return _internal_image();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Background::set_image(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.image_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Background.image)
+}
+inline std::string* Background::mutable_image() {
+  std::string* _s = _internal_mutable_image();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Background.image)
+  return _s;
+}
+inline const std::string& Background::_internal_image() const {
+  return _impl_.image_.Get();
+}
+inline void Background::_internal_set_image(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.image_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Background::_internal_mutable_image() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.image_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Background::release_image() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Background.image)
+  if (!_internal_has_image()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.image_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_.IsDefault()) {
+    _impl_.image_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Background::set_allocated_image(std::string* image) {
+  if (image != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.image_.SetAllocated(image, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_.IsDefault()) {
+    _impl_.image_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Background.image)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fBackground_2eproto
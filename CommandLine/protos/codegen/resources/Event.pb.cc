@@ -0,0 +1,2034 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Event.proto
+
+#include "resources/Event.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Argument::Argument(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ArgumentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArgumentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArgumentDefaultTypeInternal() {}
+  union {
+    Argument _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArgumentDefaultTypeInternal _Argument_default_instance_;
+PROTOBUF_CONSTEXPR Action::Action(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arguments_)*/{}
+  , /*decltype(_impl_.function_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_string_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.who_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.libid_)*/0
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.use_relative_)*/false
+  , /*decltype(_impl_.is_question_)*/false
+  , /*decltype(_impl_.use_apply_to_)*/false
+  , /*decltype(_impl_.relative_)*/false
+  , /*decltype(_impl_.exe_type_)*/0
+  , /*decltype(_impl_.is_not_)*/false} {}
+struct ActionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ActionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ActionDefaultTypeInternal() {}
+  union {
+    Action _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ActionDefaultTypeInternal _Action_default_instance_;
+PROTOBUF_CONSTEXPR Event::Event(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.actions_)*/{}
+  , /*decltype(_impl_.code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.reference_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct EventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventDefaultTypeInternal() {}
+  union {
+    Event _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventDefaultTypeInternal _Event_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fEvent_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_resources_2fEvent_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fEvent_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fEvent_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Argument, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Argument, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Argument, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Argument, _impl_.kind_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Argument, _impl_.value_),
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.libid_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.use_relative_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.is_question_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.use_apply_to_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.exe_type_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.function_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.code_string_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.who_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.relative_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.is_not_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Action, _impl_.arguments_),
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  10,
+  0,
+  1,
+  2,
+  9,
+  11,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_.type_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_.actions_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Event, _impl_.reference_),
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 18, -1, sizeof(::buffers::resources::Argument)},
+  { 29, 48, -1, sizeof(::buffers::resources::Action)},
+  { 61, 73, -1, sizeof(::buffers::resources::Event)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Argument_default_instance_._instance,
+  &::buffers::resources::_Action_default_instance_._instance,
+  &::buffers::resources::_Event_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fEvent_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025resources/Event.proto\022\021buffers.resourc"
+  "es\032\roptions.proto\"\365\001\n\010Argument\022-\n\004kind\030\001"
+  " \001(\0162\037.buffers.resources.ArgumentKind\022\020\n"
+  "\006string\030\002 \001(\tH\000\022\020\n\006sprite\030\003 \001(\tH\000\022\017\n\005sou"
+  "nd\030\004 \001(\tH\000\022\024\n\nbackground\030\005 \001(\tH\000\022\016\n\004path"
+  "\030\006 \001(\tH\000\022\020\n\006script\030\007 \001(\tH\000\022\020\n\006object\030\010 \001"
+  "(\tH\000\022\016\n\004room\030\t \001(\tH\000\022\016\n\004font\030\n \001(\tH\000\022\022\n\010"
+  "timeline\030\013 \001(\tH\000B\007\n\005value\"\347\003\n\006Action\022\r\n\005"
+  "libid\030\001 \001(\005\022\n\n\002id\030\002 \001(\005\022+\n\004kind\030\003 \001(\0162\035."
+  "buffers.resources.ActionKind\022%\n\014use_rela"
+  "tive\030\004 \001(\010B\017\222\265\030\013userelative\022#\n\013is_questi"
+  "on\030\005 \001(\010B\016\222\265\030\nisquestion\022$\n\014use_apply_to"
+  "\030\006 \001(\010B\016\222\265\030\nuseapplyto\022A\n\010exe_type\030\007 \001(\016"
+  "2\".buffers.resources.ActionExecutionB\013\222\265"
+  "\030\007exetype\022\'\n\rfunction_name\030\010 \001(\tB\020\222\265\030\014fu"
+  "nctionname\022#\n\013code_string\030\t \001(\tB\016\222\265\030\ncod"
+  "estring\022\035\n\010who_name\030\n \001(\tB\013\222\265\030\007whoName\022\020"
+  "\n\010relative\030\013 \001(\010\022\031\n\006is_not\030\014 \001(\010B\t\222\265\030\005is"
+  "not\022F\n\targuments\030\r \003(\0132\033.buffers.resourc"
+  "es.ArgumentB\026\222\265\030\022arguments/argument\"\330\001\n\005"
+  "Event\022\033\n\004type\030\001 \001(\005B\r\222\265\030\teventtype\022\033\n\006nu"
+  "mber\030\002 \001(\005B\t\222\265\030\005enumbH\000\022.\n\004name\030\003 \001(\tB\036\222"
+  "\265\030\005ename\252\265\030\021collisionObjectIdH\000\0226\n\007actio"
+  "ns\030\004 \003(\0132\031.buffers.resources.ActionB\n\222\265\030"
+  "\006action\022 \n\004code\030\005 \001(\tB\022\222\265\030\016GMX_DEPRECATE"
+  "DB\013\n\treference*\221\002\n\014ArgumentKind\022\022\n\016ARG_E"
+  "XPRESSION\020\000\022\016\n\nARG_STRING\020\001\022\014\n\010ARG_BOTH\020"
+  "\002\022\017\n\013ARG_BOOLEAN\020\003\022\014\n\010ARG_MENU\020\004\022\r\n\tARG_"
+  "COLOR\020\r\022\022\n\016ARG_FONTSTRING\020\017\022\016\n\nARG_SPRIT"
+  "E\020\005\022\r\n\tARG_SOUND\020\006\022\022\n\016ARG_BACKGROUND\020\007\022\014"
+  "\n\010ARG_PATH\020\010\022\016\n\nARG_SCRIPT\020\t\022\016\n\nARG_OBJE"
+  "CT\020\n\022\014\n\010ARG_ROOM\020\013\022\014\n\010ARG_FONT\020\014\022\020\n\014ARG_"
+  "TIMELINE\020\016*\273\001\n\nActionKind\022\016\n\nACT_NORMAL\020"
+  "\000\022\r\n\tACT_BEGIN\020\001\022\013\n\007ACT_END\020\002\022\014\n\010ACT_ELS"
+  "E\020\003\022\014\n\010ACT_EXIT\020\004\022\016\n\nACT_REPEAT\020\005\022\020\n\014ACT"
+  "_VARIABLE\020\006\022\014\n\010ACT_CODE\020\007\022\023\n\017ACT_PLACEHO"
+  "LDER\020\010\022\021\n\rACT_SEPARATOR\020\t\022\r\n\tACT_LABEL\020\n"
+  "*B\n\017ActionExecution\022\r\n\tEXEC_NONE\020\000\022\021\n\rEX"
+  "EC_FUNCTION\020\001\022\r\n\tEXEC_CODE\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fEvent_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fEvent_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fEvent_2eproto = {
+    false, false, 1548, descriptor_table_protodef_resources_2fEvent_2eproto,
+    "resources/Event.proto",
+    &descriptor_table_resources_2fEvent_2eproto_once, descriptor_table_resources_2fEvent_2eproto_deps, 1, 3,
+    schemas, file_default_instances, TableStruct_resources_2fEvent_2eproto::offsets,
+    file_level_metadata_resources_2fEvent_2eproto, file_level_enum_descriptors_resources_2fEvent_2eproto,
+    file_level_service_descriptors_resources_2fEvent_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fEvent_2eproto_getter() {
+  return &descriptor_table_resources_2fEvent_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fEvent_2eproto(&descriptor_table_resources_2fEvent_2eproto);
+namespace buffers {
+namespace resources {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ArgumentKind_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fEvent_2eproto);
+  return file_level_enum_descriptors_resources_2fEvent_2eproto[0];
+}
+bool ArgumentKind_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionKind_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fEvent_2eproto);
+  return file_level_enum_descriptors_resources_2fEvent_2eproto[1];
+}
+bool ActionKind_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionExecution_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fEvent_2eproto);
+  return file_level_enum_descriptors_resources_2fEvent_2eproto[2];
+}
+bool ActionExecution_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Argument::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Argument>()._impl_._has_bits_);
+  static void set_has_kind(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Argument::Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Argument)
+}
+Argument::Argument(const Argument& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Argument* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.kind_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.kind_ = from._impl_.kind_;
+  clear_has_value();
+  switch (from.value_case()) {
+    case kString: {
+      _this->_internal_set_string(from._internal_string());
+      break;
+    }
+    case kSprite: {
+      _this->_internal_set_sprite(from._internal_sprite());
+      break;
+    }
+    case kSound: {
+      _this->_internal_set_sound(from._internal_sound());
+      break;
+    }
+    case kBackground: {
+      _this->_internal_set_background(from._internal_background());
+      break;
+    }
+    case kPath: {
+      _this->_internal_set_path(from._internal_path());
+      break;
+    }
+    case kScript: {
+      _this->_internal_set_script(from._internal_script());
+      break;
+    }
+    case kObject: {
+      _this->_internal_set_object(from._internal_object());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_set_room(from._internal_room());
+      break;
+    }
+    case kFont: {
+      _this->_internal_set_font(from._internal_font());
+      break;
+    }
+    case kTimeline: {
+      _this->_internal_set_timeline(from._internal_timeline());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Argument)
+}
+
+inline void Argument::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.kind_){0}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+Argument::~Argument() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Argument)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Argument::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void Argument::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Argument::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:buffers.resources.Argument)
+  switch (value_case()) {
+    case kString: {
+      _impl_.value_.string_.Destroy();
+      break;
+    }
+    case kSprite: {
+      _impl_.value_.sprite_.Destroy();
+      break;
+    }
+    case kSound: {
+      _impl_.value_.sound_.Destroy();
+      break;
+    }
+    case kBackground: {
+      _impl_.value_.background_.Destroy();
+      break;
+    }
+    case kPath: {
+      _impl_.value_.path_.Destroy();
+      break;
+    }
+    case kScript: {
+      _impl_.value_.script_.Destroy();
+      break;
+    }
+    case kObject: {
+      _impl_.value_.object_.Destroy();
+      break;
+    }
+    case kRoom: {
+      _impl_.value_.room_.Destroy();
+      break;
+    }
+    case kFont: {
+      _impl_.value_.font_.Destroy();
+      break;
+    }
+    case kTimeline: {
+      _impl_.value_.timeline_.Destroy();
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void Argument::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Argument)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.kind_ = 0;
+  clear_value();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Argument::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .buffers.resources.ArgumentKind kind = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::ArgumentKind_IsValid(val))) {
+            _internal_set_kind(static_cast<::buffers::resources::ArgumentKind>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // string string = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.string");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string sprite = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_sprite();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.sprite");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string sound = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_sound();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.sound");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string background = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_background();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.background");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string path = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string script = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_script();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.script");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string object = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_object();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.object");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string room = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.room");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string font = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_font();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.font");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // string timeline = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_timeline();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Argument.timeline");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Argument::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Argument)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .buffers.resources.ArgumentKind kind = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_kind(), target);
+  }
+
+  switch (value_case()) {
+    case kString: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_string().data(), static_cast<int>(this->_internal_string().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.string");
+      target = stream->WriteStringMaybeAliased(
+          2, this->_internal_string(), target);
+      break;
+    }
+    case kSprite: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_sprite().data(), static_cast<int>(this->_internal_sprite().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.sprite");
+      target = stream->WriteStringMaybeAliased(
+          3, this->_internal_sprite(), target);
+      break;
+    }
+    case kSound: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_sound().data(), static_cast<int>(this->_internal_sound().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.sound");
+      target = stream->WriteStringMaybeAliased(
+          4, this->_internal_sound(), target);
+      break;
+    }
+    case kBackground: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_background().data(), static_cast<int>(this->_internal_background().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.background");
+      target = stream->WriteStringMaybeAliased(
+          5, this->_internal_background(), target);
+      break;
+    }
+    case kPath: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.path");
+      target = stream->WriteStringMaybeAliased(
+          6, this->_internal_path(), target);
+      break;
+    }
+    case kScript: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_script().data(), static_cast<int>(this->_internal_script().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.script");
+      target = stream->WriteStringMaybeAliased(
+          7, this->_internal_script(), target);
+      break;
+    }
+    case kObject: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_object().data(), static_cast<int>(this->_internal_object().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.object");
+      target = stream->WriteStringMaybeAliased(
+          8, this->_internal_object(), target);
+      break;
+    }
+    case kRoom: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.room");
+      target = stream->WriteStringMaybeAliased(
+          9, this->_internal_room(), target);
+      break;
+    }
+    case kFont: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_font().data(), static_cast<int>(this->_internal_font().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.font");
+      target = stream->WriteStringMaybeAliased(
+          10, this->_internal_font(), target);
+      break;
+    }
+    case kTimeline: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_timeline().data(), static_cast<int>(this->_internal_timeline().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Argument.timeline");
+      target = stream->WriteStringMaybeAliased(
+          11, this->_internal_timeline(), target);
+      break;
+    }
+    default: ;
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Argument)
+  return target;
+}
+
+size_t Argument::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Argument)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .buffers.resources.ArgumentKind kind = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
+  }
+
+  switch (value_case()) {
+    // string string = 2;
+    case kString: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_string());
+      break;
+    }
+    // string sprite = 3;
+    case kSprite: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_sprite());
+      break;
+    }
+    // string sound = 4;
+    case kSound: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_sound());
+      break;
+    }
+    // string background = 5;
+    case kBackground: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_background());
+      break;
+    }
+    // string path = 6;
+    case kPath: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path());
+      break;
+    }
+    // string script = 7;
+    case kScript: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_script());
+      break;
+    }
+    // string object = 8;
+    case kObject: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_object());
+      break;
+    }
+    // string room = 9;
+    case kRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_room());
+      break;
+    }
+    // string font = 10;
+    case kFont: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_font());
+      break;
+    }
+    // string timeline = 11;
+    case kTimeline: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_timeline());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Argument::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Argument::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Argument::GetClassData() const { return &_class_data_; }
+
+
+void Argument::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Argument*>(&to_msg);
+  auto& from = static_cast<const Argument&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Argument)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_kind()) {
+    _this->_internal_set_kind(from._internal_kind());
+  }
+  switch (from.value_case()) {
+    case kString: {
+      _this->_internal_set_string(from._internal_string());
+      break;
+    }
+    case kSprite: {
+      _this->_internal_set_sprite(from._internal_sprite());
+      break;
+    }
+    case kSound: {
+      _this->_internal_set_sound(from._internal_sound());
+      break;
+    }
+    case kBackground: {
+      _this->_internal_set_background(from._internal_background());
+      break;
+    }
+    case kPath: {
+      _this->_internal_set_path(from._internal_path());
+      break;
+    }
+    case kScript: {
+      _this->_internal_set_script(from._internal_script());
+      break;
+    }
+    case kObject: {
+      _this->_internal_set_object(from._internal_object());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_set_room(from._internal_room());
+      break;
+    }
+    case kFont: {
+      _this->_internal_set_font(from._internal_font());
+      break;
+    }
+    case kTimeline: {
+      _this->_internal_set_timeline(from._internal_timeline());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Argument::CopyFrom(const Argument& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Argument)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Argument::IsInitialized() const {
+  return true;
+}
+
+void Argument::InternalSwap(Argument* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.kind_, other->_impl_.kind_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Argument::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fEvent_2eproto_getter, &descriptor_table_resources_2fEvent_2eproto_once,
+      file_level_metadata_resources_2fEvent_2eproto[0]);
+}
+
+// ===================================================================
+
+class Action::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Action>()._impl_._has_bits_);
+  static void set_has_libid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_kind(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_use_relative(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_is_question(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_use_apply_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_exe_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_function_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_code_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_who_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_relative(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_is_not(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+};
+
+Action::Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Action)
+}
+Action::Action(const Action& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Action* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arguments_){from._impl_.arguments_}
+    , decltype(_impl_.function_name_){}
+    , decltype(_impl_.code_string_){}
+    , decltype(_impl_.who_name_){}
+    , decltype(_impl_.libid_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.kind_){}
+    , decltype(_impl_.use_relative_){}
+    , decltype(_impl_.is_question_){}
+    , decltype(_impl_.use_apply_to_){}
+    , decltype(_impl_.relative_){}
+    , decltype(_impl_.exe_type_){}
+    , decltype(_impl_.is_not_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.function_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.function_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_function_name()) {
+    _this->_impl_.function_name_.Set(from._internal_function_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.code_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_code_string()) {
+    _this->_impl_.code_string_.Set(from._internal_code_string(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.who_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.who_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_who_name()) {
+    _this->_impl_.who_name_.Set(from._internal_who_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.libid_, &from._impl_.libid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_not_) -
+    reinterpret_cast<char*>(&_impl_.libid_)) + sizeof(_impl_.is_not_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Action)
+}
+
+inline void Action::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arguments_){arena}
+    , decltype(_impl_.function_name_){}
+    , decltype(_impl_.code_string_){}
+    , decltype(_impl_.who_name_){}
+    , decltype(_impl_.libid_){0}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.kind_){0}
+    , decltype(_impl_.use_relative_){false}
+    , decltype(_impl_.is_question_){false}
+    , decltype(_impl_.use_apply_to_){false}
+    , decltype(_impl_.relative_){false}
+    , decltype(_impl_.exe_type_){0}
+    , decltype(_impl_.is_not_){false}
+  };
+  _impl_.function_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.function_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.code_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.who_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.who_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Action::~Action() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Action)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Action::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.arguments_.~RepeatedPtrField();
+  _impl_.function_name_.Destroy();
+  _impl_.code_string_.Destroy();
+  _impl_.who_name_.Destroy();
+}
+
+void Action::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Action::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Action)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.arguments_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.function_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.code_string_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.who_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.libid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_question_) -
+        reinterpret_cast<char*>(&_impl_.libid_)) + sizeof(_impl_.is_question_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.use_apply_to_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_not_) -
+        reinterpret_cast<char*>(&_impl_.use_apply_to_)) + sizeof(_impl_.is_not_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Action::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 libid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_libid(&has_bits);
+          _impl_.libid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.ActionKind kind = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::ActionKind_IsValid(val))) {
+            _internal_set_kind(static_cast<::buffers::resources::ActionKind>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool use_relative = 4 [(.buffers.gmx) = "userelative"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_use_relative(&has_bits);
+          _impl_.use_relative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_question = 5 [(.buffers.gmx) = "isquestion"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_is_question(&has_bits);
+          _impl_.is_question_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool use_apply_to = 6 [(.buffers.gmx) = "useapplyto"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_use_apply_to(&has_bits);
+          _impl_.use_apply_to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.ActionExecution exe_type = 7 [(.buffers.gmx) = "exetype"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::ActionExecution_IsValid(val))) {
+            _internal_set_exe_type(static_cast<::buffers::resources::ActionExecution>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(7, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string function_name = 8 [(.buffers.gmx) = "functionname"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_function_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Action.function_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string code_string = 9 [(.buffers.gmx) = "codestring"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_code_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Action.code_string");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string who_name = 10 [(.buffers.gmx) = "whoName"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_who_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Action.who_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool relative = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_relative(&has_bits);
+          _impl_.relative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_not = 12 [(.buffers.gmx) = "isnot"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_is_not(&has_bits);
+          _impl_.is_not_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Argument arguments = 13 [(.buffers.gmx) = "arguments/argument"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_arguments(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Action::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Action)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 libid = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_libid(), target);
+  }
+
+  // optional int32 id = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional .buffers.resources.ActionKind kind = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_kind(), target);
+  }
+
+  // optional bool use_relative = 4 [(.buffers.gmx) = "userelative"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_use_relative(), target);
+  }
+
+  // optional bool is_question = 5 [(.buffers.gmx) = "isquestion"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_is_question(), target);
+  }
+
+  // optional bool use_apply_to = 6 [(.buffers.gmx) = "useapplyto"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_use_apply_to(), target);
+  }
+
+  // optional .buffers.resources.ActionExecution exe_type = 7 [(.buffers.gmx) = "exetype"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_exe_type(), target);
+  }
+
+  // optional string function_name = 8 [(.buffers.gmx) = "functionname"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_function_name().data(), static_cast<int>(this->_internal_function_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Action.function_name");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_function_name(), target);
+  }
+
+  // optional string code_string = 9 [(.buffers.gmx) = "codestring"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_code_string().data(), static_cast<int>(this->_internal_code_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Action.code_string");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_code_string(), target);
+  }
+
+  // optional string who_name = 10 [(.buffers.gmx) = "whoName"];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_who_name().data(), static_cast<int>(this->_internal_who_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Action.who_name");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_who_name(), target);
+  }
+
+  // optional bool relative = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_relative(), target);
+  }
+
+  // optional bool is_not = 12 [(.buffers.gmx) = "isnot"];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_is_not(), target);
+  }
+
+  // repeated .buffers.resources.Argument arguments = 13 [(.buffers.gmx) = "arguments/argument"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_arguments_size()); i < n; i++) {
+    const auto& repfield = this->_internal_arguments(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(13, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Action)
+  return target;
+}
+
+size_t Action::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Action)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Argument arguments = 13 [(.buffers.gmx) = "arguments/argument"];
+  total_size += 1UL * this->_internal_arguments_size();
+  for (const auto& msg : this->_impl_.arguments_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string function_name = 8 [(.buffers.gmx) = "functionname"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_function_name());
+    }
+
+    // optional string code_string = 9 [(.buffers.gmx) = "codestring"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_code_string());
+    }
+
+    // optional string who_name = 10 [(.buffers.gmx) = "whoName"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_who_name());
+    }
+
+    // optional int32 libid = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_libid());
+    }
+
+    // optional int32 id = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional .buffers.resources.ActionKind kind = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
+    }
+
+    // optional bool use_relative = 4 [(.buffers.gmx) = "userelative"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool is_question = 5 [(.buffers.gmx) = "isquestion"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional bool use_apply_to = 6 [(.buffers.gmx) = "useapplyto"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool relative = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional .buffers.resources.ActionExecution exe_type = 7 [(.buffers.gmx) = "exetype"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_exe_type());
+    }
+
+    // optional bool is_not = 12 [(.buffers.gmx) = "isnot"];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Action::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Action::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Action::GetClassData() const { return &_class_data_; }
+
+
+void Action::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Action*>(&to_msg);
+  auto& from = static_cast<const Action&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Action)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.arguments_.MergeFrom(from._impl_.arguments_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_function_name(from._internal_function_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_code_string(from._internal_code_string());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_who_name(from._internal_who_name());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.libid_ = from._impl_.libid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.kind_ = from._impl_.kind_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.use_relative_ = from._impl_.use_relative_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.is_question_ = from._impl_.is_question_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.use_apply_to_ = from._impl_.use_apply_to_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.relative_ = from._impl_.relative_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.exe_type_ = from._impl_.exe_type_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.is_not_ = from._impl_.is_not_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Action::CopyFrom(const Action& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Action)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Action::IsInitialized() const {
+  return true;
+}
+
+void Action::InternalSwap(Action* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.arguments_.InternalSwap(&other->_impl_.arguments_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.function_name_, lhs_arena,
+      &other->_impl_.function_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.code_string_, lhs_arena,
+      &other->_impl_.code_string_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.who_name_, lhs_arena,
+      &other->_impl_.who_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Action, _impl_.is_not_)
+      + sizeof(Action::_impl_.is_not_)
+      - PROTOBUF_FIELD_OFFSET(Action, _impl_.libid_)>(
+          reinterpret_cast<char*>(&_impl_.libid_),
+          reinterpret_cast<char*>(&other->_impl_.libid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Action::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fEvent_2eproto_getter, &descriptor_table_resources_2fEvent_2eproto_once,
+      file_level_metadata_resources_2fEvent_2eproto[1]);
+}
+
+// ===================================================================
+
+class Event::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Event>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Event::Event(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Event)
+}
+Event::Event(const Event& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Event* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.actions_){from._impl_.actions_}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.reference_){}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_code()) {
+    _this->_impl_.code_.Set(from._internal_code(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  clear_has_reference();
+  switch (from.reference_case()) {
+    case kNumber: {
+      _this->_internal_set_number(from._internal_number());
+      break;
+    }
+    case kName: {
+      _this->_internal_set_name(from._internal_name());
+      break;
+    }
+    case REFERENCE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Event)
+}
+
+inline void Event::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.actions_){arena}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.reference_){}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_reference();
+}
+
+Event::~Event() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Event)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Event::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.actions_.~RepeatedPtrField();
+  _impl_.code_.Destroy();
+  if (has_reference()) {
+    clear_reference();
+  }
+}
+
+void Event::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Event::clear_reference() {
+// @@protoc_insertion_point(one_of_clear_start:buffers.resources.Event)
+  switch (reference_case()) {
+    case kNumber: {
+      // No need to clear
+      break;
+    }
+    case kName: {
+      _impl_.reference_.name_.Destroy();
+      break;
+    }
+    case REFERENCE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = REFERENCE_NOT_SET;
+}
+
+
+void Event::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Event)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.actions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.code_.ClearNonDefaultToEmpty();
+  }
+  _impl_.type_ = 0;
+  clear_reference();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Event::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type = 1 [(.buffers.gmx) = "eventtype"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 number = 2 [(.buffers.gmx) = "enumb"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _internal_set_number(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 3 [(.buffers.gmx) = "ename", (.buffers.yyp_id) = "collisionObjectId"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Event.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Action actions = 4 [(.buffers.gmx) = "action"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_actions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string code = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Event.code");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Event::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Event)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type = 1 [(.buffers.gmx) = "eventtype"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  switch (reference_case()) {
+    case kNumber: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_number(), target);
+      break;
+    }
+    case kName: {
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+        this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+        "buffers.resources.Event.name");
+      target = stream->WriteStringMaybeAliased(
+          3, this->_internal_name(), target);
+      break;
+    }
+    default: ;
+  }
+  // repeated .buffers.resources.Action actions = 4 [(.buffers.gmx) = "action"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_actions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_actions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional string code = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_code().data(), static_cast<int>(this->_internal_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Event.code");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_code(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Event)
+  return target;
+}
+
+size_t Event::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Event)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Action actions = 4 [(.buffers.gmx) = "action"];
+  total_size += 1UL * this->_internal_actions_size();
+  for (const auto& msg : this->_impl_.actions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string code = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_code());
+    }
+
+    // optional int32 type = 1 [(.buffers.gmx) = "eventtype"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+  }
+  switch (reference_case()) {
+    // int32 number = 2 [(.buffers.gmx) = "enumb"];
+    case kNumber: {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_number());
+      break;
+    }
+    // string name = 3 [(.buffers.gmx) = "ename", (.buffers.yyp_id) = "collisionObjectId"];
+    case kName: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+      break;
+    }
+    case REFERENCE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Event::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Event::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Event::GetClassData() const { return &_class_data_; }
+
+
+void Event::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Event*>(&to_msg);
+  auto& from = static_cast<const Event&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Event)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.actions_.MergeFrom(from._impl_.actions_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_code(from._internal_code());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.reference_case()) {
+    case kNumber: {
+      _this->_internal_set_number(from._internal_number());
+      break;
+    }
+    case kName: {
+      _this->_internal_set_name(from._internal_name());
+      break;
+    }
+    case REFERENCE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Event::CopyFrom(const Event& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Event)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Event::IsInitialized() const {
+  return true;
+}
+
+void Event::InternalSwap(Event* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.actions_.InternalSwap(&other->_impl_.actions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.code_, lhs_arena,
+      &other->_impl_.code_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.reference_, other->_impl_.reference_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Event::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fEvent_2eproto_getter, &descriptor_table_resources_2fEvent_2eproto_once,
+      file_level_metadata_resources_2fEvent_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Argument*
+Arena::CreateMaybeMessage< ::buffers::resources::Argument >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Argument >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Action*
+Arena::CreateMaybeMessage< ::buffers::resources::Action >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Action >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Event*
+Arena::CreateMaybeMessage< ::buffers::resources::Event >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Event >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2793 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Event.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fEvent_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fEvent_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fEvent_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fEvent_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fEvent_2eproto;
+namespace buffers {
+namespace resources {
+class Action;
+struct ActionDefaultTypeInternal;
+extern ActionDefaultTypeInternal _Action_default_instance_;
+class Argument;
+struct ArgumentDefaultTypeInternal;
+extern ArgumentDefaultTypeInternal _Argument_default_instance_;
+class Event;
+struct EventDefaultTypeInternal;
+extern EventDefaultTypeInternal _Event_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Action* Arena::CreateMaybeMessage<::buffers::resources::Action>(Arena*);
+template<> ::buffers::resources::Argument* Arena::CreateMaybeMessage<::buffers::resources::Argument>(Arena*);
+template<> ::buffers::resources::Event* Arena::CreateMaybeMessage<::buffers::resources::Event>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+enum ArgumentKind : int {
+  ARG_EXPRESSION = 0,
+  ARG_STRING = 1,
+  ARG_BOTH = 2,
+  ARG_BOOLEAN = 3,
+  ARG_MENU = 4,
+  ARG_COLOR = 13,
+  ARG_FONTSTRING = 15,
+  ARG_SPRITE = 5,
+  ARG_SOUND = 6,
+  ARG_BACKGROUND = 7,
+  ARG_PATH = 8,
+  ARG_SCRIPT = 9,
+  ARG_OBJECT = 10,
+  ARG_ROOM = 11,
+  ARG_FONT = 12,
+  ARG_TIMELINE = 14
+};
+bool ArgumentKind_IsValid(int value);
+constexpr ArgumentKind ArgumentKind_MIN = ARG_EXPRESSION;
+constexpr ArgumentKind ArgumentKind_MAX = ARG_FONTSTRING;
+constexpr int ArgumentKind_ARRAYSIZE = ArgumentKind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ArgumentKind_descriptor();
+template<typename T>
+inline const std::string& ArgumentKind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ArgumentKind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ArgumentKind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ArgumentKind_descriptor(), enum_t_value);
+}
+inline bool ArgumentKind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ArgumentKind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ArgumentKind>(
+    ArgumentKind_descriptor(), name, value);
+}
+enum ActionKind : int {
+  ACT_NORMAL = 0,
+  ACT_BEGIN = 1,
+  ACT_END = 2,
+  ACT_ELSE = 3,
+  ACT_EXIT = 4,
+  ACT_REPEAT = 5,
+  ACT_VARIABLE = 6,
+  ACT_CODE = 7,
+  ACT_PLACEHOLDER = 8,
+  ACT_SEPARATOR = 9,
+  ACT_LABEL = 10
+};
+bool ActionKind_IsValid(int value);
+constexpr ActionKind ActionKind_MIN = ACT_NORMAL;
+constexpr ActionKind ActionKind_MAX = ACT_LABEL;
+constexpr int ActionKind_ARRAYSIZE = ActionKind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionKind_descriptor();
+template<typename T>
+inline const std::string& ActionKind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ActionKind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ActionKind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ActionKind_descriptor(), enum_t_value);
+}
+inline bool ActionKind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ActionKind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ActionKind>(
+    ActionKind_descriptor(), name, value);
+}
+enum ActionExecution : int {
+  EXEC_NONE = 0,
+  EXEC_FUNCTION = 1,
+  EXEC_CODE = 2
+};
+bool ActionExecution_IsValid(int value);
+constexpr ActionExecution ActionExecution_MIN = EXEC_NONE;
+constexpr ActionExecution ActionExecution_MAX = EXEC_CODE;
+constexpr int ActionExecution_ARRAYSIZE = ActionExecution_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionExecution_descriptor();
+template<typename T>
+inline const std::string& ActionExecution_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ActionExecution>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ActionExecution_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ActionExecution_descriptor(), enum_t_value);
+}
+inline bool ActionExecution_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ActionExecution* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ActionExecution>(
+    ActionExecution_descriptor(), name, value);
+}
+// ===================================================================
+
+class Argument final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Argument) */ {
+ public:
+  inline Argument() : Argument(nullptr) {}
+  ~Argument() override;
+  explicit PROTOBUF_CONSTEXPR Argument(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Argument(const Argument& from);
+  Argument(Argument&& from) noexcept
+    : Argument() {
+    *this = ::std::move(from);
+  }
+
+  inline Argument& operator=(const Argument& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Argument& operator=(Argument&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Argument& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ValueCase {
+    kString = 2,
+    kSprite = 3,
+    kSound = 4,
+    kBackground = 5,
+    kPath = 6,
+    kScript = 7,
+    kObject = 8,
+    kRoom = 9,
+    kFont = 10,
+    kTimeline = 11,
+    VALUE_NOT_SET = 0,
+  };
+
+  static inline const Argument* internal_default_instance() {
+    return reinterpret_cast<const Argument*>(
+               &_Argument_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Argument& a, Argument& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Argument* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Argument* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Argument* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Argument>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Argument& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Argument& from) {
+    Argument::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Argument* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Argument";
+  }
+  protected:
+  explicit Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKindFieldNumber = 1,
+    kStringFieldNumber = 2,
+    kSpriteFieldNumber = 3,
+    kSoundFieldNumber = 4,
+    kBackgroundFieldNumber = 5,
+    kPathFieldNumber = 6,
+    kScriptFieldNumber = 7,
+    kObjectFieldNumber = 8,
+    kRoomFieldNumber = 9,
+    kFontFieldNumber = 10,
+    kTimelineFieldNumber = 11,
+  };
+  // optional .buffers.resources.ArgumentKind kind = 1;
+  bool has_kind() const;
+  private:
+  bool _internal_has_kind() const;
+  public:
+  void clear_kind();
+  ::buffers::resources::ArgumentKind kind() const;
+  void set_kind(::buffers::resources::ArgumentKind value);
+  private:
+  ::buffers::resources::ArgumentKind _internal_kind() const;
+  void _internal_set_kind(::buffers::resources::ArgumentKind value);
+  public:
+
+  // string string = 2;
+  bool has_string() const;
+  private:
+  bool _internal_has_string() const;
+  public:
+  void clear_string();
+  const std::string& string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string();
+  PROTOBUF_NODISCARD std::string* release_string();
+  void set_allocated_string(std::string* string);
+  private:
+  const std::string& _internal_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string(const std::string& value);
+  std::string* _internal_mutable_string();
+  public:
+
+  // string sprite = 3;
+  bool has_sprite() const;
+  private:
+  bool _internal_has_sprite() const;
+  public:
+  void clear_sprite();
+  const std::string& sprite() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sprite(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sprite();
+  PROTOBUF_NODISCARD std::string* release_sprite();
+  void set_allocated_sprite(std::string* sprite);
+  private:
+  const std::string& _internal_sprite() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sprite(const std::string& value);
+  std::string* _internal_mutable_sprite();
+  public:
+
+  // string sound = 4;
+  bool has_sound() const;
+  private:
+  bool _internal_has_sound() const;
+  public:
+  void clear_sound();
+  const std::string& sound() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sound(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sound();
+  PROTOBUF_NODISCARD std::string* release_sound();
+  void set_allocated_sound(std::string* sound);
+  private:
+  const std::string& _internal_sound() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sound(const std::string& value);
+  std::string* _internal_mutable_sound();
+  public:
+
+  // string background = 5;
+  bool has_background() const;
+  private:
+  bool _internal_has_background() const;
+  public:
+  void clear_background();
+  const std::string& background() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_background(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_background();
+  PROTOBUF_NODISCARD std::string* release_background();
+  void set_allocated_background(std::string* background);
+  private:
+  const std::string& _internal_background() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_background(const std::string& value);
+  std::string* _internal_mutable_background();
+  public:
+
+  // string path = 6;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string script = 7;
+  bool has_script() const;
+  private:
+  bool _internal_has_script() const;
+  public:
+  void clear_script();
+  const std::string& script() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_script(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_script();
+  PROTOBUF_NODISCARD std::string* release_script();
+  void set_allocated_script(std::string* script);
+  private:
+  const std::string& _internal_script() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_script(const std::string& value);
+  std::string* _internal_mutable_script();
+  public:
+
+  // string object = 8;
+  bool has_object() const;
+  private:
+  bool _internal_has_object() const;
+  public:
+  void clear_object();
+  const std::string& object() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_object(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_object();
+  PROTOBUF_NODISCARD std::string* release_object();
+  void set_allocated_object(std::string* object);
+  private:
+  const std::string& _internal_object() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object(const std::string& value);
+  std::string* _internal_mutable_object();
+  public:
+
+  // string room = 9;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // string font = 10;
+  bool has_font() const;
+  private:
+  bool _internal_has_font() const;
+  public:
+  void clear_font();
+  const std::string& font() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_font(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_font();
+  PROTOBUF_NODISCARD std::string* release_font();
+  void set_allocated_font(std::string* font);
+  private:
+  const std::string& _internal_font() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_font(const std::string& value);
+  std::string* _internal_mutable_font();
+  public:
+
+  // string timeline = 11;
+  bool has_timeline() const;
+  private:
+  bool _internal_has_timeline() const;
+  public:
+  void clear_timeline();
+  const std::string& timeline() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_timeline(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_timeline();
+  PROTOBUF_NODISCARD std::string* release_timeline();
+  void set_allocated_timeline(std::string* timeline);
+  private:
+  const std::string& _internal_timeline() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_timeline(const std::string& value);
+  std::string* _internal_mutable_timeline();
+  public:
+
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:buffers.resources.Argument)
+ private:
+  class _Internal;
+  void set_has_string();
+  void set_has_sprite();
+  void set_has_sound();
+  void set_has_background();
+  void set_has_path();
+  void set_has_script();
+  void set_has_object();
+  void set_has_room();
+  void set_has_font();
+  void set_has_timeline();
+
+  inline bool has_value() const;
+  inline void clear_has_value();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int kind_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sprite_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sound_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr background_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr script_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr object_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr font_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr timeline_;
+    } value_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fEvent_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Action final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Action) */ {
+ public:
+  inline Action() : Action(nullptr) {}
+  ~Action() override;
+  explicit PROTOBUF_CONSTEXPR Action(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Action(const Action& from);
+  Action(Action&& from) noexcept
+    : Action() {
+    *this = ::std::move(from);
+  }
+
+  inline Action& operator=(const Action& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Action& operator=(Action&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Action& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Action* internal_default_instance() {
+    return reinterpret_cast<const Action*>(
+               &_Action_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Action& a, Action& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Action* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Action* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Action* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Action>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Action& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Action& from) {
+    Action::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Action* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Action";
+  }
+  protected:
+  explicit Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgumentsFieldNumber = 13,
+    kFunctionNameFieldNumber = 8,
+    kCodeStringFieldNumber = 9,
+    kWhoNameFieldNumber = 10,
+    kLibidFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kKindFieldNumber = 3,
+    kUseRelativeFieldNumber = 4,
+    kIsQuestionFieldNumber = 5,
+    kUseApplyToFieldNumber = 6,
+    kRelativeFieldNumber = 11,
+    kExeTypeFieldNumber = 7,
+    kIsNotFieldNumber = 12,
+  };
+  // repeated .buffers.resources.Argument arguments = 13 [(.buffers.gmx) = "arguments/argument"];
+  int arguments_size() const;
+  private:
+  int _internal_arguments_size() const;
+  public:
+  void clear_arguments();
+  ::buffers::resources::Argument* mutable_arguments(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Argument >*
+      mutable_arguments();
+  private:
+  const ::buffers::resources::Argument& _internal_arguments(int index) const;
+  ::buffers::resources::Argument* _internal_add_arguments();
+  public:
+  const ::buffers::resources::Argument& arguments(int index) const;
+  ::buffers::resources::Argument* add_arguments();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Argument >&
+      arguments() const;
+
+  // optional string function_name = 8 [(.buffers.gmx) = "functionname"];
+  bool has_function_name() const;
+  private:
+  bool _internal_has_function_name() const;
+  public:
+  void clear_function_name();
+  const std::string& function_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_function_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_function_name();
+  PROTOBUF_NODISCARD std::string* release_function_name();
+  void set_allocated_function_name(std::string* function_name);
+  private:
+  const std::string& _internal_function_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_function_name(const std::string& value);
+  std::string* _internal_mutable_function_name();
+  public:
+
+  // optional string code_string = 9 [(.buffers.gmx) = "codestring"];
+  bool has_code_string() const;
+  private:
+  bool _internal_has_code_string() const;
+  public:
+  void clear_code_string();
+  const std::string& code_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code_string();
+  PROTOBUF_NODISCARD std::string* release_code_string();
+  void set_allocated_code_string(std::string* code_string);
+  private:
+  const std::string& _internal_code_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code_string(const std::string& value);
+  std::string* _internal_mutable_code_string();
+  public:
+
+  // optional string who_name = 10 [(.buffers.gmx) = "whoName"];
+  bool has_who_name() const;
+  private:
+  bool _internal_has_who_name() const;
+  public:
+  void clear_who_name();
+  const std::string& who_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_who_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_who_name();
+  PROTOBUF_NODISCARD std::string* release_who_name();
+  void set_allocated_who_name(std::string* who_name);
+  private:
+  const std::string& _internal_who_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_who_name(const std::string& value);
+  std::string* _internal_mutable_who_name();
+  public:
+
+  // optional int32 libid = 1;
+  bool has_libid() const;
+  private:
+  bool _internal_has_libid() const;
+  public:
+  void clear_libid();
+  int32_t libid() const;
+  void set_libid(int32_t value);
+  private:
+  int32_t _internal_libid() const;
+  void _internal_set_libid(int32_t value);
+  public:
+
+  // optional int32 id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional .buffers.resources.ActionKind kind = 3;
+  bool has_kind() const;
+  private:
+  bool _internal_has_kind() const;
+  public:
+  void clear_kind();
+  ::buffers::resources::ActionKind kind() const;
+  void set_kind(::buffers::resources::ActionKind value);
+  private:
+  ::buffers::resources::ActionKind _internal_kind() const;
+  void _internal_set_kind(::buffers::resources::ActionKind value);
+  public:
+
+  // optional bool use_relative = 4 [(.buffers.gmx) = "userelative"];
+  bool has_use_relative() const;
+  private:
+  bool _internal_has_use_relative() const;
+  public:
+  void clear_use_relative();
+  bool use_relative() const;
+  void set_use_relative(bool value);
+  private:
+  bool _internal_use_relative() const;
+  void _internal_set_use_relative(bool value);
+  public:
+
+  // optional bool is_question = 5 [(.buffers.gmx) = "isquestion"];
+  bool has_is_question() const;
+  private:
+  bool _internal_has_is_question() const;
+  public:
+  void clear_is_question();
+  bool is_question() const;
+  void set_is_question(bool value);
+  private:
+  bool _internal_is_question() const;
+  void _internal_set_is_question(bool value);
+  public:
+
+  // optional bool use_apply_to = 6 [(.buffers.gmx) = "useapplyto"];
+  bool has_use_apply_to() const;
+  private:
+  bool _internal_has_use_apply_to() const;
+  public:
+  void clear_use_apply_to();
+  bool use_apply_to() const;
+  void set_use_apply_to(bool value);
+  private:
+  bool _internal_use_apply_to() const;
+  void _internal_set_use_apply_to(bool value);
+  public:
+
+  // optional bool relative = 11;
+  bool has_relative() const;
+  private:
+  bool _internal_has_relative() const;
+  public:
+  void clear_relative();
+  bool relative() const;
+  void set_relative(bool value);
+  private:
+  bool _internal_relative() const;
+  void _internal_set_relative(bool value);
+  public:
+
+  // optional .buffers.resources.ActionExecution exe_type = 7 [(.buffers.gmx) = "exetype"];
+  bool has_exe_type() const;
+  private:
+  bool _internal_has_exe_type() const;
+  public:
+  void clear_exe_type();
+  ::buffers::resources::ActionExecution exe_type() const;
+  void set_exe_type(::buffers::resources::ActionExecution value);
+  private:
+  ::buffers::resources::ActionExecution _internal_exe_type() const;
+  void _internal_set_exe_type(::buffers::resources::ActionExecution value);
+  public:
+
+  // optional bool is_not = 12 [(.buffers.gmx) = "isnot"];
+  bool has_is_not() const;
+  private:
+  bool _internal_has_is_not() const;
+  public:
+  void clear_is_not();
+  bool is_not() const;
+  void set_is_not(bool value);
+  private:
+  bool _internal_is_not() const;
+  void _internal_set_is_not(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Action)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Argument > arguments_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr function_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_string_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr who_name_;
+    int32_t libid_;
+    int32_t id_;
+    int kind_;
+    bool use_relative_;
+    bool is_question_;
+    bool use_apply_to_;
+    bool relative_;
+    int exe_type_;
+    bool is_not_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fEvent_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Event final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Event) */ {
+ public:
+  inline Event() : Event(nullptr) {}
+  ~Event() override;
+  explicit PROTOBUF_CONSTEXPR Event(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Event(const Event& from);
+  Event(Event&& from) noexcept
+    : Event() {
+    *this = ::std::move(from);
+  }
+
+  inline Event& operator=(const Event& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Event& operator=(Event&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Event& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ReferenceCase {
+    kNumber = 2,
+    kName = 3,
+    REFERENCE_NOT_SET = 0,
+  };
+
+  static inline const Event* internal_default_instance() {
+    return reinterpret_cast<const Event*>(
+               &_Event_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Event& a, Event& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Event* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Event* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Event* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Event>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Event& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Event& from) {
+    Event::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Event* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Event";
+  }
+  protected:
+  explicit Event(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActionsFieldNumber = 4,
+    kCodeFieldNumber = 5,
+    kTypeFieldNumber = 1,
+    kNumberFieldNumber = 2,
+    kNameFieldNumber = 3,
+  };
+  // repeated .buffers.resources.Action actions = 4 [(.buffers.gmx) = "action"];
+  int actions_size() const;
+  private:
+  int _internal_actions_size() const;
+  public:
+  void clear_actions();
+  ::buffers::resources::Action* mutable_actions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Action >*
+      mutable_actions();
+  private:
+  const ::buffers::resources::Action& _internal_actions(int index) const;
+  ::buffers::resources::Action* _internal_add_actions();
+  public:
+  const ::buffers::resources::Action& actions(int index) const;
+  ::buffers::resources::Action* add_actions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Action >&
+      actions() const;
+
+  // optional string code = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  const std::string& code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* code);
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
+  std::string* _internal_mutable_code();
+  public:
+
+  // optional int32 type = 1 [(.buffers.gmx) = "eventtype"];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // int32 number = 2 [(.buffers.gmx) = "enumb"];
+  bool has_number() const;
+  private:
+  bool _internal_has_number() const;
+  public:
+  void clear_number();
+  int32_t number() const;
+  void set_number(int32_t value);
+  private:
+  int32_t _internal_number() const;
+  void _internal_set_number(int32_t value);
+  public:
+
+  // string name = 3 [(.buffers.gmx) = "ename", (.buffers.yyp_id) = "collisionObjectId"];
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  void clear_reference();
+  ReferenceCase reference_case() const;
+  // @@protoc_insertion_point(class_scope:buffers.resources.Event)
+ private:
+  class _Internal;
+  void set_has_number();
+  void set_has_name();
+
+  inline bool has_reference() const;
+  inline void clear_has_reference();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Action > actions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    int32_t type_;
+    union ReferenceUnion {
+      constexpr ReferenceUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      int32_t number_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    } reference_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fEvent_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Argument
+
+// optional .buffers.resources.ArgumentKind kind = 1;
+inline bool Argument::_internal_has_kind() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Argument::has_kind() const {
+  return _internal_has_kind();
+}
+inline void Argument::clear_kind() {
+  _impl_.kind_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::buffers::resources::ArgumentKind Argument::_internal_kind() const {
+  return static_cast< ::buffers::resources::ArgumentKind >(_impl_.kind_);
+}
+inline ::buffers::resources::ArgumentKind Argument::kind() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.kind)
+  return _internal_kind();
+}
+inline void Argument::_internal_set_kind(::buffers::resources::ArgumentKind value) {
+  assert(::buffers::resources::ArgumentKind_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.kind_ = value;
+}
+inline void Argument::set_kind(::buffers::resources::ArgumentKind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.kind)
+}
+
+// string string = 2;
+inline bool Argument::_internal_has_string() const {
+  return value_case() == kString;
+}
+inline bool Argument::has_string() const {
+  return _internal_has_string();
+}
+inline void Argument::set_has_string() {
+  _impl_._oneof_case_[0] = kString;
+}
+inline void Argument::clear_string() {
+  if (_internal_has_string()) {
+    _impl_.value_.string_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::string() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.string)
+  return _internal_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_string(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_string()) {
+    clear_value();
+    set_has_string();
+    _impl_.value_.string_.InitDefault();
+  }
+  _impl_.value_.string_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.string)
+}
+inline std::string* Argument::mutable_string() {
+  std::string* _s = _internal_mutable_string();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.string)
+  return _s;
+}
+inline const std::string& Argument::_internal_string() const {
+  if (_internal_has_string()) {
+    return _impl_.value_.string_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_string(const std::string& value) {
+  if (!_internal_has_string()) {
+    clear_value();
+    set_has_string();
+    _impl_.value_.string_.InitDefault();
+  }
+  _impl_.value_.string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_string() {
+  if (!_internal_has_string()) {
+    clear_value();
+    set_has_string();
+    _impl_.value_.string_.InitDefault();
+  }
+  return _impl_.value_.string_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_string() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.string)
+  if (_internal_has_string()) {
+    clear_has_value();
+    return _impl_.value_.string_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_string(std::string* string) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (string != nullptr) {
+    set_has_string();
+    _impl_.value_.string_.InitAllocated(string, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.string)
+}
+
+// string sprite = 3;
+inline bool Argument::_internal_has_sprite() const {
+  return value_case() == kSprite;
+}
+inline bool Argument::has_sprite() const {
+  return _internal_has_sprite();
+}
+inline void Argument::set_has_sprite() {
+  _impl_._oneof_case_[0] = kSprite;
+}
+inline void Argument::clear_sprite() {
+  if (_internal_has_sprite()) {
+    _impl_.value_.sprite_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::sprite() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.sprite)
+  return _internal_sprite();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_sprite(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_sprite()) {
+    clear_value();
+    set_has_sprite();
+    _impl_.value_.sprite_.InitDefault();
+  }
+  _impl_.value_.sprite_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.sprite)
+}
+inline std::string* Argument::mutable_sprite() {
+  std::string* _s = _internal_mutable_sprite();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.sprite)
+  return _s;
+}
+inline const std::string& Argument::_internal_sprite() const {
+  if (_internal_has_sprite()) {
+    return _impl_.value_.sprite_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_sprite(const std::string& value) {
+  if (!_internal_has_sprite()) {
+    clear_value();
+    set_has_sprite();
+    _impl_.value_.sprite_.InitDefault();
+  }
+  _impl_.value_.sprite_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_sprite() {
+  if (!_internal_has_sprite()) {
+    clear_value();
+    set_has_sprite();
+    _impl_.value_.sprite_.InitDefault();
+  }
+  return _impl_.value_.sprite_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_sprite() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.sprite)
+  if (_internal_has_sprite()) {
+    clear_has_value();
+    return _impl_.value_.sprite_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_sprite(std::string* sprite) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (sprite != nullptr) {
+    set_has_sprite();
+    _impl_.value_.sprite_.InitAllocated(sprite, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.sprite)
+}
+
+// string sound = 4;
+inline bool Argument::_internal_has_sound() const {
+  return value_case() == kSound;
+}
+inline bool Argument::has_sound() const {
+  return _internal_has_sound();
+}
+inline void Argument::set_has_sound() {
+  _impl_._oneof_case_[0] = kSound;
+}
+inline void Argument::clear_sound() {
+  if (_internal_has_sound()) {
+    _impl_.value_.sound_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::sound() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.sound)
+  return _internal_sound();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_sound(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_sound()) {
+    clear_value();
+    set_has_sound();
+    _impl_.value_.sound_.InitDefault();
+  }
+  _impl_.value_.sound_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.sound)
+}
+inline std::string* Argument::mutable_sound() {
+  std::string* _s = _internal_mutable_sound();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.sound)
+  return _s;
+}
+inline const std::string& Argument::_internal_sound() const {
+  if (_internal_has_sound()) {
+    return _impl_.value_.sound_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_sound(const std::string& value) {
+  if (!_internal_has_sound()) {
+    clear_value();
+    set_has_sound();
+    _impl_.value_.sound_.InitDefault();
+  }
+  _impl_.value_.sound_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_sound() {
+  if (!_internal_has_sound()) {
+    clear_value();
+    set_has_sound();
+    _impl_.value_.sound_.InitDefault();
+  }
+  return _impl_.value_.sound_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_sound() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.sound)
+  if (_internal_has_sound()) {
+    clear_has_value();
+    return _impl_.value_.sound_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_sound(std::string* sound) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (sound != nullptr) {
+    set_has_sound();
+    _impl_.value_.sound_.InitAllocated(sound, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.sound)
+}
+
+// string background = 5;
+inline bool Argument::_internal_has_background() const {
+  return value_case() == kBackground;
+}
+inline bool Argument::has_background() const {
+  return _internal_has_background();
+}
+inline void Argument::set_has_background() {
+  _impl_._oneof_case_[0] = kBackground;
+}
+inline void Argument::clear_background() {
+  if (_internal_has_background()) {
+    _impl_.value_.background_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::background() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.background)
+  return _internal_background();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_background(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_background()) {
+    clear_value();
+    set_has_background();
+    _impl_.value_.background_.InitDefault();
+  }
+  _impl_.value_.background_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.background)
+}
+inline std::string* Argument::mutable_background() {
+  std::string* _s = _internal_mutable_background();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.background)
+  return _s;
+}
+inline const std::string& Argument::_internal_background() const {
+  if (_internal_has_background()) {
+    return _impl_.value_.background_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_background(const std::string& value) {
+  if (!_internal_has_background()) {
+    clear_value();
+    set_has_background();
+    _impl_.value_.background_.InitDefault();
+  }
+  _impl_.value_.background_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_background() {
+  if (!_internal_has_background()) {
+    clear_value();
+    set_has_background();
+    _impl_.value_.background_.InitDefault();
+  }
+  return _impl_.value_.background_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_background() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.background)
+  if (_internal_has_background()) {
+    clear_has_value();
+    return _impl_.value_.background_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_background(std::string* background) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (background != nullptr) {
+    set_has_background();
+    _impl_.value_.background_.InitAllocated(background, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.background)
+}
+
+// string path = 6;
+inline bool Argument::_internal_has_path() const {
+  return value_case() == kPath;
+}
+inline bool Argument::has_path() const {
+  return _internal_has_path();
+}
+inline void Argument::set_has_path() {
+  _impl_._oneof_case_[0] = kPath;
+}
+inline void Argument::clear_path() {
+  if (_internal_has_path()) {
+    _impl_.value_.path_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::path() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_path(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_path()) {
+    clear_value();
+    set_has_path();
+    _impl_.value_.path_.InitDefault();
+  }
+  _impl_.value_.path_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.path)
+}
+inline std::string* Argument::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.path)
+  return _s;
+}
+inline const std::string& Argument::_internal_path() const {
+  if (_internal_has_path()) {
+    return _impl_.value_.path_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_path(const std::string& value) {
+  if (!_internal_has_path()) {
+    clear_value();
+    set_has_path();
+    _impl_.value_.path_.InitDefault();
+  }
+  _impl_.value_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_path() {
+  if (!_internal_has_path()) {
+    clear_value();
+    set_has_path();
+    _impl_.value_.path_.InitDefault();
+  }
+  return _impl_.value_.path_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_path() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.path)
+  if (_internal_has_path()) {
+    clear_has_value();
+    return _impl_.value_.path_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_path(std::string* path) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (path != nullptr) {
+    set_has_path();
+    _impl_.value_.path_.InitAllocated(path, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.path)
+}
+
+// string script = 7;
+inline bool Argument::_internal_has_script() const {
+  return value_case() == kScript;
+}
+inline bool Argument::has_script() const {
+  return _internal_has_script();
+}
+inline void Argument::set_has_script() {
+  _impl_._oneof_case_[0] = kScript;
+}
+inline void Argument::clear_script() {
+  if (_internal_has_script()) {
+    _impl_.value_.script_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::script() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.script)
+  return _internal_script();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_script(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_script()) {
+    clear_value();
+    set_has_script();
+    _impl_.value_.script_.InitDefault();
+  }
+  _impl_.value_.script_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.script)
+}
+inline std::string* Argument::mutable_script() {
+  std::string* _s = _internal_mutable_script();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.script)
+  return _s;
+}
+inline const std::string& Argument::_internal_script() const {
+  if (_internal_has_script()) {
+    return _impl_.value_.script_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_script(const std::string& value) {
+  if (!_internal_has_script()) {
+    clear_value();
+    set_has_script();
+    _impl_.value_.script_.InitDefault();
+  }
+  _impl_.value_.script_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_script() {
+  if (!_internal_has_script()) {
+    clear_value();
+    set_has_script();
+    _impl_.value_.script_.InitDefault();
+  }
+  return _impl_.value_.script_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_script() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.script)
+  if (_internal_has_script()) {
+    clear_has_value();
+    return _impl_.value_.script_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_script(std::string* script) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (script != nullptr) {
+    set_has_script();
+    _impl_.value_.script_.InitAllocated(script, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.script)
+}
+
+// string object = 8;
+inline bool Argument::_internal_has_object() const {
+  return value_case() == kObject;
+}
+inline bool Argument::has_object() const {
+  return _internal_has_object();
+}
+inline void Argument::set_has_object() {
+  _impl_._oneof_case_[0] = kObject;
+}
+inline void Argument::clear_object() {
+  if (_internal_has_object()) {
+    _impl_.value_.object_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::object() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.object)
+  return _internal_object();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_object(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_object()) {
+    clear_value();
+    set_has_object();
+    _impl_.value_.object_.InitDefault();
+  }
+  _impl_.value_.object_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.object)
+}
+inline std::string* Argument::mutable_object() {
+  std::string* _s = _internal_mutable_object();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.object)
+  return _s;
+}
+inline const std::string& Argument::_internal_object() const {
+  if (_internal_has_object()) {
+    return _impl_.value_.object_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_object(const std::string& value) {
+  if (!_internal_has_object()) {
+    clear_value();
+    set_has_object();
+    _impl_.value_.object_.InitDefault();
+  }
+  _impl_.value_.object_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_object() {
+  if (!_internal_has_object()) {
+    clear_value();
+    set_has_object();
+    _impl_.value_.object_.InitDefault();
+  }
+  return _impl_.value_.object_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_object() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.object)
+  if (_internal_has_object()) {
+    clear_has_value();
+    return _impl_.value_.object_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_object(std::string* object) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (object != nullptr) {
+    set_has_object();
+    _impl_.value_.object_.InitAllocated(object, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.object)
+}
+
+// string room = 9;
+inline bool Argument::_internal_has_room() const {
+  return value_case() == kRoom;
+}
+inline bool Argument::has_room() const {
+  return _internal_has_room();
+}
+inline void Argument::set_has_room() {
+  _impl_._oneof_case_[0] = kRoom;
+}
+inline void Argument::clear_room() {
+  if (_internal_has_room()) {
+    _impl_.value_.room_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::room() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_room(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_room()) {
+    clear_value();
+    set_has_room();
+    _impl_.value_.room_.InitDefault();
+  }
+  _impl_.value_.room_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.room)
+}
+inline std::string* Argument::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.room)
+  return _s;
+}
+inline const std::string& Argument::_internal_room() const {
+  if (_internal_has_room()) {
+    return _impl_.value_.room_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_room(const std::string& value) {
+  if (!_internal_has_room()) {
+    clear_value();
+    set_has_room();
+    _impl_.value_.room_.InitDefault();
+  }
+  _impl_.value_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_room() {
+  if (!_internal_has_room()) {
+    clear_value();
+    set_has_room();
+    _impl_.value_.room_.InitDefault();
+  }
+  return _impl_.value_.room_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_room() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.room)
+  if (_internal_has_room()) {
+    clear_has_value();
+    return _impl_.value_.room_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_room(std::string* room) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (room != nullptr) {
+    set_has_room();
+    _impl_.value_.room_.InitAllocated(room, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.room)
+}
+
+// string font = 10;
+inline bool Argument::_internal_has_font() const {
+  return value_case() == kFont;
+}
+inline bool Argument::has_font() const {
+  return _internal_has_font();
+}
+inline void Argument::set_has_font() {
+  _impl_._oneof_case_[0] = kFont;
+}
+inline void Argument::clear_font() {
+  if (_internal_has_font()) {
+    _impl_.value_.font_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::font() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.font)
+  return _internal_font();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_font(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_font()) {
+    clear_value();
+    set_has_font();
+    _impl_.value_.font_.InitDefault();
+  }
+  _impl_.value_.font_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.font)
+}
+inline std::string* Argument::mutable_font() {
+  std::string* _s = _internal_mutable_font();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.font)
+  return _s;
+}
+inline const std::string& Argument::_internal_font() const {
+  if (_internal_has_font()) {
+    return _impl_.value_.font_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_font(const std::string& value) {
+  if (!_internal_has_font()) {
+    clear_value();
+    set_has_font();
+    _impl_.value_.font_.InitDefault();
+  }
+  _impl_.value_.font_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_font() {
+  if (!_internal_has_font()) {
+    clear_value();
+    set_has_font();
+    _impl_.value_.font_.InitDefault();
+  }
+  return _impl_.value_.font_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_font() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.font)
+  if (_internal_has_font()) {
+    clear_has_value();
+    return _impl_.value_.font_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_font(std::string* font) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (font != nullptr) {
+    set_has_font();
+    _impl_.value_.font_.InitAllocated(font, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.font)
+}
+
+// string timeline = 11;
+inline bool Argument::_internal_has_timeline() const {
+  return value_case() == kTimeline;
+}
+inline bool Argument::has_timeline() const {
+  return _internal_has_timeline();
+}
+inline void Argument::set_has_timeline() {
+  _impl_._oneof_case_[0] = kTimeline;
+}
+inline void Argument::clear_timeline() {
+  if (_internal_has_timeline()) {
+    _impl_.value_.timeline_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Argument::timeline() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Argument.timeline)
+  return _internal_timeline();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Argument::set_timeline(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_timeline()) {
+    clear_value();
+    set_has_timeline();
+    _impl_.value_.timeline_.InitDefault();
+  }
+  _impl_.value_.timeline_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Argument.timeline)
+}
+inline std::string* Argument::mutable_timeline() {
+  std::string* _s = _internal_mutable_timeline();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Argument.timeline)
+  return _s;
+}
+inline const std::string& Argument::_internal_timeline() const {
+  if (_internal_has_timeline()) {
+    return _impl_.value_.timeline_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Argument::_internal_set_timeline(const std::string& value) {
+  if (!_internal_has_timeline()) {
+    clear_value();
+    set_has_timeline();
+    _impl_.value_.timeline_.InitDefault();
+  }
+  _impl_.value_.timeline_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_timeline() {
+  if (!_internal_has_timeline()) {
+    clear_value();
+    set_has_timeline();
+    _impl_.value_.timeline_.InitDefault();
+  }
+  return _impl_.value_.timeline_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Argument::release_timeline() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Argument.timeline)
+  if (_internal_has_timeline()) {
+    clear_has_value();
+    return _impl_.value_.timeline_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Argument::set_allocated_timeline(std::string* timeline) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (timeline != nullptr) {
+    set_has_timeline();
+    _impl_.value_.timeline_.InitAllocated(timeline, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Argument.timeline)
+}
+
+inline bool Argument::has_value() const {
+  return value_case() != VALUE_NOT_SET;
+}
+inline void Argument::clear_has_value() {
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+inline Argument::ValueCase Argument::value_case() const {
+  return Argument::ValueCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Action
+
+// optional int32 libid = 1;
+inline bool Action::_internal_has_libid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Action::has_libid() const {
+  return _internal_has_libid();
+}
+inline void Action::clear_libid() {
+  _impl_.libid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Action::_internal_libid() const {
+  return _impl_.libid_;
+}
+inline int32_t Action::libid() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.libid)
+  return _internal_libid();
+}
+inline void Action::_internal_set_libid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.libid_ = value;
+}
+inline void Action::set_libid(int32_t value) {
+  _internal_set_libid(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.libid)
+}
+
+// optional int32 id = 2;
+inline bool Action::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Action::has_id() const {
+  return _internal_has_id();
+}
+inline void Action::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Action::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Action::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.id)
+  return _internal_id();
+}
+inline void Action::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void Action::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.id)
+}
+
+// optional .buffers.resources.ActionKind kind = 3;
+inline bool Action::_internal_has_kind() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Action::has_kind() const {
+  return _internal_has_kind();
+}
+inline void Action::clear_kind() {
+  _impl_.kind_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::buffers::resources::ActionKind Action::_internal_kind() const {
+  return static_cast< ::buffers::resources::ActionKind >(_impl_.kind_);
+}
+inline ::buffers::resources::ActionKind Action::kind() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.kind)
+  return _internal_kind();
+}
+inline void Action::_internal_set_kind(::buffers::resources::ActionKind value) {
+  assert(::buffers::resources::ActionKind_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.kind_ = value;
+}
+inline void Action::set_kind(::buffers::resources::ActionKind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.kind)
+}
+
+// optional bool use_relative = 4 [(.buffers.gmx) = "userelative"];
+inline bool Action::_internal_has_use_relative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Action::has_use_relative() const {
+  return _internal_has_use_relative();
+}
+inline void Action::clear_use_relative() {
+  _impl_.use_relative_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Action::_internal_use_relative() const {
+  return _impl_.use_relative_;
+}
+inline bool Action::use_relative() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.use_relative)
+  return _internal_use_relative();
+}
+inline void Action::_internal_set_use_relative(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.use_relative_ = value;
+}
+inline void Action::set_use_relative(bool value) {
+  _internal_set_use_relative(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.use_relative)
+}
+
+// optional bool is_question = 5 [(.buffers.gmx) = "isquestion"];
+inline bool Action::_internal_has_is_question() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Action::has_is_question() const {
+  return _internal_has_is_question();
+}
+inline void Action::clear_is_question() {
+  _impl_.is_question_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Action::_internal_is_question() const {
+  return _impl_.is_question_;
+}
+inline bool Action::is_question() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.is_question)
+  return _internal_is_question();
+}
+inline void Action::_internal_set_is_question(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.is_question_ = value;
+}
+inline void Action::set_is_question(bool value) {
+  _internal_set_is_question(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.is_question)
+}
+
+// optional bool use_apply_to = 6 [(.buffers.gmx) = "useapplyto"];
+inline bool Action::_internal_has_use_apply_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Action::has_use_apply_to() const {
+  return _internal_has_use_apply_to();
+}
+inline void Action::clear_use_apply_to() {
+  _impl_.use_apply_to_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Action::_internal_use_apply_to() const {
+  return _impl_.use_apply_to_;
+}
+inline bool Action::use_apply_to() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.use_apply_to)
+  return _internal_use_apply_to();
+}
+inline void Action::_internal_set_use_apply_to(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.use_apply_to_ = value;
+}
+inline void Action::set_use_apply_to(bool value) {
+  _internal_set_use_apply_to(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.use_apply_to)
+}
+
+// optional .buffers.resources.ActionExecution exe_type = 7 [(.buffers.gmx) = "exetype"];
+inline bool Action::_internal_has_exe_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Action::has_exe_type() const {
+  return _internal_has_exe_type();
+}
+inline void Action::clear_exe_type() {
+  _impl_.exe_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::buffers::resources::ActionExecution Action::_internal_exe_type() const {
+  return static_cast< ::buffers::resources::ActionExecution >(_impl_.exe_type_);
+}
+inline ::buffers::resources::ActionExecution Action::exe_type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.exe_type)
+  return _internal_exe_type();
+}
+inline void Action::_internal_set_exe_type(::buffers::resources::ActionExecution value) {
+  assert(::buffers::resources::ActionExecution_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.exe_type_ = value;
+}
+inline void Action::set_exe_type(::buffers::resources::ActionExecution value) {
+  _internal_set_exe_type(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.exe_type)
+}
+
+// optional string function_name = 8 [(.buffers.gmx) = "functionname"];
+inline bool Action::_internal_has_function_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Action::has_function_name() const {
+  return _internal_has_function_name();
+}
+inline void Action::clear_function_name() {
+  _impl_.function_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Action::function_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.function_name)
+  return _internal_function_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Action::set_function_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.function_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.function_name)
+}
+inline std::string* Action::mutable_function_name() {
+  std::string* _s = _internal_mutable_function_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Action.function_name)
+  return _s;
+}
+inline const std::string& Action::_internal_function_name() const {
+  return _impl_.function_name_.Get();
+}
+inline void Action::_internal_set_function_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.function_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Action::_internal_mutable_function_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.function_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Action::release_function_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Action.function_name)
+  if (!_internal_has_function_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.function_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.function_name_.IsDefault()) {
+    _impl_.function_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Action::set_allocated_function_name(std::string* function_name) {
+  if (function_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.function_name_.SetAllocated(function_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.function_name_.IsDefault()) {
+    _impl_.function_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Action.function_name)
+}
+
+// optional string code_string = 9 [(.buffers.gmx) = "codestring"];
+inline bool Action::_internal_has_code_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Action::has_code_string() const {
+  return _internal_has_code_string();
+}
+inline void Action::clear_code_string() {
+  _impl_.code_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Action::code_string() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.code_string)
+  return _internal_code_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Action::set_code_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.code_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.code_string)
+}
+inline std::string* Action::mutable_code_string() {
+  std::string* _s = _internal_mutable_code_string();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Action.code_string)
+  return _s;
+}
+inline const std::string& Action::_internal_code_string() const {
+  return _impl_.code_string_.Get();
+}
+inline void Action::_internal_set_code_string(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.code_string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Action::_internal_mutable_code_string() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.code_string_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Action::release_code_string() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Action.code_string)
+  if (!_internal_has_code_string()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.code_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_string_.IsDefault()) {
+    _impl_.code_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Action::set_allocated_code_string(std::string* code_string) {
+  if (code_string != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.code_string_.SetAllocated(code_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_string_.IsDefault()) {
+    _impl_.code_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Action.code_string)
+}
+
+// optional string who_name = 10 [(.buffers.gmx) = "whoName"];
+inline bool Action::_internal_has_who_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Action::has_who_name() const {
+  return _internal_has_who_name();
+}
+inline void Action::clear_who_name() {
+  _impl_.who_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Action::who_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.who_name)
+  return _internal_who_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Action::set_who_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.who_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.who_name)
+}
+inline std::string* Action::mutable_who_name() {
+  std::string* _s = _internal_mutable_who_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Action.who_name)
+  return _s;
+}
+inline const std::string& Action::_internal_who_name() const {
+  return _impl_.who_name_.Get();
+}
+inline void Action::_internal_set_who_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.who_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Action::_internal_mutable_who_name() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.who_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Action::release_who_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Action.who_name)
+  if (!_internal_has_who_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.who_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.who_name_.IsDefault()) {
+    _impl_.who_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Action::set_allocated_who_name(std::string* who_name) {
+  if (who_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.who_name_.SetAllocated(who_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.who_name_.IsDefault()) {
+    _impl_.who_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Action.who_name)
+}
+
+// optional bool relative = 11;
+inline bool Action::_internal_has_relative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Action::has_relative() const {
+  return _internal_has_relative();
+}
+inline void Action::clear_relative() {
+  _impl_.relative_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool Action::_internal_relative() const {
+  return _impl_.relative_;
+}
+inline bool Action::relative() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.relative)
+  return _internal_relative();
+}
+inline void Action::_internal_set_relative(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.relative_ = value;
+}
+inline void Action::set_relative(bool value) {
+  _internal_set_relative(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.relative)
+}
+
+// optional bool is_not = 12 [(.buffers.gmx) = "isnot"];
+inline bool Action::_internal_has_is_not() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Action::has_is_not() const {
+  return _internal_has_is_not();
+}
+inline void Action::clear_is_not() {
+  _impl_.is_not_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool Action::_internal_is_not() const {
+  return _impl_.is_not_;
+}
+inline bool Action::is_not() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.is_not)
+  return _internal_is_not();
+}
+inline void Action::_internal_set_is_not(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.is_not_ = value;
+}
+inline void Action::set_is_not(bool value) {
+  _internal_set_is_not(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Action.is_not)
+}
+
+// repeated .buffers.resources.Argument arguments = 13 [(.buffers.gmx) = "arguments/argument"];
+inline int Action::_internal_arguments_size() const {
+  return _impl_.arguments_.size();
+}
+inline int Action::arguments_size() const {
+  return _internal_arguments_size();
+}
+inline void Action::clear_arguments() {
+  _impl_.arguments_.Clear();
+}
+inline ::buffers::resources::Argument* Action::mutable_arguments(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Action.arguments)
+  return _impl_.arguments_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Argument >*
+Action::mutable_arguments() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Action.arguments)
+  return &_impl_.arguments_;
+}
+inline const ::buffers::resources::Argument& Action::_internal_arguments(int index) const {
+  return _impl_.arguments_.Get(index);
+}
+inline const ::buffers::resources::Argument& Action::arguments(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Action.arguments)
+  return _internal_arguments(index);
+}
+inline ::buffers::resources::Argument* Action::_internal_add_arguments() {
+  return _impl_.arguments_.Add();
+}
+inline ::buffers::resources::Argument* Action::add_arguments() {
+  ::buffers::resources::Argument* _add = _internal_add_arguments();
+  // @@protoc_insertion_point(field_add:buffers.resources.Action.arguments)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Argument >&
+Action::arguments() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Action.arguments)
+  return _impl_.arguments_;
+}
+
+// -------------------------------------------------------------------
+
+// Event
+
+// optional int32 type = 1 [(.buffers.gmx) = "eventtype"];
+inline bool Event::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Event::has_type() const {
+  return _internal_has_type();
+}
+inline void Event::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Event::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t Event::type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Event.type)
+  return _internal_type();
+}
+inline void Event::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void Event::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Event.type)
+}
+
+// int32 number = 2 [(.buffers.gmx) = "enumb"];
+inline bool Event::_internal_has_number() const {
+  return reference_case() == kNumber;
+}
+inline bool Event::has_number() const {
+  return _internal_has_number();
+}
+inline void Event::set_has_number() {
+  _impl_._oneof_case_[0] = kNumber;
+}
+inline void Event::clear_number() {
+  if (_internal_has_number()) {
+    _impl_.reference_.number_ = 0;
+    clear_has_reference();
+  }
+}
+inline int32_t Event::_internal_number() const {
+  if (_internal_has_number()) {
+    return _impl_.reference_.number_;
+  }
+  return 0;
+}
+inline void Event::_internal_set_number(int32_t value) {
+  if (!_internal_has_number()) {
+    clear_reference();
+    set_has_number();
+  }
+  _impl_.reference_.number_ = value;
+}
+inline int32_t Event::number() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Event.number)
+  return _internal_number();
+}
+inline void Event::set_number(int32_t value) {
+  _internal_set_number(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Event.number)
+}
+
+// string name = 3 [(.buffers.gmx) = "ename", (.buffers.yyp_id) = "collisionObjectId"];
+inline bool Event::_internal_has_name() const {
+  return reference_case() == kName;
+}
+inline bool Event::has_name() const {
+  return _internal_has_name();
+}
+inline void Event::set_has_name() {
+  _impl_._oneof_case_[0] = kName;
+}
+inline void Event::clear_name() {
+  if (_internal_has_name()) {
+    _impl_.reference_.name_.Destroy();
+    clear_has_reference();
+  }
+}
+inline const std::string& Event::name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Event.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Event::set_name(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_name()) {
+    clear_reference();
+    set_has_name();
+    _impl_.reference_.name_.InitDefault();
+  }
+  _impl_.reference_.name_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Event.name)
+}
+inline std::string* Event::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Event.name)
+  return _s;
+}
+inline const std::string& Event::_internal_name() const {
+  if (_internal_has_name()) {
+    return _impl_.reference_.name_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Event::_internal_set_name(const std::string& value) {
+  if (!_internal_has_name()) {
+    clear_reference();
+    set_has_name();
+    _impl_.reference_.name_.InitDefault();
+  }
+  _impl_.reference_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Event::_internal_mutable_name() {
+  if (!_internal_has_name()) {
+    clear_reference();
+    set_has_name();
+    _impl_.reference_.name_.InitDefault();
+  }
+  return _impl_.reference_.name_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Event::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Event.name)
+  if (_internal_has_name()) {
+    clear_has_reference();
+    return _impl_.reference_.name_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::set_allocated_name(std::string* name) {
+  if (has_reference()) {
+    clear_reference();
+  }
+  if (name != nullptr) {
+    set_has_name();
+    _impl_.reference_.name_.InitAllocated(name, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Event.name)
+}
+
+// repeated .buffers.resources.Action actions = 4 [(.buffers.gmx) = "action"];
+inline int Event::_internal_actions_size() const {
+  return _impl_.actions_.size();
+}
+inline int Event::actions_size() const {
+  return _internal_actions_size();
+}
+inline void Event::clear_actions() {
+  _impl_.actions_.Clear();
+}
+inline ::buffers::resources::Action* Event::mutable_actions(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Event.actions)
+  return _impl_.actions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Action >*
+Event::mutable_actions() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Event.actions)
+  return &_impl_.actions_;
+}
+inline const ::buffers::resources::Action& Event::_internal_actions(int index) const {
+  return _impl_.actions_.Get(index);
+}
+inline const ::buffers::resources::Action& Event::actions(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Event.actions)
+  return _internal_actions(index);
+}
+inline ::buffers::resources::Action* Event::_internal_add_actions() {
+  return _impl_.actions_.Add();
+}
+inline ::buffers::resources::Action* Event::add_actions() {
+  ::buffers::resources::Action* _add = _internal_add_actions();
+  // @@protoc_insertion_point(field_add:buffers.resources.Event.actions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Action >&
+Event::actions() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Event.actions)
+  return _impl_.actions_;
+}
+
+// optional string code = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Event::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Event::has_code() const {
+  return _internal_has_code();
+}
+inline void Event::clear_code() {
+  _impl_.code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Event::code() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Event.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Event::set_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Event.code)
+}
+inline std::string* Event::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Event.code)
+  return _s;
+}
+inline const std::string& Event::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void Event::_internal_set_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Event::_internal_mutable_code() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Event::release_code() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Event.code)
+  if (!_internal_has_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Event::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Event.code)
+}
+
+inline bool Event::has_reference() const {
+  return reference_case() != REFERENCE_NOT_SET;
+}
+inline void Event::clear_has_reference() {
+  _impl_._oneof_case_[0] = REFERENCE_NOT_SET;
+}
+inline Event::ReferenceCase Event::reference_case() const {
+  return Event::ReferenceCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::resources::ArgumentKind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::ArgumentKind>() {
+  return ::buffers::resources::ArgumentKind_descriptor();
+}
+template <> struct is_proto_enum< ::buffers::resources::ActionKind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::ActionKind>() {
+  return ::buffers::resources::ActionKind_descriptor();
+}
+template <> struct is_proto_enum< ::buffers::resources::ActionExecution> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::ActionExecution>() {
+  return ::buffers::resources::ActionExecution_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fEvent_2eproto
@@ -0,0 +1,1531 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Font.proto
+
+#include "resources/Font.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Font_Glyph::Font_Glyph(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.character_)*/0u
+  , /*decltype(_impl_.x_)*/0u
+  , /*decltype(_impl_.y_)*/0u
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u
+  , /*decltype(_impl_.shift_)*/0
+  , /*decltype(_impl_.offset_)*/0} {}
+struct Font_GlyphDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Font_GlyphDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Font_GlyphDefaultTypeInternal() {}
+  union {
+    Font_Glyph _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Font_GlyphDefaultTypeInternal _Font_Glyph_default_instance_;
+PROTOBUF_CONSTEXPR Font_Range::Font_Range(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0} {}
+struct Font_RangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Font_RangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Font_RangeDefaultTypeInternal() {}
+  union {
+    Font_Range _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Font_RangeDefaultTypeInternal _Font_Range_default_instance_;
+PROTOBUF_CONSTEXPR Font::Font(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ranges_)*/{}
+  , /*decltype(_impl_.glyphs_)*/{}
+  , /*decltype(_impl_.font_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttf_file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.image_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_.bold_)*/false
+  , /*decltype(_impl_.italic_)*/false
+  , /*decltype(_impl_.renderhq_)*/false
+  , /*decltype(_impl_.include_ttf_)*/false
+  , /*decltype(_impl_.charset_)*/0u
+  , /*decltype(_impl_.antialias_)*/0u
+  , /*decltype(_impl_.texture_group_)*/0} {}
+struct FontDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FontDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FontDefaultTypeInternal() {}
+  union {
+    Font _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FontDefaultTypeInternal _Font_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fFont_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resources_2fFont_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fFont_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fFont_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.character_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.shift_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Glyph, _impl_.offset_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Range, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Range, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Range, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font_Range, _impl_.max_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.font_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.bold_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.italic_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.ranges_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.glyphs_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.renderhq_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.charset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.antialias_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.include_ttf_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.ttf_file_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.texture_group_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Font, _impl_.image_),
+  3,
+  0,
+  4,
+  5,
+  6,
+  ~0u,
+  ~0u,
+  7,
+  9,
+  10,
+  8,
+  1,
+  11,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::buffers::resources::Font_Glyph)},
+  { 20, 28, -1, sizeof(::buffers::resources::Font_Range)},
+  { 30, 50, -1, sizeof(::buffers::resources::Font)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Font_Glyph_default_instance_._instance,
+  &::buffers::resources::_Font_Range_default_instance_._instance,
+  &::buffers::resources::_Font_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fFont_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024resources/Font.proto\022\021buffers.resource"
+  "s\032\roptions.proto\"\366\004\n\004Font\022\036\n\002id\030\002 \001(\005B\022\222"
+  "\265\030\016GMX_DEPRECATED\022\033\n\tfont_name\030\003 \001(\tB\010\222\265"
+  "\030\004name\022\014\n\004size\030\004 \001(\005\022\014\n\004bold\030\005 \001(\010\022\016\n\006it"
+  "alic\030\006 \001(\010\022@\n\006ranges\030\007 \003(\0132\035.buffers.res"
+  "ources.Font.RangeB\021\222\265\030\rranges/range0\022\?\n\006"
+  "glyphs\030\010 \003(\0132\035.buffers.resources.Font.Gl"
+  "yphB\020\222\265\030\014glyphs/glyph\022\020\n\010renderhq\030\n \001(\010\022"
+  "\017\n\007charset\030\013 \001(\r\022\031\n\tantialias\030\014 \001(\rB\006\222\265\030"
+  "\002aa\022#\n\013include_ttf\030\r \001(\010B\016\222\265\030\nincludeTTF"
+  "\022\035\n\010ttf_file\030\016 \001(\tB\013\222\265\030\007TTFName\022.\n\rtextu"
+  "re_group\030\017 \001(\005B\027\222\265\030\023texgroups/texgroup0\022"
+  "\r\n\005image\030\020 \001(\t\032|\n\005Glyph\022\021\n\tcharacter\030\001 \001"
+  "(\r\022\t\n\001x\030\002 \001(\r\022\t\n\001y\030\003 \001(\r\022\024\n\005width\030\004 \001(\rB"
+  "\005\222\265\030\001w\022\025\n\006height\030\005 \001(\rB\005\222\265\030\001h\022\r\n\005shift\030\006"
+  " \001(\005\022\016\n\006offset\030\007 \001(\005\032C\n\005Range\022\034\n\003min\030\001 \001"
+  "(\005B\017\222\265\030\013GMX_SPLIT/0\022\034\n\003max\030\002 \001(\005B\017\222\265\030\013GM"
+  "X_SPLIT/1"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fFont_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fFont_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fFont_2eproto = {
+    false, false, 689, descriptor_table_protodef_resources_2fFont_2eproto,
+    "resources/Font.proto",
+    &descriptor_table_resources_2fFont_2eproto_once, descriptor_table_resources_2fFont_2eproto_deps, 1, 3,
+    schemas, file_default_instances, TableStruct_resources_2fFont_2eproto::offsets,
+    file_level_metadata_resources_2fFont_2eproto, file_level_enum_descriptors_resources_2fFont_2eproto,
+    file_level_service_descriptors_resources_2fFont_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fFont_2eproto_getter() {
+  return &descriptor_table_resources_2fFont_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fFont_2eproto(&descriptor_table_resources_2fFont_2eproto);
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Font_Glyph::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Font_Glyph>()._impl_._has_bits_);
+  static void set_has_character(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_shift(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+Font_Glyph::Font_Glyph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Font.Glyph)
+}
+Font_Glyph::Font_Glyph(const Font_Glyph& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Font_Glyph* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.character_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.shift_){}
+    , decltype(_impl_.offset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.character_, &from._impl_.character_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.character_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Font.Glyph)
+}
+
+inline void Font_Glyph::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.character_){0u}
+    , decltype(_impl_.x_){0u}
+    , decltype(_impl_.y_){0u}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+    , decltype(_impl_.shift_){0}
+    , decltype(_impl_.offset_){0}
+  };
+}
+
+Font_Glyph::~Font_Glyph() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Font.Glyph)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Font_Glyph::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Font_Glyph::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Font_Glyph::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Font.Glyph)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.character_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.offset_) -
+        reinterpret_cast<char*>(&_impl_.character_)) + sizeof(_impl_.offset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Font_Glyph::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 character = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_character(&has_bits);
+          _impl_.character_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 width = 4 [(.buffers.gmx) = "w"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 height = 5 [(.buffers.gmx) = "h"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 shift = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_shift(&has_bits);
+          _impl_.shift_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 offset = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Font_Glyph::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Font.Glyph)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 character = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_character(), target);
+  }
+
+  // optional uint32 x = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_x(), target);
+  }
+
+  // optional uint32 y = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_y(), target);
+  }
+
+  // optional uint32 width = 4 [(.buffers.gmx) = "w"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_width(), target);
+  }
+
+  // optional uint32 height = 5 [(.buffers.gmx) = "h"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_height(), target);
+  }
+
+  // optional int32 shift = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_shift(), target);
+  }
+
+  // optional int32 offset = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Font.Glyph)
+  return target;
+}
+
+size_t Font_Glyph::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Font.Glyph)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional uint32 character = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_character());
+    }
+
+    // optional uint32 x = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x());
+    }
+
+    // optional uint32 y = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_y());
+    }
+
+    // optional uint32 width = 4 [(.buffers.gmx) = "w"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
+    }
+
+    // optional uint32 height = 5 [(.buffers.gmx) = "h"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_height());
+    }
+
+    // optional int32 shift = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shift());
+    }
+
+    // optional int32 offset = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_offset());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Font_Glyph::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Font_Glyph::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Font_Glyph::GetClassData() const { return &_class_data_; }
+
+
+void Font_Glyph::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Font_Glyph*>(&to_msg);
+  auto& from = static_cast<const Font_Glyph&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Font.Glyph)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.character_ = from._impl_.character_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.shift_ = from._impl_.shift_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Font_Glyph::CopyFrom(const Font_Glyph& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Font.Glyph)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Font_Glyph::IsInitialized() const {
+  return true;
+}
+
+void Font_Glyph::InternalSwap(Font_Glyph* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Font_Glyph, _impl_.offset_)
+      + sizeof(Font_Glyph::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(Font_Glyph, _impl_.character_)>(
+          reinterpret_cast<char*>(&_impl_.character_),
+          reinterpret_cast<char*>(&other->_impl_.character_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Font_Glyph::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fFont_2eproto_getter, &descriptor_table_resources_2fFont_2eproto_once,
+      file_level_metadata_resources_2fFont_2eproto[0]);
+}
+
+// ===================================================================
+
+class Font_Range::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Font_Range>()._impl_._has_bits_);
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Font_Range::Font_Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Font.Range)
+}
+Font_Range::Font_Range(const Font_Range& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Font_Range* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Font.Range)
+}
+
+inline void Font_Range::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+  };
+}
+
+Font_Range::~Font_Range() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Font.Range)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Font_Range::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Font_Range::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Font_Range::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Font.Range)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.min_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_) -
+        reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Font_Range::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 min = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_min(&has_bits);
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max(&has_bits);
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Font_Range::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Font.Range)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 min = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_min(), target);
+  }
+
+  // optional int32 max = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Font.Range)
+  return target;
+}
+
+size_t Font_Range::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Font.Range)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 min = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min());
+    }
+
+    // optional int32 max = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Font_Range::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Font_Range::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Font_Range::GetClassData() const { return &_class_data_; }
+
+
+void Font_Range::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Font_Range*>(&to_msg);
+  auto& from = static_cast<const Font_Range&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Font.Range)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_ = from._impl_.min_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_ = from._impl_.max_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Font_Range::CopyFrom(const Font_Range& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Font.Range)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Font_Range::IsInitialized() const {
+  return true;
+}
+
+void Font_Range::InternalSwap(Font_Range* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Font_Range, _impl_.max_)
+      + sizeof(Font_Range::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(Font_Range, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Font_Range::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fFont_2eproto_getter, &descriptor_table_resources_2fFont_2eproto_once,
+      file_level_metadata_resources_2fFont_2eproto[1]);
+}
+
+// ===================================================================
+
+class Font::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Font>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_font_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_bold(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_italic(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_renderhq(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_charset(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_antialias(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_include_ttf(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_ttf_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_texture_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_image(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Font::Font(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Font)
+}
+Font::Font(const Font& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Font* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ranges_){from._impl_.ranges_}
+    , decltype(_impl_.glyphs_){from._impl_.glyphs_}
+    , decltype(_impl_.font_name_){}
+    , decltype(_impl_.ttf_file_){}
+    , decltype(_impl_.image_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.bold_){}
+    , decltype(_impl_.italic_){}
+    , decltype(_impl_.renderhq_){}
+    , decltype(_impl_.include_ttf_){}
+    , decltype(_impl_.charset_){}
+    , decltype(_impl_.antialias_){}
+    , decltype(_impl_.texture_group_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.font_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.font_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_font_name()) {
+    _this->_impl_.font_name_.Set(from._internal_font_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ttf_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ttf_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ttf_file()) {
+    _this->_impl_.ttf_file_.Set(from._internal_ttf_file(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.image_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_image()) {
+    _this->_impl_.image_.Set(from._internal_image(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.texture_group_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.texture_group_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Font)
+}
+
+inline void Font::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ranges_){arena}
+    , decltype(_impl_.glyphs_){arena}
+    , decltype(_impl_.font_name_){}
+    , decltype(_impl_.ttf_file_){}
+    , decltype(_impl_.image_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.size_){0}
+    , decltype(_impl_.bold_){false}
+    , decltype(_impl_.italic_){false}
+    , decltype(_impl_.renderhq_){false}
+    , decltype(_impl_.include_ttf_){false}
+    , decltype(_impl_.charset_){0u}
+    , decltype(_impl_.antialias_){0u}
+    , decltype(_impl_.texture_group_){0}
+  };
+  _impl_.font_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.font_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ttf_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ttf_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.image_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Font::~Font() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Font)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Font::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranges_.~RepeatedPtrField();
+  _impl_.glyphs_.~RepeatedPtrField();
+  _impl_.font_name_.Destroy();
+  _impl_.ttf_file_.Destroy();
+  _impl_.image_.Destroy();
+}
+
+void Font::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Font::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Font)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ranges_.Clear();
+  _impl_.glyphs_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.font_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.ttf_file_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.image_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.renderhq_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.renderhq_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.include_ttf_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.texture_group_) -
+        reinterpret_cast<char*>(&_impl_.include_ttf_)) + sizeof(_impl_.texture_group_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Font::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string font_name = 3 [(.buffers.gmx) = "name"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_font_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Font.font_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bold = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_bold(&has_bits);
+          _impl_.bold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool italic = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_italic(&has_bits);
+          _impl_.italic_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Font.Range ranges = 7 [(.buffers.gmx) = "ranges/range0"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Font.Glyph glyphs = 8 [(.buffers.gmx) = "glyphs/glyph"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_glyphs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool renderhq = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_renderhq(&has_bits);
+          _impl_.renderhq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 charset = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_charset(&has_bits);
+          _impl_.charset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 antialias = 12 [(.buffers.gmx) = "aa"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_antialias(&has_bits);
+          _impl_.antialias_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool include_ttf = 13 [(.buffers.gmx) = "includeTTF"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_include_ttf(&has_bits);
+          _impl_.include_ttf_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string ttf_file = 14 [(.buffers.gmx) = "TTFName"];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_ttf_file();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Font.ttf_file");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 texture_group = 15 [(.buffers.gmx) = "texgroups/texgroup0"];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_texture_group(&has_bits);
+          _impl_.texture_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string image = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_image();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Font.image");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Font::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Font)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional string font_name = 3 [(.buffers.gmx) = "name"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_font_name().data(), static_cast<int>(this->_internal_font_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Font.font_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_font_name(), target);
+  }
+
+  // optional int32 size = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_size(), target);
+  }
+
+  // optional bool bold = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_bold(), target);
+  }
+
+  // optional bool italic = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_italic(), target);
+  }
+
+  // repeated .buffers.resources.Font.Range ranges = 7 [(.buffers.gmx) = "ranges/range0"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ranges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .buffers.resources.Font.Glyph glyphs = 8 [(.buffers.gmx) = "glyphs/glyph"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_glyphs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_glyphs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional bool renderhq = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_renderhq(), target);
+  }
+
+  // optional uint32 charset = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_charset(), target);
+  }
+
+  // optional uint32 antialias = 12 [(.buffers.gmx) = "aa"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_antialias(), target);
+  }
+
+  // optional bool include_ttf = 13 [(.buffers.gmx) = "includeTTF"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_include_ttf(), target);
+  }
+
+  // optional string ttf_file = 14 [(.buffers.gmx) = "TTFName"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_ttf_file().data(), static_cast<int>(this->_internal_ttf_file().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Font.ttf_file");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_ttf_file(), target);
+  }
+
+  // optional int32 texture_group = 15 [(.buffers.gmx) = "texgroups/texgroup0"];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_texture_group(), target);
+  }
+
+  // optional string image = 16;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_image().data(), static_cast<int>(this->_internal_image().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Font.image");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_image(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Font)
+  return target;
+}
+
+size_t Font::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Font)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Font.Range ranges = 7 [(.buffers.gmx) = "ranges/range0"];
+  total_size += 1UL * this->_internal_ranges_size();
+  for (const auto& msg : this->_impl_.ranges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .buffers.resources.Font.Glyph glyphs = 8 [(.buffers.gmx) = "glyphs/glyph"];
+  total_size += 1UL * this->_internal_glyphs_size();
+  for (const auto& msg : this->_impl_.glyphs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string font_name = 3 [(.buffers.gmx) = "name"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_font_name());
+    }
+
+    // optional string ttf_file = 14 [(.buffers.gmx) = "TTFName"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_ttf_file());
+    }
+
+    // optional string image = 16;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_image());
+    }
+
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 size = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
+    }
+
+    // optional bool bold = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool italic = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool renderhq = 10;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional bool include_ttf = 13 [(.buffers.gmx) = "includeTTF"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 charset = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_charset());
+    }
+
+    // optional uint32 antialias = 12 [(.buffers.gmx) = "aa"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_antialias());
+    }
+
+    // optional int32 texture_group = 15 [(.buffers.gmx) = "texgroups/texgroup0"];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_texture_group());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Font::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Font::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Font::GetClassData() const { return &_class_data_; }
+
+
+void Font::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Font*>(&to_msg);
+  auto& from = static_cast<const Font&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Font)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranges_.MergeFrom(from._impl_.ranges_);
+  _this->_impl_.glyphs_.MergeFrom(from._impl_.glyphs_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_font_name(from._internal_font_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_ttf_file(from._internal_ttf_file());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_image(from._internal_image());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.bold_ = from._impl_.bold_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.italic_ = from._impl_.italic_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.renderhq_ = from._impl_.renderhq_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.include_ttf_ = from._impl_.include_ttf_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.charset_ = from._impl_.charset_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.antialias_ = from._impl_.antialias_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.texture_group_ = from._impl_.texture_group_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Font::CopyFrom(const Font& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Font)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Font::IsInitialized() const {
+  return true;
+}
+
+void Font::InternalSwap(Font* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ranges_.InternalSwap(&other->_impl_.ranges_);
+  _impl_.glyphs_.InternalSwap(&other->_impl_.glyphs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.font_name_, lhs_arena,
+      &other->_impl_.font_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ttf_file_, lhs_arena,
+      &other->_impl_.ttf_file_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_, lhs_arena,
+      &other->_impl_.image_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Font, _impl_.texture_group_)
+      + sizeof(Font::_impl_.texture_group_)
+      - PROTOBUF_FIELD_OFFSET(Font, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Font::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fFont_2eproto_getter, &descriptor_table_resources_2fFont_2eproto_once,
+      file_level_metadata_resources_2fFont_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Font_Glyph*
+Arena::CreateMaybeMessage< ::buffers::resources::Font_Glyph >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Font_Glyph >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Font_Range*
+Arena::CreateMaybeMessage< ::buffers::resources::Font_Range >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Font_Range >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Font*
+Arena::CreateMaybeMessage< ::buffers::resources::Font >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Font >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
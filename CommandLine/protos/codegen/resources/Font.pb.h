@@ -0,0 +1,1700 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Font.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fFont_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fFont_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fFont_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fFont_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fFont_2eproto;
+namespace buffers {
+namespace resources {
+class Font;
+struct FontDefaultTypeInternal;
+extern FontDefaultTypeInternal _Font_default_instance_;
+class Font_Glyph;
+struct Font_GlyphDefaultTypeInternal;
+extern Font_GlyphDefaultTypeInternal _Font_Glyph_default_instance_;
+class Font_Range;
+struct Font_RangeDefaultTypeInternal;
+extern Font_RangeDefaultTypeInternal _Font_Range_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Font* Arena::CreateMaybeMessage<::buffers::resources::Font>(Arena*);
+template<> ::buffers::resources::Font_Glyph* Arena::CreateMaybeMessage<::buffers::resources::Font_Glyph>(Arena*);
+template<> ::buffers::resources::Font_Range* Arena::CreateMaybeMessage<::buffers::resources::Font_Range>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Font_Glyph final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Font.Glyph) */ {
+ public:
+  inline Font_Glyph() : Font_Glyph(nullptr) {}
+  ~Font_Glyph() override;
+  explicit PROTOBUF_CONSTEXPR Font_Glyph(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Font_Glyph(const Font_Glyph& from);
+  Font_Glyph(Font_Glyph&& from) noexcept
+    : Font_Glyph() {
+    *this = ::std::move(from);
+  }
+
+  inline Font_Glyph& operator=(const Font_Glyph& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Font_Glyph& operator=(Font_Glyph&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Font_Glyph& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Font_Glyph* internal_default_instance() {
+    return reinterpret_cast<const Font_Glyph*>(
+               &_Font_Glyph_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Font_Glyph& a, Font_Glyph& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Font_Glyph* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Font_Glyph* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Font_Glyph* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Font_Glyph>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Font_Glyph& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Font_Glyph& from) {
+    Font_Glyph::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Font_Glyph* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Font.Glyph";
+  }
+  protected:
+  explicit Font_Glyph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCharacterFieldNumber = 1,
+    kXFieldNumber = 2,
+    kYFieldNumber = 3,
+    kWidthFieldNumber = 4,
+    kHeightFieldNumber = 5,
+    kShiftFieldNumber = 6,
+    kOffsetFieldNumber = 7,
+  };
+  // optional uint32 character = 1;
+  bool has_character() const;
+  private:
+  bool _internal_has_character() const;
+  public:
+  void clear_character();
+  uint32_t character() const;
+  void set_character(uint32_t value);
+  private:
+  uint32_t _internal_character() const;
+  void _internal_set_character(uint32_t value);
+  public:
+
+  // optional uint32 x = 2;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  uint32_t x() const;
+  void set_x(uint32_t value);
+  private:
+  uint32_t _internal_x() const;
+  void _internal_set_x(uint32_t value);
+  public:
+
+  // optional uint32 y = 3;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  uint32_t y() const;
+  void set_y(uint32_t value);
+  private:
+  uint32_t _internal_y() const;
+  void _internal_set_y(uint32_t value);
+  public:
+
+  // optional uint32 width = 4 [(.buffers.gmx) = "w"];
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // optional uint32 height = 5 [(.buffers.gmx) = "h"];
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // optional int32 shift = 6;
+  bool has_shift() const;
+  private:
+  bool _internal_has_shift() const;
+  public:
+  void clear_shift();
+  int32_t shift() const;
+  void set_shift(int32_t value);
+  private:
+  int32_t _internal_shift() const;
+  void _internal_set_shift(int32_t value);
+  public:
+
+  // optional int32 offset = 7;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Font.Glyph)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t character_;
+    uint32_t x_;
+    uint32_t y_;
+    uint32_t width_;
+    uint32_t height_;
+    int32_t shift_;
+    int32_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fFont_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Font_Range final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Font.Range) */ {
+ public:
+  inline Font_Range() : Font_Range(nullptr) {}
+  ~Font_Range() override;
+  explicit PROTOBUF_CONSTEXPR Font_Range(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Font_Range(const Font_Range& from);
+  Font_Range(Font_Range&& from) noexcept
+    : Font_Range() {
+    *this = ::std::move(from);
+  }
+
+  inline Font_Range& operator=(const Font_Range& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Font_Range& operator=(Font_Range&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Font_Range& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Font_Range* internal_default_instance() {
+    return reinterpret_cast<const Font_Range*>(
+               &_Font_Range_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Font_Range& a, Font_Range& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Font_Range* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Font_Range* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Font_Range* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Font_Range>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Font_Range& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Font_Range& from) {
+    Font_Range::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Font_Range* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Font.Range";
+  }
+  protected:
+  explicit Font_Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMinFieldNumber = 1,
+    kMaxFieldNumber = 2,
+  };
+  // optional int32 min = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+  bool has_min() const;
+  private:
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  int32_t min() const;
+  void set_min(int32_t value);
+  private:
+  int32_t _internal_min() const;
+  void _internal_set_min(int32_t value);
+  public:
+
+  // optional int32 max = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  int32_t max() const;
+  void set_max(int32_t value);
+  private:
+  int32_t _internal_max() const;
+  void _internal_set_max(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Font.Range)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t min_;
+    int32_t max_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fFont_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Font final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Font) */ {
+ public:
+  inline Font() : Font(nullptr) {}
+  ~Font() override;
+  explicit PROTOBUF_CONSTEXPR Font(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Font(const Font& from);
+  Font(Font&& from) noexcept
+    : Font() {
+    *this = ::std::move(from);
+  }
+
+  inline Font& operator=(const Font& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Font& operator=(Font&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Font& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Font* internal_default_instance() {
+    return reinterpret_cast<const Font*>(
+               &_Font_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Font& a, Font& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Font* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Font* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Font* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Font>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Font& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Font& from) {
+    Font::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Font* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Font";
+  }
+  protected:
+  explicit Font(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Font_Glyph Glyph;
+  typedef Font_Range Range;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRangesFieldNumber = 7,
+    kGlyphsFieldNumber = 8,
+    kFontNameFieldNumber = 3,
+    kTtfFileFieldNumber = 14,
+    kImageFieldNumber = 16,
+    kIdFieldNumber = 2,
+    kSizeFieldNumber = 4,
+    kBoldFieldNumber = 5,
+    kItalicFieldNumber = 6,
+    kRenderhqFieldNumber = 10,
+    kIncludeTtfFieldNumber = 13,
+    kCharsetFieldNumber = 11,
+    kAntialiasFieldNumber = 12,
+    kTextureGroupFieldNumber = 15,
+  };
+  // repeated .buffers.resources.Font.Range ranges = 7 [(.buffers.gmx) = "ranges/range0"];
+  int ranges_size() const;
+  private:
+  int _internal_ranges_size() const;
+  public:
+  void clear_ranges();
+  ::buffers::resources::Font_Range* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Range >*
+      mutable_ranges();
+  private:
+  const ::buffers::resources::Font_Range& _internal_ranges(int index) const;
+  ::buffers::resources::Font_Range* _internal_add_ranges();
+  public:
+  const ::buffers::resources::Font_Range& ranges(int index) const;
+  ::buffers::resources::Font_Range* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Range >&
+      ranges() const;
+
+  // repeated .buffers.resources.Font.Glyph glyphs = 8 [(.buffers.gmx) = "glyphs/glyph"];
+  int glyphs_size() const;
+  private:
+  int _internal_glyphs_size() const;
+  public:
+  void clear_glyphs();
+  ::buffers::resources::Font_Glyph* mutable_glyphs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Glyph >*
+      mutable_glyphs();
+  private:
+  const ::buffers::resources::Font_Glyph& _internal_glyphs(int index) const;
+  ::buffers::resources::Font_Glyph* _internal_add_glyphs();
+  public:
+  const ::buffers::resources::Font_Glyph& glyphs(int index) const;
+  ::buffers::resources::Font_Glyph* add_glyphs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Glyph >&
+      glyphs() const;
+
+  // optional string font_name = 3 [(.buffers.gmx) = "name"];
+  bool has_font_name() const;
+  private:
+  bool _internal_has_font_name() const;
+  public:
+  void clear_font_name();
+  const std::string& font_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_font_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_font_name();
+  PROTOBUF_NODISCARD std::string* release_font_name();
+  void set_allocated_font_name(std::string* font_name);
+  private:
+  const std::string& _internal_font_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_font_name(const std::string& value);
+  std::string* _internal_mutable_font_name();
+  public:
+
+  // optional string ttf_file = 14 [(.buffers.gmx) = "TTFName"];
+  bool has_ttf_file() const;
+  private:
+  bool _internal_has_ttf_file() const;
+  public:
+  void clear_ttf_file();
+  const std::string& ttf_file() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ttf_file(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ttf_file();
+  PROTOBUF_NODISCARD std::string* release_ttf_file();
+  void set_allocated_ttf_file(std::string* ttf_file);
+  private:
+  const std::string& _internal_ttf_file() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ttf_file(const std::string& value);
+  std::string* _internal_mutable_ttf_file();
+  public:
+
+  // optional string image = 16;
+  bool has_image() const;
+  private:
+  bool _internal_has_image() const;
+  public:
+  void clear_image();
+  const std::string& image() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_image(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_image();
+  PROTOBUF_NODISCARD std::string* release_image();
+  void set_allocated_image(std::string* image);
+  private:
+  const std::string& _internal_image() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_image(const std::string& value);
+  std::string* _internal_mutable_image();
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 size = 4;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // optional bool bold = 5;
+  bool has_bold() const;
+  private:
+  bool _internal_has_bold() const;
+  public:
+  void clear_bold();
+  bool bold() const;
+  void set_bold(bool value);
+  private:
+  bool _internal_bold() const;
+  void _internal_set_bold(bool value);
+  public:
+
+  // optional bool italic = 6;
+  bool has_italic() const;
+  private:
+  bool _internal_has_italic() const;
+  public:
+  void clear_italic();
+  bool italic() const;
+  void set_italic(bool value);
+  private:
+  bool _internal_italic() const;
+  void _internal_set_italic(bool value);
+  public:
+
+  // optional bool renderhq = 10;
+  bool has_renderhq() const;
+  private:
+  bool _internal_has_renderhq() const;
+  public:
+  void clear_renderhq();
+  bool renderhq() const;
+  void set_renderhq(bool value);
+  private:
+  bool _internal_renderhq() const;
+  void _internal_set_renderhq(bool value);
+  public:
+
+  // optional bool include_ttf = 13 [(.buffers.gmx) = "includeTTF"];
+  bool has_include_ttf() const;
+  private:
+  bool _internal_has_include_ttf() const;
+  public:
+  void clear_include_ttf();
+  bool include_ttf() const;
+  void set_include_ttf(bool value);
+  private:
+  bool _internal_include_ttf() const;
+  void _internal_set_include_ttf(bool value);
+  public:
+
+  // optional uint32 charset = 11;
+  bool has_charset() const;
+  private:
+  bool _internal_has_charset() const;
+  public:
+  void clear_charset();
+  uint32_t charset() const;
+  void set_charset(uint32_t value);
+  private:
+  uint32_t _internal_charset() const;
+  void _internal_set_charset(uint32_t value);
+  public:
+
+  // optional uint32 antialias = 12 [(.buffers.gmx) = "aa"];
+  bool has_antialias() const;
+  private:
+  bool _internal_has_antialias() const;
+  public:
+  void clear_antialias();
+  uint32_t antialias() const;
+  void set_antialias(uint32_t value);
+  private:
+  uint32_t _internal_antialias() const;
+  void _internal_set_antialias(uint32_t value);
+  public:
+
+  // optional int32 texture_group = 15 [(.buffers.gmx) = "texgroups/texgroup0"];
+  bool has_texture_group() const;
+  private:
+  bool _internal_has_texture_group() const;
+  public:
+  void clear_texture_group();
+  int32_t texture_group() const;
+  void set_texture_group(int32_t value);
+  private:
+  int32_t _internal_texture_group() const;
+  void _internal_set_texture_group(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Font)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Range > ranges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Glyph > glyphs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr font_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ttf_file_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_;
+    int32_t id_;
+    int32_t size_;
+    bool bold_;
+    bool italic_;
+    bool renderhq_;
+    bool include_ttf_;
+    uint32_t charset_;
+    uint32_t antialias_;
+    int32_t texture_group_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fFont_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Font_Glyph
+
+// optional uint32 character = 1;
+inline bool Font_Glyph::_internal_has_character() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_character() const {
+  return _internal_has_character();
+}
+inline void Font_Glyph::clear_character() {
+  _impl_.character_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Font_Glyph::_internal_character() const {
+  return _impl_.character_;
+}
+inline uint32_t Font_Glyph::character() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.character)
+  return _internal_character();
+}
+inline void Font_Glyph::_internal_set_character(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.character_ = value;
+}
+inline void Font_Glyph::set_character(uint32_t value) {
+  _internal_set_character(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.character)
+}
+
+// optional uint32 x = 2;
+inline bool Font_Glyph::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_x() const {
+  return _internal_has_x();
+}
+inline void Font_Glyph::clear_x() {
+  _impl_.x_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Font_Glyph::_internal_x() const {
+  return _impl_.x_;
+}
+inline uint32_t Font_Glyph::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.x)
+  return _internal_x();
+}
+inline void Font_Glyph::_internal_set_x(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
+}
+inline void Font_Glyph::set_x(uint32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.x)
+}
+
+// optional uint32 y = 3;
+inline bool Font_Glyph::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_y() const {
+  return _internal_has_y();
+}
+inline void Font_Glyph::clear_y() {
+  _impl_.y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Font_Glyph::_internal_y() const {
+  return _impl_.y_;
+}
+inline uint32_t Font_Glyph::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.y)
+  return _internal_y();
+}
+inline void Font_Glyph::_internal_set_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.y_ = value;
+}
+inline void Font_Glyph::set_y(uint32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.y)
+}
+
+// optional uint32 width = 4 [(.buffers.gmx) = "w"];
+inline bool Font_Glyph::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_width() const {
+  return _internal_has_width();
+}
+inline void Font_Glyph::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Font_Glyph::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t Font_Glyph::width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.width)
+  return _internal_width();
+}
+inline void Font_Glyph::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.width_ = value;
+}
+inline void Font_Glyph::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.width)
+}
+
+// optional uint32 height = 5 [(.buffers.gmx) = "h"];
+inline bool Font_Glyph::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_height() const {
+  return _internal_has_height();
+}
+inline void Font_Glyph::clear_height() {
+  _impl_.height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Font_Glyph::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t Font_Glyph::height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.height)
+  return _internal_height();
+}
+inline void Font_Glyph::_internal_set_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.height_ = value;
+}
+inline void Font_Glyph::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.height)
+}
+
+// optional int32 shift = 6;
+inline bool Font_Glyph::_internal_has_shift() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_shift() const {
+  return _internal_has_shift();
+}
+inline void Font_Glyph::clear_shift() {
+  _impl_.shift_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Font_Glyph::_internal_shift() const {
+  return _impl_.shift_;
+}
+inline int32_t Font_Glyph::shift() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.shift)
+  return _internal_shift();
+}
+inline void Font_Glyph::_internal_set_shift(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.shift_ = value;
+}
+inline void Font_Glyph::set_shift(int32_t value) {
+  _internal_set_shift(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.shift)
+}
+
+// optional int32 offset = 7;
+inline bool Font_Glyph::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Font_Glyph::has_offset() const {
+  return _internal_has_offset();
+}
+inline void Font_Glyph::clear_offset() {
+  _impl_.offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Font_Glyph::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t Font_Glyph::offset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Glyph.offset)
+  return _internal_offset();
+}
+inline void Font_Glyph::_internal_set_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.offset_ = value;
+}
+inline void Font_Glyph::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Glyph.offset)
+}
+
+// -------------------------------------------------------------------
+
+// Font_Range
+
+// optional int32 min = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+inline bool Font_Range::_internal_has_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Font_Range::has_min() const {
+  return _internal_has_min();
+}
+inline void Font_Range::clear_min() {
+  _impl_.min_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Font_Range::_internal_min() const {
+  return _impl_.min_;
+}
+inline int32_t Font_Range::min() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Range.min)
+  return _internal_min();
+}
+inline void Font_Range::_internal_set_min(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_ = value;
+}
+inline void Font_Range::set_min(int32_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Range.min)
+}
+
+// optional int32 max = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+inline bool Font_Range::_internal_has_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Font_Range::has_max() const {
+  return _internal_has_max();
+}
+inline void Font_Range::clear_max() {
+  _impl_.max_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Font_Range::_internal_max() const {
+  return _impl_.max_;
+}
+inline int32_t Font_Range::max() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.Range.max)
+  return _internal_max();
+}
+inline void Font_Range::_internal_set_max(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_ = value;
+}
+inline void Font_Range::set_max(int32_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.Range.max)
+}
+
+// -------------------------------------------------------------------
+
+// Font
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Font::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Font::has_id() const {
+  return _internal_has_id();
+}
+inline void Font::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Font::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Font::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.id)
+  return _internal_id();
+}
+inline void Font::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.id_ = value;
+}
+inline void Font::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.id)
+}
+
+// optional string font_name = 3 [(.buffers.gmx) = "name"];
+inline bool Font::_internal_has_font_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Font::has_font_name() const {
+  return _internal_has_font_name();
+}
+inline void Font::clear_font_name() {
+  _impl_.font_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Font::font_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.font_name)
+  return _internal_font_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Font::set_font_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.font_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.font_name)
+}
+inline std::string* Font::mutable_font_name() {
+  std::string* _s = _internal_mutable_font_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Font.font_name)
+  return _s;
+}
+inline const std::string& Font::_internal_font_name() const {
+  return _impl_.font_name_.Get();
+}
+inline void Font::_internal_set_font_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.font_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Font::_internal_mutable_font_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.font_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Font::release_font_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Font.font_name)
+  if (!_internal_has_font_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.font_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.font_name_.IsDefault()) {
+    _impl_.font_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Font::set_allocated_font_name(std::string* font_name) {
+  if (font_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.font_name_.SetAllocated(font_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.font_name_.IsDefault()) {
+    _impl_.font_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Font.font_name)
+}
+
+// optional int32 size = 4;
+inline bool Font::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Font::has_size() const {
+  return _internal_has_size();
+}
+inline void Font::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Font::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t Font::size() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.size)
+  return _internal_size();
+}
+inline void Font::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.size_ = value;
+}
+inline void Font::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.size)
+}
+
+// optional bool bold = 5;
+inline bool Font::_internal_has_bold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Font::has_bold() const {
+  return _internal_has_bold();
+}
+inline void Font::clear_bold() {
+  _impl_.bold_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Font::_internal_bold() const {
+  return _impl_.bold_;
+}
+inline bool Font::bold() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.bold)
+  return _internal_bold();
+}
+inline void Font::_internal_set_bold(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.bold_ = value;
+}
+inline void Font::set_bold(bool value) {
+  _internal_set_bold(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.bold)
+}
+
+// optional bool italic = 6;
+inline bool Font::_internal_has_italic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Font::has_italic() const {
+  return _internal_has_italic();
+}
+inline void Font::clear_italic() {
+  _impl_.italic_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Font::_internal_italic() const {
+  return _impl_.italic_;
+}
+inline bool Font::italic() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.italic)
+  return _internal_italic();
+}
+inline void Font::_internal_set_italic(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.italic_ = value;
+}
+inline void Font::set_italic(bool value) {
+  _internal_set_italic(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.italic)
+}
+
+// repeated .buffers.resources.Font.Range ranges = 7 [(.buffers.gmx) = "ranges/range0"];
+inline int Font::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
+}
+inline int Font::ranges_size() const {
+  return _internal_ranges_size();
+}
+inline void Font::clear_ranges() {
+  _impl_.ranges_.Clear();
+}
+inline ::buffers::resources::Font_Range* Font::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Font.ranges)
+  return _impl_.ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Range >*
+Font::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Font.ranges)
+  return &_impl_.ranges_;
+}
+inline const ::buffers::resources::Font_Range& Font::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
+}
+inline const ::buffers::resources::Font_Range& Font::ranges(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.ranges)
+  return _internal_ranges(index);
+}
+inline ::buffers::resources::Font_Range* Font::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
+}
+inline ::buffers::resources::Font_Range* Font::add_ranges() {
+  ::buffers::resources::Font_Range* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:buffers.resources.Font.ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Range >&
+Font::ranges() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Font.ranges)
+  return _impl_.ranges_;
+}
+
+// repeated .buffers.resources.Font.Glyph glyphs = 8 [(.buffers.gmx) = "glyphs/glyph"];
+inline int Font::_internal_glyphs_size() const {
+  return _impl_.glyphs_.size();
+}
+inline int Font::glyphs_size() const {
+  return _internal_glyphs_size();
+}
+inline void Font::clear_glyphs() {
+  _impl_.glyphs_.Clear();
+}
+inline ::buffers::resources::Font_Glyph* Font::mutable_glyphs(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Font.glyphs)
+  return _impl_.glyphs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Glyph >*
+Font::mutable_glyphs() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Font.glyphs)
+  return &_impl_.glyphs_;
+}
+inline const ::buffers::resources::Font_Glyph& Font::_internal_glyphs(int index) const {
+  return _impl_.glyphs_.Get(index);
+}
+inline const ::buffers::resources::Font_Glyph& Font::glyphs(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.glyphs)
+  return _internal_glyphs(index);
+}
+inline ::buffers::resources::Font_Glyph* Font::_internal_add_glyphs() {
+  return _impl_.glyphs_.Add();
+}
+inline ::buffers::resources::Font_Glyph* Font::add_glyphs() {
+  ::buffers::resources::Font_Glyph* _add = _internal_add_glyphs();
+  // @@protoc_insertion_point(field_add:buffers.resources.Font.glyphs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Font_Glyph >&
+Font::glyphs() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Font.glyphs)
+  return _impl_.glyphs_;
+}
+
+// optional bool renderhq = 10;
+inline bool Font::_internal_has_renderhq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Font::has_renderhq() const {
+  return _internal_has_renderhq();
+}
+inline void Font::clear_renderhq() {
+  _impl_.renderhq_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Font::_internal_renderhq() const {
+  return _impl_.renderhq_;
+}
+inline bool Font::renderhq() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.renderhq)
+  return _internal_renderhq();
+}
+inline void Font::_internal_set_renderhq(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.renderhq_ = value;
+}
+inline void Font::set_renderhq(bool value) {
+  _internal_set_renderhq(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.renderhq)
+}
+
+// optional uint32 charset = 11;
+inline bool Font::_internal_has_charset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Font::has_charset() const {
+  return _internal_has_charset();
+}
+inline void Font::clear_charset() {
+  _impl_.charset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t Font::_internal_charset() const {
+  return _impl_.charset_;
+}
+inline uint32_t Font::charset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.charset)
+  return _internal_charset();
+}
+inline void Font::_internal_set_charset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.charset_ = value;
+}
+inline void Font::set_charset(uint32_t value) {
+  _internal_set_charset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.charset)
+}
+
+// optional uint32 antialias = 12 [(.buffers.gmx) = "aa"];
+inline bool Font::_internal_has_antialias() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Font::has_antialias() const {
+  return _internal_has_antialias();
+}
+inline void Font::clear_antialias() {
+  _impl_.antialias_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t Font::_internal_antialias() const {
+  return _impl_.antialias_;
+}
+inline uint32_t Font::antialias() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.antialias)
+  return _internal_antialias();
+}
+inline void Font::_internal_set_antialias(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.antialias_ = value;
+}
+inline void Font::set_antialias(uint32_t value) {
+  _internal_set_antialias(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.antialias)
+}
+
+// optional bool include_ttf = 13 [(.buffers.gmx) = "includeTTF"];
+inline bool Font::_internal_has_include_ttf() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Font::has_include_ttf() const {
+  return _internal_has_include_ttf();
+}
+inline void Font::clear_include_ttf() {
+  _impl_.include_ttf_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Font::_internal_include_ttf() const {
+  return _impl_.include_ttf_;
+}
+inline bool Font::include_ttf() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.include_ttf)
+  return _internal_include_ttf();
+}
+inline void Font::_internal_set_include_ttf(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.include_ttf_ = value;
+}
+inline void Font::set_include_ttf(bool value) {
+  _internal_set_include_ttf(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.include_ttf)
+}
+
+// optional string ttf_file = 14 [(.buffers.gmx) = "TTFName"];
+inline bool Font::_internal_has_ttf_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Font::has_ttf_file() const {
+  return _internal_has_ttf_file();
+}
+inline void Font::clear_ttf_file() {
+  _impl_.ttf_file_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Font::ttf_file() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.ttf_file)
+  return _internal_ttf_file();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Font::set_ttf_file(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.ttf_file_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.ttf_file)
+}
+inline std::string* Font::mutable_ttf_file() {
+  std::string* _s = _internal_mutable_ttf_file();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Font.ttf_file)
+  return _s;
+}
+inline const std::string& Font::_internal_ttf_file() const {
+  return _impl_.ttf_file_.Get();
+}
+inline void Font::_internal_set_ttf_file(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ttf_file_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Font::_internal_mutable_ttf_file() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.ttf_file_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Font::release_ttf_file() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Font.ttf_file)
+  if (!_internal_has_ttf_file()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.ttf_file_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ttf_file_.IsDefault()) {
+    _impl_.ttf_file_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Font::set_allocated_ttf_file(std::string* ttf_file) {
+  if (ttf_file != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.ttf_file_.SetAllocated(ttf_file, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ttf_file_.IsDefault()) {
+    _impl_.ttf_file_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Font.ttf_file)
+}
+
+// optional int32 texture_group = 15 [(.buffers.gmx) = "texgroups/texgroup0"];
+inline bool Font::_internal_has_texture_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Font::has_texture_group() const {
+  return _internal_has_texture_group();
+}
+inline void Font::clear_texture_group() {
+  _impl_.texture_group_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t Font::_internal_texture_group() const {
+  return _impl_.texture_group_;
+}
+inline int32_t Font::texture_group() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.texture_group)
+  return _internal_texture_group();
+}
+inline void Font::_internal_set_texture_group(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.texture_group_ = value;
+}
+inline void Font::set_texture_group(int32_t value) {
+  _internal_set_texture_group(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.texture_group)
+}
+
+// optional string image = 16;
+inline bool Font::_internal_has_image() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Font::has_image() const {
+  return _internal_has_image();
+}
+inline void Font::clear_image() {
+  _impl_.image_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Font::image() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Font.image)
+  return _internal_image();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Font::set_image(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.image_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Font.image)
+}
+inline std::string* Font::mutable_image() {
+  std::string* _s = _internal_mutable_image();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Font.image)
+  return _s;
+}
+inline const std::string& Font::_internal_image() const {
+  return _impl_.image_.Get();
+}
+inline void Font::_internal_set_image(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.image_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Font::_internal_mutable_image() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.image_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Font::release_image() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Font.image)
+  if (!_internal_has_image()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.image_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_.IsDefault()) {
+    _impl_.image_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Font::set_allocated_image(std::string* image) {
+  if (image != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.image_.SetAllocated(image, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_.IsDefault()) {
+    _impl_.image_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Font.image)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fFont_2eproto
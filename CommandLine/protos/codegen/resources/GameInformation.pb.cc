@@ -0,0 +1,727 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/GameInformation.proto
+
+#include "resources/GameInformation.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR GameInformation::GameInformation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.form_caption_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.background_color_)*/0
+  , /*decltype(_impl_.left_)*/0
+  , /*decltype(_impl_.top_)*/0
+  , /*decltype(_impl_.right_)*/0
+  , /*decltype(_impl_.bottom_)*/0
+  , /*decltype(_impl_.embed_game_window_)*/false
+  , /*decltype(_impl_.show_border_)*/false
+  , /*decltype(_impl_.allow_resize_)*/false
+  , /*decltype(_impl_.stay_on_top_)*/false
+  , /*decltype(_impl_.pause_game_)*/false} {}
+struct GameInformationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameInformationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameInformationDefaultTypeInternal() {}
+  union {
+    GameInformation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameInformationDefaultTypeInternal _GameInformation_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fGameInformation_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resources_2fGameInformation_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fGameInformation_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fGameInformation_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.background_color_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.embed_game_window_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.form_caption_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.left_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.right_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.bottom_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.show_border_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.allow_resize_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.stay_on_top_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.pause_game_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::GameInformation, _impl_.text_),
+  2,
+  7,
+  0,
+  3,
+  4,
+  5,
+  6,
+  8,
+  9,
+  10,
+  11,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 18, -1, sizeof(::buffers::resources::GameInformation)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_GameInformation_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fGameInformation_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\037resources/GameInformation.proto\022\021buffe"
+  "rs.resources\032\roptions.proto\"\370\001\n\017GameInfo"
+  "rmation\022\030\n\020background_color\030\001 \001(\005\022\031\n\021emb"
+  "ed_game_window\030\002 \001(\010\022\024\n\014form_caption\030\003 \001"
+  "(\t\022\014\n\004left\030\004 \001(\005\022\013\n\003top\030\005 \001(\005\022\r\n\005right\030\006"
+  " \001(\005\022\016\n\006bottom\030\007 \001(\005\022\023\n\013show_border\030\010 \001("
+  "\010\022\024\n\014allow_resize\030\t \001(\010\022\023\n\013stay_on_top\030\n"
+  " \001(\010\022\022\n\npause_game\030\013 \001(\010\022\014\n\004text\030\014 \001(\t"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fGameInformation_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fGameInformation_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fGameInformation_2eproto = {
+    false, false, 318, descriptor_table_protodef_resources_2fGameInformation_2eproto,
+    "resources/GameInformation.proto",
+    &descriptor_table_resources_2fGameInformation_2eproto_once, descriptor_table_resources_2fGameInformation_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_resources_2fGameInformation_2eproto::offsets,
+    file_level_metadata_resources_2fGameInformation_2eproto, file_level_enum_descriptors_resources_2fGameInformation_2eproto,
+    file_level_service_descriptors_resources_2fGameInformation_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fGameInformation_2eproto_getter() {
+  return &descriptor_table_resources_2fGameInformation_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fGameInformation_2eproto(&descriptor_table_resources_2fGameInformation_2eproto);
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class GameInformation::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GameInformation>()._impl_._has_bits_);
+  static void set_has_background_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_embed_game_window(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_form_caption(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_left(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_top(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_right(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_bottom(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_show_border(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_allow_resize(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_stay_on_top(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_pause_game(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+GameInformation::GameInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.GameInformation)
+}
+GameInformation::GameInformation(const GameInformation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameInformation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.form_caption_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.background_color_){}
+    , decltype(_impl_.left_){}
+    , decltype(_impl_.top_){}
+    , decltype(_impl_.right_){}
+    , decltype(_impl_.bottom_){}
+    , decltype(_impl_.embed_game_window_){}
+    , decltype(_impl_.show_border_){}
+    , decltype(_impl_.allow_resize_){}
+    , decltype(_impl_.stay_on_top_){}
+    , decltype(_impl_.pause_game_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.form_caption_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.form_caption_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_form_caption()) {
+    _this->_impl_.form_caption_.Set(from._internal_form_caption(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.background_color_, &from._impl_.background_color_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pause_game_) -
+    reinterpret_cast<char*>(&_impl_.background_color_)) + sizeof(_impl_.pause_game_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.GameInformation)
+}
+
+inline void GameInformation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.form_caption_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.background_color_){0}
+    , decltype(_impl_.left_){0}
+    , decltype(_impl_.top_){0}
+    , decltype(_impl_.right_){0}
+    , decltype(_impl_.bottom_){0}
+    , decltype(_impl_.embed_game_window_){false}
+    , decltype(_impl_.show_border_){false}
+    , decltype(_impl_.allow_resize_){false}
+    , decltype(_impl_.stay_on_top_){false}
+    , decltype(_impl_.pause_game_){false}
+  };
+  _impl_.form_caption_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.form_caption_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GameInformation::~GameInformation() {
+  // @@protoc_insertion_point(destructor:buffers.resources.GameInformation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameInformation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.form_caption_.Destroy();
+  _impl_.text_.Destroy();
+}
+
+void GameInformation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameInformation::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.GameInformation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.form_caption_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.text_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.background_color_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.embed_game_window_) -
+        reinterpret_cast<char*>(&_impl_.background_color_)) + sizeof(_impl_.embed_game_window_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.show_border_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.pause_game_) -
+        reinterpret_cast<char*>(&_impl_.show_border_)) + sizeof(_impl_.pause_game_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameInformation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 background_color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_background_color(&has_bits);
+          _impl_.background_color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool embed_game_window = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_embed_game_window(&has_bits);
+          _impl_.embed_game_window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string form_caption = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_form_caption();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.GameInformation.form_caption");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 left = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_left(&has_bits);
+          _impl_.left_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 top = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_top(&has_bits);
+          _impl_.top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 right = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_right(&has_bits);
+          _impl_.right_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 bottom = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_bottom(&has_bits);
+          _impl_.bottom_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool show_border = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_show_border(&has_bits);
+          _impl_.show_border_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool allow_resize = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_allow_resize(&has_bits);
+          _impl_.allow_resize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool stay_on_top = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_stay_on_top(&has_bits);
+          _impl_.stay_on_top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool pause_game = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_pause_game(&has_bits);
+          _impl_.pause_game_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string text = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.GameInformation.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameInformation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.GameInformation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 background_color = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_background_color(), target);
+  }
+
+  // optional bool embed_game_window = 2;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_embed_game_window(), target);
+  }
+
+  // optional string form_caption = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_form_caption().data(), static_cast<int>(this->_internal_form_caption().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.GameInformation.form_caption");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_form_caption(), target);
+  }
+
+  // optional int32 left = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_left(), target);
+  }
+
+  // optional int32 top = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_top(), target);
+  }
+
+  // optional int32 right = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_right(), target);
+  }
+
+  // optional int32 bottom = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_bottom(), target);
+  }
+
+  // optional bool show_border = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_show_border(), target);
+  }
+
+  // optional bool allow_resize = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_allow_resize(), target);
+  }
+
+  // optional bool stay_on_top = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_stay_on_top(), target);
+  }
+
+  // optional bool pause_game = 11;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_pause_game(), target);
+  }
+
+  // optional string text = 12;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.GameInformation.text");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.GameInformation)
+  return target;
+}
+
+size_t GameInformation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.GameInformation)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string form_caption = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_form_caption());
+    }
+
+    // optional string text = 12;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_text());
+    }
+
+    // optional int32 background_color = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_background_color());
+    }
+
+    // optional int32 left = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_left());
+    }
+
+    // optional int32 top = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_top());
+    }
+
+    // optional int32 right = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_right());
+    }
+
+    // optional int32 bottom = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bottom());
+    }
+
+    // optional bool embed_game_window = 2;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional bool show_border = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool allow_resize = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool stay_on_top = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool pause_game = 11;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameInformation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameInformation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameInformation::GetClassData() const { return &_class_data_; }
+
+
+void GameInformation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameInformation*>(&to_msg);
+  auto& from = static_cast<const GameInformation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.GameInformation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_form_caption(from._internal_form_caption());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.background_color_ = from._impl_.background_color_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.left_ = from._impl_.left_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.top_ = from._impl_.top_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.right_ = from._impl_.right_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.bottom_ = from._impl_.bottom_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.embed_game_window_ = from._impl_.embed_game_window_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.show_border_ = from._impl_.show_border_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.allow_resize_ = from._impl_.allow_resize_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.stay_on_top_ = from._impl_.stay_on_top_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.pause_game_ = from._impl_.pause_game_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameInformation::CopyFrom(const GameInformation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.GameInformation)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameInformation::IsInitialized() const {
+  return true;
+}
+
+void GameInformation::InternalSwap(GameInformation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.form_caption_, lhs_arena,
+      &other->_impl_.form_caption_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameInformation, _impl_.pause_game_)
+      + sizeof(GameInformation::_impl_.pause_game_)
+      - PROTOBUF_FIELD_OFFSET(GameInformation, _impl_.background_color_)>(
+          reinterpret_cast<char*>(&_impl_.background_color_),
+          reinterpret_cast<char*>(&other->_impl_.background_color_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameInformation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fGameInformation_2eproto_getter, &descriptor_table_resources_2fGameInformation_2eproto_once,
+      file_level_metadata_resources_2fGameInformation_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::GameInformation*
+Arena::CreateMaybeMessage< ::buffers::resources::GameInformation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::GameInformation >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
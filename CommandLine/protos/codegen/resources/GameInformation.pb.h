@@ -0,0 +1,835 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/GameInformation.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fGameInformation_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fGameInformation_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fGameInformation_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fGameInformation_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fGameInformation_2eproto;
+namespace buffers {
+namespace resources {
+class GameInformation;
+struct GameInformationDefaultTypeInternal;
+extern GameInformationDefaultTypeInternal _GameInformation_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::GameInformation* Arena::CreateMaybeMessage<::buffers::resources::GameInformation>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class GameInformation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.GameInformation) */ {
+ public:
+  inline GameInformation() : GameInformation(nullptr) {}
+  ~GameInformation() override;
+  explicit PROTOBUF_CONSTEXPR GameInformation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameInformation(const GameInformation& from);
+  GameInformation(GameInformation&& from) noexcept
+    : GameInformation() {
+    *this = ::std::move(from);
+  }
+
+  inline GameInformation& operator=(const GameInformation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameInformation& operator=(GameInformation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameInformation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameInformation* internal_default_instance() {
+    return reinterpret_cast<const GameInformation*>(
+               &_GameInformation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(GameInformation& a, GameInformation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameInformation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameInformation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameInformation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameInformation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameInformation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameInformation& from) {
+    GameInformation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameInformation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.GameInformation";
+  }
+  protected:
+  explicit GameInformation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFormCaptionFieldNumber = 3,
+    kTextFieldNumber = 12,
+    kBackgroundColorFieldNumber = 1,
+    kLeftFieldNumber = 4,
+    kTopFieldNumber = 5,
+    kRightFieldNumber = 6,
+    kBottomFieldNumber = 7,
+    kEmbedGameWindowFieldNumber = 2,
+    kShowBorderFieldNumber = 8,
+    kAllowResizeFieldNumber = 9,
+    kStayOnTopFieldNumber = 10,
+    kPauseGameFieldNumber = 11,
+  };
+  // optional string form_caption = 3;
+  bool has_form_caption() const;
+  private:
+  bool _internal_has_form_caption() const;
+  public:
+  void clear_form_caption();
+  const std::string& form_caption() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_form_caption(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_form_caption();
+  PROTOBUF_NODISCARD std::string* release_form_caption();
+  void set_allocated_form_caption(std::string* form_caption);
+  private:
+  const std::string& _internal_form_caption() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_form_caption(const std::string& value);
+  std::string* _internal_mutable_form_caption();
+  public:
+
+  // optional string text = 12;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // optional int32 background_color = 1;
+  bool has_background_color() const;
+  private:
+  bool _internal_has_background_color() const;
+  public:
+  void clear_background_color();
+  int32_t background_color() const;
+  void set_background_color(int32_t value);
+  private:
+  int32_t _internal_background_color() const;
+  void _internal_set_background_color(int32_t value);
+  public:
+
+  // optional int32 left = 4;
+  bool has_left() const;
+  private:
+  bool _internal_has_left() const;
+  public:
+  void clear_left();
+  int32_t left() const;
+  void set_left(int32_t value);
+  private:
+  int32_t _internal_left() const;
+  void _internal_set_left(int32_t value);
+  public:
+
+  // optional int32 top = 5;
+  bool has_top() const;
+  private:
+  bool _internal_has_top() const;
+  public:
+  void clear_top();
+  int32_t top() const;
+  void set_top(int32_t value);
+  private:
+  int32_t _internal_top() const;
+  void _internal_set_top(int32_t value);
+  public:
+
+  // optional int32 right = 6;
+  bool has_right() const;
+  private:
+  bool _internal_has_right() const;
+  public:
+  void clear_right();
+  int32_t right() const;
+  void set_right(int32_t value);
+  private:
+  int32_t _internal_right() const;
+  void _internal_set_right(int32_t value);
+  public:
+
+  // optional int32 bottom = 7;
+  bool has_bottom() const;
+  private:
+  bool _internal_has_bottom() const;
+  public:
+  void clear_bottom();
+  int32_t bottom() const;
+  void set_bottom(int32_t value);
+  private:
+  int32_t _internal_bottom() const;
+  void _internal_set_bottom(int32_t value);
+  public:
+
+  // optional bool embed_game_window = 2;
+  bool has_embed_game_window() const;
+  private:
+  bool _internal_has_embed_game_window() const;
+  public:
+  void clear_embed_game_window();
+  bool embed_game_window() const;
+  void set_embed_game_window(bool value);
+  private:
+  bool _internal_embed_game_window() const;
+  void _internal_set_embed_game_window(bool value);
+  public:
+
+  // optional bool show_border = 8;
+  bool has_show_border() const;
+  private:
+  bool _internal_has_show_border() const;
+  public:
+  void clear_show_border();
+  bool show_border() const;
+  void set_show_border(bool value);
+  private:
+  bool _internal_show_border() const;
+  void _internal_set_show_border(bool value);
+  public:
+
+  // optional bool allow_resize = 9;
+  bool has_allow_resize() const;
+  private:
+  bool _internal_has_allow_resize() const;
+  public:
+  void clear_allow_resize();
+  bool allow_resize() const;
+  void set_allow_resize(bool value);
+  private:
+  bool _internal_allow_resize() const;
+  void _internal_set_allow_resize(bool value);
+  public:
+
+  // optional bool stay_on_top = 10;
+  bool has_stay_on_top() const;
+  private:
+  bool _internal_has_stay_on_top() const;
+  public:
+  void clear_stay_on_top();
+  bool stay_on_top() const;
+  void set_stay_on_top(bool value);
+  private:
+  bool _internal_stay_on_top() const;
+  void _internal_set_stay_on_top(bool value);
+  public:
+
+  // optional bool pause_game = 11;
+  bool has_pause_game() const;
+  private:
+  bool _internal_has_pause_game() const;
+  public:
+  void clear_pause_game();
+  bool pause_game() const;
+  void set_pause_game(bool value);
+  private:
+  bool _internal_pause_game() const;
+  void _internal_set_pause_game(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.GameInformation)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr form_caption_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t background_color_;
+    int32_t left_;
+    int32_t top_;
+    int32_t right_;
+    int32_t bottom_;
+    bool embed_game_window_;
+    bool show_border_;
+    bool allow_resize_;
+    bool stay_on_top_;
+    bool pause_game_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fGameInformation_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GameInformation
+
+// optional int32 background_color = 1;
+inline bool GameInformation::_internal_has_background_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GameInformation::has_background_color() const {
+  return _internal_has_background_color();
+}
+inline void GameInformation::clear_background_color() {
+  _impl_.background_color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t GameInformation::_internal_background_color() const {
+  return _impl_.background_color_;
+}
+inline int32_t GameInformation::background_color() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.background_color)
+  return _internal_background_color();
+}
+inline void GameInformation::_internal_set_background_color(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.background_color_ = value;
+}
+inline void GameInformation::set_background_color(int32_t value) {
+  _internal_set_background_color(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.background_color)
+}
+
+// optional bool embed_game_window = 2;
+inline bool GameInformation::_internal_has_embed_game_window() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool GameInformation::has_embed_game_window() const {
+  return _internal_has_embed_game_window();
+}
+inline void GameInformation::clear_embed_game_window() {
+  _impl_.embed_game_window_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool GameInformation::_internal_embed_game_window() const {
+  return _impl_.embed_game_window_;
+}
+inline bool GameInformation::embed_game_window() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.embed_game_window)
+  return _internal_embed_game_window();
+}
+inline void GameInformation::_internal_set_embed_game_window(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.embed_game_window_ = value;
+}
+inline void GameInformation::set_embed_game_window(bool value) {
+  _internal_set_embed_game_window(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.embed_game_window)
+}
+
+// optional string form_caption = 3;
+inline bool GameInformation::_internal_has_form_caption() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GameInformation::has_form_caption() const {
+  return _internal_has_form_caption();
+}
+inline void GameInformation::clear_form_caption() {
+  _impl_.form_caption_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GameInformation::form_caption() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.form_caption)
+  return _internal_form_caption();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInformation::set_form_caption(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.form_caption_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.form_caption)
+}
+inline std::string* GameInformation::mutable_form_caption() {
+  std::string* _s = _internal_mutable_form_caption();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.GameInformation.form_caption)
+  return _s;
+}
+inline const std::string& GameInformation::_internal_form_caption() const {
+  return _impl_.form_caption_.Get();
+}
+inline void GameInformation::_internal_set_form_caption(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.form_caption_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameInformation::_internal_mutable_form_caption() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.form_caption_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameInformation::release_form_caption() {
+  // @@protoc_insertion_point(field_release:buffers.resources.GameInformation.form_caption)
+  if (!_internal_has_form_caption()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.form_caption_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.form_caption_.IsDefault()) {
+    _impl_.form_caption_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GameInformation::set_allocated_form_caption(std::string* form_caption) {
+  if (form_caption != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.form_caption_.SetAllocated(form_caption, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.form_caption_.IsDefault()) {
+    _impl_.form_caption_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.GameInformation.form_caption)
+}
+
+// optional int32 left = 4;
+inline bool GameInformation::_internal_has_left() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GameInformation::has_left() const {
+  return _internal_has_left();
+}
+inline void GameInformation::clear_left() {
+  _impl_.left_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t GameInformation::_internal_left() const {
+  return _impl_.left_;
+}
+inline int32_t GameInformation::left() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.left)
+  return _internal_left();
+}
+inline void GameInformation::_internal_set_left(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.left_ = value;
+}
+inline void GameInformation::set_left(int32_t value) {
+  _internal_set_left(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.left)
+}
+
+// optional int32 top = 5;
+inline bool GameInformation::_internal_has_top() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GameInformation::has_top() const {
+  return _internal_has_top();
+}
+inline void GameInformation::clear_top() {
+  _impl_.top_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t GameInformation::_internal_top() const {
+  return _impl_.top_;
+}
+inline int32_t GameInformation::top() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.top)
+  return _internal_top();
+}
+inline void GameInformation::_internal_set_top(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.top_ = value;
+}
+inline void GameInformation::set_top(int32_t value) {
+  _internal_set_top(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.top)
+}
+
+// optional int32 right = 6;
+inline bool GameInformation::_internal_has_right() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool GameInformation::has_right() const {
+  return _internal_has_right();
+}
+inline void GameInformation::clear_right() {
+  _impl_.right_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t GameInformation::_internal_right() const {
+  return _impl_.right_;
+}
+inline int32_t GameInformation::right() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.right)
+  return _internal_right();
+}
+inline void GameInformation::_internal_set_right(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.right_ = value;
+}
+inline void GameInformation::set_right(int32_t value) {
+  _internal_set_right(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.right)
+}
+
+// optional int32 bottom = 7;
+inline bool GameInformation::_internal_has_bottom() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool GameInformation::has_bottom() const {
+  return _internal_has_bottom();
+}
+inline void GameInformation::clear_bottom() {
+  _impl_.bottom_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t GameInformation::_internal_bottom() const {
+  return _impl_.bottom_;
+}
+inline int32_t GameInformation::bottom() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.bottom)
+  return _internal_bottom();
+}
+inline void GameInformation::_internal_set_bottom(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.bottom_ = value;
+}
+inline void GameInformation::set_bottom(int32_t value) {
+  _internal_set_bottom(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.bottom)
+}
+
+// optional bool show_border = 8;
+inline bool GameInformation::_internal_has_show_border() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool GameInformation::has_show_border() const {
+  return _internal_has_show_border();
+}
+inline void GameInformation::clear_show_border() {
+  _impl_.show_border_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool GameInformation::_internal_show_border() const {
+  return _impl_.show_border_;
+}
+inline bool GameInformation::show_border() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.show_border)
+  return _internal_show_border();
+}
+inline void GameInformation::_internal_set_show_border(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.show_border_ = value;
+}
+inline void GameInformation::set_show_border(bool value) {
+  _internal_set_show_border(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.show_border)
+}
+
+// optional bool allow_resize = 9;
+inline bool GameInformation::_internal_has_allow_resize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool GameInformation::has_allow_resize() const {
+  return _internal_has_allow_resize();
+}
+inline void GameInformation::clear_allow_resize() {
+  _impl_.allow_resize_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool GameInformation::_internal_allow_resize() const {
+  return _impl_.allow_resize_;
+}
+inline bool GameInformation::allow_resize() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.allow_resize)
+  return _internal_allow_resize();
+}
+inline void GameInformation::_internal_set_allow_resize(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.allow_resize_ = value;
+}
+inline void GameInformation::set_allow_resize(bool value) {
+  _internal_set_allow_resize(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.allow_resize)
+}
+
+// optional bool stay_on_top = 10;
+inline bool GameInformation::_internal_has_stay_on_top() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool GameInformation::has_stay_on_top() const {
+  return _internal_has_stay_on_top();
+}
+inline void GameInformation::clear_stay_on_top() {
+  _impl_.stay_on_top_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool GameInformation::_internal_stay_on_top() const {
+  return _impl_.stay_on_top_;
+}
+inline bool GameInformation::stay_on_top() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.stay_on_top)
+  return _internal_stay_on_top();
+}
+inline void GameInformation::_internal_set_stay_on_top(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.stay_on_top_ = value;
+}
+inline void GameInformation::set_stay_on_top(bool value) {
+  _internal_set_stay_on_top(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.stay_on_top)
+}
+
+// optional bool pause_game = 11;
+inline bool GameInformation::_internal_has_pause_game() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool GameInformation::has_pause_game() const {
+  return _internal_has_pause_game();
+}
+inline void GameInformation::clear_pause_game() {
+  _impl_.pause_game_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool GameInformation::_internal_pause_game() const {
+  return _impl_.pause_game_;
+}
+inline bool GameInformation::pause_game() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.pause_game)
+  return _internal_pause_game();
+}
+inline void GameInformation::_internal_set_pause_game(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.pause_game_ = value;
+}
+inline void GameInformation::set_pause_game(bool value) {
+  _internal_set_pause_game(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.pause_game)
+}
+
+// optional string text = 12;
+inline bool GameInformation::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GameInformation::has_text() const {
+  return _internal_has_text();
+}
+inline void GameInformation::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GameInformation::text() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.GameInformation.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInformation::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.GameInformation.text)
+}
+inline std::string* GameInformation::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.GameInformation.text)
+  return _s;
+}
+inline const std::string& GameInformation::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void GameInformation::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameInformation::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameInformation::release_text() {
+  // @@protoc_insertion_point(field_release:buffers.resources.GameInformation.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GameInformation::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.GameInformation.text)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fGameInformation_2eproto
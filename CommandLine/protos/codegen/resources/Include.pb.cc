@@ -0,0 +1,703 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Include.proto
+
+#include "resources/Include.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Include::Include(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.export_directory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_.export_action_)*/0
+  , /*decltype(_impl_.exists_)*/false
+  , /*decltype(_impl_.overwrite_existing_)*/false
+  , /*decltype(_impl_.free_after_export_)*/false
+  , /*decltype(_impl_.remove_at_game_end_)*/false
+  , /*decltype(_impl_.store_)*/false} {}
+struct IncludeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncludeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncludeDefaultTypeInternal() {}
+  union {
+    Include _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncludeDefaultTypeInternal _Include_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fInclude_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_resources_2fInclude_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fInclude_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fInclude_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.exists_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.export_action_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.export_directory_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.overwrite_existing_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.free_after_export_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.remove_at_game_end_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.store_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Include, _impl_.file_name_),
+  2,
+  5,
+  3,
+  4,
+  0,
+  6,
+  7,
+  8,
+  9,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 16, -1, sizeof(::buffers::resources::Include)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Include_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fInclude_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027resources/Include.proto\022\021buffers.resou"
+  "rces\032\roptions.proto\"\373\003\n\007Include\022\036\n\002id\030\002 "
+  "\001(\005B\022\222\265\030\016GMX_DEPRECATED\022\016\n\006exists\030\004 \001(\010\022"
+  "\014\n\004size\030\005 \001(\005\022P\n\rexport_action\030\006 \001(\0162\'.b"
+  "uffers.resources.Include.ExportActionB\020\222"
+  "\265\030\014exportAction\022\'\n\020export_directory\030\007 \001("
+  "\tB\r\222\265\030\texportDir\022)\n\022overwrite_existing\030\010"
+  " \001(\010B\r\222\265\030\toverwrite\022\'\n\021free_after_export"
+  "\030\t \001(\010B\014\222\265\030\010freeData\022)\n\022remove_at_game_e"
+  "nd\030\n \001(\010B\r\222\265\030\tremoveEnd\022\r\n\005store\030\013 \001(\010\022#"
+  "\n\tfile_name\030\014 \001(\tB\020\222\265\030\010filename\210\265\030\001\"\203\001\n\014"
+  "ExportAction\022\017\n\013DONT_EXPORT\020\000\022!\n\035EXPORT_"
+  "TO_TEMPORARY_DIRECTORY\020\001\022\037\n\033EXPORT_TO_WO"
+  "RKING_DIRECTORY\020\002\022\036\n\032EXPORT_TO_CUSTOM_DI"
+  "RECTORY\020\003"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fInclude_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fInclude_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fInclude_2eproto = {
+    false, false, 569, descriptor_table_protodef_resources_2fInclude_2eproto,
+    "resources/Include.proto",
+    &descriptor_table_resources_2fInclude_2eproto_once, descriptor_table_resources_2fInclude_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_resources_2fInclude_2eproto::offsets,
+    file_level_metadata_resources_2fInclude_2eproto, file_level_enum_descriptors_resources_2fInclude_2eproto,
+    file_level_service_descriptors_resources_2fInclude_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fInclude_2eproto_getter() {
+  return &descriptor_table_resources_2fInclude_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fInclude_2eproto(&descriptor_table_resources_2fInclude_2eproto);
+namespace buffers {
+namespace resources {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Include_ExportAction_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fInclude_2eproto);
+  return file_level_enum_descriptors_resources_2fInclude_2eproto[0];
+}
+bool Include_ExportAction_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Include_ExportAction Include::DONT_EXPORT;
+constexpr Include_ExportAction Include::EXPORT_TO_TEMPORARY_DIRECTORY;
+constexpr Include_ExportAction Include::EXPORT_TO_WORKING_DIRECTORY;
+constexpr Include_ExportAction Include::EXPORT_TO_CUSTOM_DIRECTORY;
+constexpr Include_ExportAction Include::ExportAction_MIN;
+constexpr Include_ExportAction Include::ExportAction_MAX;
+constexpr int Include::ExportAction_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Include::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Include>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_exists(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_export_action(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_export_directory(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_overwrite_existing(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_free_after_export(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_remove_at_game_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_store(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_file_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Include::Include(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Include)
+}
+Include::Include(const Include& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Include* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.export_directory_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.export_action_){}
+    , decltype(_impl_.exists_){}
+    , decltype(_impl_.overwrite_existing_){}
+    , decltype(_impl_.free_after_export_){}
+    , decltype(_impl_.remove_at_game_end_){}
+    , decltype(_impl_.store_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.export_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.export_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_export_directory()) {
+    _this->_impl_.export_directory_.Set(from._internal_export_directory(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_name()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.store_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.store_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Include)
+}
+
+inline void Include::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.export_directory_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.size_){0}
+    , decltype(_impl_.export_action_){0}
+    , decltype(_impl_.exists_){false}
+    , decltype(_impl_.overwrite_existing_){false}
+    , decltype(_impl_.free_after_export_){false}
+    , decltype(_impl_.remove_at_game_end_){false}
+    , decltype(_impl_.store_){false}
+  };
+  _impl_.export_directory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.export_directory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Include::~Include() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Include)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Include::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.export_directory_.Destroy();
+  _impl_.file_name_.Destroy();
+}
+
+void Include::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Include::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Include)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.export_directory_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.file_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.free_after_export_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.free_after_export_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.remove_at_game_end_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.store_) -
+        reinterpret_cast<char*>(&_impl_.remove_at_game_end_)) + sizeof(_impl_.store_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Include::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool exists = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_exists(&has_bits);
+          _impl_.exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Include.ExportAction export_action = 6 [(.buffers.gmx) = "exportAction"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Include_ExportAction_IsValid(val))) {
+            _internal_set_export_action(static_cast<::buffers::resources::Include_ExportAction>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string export_directory = 7 [(.buffers.gmx) = "exportDir"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_export_directory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Include.export_directory");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool overwrite_existing = 8 [(.buffers.gmx) = "overwrite"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_overwrite_existing(&has_bits);
+          _impl_.overwrite_existing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool free_after_export = 9 [(.buffers.gmx) = "freeData"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_free_after_export(&has_bits);
+          _impl_.free_after_export_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool remove_at_game_end = 10 [(.buffers.gmx) = "removeEnd"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_remove_at_game_end(&has_bits);
+          _impl_.remove_at_game_end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool store = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_store(&has_bits);
+          _impl_.store_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file_name = 12 [(.buffers.file_path) = true, (.buffers.gmx) = "filename"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Include.file_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Include::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Include)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional bool exists = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_exists(), target);
+  }
+
+  // optional int32 size = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_size(), target);
+  }
+
+  // optional .buffers.resources.Include.ExportAction export_action = 6 [(.buffers.gmx) = "exportAction"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_export_action(), target);
+  }
+
+  // optional string export_directory = 7 [(.buffers.gmx) = "exportDir"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_export_directory().data(), static_cast<int>(this->_internal_export_directory().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Include.export_directory");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_export_directory(), target);
+  }
+
+  // optional bool overwrite_existing = 8 [(.buffers.gmx) = "overwrite"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_overwrite_existing(), target);
+  }
+
+  // optional bool free_after_export = 9 [(.buffers.gmx) = "freeData"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_free_after_export(), target);
+  }
+
+  // optional bool remove_at_game_end = 10 [(.buffers.gmx) = "removeEnd"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_remove_at_game_end(), target);
+  }
+
+  // optional bool store = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_store(), target);
+  }
+
+  // optional string file_name = 12 [(.buffers.file_path) = true, (.buffers.gmx) = "filename"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Include.file_name");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_file_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Include)
+  return target;
+}
+
+size_t Include::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Include)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string export_directory = 7 [(.buffers.gmx) = "exportDir"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_export_directory());
+    }
+
+    // optional string file_name = 12 [(.buffers.file_path) = true, (.buffers.gmx) = "filename"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_file_name());
+    }
+
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 size = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_size());
+    }
+
+    // optional .buffers.resources.Include.ExportAction export_action = 6 [(.buffers.gmx) = "exportAction"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_export_action());
+    }
+
+    // optional bool exists = 4;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool overwrite_existing = 8 [(.buffers.gmx) = "overwrite"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool free_after_export = 9 [(.buffers.gmx) = "freeData"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional bool remove_at_game_end = 10 [(.buffers.gmx) = "removeEnd"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool store = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Include::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Include::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Include::GetClassData() const { return &_class_data_; }
+
+
+void Include::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Include*>(&to_msg);
+  auto& from = static_cast<const Include&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Include)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_export_directory(from._internal_export_directory());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_file_name(from._internal_file_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.export_action_ = from._impl_.export_action_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.exists_ = from._impl_.exists_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.overwrite_existing_ = from._impl_.overwrite_existing_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.free_after_export_ = from._impl_.free_after_export_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.remove_at_game_end_ = from._impl_.remove_at_game_end_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.store_ = from._impl_.store_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Include::CopyFrom(const Include& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Include)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Include::IsInitialized() const {
+  return true;
+}
+
+void Include::InternalSwap(Include* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.export_directory_, lhs_arena,
+      &other->_impl_.export_directory_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Include, _impl_.store_)
+      + sizeof(Include::_impl_.store_)
+      - PROTOBUF_FIELD_OFFSET(Include, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Include::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fInclude_2eproto_getter, &descriptor_table_resources_2fInclude_2eproto_once,
+      file_level_metadata_resources_2fInclude_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Include*
+Arena::CreateMaybeMessage< ::buffers::resources::Include >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Include >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
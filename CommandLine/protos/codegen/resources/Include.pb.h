@@ -0,0 +1,820 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Include.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fInclude_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fInclude_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fInclude_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fInclude_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fInclude_2eproto;
+namespace buffers {
+namespace resources {
+class Include;
+struct IncludeDefaultTypeInternal;
+extern IncludeDefaultTypeInternal _Include_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Include* Arena::CreateMaybeMessage<::buffers::resources::Include>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+enum Include_ExportAction : int {
+  Include_ExportAction_DONT_EXPORT = 0,
+  Include_ExportAction_EXPORT_TO_TEMPORARY_DIRECTORY = 1,
+  Include_ExportAction_EXPORT_TO_WORKING_DIRECTORY = 2,
+  Include_ExportAction_EXPORT_TO_CUSTOM_DIRECTORY = 3
+};
+bool Include_ExportAction_IsValid(int value);
+constexpr Include_ExportAction Include_ExportAction_ExportAction_MIN = Include_ExportAction_DONT_EXPORT;
+constexpr Include_ExportAction Include_ExportAction_ExportAction_MAX = Include_ExportAction_EXPORT_TO_CUSTOM_DIRECTORY;
+constexpr int Include_ExportAction_ExportAction_ARRAYSIZE = Include_ExportAction_ExportAction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Include_ExportAction_descriptor();
+template<typename T>
+inline const std::string& Include_ExportAction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Include_ExportAction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Include_ExportAction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Include_ExportAction_descriptor(), enum_t_value);
+}
+inline bool Include_ExportAction_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Include_ExportAction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Include_ExportAction>(
+    Include_ExportAction_descriptor(), name, value);
+}
+// ===================================================================
+
+class Include final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Include) */ {
+ public:
+  inline Include() : Include(nullptr) {}
+  ~Include() override;
+  explicit PROTOBUF_CONSTEXPR Include(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Include(const Include& from);
+  Include(Include&& from) noexcept
+    : Include() {
+    *this = ::std::move(from);
+  }
+
+  inline Include& operator=(const Include& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Include& operator=(Include&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Include& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Include* internal_default_instance() {
+    return reinterpret_cast<const Include*>(
+               &_Include_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Include& a, Include& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Include* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Include* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Include* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Include>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Include& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Include& from) {
+    Include::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Include* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Include";
+  }
+  protected:
+  explicit Include(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Include_ExportAction ExportAction;
+  static constexpr ExportAction DONT_EXPORT =
+    Include_ExportAction_DONT_EXPORT;
+  static constexpr ExportAction EXPORT_TO_TEMPORARY_DIRECTORY =
+    Include_ExportAction_EXPORT_TO_TEMPORARY_DIRECTORY;
+  static constexpr ExportAction EXPORT_TO_WORKING_DIRECTORY =
+    Include_ExportAction_EXPORT_TO_WORKING_DIRECTORY;
+  static constexpr ExportAction EXPORT_TO_CUSTOM_DIRECTORY =
+    Include_ExportAction_EXPORT_TO_CUSTOM_DIRECTORY;
+  static inline bool ExportAction_IsValid(int value) {
+    return Include_ExportAction_IsValid(value);
+  }
+  static constexpr ExportAction ExportAction_MIN =
+    Include_ExportAction_ExportAction_MIN;
+  static constexpr ExportAction ExportAction_MAX =
+    Include_ExportAction_ExportAction_MAX;
+  static constexpr int ExportAction_ARRAYSIZE =
+    Include_ExportAction_ExportAction_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ExportAction_descriptor() {
+    return Include_ExportAction_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ExportAction_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ExportAction>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ExportAction_Name.");
+    return Include_ExportAction_Name(enum_t_value);
+  }
+  static inline bool ExportAction_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ExportAction* value) {
+    return Include_ExportAction_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExportDirectoryFieldNumber = 7,
+    kFileNameFieldNumber = 12,
+    kIdFieldNumber = 2,
+    kSizeFieldNumber = 5,
+    kExportActionFieldNumber = 6,
+    kExistsFieldNumber = 4,
+    kOverwriteExistingFieldNumber = 8,
+    kFreeAfterExportFieldNumber = 9,
+    kRemoveAtGameEndFieldNumber = 10,
+    kStoreFieldNumber = 11,
+  };
+  // optional string export_directory = 7 [(.buffers.gmx) = "exportDir"];
+  bool has_export_directory() const;
+  private:
+  bool _internal_has_export_directory() const;
+  public:
+  void clear_export_directory();
+  const std::string& export_directory() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_export_directory(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_export_directory();
+  PROTOBUF_NODISCARD std::string* release_export_directory();
+  void set_allocated_export_directory(std::string* export_directory);
+  private:
+  const std::string& _internal_export_directory() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_export_directory(const std::string& value);
+  std::string* _internal_mutable_export_directory();
+  public:
+
+  // optional string file_name = 12 [(.buffers.file_path) = true, (.buffers.gmx) = "filename"];
+  bool has_file_name() const;
+  private:
+  bool _internal_has_file_name() const;
+  public:
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 size = 5;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
+
+  // optional .buffers.resources.Include.ExportAction export_action = 6 [(.buffers.gmx) = "exportAction"];
+  bool has_export_action() const;
+  private:
+  bool _internal_has_export_action() const;
+  public:
+  void clear_export_action();
+  ::buffers::resources::Include_ExportAction export_action() const;
+  void set_export_action(::buffers::resources::Include_ExportAction value);
+  private:
+  ::buffers::resources::Include_ExportAction _internal_export_action() const;
+  void _internal_set_export_action(::buffers::resources::Include_ExportAction value);
+  public:
+
+  // optional bool exists = 4;
+  bool has_exists() const;
+  private:
+  bool _internal_has_exists() const;
+  public:
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // optional bool overwrite_existing = 8 [(.buffers.gmx) = "overwrite"];
+  bool has_overwrite_existing() const;
+  private:
+  bool _internal_has_overwrite_existing() const;
+  public:
+  void clear_overwrite_existing();
+  bool overwrite_existing() const;
+  void set_overwrite_existing(bool value);
+  private:
+  bool _internal_overwrite_existing() const;
+  void _internal_set_overwrite_existing(bool value);
+  public:
+
+  // optional bool free_after_export = 9 [(.buffers.gmx) = "freeData"];
+  bool has_free_after_export() const;
+  private:
+  bool _internal_has_free_after_export() const;
+  public:
+  void clear_free_after_export();
+  bool free_after_export() const;
+  void set_free_after_export(bool value);
+  private:
+  bool _internal_free_after_export() const;
+  void _internal_set_free_after_export(bool value);
+  public:
+
+  // optional bool remove_at_game_end = 10 [(.buffers.gmx) = "removeEnd"];
+  bool has_remove_at_game_end() const;
+  private:
+  bool _internal_has_remove_at_game_end() const;
+  public:
+  void clear_remove_at_game_end();
+  bool remove_at_game_end() const;
+  void set_remove_at_game_end(bool value);
+  private:
+  bool _internal_remove_at_game_end() const;
+  void _internal_set_remove_at_game_end(bool value);
+  public:
+
+  // optional bool store = 11;
+  bool has_store() const;
+  private:
+  bool _internal_has_store() const;
+  public:
+  void clear_store();
+  bool store() const;
+  void set_store(bool value);
+  private:
+  bool _internal_store() const;
+  void _internal_set_store(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Include)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr export_directory_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    int32_t id_;
+    int32_t size_;
+    int export_action_;
+    bool exists_;
+    bool overwrite_existing_;
+    bool free_after_export_;
+    bool remove_at_game_end_;
+    bool store_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fInclude_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Include
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Include::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Include::has_id() const {
+  return _internal_has_id();
+}
+inline void Include::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Include::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Include::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.id)
+  return _internal_id();
+}
+inline void Include::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void Include::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.id)
+}
+
+// optional bool exists = 4;
+inline bool Include::_internal_has_exists() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Include::has_exists() const {
+  return _internal_has_exists();
+}
+inline void Include::clear_exists() {
+  _impl_.exists_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Include::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool Include::exists() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.exists)
+  return _internal_exists();
+}
+inline void Include::_internal_set_exists(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.exists_ = value;
+}
+inline void Include::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.exists)
+}
+
+// optional int32 size = 5;
+inline bool Include::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Include::has_size() const {
+  return _internal_has_size();
+}
+inline void Include::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Include::_internal_size() const {
+  return _impl_.size_;
+}
+inline int32_t Include::size() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.size)
+  return _internal_size();
+}
+inline void Include::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.size_ = value;
+}
+inline void Include::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.size)
+}
+
+// optional .buffers.resources.Include.ExportAction export_action = 6 [(.buffers.gmx) = "exportAction"];
+inline bool Include::_internal_has_export_action() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Include::has_export_action() const {
+  return _internal_has_export_action();
+}
+inline void Include::clear_export_action() {
+  _impl_.export_action_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::buffers::resources::Include_ExportAction Include::_internal_export_action() const {
+  return static_cast< ::buffers::resources::Include_ExportAction >(_impl_.export_action_);
+}
+inline ::buffers::resources::Include_ExportAction Include::export_action() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.export_action)
+  return _internal_export_action();
+}
+inline void Include::_internal_set_export_action(::buffers::resources::Include_ExportAction value) {
+  assert(::buffers::resources::Include_ExportAction_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.export_action_ = value;
+}
+inline void Include::set_export_action(::buffers::resources::Include_ExportAction value) {
+  _internal_set_export_action(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.export_action)
+}
+
+// optional string export_directory = 7 [(.buffers.gmx) = "exportDir"];
+inline bool Include::_internal_has_export_directory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Include::has_export_directory() const {
+  return _internal_has_export_directory();
+}
+inline void Include::clear_export_directory() {
+  _impl_.export_directory_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Include::export_directory() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.export_directory)
+  return _internal_export_directory();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Include::set_export_directory(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.export_directory_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.export_directory)
+}
+inline std::string* Include::mutable_export_directory() {
+  std::string* _s = _internal_mutable_export_directory();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Include.export_directory)
+  return _s;
+}
+inline const std::string& Include::_internal_export_directory() const {
+  return _impl_.export_directory_.Get();
+}
+inline void Include::_internal_set_export_directory(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.export_directory_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Include::_internal_mutable_export_directory() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.export_directory_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Include::release_export_directory() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Include.export_directory)
+  if (!_internal_has_export_directory()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.export_directory_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.export_directory_.IsDefault()) {
+    _impl_.export_directory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Include::set_allocated_export_directory(std::string* export_directory) {
+  if (export_directory != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.export_directory_.SetAllocated(export_directory, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.export_directory_.IsDefault()) {
+    _impl_.export_directory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Include.export_directory)
+}
+
+// optional bool overwrite_existing = 8 [(.buffers.gmx) = "overwrite"];
+inline bool Include::_internal_has_overwrite_existing() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Include::has_overwrite_existing() const {
+  return _internal_has_overwrite_existing();
+}
+inline void Include::clear_overwrite_existing() {
+  _impl_.overwrite_existing_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Include::_internal_overwrite_existing() const {
+  return _impl_.overwrite_existing_;
+}
+inline bool Include::overwrite_existing() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.overwrite_existing)
+  return _internal_overwrite_existing();
+}
+inline void Include::_internal_set_overwrite_existing(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.overwrite_existing_ = value;
+}
+inline void Include::set_overwrite_existing(bool value) {
+  _internal_set_overwrite_existing(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.overwrite_existing)
+}
+
+// optional bool free_after_export = 9 [(.buffers.gmx) = "freeData"];
+inline bool Include::_internal_has_free_after_export() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Include::has_free_after_export() const {
+  return _internal_has_free_after_export();
+}
+inline void Include::clear_free_after_export() {
+  _impl_.free_after_export_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Include::_internal_free_after_export() const {
+  return _impl_.free_after_export_;
+}
+inline bool Include::free_after_export() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.free_after_export)
+  return _internal_free_after_export();
+}
+inline void Include::_internal_set_free_after_export(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.free_after_export_ = value;
+}
+inline void Include::set_free_after_export(bool value) {
+  _internal_set_free_after_export(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.free_after_export)
+}
+
+// optional bool remove_at_game_end = 10 [(.buffers.gmx) = "removeEnd"];
+inline bool Include::_internal_has_remove_at_game_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Include::has_remove_at_game_end() const {
+  return _internal_has_remove_at_game_end();
+}
+inline void Include::clear_remove_at_game_end() {
+  _impl_.remove_at_game_end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Include::_internal_remove_at_game_end() const {
+  return _impl_.remove_at_game_end_;
+}
+inline bool Include::remove_at_game_end() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.remove_at_game_end)
+  return _internal_remove_at_game_end();
+}
+inline void Include::_internal_set_remove_at_game_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.remove_at_game_end_ = value;
+}
+inline void Include::set_remove_at_game_end(bool value) {
+  _internal_set_remove_at_game_end(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.remove_at_game_end)
+}
+
+// optional bool store = 11;
+inline bool Include::_internal_has_store() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Include::has_store() const {
+  return _internal_has_store();
+}
+inline void Include::clear_store() {
+  _impl_.store_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool Include::_internal_store() const {
+  return _impl_.store_;
+}
+inline bool Include::store() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.store)
+  return _internal_store();
+}
+inline void Include::_internal_set_store(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.store_ = value;
+}
+inline void Include::set_store(bool value) {
+  _internal_set_store(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.store)
+}
+
+// optional string file_name = 12 [(.buffers.file_path) = true, (.buffers.gmx) = "filename"];
+inline bool Include::_internal_has_file_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Include::has_file_name() const {
+  return _internal_has_file_name();
+}
+inline void Include::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Include::file_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Include.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Include::set_file_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Include.file_name)
+}
+inline std::string* Include::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Include.file_name)
+  return _s;
+}
+inline const std::string& Include::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void Include::_internal_set_file_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Include::_internal_mutable_file_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Include::release_file_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Include.file_name)
+  if (!_internal_has_file_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.file_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Include::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Include.file_name)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::resources::Include_ExportAction> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Include_ExportAction>() {
+  return ::buffers::resources::Include_ExportAction_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fInclude_2eproto
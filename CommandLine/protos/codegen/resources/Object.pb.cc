@@ -0,0 +1,1634 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Object.proto
+
+#include "resources/Object.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Object_PhysicsShapePoint::Object_PhysicsShapePoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0} {}
+struct Object_PhysicsShapePointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Object_PhysicsShapePointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Object_PhysicsShapePointDefaultTypeInternal() {}
+  union {
+    Object_PhysicsShapePoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Object_PhysicsShapePointDefaultTypeInternal _Object_PhysicsShapePoint_default_instance_;
+PROTOBUF_CONSTEXPR Object_ObjectPhysicsSettings::Object_ObjectPhysicsSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.phy_shape_)*/{}
+  , /*decltype(_impl_.phy_density_)*/0
+  , /*decltype(_impl_.phy_shape_type_)*/0
+  , /*decltype(_impl_.phy_group_)*/0
+  , /*decltype(_impl_.phy_restitution_)*/0
+  , /*decltype(_impl_.phy_linear_damping_)*/0
+  , /*decltype(_impl_.phy_angular_damping_)*/0
+  , /*decltype(_impl_.phy_friction_)*/0
+  , /*decltype(_impl_.use_physics_)*/false
+  , /*decltype(_impl_.phy_sensor_)*/false
+  , /*decltype(_impl_.phy_awake_)*/false
+  , /*decltype(_impl_.phy_kinematic_)*/false} {}
+struct Object_ObjectPhysicsSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Object_ObjectPhysicsSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Object_ObjectPhysicsSettingsDefaultTypeInternal() {}
+  union {
+    Object_ObjectPhysicsSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Object_ObjectPhysicsSettingsDefaultTypeInternal _Object_ObjectPhysicsSettings_default_instance_;
+PROTOBUF_CONSTEXPR Object::Object(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.parent_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sprite_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mask_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.physics_settings_)*/nullptr
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.depth_)*/0
+  , /*decltype(_impl_.solid_)*/false
+  , /*decltype(_impl_.visible_)*/false
+  , /*decltype(_impl_.persistent_)*/false} {}
+struct ObjectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ObjectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ObjectDefaultTypeInternal() {}
+  union {
+    Object _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ObjectDefaultTypeInternal _Object_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fObject_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_resources_2fObject_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fObject_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fObject_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_PhysicsShapePoint, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_PhysicsShapePoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_PhysicsShapePoint, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_PhysicsShapePoint, _impl_.y_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.use_physics_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_sensor_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_shape_type_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_density_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_restitution_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_group_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_linear_damping_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_angular_damping_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_friction_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_awake_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_kinematic_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object_ObjectPhysicsSettings, _impl_.phy_shape_),
+  7,
+  8,
+  1,
+  0,
+  3,
+  2,
+  4,
+  5,
+  6,
+  9,
+  10,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.parent_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.sprite_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.mask_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.solid_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.visible_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.persistent_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Object, _impl_.physics_settings_),
+  4,
+  0,
+  1,
+  2,
+  5,
+  6,
+  7,
+  8,
+  ~0u,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::buffers::resources::Object_PhysicsShapePoint)},
+  { 10, 28, -1, sizeof(::buffers::resources::Object_ObjectPhysicsSettings)},
+  { 40, 56, -1, sizeof(::buffers::resources::Object)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Object_PhysicsShapePoint_default_instance_._instance,
+  &::buffers::resources::_Object_ObjectPhysicsSettings_default_instance_._instance,
+  &::buffers::resources::_Object_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fObject_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026resources/Object.proto\022\021buffers.resour"
+  "ces\032\roptions.proto\032\025resources/Event.prot"
+  "o\"\340\013\n\006Object\022\036\n\002id\030\002 \001(\005B\022\222\265\030\016GMX_DEPREC"
+  "ATED\0225\n\013parent_name\030\003 \001(\tB \222\265\030\nparentNam"
+  "e\252\265\030\016parentObjectId\022/\n\013sprite_name\030\004 \001(\t"
+  "B\032\222\265\030\nspriteName\252\265\030\010spriteId\022/\n\tmask_nam"
+  "e\030\005 \001(\tB\034\222\265\030\010maskName\252\265\030\014maskSpriteId\022!\n"
+  "\005depth\030\006 \001(\005B\022\242\265\030\016YYP_DEPRECATED\022\r\n\005soli"
+  "d\030\007 \001(\010\022\017\n\007visible\030\010 \001(\010\022\022\n\npersistent\030\t"
+  " \001(\010\022G\n\006events\030\n \003(\0132\030.buffers.resources"
+  ".EventB\035\222\265\030\014events/event\242\265\030\teventList\022Y\n"
+  "\020physics_settings\030\013 \001(\0132/.buffers.resour"
+  "ces.Object.ObjectPhysicsSettingsB\016\222\265\030\nEG"
+  "M_NESTED\032K\n\021PhysicsShapePoint\022\032\n\001x\030\001 \001(\005"
+  "B\017\222\265\030\013GMX_SPLIT/0\022\032\n\001y\030\002 \001(\005B\017\222\265\030\013GMX_SP"
+  "LIT/1\032\244\007\n\025ObjectPhysicsSettings\0227\n\013use_p"
+  "hysics\030\001 \001(\010B\"\222\265\030\rPhysicsObject\242\265\030\rphysi"
+  "csObject\022<\n\nphy_sensor\030\002 \001(\010B(\222\265\030\023Physic"
+  "sObjectSensor\242\265\030\rphysicsSensor\022f\n\016phy_sh"
+  "ape_type\030\003 \001(\0162&.buffers.resources.Objec"
+  "t.PhysicsShapeB&\222\265\030\022PhysicsObjectShape\242\265"
+  "\030\014physicsShape\022\?\n\013phy_density\030\004 \001(\001B*\222\265\030"
+  "\024PhysicsObjectDensity\242\265\030\016physicsDensity\022"
+  "K\n\017phy_restitution\030\005 \001(\001B2\222\265\030\030PhysicsObj"
+  "ectRestitution\242\265\030\022physicsRestitution\0229\n\t"
+  "phy_group\030\006 \001(\005B&\222\265\030\022PhysicsObjectGroup\242"
+  "\265\030\014physicsGroup\022R\n\022phy_linear_damping\030\007 "
+  "\001(\001B6\222\265\030\032PhysicsObjectLinearDamping\242\265\030\024p"
+  "hysicsLinearDamping\022U\n\023phy_angular_dampi"
+  "ng\030\010 \001(\001B8\222\265\030\033PhysicsObjectAngularDampin"
+  "g\242\265\030\025physicsAngularDamping\022B\n\014phy_fricti"
+  "on\030\t \001(\001B,\222\265\030\025PhysicsObjectFriction\242\265\030\017p"
+  "hysicsFriction\0229\n\tphy_awake\030\n \001(\010B&\222\265\030\022P"
+  "hysicsObjectAwake\242\265\030\014physicsAwake\022E\n\rphy"
+  "_kinematic\030\013 \001(\010B.\222\265\030\026PhysicsObjectKinem"
+  "atic\242\265\030\020physicsKinematic\022r\n\tphy_shape\030\014 "
+  "\003(\0132+.buffers.resources.Object.PhysicsSh"
+  "apePointB2\222\265\030\030PhysicsShapePoints/point\242\265"
+  "\030\022physicsShapePoints\".\n\014PhysicsShape\022\n\n\006"
+  "CIRCLE\020\000\022\007\n\003BOX\020\001\022\t\n\005SHAPE\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fObject_2eproto_deps[2] = {
+  &::descriptor_table_options_2eproto,
+  &::descriptor_table_resources_2fEvent_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fObject_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fObject_2eproto = {
+    false, false, 1588, descriptor_table_protodef_resources_2fObject_2eproto,
+    "resources/Object.proto",
+    &descriptor_table_resources_2fObject_2eproto_once, descriptor_table_resources_2fObject_2eproto_deps, 2, 3,
+    schemas, file_default_instances, TableStruct_resources_2fObject_2eproto::offsets,
+    file_level_metadata_resources_2fObject_2eproto, file_level_enum_descriptors_resources_2fObject_2eproto,
+    file_level_service_descriptors_resources_2fObject_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fObject_2eproto_getter() {
+  return &descriptor_table_resources_2fObject_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fObject_2eproto(&descriptor_table_resources_2fObject_2eproto);
+namespace buffers {
+namespace resources {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Object_PhysicsShape_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fObject_2eproto);
+  return file_level_enum_descriptors_resources_2fObject_2eproto[0];
+}
+bool Object_PhysicsShape_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Object_PhysicsShape Object::CIRCLE;
+constexpr Object_PhysicsShape Object::BOX;
+constexpr Object_PhysicsShape Object::SHAPE;
+constexpr Object_PhysicsShape Object::PhysicsShape_MIN;
+constexpr Object_PhysicsShape Object::PhysicsShape_MAX;
+constexpr int Object::PhysicsShape_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Object_PhysicsShapePoint::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Object_PhysicsShapePoint>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Object_PhysicsShapePoint::Object_PhysicsShapePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Object.PhysicsShapePoint)
+}
+Object_PhysicsShapePoint::Object_PhysicsShapePoint(const Object_PhysicsShapePoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Object_PhysicsShapePoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Object.PhysicsShapePoint)
+}
+
+inline void Object_PhysicsShapePoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+  };
+}
+
+Object_PhysicsShapePoint::~Object_PhysicsShapePoint() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Object.PhysicsShapePoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Object_PhysicsShapePoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Object_PhysicsShapePoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Object_PhysicsShapePoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Object.PhysicsShapePoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.y_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Object_PhysicsShapePoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Object_PhysicsShapePoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Object.PhysicsShapePoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Object.PhysicsShapePoint)
+  return target;
+}
+
+size_t Object_PhysicsShapePoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Object.PhysicsShapePoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Object_PhysicsShapePoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Object_PhysicsShapePoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Object_PhysicsShapePoint::GetClassData() const { return &_class_data_; }
+
+
+void Object_PhysicsShapePoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Object_PhysicsShapePoint*>(&to_msg);
+  auto& from = static_cast<const Object_PhysicsShapePoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Object.PhysicsShapePoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Object_PhysicsShapePoint::CopyFrom(const Object_PhysicsShapePoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Object.PhysicsShapePoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Object_PhysicsShapePoint::IsInitialized() const {
+  return true;
+}
+
+void Object_PhysicsShapePoint::InternalSwap(Object_PhysicsShapePoint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Object_PhysicsShapePoint, _impl_.y_)
+      + sizeof(Object_PhysicsShapePoint::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(Object_PhysicsShapePoint, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Object_PhysicsShapePoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fObject_2eproto_getter, &descriptor_table_resources_2fObject_2eproto_once,
+      file_level_metadata_resources_2fObject_2eproto[0]);
+}
+
+// ===================================================================
+
+class Object_ObjectPhysicsSettings::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Object_ObjectPhysicsSettings>()._impl_._has_bits_);
+  static void set_has_use_physics(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_phy_sensor(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_phy_shape_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_phy_density(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_phy_restitution(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_phy_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_phy_linear_damping(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_phy_angular_damping(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_phy_friction(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_phy_awake(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_phy_kinematic(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+};
+
+Object_ObjectPhysicsSettings::Object_ObjectPhysicsSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Object.ObjectPhysicsSettings)
+}
+Object_ObjectPhysicsSettings::Object_ObjectPhysicsSettings(const Object_ObjectPhysicsSettings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Object_ObjectPhysicsSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phy_shape_){from._impl_.phy_shape_}
+    , decltype(_impl_.phy_density_){}
+    , decltype(_impl_.phy_shape_type_){}
+    , decltype(_impl_.phy_group_){}
+    , decltype(_impl_.phy_restitution_){}
+    , decltype(_impl_.phy_linear_damping_){}
+    , decltype(_impl_.phy_angular_damping_){}
+    , decltype(_impl_.phy_friction_){}
+    , decltype(_impl_.use_physics_){}
+    , decltype(_impl_.phy_sensor_){}
+    , decltype(_impl_.phy_awake_){}
+    , decltype(_impl_.phy_kinematic_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.phy_density_, &from._impl_.phy_density_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.phy_kinematic_) -
+    reinterpret_cast<char*>(&_impl_.phy_density_)) + sizeof(_impl_.phy_kinematic_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Object.ObjectPhysicsSettings)
+}
+
+inline void Object_ObjectPhysicsSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.phy_shape_){arena}
+    , decltype(_impl_.phy_density_){0}
+    , decltype(_impl_.phy_shape_type_){0}
+    , decltype(_impl_.phy_group_){0}
+    , decltype(_impl_.phy_restitution_){0}
+    , decltype(_impl_.phy_linear_damping_){0}
+    , decltype(_impl_.phy_angular_damping_){0}
+    , decltype(_impl_.phy_friction_){0}
+    , decltype(_impl_.use_physics_){false}
+    , decltype(_impl_.phy_sensor_){false}
+    , decltype(_impl_.phy_awake_){false}
+    , decltype(_impl_.phy_kinematic_){false}
+  };
+}
+
+Object_ObjectPhysicsSettings::~Object_ObjectPhysicsSettings() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Object.ObjectPhysicsSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Object_ObjectPhysicsSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phy_shape_.~RepeatedPtrField();
+}
+
+void Object_ObjectPhysicsSettings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Object_ObjectPhysicsSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Object.ObjectPhysicsSettings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.phy_shape_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.phy_density_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.use_physics_) -
+        reinterpret_cast<char*>(&_impl_.phy_density_)) + sizeof(_impl_.use_physics_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.phy_sensor_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.phy_kinematic_) -
+        reinterpret_cast<char*>(&_impl_.phy_sensor_)) + sizeof(_impl_.phy_kinematic_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Object_ObjectPhysicsSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool use_physics = 1 [(.buffers.gmx) = "PhysicsObject", (.buffers.yyp) = "physicsObject"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_use_physics(&has_bits);
+          _impl_.use_physics_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool phy_sensor = 2 [(.buffers.gmx) = "PhysicsObjectSensor", (.buffers.yyp) = "physicsSensor"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_phy_sensor(&has_bits);
+          _impl_.phy_sensor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Object.PhysicsShape phy_shape_type = 3 [(.buffers.gmx) = "PhysicsObjectShape", (.buffers.yyp) = "physicsShape"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Object_PhysicsShape_IsValid(val))) {
+            _internal_set_phy_shape_type(static_cast<::buffers::resources::Object_PhysicsShape>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_density = 4 [(.buffers.gmx) = "PhysicsObjectDensity", (.buffers.yyp) = "physicsDensity"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_phy_density(&has_bits);
+          _impl_.phy_density_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_restitution = 5 [(.buffers.gmx) = "PhysicsObjectRestitution", (.buffers.yyp) = "physicsRestitution"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_phy_restitution(&has_bits);
+          _impl_.phy_restitution_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 phy_group = 6 [(.buffers.gmx) = "PhysicsObjectGroup", (.buffers.yyp) = "physicsGroup"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_phy_group(&has_bits);
+          _impl_.phy_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_linear_damping = 7 [(.buffers.gmx) = "PhysicsObjectLinearDamping", (.buffers.yyp) = "physicsLinearDamping"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_phy_linear_damping(&has_bits);
+          _impl_.phy_linear_damping_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_angular_damping = 8 [(.buffers.gmx) = "PhysicsObjectAngularDamping", (.buffers.yyp) = "physicsAngularDamping"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_phy_angular_damping(&has_bits);
+          _impl_.phy_angular_damping_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_friction = 9 [(.buffers.gmx) = "PhysicsObjectFriction", (.buffers.yyp) = "physicsFriction"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_phy_friction(&has_bits);
+          _impl_.phy_friction_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool phy_awake = 10 [(.buffers.gmx) = "PhysicsObjectAwake", (.buffers.yyp) = "physicsAwake"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_phy_awake(&has_bits);
+          _impl_.phy_awake_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool phy_kinematic = 11 [(.buffers.gmx) = "PhysicsObjectKinematic", (.buffers.yyp) = "physicsKinematic"];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_phy_kinematic(&has_bits);
+          _impl_.phy_kinematic_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Object.PhysicsShapePoint phy_shape = 12 [(.buffers.gmx) = "PhysicsShapePoints/point", (.buffers.yyp) = "physicsShapePoints"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_phy_shape(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Object_ObjectPhysicsSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Object.ObjectPhysicsSettings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool use_physics = 1 [(.buffers.gmx) = "PhysicsObject", (.buffers.yyp) = "physicsObject"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_use_physics(), target);
+  }
+
+  // optional bool phy_sensor = 2 [(.buffers.gmx) = "PhysicsObjectSensor", (.buffers.yyp) = "physicsSensor"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_phy_sensor(), target);
+  }
+
+  // optional .buffers.resources.Object.PhysicsShape phy_shape_type = 3 [(.buffers.gmx) = "PhysicsObjectShape", (.buffers.yyp) = "physicsShape"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_phy_shape_type(), target);
+  }
+
+  // optional double phy_density = 4 [(.buffers.gmx) = "PhysicsObjectDensity", (.buffers.yyp) = "physicsDensity"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_phy_density(), target);
+  }
+
+  // optional double phy_restitution = 5 [(.buffers.gmx) = "PhysicsObjectRestitution", (.buffers.yyp) = "physicsRestitution"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_phy_restitution(), target);
+  }
+
+  // optional int32 phy_group = 6 [(.buffers.gmx) = "PhysicsObjectGroup", (.buffers.yyp) = "physicsGroup"];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_phy_group(), target);
+  }
+
+  // optional double phy_linear_damping = 7 [(.buffers.gmx) = "PhysicsObjectLinearDamping", (.buffers.yyp) = "physicsLinearDamping"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_phy_linear_damping(), target);
+  }
+
+  // optional double phy_angular_damping = 8 [(.buffers.gmx) = "PhysicsObjectAngularDamping", (.buffers.yyp) = "physicsAngularDamping"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_phy_angular_damping(), target);
+  }
+
+  // optional double phy_friction = 9 [(.buffers.gmx) = "PhysicsObjectFriction", (.buffers.yyp) = "physicsFriction"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_phy_friction(), target);
+  }
+
+  // optional bool phy_awake = 10 [(.buffers.gmx) = "PhysicsObjectAwake", (.buffers.yyp) = "physicsAwake"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_phy_awake(), target);
+  }
+
+  // optional bool phy_kinematic = 11 [(.buffers.gmx) = "PhysicsObjectKinematic", (.buffers.yyp) = "physicsKinematic"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_phy_kinematic(), target);
+  }
+
+  // repeated .buffers.resources.Object.PhysicsShapePoint phy_shape = 12 [(.buffers.gmx) = "PhysicsShapePoints/point", (.buffers.yyp) = "physicsShapePoints"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_phy_shape_size()); i < n; i++) {
+    const auto& repfield = this->_internal_phy_shape(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Object.ObjectPhysicsSettings)
+  return target;
+}
+
+size_t Object_ObjectPhysicsSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Object.ObjectPhysicsSettings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Object.PhysicsShapePoint phy_shape = 12 [(.buffers.gmx) = "PhysicsShapePoints/point", (.buffers.yyp) = "physicsShapePoints"];
+  total_size += 1UL * this->_internal_phy_shape_size();
+  for (const auto& msg : this->_impl_.phy_shape_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double phy_density = 4 [(.buffers.gmx) = "PhysicsObjectDensity", (.buffers.yyp) = "physicsDensity"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional .buffers.resources.Object.PhysicsShape phy_shape_type = 3 [(.buffers.gmx) = "PhysicsObjectShape", (.buffers.yyp) = "physicsShape"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_phy_shape_type());
+    }
+
+    // optional int32 phy_group = 6 [(.buffers.gmx) = "PhysicsObjectGroup", (.buffers.yyp) = "physicsGroup"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_phy_group());
+    }
+
+    // optional double phy_restitution = 5 [(.buffers.gmx) = "PhysicsObjectRestitution", (.buffers.yyp) = "physicsRestitution"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double phy_linear_damping = 7 [(.buffers.gmx) = "PhysicsObjectLinearDamping", (.buffers.yyp) = "physicsLinearDamping"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double phy_angular_damping = 8 [(.buffers.gmx) = "PhysicsObjectAngularDamping", (.buffers.yyp) = "physicsAngularDamping"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double phy_friction = 9 [(.buffers.gmx) = "PhysicsObjectFriction", (.buffers.yyp) = "physicsFriction"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool use_physics = 1 [(.buffers.gmx) = "PhysicsObject", (.buffers.yyp) = "physicsObject"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional bool phy_sensor = 2 [(.buffers.gmx) = "PhysicsObjectSensor", (.buffers.yyp) = "physicsSensor"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool phy_awake = 10 [(.buffers.gmx) = "PhysicsObjectAwake", (.buffers.yyp) = "physicsAwake"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool phy_kinematic = 11 [(.buffers.gmx) = "PhysicsObjectKinematic", (.buffers.yyp) = "physicsKinematic"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Object_ObjectPhysicsSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Object_ObjectPhysicsSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Object_ObjectPhysicsSettings::GetClassData() const { return &_class_data_; }
+
+
+void Object_ObjectPhysicsSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Object_ObjectPhysicsSettings*>(&to_msg);
+  auto& from = static_cast<const Object_ObjectPhysicsSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Object.ObjectPhysicsSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.phy_shape_.MergeFrom(from._impl_.phy_shape_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.phy_density_ = from._impl_.phy_density_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.phy_shape_type_ = from._impl_.phy_shape_type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.phy_group_ = from._impl_.phy_group_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.phy_restitution_ = from._impl_.phy_restitution_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.phy_linear_damping_ = from._impl_.phy_linear_damping_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.phy_angular_damping_ = from._impl_.phy_angular_damping_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.phy_friction_ = from._impl_.phy_friction_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.use_physics_ = from._impl_.use_physics_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.phy_sensor_ = from._impl_.phy_sensor_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.phy_awake_ = from._impl_.phy_awake_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.phy_kinematic_ = from._impl_.phy_kinematic_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Object_ObjectPhysicsSettings::CopyFrom(const Object_ObjectPhysicsSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Object.ObjectPhysicsSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Object_ObjectPhysicsSettings::IsInitialized() const {
+  return true;
+}
+
+void Object_ObjectPhysicsSettings::InternalSwap(Object_ObjectPhysicsSettings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.phy_shape_.InternalSwap(&other->_impl_.phy_shape_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Object_ObjectPhysicsSettings, _impl_.phy_kinematic_)
+      + sizeof(Object_ObjectPhysicsSettings::_impl_.phy_kinematic_)
+      - PROTOBUF_FIELD_OFFSET(Object_ObjectPhysicsSettings, _impl_.phy_density_)>(
+          reinterpret_cast<char*>(&_impl_.phy_density_),
+          reinterpret_cast<char*>(&other->_impl_.phy_density_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Object_ObjectPhysicsSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fObject_2eproto_getter, &descriptor_table_resources_2fObject_2eproto_once,
+      file_level_metadata_resources_2fObject_2eproto[1]);
+}
+
+// ===================================================================
+
+class Object::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Object>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_parent_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sprite_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_mask_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_solid(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_visible(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_persistent(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::buffers::resources::Object_ObjectPhysicsSettings& physics_settings(const Object* msg);
+  static void set_has_physics_settings(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::buffers::resources::Object_ObjectPhysicsSettings&
+Object::_Internal::physics_settings(const Object* msg) {
+  return *msg->_impl_.physics_settings_;
+}
+void Object::clear_events() {
+  _impl_.events_.Clear();
+}
+Object::Object(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Object)
+}
+Object::Object(const Object& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Object* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.parent_name_){}
+    , decltype(_impl_.sprite_name_){}
+    , decltype(_impl_.mask_name_){}
+    , decltype(_impl_.physics_settings_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.solid_){}
+    , decltype(_impl_.visible_){}
+    , decltype(_impl_.persistent_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.parent_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_parent_name()) {
+    _this->_impl_.parent_name_.Set(from._internal_parent_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sprite_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sprite_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_sprite_name()) {
+    _this->_impl_.sprite_name_.Set(from._internal_sprite_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.mask_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_mask_name()) {
+    _this->_impl_.mask_name_.Set(from._internal_mask_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_physics_settings()) {
+    _this->_impl_.physics_settings_ = new ::buffers::resources::Object_ObjectPhysicsSettings(*from._impl_.physics_settings_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.persistent_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.persistent_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Object)
+}
+
+inline void Object::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.parent_name_){}
+    , decltype(_impl_.sprite_name_){}
+    , decltype(_impl_.mask_name_){}
+    , decltype(_impl_.physics_settings_){nullptr}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.depth_){0}
+    , decltype(_impl_.solid_){false}
+    , decltype(_impl_.visible_){false}
+    , decltype(_impl_.persistent_){false}
+  };
+  _impl_.parent_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sprite_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sprite_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.mask_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mask_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Object::~Object() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Object)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Object::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  _impl_.parent_name_.Destroy();
+  _impl_.sprite_name_.Destroy();
+  _impl_.mask_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.physics_settings_;
+}
+
+void Object::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Object::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Object)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.parent_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.sprite_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.mask_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.physics_settings_ != nullptr);
+      _impl_.physics_settings_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.visible_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.visible_));
+  }
+  _impl_.persistent_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Object::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string parent_name = 3 [(.buffers.gmx) = "parentName", (.buffers.yyp_id) = "parentObjectId"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_parent_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Object.parent_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string sprite_name = 4 [(.buffers.gmx) = "spriteName", (.buffers.yyp_id) = "spriteId"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_sprite_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Object.sprite_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string mask_name = 5 [(.buffers.gmx) = "maskName", (.buffers.yyp_id) = "maskSpriteId"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_mask_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Object.mask_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 depth = 6 [(.buffers.yyp) = "YYP_DEPRECATED"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_depth(&has_bits);
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool solid = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_solid(&has_bits);
+          _impl_.solid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool visible = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_visible(&has_bits);
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool persistent = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_persistent(&has_bits);
+          _impl_.persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Event events = 10 [(.buffers.gmx) = "events/event", (.buffers.yyp) = "eventList"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Object.ObjectPhysicsSettings physics_settings = 11 [(.buffers.gmx) = "EGM_NESTED"];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_physics_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Object::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Object)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional string parent_name = 3 [(.buffers.gmx) = "parentName", (.buffers.yyp_id) = "parentObjectId"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_parent_name().data(), static_cast<int>(this->_internal_parent_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Object.parent_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_parent_name(), target);
+  }
+
+  // optional string sprite_name = 4 [(.buffers.gmx) = "spriteName", (.buffers.yyp_id) = "spriteId"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_sprite_name().data(), static_cast<int>(this->_internal_sprite_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Object.sprite_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_sprite_name(), target);
+  }
+
+  // optional string mask_name = 5 [(.buffers.gmx) = "maskName", (.buffers.yyp_id) = "maskSpriteId"];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_mask_name().data(), static_cast<int>(this->_internal_mask_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Object.mask_name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_mask_name(), target);
+  }
+
+  // optional int32 depth = 6 [(.buffers.yyp) = "YYP_DEPRECATED"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_depth(), target);
+  }
+
+  // optional bool solid = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_solid(), target);
+  }
+
+  // optional bool visible = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_visible(), target);
+  }
+
+  // optional bool persistent = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_persistent(), target);
+  }
+
+  // repeated .buffers.resources.Event events = 10 [(.buffers.gmx) = "events/event", (.buffers.yyp) = "eventList"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .buffers.resources.Object.ObjectPhysicsSettings physics_settings = 11 [(.buffers.gmx) = "EGM_NESTED"];
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::physics_settings(this),
+        _Internal::physics_settings(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Object)
+  return target;
+}
+
+size_t Object::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Object)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Event events = 10 [(.buffers.gmx) = "events/event", (.buffers.yyp) = "eventList"];
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string parent_name = 3 [(.buffers.gmx) = "parentName", (.buffers.yyp_id) = "parentObjectId"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_parent_name());
+    }
+
+    // optional string sprite_name = 4 [(.buffers.gmx) = "spriteName", (.buffers.yyp_id) = "spriteId"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_sprite_name());
+    }
+
+    // optional string mask_name = 5 [(.buffers.gmx) = "maskName", (.buffers.yyp_id) = "maskSpriteId"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_mask_name());
+    }
+
+    // optional .buffers.resources.Object.ObjectPhysicsSettings physics_settings = 11 [(.buffers.gmx) = "EGM_NESTED"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.physics_settings_);
+    }
+
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 depth = 6 [(.buffers.yyp) = "YYP_DEPRECATED"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_depth());
+    }
+
+    // optional bool solid = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool visible = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // optional bool persistent = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Object::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Object::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Object::GetClassData() const { return &_class_data_; }
+
+
+void Object::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Object*>(&to_msg);
+  auto& from = static_cast<const Object&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Object)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_parent_name(from._internal_parent_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_sprite_name(from._internal_sprite_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_mask_name(from._internal_mask_name());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_physics_settings()->::buffers::resources::Object_ObjectPhysicsSettings::MergeFrom(
+          from._internal_physics_settings());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.depth_ = from._impl_.depth_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.solid_ = from._impl_.solid_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.visible_ = from._impl_.visible_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_persistent(from._internal_persistent());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Object::CopyFrom(const Object& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Object)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Object::IsInitialized() const {
+  return true;
+}
+
+void Object::InternalSwap(Object* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.parent_name_, lhs_arena,
+      &other->_impl_.parent_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sprite_name_, lhs_arena,
+      &other->_impl_.sprite_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mask_name_, lhs_arena,
+      &other->_impl_.mask_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Object, _impl_.persistent_)
+      + sizeof(Object::_impl_.persistent_)
+      - PROTOBUF_FIELD_OFFSET(Object, _impl_.physics_settings_)>(
+          reinterpret_cast<char*>(&_impl_.physics_settings_),
+          reinterpret_cast<char*>(&other->_impl_.physics_settings_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Object::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fObject_2eproto_getter, &descriptor_table_resources_2fObject_2eproto_once,
+      file_level_metadata_resources_2fObject_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Object_PhysicsShapePoint*
+Arena::CreateMaybeMessage< ::buffers::resources::Object_PhysicsShapePoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Object_PhysicsShapePoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Object_ObjectPhysicsSettings*
+Arena::CreateMaybeMessage< ::buffers::resources::Object_ObjectPhysicsSettings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Object_ObjectPhysicsSettings >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Object*
+Arena::CreateMaybeMessage< ::buffers::resources::Object >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Object >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1876 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Object.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fObject_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fObject_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+#include "resources/Event.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fObject_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fObject_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fObject_2eproto;
+namespace buffers {
+namespace resources {
+class Object;
+struct ObjectDefaultTypeInternal;
+extern ObjectDefaultTypeInternal _Object_default_instance_;
+class Object_ObjectPhysicsSettings;
+struct Object_ObjectPhysicsSettingsDefaultTypeInternal;
+extern Object_ObjectPhysicsSettingsDefaultTypeInternal _Object_ObjectPhysicsSettings_default_instance_;
+class Object_PhysicsShapePoint;
+struct Object_PhysicsShapePointDefaultTypeInternal;
+extern Object_PhysicsShapePointDefaultTypeInternal _Object_PhysicsShapePoint_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Object* Arena::CreateMaybeMessage<::buffers::resources::Object>(Arena*);
+template<> ::buffers::resources::Object_ObjectPhysicsSettings* Arena::CreateMaybeMessage<::buffers::resources::Object_ObjectPhysicsSettings>(Arena*);
+template<> ::buffers::resources::Object_PhysicsShapePoint* Arena::CreateMaybeMessage<::buffers::resources::Object_PhysicsShapePoint>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+enum Object_PhysicsShape : int {
+  Object_PhysicsShape_CIRCLE = 0,
+  Object_PhysicsShape_BOX = 1,
+  Object_PhysicsShape_SHAPE = 2
+};
+bool Object_PhysicsShape_IsValid(int value);
+constexpr Object_PhysicsShape Object_PhysicsShape_PhysicsShape_MIN = Object_PhysicsShape_CIRCLE;
+constexpr Object_PhysicsShape Object_PhysicsShape_PhysicsShape_MAX = Object_PhysicsShape_SHAPE;
+constexpr int Object_PhysicsShape_PhysicsShape_ARRAYSIZE = Object_PhysicsShape_PhysicsShape_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Object_PhysicsShape_descriptor();
+template<typename T>
+inline const std::string& Object_PhysicsShape_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Object_PhysicsShape>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Object_PhysicsShape_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Object_PhysicsShape_descriptor(), enum_t_value);
+}
+inline bool Object_PhysicsShape_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Object_PhysicsShape* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Object_PhysicsShape>(
+    Object_PhysicsShape_descriptor(), name, value);
+}
+// ===================================================================
+
+class Object_PhysicsShapePoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Object.PhysicsShapePoint) */ {
+ public:
+  inline Object_PhysicsShapePoint() : Object_PhysicsShapePoint(nullptr) {}
+  ~Object_PhysicsShapePoint() override;
+  explicit PROTOBUF_CONSTEXPR Object_PhysicsShapePoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Object_PhysicsShapePoint(const Object_PhysicsShapePoint& from);
+  Object_PhysicsShapePoint(Object_PhysicsShapePoint&& from) noexcept
+    : Object_PhysicsShapePoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Object_PhysicsShapePoint& operator=(const Object_PhysicsShapePoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Object_PhysicsShapePoint& operator=(Object_PhysicsShapePoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Object_PhysicsShapePoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Object_PhysicsShapePoint* internal_default_instance() {
+    return reinterpret_cast<const Object_PhysicsShapePoint*>(
+               &_Object_PhysicsShapePoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Object_PhysicsShapePoint& a, Object_PhysicsShapePoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Object_PhysicsShapePoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Object_PhysicsShapePoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Object_PhysicsShapePoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Object_PhysicsShapePoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Object_PhysicsShapePoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Object_PhysicsShapePoint& from) {
+    Object_PhysicsShapePoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Object_PhysicsShapePoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Object.PhysicsShapePoint";
+  }
+  protected:
+  explicit Object_PhysicsShapePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
+  // optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Object.PhysicsShapePoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fObject_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Object_ObjectPhysicsSettings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Object.ObjectPhysicsSettings) */ {
+ public:
+  inline Object_ObjectPhysicsSettings() : Object_ObjectPhysicsSettings(nullptr) {}
+  ~Object_ObjectPhysicsSettings() override;
+  explicit PROTOBUF_CONSTEXPR Object_ObjectPhysicsSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Object_ObjectPhysicsSettings(const Object_ObjectPhysicsSettings& from);
+  Object_ObjectPhysicsSettings(Object_ObjectPhysicsSettings&& from) noexcept
+    : Object_ObjectPhysicsSettings() {
+    *this = ::std::move(from);
+  }
+
+  inline Object_ObjectPhysicsSettings& operator=(const Object_ObjectPhysicsSettings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Object_ObjectPhysicsSettings& operator=(Object_ObjectPhysicsSettings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Object_ObjectPhysicsSettings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Object_ObjectPhysicsSettings* internal_default_instance() {
+    return reinterpret_cast<const Object_ObjectPhysicsSettings*>(
+               &_Object_ObjectPhysicsSettings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Object_ObjectPhysicsSettings& a, Object_ObjectPhysicsSettings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Object_ObjectPhysicsSettings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Object_ObjectPhysicsSettings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Object_ObjectPhysicsSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Object_ObjectPhysicsSettings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Object_ObjectPhysicsSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Object_ObjectPhysicsSettings& from) {
+    Object_ObjectPhysicsSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Object_ObjectPhysicsSettings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Object.ObjectPhysicsSettings";
+  }
+  protected:
+  explicit Object_ObjectPhysicsSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhyShapeFieldNumber = 12,
+    kPhyDensityFieldNumber = 4,
+    kPhyShapeTypeFieldNumber = 3,
+    kPhyGroupFieldNumber = 6,
+    kPhyRestitutionFieldNumber = 5,
+    kPhyLinearDampingFieldNumber = 7,
+    kPhyAngularDampingFieldNumber = 8,
+    kPhyFrictionFieldNumber = 9,
+    kUsePhysicsFieldNumber = 1,
+    kPhySensorFieldNumber = 2,
+    kPhyAwakeFieldNumber = 10,
+    kPhyKinematicFieldNumber = 11,
+  };
+  // repeated .buffers.resources.Object.PhysicsShapePoint phy_shape = 12 [(.buffers.gmx) = "PhysicsShapePoints/point", (.buffers.yyp) = "physicsShapePoints"];
+  int phy_shape_size() const;
+  private:
+  int _internal_phy_shape_size() const;
+  public:
+  void clear_phy_shape();
+  ::buffers::resources::Object_PhysicsShapePoint* mutable_phy_shape(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Object_PhysicsShapePoint >*
+      mutable_phy_shape();
+  private:
+  const ::buffers::resources::Object_PhysicsShapePoint& _internal_phy_shape(int index) const;
+  ::buffers::resources::Object_PhysicsShapePoint* _internal_add_phy_shape();
+  public:
+  const ::buffers::resources::Object_PhysicsShapePoint& phy_shape(int index) const;
+  ::buffers::resources::Object_PhysicsShapePoint* add_phy_shape();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Object_PhysicsShapePoint >&
+      phy_shape() const;
+
+  // optional double phy_density = 4 [(.buffers.gmx) = "PhysicsObjectDensity", (.buffers.yyp) = "physicsDensity"];
+  bool has_phy_density() const;
+  private:
+  bool _internal_has_phy_density() const;
+  public:
+  void clear_phy_density();
+  double phy_density() const;
+  void set_phy_density(double value);
+  private:
+  double _internal_phy_density() const;
+  void _internal_set_phy_density(double value);
+  public:
+
+  // optional .buffers.resources.Object.PhysicsShape phy_shape_type = 3 [(.buffers.gmx) = "PhysicsObjectShape", (.buffers.yyp) = "physicsShape"];
+  bool has_phy_shape_type() const;
+  private:
+  bool _internal_has_phy_shape_type() const;
+  public:
+  void clear_phy_shape_type();
+  ::buffers::resources::Object_PhysicsShape phy_shape_type() const;
+  void set_phy_shape_type(::buffers::resources::Object_PhysicsShape value);
+  private:
+  ::buffers::resources::Object_PhysicsShape _internal_phy_shape_type() const;
+  void _internal_set_phy_shape_type(::buffers::resources::Object_PhysicsShape value);
+  public:
+
+  // optional int32 phy_group = 6 [(.buffers.gmx) = "PhysicsObjectGroup", (.buffers.yyp) = "physicsGroup"];
+  bool has_phy_group() const;
+  private:
+  bool _internal_has_phy_group() const;
+  public:
+  void clear_phy_group();
+  int32_t phy_group() const;
+  void set_phy_group(int32_t value);
+  private:
+  int32_t _internal_phy_group() const;
+  void _internal_set_phy_group(int32_t value);
+  public:
+
+  // optional double phy_restitution = 5 [(.buffers.gmx) = "PhysicsObjectRestitution", (.buffers.yyp) = "physicsRestitution"];
+  bool has_phy_restitution() const;
+  private:
+  bool _internal_has_phy_restitution() const;
+  public:
+  void clear_phy_restitution();
+  double phy_restitution() const;
+  void set_phy_restitution(double value);
+  private:
+  double _internal_phy_restitution() const;
+  void _internal_set_phy_restitution(double value);
+  public:
+
+  // optional double phy_linear_damping = 7 [(.buffers.gmx) = "PhysicsObjectLinearDamping", (.buffers.yyp) = "physicsLinearDamping"];
+  bool has_phy_linear_damping() const;
+  private:
+  bool _internal_has_phy_linear_damping() const;
+  public:
+  void clear_phy_linear_damping();
+  double phy_linear_damping() const;
+  void set_phy_linear_damping(double value);
+  private:
+  double _internal_phy_linear_damping() const;
+  void _internal_set_phy_linear_damping(double value);
+  public:
+
+  // optional double phy_angular_damping = 8 [(.buffers.gmx) = "PhysicsObjectAngularDamping", (.buffers.yyp) = "physicsAngularDamping"];
+  bool has_phy_angular_damping() const;
+  private:
+  bool _internal_has_phy_angular_damping() const;
+  public:
+  void clear_phy_angular_damping();
+  double phy_angular_damping() const;
+  void set_phy_angular_damping(double value);
+  private:
+  double _internal_phy_angular_damping() const;
+  void _internal_set_phy_angular_damping(double value);
+  public:
+
+  // optional double phy_friction = 9 [(.buffers.gmx) = "PhysicsObjectFriction", (.buffers.yyp) = "physicsFriction"];
+  bool has_phy_friction() const;
+  private:
+  bool _internal_has_phy_friction() const;
+  public:
+  void clear_phy_friction();
+  double phy_friction() const;
+  void set_phy_friction(double value);
+  private:
+  double _internal_phy_friction() const;
+  void _internal_set_phy_friction(double value);
+  public:
+
+  // optional bool use_physics = 1 [(.buffers.gmx) = "PhysicsObject", (.buffers.yyp) = "physicsObject"];
+  bool has_use_physics() const;
+  private:
+  bool _internal_has_use_physics() const;
+  public:
+  void clear_use_physics();
+  bool use_physics() const;
+  void set_use_physics(bool value);
+  private:
+  bool _internal_use_physics() const;
+  void _internal_set_use_physics(bool value);
+  public:
+
+  // optional bool phy_sensor = 2 [(.buffers.gmx) = "PhysicsObjectSensor", (.buffers.yyp) = "physicsSensor"];
+  bool has_phy_sensor() const;
+  private:
+  bool _internal_has_phy_sensor() const;
+  public:
+  void clear_phy_sensor();
+  bool phy_sensor() const;
+  void set_phy_sensor(bool value);
+  private:
+  bool _internal_phy_sensor() const;
+  void _internal_set_phy_sensor(bool value);
+  public:
+
+  // optional bool phy_awake = 10 [(.buffers.gmx) = "PhysicsObjectAwake", (.buffers.yyp) = "physicsAwake"];
+  bool has_phy_awake() const;
+  private:
+  bool _internal_has_phy_awake() const;
+  public:
+  void clear_phy_awake();
+  bool phy_awake() const;
+  void set_phy_awake(bool value);
+  private:
+  bool _internal_phy_awake() const;
+  void _internal_set_phy_awake(bool value);
+  public:
+
+  // optional bool phy_kinematic = 11 [(.buffers.gmx) = "PhysicsObjectKinematic", (.buffers.yyp) = "physicsKinematic"];
+  bool has_phy_kinematic() const;
+  private:
+  bool _internal_has_phy_kinematic() const;
+  public:
+  void clear_phy_kinematic();
+  bool phy_kinematic() const;
+  void set_phy_kinematic(bool value);
+  private:
+  bool _internal_phy_kinematic() const;
+  void _internal_set_phy_kinematic(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Object.ObjectPhysicsSettings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Object_PhysicsShapePoint > phy_shape_;
+    double phy_density_;
+    int phy_shape_type_;
+    int32_t phy_group_;
+    double phy_restitution_;
+    double phy_linear_damping_;
+    double phy_angular_damping_;
+    double phy_friction_;
+    bool use_physics_;
+    bool phy_sensor_;
+    bool phy_awake_;
+    bool phy_kinematic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fObject_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Object final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Object) */ {
+ public:
+  inline Object() : Object(nullptr) {}
+  ~Object() override;
+  explicit PROTOBUF_CONSTEXPR Object(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Object(const Object& from);
+  Object(Object&& from) noexcept
+    : Object() {
+    *this = ::std::move(from);
+  }
+
+  inline Object& operator=(const Object& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Object& operator=(Object&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Object& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Object* internal_default_instance() {
+    return reinterpret_cast<const Object*>(
+               &_Object_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Object& a, Object& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Object* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Object* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Object* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Object>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Object& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Object& from) {
+    Object::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Object* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Object";
+  }
+  protected:
+  explicit Object(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Object_PhysicsShapePoint PhysicsShapePoint;
+  typedef Object_ObjectPhysicsSettings ObjectPhysicsSettings;
+
+  typedef Object_PhysicsShape PhysicsShape;
+  static constexpr PhysicsShape CIRCLE =
+    Object_PhysicsShape_CIRCLE;
+  static constexpr PhysicsShape BOX =
+    Object_PhysicsShape_BOX;
+  static constexpr PhysicsShape SHAPE =
+    Object_PhysicsShape_SHAPE;
+  static inline bool PhysicsShape_IsValid(int value) {
+    return Object_PhysicsShape_IsValid(value);
+  }
+  static constexpr PhysicsShape PhysicsShape_MIN =
+    Object_PhysicsShape_PhysicsShape_MIN;
+  static constexpr PhysicsShape PhysicsShape_MAX =
+    Object_PhysicsShape_PhysicsShape_MAX;
+  static constexpr int PhysicsShape_ARRAYSIZE =
+    Object_PhysicsShape_PhysicsShape_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  PhysicsShape_descriptor() {
+    return Object_PhysicsShape_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& PhysicsShape_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PhysicsShape>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function PhysicsShape_Name.");
+    return Object_PhysicsShape_Name(enum_t_value);
+  }
+  static inline bool PhysicsShape_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PhysicsShape* value) {
+    return Object_PhysicsShape_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 10,
+    kParentNameFieldNumber = 3,
+    kSpriteNameFieldNumber = 4,
+    kMaskNameFieldNumber = 5,
+    kPhysicsSettingsFieldNumber = 11,
+    kIdFieldNumber = 2,
+    kDepthFieldNumber = 6,
+    kSolidFieldNumber = 7,
+    kVisibleFieldNumber = 8,
+    kPersistentFieldNumber = 9,
+  };
+  // repeated .buffers.resources.Event events = 10 [(.buffers.gmx) = "events/event", (.buffers.yyp) = "eventList"];
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::buffers::resources::Event* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Event >*
+      mutable_events();
+  private:
+  const ::buffers::resources::Event& _internal_events(int index) const;
+  ::buffers::resources::Event* _internal_add_events();
+  public:
+  const ::buffers::resources::Event& events(int index) const;
+  ::buffers::resources::Event* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Event >&
+      events() const;
+
+  // optional string parent_name = 3 [(.buffers.gmx) = "parentName", (.buffers.yyp_id) = "parentObjectId"];
+  bool has_parent_name() const;
+  private:
+  bool _internal_has_parent_name() const;
+  public:
+  void clear_parent_name();
+  const std::string& parent_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_name();
+  PROTOBUF_NODISCARD std::string* release_parent_name();
+  void set_allocated_parent_name(std::string* parent_name);
+  private:
+  const std::string& _internal_parent_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_name(const std::string& value);
+  std::string* _internal_mutable_parent_name();
+  public:
+
+  // optional string sprite_name = 4 [(.buffers.gmx) = "spriteName", (.buffers.yyp_id) = "spriteId"];
+  bool has_sprite_name() const;
+  private:
+  bool _internal_has_sprite_name() const;
+  public:
+  void clear_sprite_name();
+  const std::string& sprite_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sprite_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sprite_name();
+  PROTOBUF_NODISCARD std::string* release_sprite_name();
+  void set_allocated_sprite_name(std::string* sprite_name);
+  private:
+  const std::string& _internal_sprite_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sprite_name(const std::string& value);
+  std::string* _internal_mutable_sprite_name();
+  public:
+
+  // optional string mask_name = 5 [(.buffers.gmx) = "maskName", (.buffers.yyp_id) = "maskSpriteId"];
+  bool has_mask_name() const;
+  private:
+  bool _internal_has_mask_name() const;
+  public:
+  void clear_mask_name();
+  const std::string& mask_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mask_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mask_name();
+  PROTOBUF_NODISCARD std::string* release_mask_name();
+  void set_allocated_mask_name(std::string* mask_name);
+  private:
+  const std::string& _internal_mask_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mask_name(const std::string& value);
+  std::string* _internal_mutable_mask_name();
+  public:
+
+  // optional .buffers.resources.Object.ObjectPhysicsSettings physics_settings = 11 [(.buffers.gmx) = "EGM_NESTED"];
+  bool has_physics_settings() const;
+  private:
+  bool _internal_has_physics_settings() const;
+  public:
+  void clear_physics_settings();
+  const ::buffers::resources::Object_ObjectPhysicsSettings& physics_settings() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Object_ObjectPhysicsSettings* release_physics_settings();
+  ::buffers::resources::Object_ObjectPhysicsSettings* mutable_physics_settings();
+  void set_allocated_physics_settings(::buffers::resources::Object_ObjectPhysicsSettings* physics_settings);
+  private:
+  const ::buffers::resources::Object_ObjectPhysicsSettings& _internal_physics_settings() const;
+  ::buffers::resources::Object_ObjectPhysicsSettings* _internal_mutable_physics_settings();
+  public:
+  void unsafe_arena_set_allocated_physics_settings(
+      ::buffers::resources::Object_ObjectPhysicsSettings* physics_settings);
+  ::buffers::resources::Object_ObjectPhysicsSettings* unsafe_arena_release_physics_settings();
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 depth = 6 [(.buffers.yyp) = "YYP_DEPRECATED"];
+  bool has_depth() const;
+  private:
+  bool _internal_has_depth() const;
+  public:
+  void clear_depth();
+  int32_t depth() const;
+  void set_depth(int32_t value);
+  private:
+  int32_t _internal_depth() const;
+  void _internal_set_depth(int32_t value);
+  public:
+
+  // optional bool solid = 7;
+  bool has_solid() const;
+  private:
+  bool _internal_has_solid() const;
+  public:
+  void clear_solid();
+  bool solid() const;
+  void set_solid(bool value);
+  private:
+  bool _internal_solid() const;
+  void _internal_set_solid(bool value);
+  public:
+
+  // optional bool visible = 8;
+  bool has_visible() const;
+  private:
+  bool _internal_has_visible() const;
+  public:
+  void clear_visible();
+  bool visible() const;
+  void set_visible(bool value);
+  private:
+  bool _internal_visible() const;
+  void _internal_set_visible(bool value);
+  public:
+
+  // optional bool persistent = 9;
+  bool has_persistent() const;
+  private:
+  bool _internal_has_persistent() const;
+  public:
+  void clear_persistent();
+  bool persistent() const;
+  void set_persistent(bool value);
+  private:
+  bool _internal_persistent() const;
+  void _internal_set_persistent(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Object)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Event > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sprite_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_name_;
+    ::buffers::resources::Object_ObjectPhysicsSettings* physics_settings_;
+    int32_t id_;
+    int32_t depth_;
+    bool solid_;
+    bool visible_;
+    bool persistent_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fObject_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Object_PhysicsShapePoint
+
+// optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+inline bool Object_PhysicsShapePoint::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Object_PhysicsShapePoint::has_x() const {
+  return _internal_has_x();
+}
+inline void Object_PhysicsShapePoint::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Object_PhysicsShapePoint::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Object_PhysicsShapePoint::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.PhysicsShapePoint.x)
+  return _internal_x();
+}
+inline void Object_PhysicsShapePoint::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void Object_PhysicsShapePoint::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.PhysicsShapePoint.x)
+}
+
+// optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+inline bool Object_PhysicsShapePoint::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Object_PhysicsShapePoint::has_y() const {
+  return _internal_has_y();
+}
+inline void Object_PhysicsShapePoint::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Object_PhysicsShapePoint::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Object_PhysicsShapePoint::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.PhysicsShapePoint.y)
+  return _internal_y();
+}
+inline void Object_PhysicsShapePoint::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void Object_PhysicsShapePoint::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.PhysicsShapePoint.y)
+}
+
+// -------------------------------------------------------------------
+
+// Object_ObjectPhysicsSettings
+
+// optional bool use_physics = 1 [(.buffers.gmx) = "PhysicsObject", (.buffers.yyp) = "physicsObject"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_use_physics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_use_physics() const {
+  return _internal_has_use_physics();
+}
+inline void Object_ObjectPhysicsSettings::clear_use_physics() {
+  _impl_.use_physics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Object_ObjectPhysicsSettings::_internal_use_physics() const {
+  return _impl_.use_physics_;
+}
+inline bool Object_ObjectPhysicsSettings::use_physics() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.use_physics)
+  return _internal_use_physics();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_use_physics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.use_physics_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_use_physics(bool value) {
+  _internal_set_use_physics(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.use_physics)
+}
+
+// optional bool phy_sensor = 2 [(.buffers.gmx) = "PhysicsObjectSensor", (.buffers.yyp) = "physicsSensor"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_sensor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_sensor() const {
+  return _internal_has_phy_sensor();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_sensor() {
+  _impl_.phy_sensor_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Object_ObjectPhysicsSettings::_internal_phy_sensor() const {
+  return _impl_.phy_sensor_;
+}
+inline bool Object_ObjectPhysicsSettings::phy_sensor() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_sensor)
+  return _internal_phy_sensor();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_sensor(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.phy_sensor_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_sensor(bool value) {
+  _internal_set_phy_sensor(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_sensor)
+}
+
+// optional .buffers.resources.Object.PhysicsShape phy_shape_type = 3 [(.buffers.gmx) = "PhysicsObjectShape", (.buffers.yyp) = "physicsShape"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_shape_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_shape_type() const {
+  return _internal_has_phy_shape_type();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_shape_type() {
+  _impl_.phy_shape_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::buffers::resources::Object_PhysicsShape Object_ObjectPhysicsSettings::_internal_phy_shape_type() const {
+  return static_cast< ::buffers::resources::Object_PhysicsShape >(_impl_.phy_shape_type_);
+}
+inline ::buffers::resources::Object_PhysicsShape Object_ObjectPhysicsSettings::phy_shape_type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_shape_type)
+  return _internal_phy_shape_type();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_shape_type(::buffers::resources::Object_PhysicsShape value) {
+  assert(::buffers::resources::Object_PhysicsShape_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.phy_shape_type_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_shape_type(::buffers::resources::Object_PhysicsShape value) {
+  _internal_set_phy_shape_type(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_shape_type)
+}
+
+// optional double phy_density = 4 [(.buffers.gmx) = "PhysicsObjectDensity", (.buffers.yyp) = "physicsDensity"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_density() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_density() const {
+  return _internal_has_phy_density();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_density() {
+  _impl_.phy_density_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Object_ObjectPhysicsSettings::_internal_phy_density() const {
+  return _impl_.phy_density_;
+}
+inline double Object_ObjectPhysicsSettings::phy_density() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_density)
+  return _internal_phy_density();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_density(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.phy_density_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_density(double value) {
+  _internal_set_phy_density(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_density)
+}
+
+// optional double phy_restitution = 5 [(.buffers.gmx) = "PhysicsObjectRestitution", (.buffers.yyp) = "physicsRestitution"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_restitution() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_restitution() const {
+  return _internal_has_phy_restitution();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_restitution() {
+  _impl_.phy_restitution_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Object_ObjectPhysicsSettings::_internal_phy_restitution() const {
+  return _impl_.phy_restitution_;
+}
+inline double Object_ObjectPhysicsSettings::phy_restitution() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_restitution)
+  return _internal_phy_restitution();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_restitution(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.phy_restitution_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_restitution(double value) {
+  _internal_set_phy_restitution(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_restitution)
+}
+
+// optional int32 phy_group = 6 [(.buffers.gmx) = "PhysicsObjectGroup", (.buffers.yyp) = "physicsGroup"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_group() const {
+  return _internal_has_phy_group();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_group() {
+  _impl_.phy_group_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Object_ObjectPhysicsSettings::_internal_phy_group() const {
+  return _impl_.phy_group_;
+}
+inline int32_t Object_ObjectPhysicsSettings::phy_group() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_group)
+  return _internal_phy_group();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_group(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.phy_group_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_group(int32_t value) {
+  _internal_set_phy_group(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_group)
+}
+
+// optional double phy_linear_damping = 7 [(.buffers.gmx) = "PhysicsObjectLinearDamping", (.buffers.yyp) = "physicsLinearDamping"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_linear_damping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_linear_damping() const {
+  return _internal_has_phy_linear_damping();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_linear_damping() {
+  _impl_.phy_linear_damping_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Object_ObjectPhysicsSettings::_internal_phy_linear_damping() const {
+  return _impl_.phy_linear_damping_;
+}
+inline double Object_ObjectPhysicsSettings::phy_linear_damping() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_linear_damping)
+  return _internal_phy_linear_damping();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_linear_damping(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.phy_linear_damping_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_linear_damping(double value) {
+  _internal_set_phy_linear_damping(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_linear_damping)
+}
+
+// optional double phy_angular_damping = 8 [(.buffers.gmx) = "PhysicsObjectAngularDamping", (.buffers.yyp) = "physicsAngularDamping"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_angular_damping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_angular_damping() const {
+  return _internal_has_phy_angular_damping();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_angular_damping() {
+  _impl_.phy_angular_damping_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Object_ObjectPhysicsSettings::_internal_phy_angular_damping() const {
+  return _impl_.phy_angular_damping_;
+}
+inline double Object_ObjectPhysicsSettings::phy_angular_damping() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_angular_damping)
+  return _internal_phy_angular_damping();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_angular_damping(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.phy_angular_damping_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_angular_damping(double value) {
+  _internal_set_phy_angular_damping(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_angular_damping)
+}
+
+// optional double phy_friction = 9 [(.buffers.gmx) = "PhysicsObjectFriction", (.buffers.yyp) = "physicsFriction"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_friction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_friction() const {
+  return _internal_has_phy_friction();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_friction() {
+  _impl_.phy_friction_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Object_ObjectPhysicsSettings::_internal_phy_friction() const {
+  return _impl_.phy_friction_;
+}
+inline double Object_ObjectPhysicsSettings::phy_friction() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_friction)
+  return _internal_phy_friction();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_friction(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.phy_friction_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_friction(double value) {
+  _internal_set_phy_friction(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_friction)
+}
+
+// optional bool phy_awake = 10 [(.buffers.gmx) = "PhysicsObjectAwake", (.buffers.yyp) = "physicsAwake"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_awake() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_awake() const {
+  return _internal_has_phy_awake();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_awake() {
+  _impl_.phy_awake_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool Object_ObjectPhysicsSettings::_internal_phy_awake() const {
+  return _impl_.phy_awake_;
+}
+inline bool Object_ObjectPhysicsSettings::phy_awake() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_awake)
+  return _internal_phy_awake();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_awake(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.phy_awake_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_awake(bool value) {
+  _internal_set_phy_awake(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_awake)
+}
+
+// optional bool phy_kinematic = 11 [(.buffers.gmx) = "PhysicsObjectKinematic", (.buffers.yyp) = "physicsKinematic"];
+inline bool Object_ObjectPhysicsSettings::_internal_has_phy_kinematic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Object_ObjectPhysicsSettings::has_phy_kinematic() const {
+  return _internal_has_phy_kinematic();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_kinematic() {
+  _impl_.phy_kinematic_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool Object_ObjectPhysicsSettings::_internal_phy_kinematic() const {
+  return _impl_.phy_kinematic_;
+}
+inline bool Object_ObjectPhysicsSettings::phy_kinematic() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_kinematic)
+  return _internal_phy_kinematic();
+}
+inline void Object_ObjectPhysicsSettings::_internal_set_phy_kinematic(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.phy_kinematic_ = value;
+}
+inline void Object_ObjectPhysicsSettings::set_phy_kinematic(bool value) {
+  _internal_set_phy_kinematic(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.ObjectPhysicsSettings.phy_kinematic)
+}
+
+// repeated .buffers.resources.Object.PhysicsShapePoint phy_shape = 12 [(.buffers.gmx) = "PhysicsShapePoints/point", (.buffers.yyp) = "physicsShapePoints"];
+inline int Object_ObjectPhysicsSettings::_internal_phy_shape_size() const {
+  return _impl_.phy_shape_.size();
+}
+inline int Object_ObjectPhysicsSettings::phy_shape_size() const {
+  return _internal_phy_shape_size();
+}
+inline void Object_ObjectPhysicsSettings::clear_phy_shape() {
+  _impl_.phy_shape_.Clear();
+}
+inline ::buffers::resources::Object_PhysicsShapePoint* Object_ObjectPhysicsSettings::mutable_phy_shape(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.ObjectPhysicsSettings.phy_shape)
+  return _impl_.phy_shape_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Object_PhysicsShapePoint >*
+Object_ObjectPhysicsSettings::mutable_phy_shape() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Object.ObjectPhysicsSettings.phy_shape)
+  return &_impl_.phy_shape_;
+}
+inline const ::buffers::resources::Object_PhysicsShapePoint& Object_ObjectPhysicsSettings::_internal_phy_shape(int index) const {
+  return _impl_.phy_shape_.Get(index);
+}
+inline const ::buffers::resources::Object_PhysicsShapePoint& Object_ObjectPhysicsSettings::phy_shape(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.ObjectPhysicsSettings.phy_shape)
+  return _internal_phy_shape(index);
+}
+inline ::buffers::resources::Object_PhysicsShapePoint* Object_ObjectPhysicsSettings::_internal_add_phy_shape() {
+  return _impl_.phy_shape_.Add();
+}
+inline ::buffers::resources::Object_PhysicsShapePoint* Object_ObjectPhysicsSettings::add_phy_shape() {
+  ::buffers::resources::Object_PhysicsShapePoint* _add = _internal_add_phy_shape();
+  // @@protoc_insertion_point(field_add:buffers.resources.Object.ObjectPhysicsSettings.phy_shape)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Object_PhysicsShapePoint >&
+Object_ObjectPhysicsSettings::phy_shape() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Object.ObjectPhysicsSettings.phy_shape)
+  return _impl_.phy_shape_;
+}
+
+// -------------------------------------------------------------------
+
+// Object
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Object::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Object::has_id() const {
+  return _internal_has_id();
+}
+inline void Object::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Object::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Object::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.id)
+  return _internal_id();
+}
+inline void Object::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void Object::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.id)
+}
+
+// optional string parent_name = 3 [(.buffers.gmx) = "parentName", (.buffers.yyp_id) = "parentObjectId"];
+inline bool Object::_internal_has_parent_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Object::has_parent_name() const {
+  return _internal_has_parent_name();
+}
+inline void Object::clear_parent_name() {
+  _impl_.parent_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Object::parent_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.parent_name)
+  return _internal_parent_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Object::set_parent_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.parent_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.parent_name)
+}
+inline std::string* Object::mutable_parent_name() {
+  std::string* _s = _internal_mutable_parent_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.parent_name)
+  return _s;
+}
+inline const std::string& Object::_internal_parent_name() const {
+  return _impl_.parent_name_.Get();
+}
+inline void Object::_internal_set_parent_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.parent_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Object::_internal_mutable_parent_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.parent_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Object::release_parent_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Object.parent_name)
+  if (!_internal_has_parent_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.parent_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_name_.IsDefault()) {
+    _impl_.parent_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Object::set_allocated_parent_name(std::string* parent_name) {
+  if (parent_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.parent_name_.SetAllocated(parent_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_name_.IsDefault()) {
+    _impl_.parent_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Object.parent_name)
+}
+
+// optional string sprite_name = 4 [(.buffers.gmx) = "spriteName", (.buffers.yyp_id) = "spriteId"];
+inline bool Object::_internal_has_sprite_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Object::has_sprite_name() const {
+  return _internal_has_sprite_name();
+}
+inline void Object::clear_sprite_name() {
+  _impl_.sprite_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Object::sprite_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.sprite_name)
+  return _internal_sprite_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Object::set_sprite_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.sprite_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.sprite_name)
+}
+inline std::string* Object::mutable_sprite_name() {
+  std::string* _s = _internal_mutable_sprite_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.sprite_name)
+  return _s;
+}
+inline const std::string& Object::_internal_sprite_name() const {
+  return _impl_.sprite_name_.Get();
+}
+inline void Object::_internal_set_sprite_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sprite_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Object::_internal_mutable_sprite_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.sprite_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Object::release_sprite_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Object.sprite_name)
+  if (!_internal_has_sprite_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.sprite_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sprite_name_.IsDefault()) {
+    _impl_.sprite_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Object::set_allocated_sprite_name(std::string* sprite_name) {
+  if (sprite_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.sprite_name_.SetAllocated(sprite_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sprite_name_.IsDefault()) {
+    _impl_.sprite_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Object.sprite_name)
+}
+
+// optional string mask_name = 5 [(.buffers.gmx) = "maskName", (.buffers.yyp_id) = "maskSpriteId"];
+inline bool Object::_internal_has_mask_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Object::has_mask_name() const {
+  return _internal_has_mask_name();
+}
+inline void Object::clear_mask_name() {
+  _impl_.mask_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Object::mask_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.mask_name)
+  return _internal_mask_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Object::set_mask_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.mask_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.mask_name)
+}
+inline std::string* Object::mutable_mask_name() {
+  std::string* _s = _internal_mutable_mask_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.mask_name)
+  return _s;
+}
+inline const std::string& Object::_internal_mask_name() const {
+  return _impl_.mask_name_.Get();
+}
+inline void Object::_internal_set_mask_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.mask_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Object::_internal_mutable_mask_name() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.mask_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Object::release_mask_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Object.mask_name)
+  if (!_internal_has_mask_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.mask_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mask_name_.IsDefault()) {
+    _impl_.mask_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Object::set_allocated_mask_name(std::string* mask_name) {
+  if (mask_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.mask_name_.SetAllocated(mask_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mask_name_.IsDefault()) {
+    _impl_.mask_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Object.mask_name)
+}
+
+// optional int32 depth = 6 [(.buffers.yyp) = "YYP_DEPRECATED"];
+inline bool Object::_internal_has_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Object::has_depth() const {
+  return _internal_has_depth();
+}
+inline void Object::clear_depth() {
+  _impl_.depth_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Object::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline int32_t Object::depth() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.depth)
+  return _internal_depth();
+}
+inline void Object::_internal_set_depth(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.depth_ = value;
+}
+inline void Object::set_depth(int32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.depth)
+}
+
+// optional bool solid = 7;
+inline bool Object::_internal_has_solid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Object::has_solid() const {
+  return _internal_has_solid();
+}
+inline void Object::clear_solid() {
+  _impl_.solid_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Object::_internal_solid() const {
+  return _impl_.solid_;
+}
+inline bool Object::solid() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.solid)
+  return _internal_solid();
+}
+inline void Object::_internal_set_solid(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.solid_ = value;
+}
+inline void Object::set_solid(bool value) {
+  _internal_set_solid(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.solid)
+}
+
+// optional bool visible = 8;
+inline bool Object::_internal_has_visible() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Object::has_visible() const {
+  return _internal_has_visible();
+}
+inline void Object::clear_visible() {
+  _impl_.visible_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Object::_internal_visible() const {
+  return _impl_.visible_;
+}
+inline bool Object::visible() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.visible)
+  return _internal_visible();
+}
+inline void Object::_internal_set_visible(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.visible_ = value;
+}
+inline void Object::set_visible(bool value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.visible)
+}
+
+// optional bool persistent = 9;
+inline bool Object::_internal_has_persistent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Object::has_persistent() const {
+  return _internal_has_persistent();
+}
+inline void Object::clear_persistent() {
+  _impl_.persistent_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Object::_internal_persistent() const {
+  return _impl_.persistent_;
+}
+inline bool Object::persistent() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.persistent)
+  return _internal_persistent();
+}
+inline void Object::_internal_set_persistent(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.persistent_ = value;
+}
+inline void Object::set_persistent(bool value) {
+  _internal_set_persistent(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Object.persistent)
+}
+
+// repeated .buffers.resources.Event events = 10 [(.buffers.gmx) = "events/event", (.buffers.yyp) = "eventList"];
+inline int Object::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int Object::events_size() const {
+  return _internal_events_size();
+}
+inline ::buffers::resources::Event* Object::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Event >*
+Object::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Object.events)
+  return &_impl_.events_;
+}
+inline const ::buffers::resources::Event& Object::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::buffers::resources::Event& Object::events(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.events)
+  return _internal_events(index);
+}
+inline ::buffers::resources::Event* Object::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::buffers::resources::Event* Object::add_events() {
+  ::buffers::resources::Event* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:buffers.resources.Object.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Event >&
+Object::events() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Object.events)
+  return _impl_.events_;
+}
+
+// optional .buffers.resources.Object.ObjectPhysicsSettings physics_settings = 11 [(.buffers.gmx) = "EGM_NESTED"];
+inline bool Object::_internal_has_physics_settings() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.physics_settings_ != nullptr);
+  return value;
+}
+inline bool Object::has_physics_settings() const {
+  return _internal_has_physics_settings();
+}
+inline void Object::clear_physics_settings() {
+  if (_impl_.physics_settings_ != nullptr) _impl_.physics_settings_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::buffers::resources::Object_ObjectPhysicsSettings& Object::_internal_physics_settings() const {
+  const ::buffers::resources::Object_ObjectPhysicsSettings* p = _impl_.physics_settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::resources::Object_ObjectPhysicsSettings&>(
+      ::buffers::resources::_Object_ObjectPhysicsSettings_default_instance_);
+}
+inline const ::buffers::resources::Object_ObjectPhysicsSettings& Object::physics_settings() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Object.physics_settings)
+  return _internal_physics_settings();
+}
+inline void Object::unsafe_arena_set_allocated_physics_settings(
+    ::buffers::resources::Object_ObjectPhysicsSettings* physics_settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physics_settings_);
+  }
+  _impl_.physics_settings_ = physics_settings;
+  if (physics_settings) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.resources.Object.physics_settings)
+}
+inline ::buffers::resources::Object_ObjectPhysicsSettings* Object::release_physics_settings() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::buffers::resources::Object_ObjectPhysicsSettings* temp = _impl_.physics_settings_;
+  _impl_.physics_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::resources::Object_ObjectPhysicsSettings* Object::unsafe_arena_release_physics_settings() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Object.physics_settings)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::buffers::resources::Object_ObjectPhysicsSettings* temp = _impl_.physics_settings_;
+  _impl_.physics_settings_ = nullptr;
+  return temp;
+}
+inline ::buffers::resources::Object_ObjectPhysicsSettings* Object::_internal_mutable_physics_settings() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.physics_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::resources::Object_ObjectPhysicsSettings>(GetArenaForAllocation());
+    _impl_.physics_settings_ = p;
+  }
+  return _impl_.physics_settings_;
+}
+inline ::buffers::resources::Object_ObjectPhysicsSettings* Object::mutable_physics_settings() {
+  ::buffers::resources::Object_ObjectPhysicsSettings* _msg = _internal_mutable_physics_settings();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Object.physics_settings)
+  return _msg;
+}
+inline void Object::set_allocated_physics_settings(::buffers::resources::Object_ObjectPhysicsSettings* physics_settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.physics_settings_;
+  }
+  if (physics_settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(physics_settings);
+    if (message_arena != submessage_arena) {
+      physics_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, physics_settings, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.physics_settings_ = physics_settings;
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Object.physics_settings)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::resources::Object_PhysicsShape> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Object_PhysicsShape>() {
+  return ::buffers::resources::Object_PhysicsShape_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fObject_2eproto
@@ -0,0 +1,921 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Path.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fPath_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fPath_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fPath_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fPath_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fPath_2eproto;
+namespace buffers {
+namespace resources {
+class Path;
+struct PathDefaultTypeInternal;
+extern PathDefaultTypeInternal _Path_default_instance_;
+class Path_Point;
+struct Path_PointDefaultTypeInternal;
+extern Path_PointDefaultTypeInternal _Path_Point_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Path* Arena::CreateMaybeMessage<::buffers::resources::Path>(Arena*);
+template<> ::buffers::resources::Path_Point* Arena::CreateMaybeMessage<::buffers::resources::Path_Point>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Path_Point final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Path.Point) */ {
+ public:
+  inline Path_Point() : Path_Point(nullptr) {}
+  ~Path_Point() override;
+  explicit PROTOBUF_CONSTEXPR Path_Point(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Path_Point(const Path_Point& from);
+  Path_Point(Path_Point&& from) noexcept
+    : Path_Point() {
+    *this = ::std::move(from);
+  }
+
+  inline Path_Point& operator=(const Path_Point& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Path_Point& operator=(Path_Point&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Path_Point& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Path_Point* internal_default_instance() {
+    return reinterpret_cast<const Path_Point*>(
+               &_Path_Point_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Path_Point& a, Path_Point& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Path_Point* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Path_Point* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Path_Point* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Path_Point>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Path_Point& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Path_Point& from) {
+    Path_Point::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Path_Point* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Path.Point";
+  }
+  protected:
+  explicit Path_Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kSpeedFieldNumber = 3,
+  };
+  // optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional int32 speed = 3 [(.buffers.gmx) = "GMX_SPLIT/2"];
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
+  void clear_speed();
+  int32_t speed() const;
+  void set_speed(int32_t value);
+  private:
+  int32_t _internal_speed() const;
+  void _internal_set_speed(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Path.Point)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    int32_t speed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fPath_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Path final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Path) */ {
+ public:
+  inline Path() : Path(nullptr) {}
+  ~Path() override;
+  explicit PROTOBUF_CONSTEXPR Path(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Path(const Path& from);
+  Path(Path&& from) noexcept
+    : Path() {
+    *this = ::std::move(from);
+  }
+
+  inline Path& operator=(const Path& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Path& operator=(Path&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Path& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Path* internal_default_instance() {
+    return reinterpret_cast<const Path*>(
+               &_Path_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Path& a, Path& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Path* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Path* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Path* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Path>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Path& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Path& from) {
+    Path::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Path* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Path";
+  }
+  protected:
+  explicit Path(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Path_Point Point;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPointsFieldNumber = 9,
+    kBackgroundRoomNameFieldNumber = 3,
+    kIdFieldNumber = 2,
+    kHsnapFieldNumber = 4,
+    kVsnapFieldNumber = 5,
+    kSmoothFieldNumber = 6,
+    kClosedFieldNumber = 7,
+    kPrecisionFieldNumber = 8,
+  };
+  // repeated .buffers.resources.Path.Point points = 9 [(.buffers.gmx) = "points/point"];
+  int points_size() const;
+  private:
+  int _internal_points_size() const;
+  public:
+  void clear_points();
+  ::buffers::resources::Path_Point* mutable_points(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Path_Point >*
+      mutable_points();
+  private:
+  const ::buffers::resources::Path_Point& _internal_points(int index) const;
+  ::buffers::resources::Path_Point* _internal_add_points();
+  public:
+  const ::buffers::resources::Path_Point& points(int index) const;
+  ::buffers::resources::Path_Point* add_points();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Path_Point >&
+      points() const;
+
+  // optional string background_room_name = 3 [(.buffers.gmx_id) = "backroom"];
+  bool has_background_room_name() const;
+  private:
+  bool _internal_has_background_room_name() const;
+  public:
+  void clear_background_room_name();
+  const std::string& background_room_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_background_room_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_background_room_name();
+  PROTOBUF_NODISCARD std::string* release_background_room_name();
+  void set_allocated_background_room_name(std::string* background_room_name);
+  private:
+  const std::string& _internal_background_room_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_background_room_name(const std::string& value);
+  std::string* _internal_mutable_background_room_name();
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 hsnap = 4;
+  bool has_hsnap() const;
+  private:
+  bool _internal_has_hsnap() const;
+  public:
+  void clear_hsnap();
+  int32_t hsnap() const;
+  void set_hsnap(int32_t value);
+  private:
+  int32_t _internal_hsnap() const;
+  void _internal_set_hsnap(int32_t value);
+  public:
+
+  // optional int32 vsnap = 5;
+  bool has_vsnap() const;
+  private:
+  bool _internal_has_vsnap() const;
+  public:
+  void clear_vsnap();
+  int32_t vsnap() const;
+  void set_vsnap(int32_t value);
+  private:
+  int32_t _internal_vsnap() const;
+  void _internal_set_vsnap(int32_t value);
+  public:
+
+  // optional bool smooth = 6 [(.buffers.gmx) = "kind"];
+  bool has_smooth() const;
+  private:
+  bool _internal_has_smooth() const;
+  public:
+  void clear_smooth();
+  bool smooth() const;
+  void set_smooth(bool value);
+  private:
+  bool _internal_smooth() const;
+  void _internal_set_smooth(bool value);
+  public:
+
+  // optional bool closed = 7;
+  bool has_closed() const;
+  private:
+  bool _internal_has_closed() const;
+  public:
+  void clear_closed();
+  bool closed() const;
+  void set_closed(bool value);
+  private:
+  bool _internal_closed() const;
+  void _internal_set_closed(bool value);
+  public:
+
+  // optional int32 precision = 8;
+  bool has_precision() const;
+  private:
+  bool _internal_has_precision() const;
+  public:
+  void clear_precision();
+  int32_t precision() const;
+  void set_precision(int32_t value);
+  private:
+  int32_t _internal_precision() const;
+  void _internal_set_precision(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Path)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Path_Point > points_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr background_room_name_;
+    int32_t id_;
+    int32_t hsnap_;
+    int32_t vsnap_;
+    bool smooth_;
+    bool closed_;
+    int32_t precision_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fPath_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Path_Point
+
+// optional int32 x = 1 [(.buffers.gmx) = "GMX_SPLIT/0"];
+inline bool Path_Point::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Path_Point::has_x() const {
+  return _internal_has_x();
+}
+inline void Path_Point::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Path_Point::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Path_Point::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.Point.x)
+  return _internal_x();
+}
+inline void Path_Point::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void Path_Point::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.Point.x)
+}
+
+// optional int32 y = 2 [(.buffers.gmx) = "GMX_SPLIT/1"];
+inline bool Path_Point::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Path_Point::has_y() const {
+  return _internal_has_y();
+}
+inline void Path_Point::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Path_Point::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Path_Point::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.Point.y)
+  return _internal_y();
+}
+inline void Path_Point::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void Path_Point::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.Point.y)
+}
+
+// optional int32 speed = 3 [(.buffers.gmx) = "GMX_SPLIT/2"];
+inline bool Path_Point::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Path_Point::has_speed() const {
+  return _internal_has_speed();
+}
+inline void Path_Point::clear_speed() {
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Path_Point::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline int32_t Path_Point::speed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.Point.speed)
+  return _internal_speed();
+}
+inline void Path_Point::_internal_set_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.speed_ = value;
+}
+inline void Path_Point::set_speed(int32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.Point.speed)
+}
+
+// -------------------------------------------------------------------
+
+// Path
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Path::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Path::has_id() const {
+  return _internal_has_id();
+}
+inline void Path::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Path::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Path::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.id)
+  return _internal_id();
+}
+inline void Path::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void Path::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.id)
+}
+
+// optional string background_room_name = 3 [(.buffers.gmx_id) = "backroom"];
+inline bool Path::_internal_has_background_room_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Path::has_background_room_name() const {
+  return _internal_has_background_room_name();
+}
+inline void Path::clear_background_room_name() {
+  _impl_.background_room_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Path::background_room_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.background_room_name)
+  return _internal_background_room_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Path::set_background_room_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.background_room_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.background_room_name)
+}
+inline std::string* Path::mutable_background_room_name() {
+  std::string* _s = _internal_mutable_background_room_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Path.background_room_name)
+  return _s;
+}
+inline const std::string& Path::_internal_background_room_name() const {
+  return _impl_.background_room_name_.Get();
+}
+inline void Path::_internal_set_background_room_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.background_room_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Path::_internal_mutable_background_room_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.background_room_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Path::release_background_room_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Path.background_room_name)
+  if (!_internal_has_background_room_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.background_room_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_room_name_.IsDefault()) {
+    _impl_.background_room_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Path::set_allocated_background_room_name(std::string* background_room_name) {
+  if (background_room_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.background_room_name_.SetAllocated(background_room_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_room_name_.IsDefault()) {
+    _impl_.background_room_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Path.background_room_name)
+}
+
+// optional int32 hsnap = 4;
+inline bool Path::_internal_has_hsnap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Path::has_hsnap() const {
+  return _internal_has_hsnap();
+}
+inline void Path::clear_hsnap() {
+  _impl_.hsnap_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Path::_internal_hsnap() const {
+  return _impl_.hsnap_;
+}
+inline int32_t Path::hsnap() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.hsnap)
+  return _internal_hsnap();
+}
+inline void Path::_internal_set_hsnap(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hsnap_ = value;
+}
+inline void Path::set_hsnap(int32_t value) {
+  _internal_set_hsnap(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.hsnap)
+}
+
+// optional int32 vsnap = 5;
+inline bool Path::_internal_has_vsnap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Path::has_vsnap() const {
+  return _internal_has_vsnap();
+}
+inline void Path::clear_vsnap() {
+  _impl_.vsnap_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Path::_internal_vsnap() const {
+  return _impl_.vsnap_;
+}
+inline int32_t Path::vsnap() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.vsnap)
+  return _internal_vsnap();
+}
+inline void Path::_internal_set_vsnap(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.vsnap_ = value;
+}
+inline void Path::set_vsnap(int32_t value) {
+  _internal_set_vsnap(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.vsnap)
+}
+
+// optional bool smooth = 6 [(.buffers.gmx) = "kind"];
+inline bool Path::_internal_has_smooth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Path::has_smooth() const {
+  return _internal_has_smooth();
+}
+inline void Path::clear_smooth() {
+  _impl_.smooth_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Path::_internal_smooth() const {
+  return _impl_.smooth_;
+}
+inline bool Path::smooth() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.smooth)
+  return _internal_smooth();
+}
+inline void Path::_internal_set_smooth(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.smooth_ = value;
+}
+inline void Path::set_smooth(bool value) {
+  _internal_set_smooth(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.smooth)
+}
+
+// optional bool closed = 7;
+inline bool Path::_internal_has_closed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Path::has_closed() const {
+  return _internal_has_closed();
+}
+inline void Path::clear_closed() {
+  _impl_.closed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Path::_internal_closed() const {
+  return _impl_.closed_;
+}
+inline bool Path::closed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.closed)
+  return _internal_closed();
+}
+inline void Path::_internal_set_closed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.closed_ = value;
+}
+inline void Path::set_closed(bool value) {
+  _internal_set_closed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.closed)
+}
+
+// optional int32 precision = 8;
+inline bool Path::_internal_has_precision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Path::has_precision() const {
+  return _internal_has_precision();
+}
+inline void Path::clear_precision() {
+  _impl_.precision_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Path::_internal_precision() const {
+  return _impl_.precision_;
+}
+inline int32_t Path::precision() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.precision)
+  return _internal_precision();
+}
+inline void Path::_internal_set_precision(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.precision_ = value;
+}
+inline void Path::set_precision(int32_t value) {
+  _internal_set_precision(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Path.precision)
+}
+
+// repeated .buffers.resources.Path.Point points = 9 [(.buffers.gmx) = "points/point"];
+inline int Path::_internal_points_size() const {
+  return _impl_.points_.size();
+}
+inline int Path::points_size() const {
+  return _internal_points_size();
+}
+inline void Path::clear_points() {
+  _impl_.points_.Clear();
+}
+inline ::buffers::resources::Path_Point* Path::mutable_points(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Path.points)
+  return _impl_.points_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Path_Point >*
+Path::mutable_points() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Path.points)
+  return &_impl_.points_;
+}
+inline const ::buffers::resources::Path_Point& Path::_internal_points(int index) const {
+  return _impl_.points_.Get(index);
+}
+inline const ::buffers::resources::Path_Point& Path::points(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Path.points)
+  return _internal_points(index);
+}
+inline ::buffers::resources::Path_Point* Path::_internal_add_points() {
+  return _impl_.points_.Add();
+}
+inline ::buffers::resources::Path_Point* Path::add_points() {
+  ::buffers::resources::Path_Point* _add = _internal_add_points();
+  // @@protoc_insertion_point(field_add:buffers.resources.Path.points)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Path_Point >&
+Path::points() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Path.points)
+  return _impl_.points_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fPath_2eproto
@@ -0,0 +1,4132 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Room.proto
+
+#include "resources/Room.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Room_Background::Room_Background(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.background_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.visible_)*/false
+  , /*decltype(_impl_.foreground_)*/false
+  , /*decltype(_impl_.htiled_)*/false
+  , /*decltype(_impl_.vtiled_)*/false
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.stretch_)*/false
+  , /*decltype(_impl_.hspeed_)*/0
+  , /*decltype(_impl_.vspeed_)*/0} {}
+struct Room_BackgroundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Room_BackgroundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Room_BackgroundDefaultTypeInternal() {}
+  union {
+    Room_Background _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Room_BackgroundDefaultTypeInternal _Room_Background_default_instance_;
+PROTOBUF_CONSTEXPR Room_View::Room_View(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.object_following_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.visible_)*/false
+  , /*decltype(_impl_.xview_)*/0
+  , /*decltype(_impl_.yview_)*/0
+  , /*decltype(_impl_.wview_)*/0u
+  , /*decltype(_impl_.hview_)*/0u
+  , /*decltype(_impl_.xport_)*/0
+  , /*decltype(_impl_.yport_)*/0
+  , /*decltype(_impl_.wport_)*/0u
+  , /*decltype(_impl_.hport_)*/0u
+  , /*decltype(_impl_.hborder_)*/0
+  , /*decltype(_impl_.hspeed_)*/0
+  , /*decltype(_impl_.vspeed_)*/0
+  , /*decltype(_impl_.vborder_)*/0} {}
+struct Room_ViewDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Room_ViewDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Room_ViewDefaultTypeInternal() {}
+  union {
+    Room_View _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Room_ViewDefaultTypeInternal _Room_View_default_instance_;
+PROTOBUF_CONSTEXPR Room_Instance::Room_Instance(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.object_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.locked_)*/false
+  , /*decltype(_impl_.xscale_)*/0
+  , /*decltype(_impl_.yscale_)*/0
+  , /*decltype(_impl_.rotation_)*/0
+  , /*decltype(_impl_.color_)*/0} {}
+struct Room_InstanceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Room_InstanceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Room_InstanceDefaultTypeInternal() {}
+  union {
+    Room_Instance _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Room_InstanceDefaultTypeInternal _Room_Instance_default_instance_;
+PROTOBUF_CONSTEXPR Room_Tile::Room_Tile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.background_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.locked_)*/false
+  , /*decltype(_impl_.xoffset_)*/0
+  , /*decltype(_impl_.yoffset_)*/0
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u
+  , /*decltype(_impl_.xscale_)*/0
+  , /*decltype(_impl_.depth_)*/0
+  , /*decltype(_impl_.color_)*/0
+  , /*decltype(_impl_.yscale_)*/0} {}
+struct Room_TileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Room_TileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Room_TileDefaultTypeInternal() {}
+  union {
+    Room_Tile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Room_TileDefaultTypeInternal _Room_Tile_default_instance_;
+PROTOBUF_CONSTEXPR Room_RoomPhysicsSettings::Room_RoomPhysicsSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.use_physics_)*/false
+  , /*decltype(_impl_.phy_world_top_)*/0
+  , /*decltype(_impl_.phy_world_left_)*/0
+  , /*decltype(_impl_.phy_world_right_)*/0
+  , /*decltype(_impl_.phy_world_xgravity_)*/0
+  , /*decltype(_impl_.phy_world_ygravity_)*/0
+  , /*decltype(_impl_.phy_world_pixel_meters_)*/0
+  , /*decltype(_impl_.phy_world_bottom_)*/0} {}
+struct Room_RoomPhysicsSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Room_RoomPhysicsSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Room_RoomPhysicsSettingsDefaultTypeInternal() {}
+  union {
+    Room_RoomPhysicsSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Room_RoomPhysicsSettingsDefaultTypeInternal _Room_RoomPhysicsSettings_default_instance_;
+PROTOBUF_CONSTEXPR Room::Room(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.backgrounds_)*/{}
+  , /*decltype(_impl_.views_)*/{}
+  , /*decltype(_impl_.instances_)*/{}
+  , /*decltype(_impl_.tiles_)*/{}
+  , /*decltype(_impl_.caption_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.physics_settings_)*/nullptr
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u
+  , /*decltype(_impl_.hsnap_)*/0u
+  , /*decltype(_impl_.vsnap_)*/0u
+  , /*decltype(_impl_.color_)*/0
+  , /*decltype(_impl_.isometric_)*/false
+  , /*decltype(_impl_.persistent_)*/false
+  , /*decltype(_impl_.show_color_)*/false
+  , /*decltype(_impl_.enable_views_)*/false
+  , /*decltype(_impl_.clear_view_background_)*/false
+  , /*decltype(_impl_.clear_display_buffer_)*/false
+  , /*decltype(_impl_.speed_)*/0u
+  , /*decltype(_impl_.id_)*/0} {}
+struct RoomDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomDefaultTypeInternal() {}
+  union {
+    Room _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomDefaultTypeInternal _Room_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fRoom_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resources_2fRoom_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fRoom_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fRoom_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.visible_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.foreground_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.background_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.htiled_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.vtiled_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.hspeed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.vspeed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Background, _impl_.stretch_),
+  2,
+  3,
+  0,
+  1,
+  6,
+  4,
+  5,
+  8,
+  9,
+  7,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.visible_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.xview_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.yview_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.wview_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.hview_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.xport_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.yport_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.wport_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.hport_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.hborder_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.vborder_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.hspeed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.vspeed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_View, _impl_.object_following_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  13,
+  11,
+  12,
+  0,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.object_type_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.locked_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.xscale_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.yscale_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.color_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Instance, _impl_.rotation_),
+  0,
+  3,
+  1,
+  4,
+  5,
+  6,
+  2,
+  7,
+  8,
+  10,
+  9,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.background_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.locked_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.xoffset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.yoffset_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.xscale_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.yscale_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_Tile, _impl_.color_),
+  0,
+  2,
+  1,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  11,
+  10,
+  13,
+  12,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.use_physics_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_top_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_left_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_right_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_bottom_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_xgravity_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_ygravity_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room_RoomPhysicsSettings, _impl_.phy_world_pixel_meters_),
+  0,
+  1,
+  2,
+  3,
+  7,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.caption_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.hsnap_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.vsnap_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.isometric_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.speed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.persistent_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.color_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.show_color_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.enable_views_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.clear_view_background_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.clear_display_buffer_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.backgrounds_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.views_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.instances_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.tiles_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Room, _impl_.physics_settings_),
+  15,
+  0,
+  3,
+  4,
+  5,
+  6,
+  8,
+  14,
+  9,
+  7,
+  10,
+  1,
+  11,
+  12,
+  13,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 16, -1, sizeof(::buffers::resources::Room_Background)},
+  { 26, 46, -1, sizeof(::buffers::resources::Room_View)},
+  { 60, 77, -1, sizeof(::buffers::resources::Room_Instance)},
+  { 88, 108, -1, sizeof(::buffers::resources::Room_Tile)},
+  { 122, 136, -1, sizeof(::buffers::resources::Room_RoomPhysicsSettings)},
+  { 144, 170, -1, sizeof(::buffers::resources::Room)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Room_Background_default_instance_._instance,
+  &::buffers::resources::_Room_View_default_instance_._instance,
+  &::buffers::resources::_Room_Instance_default_instance_._instance,
+  &::buffers::resources::_Room_Tile_default_instance_._instance,
+  &::buffers::resources::_Room_RoomPhysicsSettings_default_instance_._instance,
+  &::buffers::resources::_Room_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fRoom_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024resources/Room.proto\022\021buffers.resource"
+  "s\032\roptions.proto\"\270\022\n\004Room\022\036\n\002id\030\035 \001(\005B\022\222"
+  "\265\030\016GMX_DEPRECATED\022\017\n\007caption\030\001 \001(\t\022%\n\005wi"
+  "dth\030\002 \001(\rB\026\242\265\030\022roomSettings/Width\022\'\n\006hei"
+  "ght\030\003 \001(\rB\027\242\265\030\023roomSettings/Height\022\r\n\005hs"
+  "nap\030\004 \001(\r\022\r\n\005vsnap\030\005 \001(\r\022\021\n\tisometric\030\006 "
+  "\001(\010\022\r\n\005speed\030\033 \001(\r\022/\n\npersistent\030\007 \001(\010B\033"
+  "\242\265\030\027roomSettings/persistent\022\031\n\005color\030\010 \001"
+  "(\005B\n\222\265\030\006colour\022\"\n\nshow_color\030\t \001(\010B\016\222\265\030\n"
+  "showcolour\022\014\n\004code\030\n \001(\t\022A\n\014enable_views"
+  "\030\013 \001(\010B+\222\265\030\013enableViews\242\265\030\030viewSettings/"
+  "enableViews\022Z\n\025clear_view_background\030\014 \001"
+  "(\010B;\222\265\030\023clearViewBackground\242\265\030 viewSetti"
+  "ngs/clearViewBackground\022W\n\024clear_display"
+  "_buffer\030\r \001(\010B9\222\265\030\022clearDisplayBuffer\242\265\030"
+  "\037viewSettings/clearDisplayBuffer\022S\n\013back"
+  "grounds\030\017 \003(\0132\".buffers.resources.Room.B"
+  "ackgroundB\032\222\265\030\026backgrounds/background\022D\n"
+  "\005views\030\020 \003(\0132\034.buffers.resources.Room.Vi"
+  "ewB\027\222\265\030\nviews/view\242\265\030\005views\022K\n\tinstances"
+  "\030\021 \003(\0132 .buffers.resources.Room.Instance"
+  "B\026\222\265\030\022instances/instance\022;\n\005tiles\030\022 \003(\0132"
+  "\034.buffers.resources.Room.TileB\016\222\265\030\ntiles"
+  "/tile\022U\n\020physics_settings\030\023 \001(\0132+.buffer"
+  "s.resources.Room.RoomPhysicsSettingsB\016\222\265"
+  "\030\nEGM_NESTED\032\273\001\n\nBackground\022\017\n\007visible\030\001"
+  " \001(\010\022\022\n\nforeground\030\002 \001(\010\022!\n\017background_n"
+  "ame\030\003 \001(\tB\010\222\265\030\004name\022\t\n\001x\030\004 \001(\005\022\t\n\001y\030\005 \001("
+  "\005\022\016\n\006htiled\030\006 \001(\010\022\016\n\006vtiled\030\007 \001(\010\022\016\n\006hsp"
+  "eed\030\010 \001(\001\022\016\n\006vspeed\030\t \001(\001\022\017\n\007stretch\030\n \001"
+  "(\010\032\370\001\n\004View\022\017\n\007visible\030\001 \001(\010\022\r\n\005xview\030\002 "
+  "\001(\005\022\r\n\005yview\030\003 \001(\005\022\r\n\005wview\030\004 \001(\r\022\r\n\005hvi"
+  "ew\030\005 \001(\r\022\r\n\005xport\030\006 \001(\005\022\r\n\005yport\030\007 \001(\005\022\r"
+  "\n\005wport\030\010 \001(\r\022\r\n\005hport\030\t \001(\r\022\017\n\007hborder\030"
+  "\n \001(\005\022\017\n\007vborder\030\013 \001(\005\022\016\n\006hspeed\030\014 \001(\001\022\016"
+  "\n\006vspeed\030\r \001(\001\022%\n\020object_following\030\016 \001(\t"
+  "B\013\222\265\030\007objName\032\347\001\n\010Instance\022\014\n\004name\030\001 \001(\t"
+  "\022\022\n\002id\030\002 \001(\005B\006\200\265\030\240\215\006\022 \n\013object_type\030\003 \001("
+  "\tB\013\222\265\030\007objName\022\t\n\001x\030\004 \001(\005\022\t\n\001y\030\005 \001(\005\022\016\n\006"
+  "locked\030\006 \001(\010\022\014\n\004code\030\007 \001(\t\022\032\n\006xscale\030\010 \001"
+  "(\001B\n\222\265\030\006scaleX\022\032\n\006yscale\030\t \001(\001B\n\222\265\030\006scal"
+  "eY\022\031\n\005color\030\n \001(\005B\n\222\265\030\006colour\022\020\n\010rotatio"
+  "n\030\013 \001(\001\032\265\002\n\004Tile\022\014\n\004name\030\001 \001(\t\022\023\n\002id\030\002 \001"
+  "(\005B\007\200\265\030\200\255\342\004\022#\n\017background_name\030\003 \001(\tB\n\222\265"
+  "\030\006bgName\022\t\n\001x\030\004 \001(\005\022\t\n\001y\030\005 \001(\005\022\016\n\006locked"
+  "\030\006 \001(\010\022\027\n\007xoffset\030\007 \001(\005B\006\222\265\030\002xo\022\027\n\007yoffs"
+  "et\030\010 \001(\005B\006\222\265\030\002yo\022\024\n\005width\030\t \001(\rB\005\222\265\030\001w\022\025"
+  "\n\006height\030\n \001(\rB\005\222\265\030\001h\022\r\n\005depth\030\013 \001(\005\022\032\n\006"
+  "xscale\030\014 \001(\001B\n\222\265\030\006scaleX\022\032\n\006yscale\030\r \001(\001"
+  "B\n\222\265\030\006scaleY\022\031\n\005color\030\016 \001(\005B\n\222\265\030\006colour\032"
+  "\241\003\n\023RoomPhysicsSettings\022%\n\013use_physics\030\023"
+  " \001(\010B\020\222\265\030\014PhysicsWorld\022*\n\rphy_world_top\030"
+  "\024 \001(\005B\023\222\265\030\017PhysicsWorldTop\022,\n\016phy_world_"
+  "left\030\025 \001(\005B\024\222\265\030\020PhysicsWorldLeft\022.\n\017phy_"
+  "world_right\030\026 \001(\005B\025\222\265\030\021PhysicsWorldRight"
+  "\0220\n\020phy_world_bottom\030\027 \001(\005B\026\222\265\030\022PhysicsW"
+  "orldBottom\0224\n\022phy_world_xgravity\030\030 \001(\001B\030"
+  "\222\265\030\024PhysicsWorldGravityX\0224\n\022phy_world_yg"
+  "ravity\030\031 \001(\001B\030\222\265\030\024PhysicsWorldGravityY\022;"
+  "\n\026phy_world_pixel_meters\030\032 \001(\001B\033\222\265\030\027Phys"
+  "icsWorldPixToMeters"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fRoom_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fRoom_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fRoom_2eproto = {
+    false, false, 2419, descriptor_table_protodef_resources_2fRoom_2eproto,
+    "resources/Room.proto",
+    &descriptor_table_resources_2fRoom_2eproto_once, descriptor_table_resources_2fRoom_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_resources_2fRoom_2eproto::offsets,
+    file_level_metadata_resources_2fRoom_2eproto, file_level_enum_descriptors_resources_2fRoom_2eproto,
+    file_level_service_descriptors_resources_2fRoom_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fRoom_2eproto_getter() {
+  return &descriptor_table_resources_2fRoom_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fRoom_2eproto(&descriptor_table_resources_2fRoom_2eproto);
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Room_Background::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room_Background>()._impl_._has_bits_);
+  static void set_has_visible(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_foreground(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_background_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_htiled(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_vtiled(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_hspeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_vspeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_stretch(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+Room_Background::Room_Background(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room.Background)
+}
+Room_Background::Room_Background(const Room_Background& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room_Background* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.background_name_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.visible_){}
+    , decltype(_impl_.foreground_){}
+    , decltype(_impl_.htiled_){}
+    , decltype(_impl_.vtiled_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.stretch_){}
+    , decltype(_impl_.hspeed_){}
+    , decltype(_impl_.vspeed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.background_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_background_name()) {
+    _this->_impl_.background_name_.Set(from._internal_background_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vspeed_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.vspeed_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room.Background)
+}
+
+inline void Room_Background::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.background_name_){}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.visible_){false}
+    , decltype(_impl_.foreground_){false}
+    , decltype(_impl_.htiled_){false}
+    , decltype(_impl_.vtiled_){false}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.stretch_){false}
+    , decltype(_impl_.hspeed_){0}
+    , decltype(_impl_.vspeed_){0}
+  };
+  _impl_.background_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Room_Background::~Room_Background() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room.Background)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room_Background::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.background_name_.Destroy();
+}
+
+void Room_Background::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room_Background::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room.Background)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.background_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.stretch_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.stretch_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.hspeed_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.vspeed_) -
+        reinterpret_cast<char*>(&_impl_.hspeed_)) + sizeof(_impl_.vspeed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room_Background::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool visible = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_visible(&has_bits);
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool foreground = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_foreground(&has_bits);
+          _impl_.foreground_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string background_name = 3 [(.buffers.gmx) = "name"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_background_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Background.background_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 x = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool htiled = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_htiled(&has_bits);
+          _impl_.htiled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool vtiled = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_vtiled(&has_bits);
+          _impl_.vtiled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double hspeed = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_hspeed(&has_bits);
+          _impl_.hspeed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double vspeed = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_vspeed(&has_bits);
+          _impl_.vspeed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool stretch = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_stretch(&has_bits);
+          _impl_.stretch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room_Background::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room.Background)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool visible = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_visible(), target);
+  }
+
+  // optional bool foreground = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_foreground(), target);
+  }
+
+  // optional string background_name = 3 [(.buffers.gmx) = "name"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_background_name().data(), static_cast<int>(this->_internal_background_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Background.background_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_background_name(), target);
+  }
+
+  // optional int32 x = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_y(), target);
+  }
+
+  // optional bool htiled = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_htiled(), target);
+  }
+
+  // optional bool vtiled = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_vtiled(), target);
+  }
+
+  // optional double hspeed = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_hspeed(), target);
+  }
+
+  // optional double vspeed = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_vspeed(), target);
+  }
+
+  // optional bool stretch = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_stretch(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room.Background)
+  return target;
+}
+
+size_t Room_Background::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room.Background)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string background_name = 3 [(.buffers.gmx) = "name"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_background_name());
+    }
+
+    // optional int32 x = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional bool visible = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool foreground = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool htiled = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool vtiled = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 y = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional bool stretch = 10;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional double hspeed = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double vspeed = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room_Background::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room_Background::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room_Background::GetClassData() const { return &_class_data_; }
+
+
+void Room_Background::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room_Background*>(&to_msg);
+  auto& from = static_cast<const Room_Background&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room.Background)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_background_name(from._internal_background_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.visible_ = from._impl_.visible_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.foreground_ = from._impl_.foreground_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.htiled_ = from._impl_.htiled_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.vtiled_ = from._impl_.vtiled_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.stretch_ = from._impl_.stretch_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.hspeed_ = from._impl_.hspeed_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.vspeed_ = from._impl_.vspeed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room_Background::CopyFrom(const Room_Background& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room.Background)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room_Background::IsInitialized() const {
+  return true;
+}
+
+void Room_Background::InternalSwap(Room_Background* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.background_name_, lhs_arena,
+      &other->_impl_.background_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room_Background, _impl_.vspeed_)
+      + sizeof(Room_Background::_impl_.vspeed_)
+      - PROTOBUF_FIELD_OFFSET(Room_Background, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room_Background::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[0]);
+}
+
+// ===================================================================
+
+class Room_View::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room_View>()._impl_._has_bits_);
+  static void set_has_visible(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_xview(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_yview(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_wview(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_hview(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_xport(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_yport(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_wport(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_hport(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_hborder(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_vborder(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_hspeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_vspeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_object_following(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Room_View::Room_View(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room.View)
+}
+Room_View::Room_View(const Room_View& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room_View* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_following_){}
+    , decltype(_impl_.visible_){}
+    , decltype(_impl_.xview_){}
+    , decltype(_impl_.yview_){}
+    , decltype(_impl_.wview_){}
+    , decltype(_impl_.hview_){}
+    , decltype(_impl_.xport_){}
+    , decltype(_impl_.yport_){}
+    , decltype(_impl_.wport_){}
+    , decltype(_impl_.hport_){}
+    , decltype(_impl_.hborder_){}
+    , decltype(_impl_.hspeed_){}
+    , decltype(_impl_.vspeed_){}
+    , decltype(_impl_.vborder_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.object_following_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_following_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_object_following()) {
+    _this->_impl_.object_following_.Set(from._internal_object_following(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.visible_, &from._impl_.visible_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vborder_) -
+    reinterpret_cast<char*>(&_impl_.visible_)) + sizeof(_impl_.vborder_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room.View)
+}
+
+inline void Room_View::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_following_){}
+    , decltype(_impl_.visible_){false}
+    , decltype(_impl_.xview_){0}
+    , decltype(_impl_.yview_){0}
+    , decltype(_impl_.wview_){0u}
+    , decltype(_impl_.hview_){0u}
+    , decltype(_impl_.xport_){0}
+    , decltype(_impl_.yport_){0}
+    , decltype(_impl_.wport_){0u}
+    , decltype(_impl_.hport_){0u}
+    , decltype(_impl_.hborder_){0}
+    , decltype(_impl_.hspeed_){0}
+    , decltype(_impl_.vspeed_){0}
+    , decltype(_impl_.vborder_){0}
+  };
+  _impl_.object_following_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_following_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Room_View::~Room_View() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room.View)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room_View::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.object_following_.Destroy();
+}
+
+void Room_View::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room_View::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room.View)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.object_following_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.visible_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.yport_) -
+        reinterpret_cast<char*>(&_impl_.visible_)) + sizeof(_impl_.yport_));
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    ::memset(&_impl_.wport_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.vborder_) -
+        reinterpret_cast<char*>(&_impl_.wport_)) + sizeof(_impl_.vborder_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room_View::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool visible = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_visible(&has_bits);
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 xview = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_xview(&has_bits);
+          _impl_.xview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 yview = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_yview(&has_bits);
+          _impl_.yview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 wview = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_wview(&has_bits);
+          _impl_.wview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hview = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_hview(&has_bits);
+          _impl_.hview_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 xport = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_xport(&has_bits);
+          _impl_.xport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 yport = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_yport(&has_bits);
+          _impl_.yport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 wport = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_wport(&has_bits);
+          _impl_.wport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hport = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_hport(&has_bits);
+          _impl_.hport_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 hborder = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_hborder(&has_bits);
+          _impl_.hborder_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 vborder = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_vborder(&has_bits);
+          _impl_.vborder_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double hspeed = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_hspeed(&has_bits);
+          _impl_.hspeed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double vspeed = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_vspeed(&has_bits);
+          _impl_.vspeed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string object_following = 14 [(.buffers.gmx) = "objName"];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_object_following();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.View.object_following");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room_View::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room.View)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool visible = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_visible(), target);
+  }
+
+  // optional int32 xview = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_xview(), target);
+  }
+
+  // optional int32 yview = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_yview(), target);
+  }
+
+  // optional uint32 wview = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_wview(), target);
+  }
+
+  // optional uint32 hview = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_hview(), target);
+  }
+
+  // optional int32 xport = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_xport(), target);
+  }
+
+  // optional int32 yport = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_yport(), target);
+  }
+
+  // optional uint32 wport = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_wport(), target);
+  }
+
+  // optional uint32 hport = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_hport(), target);
+  }
+
+  // optional int32 hborder = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_hborder(), target);
+  }
+
+  // optional int32 vborder = 11;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_vborder(), target);
+  }
+
+  // optional double hspeed = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_hspeed(), target);
+  }
+
+  // optional double vspeed = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_vspeed(), target);
+  }
+
+  // optional string object_following = 14 [(.buffers.gmx) = "objName"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_object_following().data(), static_cast<int>(this->_internal_object_following().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.View.object_following");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_object_following(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room.View)
+  return target;
+}
+
+size_t Room_View::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room.View)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string object_following = 14 [(.buffers.gmx) = "objName"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_object_following());
+    }
+
+    // optional bool visible = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 xview = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_xview());
+    }
+
+    // optional int32 yview = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_yview());
+    }
+
+    // optional uint32 wview = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_wview());
+    }
+
+    // optional uint32 hview = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hview());
+    }
+
+    // optional int32 xport = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_xport());
+    }
+
+    // optional int32 yport = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_yport());
+    }
+
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    // optional uint32 wport = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_wport());
+    }
+
+    // optional uint32 hport = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hport());
+    }
+
+    // optional int32 hborder = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hborder());
+    }
+
+    // optional double hspeed = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double vspeed = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 vborder = 11;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vborder());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room_View::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room_View::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room_View::GetClassData() const { return &_class_data_; }
+
+
+void Room_View::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room_View*>(&to_msg);
+  auto& from = static_cast<const Room_View&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room.View)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_object_following(from._internal_object_following());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.visible_ = from._impl_.visible_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.xview_ = from._impl_.xview_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.yview_ = from._impl_.yview_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.wview_ = from._impl_.wview_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.hview_ = from._impl_.hview_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.xport_ = from._impl_.xport_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.yport_ = from._impl_.yport_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.wport_ = from._impl_.wport_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.hport_ = from._impl_.hport_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.hborder_ = from._impl_.hborder_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.hspeed_ = from._impl_.hspeed_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.vspeed_ = from._impl_.vspeed_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.vborder_ = from._impl_.vborder_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room_View::CopyFrom(const Room_View& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room.View)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room_View::IsInitialized() const {
+  return true;
+}
+
+void Room_View::InternalSwap(Room_View* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.object_following_, lhs_arena,
+      &other->_impl_.object_following_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room_View, _impl_.vborder_)
+      + sizeof(Room_View::_impl_.vborder_)
+      - PROTOBUF_FIELD_OFFSET(Room_View, _impl_.visible_)>(
+          reinterpret_cast<char*>(&_impl_.visible_),
+          reinterpret_cast<char*>(&other->_impl_.visible_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room_View::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[1]);
+}
+
+// ===================================================================
+
+class Room_Instance::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room_Instance>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_object_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_locked(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_xscale(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_yscale(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_rotation(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
+
+Room_Instance::Room_Instance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room.Instance)
+}
+Room_Instance::Room_Instance(const Room_Instance& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room_Instance* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.object_type_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.locked_){}
+    , decltype(_impl_.xscale_){}
+    , decltype(_impl_.yscale_){}
+    , decltype(_impl_.rotation_){}
+    , decltype(_impl_.color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.object_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_object_type()) {
+    _this->_impl_.object_type_.Set(from._internal_object_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_code()) {
+    _this->_impl_.code_.Set(from._internal_code(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.color_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.color_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room.Instance)
+}
+
+inline void Room_Instance::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.object_type_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.locked_){false}
+    , decltype(_impl_.xscale_){0}
+    , decltype(_impl_.yscale_){0}
+    , decltype(_impl_.rotation_){0}
+    , decltype(_impl_.color_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.object_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Room_Instance::~Room_Instance() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room.Instance)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room_Instance::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.object_type_.Destroy();
+  _impl_.code_.Destroy();
+}
+
+void Room_Instance::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room_Instance::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room.Instance)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.object_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.code_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.xscale_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.xscale_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.yscale_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.color_) -
+        reinterpret_cast<char*>(&_impl_.yscale_)) + sizeof(_impl_.color_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room_Instance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Instance.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 id = 2 [(.buffers.id_start) = 100000];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string object_type = 3 [(.buffers.gmx) = "objName"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_object_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Instance.object_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 x = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool locked = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_locked(&has_bits);
+          _impl_.locked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string code = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Instance.code");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double xscale = 8 [(.buffers.gmx) = "scaleX"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_xscale(&has_bits);
+          _impl_.xscale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double yscale = 9 [(.buffers.gmx) = "scaleY"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_yscale(&has_bits);
+          _impl_.yscale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 color = 10 [(.buffers.gmx) = "colour"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_color(&has_bits);
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rotation = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_rotation(&has_bits);
+          _impl_.rotation_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room_Instance::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room.Instance)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Instance.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional int32 id = 2 [(.buffers.id_start) = 100000];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional string object_type = 3 [(.buffers.gmx) = "objName"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_object_type().data(), static_cast<int>(this->_internal_object_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Instance.object_type");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_object_type(), target);
+  }
+
+  // optional int32 x = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_y(), target);
+  }
+
+  // optional bool locked = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_locked(), target);
+  }
+
+  // optional string code = 7;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_code().data(), static_cast<int>(this->_internal_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Instance.code");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_code(), target);
+  }
+
+  // optional double xscale = 8 [(.buffers.gmx) = "scaleX"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_xscale(), target);
+  }
+
+  // optional double yscale = 9 [(.buffers.gmx) = "scaleY"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_yscale(), target);
+  }
+
+  // optional int32 color = 10 [(.buffers.gmx) = "colour"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_color(), target);
+  }
+
+  // optional double rotation = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_rotation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room.Instance)
+  return target;
+}
+
+size_t Room_Instance::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room.Instance)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string object_type = 3 [(.buffers.gmx) = "objName"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_object_type());
+    }
+
+    // optional string code = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_code());
+    }
+
+    // optional int32 id = 2 [(.buffers.id_start) = 100000];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 x = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional bool locked = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional double xscale = 8 [(.buffers.gmx) = "scaleX"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional double yscale = 9 [(.buffers.gmx) = "scaleY"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rotation = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 color = 10 [(.buffers.gmx) = "colour"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_color());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room_Instance::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room_Instance::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room_Instance::GetClassData() const { return &_class_data_; }
+
+
+void Room_Instance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room_Instance*>(&to_msg);
+  auto& from = static_cast<const Room_Instance&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room.Instance)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_object_type(from._internal_object_type());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_code(from._internal_code());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.locked_ = from._impl_.locked_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.xscale_ = from._impl_.xscale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.yscale_ = from._impl_.yscale_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.rotation_ = from._impl_.rotation_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room_Instance::CopyFrom(const Room_Instance& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room.Instance)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room_Instance::IsInitialized() const {
+  return true;
+}
+
+void Room_Instance::InternalSwap(Room_Instance* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.object_type_, lhs_arena,
+      &other->_impl_.object_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.code_, lhs_arena,
+      &other->_impl_.code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room_Instance, _impl_.color_)
+      + sizeof(Room_Instance::_impl_.color_)
+      - PROTOBUF_FIELD_OFFSET(Room_Instance, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room_Instance::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[2]);
+}
+
+// ===================================================================
+
+class Room_Tile::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room_Tile>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_background_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_locked(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_xoffset(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_yoffset(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_xscale(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_yscale(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+};
+
+Room_Tile::Room_Tile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room.Tile)
+}
+Room_Tile::Room_Tile(const Room_Tile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room_Tile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.background_name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.locked_){}
+    , decltype(_impl_.xoffset_){}
+    , decltype(_impl_.yoffset_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.xscale_){}
+    , decltype(_impl_.depth_){}
+    , decltype(_impl_.color_){}
+    , decltype(_impl_.yscale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.background_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_background_name()) {
+    _this->_impl_.background_name_.Set(from._internal_background_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yscale_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.yscale_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room.Tile)
+}
+
+inline void Room_Tile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.background_name_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.locked_){false}
+    , decltype(_impl_.xoffset_){0}
+    , decltype(_impl_.yoffset_){0}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+    , decltype(_impl_.xscale_){0}
+    , decltype(_impl_.depth_){0}
+    , decltype(_impl_.color_){0}
+    , decltype(_impl_.yscale_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.background_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Room_Tile::~Room_Tile() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room.Tile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room_Tile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.background_name_.Destroy();
+}
+
+void Room_Tile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room_Tile::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room.Tile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.background_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.yoffset_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.yoffset_));
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    ::memset(&_impl_.width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.yscale_) -
+        reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.yscale_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room_Tile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Tile.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 id = 2 [(.buffers.id_start) = 10000000];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string background_name = 3 [(.buffers.gmx) = "bgName"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_background_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.Tile.background_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 x = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool locked = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_locked(&has_bits);
+          _impl_.locked_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 xoffset = 7 [(.buffers.gmx) = "xo"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_xoffset(&has_bits);
+          _impl_.xoffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 yoffset = 8 [(.buffers.gmx) = "yo"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_yoffset(&has_bits);
+          _impl_.yoffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 width = 9 [(.buffers.gmx) = "w"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 height = 10 [(.buffers.gmx) = "h"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 depth = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_depth(&has_bits);
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double xscale = 12 [(.buffers.gmx) = "scaleX"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_xscale(&has_bits);
+          _impl_.xscale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double yscale = 13 [(.buffers.gmx) = "scaleY"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_yscale(&has_bits);
+          _impl_.yscale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 color = 14 [(.buffers.gmx) = "colour"];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_color(&has_bits);
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room_Tile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room.Tile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Tile.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional int32 id = 2 [(.buffers.id_start) = 10000000];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional string background_name = 3 [(.buffers.gmx) = "bgName"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_background_name().data(), static_cast<int>(this->_internal_background_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.Tile.background_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_background_name(), target);
+  }
+
+  // optional int32 x = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_y(), target);
+  }
+
+  // optional bool locked = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_locked(), target);
+  }
+
+  // optional int32 xoffset = 7 [(.buffers.gmx) = "xo"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_xoffset(), target);
+  }
+
+  // optional int32 yoffset = 8 [(.buffers.gmx) = "yo"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_yoffset(), target);
+  }
+
+  // optional uint32 width = 9 [(.buffers.gmx) = "w"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_width(), target);
+  }
+
+  // optional uint32 height = 10 [(.buffers.gmx) = "h"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_height(), target);
+  }
+
+  // optional int32 depth = 11;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_depth(), target);
+  }
+
+  // optional double xscale = 12 [(.buffers.gmx) = "scaleX"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_xscale(), target);
+  }
+
+  // optional double yscale = 13 [(.buffers.gmx) = "scaleY"];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_yscale(), target);
+  }
+
+  // optional int32 color = 14 [(.buffers.gmx) = "colour"];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room.Tile)
+  return target;
+}
+
+size_t Room_Tile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room.Tile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string background_name = 3 [(.buffers.gmx) = "bgName"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_background_name());
+    }
+
+    // optional int32 id = 2 [(.buffers.id_start) = 10000000];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional int32 x = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional bool locked = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 xoffset = 7 [(.buffers.gmx) = "xo"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_xoffset());
+    }
+
+    // optional int32 yoffset = 8 [(.buffers.gmx) = "yo"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_yoffset());
+    }
+
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    // optional uint32 width = 9 [(.buffers.gmx) = "w"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
+    }
+
+    // optional uint32 height = 10 [(.buffers.gmx) = "h"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_height());
+    }
+
+    // optional double xscale = 12 [(.buffers.gmx) = "scaleX"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 depth = 11;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_depth());
+    }
+
+    // optional int32 color = 14 [(.buffers.gmx) = "colour"];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_color());
+    }
+
+    // optional double yscale = 13 [(.buffers.gmx) = "scaleY"];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room_Tile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room_Tile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room_Tile::GetClassData() const { return &_class_data_; }
+
+
+void Room_Tile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room_Tile*>(&to_msg);
+  auto& from = static_cast<const Room_Tile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room.Tile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_background_name(from._internal_background_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.locked_ = from._impl_.locked_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.xoffset_ = from._impl_.xoffset_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.yoffset_ = from._impl_.yoffset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.xscale_ = from._impl_.xscale_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.depth_ = from._impl_.depth_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.yscale_ = from._impl_.yscale_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room_Tile::CopyFrom(const Room_Tile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room.Tile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room_Tile::IsInitialized() const {
+  return true;
+}
+
+void Room_Tile::InternalSwap(Room_Tile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.background_name_, lhs_arena,
+      &other->_impl_.background_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room_Tile, _impl_.yscale_)
+      + sizeof(Room_Tile::_impl_.yscale_)
+      - PROTOBUF_FIELD_OFFSET(Room_Tile, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room_Tile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[3]);
+}
+
+// ===================================================================
+
+class Room_RoomPhysicsSettings::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room_RoomPhysicsSettings>()._impl_._has_bits_);
+  static void set_has_use_physics(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_phy_world_top(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_phy_world_left(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_phy_world_right(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_phy_world_bottom(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_phy_world_xgravity(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_phy_world_ygravity(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_phy_world_pixel_meters(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+Room_RoomPhysicsSettings::Room_RoomPhysicsSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room.RoomPhysicsSettings)
+}
+Room_RoomPhysicsSettings::Room_RoomPhysicsSettings(const Room_RoomPhysicsSettings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room_RoomPhysicsSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.use_physics_){}
+    , decltype(_impl_.phy_world_top_){}
+    , decltype(_impl_.phy_world_left_){}
+    , decltype(_impl_.phy_world_right_){}
+    , decltype(_impl_.phy_world_xgravity_){}
+    , decltype(_impl_.phy_world_ygravity_){}
+    , decltype(_impl_.phy_world_pixel_meters_){}
+    , decltype(_impl_.phy_world_bottom_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.use_physics_, &from._impl_.use_physics_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.phy_world_bottom_) -
+    reinterpret_cast<char*>(&_impl_.use_physics_)) + sizeof(_impl_.phy_world_bottom_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room.RoomPhysicsSettings)
+}
+
+inline void Room_RoomPhysicsSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.use_physics_){false}
+    , decltype(_impl_.phy_world_top_){0}
+    , decltype(_impl_.phy_world_left_){0}
+    , decltype(_impl_.phy_world_right_){0}
+    , decltype(_impl_.phy_world_xgravity_){0}
+    , decltype(_impl_.phy_world_ygravity_){0}
+    , decltype(_impl_.phy_world_pixel_meters_){0}
+    , decltype(_impl_.phy_world_bottom_){0}
+  };
+}
+
+Room_RoomPhysicsSettings::~Room_RoomPhysicsSettings() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room.RoomPhysicsSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room_RoomPhysicsSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Room_RoomPhysicsSettings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room_RoomPhysicsSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room.RoomPhysicsSettings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.use_physics_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.phy_world_bottom_) -
+        reinterpret_cast<char*>(&_impl_.use_physics_)) + sizeof(_impl_.phy_world_bottom_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room_RoomPhysicsSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool use_physics = 19 [(.buffers.gmx) = "PhysicsWorld"];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_use_physics(&has_bits);
+          _impl_.use_physics_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 phy_world_top = 20 [(.buffers.gmx) = "PhysicsWorldTop"];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_phy_world_top(&has_bits);
+          _impl_.phy_world_top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 phy_world_left = 21 [(.buffers.gmx) = "PhysicsWorldLeft"];
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_phy_world_left(&has_bits);
+          _impl_.phy_world_left_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 phy_world_right = 22 [(.buffers.gmx) = "PhysicsWorldRight"];
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _Internal::set_has_phy_world_right(&has_bits);
+          _impl_.phy_world_right_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 phy_world_bottom = 23 [(.buffers.gmx) = "PhysicsWorldBottom"];
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _Internal::set_has_phy_world_bottom(&has_bits);
+          _impl_.phy_world_bottom_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_world_xgravity = 24 [(.buffers.gmx) = "PhysicsWorldGravityX"];
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 193)) {
+          _Internal::set_has_phy_world_xgravity(&has_bits);
+          _impl_.phy_world_xgravity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_world_ygravity = 25 [(.buffers.gmx) = "PhysicsWorldGravityY"];
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 201)) {
+          _Internal::set_has_phy_world_ygravity(&has_bits);
+          _impl_.phy_world_ygravity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double phy_world_pixel_meters = 26 [(.buffers.gmx) = "PhysicsWorldPixToMeters"];
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
+          _Internal::set_has_phy_world_pixel_meters(&has_bits);
+          _impl_.phy_world_pixel_meters_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room_RoomPhysicsSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room.RoomPhysicsSettings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool use_physics = 19 [(.buffers.gmx) = "PhysicsWorld"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(19, this->_internal_use_physics(), target);
+  }
+
+  // optional int32 phy_world_top = 20 [(.buffers.gmx) = "PhysicsWorldTop"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(20, this->_internal_phy_world_top(), target);
+  }
+
+  // optional int32 phy_world_left = 21 [(.buffers.gmx) = "PhysicsWorldLeft"];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(21, this->_internal_phy_world_left(), target);
+  }
+
+  // optional int32 phy_world_right = 22 [(.buffers.gmx) = "PhysicsWorldRight"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(22, this->_internal_phy_world_right(), target);
+  }
+
+  // optional int32 phy_world_bottom = 23 [(.buffers.gmx) = "PhysicsWorldBottom"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(23, this->_internal_phy_world_bottom(), target);
+  }
+
+  // optional double phy_world_xgravity = 24 [(.buffers.gmx) = "PhysicsWorldGravityX"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(24, this->_internal_phy_world_xgravity(), target);
+  }
+
+  // optional double phy_world_ygravity = 25 [(.buffers.gmx) = "PhysicsWorldGravityY"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(25, this->_internal_phy_world_ygravity(), target);
+  }
+
+  // optional double phy_world_pixel_meters = 26 [(.buffers.gmx) = "PhysicsWorldPixToMeters"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_phy_world_pixel_meters(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room.RoomPhysicsSettings)
+  return target;
+}
+
+size_t Room_RoomPhysicsSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room.RoomPhysicsSettings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bool use_physics = 19 [(.buffers.gmx) = "PhysicsWorld"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 + 1;
+    }
+
+    // optional int32 phy_world_top = 20 [(.buffers.gmx) = "PhysicsWorldTop"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_phy_world_top());
+    }
+
+    // optional int32 phy_world_left = 21 [(.buffers.gmx) = "PhysicsWorldLeft"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_phy_world_left());
+    }
+
+    // optional int32 phy_world_right = 22 [(.buffers.gmx) = "PhysicsWorldRight"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_phy_world_right());
+    }
+
+    // optional double phy_world_xgravity = 24 [(.buffers.gmx) = "PhysicsWorldGravityX"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double phy_world_ygravity = 25 [(.buffers.gmx) = "PhysicsWorldGravityY"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double phy_world_pixel_meters = 26 [(.buffers.gmx) = "PhysicsWorldPixToMeters"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 + 8;
+    }
+
+    // optional int32 phy_world_bottom = 23 [(.buffers.gmx) = "PhysicsWorldBottom"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_phy_world_bottom());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room_RoomPhysicsSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room_RoomPhysicsSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room_RoomPhysicsSettings::GetClassData() const { return &_class_data_; }
+
+
+void Room_RoomPhysicsSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room_RoomPhysicsSettings*>(&to_msg);
+  auto& from = static_cast<const Room_RoomPhysicsSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room.RoomPhysicsSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.use_physics_ = from._impl_.use_physics_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.phy_world_top_ = from._impl_.phy_world_top_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.phy_world_left_ = from._impl_.phy_world_left_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.phy_world_right_ = from._impl_.phy_world_right_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.phy_world_xgravity_ = from._impl_.phy_world_xgravity_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.phy_world_ygravity_ = from._impl_.phy_world_ygravity_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.phy_world_pixel_meters_ = from._impl_.phy_world_pixel_meters_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.phy_world_bottom_ = from._impl_.phy_world_bottom_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room_RoomPhysicsSettings::CopyFrom(const Room_RoomPhysicsSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room.RoomPhysicsSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room_RoomPhysicsSettings::IsInitialized() const {
+  return true;
+}
+
+void Room_RoomPhysicsSettings::InternalSwap(Room_RoomPhysicsSettings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room_RoomPhysicsSettings, _impl_.phy_world_bottom_)
+      + sizeof(Room_RoomPhysicsSettings::_impl_.phy_world_bottom_)
+      - PROTOBUF_FIELD_OFFSET(Room_RoomPhysicsSettings, _impl_.use_physics_)>(
+          reinterpret_cast<char*>(&_impl_.use_physics_),
+          reinterpret_cast<char*>(&other->_impl_.use_physics_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room_RoomPhysicsSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[4]);
+}
+
+// ===================================================================
+
+class Room::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Room>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_caption(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_hsnap(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_vsnap(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_isometric(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_persistent(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_show_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_enable_views(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_clear_view_background(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_clear_display_buffer(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::buffers::resources::Room_RoomPhysicsSettings& physics_settings(const Room* msg);
+  static void set_has_physics_settings(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::buffers::resources::Room_RoomPhysicsSettings&
+Room::_Internal::physics_settings(const Room* msg) {
+  return *msg->_impl_.physics_settings_;
+}
+Room::Room(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Room)
+}
+Room::Room(const Room& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Room* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.backgrounds_){from._impl_.backgrounds_}
+    , decltype(_impl_.views_){from._impl_.views_}
+    , decltype(_impl_.instances_){from._impl_.instances_}
+    , decltype(_impl_.tiles_){from._impl_.tiles_}
+    , decltype(_impl_.caption_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.physics_settings_){nullptr}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.hsnap_){}
+    , decltype(_impl_.vsnap_){}
+    , decltype(_impl_.color_){}
+    , decltype(_impl_.isometric_){}
+    , decltype(_impl_.persistent_){}
+    , decltype(_impl_.show_color_){}
+    , decltype(_impl_.enable_views_){}
+    , decltype(_impl_.clear_view_background_){}
+    , decltype(_impl_.clear_display_buffer_){}
+    , decltype(_impl_.speed_){}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.caption_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.caption_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_caption()) {
+    _this->_impl_.caption_.Set(from._internal_caption(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_code()) {
+    _this->_impl_.code_.Set(from._internal_code(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_physics_settings()) {
+    _this->_impl_.physics_settings_ = new ::buffers::resources::Room_RoomPhysicsSettings(*from._impl_.physics_settings_);
+  }
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.id_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Room)
+}
+
+inline void Room::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.backgrounds_){arena}
+    , decltype(_impl_.views_){arena}
+    , decltype(_impl_.instances_){arena}
+    , decltype(_impl_.tiles_){arena}
+    , decltype(_impl_.caption_){}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.physics_settings_){nullptr}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+    , decltype(_impl_.hsnap_){0u}
+    , decltype(_impl_.vsnap_){0u}
+    , decltype(_impl_.color_){0}
+    , decltype(_impl_.isometric_){false}
+    , decltype(_impl_.persistent_){false}
+    , decltype(_impl_.show_color_){false}
+    , decltype(_impl_.enable_views_){false}
+    , decltype(_impl_.clear_view_background_){false}
+    , decltype(_impl_.clear_display_buffer_){false}
+    , decltype(_impl_.speed_){0u}
+    , decltype(_impl_.id_){0}
+  };
+  _impl_.caption_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.caption_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Room::~Room() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Room)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Room::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.backgrounds_.~RepeatedPtrField();
+  _impl_.views_.~RepeatedPtrField();
+  _impl_.instances_.~RepeatedPtrField();
+  _impl_.tiles_.~RepeatedPtrField();
+  _impl_.caption_.Destroy();
+  _impl_.code_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.physics_settings_;
+}
+
+void Room::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Room::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Room)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.backgrounds_.Clear();
+  _impl_.views_.Clear();
+  _impl_.instances_.Clear();
+  _impl_.tiles_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.caption_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.code_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.physics_settings_ != nullptr);
+      _impl_.physics_settings_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.color_) -
+        reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.color_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.isometric_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.id_) -
+        reinterpret_cast<char*>(&_impl_.isometric_)) + sizeof(_impl_.id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Room::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string caption = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_caption();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.caption");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 width = 2 [(.buffers.yyp) = "roomSettings/Width"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 height = 3 [(.buffers.yyp) = "roomSettings/Height"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hsnap = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_hsnap(&has_bits);
+          _impl_.hsnap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vsnap = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_vsnap(&has_bits);
+          _impl_.vsnap_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool isometric = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_isometric(&has_bits);
+          _impl_.isometric_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool persistent = 7 [(.buffers.yyp) = "roomSettings/persistent"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_persistent(&has_bits);
+          _impl_.persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 color = 8 [(.buffers.gmx) = "colour"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_color(&has_bits);
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool show_color = 9 [(.buffers.gmx) = "showcolour"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_show_color(&has_bits);
+          _impl_.show_color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string code = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Room.code");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool enable_views = 11 [(.buffers.gmx) = "enableViews", (.buffers.yyp) = "viewSettings/enableViews"];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_enable_views(&has_bits);
+          _impl_.enable_views_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool clear_view_background = 12 [(.buffers.gmx) = "clearViewBackground", (.buffers.yyp) = "viewSettings/clearViewBackground"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_clear_view_background(&has_bits);
+          _impl_.clear_view_background_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool clear_display_buffer = 13 [(.buffers.gmx) = "clearDisplayBuffer", (.buffers.yyp) = "viewSettings/clearDisplayBuffer"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_clear_display_buffer(&has_bits);
+          _impl_.clear_display_buffer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Room.Background backgrounds = 15 [(.buffers.gmx) = "backgrounds/background"];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_backgrounds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Room.View views = 16 [(.buffers.gmx) = "views/view", (.buffers.yyp) = "views"];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_views(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Room.Instance instances = 17 [(.buffers.gmx) = "instances/instance"];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_instances(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Room.Tile tiles = 18 [(.buffers.gmx) = "tiles/tile"];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_tiles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<146>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Room.RoomPhysicsSettings physics_settings = 19 [(.buffers.gmx) = "EGM_NESTED"];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_physics_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 speed = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
+          _Internal::set_has_speed(&has_bits);
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 id = 29 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Room::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Room)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string caption = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_caption().data(), static_cast<int>(this->_internal_caption().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.caption");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_caption(), target);
+  }
+
+  // optional uint32 width = 2 [(.buffers.yyp) = "roomSettings/Width"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_width(), target);
+  }
+
+  // optional uint32 height = 3 [(.buffers.yyp) = "roomSettings/Height"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_height(), target);
+  }
+
+  // optional uint32 hsnap = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_hsnap(), target);
+  }
+
+  // optional uint32 vsnap = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_vsnap(), target);
+  }
+
+  // optional bool isometric = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_isometric(), target);
+  }
+
+  // optional bool persistent = 7 [(.buffers.yyp) = "roomSettings/persistent"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_persistent(), target);
+  }
+
+  // optional int32 color = 8 [(.buffers.gmx) = "colour"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_color(), target);
+  }
+
+  // optional bool show_color = 9 [(.buffers.gmx) = "showcolour"];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_show_color(), target);
+  }
+
+  // optional string code = 10;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_code().data(), static_cast<int>(this->_internal_code().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Room.code");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_code(), target);
+  }
+
+  // optional bool enable_views = 11 [(.buffers.gmx) = "enableViews", (.buffers.yyp) = "viewSettings/enableViews"];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_enable_views(), target);
+  }
+
+  // optional bool clear_view_background = 12 [(.buffers.gmx) = "clearViewBackground", (.buffers.yyp) = "viewSettings/clearViewBackground"];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_clear_view_background(), target);
+  }
+
+  // optional bool clear_display_buffer = 13 [(.buffers.gmx) = "clearDisplayBuffer", (.buffers.yyp) = "viewSettings/clearDisplayBuffer"];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_clear_display_buffer(), target);
+  }
+
+  // repeated .buffers.resources.Room.Background backgrounds = 15 [(.buffers.gmx) = "backgrounds/background"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_backgrounds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_backgrounds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(15, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .buffers.resources.Room.View views = 16 [(.buffers.gmx) = "views/view", (.buffers.yyp) = "views"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_views_size()); i < n; i++) {
+    const auto& repfield = this->_internal_views(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .buffers.resources.Room.Instance instances = 17 [(.buffers.gmx) = "instances/instance"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_instances_size()); i < n; i++) {
+    const auto& repfield = this->_internal_instances(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .buffers.resources.Room.Tile tiles = 18 [(.buffers.gmx) = "tiles/tile"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tiles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tiles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(18, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .buffers.resources.Room.RoomPhysicsSettings physics_settings = 19 [(.buffers.gmx) = "EGM_NESTED"];
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::physics_settings(this),
+        _Internal::physics_settings(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 speed = 27;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(27, this->_internal_speed(), target);
+  }
+
+  // optional int32 id = 29 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(29, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Room)
+  return target;
+}
+
+size_t Room::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Room)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Room.Background backgrounds = 15 [(.buffers.gmx) = "backgrounds/background"];
+  total_size += 1UL * this->_internal_backgrounds_size();
+  for (const auto& msg : this->_impl_.backgrounds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .buffers.resources.Room.View views = 16 [(.buffers.gmx) = "views/view", (.buffers.yyp) = "views"];
+  total_size += 2UL * this->_internal_views_size();
+  for (const auto& msg : this->_impl_.views_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .buffers.resources.Room.Instance instances = 17 [(.buffers.gmx) = "instances/instance"];
+  total_size += 2UL * this->_internal_instances_size();
+  for (const auto& msg : this->_impl_.instances_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .buffers.resources.Room.Tile tiles = 18 [(.buffers.gmx) = "tiles/tile"];
+  total_size += 2UL * this->_internal_tiles_size();
+  for (const auto& msg : this->_impl_.tiles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string caption = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_caption());
+    }
+
+    // optional string code = 10;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_code());
+    }
+
+    // optional .buffers.resources.Room.RoomPhysicsSettings physics_settings = 19 [(.buffers.gmx) = "EGM_NESTED"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.physics_settings_);
+    }
+
+    // optional uint32 width = 2 [(.buffers.yyp) = "roomSettings/Width"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
+    }
+
+    // optional uint32 height = 3 [(.buffers.yyp) = "roomSettings/Height"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_height());
+    }
+
+    // optional uint32 hsnap = 4;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hsnap());
+    }
+
+    // optional uint32 vsnap = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vsnap());
+    }
+
+    // optional int32 color = 8 [(.buffers.gmx) = "colour"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_color());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional bool isometric = 6;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool persistent = 7 [(.buffers.yyp) = "roomSettings/persistent"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool show_color = 9 [(.buffers.gmx) = "showcolour"];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool enable_views = 11 [(.buffers.gmx) = "enableViews", (.buffers.yyp) = "viewSettings/enableViews"];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool clear_view_background = 12 [(.buffers.gmx) = "clearViewBackground", (.buffers.yyp) = "viewSettings/clearViewBackground"];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool clear_display_buffer = 13 [(.buffers.gmx) = "clearDisplayBuffer", (.buffers.yyp) = "viewSettings/clearDisplayBuffer"];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 speed = 27;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_speed());
+    }
+
+    // optional int32 id = 29 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Room::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Room::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Room::GetClassData() const { return &_class_data_; }
+
+
+void Room::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Room*>(&to_msg);
+  auto& from = static_cast<const Room&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Room)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.backgrounds_.MergeFrom(from._impl_.backgrounds_);
+  _this->_impl_.views_.MergeFrom(from._impl_.views_);
+  _this->_impl_.instances_.MergeFrom(from._impl_.instances_);
+  _this->_impl_.tiles_.MergeFrom(from._impl_.tiles_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_caption(from._internal_caption());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_code(from._internal_code());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_physics_settings()->::buffers::resources::Room_RoomPhysicsSettings::MergeFrom(
+          from._internal_physics_settings());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.hsnap_ = from._impl_.hsnap_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.vsnap_ = from._impl_.vsnap_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.isometric_ = from._impl_.isometric_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.persistent_ = from._impl_.persistent_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.show_color_ = from._impl_.show_color_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.enable_views_ = from._impl_.enable_views_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.clear_view_background_ = from._impl_.clear_view_background_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.clear_display_buffer_ = from._impl_.clear_display_buffer_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.speed_ = from._impl_.speed_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Room::CopyFrom(const Room& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Room)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Room::IsInitialized() const {
+  return true;
+}
+
+void Room::InternalSwap(Room* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.backgrounds_.InternalSwap(&other->_impl_.backgrounds_);
+  _impl_.views_.InternalSwap(&other->_impl_.views_);
+  _impl_.instances_.InternalSwap(&other->_impl_.instances_);
+  _impl_.tiles_.InternalSwap(&other->_impl_.tiles_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.caption_, lhs_arena,
+      &other->_impl_.caption_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.code_, lhs_arena,
+      &other->_impl_.code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Room, _impl_.id_)
+      + sizeof(Room::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(Room, _impl_.physics_settings_)>(
+          reinterpret_cast<char*>(&_impl_.physics_settings_),
+          reinterpret_cast<char*>(&other->_impl_.physics_settings_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Room::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fRoom_2eproto_getter, &descriptor_table_resources_2fRoom_2eproto_once,
+      file_level_metadata_resources_2fRoom_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room_Background*
+Arena::CreateMaybeMessage< ::buffers::resources::Room_Background >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room_Background >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room_View*
+Arena::CreateMaybeMessage< ::buffers::resources::Room_View >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room_View >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room_Instance*
+Arena::CreateMaybeMessage< ::buffers::resources::Room_Instance >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room_Instance >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room_Tile*
+Arena::CreateMaybeMessage< ::buffers::resources::Room_Tile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room_Tile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room_RoomPhysicsSettings*
+Arena::CreateMaybeMessage< ::buffers::resources::Room_RoomPhysicsSettings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room_RoomPhysicsSettings >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Room*
+Arena::CreateMaybeMessage< ::buffers::resources::Room >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Room >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,4861 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Room.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fRoom_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fRoom_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fRoom_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fRoom_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fRoom_2eproto;
+namespace buffers {
+namespace resources {
+class Room;
+struct RoomDefaultTypeInternal;
+extern RoomDefaultTypeInternal _Room_default_instance_;
+class Room_Background;
+struct Room_BackgroundDefaultTypeInternal;
+extern Room_BackgroundDefaultTypeInternal _Room_Background_default_instance_;
+class Room_Instance;
+struct Room_InstanceDefaultTypeInternal;
+extern Room_InstanceDefaultTypeInternal _Room_Instance_default_instance_;
+class Room_RoomPhysicsSettings;
+struct Room_RoomPhysicsSettingsDefaultTypeInternal;
+extern Room_RoomPhysicsSettingsDefaultTypeInternal _Room_RoomPhysicsSettings_default_instance_;
+class Room_Tile;
+struct Room_TileDefaultTypeInternal;
+extern Room_TileDefaultTypeInternal _Room_Tile_default_instance_;
+class Room_View;
+struct Room_ViewDefaultTypeInternal;
+extern Room_ViewDefaultTypeInternal _Room_View_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Room* Arena::CreateMaybeMessage<::buffers::resources::Room>(Arena*);
+template<> ::buffers::resources::Room_Background* Arena::CreateMaybeMessage<::buffers::resources::Room_Background>(Arena*);
+template<> ::buffers::resources::Room_Instance* Arena::CreateMaybeMessage<::buffers::resources::Room_Instance>(Arena*);
+template<> ::buffers::resources::Room_RoomPhysicsSettings* Arena::CreateMaybeMessage<::buffers::resources::Room_RoomPhysicsSettings>(Arena*);
+template<> ::buffers::resources::Room_Tile* Arena::CreateMaybeMessage<::buffers::resources::Room_Tile>(Arena*);
+template<> ::buffers::resources::Room_View* Arena::CreateMaybeMessage<::buffers::resources::Room_View>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Room_Background final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room.Background) */ {
+ public:
+  inline Room_Background() : Room_Background(nullptr) {}
+  ~Room_Background() override;
+  explicit PROTOBUF_CONSTEXPR Room_Background(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room_Background(const Room_Background& from);
+  Room_Background(Room_Background&& from) noexcept
+    : Room_Background() {
+    *this = ::std::move(from);
+  }
+
+  inline Room_Background& operator=(const Room_Background& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room_Background& operator=(Room_Background&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room_Background& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room_Background* internal_default_instance() {
+    return reinterpret_cast<const Room_Background*>(
+               &_Room_Background_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Room_Background& a, Room_Background& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room_Background* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room_Background* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room_Background* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room_Background>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room_Background& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room_Background& from) {
+    Room_Background::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room_Background* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room.Background";
+  }
+  protected:
+  explicit Room_Background(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBackgroundNameFieldNumber = 3,
+    kXFieldNumber = 4,
+    kVisibleFieldNumber = 1,
+    kForegroundFieldNumber = 2,
+    kHtiledFieldNumber = 6,
+    kVtiledFieldNumber = 7,
+    kYFieldNumber = 5,
+    kStretchFieldNumber = 10,
+    kHspeedFieldNumber = 8,
+    kVspeedFieldNumber = 9,
+  };
+  // optional string background_name = 3 [(.buffers.gmx) = "name"];
+  bool has_background_name() const;
+  private:
+  bool _internal_has_background_name() const;
+  public:
+  void clear_background_name();
+  const std::string& background_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_background_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_background_name();
+  PROTOBUF_NODISCARD std::string* release_background_name();
+  void set_allocated_background_name(std::string* background_name);
+  private:
+  const std::string& _internal_background_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_background_name(const std::string& value);
+  std::string* _internal_mutable_background_name();
+  public:
+
+  // optional int32 x = 4;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional bool visible = 1;
+  bool has_visible() const;
+  private:
+  bool _internal_has_visible() const;
+  public:
+  void clear_visible();
+  bool visible() const;
+  void set_visible(bool value);
+  private:
+  bool _internal_visible() const;
+  void _internal_set_visible(bool value);
+  public:
+
+  // optional bool foreground = 2;
+  bool has_foreground() const;
+  private:
+  bool _internal_has_foreground() const;
+  public:
+  void clear_foreground();
+  bool foreground() const;
+  void set_foreground(bool value);
+  private:
+  bool _internal_foreground() const;
+  void _internal_set_foreground(bool value);
+  public:
+
+  // optional bool htiled = 6;
+  bool has_htiled() const;
+  private:
+  bool _internal_has_htiled() const;
+  public:
+  void clear_htiled();
+  bool htiled() const;
+  void set_htiled(bool value);
+  private:
+  bool _internal_htiled() const;
+  void _internal_set_htiled(bool value);
+  public:
+
+  // optional bool vtiled = 7;
+  bool has_vtiled() const;
+  private:
+  bool _internal_has_vtiled() const;
+  public:
+  void clear_vtiled();
+  bool vtiled() const;
+  void set_vtiled(bool value);
+  private:
+  bool _internal_vtiled() const;
+  void _internal_set_vtiled(bool value);
+  public:
+
+  // optional int32 y = 5;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional bool stretch = 10;
+  bool has_stretch() const;
+  private:
+  bool _internal_has_stretch() const;
+  public:
+  void clear_stretch();
+  bool stretch() const;
+  void set_stretch(bool value);
+  private:
+  bool _internal_stretch() const;
+  void _internal_set_stretch(bool value);
+  public:
+
+  // optional double hspeed = 8;
+  bool has_hspeed() const;
+  private:
+  bool _internal_has_hspeed() const;
+  public:
+  void clear_hspeed();
+  double hspeed() const;
+  void set_hspeed(double value);
+  private:
+  double _internal_hspeed() const;
+  void _internal_set_hspeed(double value);
+  public:
+
+  // optional double vspeed = 9;
+  bool has_vspeed() const;
+  private:
+  bool _internal_has_vspeed() const;
+  public:
+  void clear_vspeed();
+  double vspeed() const;
+  void set_vspeed(double value);
+  private:
+  double _internal_vspeed() const;
+  void _internal_set_vspeed(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room.Background)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr background_name_;
+    int32_t x_;
+    bool visible_;
+    bool foreground_;
+    bool htiled_;
+    bool vtiled_;
+    int32_t y_;
+    bool stretch_;
+    double hspeed_;
+    double vspeed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Room_View final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room.View) */ {
+ public:
+  inline Room_View() : Room_View(nullptr) {}
+  ~Room_View() override;
+  explicit PROTOBUF_CONSTEXPR Room_View(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room_View(const Room_View& from);
+  Room_View(Room_View&& from) noexcept
+    : Room_View() {
+    *this = ::std::move(from);
+  }
+
+  inline Room_View& operator=(const Room_View& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room_View& operator=(Room_View&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room_View& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room_View* internal_default_instance() {
+    return reinterpret_cast<const Room_View*>(
+               &_Room_View_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Room_View& a, Room_View& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room_View* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room_View* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room_View* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room_View>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room_View& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room_View& from) {
+    Room_View::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room_View* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room.View";
+  }
+  protected:
+  explicit Room_View(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectFollowingFieldNumber = 14,
+    kVisibleFieldNumber = 1,
+    kXviewFieldNumber = 2,
+    kYviewFieldNumber = 3,
+    kWviewFieldNumber = 4,
+    kHviewFieldNumber = 5,
+    kXportFieldNumber = 6,
+    kYportFieldNumber = 7,
+    kWportFieldNumber = 8,
+    kHportFieldNumber = 9,
+    kHborderFieldNumber = 10,
+    kHspeedFieldNumber = 12,
+    kVspeedFieldNumber = 13,
+    kVborderFieldNumber = 11,
+  };
+  // optional string object_following = 14 [(.buffers.gmx) = "objName"];
+  bool has_object_following() const;
+  private:
+  bool _internal_has_object_following() const;
+  public:
+  void clear_object_following();
+  const std::string& object_following() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_object_following(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_object_following();
+  PROTOBUF_NODISCARD std::string* release_object_following();
+  void set_allocated_object_following(std::string* object_following);
+  private:
+  const std::string& _internal_object_following() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_following(const std::string& value);
+  std::string* _internal_mutable_object_following();
+  public:
+
+  // optional bool visible = 1;
+  bool has_visible() const;
+  private:
+  bool _internal_has_visible() const;
+  public:
+  void clear_visible();
+  bool visible() const;
+  void set_visible(bool value);
+  private:
+  bool _internal_visible() const;
+  void _internal_set_visible(bool value);
+  public:
+
+  // optional int32 xview = 2;
+  bool has_xview() const;
+  private:
+  bool _internal_has_xview() const;
+  public:
+  void clear_xview();
+  int32_t xview() const;
+  void set_xview(int32_t value);
+  private:
+  int32_t _internal_xview() const;
+  void _internal_set_xview(int32_t value);
+  public:
+
+  // optional int32 yview = 3;
+  bool has_yview() const;
+  private:
+  bool _internal_has_yview() const;
+  public:
+  void clear_yview();
+  int32_t yview() const;
+  void set_yview(int32_t value);
+  private:
+  int32_t _internal_yview() const;
+  void _internal_set_yview(int32_t value);
+  public:
+
+  // optional uint32 wview = 4;
+  bool has_wview() const;
+  private:
+  bool _internal_has_wview() const;
+  public:
+  void clear_wview();
+  uint32_t wview() const;
+  void set_wview(uint32_t value);
+  private:
+  uint32_t _internal_wview() const;
+  void _internal_set_wview(uint32_t value);
+  public:
+
+  // optional uint32 hview = 5;
+  bool has_hview() const;
+  private:
+  bool _internal_has_hview() const;
+  public:
+  void clear_hview();
+  uint32_t hview() const;
+  void set_hview(uint32_t value);
+  private:
+  uint32_t _internal_hview() const;
+  void _internal_set_hview(uint32_t value);
+  public:
+
+  // optional int32 xport = 6;
+  bool has_xport() const;
+  private:
+  bool _internal_has_xport() const;
+  public:
+  void clear_xport();
+  int32_t xport() const;
+  void set_xport(int32_t value);
+  private:
+  int32_t _internal_xport() const;
+  void _internal_set_xport(int32_t value);
+  public:
+
+  // optional int32 yport = 7;
+  bool has_yport() const;
+  private:
+  bool _internal_has_yport() const;
+  public:
+  void clear_yport();
+  int32_t yport() const;
+  void set_yport(int32_t value);
+  private:
+  int32_t _internal_yport() const;
+  void _internal_set_yport(int32_t value);
+  public:
+
+  // optional uint32 wport = 8;
+  bool has_wport() const;
+  private:
+  bool _internal_has_wport() const;
+  public:
+  void clear_wport();
+  uint32_t wport() const;
+  void set_wport(uint32_t value);
+  private:
+  uint32_t _internal_wport() const;
+  void _internal_set_wport(uint32_t value);
+  public:
+
+  // optional uint32 hport = 9;
+  bool has_hport() const;
+  private:
+  bool _internal_has_hport() const;
+  public:
+  void clear_hport();
+  uint32_t hport() const;
+  void set_hport(uint32_t value);
+  private:
+  uint32_t _internal_hport() const;
+  void _internal_set_hport(uint32_t value);
+  public:
+
+  // optional int32 hborder = 10;
+  bool has_hborder() const;
+  private:
+  bool _internal_has_hborder() const;
+  public:
+  void clear_hborder();
+  int32_t hborder() const;
+  void set_hborder(int32_t value);
+  private:
+  int32_t _internal_hborder() const;
+  void _internal_set_hborder(int32_t value);
+  public:
+
+  // optional double hspeed = 12;
+  bool has_hspeed() const;
+  private:
+  bool _internal_has_hspeed() const;
+  public:
+  void clear_hspeed();
+  double hspeed() const;
+  void set_hspeed(double value);
+  private:
+  double _internal_hspeed() const;
+  void _internal_set_hspeed(double value);
+  public:
+
+  // optional double vspeed = 13;
+  bool has_vspeed() const;
+  private:
+  bool _internal_has_vspeed() const;
+  public:
+  void clear_vspeed();
+  double vspeed() const;
+  void set_vspeed(double value);
+  private:
+  double _internal_vspeed() const;
+  void _internal_set_vspeed(double value);
+  public:
+
+  // optional int32 vborder = 11;
+  bool has_vborder() const;
+  private:
+  bool _internal_has_vborder() const;
+  public:
+  void clear_vborder();
+  int32_t vborder() const;
+  void set_vborder(int32_t value);
+  private:
+  int32_t _internal_vborder() const;
+  void _internal_set_vborder(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room.View)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr object_following_;
+    bool visible_;
+    int32_t xview_;
+    int32_t yview_;
+    uint32_t wview_;
+    uint32_t hview_;
+    int32_t xport_;
+    int32_t yport_;
+    uint32_t wport_;
+    uint32_t hport_;
+    int32_t hborder_;
+    double hspeed_;
+    double vspeed_;
+    int32_t vborder_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Room_Instance final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room.Instance) */ {
+ public:
+  inline Room_Instance() : Room_Instance(nullptr) {}
+  ~Room_Instance() override;
+  explicit PROTOBUF_CONSTEXPR Room_Instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room_Instance(const Room_Instance& from);
+  Room_Instance(Room_Instance&& from) noexcept
+    : Room_Instance() {
+    *this = ::std::move(from);
+  }
+
+  inline Room_Instance& operator=(const Room_Instance& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room_Instance& operator=(Room_Instance&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room_Instance& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room_Instance* internal_default_instance() {
+    return reinterpret_cast<const Room_Instance*>(
+               &_Room_Instance_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Room_Instance& a, Room_Instance& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room_Instance* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room_Instance* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room_Instance* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room_Instance>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room_Instance& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room_Instance& from) {
+    Room_Instance::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room_Instance* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room.Instance";
+  }
+  protected:
+  explicit Room_Instance(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kObjectTypeFieldNumber = 3,
+    kCodeFieldNumber = 7,
+    kIdFieldNumber = 2,
+    kXFieldNumber = 4,
+    kYFieldNumber = 5,
+    kLockedFieldNumber = 6,
+    kXscaleFieldNumber = 8,
+    kYscaleFieldNumber = 9,
+    kRotationFieldNumber = 11,
+    kColorFieldNumber = 10,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string object_type = 3 [(.buffers.gmx) = "objName"];
+  bool has_object_type() const;
+  private:
+  bool _internal_has_object_type() const;
+  public:
+  void clear_object_type();
+  const std::string& object_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_object_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_object_type();
+  PROTOBUF_NODISCARD std::string* release_object_type();
+  void set_allocated_object_type(std::string* object_type);
+  private:
+  const std::string& _internal_object_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_type(const std::string& value);
+  std::string* _internal_mutable_object_type();
+  public:
+
+  // optional string code = 7;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  const std::string& code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* code);
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
+  std::string* _internal_mutable_code();
+  public:
+
+  // optional int32 id = 2 [(.buffers.id_start) = 100000];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 x = 4;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 5;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional bool locked = 6;
+  bool has_locked() const;
+  private:
+  bool _internal_has_locked() const;
+  public:
+  void clear_locked();
+  bool locked() const;
+  void set_locked(bool value);
+  private:
+  bool _internal_locked() const;
+  void _internal_set_locked(bool value);
+  public:
+
+  // optional double xscale = 8 [(.buffers.gmx) = "scaleX"];
+  bool has_xscale() const;
+  private:
+  bool _internal_has_xscale() const;
+  public:
+  void clear_xscale();
+  double xscale() const;
+  void set_xscale(double value);
+  private:
+  double _internal_xscale() const;
+  void _internal_set_xscale(double value);
+  public:
+
+  // optional double yscale = 9 [(.buffers.gmx) = "scaleY"];
+  bool has_yscale() const;
+  private:
+  bool _internal_has_yscale() const;
+  public:
+  void clear_yscale();
+  double yscale() const;
+  void set_yscale(double value);
+  private:
+  double _internal_yscale() const;
+  void _internal_set_yscale(double value);
+  public:
+
+  // optional double rotation = 11;
+  bool has_rotation() const;
+  private:
+  bool _internal_has_rotation() const;
+  public:
+  void clear_rotation();
+  double rotation() const;
+  void set_rotation(double value);
+  private:
+  double _internal_rotation() const;
+  void _internal_set_rotation(double value);
+  public:
+
+  // optional int32 color = 10 [(.buffers.gmx) = "colour"];
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  int32_t color() const;
+  void set_color(int32_t value);
+  private:
+  int32_t _internal_color() const;
+  void _internal_set_color(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room.Instance)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr object_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    int32_t id_;
+    int32_t x_;
+    int32_t y_;
+    bool locked_;
+    double xscale_;
+    double yscale_;
+    double rotation_;
+    int32_t color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Room_Tile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room.Tile) */ {
+ public:
+  inline Room_Tile() : Room_Tile(nullptr) {}
+  ~Room_Tile() override;
+  explicit PROTOBUF_CONSTEXPR Room_Tile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room_Tile(const Room_Tile& from);
+  Room_Tile(Room_Tile&& from) noexcept
+    : Room_Tile() {
+    *this = ::std::move(from);
+  }
+
+  inline Room_Tile& operator=(const Room_Tile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room_Tile& operator=(Room_Tile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room_Tile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room_Tile* internal_default_instance() {
+    return reinterpret_cast<const Room_Tile*>(
+               &_Room_Tile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Room_Tile& a, Room_Tile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room_Tile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room_Tile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room_Tile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room_Tile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room_Tile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room_Tile& from) {
+    Room_Tile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room_Tile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room.Tile";
+  }
+  protected:
+  explicit Room_Tile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kBackgroundNameFieldNumber = 3,
+    kIdFieldNumber = 2,
+    kXFieldNumber = 4,
+    kYFieldNumber = 5,
+    kLockedFieldNumber = 6,
+    kXoffsetFieldNumber = 7,
+    kYoffsetFieldNumber = 8,
+    kWidthFieldNumber = 9,
+    kHeightFieldNumber = 10,
+    kXscaleFieldNumber = 12,
+    kDepthFieldNumber = 11,
+    kColorFieldNumber = 14,
+    kYscaleFieldNumber = 13,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string background_name = 3 [(.buffers.gmx) = "bgName"];
+  bool has_background_name() const;
+  private:
+  bool _internal_has_background_name() const;
+  public:
+  void clear_background_name();
+  const std::string& background_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_background_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_background_name();
+  PROTOBUF_NODISCARD std::string* release_background_name();
+  void set_allocated_background_name(std::string* background_name);
+  private:
+  const std::string& _internal_background_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_background_name(const std::string& value);
+  std::string* _internal_mutable_background_name();
+  public:
+
+  // optional int32 id = 2 [(.buffers.id_start) = 10000000];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional int32 x = 4;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 5;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional bool locked = 6;
+  bool has_locked() const;
+  private:
+  bool _internal_has_locked() const;
+  public:
+  void clear_locked();
+  bool locked() const;
+  void set_locked(bool value);
+  private:
+  bool _internal_locked() const;
+  void _internal_set_locked(bool value);
+  public:
+
+  // optional int32 xoffset = 7 [(.buffers.gmx) = "xo"];
+  bool has_xoffset() const;
+  private:
+  bool _internal_has_xoffset() const;
+  public:
+  void clear_xoffset();
+  int32_t xoffset() const;
+  void set_xoffset(int32_t value);
+  private:
+  int32_t _internal_xoffset() const;
+  void _internal_set_xoffset(int32_t value);
+  public:
+
+  // optional int32 yoffset = 8 [(.buffers.gmx) = "yo"];
+  bool has_yoffset() const;
+  private:
+  bool _internal_has_yoffset() const;
+  public:
+  void clear_yoffset();
+  int32_t yoffset() const;
+  void set_yoffset(int32_t value);
+  private:
+  int32_t _internal_yoffset() const;
+  void _internal_set_yoffset(int32_t value);
+  public:
+
+  // optional uint32 width = 9 [(.buffers.gmx) = "w"];
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // optional uint32 height = 10 [(.buffers.gmx) = "h"];
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // optional double xscale = 12 [(.buffers.gmx) = "scaleX"];
+  bool has_xscale() const;
+  private:
+  bool _internal_has_xscale() const;
+  public:
+  void clear_xscale();
+  double xscale() const;
+  void set_xscale(double value);
+  private:
+  double _internal_xscale() const;
+  void _internal_set_xscale(double value);
+  public:
+
+  // optional int32 depth = 11;
+  bool has_depth() const;
+  private:
+  bool _internal_has_depth() const;
+  public:
+  void clear_depth();
+  int32_t depth() const;
+  void set_depth(int32_t value);
+  private:
+  int32_t _internal_depth() const;
+  void _internal_set_depth(int32_t value);
+  public:
+
+  // optional int32 color = 14 [(.buffers.gmx) = "colour"];
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  int32_t color() const;
+  void set_color(int32_t value);
+  private:
+  int32_t _internal_color() const;
+  void _internal_set_color(int32_t value);
+  public:
+
+  // optional double yscale = 13 [(.buffers.gmx) = "scaleY"];
+  bool has_yscale() const;
+  private:
+  bool _internal_has_yscale() const;
+  public:
+  void clear_yscale();
+  double yscale() const;
+  void set_yscale(double value);
+  private:
+  double _internal_yscale() const;
+  void _internal_set_yscale(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room.Tile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr background_name_;
+    int32_t id_;
+    int32_t x_;
+    int32_t y_;
+    bool locked_;
+    int32_t xoffset_;
+    int32_t yoffset_;
+    uint32_t width_;
+    uint32_t height_;
+    double xscale_;
+    int32_t depth_;
+    int32_t color_;
+    double yscale_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Room_RoomPhysicsSettings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room.RoomPhysicsSettings) */ {
+ public:
+  inline Room_RoomPhysicsSettings() : Room_RoomPhysicsSettings(nullptr) {}
+  ~Room_RoomPhysicsSettings() override;
+  explicit PROTOBUF_CONSTEXPR Room_RoomPhysicsSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room_RoomPhysicsSettings(const Room_RoomPhysicsSettings& from);
+  Room_RoomPhysicsSettings(Room_RoomPhysicsSettings&& from) noexcept
+    : Room_RoomPhysicsSettings() {
+    *this = ::std::move(from);
+  }
+
+  inline Room_RoomPhysicsSettings& operator=(const Room_RoomPhysicsSettings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room_RoomPhysicsSettings& operator=(Room_RoomPhysicsSettings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room_RoomPhysicsSettings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room_RoomPhysicsSettings* internal_default_instance() {
+    return reinterpret_cast<const Room_RoomPhysicsSettings*>(
+               &_Room_RoomPhysicsSettings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Room_RoomPhysicsSettings& a, Room_RoomPhysicsSettings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room_RoomPhysicsSettings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room_RoomPhysicsSettings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room_RoomPhysicsSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room_RoomPhysicsSettings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room_RoomPhysicsSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room_RoomPhysicsSettings& from) {
+    Room_RoomPhysicsSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room_RoomPhysicsSettings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room.RoomPhysicsSettings";
+  }
+  protected:
+  explicit Room_RoomPhysicsSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsePhysicsFieldNumber = 19,
+    kPhyWorldTopFieldNumber = 20,
+    kPhyWorldLeftFieldNumber = 21,
+    kPhyWorldRightFieldNumber = 22,
+    kPhyWorldXgravityFieldNumber = 24,
+    kPhyWorldYgravityFieldNumber = 25,
+    kPhyWorldPixelMetersFieldNumber = 26,
+    kPhyWorldBottomFieldNumber = 23,
+  };
+  // optional bool use_physics = 19 [(.buffers.gmx) = "PhysicsWorld"];
+  bool has_use_physics() const;
+  private:
+  bool _internal_has_use_physics() const;
+  public:
+  void clear_use_physics();
+  bool use_physics() const;
+  void set_use_physics(bool value);
+  private:
+  bool _internal_use_physics() const;
+  void _internal_set_use_physics(bool value);
+  public:
+
+  // optional int32 phy_world_top = 20 [(.buffers.gmx) = "PhysicsWorldTop"];
+  bool has_phy_world_top() const;
+  private:
+  bool _internal_has_phy_world_top() const;
+  public:
+  void clear_phy_world_top();
+  int32_t phy_world_top() const;
+  void set_phy_world_top(int32_t value);
+  private:
+  int32_t _internal_phy_world_top() const;
+  void _internal_set_phy_world_top(int32_t value);
+  public:
+
+  // optional int32 phy_world_left = 21 [(.buffers.gmx) = "PhysicsWorldLeft"];
+  bool has_phy_world_left() const;
+  private:
+  bool _internal_has_phy_world_left() const;
+  public:
+  void clear_phy_world_left();
+  int32_t phy_world_left() const;
+  void set_phy_world_left(int32_t value);
+  private:
+  int32_t _internal_phy_world_left() const;
+  void _internal_set_phy_world_left(int32_t value);
+  public:
+
+  // optional int32 phy_world_right = 22 [(.buffers.gmx) = "PhysicsWorldRight"];
+  bool has_phy_world_right() const;
+  private:
+  bool _internal_has_phy_world_right() const;
+  public:
+  void clear_phy_world_right();
+  int32_t phy_world_right() const;
+  void set_phy_world_right(int32_t value);
+  private:
+  int32_t _internal_phy_world_right() const;
+  void _internal_set_phy_world_right(int32_t value);
+  public:
+
+  // optional double phy_world_xgravity = 24 [(.buffers.gmx) = "PhysicsWorldGravityX"];
+  bool has_phy_world_xgravity() const;
+  private:
+  bool _internal_has_phy_world_xgravity() const;
+  public:
+  void clear_phy_world_xgravity();
+  double phy_world_xgravity() const;
+  void set_phy_world_xgravity(double value);
+  private:
+  double _internal_phy_world_xgravity() const;
+  void _internal_set_phy_world_xgravity(double value);
+  public:
+
+  // optional double phy_world_ygravity = 25 [(.buffers.gmx) = "PhysicsWorldGravityY"];
+  bool has_phy_world_ygravity() const;
+  private:
+  bool _internal_has_phy_world_ygravity() const;
+  public:
+  void clear_phy_world_ygravity();
+  double phy_world_ygravity() const;
+  void set_phy_world_ygravity(double value);
+  private:
+  double _internal_phy_world_ygravity() const;
+  void _internal_set_phy_world_ygravity(double value);
+  public:
+
+  // optional double phy_world_pixel_meters = 26 [(.buffers.gmx) = "PhysicsWorldPixToMeters"];
+  bool has_phy_world_pixel_meters() const;
+  private:
+  bool _internal_has_phy_world_pixel_meters() const;
+  public:
+  void clear_phy_world_pixel_meters();
+  double phy_world_pixel_meters() const;
+  void set_phy_world_pixel_meters(double value);
+  private:
+  double _internal_phy_world_pixel_meters() const;
+  void _internal_set_phy_world_pixel_meters(double value);
+  public:
+
+  // optional int32 phy_world_bottom = 23 [(.buffers.gmx) = "PhysicsWorldBottom"];
+  bool has_phy_world_bottom() const;
+  private:
+  bool _internal_has_phy_world_bottom() const;
+  public:
+  void clear_phy_world_bottom();
+  int32_t phy_world_bottom() const;
+  void set_phy_world_bottom(int32_t value);
+  private:
+  int32_t _internal_phy_world_bottom() const;
+  void _internal_set_phy_world_bottom(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room.RoomPhysicsSettings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool use_physics_;
+    int32_t phy_world_top_;
+    int32_t phy_world_left_;
+    int32_t phy_world_right_;
+    double phy_world_xgravity_;
+    double phy_world_ygravity_;
+    double phy_world_pixel_meters_;
+    int32_t phy_world_bottom_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Room final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Room) */ {
+ public:
+  inline Room() : Room(nullptr) {}
+  ~Room() override;
+  explicit PROTOBUF_CONSTEXPR Room(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Room(const Room& from);
+  Room(Room&& from) noexcept
+    : Room() {
+    *this = ::std::move(from);
+  }
+
+  inline Room& operator=(const Room& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Room& operator=(Room&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Room& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Room* internal_default_instance() {
+    return reinterpret_cast<const Room*>(
+               &_Room_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Room& a, Room& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Room* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Room* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Room* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Room>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Room& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Room& from) {
+    Room::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Room* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Room";
+  }
+  protected:
+  explicit Room(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Room_Background Background;
+  typedef Room_View View;
+  typedef Room_Instance Instance;
+  typedef Room_Tile Tile;
+  typedef Room_RoomPhysicsSettings RoomPhysicsSettings;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBackgroundsFieldNumber = 15,
+    kViewsFieldNumber = 16,
+    kInstancesFieldNumber = 17,
+    kTilesFieldNumber = 18,
+    kCaptionFieldNumber = 1,
+    kCodeFieldNumber = 10,
+    kPhysicsSettingsFieldNumber = 19,
+    kWidthFieldNumber = 2,
+    kHeightFieldNumber = 3,
+    kHsnapFieldNumber = 4,
+    kVsnapFieldNumber = 5,
+    kColorFieldNumber = 8,
+    kIsometricFieldNumber = 6,
+    kPersistentFieldNumber = 7,
+    kShowColorFieldNumber = 9,
+    kEnableViewsFieldNumber = 11,
+    kClearViewBackgroundFieldNumber = 12,
+    kClearDisplayBufferFieldNumber = 13,
+    kSpeedFieldNumber = 27,
+    kIdFieldNumber = 29,
+  };
+  // repeated .buffers.resources.Room.Background backgrounds = 15 [(.buffers.gmx) = "backgrounds/background"];
+  int backgrounds_size() const;
+  private:
+  int _internal_backgrounds_size() const;
+  public:
+  void clear_backgrounds();
+  ::buffers::resources::Room_Background* mutable_backgrounds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Background >*
+      mutable_backgrounds();
+  private:
+  const ::buffers::resources::Room_Background& _internal_backgrounds(int index) const;
+  ::buffers::resources::Room_Background* _internal_add_backgrounds();
+  public:
+  const ::buffers::resources::Room_Background& backgrounds(int index) const;
+  ::buffers::resources::Room_Background* add_backgrounds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Background >&
+      backgrounds() const;
+
+  // repeated .buffers.resources.Room.View views = 16 [(.buffers.gmx) = "views/view", (.buffers.yyp) = "views"];
+  int views_size() const;
+  private:
+  int _internal_views_size() const;
+  public:
+  void clear_views();
+  ::buffers::resources::Room_View* mutable_views(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_View >*
+      mutable_views();
+  private:
+  const ::buffers::resources::Room_View& _internal_views(int index) const;
+  ::buffers::resources::Room_View* _internal_add_views();
+  public:
+  const ::buffers::resources::Room_View& views(int index) const;
+  ::buffers::resources::Room_View* add_views();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_View >&
+      views() const;
+
+  // repeated .buffers.resources.Room.Instance instances = 17 [(.buffers.gmx) = "instances/instance"];
+  int instances_size() const;
+  private:
+  int _internal_instances_size() const;
+  public:
+  void clear_instances();
+  ::buffers::resources::Room_Instance* mutable_instances(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Instance >*
+      mutable_instances();
+  private:
+  const ::buffers::resources::Room_Instance& _internal_instances(int index) const;
+  ::buffers::resources::Room_Instance* _internal_add_instances();
+  public:
+  const ::buffers::resources::Room_Instance& instances(int index) const;
+  ::buffers::resources::Room_Instance* add_instances();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Instance >&
+      instances() const;
+
+  // repeated .buffers.resources.Room.Tile tiles = 18 [(.buffers.gmx) = "tiles/tile"];
+  int tiles_size() const;
+  private:
+  int _internal_tiles_size() const;
+  public:
+  void clear_tiles();
+  ::buffers::resources::Room_Tile* mutable_tiles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Tile >*
+      mutable_tiles();
+  private:
+  const ::buffers::resources::Room_Tile& _internal_tiles(int index) const;
+  ::buffers::resources::Room_Tile* _internal_add_tiles();
+  public:
+  const ::buffers::resources::Room_Tile& tiles(int index) const;
+  ::buffers::resources::Room_Tile* add_tiles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Tile >&
+      tiles() const;
+
+  // optional string caption = 1;
+  bool has_caption() const;
+  private:
+  bool _internal_has_caption() const;
+  public:
+  void clear_caption();
+  const std::string& caption() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_caption(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_caption();
+  PROTOBUF_NODISCARD std::string* release_caption();
+  void set_allocated_caption(std::string* caption);
+  private:
+  const std::string& _internal_caption() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_caption(const std::string& value);
+  std::string* _internal_mutable_caption();
+  public:
+
+  // optional string code = 10;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  const std::string& code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* code);
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
+  std::string* _internal_mutable_code();
+  public:
+
+  // optional .buffers.resources.Room.RoomPhysicsSettings physics_settings = 19 [(.buffers.gmx) = "EGM_NESTED"];
+  bool has_physics_settings() const;
+  private:
+  bool _internal_has_physics_settings() const;
+  public:
+  void clear_physics_settings();
+  const ::buffers::resources::Room_RoomPhysicsSettings& physics_settings() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Room_RoomPhysicsSettings* release_physics_settings();
+  ::buffers::resources::Room_RoomPhysicsSettings* mutable_physics_settings();
+  void set_allocated_physics_settings(::buffers::resources::Room_RoomPhysicsSettings* physics_settings);
+  private:
+  const ::buffers::resources::Room_RoomPhysicsSettings& _internal_physics_settings() const;
+  ::buffers::resources::Room_RoomPhysicsSettings* _internal_mutable_physics_settings();
+  public:
+  void unsafe_arena_set_allocated_physics_settings(
+      ::buffers::resources::Room_RoomPhysicsSettings* physics_settings);
+  ::buffers::resources::Room_RoomPhysicsSettings* unsafe_arena_release_physics_settings();
+
+  // optional uint32 width = 2 [(.buffers.yyp) = "roomSettings/Width"];
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // optional uint32 height = 3 [(.buffers.yyp) = "roomSettings/Height"];
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // optional uint32 hsnap = 4;
+  bool has_hsnap() const;
+  private:
+  bool _internal_has_hsnap() const;
+  public:
+  void clear_hsnap();
+  uint32_t hsnap() const;
+  void set_hsnap(uint32_t value);
+  private:
+  uint32_t _internal_hsnap() const;
+  void _internal_set_hsnap(uint32_t value);
+  public:
+
+  // optional uint32 vsnap = 5;
+  bool has_vsnap() const;
+  private:
+  bool _internal_has_vsnap() const;
+  public:
+  void clear_vsnap();
+  uint32_t vsnap() const;
+  void set_vsnap(uint32_t value);
+  private:
+  uint32_t _internal_vsnap() const;
+  void _internal_set_vsnap(uint32_t value);
+  public:
+
+  // optional int32 color = 8 [(.buffers.gmx) = "colour"];
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  int32_t color() const;
+  void set_color(int32_t value);
+  private:
+  int32_t _internal_color() const;
+  void _internal_set_color(int32_t value);
+  public:
+
+  // optional bool isometric = 6;
+  bool has_isometric() const;
+  private:
+  bool _internal_has_isometric() const;
+  public:
+  void clear_isometric();
+  bool isometric() const;
+  void set_isometric(bool value);
+  private:
+  bool _internal_isometric() const;
+  void _internal_set_isometric(bool value);
+  public:
+
+  // optional bool persistent = 7 [(.buffers.yyp) = "roomSettings/persistent"];
+  bool has_persistent() const;
+  private:
+  bool _internal_has_persistent() const;
+  public:
+  void clear_persistent();
+  bool persistent() const;
+  void set_persistent(bool value);
+  private:
+  bool _internal_persistent() const;
+  void _internal_set_persistent(bool value);
+  public:
+
+  // optional bool show_color = 9 [(.buffers.gmx) = "showcolour"];
+  bool has_show_color() const;
+  private:
+  bool _internal_has_show_color() const;
+  public:
+  void clear_show_color();
+  bool show_color() const;
+  void set_show_color(bool value);
+  private:
+  bool _internal_show_color() const;
+  void _internal_set_show_color(bool value);
+  public:
+
+  // optional bool enable_views = 11 [(.buffers.gmx) = "enableViews", (.buffers.yyp) = "viewSettings/enableViews"];
+  bool has_enable_views() const;
+  private:
+  bool _internal_has_enable_views() const;
+  public:
+  void clear_enable_views();
+  bool enable_views() const;
+  void set_enable_views(bool value);
+  private:
+  bool _internal_enable_views() const;
+  void _internal_set_enable_views(bool value);
+  public:
+
+  // optional bool clear_view_background = 12 [(.buffers.gmx) = "clearViewBackground", (.buffers.yyp) = "viewSettings/clearViewBackground"];
+  bool has_clear_view_background() const;
+  private:
+  bool _internal_has_clear_view_background() const;
+  public:
+  void clear_clear_view_background();
+  bool clear_view_background() const;
+  void set_clear_view_background(bool value);
+  private:
+  bool _internal_clear_view_background() const;
+  void _internal_set_clear_view_background(bool value);
+  public:
+
+  // optional bool clear_display_buffer = 13 [(.buffers.gmx) = "clearDisplayBuffer", (.buffers.yyp) = "viewSettings/clearDisplayBuffer"];
+  bool has_clear_display_buffer() const;
+  private:
+  bool _internal_has_clear_display_buffer() const;
+  public:
+  void clear_clear_display_buffer();
+  bool clear_display_buffer() const;
+  void set_clear_display_buffer(bool value);
+  private:
+  bool _internal_clear_display_buffer() const;
+  void _internal_set_clear_display_buffer(bool value);
+  public:
+
+  // optional uint32 speed = 27;
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
+  void clear_speed();
+  uint32_t speed() const;
+  void set_speed(uint32_t value);
+  private:
+  uint32_t _internal_speed() const;
+  void _internal_set_speed(uint32_t value);
+  public:
+
+  // optional int32 id = 29 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Room)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Background > backgrounds_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_View > views_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Instance > instances_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Tile > tiles_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr caption_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    ::buffers::resources::Room_RoomPhysicsSettings* physics_settings_;
+    uint32_t width_;
+    uint32_t height_;
+    uint32_t hsnap_;
+    uint32_t vsnap_;
+    int32_t color_;
+    bool isometric_;
+    bool persistent_;
+    bool show_color_;
+    bool enable_views_;
+    bool clear_view_background_;
+    bool clear_display_buffer_;
+    uint32_t speed_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fRoom_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Room_Background
+
+// optional bool visible = 1;
+inline bool Room_Background::_internal_has_visible() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Room_Background::has_visible() const {
+  return _internal_has_visible();
+}
+inline void Room_Background::clear_visible() {
+  _impl_.visible_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Room_Background::_internal_visible() const {
+  return _impl_.visible_;
+}
+inline bool Room_Background::visible() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.visible)
+  return _internal_visible();
+}
+inline void Room_Background::_internal_set_visible(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.visible_ = value;
+}
+inline void Room_Background::set_visible(bool value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.visible)
+}
+
+// optional bool foreground = 2;
+inline bool Room_Background::_internal_has_foreground() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room_Background::has_foreground() const {
+  return _internal_has_foreground();
+}
+inline void Room_Background::clear_foreground() {
+  _impl_.foreground_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool Room_Background::_internal_foreground() const {
+  return _impl_.foreground_;
+}
+inline bool Room_Background::foreground() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.foreground)
+  return _internal_foreground();
+}
+inline void Room_Background::_internal_set_foreground(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.foreground_ = value;
+}
+inline void Room_Background::set_foreground(bool value) {
+  _internal_set_foreground(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.foreground)
+}
+
+// optional string background_name = 3 [(.buffers.gmx) = "name"];
+inline bool Room_Background::_internal_has_background_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room_Background::has_background_name() const {
+  return _internal_has_background_name();
+}
+inline void Room_Background::clear_background_name() {
+  _impl_.background_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Room_Background::background_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.background_name)
+  return _internal_background_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Background::set_background_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.background_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.background_name)
+}
+inline std::string* Room_Background::mutable_background_name() {
+  std::string* _s = _internal_mutable_background_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Background.background_name)
+  return _s;
+}
+inline const std::string& Room_Background::_internal_background_name() const {
+  return _impl_.background_name_.Get();
+}
+inline void Room_Background::_internal_set_background_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.background_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Background::_internal_mutable_background_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.background_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Background::release_background_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Background.background_name)
+  if (!_internal_has_background_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.background_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_name_.IsDefault()) {
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Background::set_allocated_background_name(std::string* background_name) {
+  if (background_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.background_name_.SetAllocated(background_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_name_.IsDefault()) {
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Background.background_name)
+}
+
+// optional int32 x = 4;
+inline bool Room_Background::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room_Background::has_x() const {
+  return _internal_has_x();
+}
+inline void Room_Background::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Room_Background::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Room_Background::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.x)
+  return _internal_x();
+}
+inline void Room_Background::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
+}
+inline void Room_Background::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.x)
+}
+
+// optional int32 y = 5;
+inline bool Room_Background::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room_Background::has_y() const {
+  return _internal_has_y();
+}
+inline void Room_Background::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Room_Background::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Room_Background::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.y)
+  return _internal_y();
+}
+inline void Room_Background::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.y_ = value;
+}
+inline void Room_Background::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.y)
+}
+
+// optional bool htiled = 6;
+inline bool Room_Background::_internal_has_htiled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room_Background::has_htiled() const {
+  return _internal_has_htiled();
+}
+inline void Room_Background::clear_htiled() {
+  _impl_.htiled_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Room_Background::_internal_htiled() const {
+  return _impl_.htiled_;
+}
+inline bool Room_Background::htiled() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.htiled)
+  return _internal_htiled();
+}
+inline void Room_Background::_internal_set_htiled(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.htiled_ = value;
+}
+inline void Room_Background::set_htiled(bool value) {
+  _internal_set_htiled(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.htiled)
+}
+
+// optional bool vtiled = 7;
+inline bool Room_Background::_internal_has_vtiled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room_Background::has_vtiled() const {
+  return _internal_has_vtiled();
+}
+inline void Room_Background::clear_vtiled() {
+  _impl_.vtiled_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Room_Background::_internal_vtiled() const {
+  return _impl_.vtiled_;
+}
+inline bool Room_Background::vtiled() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.vtiled)
+  return _internal_vtiled();
+}
+inline void Room_Background::_internal_set_vtiled(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.vtiled_ = value;
+}
+inline void Room_Background::set_vtiled(bool value) {
+  _internal_set_vtiled(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.vtiled)
+}
+
+// optional double hspeed = 8;
+inline bool Room_Background::_internal_has_hspeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Room_Background::has_hspeed() const {
+  return _internal_has_hspeed();
+}
+inline void Room_Background::clear_hspeed() {
+  _impl_.hspeed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double Room_Background::_internal_hspeed() const {
+  return _impl_.hspeed_;
+}
+inline double Room_Background::hspeed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.hspeed)
+  return _internal_hspeed();
+}
+inline void Room_Background::_internal_set_hspeed(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.hspeed_ = value;
+}
+inline void Room_Background::set_hspeed(double value) {
+  _internal_set_hspeed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.hspeed)
+}
+
+// optional double vspeed = 9;
+inline bool Room_Background::_internal_has_vspeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Room_Background::has_vspeed() const {
+  return _internal_has_vspeed();
+}
+inline void Room_Background::clear_vspeed() {
+  _impl_.vspeed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double Room_Background::_internal_vspeed() const {
+  return _impl_.vspeed_;
+}
+inline double Room_Background::vspeed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.vspeed)
+  return _internal_vspeed();
+}
+inline void Room_Background::_internal_set_vspeed(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.vspeed_ = value;
+}
+inline void Room_Background::set_vspeed(double value) {
+  _internal_set_vspeed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.vspeed)
+}
+
+// optional bool stretch = 10;
+inline bool Room_Background::_internal_has_stretch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room_Background::has_stretch() const {
+  return _internal_has_stretch();
+}
+inline void Room_Background::clear_stretch() {
+  _impl_.stretch_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Room_Background::_internal_stretch() const {
+  return _impl_.stretch_;
+}
+inline bool Room_Background::stretch() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Background.stretch)
+  return _internal_stretch();
+}
+inline void Room_Background::_internal_set_stretch(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.stretch_ = value;
+}
+inline void Room_Background::set_stretch(bool value) {
+  _internal_set_stretch(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Background.stretch)
+}
+
+// -------------------------------------------------------------------
+
+// Room_View
+
+// optional bool visible = 1;
+inline bool Room_View::_internal_has_visible() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room_View::has_visible() const {
+  return _internal_has_visible();
+}
+inline void Room_View::clear_visible() {
+  _impl_.visible_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Room_View::_internal_visible() const {
+  return _impl_.visible_;
+}
+inline bool Room_View::visible() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.visible)
+  return _internal_visible();
+}
+inline void Room_View::_internal_set_visible(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.visible_ = value;
+}
+inline void Room_View::set_visible(bool value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.visible)
+}
+
+// optional int32 xview = 2;
+inline bool Room_View::_internal_has_xview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Room_View::has_xview() const {
+  return _internal_has_xview();
+}
+inline void Room_View::clear_xview() {
+  _impl_.xview_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Room_View::_internal_xview() const {
+  return _impl_.xview_;
+}
+inline int32_t Room_View::xview() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.xview)
+  return _internal_xview();
+}
+inline void Room_View::_internal_set_xview(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.xview_ = value;
+}
+inline void Room_View::set_xview(int32_t value) {
+  _internal_set_xview(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.xview)
+}
+
+// optional int32 yview = 3;
+inline bool Room_View::_internal_has_yview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room_View::has_yview() const {
+  return _internal_has_yview();
+}
+inline void Room_View::clear_yview() {
+  _impl_.yview_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Room_View::_internal_yview() const {
+  return _impl_.yview_;
+}
+inline int32_t Room_View::yview() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.yview)
+  return _internal_yview();
+}
+inline void Room_View::_internal_set_yview(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.yview_ = value;
+}
+inline void Room_View::set_yview(int32_t value) {
+  _internal_set_yview(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.yview)
+}
+
+// optional uint32 wview = 4;
+inline bool Room_View::_internal_has_wview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room_View::has_wview() const {
+  return _internal_has_wview();
+}
+inline void Room_View::clear_wview() {
+  _impl_.wview_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Room_View::_internal_wview() const {
+  return _impl_.wview_;
+}
+inline uint32_t Room_View::wview() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.wview)
+  return _internal_wview();
+}
+inline void Room_View::_internal_set_wview(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.wview_ = value;
+}
+inline void Room_View::set_wview(uint32_t value) {
+  _internal_set_wview(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.wview)
+}
+
+// optional uint32 hview = 5;
+inline bool Room_View::_internal_has_hview() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room_View::has_hview() const {
+  return _internal_has_hview();
+}
+inline void Room_View::clear_hview() {
+  _impl_.hview_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Room_View::_internal_hview() const {
+  return _impl_.hview_;
+}
+inline uint32_t Room_View::hview() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.hview)
+  return _internal_hview();
+}
+inline void Room_View::_internal_set_hview(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.hview_ = value;
+}
+inline void Room_View::set_hview(uint32_t value) {
+  _internal_set_hview(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.hview)
+}
+
+// optional int32 xport = 6;
+inline bool Room_View::_internal_has_xport() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room_View::has_xport() const {
+  return _internal_has_xport();
+}
+inline void Room_View::clear_xport() {
+  _impl_.xport_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Room_View::_internal_xport() const {
+  return _impl_.xport_;
+}
+inline int32_t Room_View::xport() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.xport)
+  return _internal_xport();
+}
+inline void Room_View::_internal_set_xport(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.xport_ = value;
+}
+inline void Room_View::set_xport(int32_t value) {
+  _internal_set_xport(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.xport)
+}
+
+// optional int32 yport = 7;
+inline bool Room_View::_internal_has_yport() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room_View::has_yport() const {
+  return _internal_has_yport();
+}
+inline void Room_View::clear_yport() {
+  _impl_.yport_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Room_View::_internal_yport() const {
+  return _impl_.yport_;
+}
+inline int32_t Room_View::yport() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.yport)
+  return _internal_yport();
+}
+inline void Room_View::_internal_set_yport(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.yport_ = value;
+}
+inline void Room_View::set_yport(int32_t value) {
+  _internal_set_yport(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.yport)
+}
+
+// optional uint32 wport = 8;
+inline bool Room_View::_internal_has_wport() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Room_View::has_wport() const {
+  return _internal_has_wport();
+}
+inline void Room_View::clear_wport() {
+  _impl_.wport_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t Room_View::_internal_wport() const {
+  return _impl_.wport_;
+}
+inline uint32_t Room_View::wport() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.wport)
+  return _internal_wport();
+}
+inline void Room_View::_internal_set_wport(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.wport_ = value;
+}
+inline void Room_View::set_wport(uint32_t value) {
+  _internal_set_wport(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.wport)
+}
+
+// optional uint32 hport = 9;
+inline bool Room_View::_internal_has_hport() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Room_View::has_hport() const {
+  return _internal_has_hport();
+}
+inline void Room_View::clear_hport() {
+  _impl_.hport_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t Room_View::_internal_hport() const {
+  return _impl_.hport_;
+}
+inline uint32_t Room_View::hport() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.hport)
+  return _internal_hport();
+}
+inline void Room_View::_internal_set_hport(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.hport_ = value;
+}
+inline void Room_View::set_hport(uint32_t value) {
+  _internal_set_hport(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.hport)
+}
+
+// optional int32 hborder = 10;
+inline bool Room_View::_internal_has_hborder() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Room_View::has_hborder() const {
+  return _internal_has_hborder();
+}
+inline void Room_View::clear_hborder() {
+  _impl_.hborder_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t Room_View::_internal_hborder() const {
+  return _impl_.hborder_;
+}
+inline int32_t Room_View::hborder() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.hborder)
+  return _internal_hborder();
+}
+inline void Room_View::_internal_set_hborder(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.hborder_ = value;
+}
+inline void Room_View::set_hborder(int32_t value) {
+  _internal_set_hborder(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.hborder)
+}
+
+// optional int32 vborder = 11;
+inline bool Room_View::_internal_has_vborder() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Room_View::has_vborder() const {
+  return _internal_has_vborder();
+}
+inline void Room_View::clear_vborder() {
+  _impl_.vborder_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t Room_View::_internal_vborder() const {
+  return _impl_.vborder_;
+}
+inline int32_t Room_View::vborder() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.vborder)
+  return _internal_vborder();
+}
+inline void Room_View::_internal_set_vborder(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.vborder_ = value;
+}
+inline void Room_View::set_vborder(int32_t value) {
+  _internal_set_vborder(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.vborder)
+}
+
+// optional double hspeed = 12;
+inline bool Room_View::_internal_has_hspeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Room_View::has_hspeed() const {
+  return _internal_has_hspeed();
+}
+inline void Room_View::clear_hspeed() {
+  _impl_.hspeed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double Room_View::_internal_hspeed() const {
+  return _impl_.hspeed_;
+}
+inline double Room_View::hspeed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.hspeed)
+  return _internal_hspeed();
+}
+inline void Room_View::_internal_set_hspeed(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.hspeed_ = value;
+}
+inline void Room_View::set_hspeed(double value) {
+  _internal_set_hspeed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.hspeed)
+}
+
+// optional double vspeed = 13;
+inline bool Room_View::_internal_has_vspeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Room_View::has_vspeed() const {
+  return _internal_has_vspeed();
+}
+inline void Room_View::clear_vspeed() {
+  _impl_.vspeed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double Room_View::_internal_vspeed() const {
+  return _impl_.vspeed_;
+}
+inline double Room_View::vspeed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.vspeed)
+  return _internal_vspeed();
+}
+inline void Room_View::_internal_set_vspeed(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.vspeed_ = value;
+}
+inline void Room_View::set_vspeed(double value) {
+  _internal_set_vspeed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.vspeed)
+}
+
+// optional string object_following = 14 [(.buffers.gmx) = "objName"];
+inline bool Room_View::_internal_has_object_following() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room_View::has_object_following() const {
+  return _internal_has_object_following();
+}
+inline void Room_View::clear_object_following() {
+  _impl_.object_following_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Room_View::object_following() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.View.object_following)
+  return _internal_object_following();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_View::set_object_following(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.object_following_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.View.object_following)
+}
+inline std::string* Room_View::mutable_object_following() {
+  std::string* _s = _internal_mutable_object_following();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.View.object_following)
+  return _s;
+}
+inline const std::string& Room_View::_internal_object_following() const {
+  return _impl_.object_following_.Get();
+}
+inline void Room_View::_internal_set_object_following(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.object_following_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_View::_internal_mutable_object_following() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.object_following_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_View::release_object_following() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.View.object_following)
+  if (!_internal_has_object_following()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.object_following_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_following_.IsDefault()) {
+    _impl_.object_following_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_View::set_allocated_object_following(std::string* object_following) {
+  if (object_following != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.object_following_.SetAllocated(object_following, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_following_.IsDefault()) {
+    _impl_.object_following_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.View.object_following)
+}
+
+// -------------------------------------------------------------------
+
+// Room_Instance
+
+// optional string name = 1;
+inline bool Room_Instance::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_name() const {
+  return _internal_has_name();
+}
+inline void Room_Instance::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Room_Instance::name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Instance::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.name)
+}
+inline std::string* Room_Instance::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Instance.name)
+  return _s;
+}
+inline const std::string& Room_Instance::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Room_Instance::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Instance::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Instance::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Instance.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Instance::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Instance.name)
+}
+
+// optional int32 id = 2 [(.buffers.id_start) = 100000];
+inline bool Room_Instance::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_id() const {
+  return _internal_has_id();
+}
+inline void Room_Instance::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Room_Instance::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Room_Instance::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.id)
+  return _internal_id();
+}
+inline void Room_Instance::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.id_ = value;
+}
+inline void Room_Instance::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.id)
+}
+
+// optional string object_type = 3 [(.buffers.gmx) = "objName"];
+inline bool Room_Instance::_internal_has_object_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_object_type() const {
+  return _internal_has_object_type();
+}
+inline void Room_Instance::clear_object_type() {
+  _impl_.object_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Room_Instance::object_type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.object_type)
+  return _internal_object_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Instance::set_object_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.object_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.object_type)
+}
+inline std::string* Room_Instance::mutable_object_type() {
+  std::string* _s = _internal_mutable_object_type();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Instance.object_type)
+  return _s;
+}
+inline const std::string& Room_Instance::_internal_object_type() const {
+  return _impl_.object_type_.Get();
+}
+inline void Room_Instance::_internal_set_object_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.object_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Instance::_internal_mutable_object_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.object_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Instance::release_object_type() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Instance.object_type)
+  if (!_internal_has_object_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.object_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_type_.IsDefault()) {
+    _impl_.object_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Instance::set_allocated_object_type(std::string* object_type) {
+  if (object_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.object_type_.SetAllocated(object_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_type_.IsDefault()) {
+    _impl_.object_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Instance.object_type)
+}
+
+// optional int32 x = 4;
+inline bool Room_Instance::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_x() const {
+  return _internal_has_x();
+}
+inline void Room_Instance::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Room_Instance::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Room_Instance::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.x)
+  return _internal_x();
+}
+inline void Room_Instance::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.x_ = value;
+}
+inline void Room_Instance::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.x)
+}
+
+// optional int32 y = 5;
+inline bool Room_Instance::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_y() const {
+  return _internal_has_y();
+}
+inline void Room_Instance::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Room_Instance::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Room_Instance::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.y)
+  return _internal_y();
+}
+inline void Room_Instance::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.y_ = value;
+}
+inline void Room_Instance::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.y)
+}
+
+// optional bool locked = 6;
+inline bool Room_Instance::_internal_has_locked() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_locked() const {
+  return _internal_has_locked();
+}
+inline void Room_Instance::clear_locked() {
+  _impl_.locked_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Room_Instance::_internal_locked() const {
+  return _impl_.locked_;
+}
+inline bool Room_Instance::locked() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.locked)
+  return _internal_locked();
+}
+inline void Room_Instance::_internal_set_locked(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.locked_ = value;
+}
+inline void Room_Instance::set_locked(bool value) {
+  _internal_set_locked(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.locked)
+}
+
+// optional string code = 7;
+inline bool Room_Instance::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_code() const {
+  return _internal_has_code();
+}
+inline void Room_Instance::clear_code() {
+  _impl_.code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Room_Instance::code() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Instance::set_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.code)
+}
+inline std::string* Room_Instance::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Instance.code)
+  return _s;
+}
+inline const std::string& Room_Instance::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void Room_Instance::_internal_set_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Instance::_internal_mutable_code() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Instance::release_code() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Instance.code)
+  if (!_internal_has_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Instance::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Instance.code)
+}
+
+// optional double xscale = 8 [(.buffers.gmx) = "scaleX"];
+inline bool Room_Instance::_internal_has_xscale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_xscale() const {
+  return _internal_has_xscale();
+}
+inline void Room_Instance::clear_xscale() {
+  _impl_.xscale_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double Room_Instance::_internal_xscale() const {
+  return _impl_.xscale_;
+}
+inline double Room_Instance::xscale() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.xscale)
+  return _internal_xscale();
+}
+inline void Room_Instance::_internal_set_xscale(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.xscale_ = value;
+}
+inline void Room_Instance::set_xscale(double value) {
+  _internal_set_xscale(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.xscale)
+}
+
+// optional double yscale = 9 [(.buffers.gmx) = "scaleY"];
+inline bool Room_Instance::_internal_has_yscale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_yscale() const {
+  return _internal_has_yscale();
+}
+inline void Room_Instance::clear_yscale() {
+  _impl_.yscale_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double Room_Instance::_internal_yscale() const {
+  return _impl_.yscale_;
+}
+inline double Room_Instance::yscale() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.yscale)
+  return _internal_yscale();
+}
+inline void Room_Instance::_internal_set_yscale(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.yscale_ = value;
+}
+inline void Room_Instance::set_yscale(double value) {
+  _internal_set_yscale(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.yscale)
+}
+
+// optional int32 color = 10 [(.buffers.gmx) = "colour"];
+inline bool Room_Instance::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_color() const {
+  return _internal_has_color();
+}
+inline void Room_Instance::clear_color() {
+  _impl_.color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t Room_Instance::_internal_color() const {
+  return _impl_.color_;
+}
+inline int32_t Room_Instance::color() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.color)
+  return _internal_color();
+}
+inline void Room_Instance::_internal_set_color(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.color_ = value;
+}
+inline void Room_Instance::set_color(int32_t value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.color)
+}
+
+// optional double rotation = 11;
+inline bool Room_Instance::_internal_has_rotation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Room_Instance::has_rotation() const {
+  return _internal_has_rotation();
+}
+inline void Room_Instance::clear_rotation() {
+  _impl_.rotation_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double Room_Instance::_internal_rotation() const {
+  return _impl_.rotation_;
+}
+inline double Room_Instance::rotation() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Instance.rotation)
+  return _internal_rotation();
+}
+inline void Room_Instance::_internal_set_rotation(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.rotation_ = value;
+}
+inline void Room_Instance::set_rotation(double value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Instance.rotation)
+}
+
+// -------------------------------------------------------------------
+
+// Room_Tile
+
+// optional string name = 1;
+inline bool Room_Tile::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_name() const {
+  return _internal_has_name();
+}
+inline void Room_Tile::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Room_Tile::name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Tile::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.name)
+}
+inline std::string* Room_Tile::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Tile.name)
+  return _s;
+}
+inline const std::string& Room_Tile::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Room_Tile::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Tile::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Tile::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Tile.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Tile::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Tile.name)
+}
+
+// optional int32 id = 2 [(.buffers.id_start) = 10000000];
+inline bool Room_Tile::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_id() const {
+  return _internal_has_id();
+}
+inline void Room_Tile::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Room_Tile::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Room_Tile::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.id)
+  return _internal_id();
+}
+inline void Room_Tile::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void Room_Tile::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.id)
+}
+
+// optional string background_name = 3 [(.buffers.gmx) = "bgName"];
+inline bool Room_Tile::_internal_has_background_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_background_name() const {
+  return _internal_has_background_name();
+}
+inline void Room_Tile::clear_background_name() {
+  _impl_.background_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Room_Tile::background_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.background_name)
+  return _internal_background_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room_Tile::set_background_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.background_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.background_name)
+}
+inline std::string* Room_Tile::mutable_background_name() {
+  std::string* _s = _internal_mutable_background_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.Tile.background_name)
+  return _s;
+}
+inline const std::string& Room_Tile::_internal_background_name() const {
+  return _impl_.background_name_.Get();
+}
+inline void Room_Tile::_internal_set_background_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.background_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room_Tile::_internal_mutable_background_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.background_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room_Tile::release_background_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.Tile.background_name)
+  if (!_internal_has_background_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.background_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_name_.IsDefault()) {
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room_Tile::set_allocated_background_name(std::string* background_name) {
+  if (background_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.background_name_.SetAllocated(background_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_name_.IsDefault()) {
+    _impl_.background_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.Tile.background_name)
+}
+
+// optional int32 x = 4;
+inline bool Room_Tile::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_x() const {
+  return _internal_has_x();
+}
+inline void Room_Tile::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Room_Tile::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t Room_Tile::x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.x)
+  return _internal_x();
+}
+inline void Room_Tile::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.x_ = value;
+}
+inline void Room_Tile::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.x)
+}
+
+// optional int32 y = 5;
+inline bool Room_Tile::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_y() const {
+  return _internal_has_y();
+}
+inline void Room_Tile::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Room_Tile::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t Room_Tile::y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.y)
+  return _internal_y();
+}
+inline void Room_Tile::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.y_ = value;
+}
+inline void Room_Tile::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.y)
+}
+
+// optional bool locked = 6;
+inline bool Room_Tile::_internal_has_locked() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_locked() const {
+  return _internal_has_locked();
+}
+inline void Room_Tile::clear_locked() {
+  _impl_.locked_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Room_Tile::_internal_locked() const {
+  return _impl_.locked_;
+}
+inline bool Room_Tile::locked() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.locked)
+  return _internal_locked();
+}
+inline void Room_Tile::_internal_set_locked(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.locked_ = value;
+}
+inline void Room_Tile::set_locked(bool value) {
+  _internal_set_locked(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.locked)
+}
+
+// optional int32 xoffset = 7 [(.buffers.gmx) = "xo"];
+inline bool Room_Tile::_internal_has_xoffset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_xoffset() const {
+  return _internal_has_xoffset();
+}
+inline void Room_Tile::clear_xoffset() {
+  _impl_.xoffset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Room_Tile::_internal_xoffset() const {
+  return _impl_.xoffset_;
+}
+inline int32_t Room_Tile::xoffset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.xoffset)
+  return _internal_xoffset();
+}
+inline void Room_Tile::_internal_set_xoffset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.xoffset_ = value;
+}
+inline void Room_Tile::set_xoffset(int32_t value) {
+  _internal_set_xoffset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.xoffset)
+}
+
+// optional int32 yoffset = 8 [(.buffers.gmx) = "yo"];
+inline bool Room_Tile::_internal_has_yoffset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_yoffset() const {
+  return _internal_has_yoffset();
+}
+inline void Room_Tile::clear_yoffset() {
+  _impl_.yoffset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Room_Tile::_internal_yoffset() const {
+  return _impl_.yoffset_;
+}
+inline int32_t Room_Tile::yoffset() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.yoffset)
+  return _internal_yoffset();
+}
+inline void Room_Tile::_internal_set_yoffset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.yoffset_ = value;
+}
+inline void Room_Tile::set_yoffset(int32_t value) {
+  _internal_set_yoffset(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.yoffset)
+}
+
+// optional uint32 width = 9 [(.buffers.gmx) = "w"];
+inline bool Room_Tile::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_width() const {
+  return _internal_has_width();
+}
+inline void Room_Tile::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t Room_Tile::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t Room_Tile::width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.width)
+  return _internal_width();
+}
+inline void Room_Tile::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.width_ = value;
+}
+inline void Room_Tile::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.width)
+}
+
+// optional uint32 height = 10 [(.buffers.gmx) = "h"];
+inline bool Room_Tile::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_height() const {
+  return _internal_has_height();
+}
+inline void Room_Tile::clear_height() {
+  _impl_.height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t Room_Tile::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t Room_Tile::height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.height)
+  return _internal_height();
+}
+inline void Room_Tile::_internal_set_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.height_ = value;
+}
+inline void Room_Tile::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.height)
+}
+
+// optional int32 depth = 11;
+inline bool Room_Tile::_internal_has_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_depth() const {
+  return _internal_has_depth();
+}
+inline void Room_Tile::clear_depth() {
+  _impl_.depth_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t Room_Tile::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline int32_t Room_Tile::depth() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.depth)
+  return _internal_depth();
+}
+inline void Room_Tile::_internal_set_depth(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.depth_ = value;
+}
+inline void Room_Tile::set_depth(int32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.depth)
+}
+
+// optional double xscale = 12 [(.buffers.gmx) = "scaleX"];
+inline bool Room_Tile::_internal_has_xscale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_xscale() const {
+  return _internal_has_xscale();
+}
+inline void Room_Tile::clear_xscale() {
+  _impl_.xscale_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double Room_Tile::_internal_xscale() const {
+  return _impl_.xscale_;
+}
+inline double Room_Tile::xscale() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.xscale)
+  return _internal_xscale();
+}
+inline void Room_Tile::_internal_set_xscale(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.xscale_ = value;
+}
+inline void Room_Tile::set_xscale(double value) {
+  _internal_set_xscale(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.xscale)
+}
+
+// optional double yscale = 13 [(.buffers.gmx) = "scaleY"];
+inline bool Room_Tile::_internal_has_yscale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_yscale() const {
+  return _internal_has_yscale();
+}
+inline void Room_Tile::clear_yscale() {
+  _impl_.yscale_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double Room_Tile::_internal_yscale() const {
+  return _impl_.yscale_;
+}
+inline double Room_Tile::yscale() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.yscale)
+  return _internal_yscale();
+}
+inline void Room_Tile::_internal_set_yscale(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.yscale_ = value;
+}
+inline void Room_Tile::set_yscale(double value) {
+  _internal_set_yscale(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.yscale)
+}
+
+// optional int32 color = 14 [(.buffers.gmx) = "colour"];
+inline bool Room_Tile::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Room_Tile::has_color() const {
+  return _internal_has_color();
+}
+inline void Room_Tile::clear_color() {
+  _impl_.color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t Room_Tile::_internal_color() const {
+  return _impl_.color_;
+}
+inline int32_t Room_Tile::color() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.Tile.color)
+  return _internal_color();
+}
+inline void Room_Tile::_internal_set_color(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.color_ = value;
+}
+inline void Room_Tile::set_color(int32_t value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.Tile.color)
+}
+
+// -------------------------------------------------------------------
+
+// Room_RoomPhysicsSettings
+
+// optional bool use_physics = 19 [(.buffers.gmx) = "PhysicsWorld"];
+inline bool Room_RoomPhysicsSettings::_internal_has_use_physics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_use_physics() const {
+  return _internal_has_use_physics();
+}
+inline void Room_RoomPhysicsSettings::clear_use_physics() {
+  _impl_.use_physics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool Room_RoomPhysicsSettings::_internal_use_physics() const {
+  return _impl_.use_physics_;
+}
+inline bool Room_RoomPhysicsSettings::use_physics() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.use_physics)
+  return _internal_use_physics();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_use_physics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.use_physics_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_use_physics(bool value) {
+  _internal_set_use_physics(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.use_physics)
+}
+
+// optional int32 phy_world_top = 20 [(.buffers.gmx) = "PhysicsWorldTop"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_top() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_top() const {
+  return _internal_has_phy_world_top();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_top() {
+  _impl_.phy_world_top_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Room_RoomPhysicsSettings::_internal_phy_world_top() const {
+  return _impl_.phy_world_top_;
+}
+inline int32_t Room_RoomPhysicsSettings::phy_world_top() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_top)
+  return _internal_phy_world_top();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_top(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.phy_world_top_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_top(int32_t value) {
+  _internal_set_phy_world_top(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_top)
+}
+
+// optional int32 phy_world_left = 21 [(.buffers.gmx) = "PhysicsWorldLeft"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_left() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_left() const {
+  return _internal_has_phy_world_left();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_left() {
+  _impl_.phy_world_left_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Room_RoomPhysicsSettings::_internal_phy_world_left() const {
+  return _impl_.phy_world_left_;
+}
+inline int32_t Room_RoomPhysicsSettings::phy_world_left() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_left)
+  return _internal_phy_world_left();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_left(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.phy_world_left_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_left(int32_t value) {
+  _internal_set_phy_world_left(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_left)
+}
+
+// optional int32 phy_world_right = 22 [(.buffers.gmx) = "PhysicsWorldRight"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_right() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_right() const {
+  return _internal_has_phy_world_right();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_right() {
+  _impl_.phy_world_right_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Room_RoomPhysicsSettings::_internal_phy_world_right() const {
+  return _impl_.phy_world_right_;
+}
+inline int32_t Room_RoomPhysicsSettings::phy_world_right() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_right)
+  return _internal_phy_world_right();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_right(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.phy_world_right_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_right(int32_t value) {
+  _internal_set_phy_world_right(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_right)
+}
+
+// optional int32 phy_world_bottom = 23 [(.buffers.gmx) = "PhysicsWorldBottom"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_bottom() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_bottom() const {
+  return _internal_has_phy_world_bottom();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_bottom() {
+  _impl_.phy_world_bottom_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Room_RoomPhysicsSettings::_internal_phy_world_bottom() const {
+  return _impl_.phy_world_bottom_;
+}
+inline int32_t Room_RoomPhysicsSettings::phy_world_bottom() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_bottom)
+  return _internal_phy_world_bottom();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_bottom(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.phy_world_bottom_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_bottom(int32_t value) {
+  _internal_set_phy_world_bottom(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_bottom)
+}
+
+// optional double phy_world_xgravity = 24 [(.buffers.gmx) = "PhysicsWorldGravityX"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_xgravity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_xgravity() const {
+  return _internal_has_phy_world_xgravity();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_xgravity() {
+  _impl_.phy_world_xgravity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Room_RoomPhysicsSettings::_internal_phy_world_xgravity() const {
+  return _impl_.phy_world_xgravity_;
+}
+inline double Room_RoomPhysicsSettings::phy_world_xgravity() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_xgravity)
+  return _internal_phy_world_xgravity();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_xgravity(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.phy_world_xgravity_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_xgravity(double value) {
+  _internal_set_phy_world_xgravity(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_xgravity)
+}
+
+// optional double phy_world_ygravity = 25 [(.buffers.gmx) = "PhysicsWorldGravityY"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_ygravity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_ygravity() const {
+  return _internal_has_phy_world_ygravity();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_ygravity() {
+  _impl_.phy_world_ygravity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Room_RoomPhysicsSettings::_internal_phy_world_ygravity() const {
+  return _impl_.phy_world_ygravity_;
+}
+inline double Room_RoomPhysicsSettings::phy_world_ygravity() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_ygravity)
+  return _internal_phy_world_ygravity();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_ygravity(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.phy_world_ygravity_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_ygravity(double value) {
+  _internal_set_phy_world_ygravity(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_ygravity)
+}
+
+// optional double phy_world_pixel_meters = 26 [(.buffers.gmx) = "PhysicsWorldPixToMeters"];
+inline bool Room_RoomPhysicsSettings::_internal_has_phy_world_pixel_meters() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room_RoomPhysicsSettings::has_phy_world_pixel_meters() const {
+  return _internal_has_phy_world_pixel_meters();
+}
+inline void Room_RoomPhysicsSettings::clear_phy_world_pixel_meters() {
+  _impl_.phy_world_pixel_meters_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Room_RoomPhysicsSettings::_internal_phy_world_pixel_meters() const {
+  return _impl_.phy_world_pixel_meters_;
+}
+inline double Room_RoomPhysicsSettings::phy_world_pixel_meters() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.RoomPhysicsSettings.phy_world_pixel_meters)
+  return _internal_phy_world_pixel_meters();
+}
+inline void Room_RoomPhysicsSettings::_internal_set_phy_world_pixel_meters(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.phy_world_pixel_meters_ = value;
+}
+inline void Room_RoomPhysicsSettings::set_phy_world_pixel_meters(double value) {
+  _internal_set_phy_world_pixel_meters(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.RoomPhysicsSettings.phy_world_pixel_meters)
+}
+
+// -------------------------------------------------------------------
+
+// Room
+
+// optional int32 id = 29 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Room::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Room::has_id() const {
+  return _internal_has_id();
+}
+inline void Room::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t Room::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Room::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.id)
+  return _internal_id();
+}
+inline void Room::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.id_ = value;
+}
+inline void Room::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.id)
+}
+
+// optional string caption = 1;
+inline bool Room::_internal_has_caption() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Room::has_caption() const {
+  return _internal_has_caption();
+}
+inline void Room::clear_caption() {
+  _impl_.caption_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Room::caption() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.caption)
+  return _internal_caption();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room::set_caption(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.caption_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.caption)
+}
+inline std::string* Room::mutable_caption() {
+  std::string* _s = _internal_mutable_caption();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.caption)
+  return _s;
+}
+inline const std::string& Room::_internal_caption() const {
+  return _impl_.caption_.Get();
+}
+inline void Room::_internal_set_caption(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.caption_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room::_internal_mutable_caption() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.caption_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room::release_caption() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.caption)
+  if (!_internal_has_caption()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.caption_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.caption_.IsDefault()) {
+    _impl_.caption_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room::set_allocated_caption(std::string* caption) {
+  if (caption != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.caption_.SetAllocated(caption, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.caption_.IsDefault()) {
+    _impl_.caption_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.caption)
+}
+
+// optional uint32 width = 2 [(.buffers.yyp) = "roomSettings/Width"];
+inline bool Room::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Room::has_width() const {
+  return _internal_has_width();
+}
+inline void Room::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Room::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t Room::width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.width)
+  return _internal_width();
+}
+inline void Room::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.width_ = value;
+}
+inline void Room::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.width)
+}
+
+// optional uint32 height = 3 [(.buffers.yyp) = "roomSettings/Height"];
+inline bool Room::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Room::has_height() const {
+  return _internal_has_height();
+}
+inline void Room::clear_height() {
+  _impl_.height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Room::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t Room::height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.height)
+  return _internal_height();
+}
+inline void Room::_internal_set_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.height_ = value;
+}
+inline void Room::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.height)
+}
+
+// optional uint32 hsnap = 4;
+inline bool Room::_internal_has_hsnap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Room::has_hsnap() const {
+  return _internal_has_hsnap();
+}
+inline void Room::clear_hsnap() {
+  _impl_.hsnap_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Room::_internal_hsnap() const {
+  return _impl_.hsnap_;
+}
+inline uint32_t Room::hsnap() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.hsnap)
+  return _internal_hsnap();
+}
+inline void Room::_internal_set_hsnap(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.hsnap_ = value;
+}
+inline void Room::set_hsnap(uint32_t value) {
+  _internal_set_hsnap(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.hsnap)
+}
+
+// optional uint32 vsnap = 5;
+inline bool Room::_internal_has_vsnap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Room::has_vsnap() const {
+  return _internal_has_vsnap();
+}
+inline void Room::clear_vsnap() {
+  _impl_.vsnap_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t Room::_internal_vsnap() const {
+  return _impl_.vsnap_;
+}
+inline uint32_t Room::vsnap() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.vsnap)
+  return _internal_vsnap();
+}
+inline void Room::_internal_set_vsnap(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.vsnap_ = value;
+}
+inline void Room::set_vsnap(uint32_t value) {
+  _internal_set_vsnap(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.vsnap)
+}
+
+// optional bool isometric = 6;
+inline bool Room::_internal_has_isometric() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Room::has_isometric() const {
+  return _internal_has_isometric();
+}
+inline void Room::clear_isometric() {
+  _impl_.isometric_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool Room::_internal_isometric() const {
+  return _impl_.isometric_;
+}
+inline bool Room::isometric() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.isometric)
+  return _internal_isometric();
+}
+inline void Room::_internal_set_isometric(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.isometric_ = value;
+}
+inline void Room::set_isometric(bool value) {
+  _internal_set_isometric(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.isometric)
+}
+
+// optional uint32 speed = 27;
+inline bool Room::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Room::has_speed() const {
+  return _internal_has_speed();
+}
+inline void Room::clear_speed() {
+  _impl_.speed_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t Room::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline uint32_t Room::speed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.speed)
+  return _internal_speed();
+}
+inline void Room::_internal_set_speed(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.speed_ = value;
+}
+inline void Room::set_speed(uint32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.speed)
+}
+
+// optional bool persistent = 7 [(.buffers.yyp) = "roomSettings/persistent"];
+inline bool Room::_internal_has_persistent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Room::has_persistent() const {
+  return _internal_has_persistent();
+}
+inline void Room::clear_persistent() {
+  _impl_.persistent_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool Room::_internal_persistent() const {
+  return _impl_.persistent_;
+}
+inline bool Room::persistent() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.persistent)
+  return _internal_persistent();
+}
+inline void Room::_internal_set_persistent(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.persistent_ = value;
+}
+inline void Room::set_persistent(bool value) {
+  _internal_set_persistent(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.persistent)
+}
+
+// optional int32 color = 8 [(.buffers.gmx) = "colour"];
+inline bool Room::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Room::has_color() const {
+  return _internal_has_color();
+}
+inline void Room::clear_color() {
+  _impl_.color_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Room::_internal_color() const {
+  return _impl_.color_;
+}
+inline int32_t Room::color() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.color)
+  return _internal_color();
+}
+inline void Room::_internal_set_color(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.color_ = value;
+}
+inline void Room::set_color(int32_t value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.color)
+}
+
+// optional bool show_color = 9 [(.buffers.gmx) = "showcolour"];
+inline bool Room::_internal_has_show_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Room::has_show_color() const {
+  return _internal_has_show_color();
+}
+inline void Room::clear_show_color() {
+  _impl_.show_color_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool Room::_internal_show_color() const {
+  return _impl_.show_color_;
+}
+inline bool Room::show_color() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.show_color)
+  return _internal_show_color();
+}
+inline void Room::_internal_set_show_color(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.show_color_ = value;
+}
+inline void Room::set_show_color(bool value) {
+  _internal_set_show_color(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.show_color)
+}
+
+// optional string code = 10;
+inline bool Room::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Room::has_code() const {
+  return _internal_has_code();
+}
+inline void Room::clear_code() {
+  _impl_.code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Room::code() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Room::set_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.code)
+}
+inline std::string* Room::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.code)
+  return _s;
+}
+inline const std::string& Room::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void Room::_internal_set_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Room::_internal_mutable_code() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Room::release_code() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.code)
+  if (!_internal_has_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Room::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.code)
+}
+
+// optional bool enable_views = 11 [(.buffers.gmx) = "enableViews", (.buffers.yyp) = "viewSettings/enableViews"];
+inline bool Room::_internal_has_enable_views() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Room::has_enable_views() const {
+  return _internal_has_enable_views();
+}
+inline void Room::clear_enable_views() {
+  _impl_.enable_views_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool Room::_internal_enable_views() const {
+  return _impl_.enable_views_;
+}
+inline bool Room::enable_views() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.enable_views)
+  return _internal_enable_views();
+}
+inline void Room::_internal_set_enable_views(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.enable_views_ = value;
+}
+inline void Room::set_enable_views(bool value) {
+  _internal_set_enable_views(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.enable_views)
+}
+
+// optional bool clear_view_background = 12 [(.buffers.gmx) = "clearViewBackground", (.buffers.yyp) = "viewSettings/clearViewBackground"];
+inline bool Room::_internal_has_clear_view_background() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Room::has_clear_view_background() const {
+  return _internal_has_clear_view_background();
+}
+inline void Room::clear_clear_view_background() {
+  _impl_.clear_view_background_ = false;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline bool Room::_internal_clear_view_background() const {
+  return _impl_.clear_view_background_;
+}
+inline bool Room::clear_view_background() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.clear_view_background)
+  return _internal_clear_view_background();
+}
+inline void Room::_internal_set_clear_view_background(bool value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.clear_view_background_ = value;
+}
+inline void Room::set_clear_view_background(bool value) {
+  _internal_set_clear_view_background(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.clear_view_background)
+}
+
+// optional bool clear_display_buffer = 13 [(.buffers.gmx) = "clearDisplayBuffer", (.buffers.yyp) = "viewSettings/clearDisplayBuffer"];
+inline bool Room::_internal_has_clear_display_buffer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Room::has_clear_display_buffer() const {
+  return _internal_has_clear_display_buffer();
+}
+inline void Room::clear_clear_display_buffer() {
+  _impl_.clear_display_buffer_ = false;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline bool Room::_internal_clear_display_buffer() const {
+  return _impl_.clear_display_buffer_;
+}
+inline bool Room::clear_display_buffer() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.clear_display_buffer)
+  return _internal_clear_display_buffer();
+}
+inline void Room::_internal_set_clear_display_buffer(bool value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.clear_display_buffer_ = value;
+}
+inline void Room::set_clear_display_buffer(bool value) {
+  _internal_set_clear_display_buffer(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Room.clear_display_buffer)
+}
+
+// repeated .buffers.resources.Room.Background backgrounds = 15 [(.buffers.gmx) = "backgrounds/background"];
+inline int Room::_internal_backgrounds_size() const {
+  return _impl_.backgrounds_.size();
+}
+inline int Room::backgrounds_size() const {
+  return _internal_backgrounds_size();
+}
+inline void Room::clear_backgrounds() {
+  _impl_.backgrounds_.Clear();
+}
+inline ::buffers::resources::Room_Background* Room::mutable_backgrounds(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.backgrounds)
+  return _impl_.backgrounds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Background >*
+Room::mutable_backgrounds() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Room.backgrounds)
+  return &_impl_.backgrounds_;
+}
+inline const ::buffers::resources::Room_Background& Room::_internal_backgrounds(int index) const {
+  return _impl_.backgrounds_.Get(index);
+}
+inline const ::buffers::resources::Room_Background& Room::backgrounds(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.backgrounds)
+  return _internal_backgrounds(index);
+}
+inline ::buffers::resources::Room_Background* Room::_internal_add_backgrounds() {
+  return _impl_.backgrounds_.Add();
+}
+inline ::buffers::resources::Room_Background* Room::add_backgrounds() {
+  ::buffers::resources::Room_Background* _add = _internal_add_backgrounds();
+  // @@protoc_insertion_point(field_add:buffers.resources.Room.backgrounds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Background >&
+Room::backgrounds() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Room.backgrounds)
+  return _impl_.backgrounds_;
+}
+
+// repeated .buffers.resources.Room.View views = 16 [(.buffers.gmx) = "views/view", (.buffers.yyp) = "views"];
+inline int Room::_internal_views_size() const {
+  return _impl_.views_.size();
+}
+inline int Room::views_size() const {
+  return _internal_views_size();
+}
+inline void Room::clear_views() {
+  _impl_.views_.Clear();
+}
+inline ::buffers::resources::Room_View* Room::mutable_views(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.views)
+  return _impl_.views_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_View >*
+Room::mutable_views() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Room.views)
+  return &_impl_.views_;
+}
+inline const ::buffers::resources::Room_View& Room::_internal_views(int index) const {
+  return _impl_.views_.Get(index);
+}
+inline const ::buffers::resources::Room_View& Room::views(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.views)
+  return _internal_views(index);
+}
+inline ::buffers::resources::Room_View* Room::_internal_add_views() {
+  return _impl_.views_.Add();
+}
+inline ::buffers::resources::Room_View* Room::add_views() {
+  ::buffers::resources::Room_View* _add = _internal_add_views();
+  // @@protoc_insertion_point(field_add:buffers.resources.Room.views)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_View >&
+Room::views() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Room.views)
+  return _impl_.views_;
+}
+
+// repeated .buffers.resources.Room.Instance instances = 17 [(.buffers.gmx) = "instances/instance"];
+inline int Room::_internal_instances_size() const {
+  return _impl_.instances_.size();
+}
+inline int Room::instances_size() const {
+  return _internal_instances_size();
+}
+inline void Room::clear_instances() {
+  _impl_.instances_.Clear();
+}
+inline ::buffers::resources::Room_Instance* Room::mutable_instances(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.instances)
+  return _impl_.instances_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Instance >*
+Room::mutable_instances() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Room.instances)
+  return &_impl_.instances_;
+}
+inline const ::buffers::resources::Room_Instance& Room::_internal_instances(int index) const {
+  return _impl_.instances_.Get(index);
+}
+inline const ::buffers::resources::Room_Instance& Room::instances(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.instances)
+  return _internal_instances(index);
+}
+inline ::buffers::resources::Room_Instance* Room::_internal_add_instances() {
+  return _impl_.instances_.Add();
+}
+inline ::buffers::resources::Room_Instance* Room::add_instances() {
+  ::buffers::resources::Room_Instance* _add = _internal_add_instances();
+  // @@protoc_insertion_point(field_add:buffers.resources.Room.instances)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Instance >&
+Room::instances() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Room.instances)
+  return _impl_.instances_;
+}
+
+// repeated .buffers.resources.Room.Tile tiles = 18 [(.buffers.gmx) = "tiles/tile"];
+inline int Room::_internal_tiles_size() const {
+  return _impl_.tiles_.size();
+}
+inline int Room::tiles_size() const {
+  return _internal_tiles_size();
+}
+inline void Room::clear_tiles() {
+  _impl_.tiles_.Clear();
+}
+inline ::buffers::resources::Room_Tile* Room::mutable_tiles(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.tiles)
+  return _impl_.tiles_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Tile >*
+Room::mutable_tiles() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Room.tiles)
+  return &_impl_.tiles_;
+}
+inline const ::buffers::resources::Room_Tile& Room::_internal_tiles(int index) const {
+  return _impl_.tiles_.Get(index);
+}
+inline const ::buffers::resources::Room_Tile& Room::tiles(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.tiles)
+  return _internal_tiles(index);
+}
+inline ::buffers::resources::Room_Tile* Room::_internal_add_tiles() {
+  return _impl_.tiles_.Add();
+}
+inline ::buffers::resources::Room_Tile* Room::add_tiles() {
+  ::buffers::resources::Room_Tile* _add = _internal_add_tiles();
+  // @@protoc_insertion_point(field_add:buffers.resources.Room.tiles)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Room_Tile >&
+Room::tiles() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Room.tiles)
+  return _impl_.tiles_;
+}
+
+// optional .buffers.resources.Room.RoomPhysicsSettings physics_settings = 19 [(.buffers.gmx) = "EGM_NESTED"];
+inline bool Room::_internal_has_physics_settings() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.physics_settings_ != nullptr);
+  return value;
+}
+inline bool Room::has_physics_settings() const {
+  return _internal_has_physics_settings();
+}
+inline void Room::clear_physics_settings() {
+  if (_impl_.physics_settings_ != nullptr) _impl_.physics_settings_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::buffers::resources::Room_RoomPhysicsSettings& Room::_internal_physics_settings() const {
+  const ::buffers::resources::Room_RoomPhysicsSettings* p = _impl_.physics_settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::resources::Room_RoomPhysicsSettings&>(
+      ::buffers::resources::_Room_RoomPhysicsSettings_default_instance_);
+}
+inline const ::buffers::resources::Room_RoomPhysicsSettings& Room::physics_settings() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Room.physics_settings)
+  return _internal_physics_settings();
+}
+inline void Room::unsafe_arena_set_allocated_physics_settings(
+    ::buffers::resources::Room_RoomPhysicsSettings* physics_settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.physics_settings_);
+  }
+  _impl_.physics_settings_ = physics_settings;
+  if (physics_settings) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.resources.Room.physics_settings)
+}
+inline ::buffers::resources::Room_RoomPhysicsSettings* Room::release_physics_settings() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::buffers::resources::Room_RoomPhysicsSettings* temp = _impl_.physics_settings_;
+  _impl_.physics_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::resources::Room_RoomPhysicsSettings* Room::unsafe_arena_release_physics_settings() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Room.physics_settings)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::buffers::resources::Room_RoomPhysicsSettings* temp = _impl_.physics_settings_;
+  _impl_.physics_settings_ = nullptr;
+  return temp;
+}
+inline ::buffers::resources::Room_RoomPhysicsSettings* Room::_internal_mutable_physics_settings() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.physics_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::resources::Room_RoomPhysicsSettings>(GetArenaForAllocation());
+    _impl_.physics_settings_ = p;
+  }
+  return _impl_.physics_settings_;
+}
+inline ::buffers::resources::Room_RoomPhysicsSettings* Room::mutable_physics_settings() {
+  ::buffers::resources::Room_RoomPhysicsSettings* _msg = _internal_mutable_physics_settings();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Room.physics_settings)
+  return _msg;
+}
+inline void Room::set_allocated_physics_settings(::buffers::resources::Room_RoomPhysicsSettings* physics_settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.physics_settings_;
+  }
+  if (physics_settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(physics_settings);
+    if (message_arena != submessage_arena) {
+      physics_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, physics_settings, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.physics_settings_ = physics_settings;
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Room.physics_settings)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fRoom_2eproto
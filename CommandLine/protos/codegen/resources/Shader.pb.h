@@ -0,0 +1,579 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Shader.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fShader_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fShader_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fShader_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fShader_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fShader_2eproto;
+namespace buffers {
+namespace resources {
+class Shader;
+struct ShaderDefaultTypeInternal;
+extern ShaderDefaultTypeInternal _Shader_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Shader* Arena::CreateMaybeMessage<::buffers::resources::Shader>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Shader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Shader) */ {
+ public:
+  inline Shader() : Shader(nullptr) {}
+  ~Shader() override;
+  explicit PROTOBUF_CONSTEXPR Shader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Shader(const Shader& from);
+  Shader(Shader&& from) noexcept
+    : Shader() {
+    *this = ::std::move(from);
+  }
+
+  inline Shader& operator=(const Shader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Shader& operator=(Shader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Shader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Shader* internal_default_instance() {
+    return reinterpret_cast<const Shader*>(
+               &_Shader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Shader& a, Shader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Shader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Shader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Shader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Shader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Shader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Shader& from) {
+    Shader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Shader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Shader";
+  }
+  protected:
+  explicit Shader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 3,
+    kVertexCodeFieldNumber = 5,
+    kFragmentCodeFieldNumber = 6,
+    kIdFieldNumber = 2,
+    kPrecompileFieldNumber = 4,
+  };
+  // optional string type = 3;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // optional string vertex_code = 5;
+  bool has_vertex_code() const;
+  private:
+  bool _internal_has_vertex_code() const;
+  public:
+  void clear_vertex_code();
+  const std::string& vertex_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_vertex_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_vertex_code();
+  PROTOBUF_NODISCARD std::string* release_vertex_code();
+  void set_allocated_vertex_code(std::string* vertex_code);
+  private:
+  const std::string& _internal_vertex_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_vertex_code(const std::string& value);
+  std::string* _internal_mutable_vertex_code();
+  public:
+
+  // optional string fragment_code = 6;
+  bool has_fragment_code() const;
+  private:
+  bool _internal_has_fragment_code() const;
+  public:
+  void clear_fragment_code();
+  const std::string& fragment_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_fragment_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_fragment_code();
+  PROTOBUF_NODISCARD std::string* release_fragment_code();
+  void set_allocated_fragment_code(std::string* fragment_code);
+  private:
+  const std::string& _internal_fragment_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_fragment_code(const std::string& value);
+  std::string* _internal_mutable_fragment_code();
+  public:
+
+  // optional int32 id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional bool precompile = 4;
+  bool has_precompile() const;
+  private:
+  bool _internal_has_precompile() const;
+  public:
+  void clear_precompile();
+  bool precompile() const;
+  void set_precompile(bool value);
+  private:
+  bool _internal_precompile() const;
+  void _internal_set_precompile(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Shader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr vertex_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr fragment_code_;
+    int32_t id_;
+    bool precompile_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fShader_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Shader
+
+// optional int32 id = 2;
+inline bool Shader::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Shader::has_id() const {
+  return _internal_has_id();
+}
+inline void Shader::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Shader::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Shader::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Shader.id)
+  return _internal_id();
+}
+inline void Shader::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.id_ = value;
+}
+inline void Shader::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Shader.id)
+}
+
+// optional string type = 3;
+inline bool Shader::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Shader::has_type() const {
+  return _internal_has_type();
+}
+inline void Shader::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Shader::type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Shader.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Shader::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Shader.type)
+}
+inline std::string* Shader::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Shader.type)
+  return _s;
+}
+inline const std::string& Shader::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void Shader::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Shader::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Shader::release_type() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Shader.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Shader::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Shader.type)
+}
+
+// optional bool precompile = 4;
+inline bool Shader::_internal_has_precompile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Shader::has_precompile() const {
+  return _internal_has_precompile();
+}
+inline void Shader::clear_precompile() {
+  _impl_.precompile_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Shader::_internal_precompile() const {
+  return _impl_.precompile_;
+}
+inline bool Shader::precompile() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Shader.precompile)
+  return _internal_precompile();
+}
+inline void Shader::_internal_set_precompile(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.precompile_ = value;
+}
+inline void Shader::set_precompile(bool value) {
+  _internal_set_precompile(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Shader.precompile)
+}
+
+// optional string vertex_code = 5;
+inline bool Shader::_internal_has_vertex_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Shader::has_vertex_code() const {
+  return _internal_has_vertex_code();
+}
+inline void Shader::clear_vertex_code() {
+  _impl_.vertex_code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Shader::vertex_code() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Shader.vertex_code)
+  return _internal_vertex_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Shader::set_vertex_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.vertex_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Shader.vertex_code)
+}
+inline std::string* Shader::mutable_vertex_code() {
+  std::string* _s = _internal_mutable_vertex_code();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Shader.vertex_code)
+  return _s;
+}
+inline const std::string& Shader::_internal_vertex_code() const {
+  return _impl_.vertex_code_.Get();
+}
+inline void Shader::_internal_set_vertex_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.vertex_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Shader::_internal_mutable_vertex_code() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.vertex_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Shader::release_vertex_code() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Shader.vertex_code)
+  if (!_internal_has_vertex_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.vertex_code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.vertex_code_.IsDefault()) {
+    _impl_.vertex_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Shader::set_allocated_vertex_code(std::string* vertex_code) {
+  if (vertex_code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.vertex_code_.SetAllocated(vertex_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.vertex_code_.IsDefault()) {
+    _impl_.vertex_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Shader.vertex_code)
+}
+
+// optional string fragment_code = 6;
+inline bool Shader::_internal_has_fragment_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Shader::has_fragment_code() const {
+  return _internal_has_fragment_code();
+}
+inline void Shader::clear_fragment_code() {
+  _impl_.fragment_code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Shader::fragment_code() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Shader.fragment_code)
+  return _internal_fragment_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Shader::set_fragment_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.fragment_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Shader.fragment_code)
+}
+inline std::string* Shader::mutable_fragment_code() {
+  std::string* _s = _internal_mutable_fragment_code();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Shader.fragment_code)
+  return _s;
+}
+inline const std::string& Shader::_internal_fragment_code() const {
+  return _impl_.fragment_code_.Get();
+}
+inline void Shader::_internal_set_fragment_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.fragment_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Shader::_internal_mutable_fragment_code() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.fragment_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Shader::release_fragment_code() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Shader.fragment_code)
+  if (!_internal_has_fragment_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.fragment_code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fragment_code_.IsDefault()) {
+    _impl_.fragment_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Shader::set_allocated_fragment_code(std::string* fragment_code) {
+  if (fragment_code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.fragment_code_.SetAllocated(fragment_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fragment_code_.IsDefault()) {
+    _impl_.fragment_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Shader.fragment_code)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fShader_2eproto
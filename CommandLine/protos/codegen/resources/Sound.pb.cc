@@ -0,0 +1,986 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Sound.proto
+
+#include "resources/Sound.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Sound::Sound(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_extension_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pan_)*/0
+  , /*decltype(_impl_.volume_)*/0
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.kind_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.effects_)*/0
+  , /*decltype(_impl_.bit_rate_)*/0u
+  , /*decltype(_impl_.preload_)*/false
+  , /*decltype(_impl_.compressed_)*/false
+  , /*decltype(_impl_.streamed_)*/false
+  , /*decltype(_impl_.uncompress_on_load_)*/false
+  , /*decltype(_impl_.sample_rate_)*/0u
+  , /*decltype(_impl_.bit_depth_)*/0u
+  , /*decltype(_impl_.audio_group_)*/0} {}
+struct SoundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SoundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SoundDefaultTypeInternal() {}
+  union {
+    Sound _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SoundDefaultTypeInternal _Sound_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fSound_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_resources_2fSound_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fSound_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fSound_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.preload_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.pan_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.volume_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.file_extension_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.kind_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.effects_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.bit_rate_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.sample_rate_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.bit_depth_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.compressed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.streamed_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.uncompress_on_load_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sound, _impl_.audio_group_),
+  5,
+  10,
+  3,
+  4,
+  0,
+  1,
+  6,
+  7,
+  2,
+  8,
+  9,
+  14,
+  15,
+  11,
+  12,
+  13,
+  16,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 23, -1, sizeof(::buffers::resources::Sound)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Sound_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fSound_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025resources/Sound.proto\022\021buffers.resourc"
+  "es\032\roptions.proto\"\316\005\n\005Sound\022\036\n\002id\030\002 \001(\005B"
+  "\022\222\265\030\016GMX_DEPRECATED\022\017\n\007preload\030\003 \001(\010\022\013\n\003"
+  "pan\030\004 \001(\001\022!\n\006volume\030\005 \001(\001B\021\222\265\030\rvolume/vo"
+  "lume\022\033\n\tfile_name\030\006 \001(\tB\010\222\265\030\004data\022%\n\016fil"
+  "e_extension\030\007 \001(\tB\r\222\265\030\textension\022+\n\004kind"
+  "\030\010 \001(\0162\035.buffers.resources.Sound.Kind\022;\n"
+  "\004type\030\t \001(\0162\035.buffers.resources.Sound.Ty"
+  "peB\016\222\265\030\ntypes/type\022\036\n\004data\030\n \001(\tB\020\222\265\030\010or"
+  "igname\210\265\030\001\022\017\n\007effects\030\013 \001(\005\022&\n\010bit_rate\030"
+  "\014 \001(\rB\024\222\265\030\020bitRates/bitRate\022/\n\013sample_ra"
+  "te\030\r \001(\rB\032\222\265\030\026sampleRates/sampleRate\022)\n\t"
+  "bit_depth\030\016 \001(\rB\026\222\265\030\022bitDepths/bitDepth\022"
+  "\022\n\ncompressed\030\017 \001(\010\022\020\n\010streamed\030\020 \001(\010\0220\n"
+  "\022uncompress_on_load\030\021 \001(\010B\024\222\265\030\020uncompres"
+  "sOnLoad\022#\n\013audio_group\030\022 \001(\005B\016\222\265\030\naudioG"
+  "roup\"V\n\004Kind\022\n\n\006NORMAL\020\000\022\024\n\020BACKGROUND_M"
+  "USIC\020\001\022\025\n\021THREE_DIMENSIONAL\020\002\022\025\n\021MULTIME"
+  "DIA_PLAYER\020\003\",\n\004Type\022\010\n\004MONO\020\000\022\n\n\006STEREO"
+  "\020\001\022\016\n\nPOSITIONAL\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fSound_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fSound_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fSound_2eproto = {
+    false, false, 778, descriptor_table_protodef_resources_2fSound_2eproto,
+    "resources/Sound.proto",
+    &descriptor_table_resources_2fSound_2eproto_once, descriptor_table_resources_2fSound_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_resources_2fSound_2eproto::offsets,
+    file_level_metadata_resources_2fSound_2eproto, file_level_enum_descriptors_resources_2fSound_2eproto,
+    file_level_service_descriptors_resources_2fSound_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fSound_2eproto_getter() {
+  return &descriptor_table_resources_2fSound_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fSound_2eproto(&descriptor_table_resources_2fSound_2eproto);
+namespace buffers {
+namespace resources {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sound_Kind_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fSound_2eproto);
+  return file_level_enum_descriptors_resources_2fSound_2eproto[0];
+}
+bool Sound_Kind_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Sound_Kind Sound::NORMAL;
+constexpr Sound_Kind Sound::BACKGROUND_MUSIC;
+constexpr Sound_Kind Sound::THREE_DIMENSIONAL;
+constexpr Sound_Kind Sound::MULTIMEDIA_PLAYER;
+constexpr Sound_Kind Sound::Kind_MIN;
+constexpr Sound_Kind Sound::Kind_MAX;
+constexpr int Sound::Kind_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sound_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fSound_2eproto);
+  return file_level_enum_descriptors_resources_2fSound_2eproto[1];
+}
+bool Sound_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Sound_Type Sound::MONO;
+constexpr Sound_Type Sound::STEREO;
+constexpr Sound_Type Sound::POSITIONAL;
+constexpr Sound_Type Sound::Type_MIN;
+constexpr Sound_Type Sound::Type_MAX;
+constexpr int Sound::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Sound::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Sound>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_preload(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_pan(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_volume(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_file_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_file_extension(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_kind(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_effects(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_bit_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_sample_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_bit_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_compressed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_streamed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_uncompress_on_load(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_audio_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+};
+
+Sound::Sound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Sound)
+}
+Sound::Sound(const Sound& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Sound* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.file_extension_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.pan_){}
+    , decltype(_impl_.volume_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.kind_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.effects_){}
+    , decltype(_impl_.bit_rate_){}
+    , decltype(_impl_.preload_){}
+    , decltype(_impl_.compressed_){}
+    , decltype(_impl_.streamed_){}
+    , decltype(_impl_.uncompress_on_load_){}
+    , decltype(_impl_.sample_rate_){}
+    , decltype(_impl_.bit_depth_){}
+    , decltype(_impl_.audio_group_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_name()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_extension_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_extension_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_extension()) {
+    _this->_impl_.file_extension_.Set(from._internal_file_extension(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.pan_, &from._impl_.pan_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.audio_group_) -
+    reinterpret_cast<char*>(&_impl_.pan_)) + sizeof(_impl_.audio_group_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Sound)
+}
+
+inline void Sound::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.file_extension_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.pan_){0}
+    , decltype(_impl_.volume_){0}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.kind_){0}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.effects_){0}
+    , decltype(_impl_.bit_rate_){0u}
+    , decltype(_impl_.preload_){false}
+    , decltype(_impl_.compressed_){false}
+    , decltype(_impl_.streamed_){false}
+    , decltype(_impl_.uncompress_on_load_){false}
+    , decltype(_impl_.sample_rate_){0u}
+    , decltype(_impl_.bit_depth_){0u}
+    , decltype(_impl_.audio_group_){0}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_extension_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_extension_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Sound::~Sound() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Sound)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Sound::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.file_extension_.Destroy();
+  _impl_.data_.Destroy();
+}
+
+void Sound::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Sound::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Sound)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.file_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.file_extension_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.data_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.pan_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.pan_)) + sizeof(_impl_.type_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.effects_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bit_depth_) -
+        reinterpret_cast<char*>(&_impl_.effects_)) + sizeof(_impl_.bit_depth_));
+  }
+  _impl_.audio_group_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Sound::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool preload = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_preload(&has_bits);
+          _impl_.preload_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double pan = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_pan(&has_bits);
+          _impl_.pan_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double volume = 5 [(.buffers.gmx) = "volume/volume"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_volume(&has_bits);
+          _impl_.volume_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file_name = 6 [(.buffers.gmx) = "data"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Sound.file_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file_extension = 7 [(.buffers.gmx) = "extension"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_file_extension();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Sound.file_extension");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Sound.Kind kind = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Sound_Kind_IsValid(val))) {
+            _internal_set_kind(static_cast<::buffers::resources::Sound_Kind>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(8, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Sound.Type type = 9 [(.buffers.gmx) = "types/type"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Sound_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::buffers::resources::Sound_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(9, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string data = 10 [(.buffers.file_path) = true, (.buffers.gmx) = "origname"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.resources.Sound.data");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 effects = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_effects(&has_bits);
+          _impl_.effects_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bit_rate = 12 [(.buffers.gmx) = "bitRates/bitRate"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_bit_rate(&has_bits);
+          _impl_.bit_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sample_rate = 13 [(.buffers.gmx) = "sampleRates/sampleRate"];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_sample_rate(&has_bits);
+          _impl_.sample_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bit_depth = 14 [(.buffers.gmx) = "bitDepths/bitDepth"];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_bit_depth(&has_bits);
+          _impl_.bit_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool compressed = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_compressed(&has_bits);
+          _impl_.compressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool streamed = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_streamed(&has_bits);
+          _impl_.streamed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool uncompress_on_load = 17 [(.buffers.gmx) = "uncompressOnLoad"];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_uncompress_on_load(&has_bits);
+          _impl_.uncompress_on_load_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 audio_group = 18 [(.buffers.gmx) = "audioGroup"];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_audio_group(&has_bits);
+          _impl_.audio_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Sound::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Sound)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // optional bool preload = 3;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_preload(), target);
+  }
+
+  // optional double pan = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_pan(), target);
+  }
+
+  // optional double volume = 5 [(.buffers.gmx) = "volume/volume"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_volume(), target);
+  }
+
+  // optional string file_name = 6 [(.buffers.gmx) = "data"];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Sound.file_name");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_file_name(), target);
+  }
+
+  // optional string file_extension = 7 [(.buffers.gmx) = "extension"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_extension().data(), static_cast<int>(this->_internal_file_extension().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Sound.file_extension");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_file_extension(), target);
+  }
+
+  // optional .buffers.resources.Sound.Kind kind = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_kind(), target);
+  }
+
+  // optional .buffers.resources.Sound.Type type = 9 [(.buffers.gmx) = "types/type"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_type(), target);
+  }
+
+  // optional string data = 10 [(.buffers.file_path) = true, (.buffers.gmx) = "origname"];
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Sound.data");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_data(), target);
+  }
+
+  // optional int32 effects = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_effects(), target);
+  }
+
+  // optional uint32 bit_rate = 12 [(.buffers.gmx) = "bitRates/bitRate"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_bit_rate(), target);
+  }
+
+  // optional uint32 sample_rate = 13 [(.buffers.gmx) = "sampleRates/sampleRate"];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_sample_rate(), target);
+  }
+
+  // optional uint32 bit_depth = 14 [(.buffers.gmx) = "bitDepths/bitDepth"];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(14, this->_internal_bit_depth(), target);
+  }
+
+  // optional bool compressed = 15;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_compressed(), target);
+  }
+
+  // optional bool streamed = 16;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_streamed(), target);
+  }
+
+  // optional bool uncompress_on_load = 17 [(.buffers.gmx) = "uncompressOnLoad"];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_uncompress_on_load(), target);
+  }
+
+  // optional int32 audio_group = 18 [(.buffers.gmx) = "audioGroup"];
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_audio_group(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Sound)
+  return target;
+}
+
+size_t Sound::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Sound)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string file_name = 6 [(.buffers.gmx) = "data"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_file_name());
+    }
+
+    // optional string file_extension = 7 [(.buffers.gmx) = "extension"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_file_extension());
+    }
+
+    // optional string data = 10 [(.buffers.file_path) = true, (.buffers.gmx) = "origname"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_data());
+    }
+
+    // optional double pan = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double volume = 5 [(.buffers.gmx) = "volume/volume"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional .buffers.resources.Sound.Kind kind = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_kind());
+    }
+
+    // optional .buffers.resources.Sound.Type type = 9 [(.buffers.gmx) = "types/type"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional int32 effects = 11;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_effects());
+    }
+
+    // optional uint32 bit_rate = 12 [(.buffers.gmx) = "bitRates/bitRate"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bit_rate());
+    }
+
+    // optional bool preload = 3;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool compressed = 15;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool streamed = 16;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional bool uncompress_on_load = 17 [(.buffers.gmx) = "uncompressOnLoad"];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint32 sample_rate = 13 [(.buffers.gmx) = "sampleRates/sampleRate"];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sample_rate());
+    }
+
+    // optional uint32 bit_depth = 14 [(.buffers.gmx) = "bitDepths/bitDepth"];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bit_depth());
+    }
+
+  }
+  // optional int32 audio_group = 18 [(.buffers.gmx) = "audioGroup"];
+  if (cached_has_bits & 0x00010000u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_audio_group());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Sound::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Sound::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Sound::GetClassData() const { return &_class_data_; }
+
+
+void Sound::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Sound*>(&to_msg);
+  auto& from = static_cast<const Sound&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Sound)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_file_name(from._internal_file_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_file_extension(from._internal_file_extension());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.pan_ = from._impl_.pan_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.volume_ = from._impl_.volume_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.kind_ = from._impl_.kind_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.effects_ = from._impl_.effects_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.bit_rate_ = from._impl_.bit_rate_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.preload_ = from._impl_.preload_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.compressed_ = from._impl_.compressed_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.streamed_ = from._impl_.streamed_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.uncompress_on_load_ = from._impl_.uncompress_on_load_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.sample_rate_ = from._impl_.sample_rate_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.bit_depth_ = from._impl_.bit_depth_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_audio_group(from._internal_audio_group());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Sound::CopyFrom(const Sound& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Sound)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Sound::IsInitialized() const {
+  return true;
+}
+
+void Sound::InternalSwap(Sound* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_extension_, lhs_arena,
+      &other->_impl_.file_extension_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Sound, _impl_.audio_group_)
+      + sizeof(Sound::_impl_.audio_group_)
+      - PROTOBUF_FIELD_OFFSET(Sound, _impl_.pan_)>(
+          reinterpret_cast<char*>(&_impl_.pan_),
+          reinterpret_cast<char*>(&other->_impl_.pan_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Sound::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fSound_2eproto_getter, &descriptor_table_resources_2fSound_2eproto_once,
+      file_level_metadata_resources_2fSound_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Sound*
+Arena::CreateMaybeMessage< ::buffers::resources::Sound >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Sound >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1228 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Sound.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fSound_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fSound_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fSound_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fSound_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fSound_2eproto;
+namespace buffers {
+namespace resources {
+class Sound;
+struct SoundDefaultTypeInternal;
+extern SoundDefaultTypeInternal _Sound_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Sound* Arena::CreateMaybeMessage<::buffers::resources::Sound>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+enum Sound_Kind : int {
+  Sound_Kind_NORMAL = 0,
+  Sound_Kind_BACKGROUND_MUSIC = 1,
+  Sound_Kind_THREE_DIMENSIONAL = 2,
+  Sound_Kind_MULTIMEDIA_PLAYER = 3
+};
+bool Sound_Kind_IsValid(int value);
+constexpr Sound_Kind Sound_Kind_Kind_MIN = Sound_Kind_NORMAL;
+constexpr Sound_Kind Sound_Kind_Kind_MAX = Sound_Kind_MULTIMEDIA_PLAYER;
+constexpr int Sound_Kind_Kind_ARRAYSIZE = Sound_Kind_Kind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sound_Kind_descriptor();
+template<typename T>
+inline const std::string& Sound_Kind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Sound_Kind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Sound_Kind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Sound_Kind_descriptor(), enum_t_value);
+}
+inline bool Sound_Kind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Sound_Kind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Sound_Kind>(
+    Sound_Kind_descriptor(), name, value);
+}
+enum Sound_Type : int {
+  Sound_Type_MONO = 0,
+  Sound_Type_STEREO = 1,
+  Sound_Type_POSITIONAL = 2
+};
+bool Sound_Type_IsValid(int value);
+constexpr Sound_Type Sound_Type_Type_MIN = Sound_Type_MONO;
+constexpr Sound_Type Sound_Type_Type_MAX = Sound_Type_POSITIONAL;
+constexpr int Sound_Type_Type_ARRAYSIZE = Sound_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sound_Type_descriptor();
+template<typename T>
+inline const std::string& Sound_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Sound_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Sound_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Sound_Type_descriptor(), enum_t_value);
+}
+inline bool Sound_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Sound_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Sound_Type>(
+    Sound_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class Sound final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Sound) */ {
+ public:
+  inline Sound() : Sound(nullptr) {}
+  ~Sound() override;
+  explicit PROTOBUF_CONSTEXPR Sound(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Sound(const Sound& from);
+  Sound(Sound&& from) noexcept
+    : Sound() {
+    *this = ::std::move(from);
+  }
+
+  inline Sound& operator=(const Sound& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Sound& operator=(Sound&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Sound& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Sound* internal_default_instance() {
+    return reinterpret_cast<const Sound*>(
+               &_Sound_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Sound& a, Sound& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Sound* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Sound* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Sound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Sound>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Sound& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Sound& from) {
+    Sound::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Sound* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Sound";
+  }
+  protected:
+  explicit Sound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Sound_Kind Kind;
+  static constexpr Kind NORMAL =
+    Sound_Kind_NORMAL;
+  static constexpr Kind BACKGROUND_MUSIC =
+    Sound_Kind_BACKGROUND_MUSIC;
+  static constexpr Kind THREE_DIMENSIONAL =
+    Sound_Kind_THREE_DIMENSIONAL;
+  static constexpr Kind MULTIMEDIA_PLAYER =
+    Sound_Kind_MULTIMEDIA_PLAYER;
+  static inline bool Kind_IsValid(int value) {
+    return Sound_Kind_IsValid(value);
+  }
+  static constexpr Kind Kind_MIN =
+    Sound_Kind_Kind_MIN;
+  static constexpr Kind Kind_MAX =
+    Sound_Kind_Kind_MAX;
+  static constexpr int Kind_ARRAYSIZE =
+    Sound_Kind_Kind_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Kind_descriptor() {
+    return Sound_Kind_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Kind_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Kind>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Kind_Name.");
+    return Sound_Kind_Name(enum_t_value);
+  }
+  static inline bool Kind_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Kind* value) {
+    return Sound_Kind_Parse(name, value);
+  }
+
+  typedef Sound_Type Type;
+  static constexpr Type MONO =
+    Sound_Type_MONO;
+  static constexpr Type STEREO =
+    Sound_Type_STEREO;
+  static constexpr Type POSITIONAL =
+    Sound_Type_POSITIONAL;
+  static inline bool Type_IsValid(int value) {
+    return Sound_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    Sound_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    Sound_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    Sound_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return Sound_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Sound_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return Sound_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 6,
+    kFileExtensionFieldNumber = 7,
+    kDataFieldNumber = 10,
+    kPanFieldNumber = 4,
+    kVolumeFieldNumber = 5,
+    kIdFieldNumber = 2,
+    kKindFieldNumber = 8,
+    kTypeFieldNumber = 9,
+    kEffectsFieldNumber = 11,
+    kBitRateFieldNumber = 12,
+    kPreloadFieldNumber = 3,
+    kCompressedFieldNumber = 15,
+    kStreamedFieldNumber = 16,
+    kUncompressOnLoadFieldNumber = 17,
+    kSampleRateFieldNumber = 13,
+    kBitDepthFieldNumber = 14,
+    kAudioGroupFieldNumber = 18,
+  };
+  // optional string file_name = 6 [(.buffers.gmx) = "data"];
+  bool has_file_name() const;
+  private:
+  bool _internal_has_file_name() const;
+  public:
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // optional string file_extension = 7 [(.buffers.gmx) = "extension"];
+  bool has_file_extension() const;
+  private:
+  bool _internal_has_file_extension() const;
+  public:
+  void clear_file_extension();
+  const std::string& file_extension() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_extension(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_extension();
+  PROTOBUF_NODISCARD std::string* release_file_extension();
+  void set_allocated_file_extension(std::string* file_extension);
+  private:
+  const std::string& _internal_file_extension() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_extension(const std::string& value);
+  std::string* _internal_mutable_file_extension();
+  public:
+
+  // optional string data = 10 [(.buffers.file_path) = true, (.buffers.gmx) = "origname"];
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional double pan = 4;
+  bool has_pan() const;
+  private:
+  bool _internal_has_pan() const;
+  public:
+  void clear_pan();
+  double pan() const;
+  void set_pan(double value);
+  private:
+  double _internal_pan() const;
+  void _internal_set_pan(double value);
+  public:
+
+  // optional double volume = 5 [(.buffers.gmx) = "volume/volume"];
+  bool has_volume() const;
+  private:
+  bool _internal_has_volume() const;
+  public:
+  void clear_volume();
+  double volume() const;
+  void set_volume(double value);
+  private:
+  double _internal_volume() const;
+  void _internal_set_volume(double value);
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional .buffers.resources.Sound.Kind kind = 8;
+  bool has_kind() const;
+  private:
+  bool _internal_has_kind() const;
+  public:
+  void clear_kind();
+  ::buffers::resources::Sound_Kind kind() const;
+  void set_kind(::buffers::resources::Sound_Kind value);
+  private:
+  ::buffers::resources::Sound_Kind _internal_kind() const;
+  void _internal_set_kind(::buffers::resources::Sound_Kind value);
+  public:
+
+  // optional .buffers.resources.Sound.Type type = 9 [(.buffers.gmx) = "types/type"];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::buffers::resources::Sound_Type type() const;
+  void set_type(::buffers::resources::Sound_Type value);
+  private:
+  ::buffers::resources::Sound_Type _internal_type() const;
+  void _internal_set_type(::buffers::resources::Sound_Type value);
+  public:
+
+  // optional int32 effects = 11;
+  bool has_effects() const;
+  private:
+  bool _internal_has_effects() const;
+  public:
+  void clear_effects();
+  int32_t effects() const;
+  void set_effects(int32_t value);
+  private:
+  int32_t _internal_effects() const;
+  void _internal_set_effects(int32_t value);
+  public:
+
+  // optional uint32 bit_rate = 12 [(.buffers.gmx) = "bitRates/bitRate"];
+  bool has_bit_rate() const;
+  private:
+  bool _internal_has_bit_rate() const;
+  public:
+  void clear_bit_rate();
+  uint32_t bit_rate() const;
+  void set_bit_rate(uint32_t value);
+  private:
+  uint32_t _internal_bit_rate() const;
+  void _internal_set_bit_rate(uint32_t value);
+  public:
+
+  // optional bool preload = 3;
+  bool has_preload() const;
+  private:
+  bool _internal_has_preload() const;
+  public:
+  void clear_preload();
+  bool preload() const;
+  void set_preload(bool value);
+  private:
+  bool _internal_preload() const;
+  void _internal_set_preload(bool value);
+  public:
+
+  // optional bool compressed = 15;
+  bool has_compressed() const;
+  private:
+  bool _internal_has_compressed() const;
+  public:
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
+  // optional bool streamed = 16;
+  bool has_streamed() const;
+  private:
+  bool _internal_has_streamed() const;
+  public:
+  void clear_streamed();
+  bool streamed() const;
+  void set_streamed(bool value);
+  private:
+  bool _internal_streamed() const;
+  void _internal_set_streamed(bool value);
+  public:
+
+  // optional bool uncompress_on_load = 17 [(.buffers.gmx) = "uncompressOnLoad"];
+  bool has_uncompress_on_load() const;
+  private:
+  bool _internal_has_uncompress_on_load() const;
+  public:
+  void clear_uncompress_on_load();
+  bool uncompress_on_load() const;
+  void set_uncompress_on_load(bool value);
+  private:
+  bool _internal_uncompress_on_load() const;
+  void _internal_set_uncompress_on_load(bool value);
+  public:
+
+  // optional uint32 sample_rate = 13 [(.buffers.gmx) = "sampleRates/sampleRate"];
+  bool has_sample_rate() const;
+  private:
+  bool _internal_has_sample_rate() const;
+  public:
+  void clear_sample_rate();
+  uint32_t sample_rate() const;
+  void set_sample_rate(uint32_t value);
+  private:
+  uint32_t _internal_sample_rate() const;
+  void _internal_set_sample_rate(uint32_t value);
+  public:
+
+  // optional uint32 bit_depth = 14 [(.buffers.gmx) = "bitDepths/bitDepth"];
+  bool has_bit_depth() const;
+  private:
+  bool _internal_has_bit_depth() const;
+  public:
+  void clear_bit_depth();
+  uint32_t bit_depth() const;
+  void set_bit_depth(uint32_t value);
+  private:
+  uint32_t _internal_bit_depth() const;
+  void _internal_set_bit_depth(uint32_t value);
+  public:
+
+  // optional int32 audio_group = 18 [(.buffers.gmx) = "audioGroup"];
+  bool has_audio_group() const;
+  private:
+  bool _internal_has_audio_group() const;
+  public:
+  void clear_audio_group();
+  int32_t audio_group() const;
+  void set_audio_group(int32_t value);
+  private:
+  int32_t _internal_audio_group() const;
+  void _internal_set_audio_group(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Sound)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_extension_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    double pan_;
+    double volume_;
+    int32_t id_;
+    int kind_;
+    int type_;
+    int32_t effects_;
+    uint32_t bit_rate_;
+    bool preload_;
+    bool compressed_;
+    bool streamed_;
+    bool uncompress_on_load_;
+    uint32_t sample_rate_;
+    uint32_t bit_depth_;
+    int32_t audio_group_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fSound_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Sound
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Sound::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Sound::has_id() const {
+  return _internal_has_id();
+}
+inline void Sound::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Sound::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Sound::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.id)
+  return _internal_id();
+}
+inline void Sound::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.id_ = value;
+}
+inline void Sound::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.id)
+}
+
+// optional bool preload = 3;
+inline bool Sound::_internal_has_preload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Sound::has_preload() const {
+  return _internal_has_preload();
+}
+inline void Sound::clear_preload() {
+  _impl_.preload_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool Sound::_internal_preload() const {
+  return _impl_.preload_;
+}
+inline bool Sound::preload() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.preload)
+  return _internal_preload();
+}
+inline void Sound::_internal_set_preload(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.preload_ = value;
+}
+inline void Sound::set_preload(bool value) {
+  _internal_set_preload(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.preload)
+}
+
+// optional double pan = 4;
+inline bool Sound::_internal_has_pan() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Sound::has_pan() const {
+  return _internal_has_pan();
+}
+inline void Sound::clear_pan() {
+  _impl_.pan_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Sound::_internal_pan() const {
+  return _impl_.pan_;
+}
+inline double Sound::pan() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.pan)
+  return _internal_pan();
+}
+inline void Sound::_internal_set_pan(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.pan_ = value;
+}
+inline void Sound::set_pan(double value) {
+  _internal_set_pan(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.pan)
+}
+
+// optional double volume = 5 [(.buffers.gmx) = "volume/volume"];
+inline bool Sound::_internal_has_volume() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Sound::has_volume() const {
+  return _internal_has_volume();
+}
+inline void Sound::clear_volume() {
+  _impl_.volume_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Sound::_internal_volume() const {
+  return _impl_.volume_;
+}
+inline double Sound::volume() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.volume)
+  return _internal_volume();
+}
+inline void Sound::_internal_set_volume(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.volume_ = value;
+}
+inline void Sound::set_volume(double value) {
+  _internal_set_volume(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.volume)
+}
+
+// optional string file_name = 6 [(.buffers.gmx) = "data"];
+inline bool Sound::_internal_has_file_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Sound::has_file_name() const {
+  return _internal_has_file_name();
+}
+inline void Sound::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Sound::file_name() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sound::set_file_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.file_name)
+}
+inline std::string* Sound::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Sound.file_name)
+  return _s;
+}
+inline const std::string& Sound::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void Sound::_internal_set_file_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sound::_internal_mutable_file_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sound::release_file_name() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Sound.file_name)
+  if (!_internal_has_file_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.file_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sound::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Sound.file_name)
+}
+
+// optional string file_extension = 7 [(.buffers.gmx) = "extension"];
+inline bool Sound::_internal_has_file_extension() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Sound::has_file_extension() const {
+  return _internal_has_file_extension();
+}
+inline void Sound::clear_file_extension() {
+  _impl_.file_extension_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Sound::file_extension() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.file_extension)
+  return _internal_file_extension();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sound::set_file_extension(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.file_extension_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.file_extension)
+}
+inline std::string* Sound::mutable_file_extension() {
+  std::string* _s = _internal_mutable_file_extension();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Sound.file_extension)
+  return _s;
+}
+inline const std::string& Sound::_internal_file_extension() const {
+  return _impl_.file_extension_.Get();
+}
+inline void Sound::_internal_set_file_extension(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.file_extension_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sound::_internal_mutable_file_extension() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.file_extension_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sound::release_file_extension() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Sound.file_extension)
+  if (!_internal_has_file_extension()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.file_extension_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_extension_.IsDefault()) {
+    _impl_.file_extension_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sound::set_allocated_file_extension(std::string* file_extension) {
+  if (file_extension != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.file_extension_.SetAllocated(file_extension, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_extension_.IsDefault()) {
+    _impl_.file_extension_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Sound.file_extension)
+}
+
+// optional .buffers.resources.Sound.Kind kind = 8;
+inline bool Sound::_internal_has_kind() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Sound::has_kind() const {
+  return _internal_has_kind();
+}
+inline void Sound::clear_kind() {
+  _impl_.kind_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::buffers::resources::Sound_Kind Sound::_internal_kind() const {
+  return static_cast< ::buffers::resources::Sound_Kind >(_impl_.kind_);
+}
+inline ::buffers::resources::Sound_Kind Sound::kind() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.kind)
+  return _internal_kind();
+}
+inline void Sound::_internal_set_kind(::buffers::resources::Sound_Kind value) {
+  assert(::buffers::resources::Sound_Kind_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.kind_ = value;
+}
+inline void Sound::set_kind(::buffers::resources::Sound_Kind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.kind)
+}
+
+// optional .buffers.resources.Sound.Type type = 9 [(.buffers.gmx) = "types/type"];
+inline bool Sound::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Sound::has_type() const {
+  return _internal_has_type();
+}
+inline void Sound::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::buffers::resources::Sound_Type Sound::_internal_type() const {
+  return static_cast< ::buffers::resources::Sound_Type >(_impl_.type_);
+}
+inline ::buffers::resources::Sound_Type Sound::type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.type)
+  return _internal_type();
+}
+inline void Sound::_internal_set_type(::buffers::resources::Sound_Type value) {
+  assert(::buffers::resources::Sound_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.type_ = value;
+}
+inline void Sound::set_type(::buffers::resources::Sound_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.type)
+}
+
+// optional string data = 10 [(.buffers.file_path) = true, (.buffers.gmx) = "origname"];
+inline bool Sound::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Sound::has_data() const {
+  return _internal_has_data();
+}
+inline void Sound::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Sound::data() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sound::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.data_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.data)
+}
+inline std::string* Sound::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Sound.data)
+  return _s;
+}
+inline const std::string& Sound::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void Sound::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sound::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sound::release_data() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Sound.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sound::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Sound.data)
+}
+
+// optional int32 effects = 11;
+inline bool Sound::_internal_has_effects() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Sound::has_effects() const {
+  return _internal_has_effects();
+}
+inline void Sound::clear_effects() {
+  _impl_.effects_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t Sound::_internal_effects() const {
+  return _impl_.effects_;
+}
+inline int32_t Sound::effects() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.effects)
+  return _internal_effects();
+}
+inline void Sound::_internal_set_effects(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.effects_ = value;
+}
+inline void Sound::set_effects(int32_t value) {
+  _internal_set_effects(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.effects)
+}
+
+// optional uint32 bit_rate = 12 [(.buffers.gmx) = "bitRates/bitRate"];
+inline bool Sound::_internal_has_bit_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Sound::has_bit_rate() const {
+  return _internal_has_bit_rate();
+}
+inline void Sound::clear_bit_rate() {
+  _impl_.bit_rate_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t Sound::_internal_bit_rate() const {
+  return _impl_.bit_rate_;
+}
+inline uint32_t Sound::bit_rate() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.bit_rate)
+  return _internal_bit_rate();
+}
+inline void Sound::_internal_set_bit_rate(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.bit_rate_ = value;
+}
+inline void Sound::set_bit_rate(uint32_t value) {
+  _internal_set_bit_rate(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.bit_rate)
+}
+
+// optional uint32 sample_rate = 13 [(.buffers.gmx) = "sampleRates/sampleRate"];
+inline bool Sound::_internal_has_sample_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Sound::has_sample_rate() const {
+  return _internal_has_sample_rate();
+}
+inline void Sound::clear_sample_rate() {
+  _impl_.sample_rate_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t Sound::_internal_sample_rate() const {
+  return _impl_.sample_rate_;
+}
+inline uint32_t Sound::sample_rate() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.sample_rate)
+  return _internal_sample_rate();
+}
+inline void Sound::_internal_set_sample_rate(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.sample_rate_ = value;
+}
+inline void Sound::set_sample_rate(uint32_t value) {
+  _internal_set_sample_rate(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.sample_rate)
+}
+
+// optional uint32 bit_depth = 14 [(.buffers.gmx) = "bitDepths/bitDepth"];
+inline bool Sound::_internal_has_bit_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Sound::has_bit_depth() const {
+  return _internal_has_bit_depth();
+}
+inline void Sound::clear_bit_depth() {
+  _impl_.bit_depth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint32_t Sound::_internal_bit_depth() const {
+  return _impl_.bit_depth_;
+}
+inline uint32_t Sound::bit_depth() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.bit_depth)
+  return _internal_bit_depth();
+}
+inline void Sound::_internal_set_bit_depth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.bit_depth_ = value;
+}
+inline void Sound::set_bit_depth(uint32_t value) {
+  _internal_set_bit_depth(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.bit_depth)
+}
+
+// optional bool compressed = 15;
+inline bool Sound::_internal_has_compressed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Sound::has_compressed() const {
+  return _internal_has_compressed();
+}
+inline void Sound::clear_compressed() {
+  _impl_.compressed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool Sound::_internal_compressed() const {
+  return _impl_.compressed_;
+}
+inline bool Sound::compressed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.compressed)
+  return _internal_compressed();
+}
+inline void Sound::_internal_set_compressed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.compressed_ = value;
+}
+inline void Sound::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.compressed)
+}
+
+// optional bool streamed = 16;
+inline bool Sound::_internal_has_streamed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Sound::has_streamed() const {
+  return _internal_has_streamed();
+}
+inline void Sound::clear_streamed() {
+  _impl_.streamed_ = false;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline bool Sound::_internal_streamed() const {
+  return _impl_.streamed_;
+}
+inline bool Sound::streamed() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.streamed)
+  return _internal_streamed();
+}
+inline void Sound::_internal_set_streamed(bool value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.streamed_ = value;
+}
+inline void Sound::set_streamed(bool value) {
+  _internal_set_streamed(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.streamed)
+}
+
+// optional bool uncompress_on_load = 17 [(.buffers.gmx) = "uncompressOnLoad"];
+inline bool Sound::_internal_has_uncompress_on_load() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Sound::has_uncompress_on_load() const {
+  return _internal_has_uncompress_on_load();
+}
+inline void Sound::clear_uncompress_on_load() {
+  _impl_.uncompress_on_load_ = false;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline bool Sound::_internal_uncompress_on_load() const {
+  return _impl_.uncompress_on_load_;
+}
+inline bool Sound::uncompress_on_load() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.uncompress_on_load)
+  return _internal_uncompress_on_load();
+}
+inline void Sound::_internal_set_uncompress_on_load(bool value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.uncompress_on_load_ = value;
+}
+inline void Sound::set_uncompress_on_load(bool value) {
+  _internal_set_uncompress_on_load(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.uncompress_on_load)
+}
+
+// optional int32 audio_group = 18 [(.buffers.gmx) = "audioGroup"];
+inline bool Sound::_internal_has_audio_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Sound::has_audio_group() const {
+  return _internal_has_audio_group();
+}
+inline void Sound::clear_audio_group() {
+  _impl_.audio_group_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t Sound::_internal_audio_group() const {
+  return _impl_.audio_group_;
+}
+inline int32_t Sound::audio_group() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sound.audio_group)
+  return _internal_audio_group();
+}
+inline void Sound::_internal_set_audio_group(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.audio_group_ = value;
+}
+inline void Sound::set_audio_group(int32_t value) {
+  _internal_set_audio_group(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sound.audio_group)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::resources::Sound_Kind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Sound_Kind>() {
+  return ::buffers::resources::Sound_Kind_descriptor();
+}
+template <> struct is_proto_enum< ::buffers::resources::Sound_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Sound_Type>() {
+  return ::buffers::resources::Sound_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fSound_2eproto
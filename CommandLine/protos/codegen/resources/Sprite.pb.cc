@@ -0,0 +1,1087 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Sprite.proto
+
+#include "resources/Sprite.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Sprite::Sprite(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.subimages_)*/{}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.preload_)*/false
+  , /*decltype(_impl_.transparent_)*/false
+  , /*decltype(_impl_.smooth_edges_)*/false
+  , /*decltype(_impl_.separate_mask_)*/false
+  , /*decltype(_impl_.alpha_tolerance_)*/0
+  , /*decltype(_impl_.origin_x_)*/0
+  , /*decltype(_impl_.origin_y_)*/0
+  , /*decltype(_impl_.shape_)*/0
+  , /*decltype(_impl_.bbox_mode_)*/0
+  , /*decltype(_impl_.bbox_left_)*/0
+  , /*decltype(_impl_.bbox_right_)*/0
+  , /*decltype(_impl_.bbox_top_)*/0
+  , /*decltype(_impl_.bbox_bottom_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.h_tile_)*/0
+  , /*decltype(_impl_.v_tile_)*/0
+  , /*decltype(_impl_.texture_group_)*/0
+  , /*decltype(_impl_.for3d_)*/false
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.height_)*/0u} {}
+struct SpriteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpriteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpriteDefaultTypeInternal() {}
+  union {
+    Sprite _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpriteDefaultTypeInternal _Sprite_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fSprite_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_resources_2fSprite_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fSprite_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fSprite_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.preload_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.transparent_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.smooth_edges_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.alpha_tolerance_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.separate_mask_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.origin_x_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.origin_y_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.bbox_mode_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.bbox_left_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.bbox_right_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.bbox_top_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.bbox_bottom_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.h_tile_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.v_tile_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.texture_group_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.for3d_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Sprite, _impl_.subimages_),
+  0,
+  1,
+  2,
+  3,
+  5,
+  4,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  19,
+  20,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 28, -1, sizeof(::buffers::resources::Sprite)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Sprite_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fSprite_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026resources/Sprite.proto\022\021buffers.resour"
+  "ces\032\roptions.proto\"\323\006\n\006Sprite\022\036\n\002id\030\002 \001("
+  "\005B\022\222\265\030\016GMX_DEPRECATED\022#\n\007preload\030\004 \001(\010B\022"
+  "\222\265\030\016GMX_DEPRECATED\022\'\n\013transparent\030\005 \001(\010B"
+  "\022\222\265\030\016GMX_DEPRECATED\022(\n\014smooth_edges\030\006 \001("
+  "\010B\022\222\265\030\016GMX_DEPRECATED\022)\n\017alpha_tolerance"
+  "\030\007 \001(\005B\020\222\265\030\014coltolerance\022#\n\rseparate_mas"
+  "k\030\010 \001(\010B\014\222\265\030\010sepmasks\022\033\n\010origin_x\030\t \001(\005B"
+  "\t\222\265\030\005xorig\022\035\n\010origin_y\030\n \001(\005B\013\222\265\030\007yorigi"
+  "n\022;\n\005shape\030\013 \001(\0162\037.buffers.resources.Spr"
+  "ite.ShapeB\013\222\265\030\007colkind\022F\n\tbbox_mode\030\014 \001("
+  "\0162%.buffers.resources.Sprite.BoundingBox"
+  "B\014\222\265\030\010bboxmode\022\021\n\tbbox_left\030\r \001(\005\022\022\n\nbbo"
+  "x_right\030\016 \001(\005\022\020\n\010bbox_top\030\017 \001(\005\022\023\n\013bbox_"
+  "bottom\030\020 \001(\005\022\014\n\004type\030\021 \001(\005\022\031\n\006h_tile\030\022 \001"
+  "(\005B\t\222\265\030\005HTile\022\031\n\006v_tile\030\023 \001(\005B\t\222\265\030\005VTile"
+  "\0226\n\rtexture_group\030\024 \001(\005B\037\222\265\030\033TextureGrou"
+  "ps/TextureGroup0\022\030\n\005for3D\030\025 \001(\010B\t\222\265\030\005For"
+  "3D\022\r\n\005width\030\026 \001(\r\022\016\n\006height\030\027 \001(\r\022\'\n\tsub"
+  "images\030\003 \003(\tB\024\222\265\030\014frames/frame\210\265\030\001\":\n\005Sh"
+  "ape\022\013\n\007PRECISE\020\000\022\r\n\tRECTANGLE\020\001\022\010\n\004DISK\020"
+  "\002\022\013\n\007DIAMOND\020\003\"8\n\013BoundingBox\022\r\n\tAUTOMAT"
+  "IC\020\000\022\016\n\nFULL_IMAGE\020\001\022\n\n\006MANUAL\020\002"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fSprite_2eproto_deps[1] = {
+  &::descriptor_table_options_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fSprite_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fSprite_2eproto = {
+    false, false, 912, descriptor_table_protodef_resources_2fSprite_2eproto,
+    "resources/Sprite.proto",
+    &descriptor_table_resources_2fSprite_2eproto_once, descriptor_table_resources_2fSprite_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_resources_2fSprite_2eproto::offsets,
+    file_level_metadata_resources_2fSprite_2eproto, file_level_enum_descriptors_resources_2fSprite_2eproto,
+    file_level_service_descriptors_resources_2fSprite_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fSprite_2eproto_getter() {
+  return &descriptor_table_resources_2fSprite_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fSprite_2eproto(&descriptor_table_resources_2fSprite_2eproto);
+namespace buffers {
+namespace resources {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sprite_Shape_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fSprite_2eproto);
+  return file_level_enum_descriptors_resources_2fSprite_2eproto[0];
+}
+bool Sprite_Shape_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Sprite_Shape Sprite::PRECISE;
+constexpr Sprite_Shape Sprite::RECTANGLE;
+constexpr Sprite_Shape Sprite::DISK;
+constexpr Sprite_Shape Sprite::DIAMOND;
+constexpr Sprite_Shape Sprite::Shape_MIN;
+constexpr Sprite_Shape Sprite::Shape_MAX;
+constexpr int Sprite::Shape_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sprite_BoundingBox_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resources_2fSprite_2eproto);
+  return file_level_enum_descriptors_resources_2fSprite_2eproto[1];
+}
+bool Sprite_BoundingBox_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Sprite_BoundingBox Sprite::AUTOMATIC;
+constexpr Sprite_BoundingBox Sprite::FULL_IMAGE;
+constexpr Sprite_BoundingBox Sprite::MANUAL;
+constexpr Sprite_BoundingBox Sprite::BoundingBox_MIN;
+constexpr Sprite_BoundingBox Sprite::BoundingBox_MAX;
+constexpr int Sprite::BoundingBox_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Sprite::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Sprite>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_preload(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_transparent(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_smooth_edges(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_alpha_tolerance(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_separate_mask(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_origin_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_origin_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_shape(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_bbox_mode(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_bbox_left(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_bbox_right(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_bbox_top(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_bbox_bottom(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_h_tile(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_v_tile(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_texture_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_for3d(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+};
+
+Sprite::Sprite(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Sprite)
+}
+Sprite::Sprite(const Sprite& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Sprite* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subimages_){from._impl_.subimages_}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.preload_){}
+    , decltype(_impl_.transparent_){}
+    , decltype(_impl_.smooth_edges_){}
+    , decltype(_impl_.separate_mask_){}
+    , decltype(_impl_.alpha_tolerance_){}
+    , decltype(_impl_.origin_x_){}
+    , decltype(_impl_.origin_y_){}
+    , decltype(_impl_.shape_){}
+    , decltype(_impl_.bbox_mode_){}
+    , decltype(_impl_.bbox_left_){}
+    , decltype(_impl_.bbox_right_){}
+    , decltype(_impl_.bbox_top_){}
+    , decltype(_impl_.bbox_bottom_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.h_tile_){}
+    , decltype(_impl_.v_tile_){}
+    , decltype(_impl_.texture_group_){}
+    , decltype(_impl_.for3d_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Sprite)
+}
+
+inline void Sprite::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subimages_){arena}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.preload_){false}
+    , decltype(_impl_.transparent_){false}
+    , decltype(_impl_.smooth_edges_){false}
+    , decltype(_impl_.separate_mask_){false}
+    , decltype(_impl_.alpha_tolerance_){0}
+    , decltype(_impl_.origin_x_){0}
+    , decltype(_impl_.origin_y_){0}
+    , decltype(_impl_.shape_){0}
+    , decltype(_impl_.bbox_mode_){0}
+    , decltype(_impl_.bbox_left_){0}
+    , decltype(_impl_.bbox_right_){0}
+    , decltype(_impl_.bbox_top_){0}
+    , decltype(_impl_.bbox_bottom_){0}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.h_tile_){0}
+    , decltype(_impl_.v_tile_){0}
+    , decltype(_impl_.texture_group_){0}
+    , decltype(_impl_.for3d_){false}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.height_){0u}
+  };
+}
+
+Sprite::~Sprite() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Sprite)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Sprite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subimages_.~RepeatedPtrField();
+}
+
+void Sprite::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Sprite::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Sprite)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.subimages_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.origin_y_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.origin_y_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.shape_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.h_tile_) -
+        reinterpret_cast<char*>(&_impl_.shape_)) + sizeof(_impl_.h_tile_));
+  }
+  if (cached_has_bits & 0x001f0000u) {
+    ::memset(&_impl_.v_tile_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.height_) -
+        reinterpret_cast<char*>(&_impl_.v_tile_)) + sizeof(_impl_.height_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Sprite::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string subimages = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "frames/frame"];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_subimages();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "buffers.resources.Sprite.subimages");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_preload(&has_bits);
+          _impl_.preload_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_transparent(&has_bits);
+          _impl_.transparent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_smooth_edges(&has_bits);
+          _impl_.smooth_edges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 alpha_tolerance = 7 [(.buffers.gmx) = "coltolerance"];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_alpha_tolerance(&has_bits);
+          _impl_.alpha_tolerance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool separate_mask = 8 [(.buffers.gmx) = "sepmasks"];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_separate_mask(&has_bits);
+          _impl_.separate_mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 origin_x = 9 [(.buffers.gmx) = "xorig"];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_origin_x(&has_bits);
+          _impl_.origin_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 origin_y = 10 [(.buffers.gmx) = "yorigin"];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_origin_y(&has_bits);
+          _impl_.origin_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Sprite.Shape shape = 11 [(.buffers.gmx) = "colkind"];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Sprite_Shape_IsValid(val))) {
+            _internal_set_shape(static_cast<::buffers::resources::Sprite_Shape>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(11, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Sprite.BoundingBox bbox_mode = 12 [(.buffers.gmx) = "bboxmode"];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::buffers::resources::Sprite_BoundingBox_IsValid(val))) {
+            _internal_set_bbox_mode(static_cast<::buffers::resources::Sprite_BoundingBox>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(12, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 bbox_left = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_bbox_left(&has_bits);
+          _impl_.bbox_left_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 bbox_right = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_bbox_right(&has_bits);
+          _impl_.bbox_right_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 bbox_top = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_bbox_top(&has_bits);
+          _impl_.bbox_top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 bbox_bottom = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_bbox_bottom(&has_bits);
+          _impl_.bbox_bottom_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 type = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 h_tile = 18 [(.buffers.gmx) = "HTile"];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_h_tile(&has_bits);
+          _impl_.h_tile_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 v_tile = 19 [(.buffers.gmx) = "VTile"];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_v_tile(&has_bits);
+          _impl_.v_tile_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 texture_group = 20 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_texture_group(&has_bits);
+          _impl_.texture_group_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool for3D = 21 [(.buffers.gmx) = "For3D"];
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_for3d(&has_bits);
+          _impl_.for3d_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 width = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 height = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Sprite::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Sprite)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // repeated string subimages = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "frames/frame"];
+  for (int i = 0, n = this->_internal_subimages_size(); i < n; i++) {
+    const auto& s = this->_internal_subimages(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.resources.Sprite.subimages");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_preload(), target);
+  }
+
+  // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_transparent(), target);
+  }
+
+  // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_smooth_edges(), target);
+  }
+
+  // optional int32 alpha_tolerance = 7 [(.buffers.gmx) = "coltolerance"];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_alpha_tolerance(), target);
+  }
+
+  // optional bool separate_mask = 8 [(.buffers.gmx) = "sepmasks"];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_separate_mask(), target);
+  }
+
+  // optional int32 origin_x = 9 [(.buffers.gmx) = "xorig"];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_origin_x(), target);
+  }
+
+  // optional int32 origin_y = 10 [(.buffers.gmx) = "yorigin"];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_origin_y(), target);
+  }
+
+  // optional .buffers.resources.Sprite.Shape shape = 11 [(.buffers.gmx) = "colkind"];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_shape(), target);
+  }
+
+  // optional .buffers.resources.Sprite.BoundingBox bbox_mode = 12 [(.buffers.gmx) = "bboxmode"];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      12, this->_internal_bbox_mode(), target);
+  }
+
+  // optional int32 bbox_left = 13;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_bbox_left(), target);
+  }
+
+  // optional int32 bbox_right = 14;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_bbox_right(), target);
+  }
+
+  // optional int32 bbox_top = 15;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_bbox_top(), target);
+  }
+
+  // optional int32 bbox_bottom = 16;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(16, this->_internal_bbox_bottom(), target);
+  }
+
+  // optional int32 type = 17;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(17, this->_internal_type(), target);
+  }
+
+  // optional int32 h_tile = 18 [(.buffers.gmx) = "HTile"];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_h_tile(), target);
+  }
+
+  // optional int32 v_tile = 19 [(.buffers.gmx) = "VTile"];
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(19, this->_internal_v_tile(), target);
+  }
+
+  // optional int32 texture_group = 20 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(20, this->_internal_texture_group(), target);
+  }
+
+  // optional bool for3D = 21 [(.buffers.gmx) = "For3D"];
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(21, this->_internal_for3d(), target);
+  }
+
+  // optional uint32 width = 22;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(22, this->_internal_width(), target);
+  }
+
+  // optional uint32 height = 23;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(23, this->_internal_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Sprite)
+  return target;
+}
+
+size_t Sprite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Sprite)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string subimages = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "frames/frame"];
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.subimages_.size());
+  for (int i = 0, n = _impl_.subimages_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.subimages_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+    }
+
+    // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool separate_mask = 8 [(.buffers.gmx) = "sepmasks"];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 alpha_tolerance = 7 [(.buffers.gmx) = "coltolerance"];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_alpha_tolerance());
+    }
+
+    // optional int32 origin_x = 9 [(.buffers.gmx) = "xorig"];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_origin_x());
+    }
+
+    // optional int32 origin_y = 10 [(.buffers.gmx) = "yorigin"];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_origin_y());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional .buffers.resources.Sprite.Shape shape = 11 [(.buffers.gmx) = "colkind"];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_shape());
+    }
+
+    // optional .buffers.resources.Sprite.BoundingBox bbox_mode = 12 [(.buffers.gmx) = "bboxmode"];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_bbox_mode());
+    }
+
+    // optional int32 bbox_left = 13;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bbox_left());
+    }
+
+    // optional int32 bbox_right = 14;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bbox_right());
+    }
+
+    // optional int32 bbox_top = 15;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bbox_top());
+    }
+
+    // optional int32 bbox_bottom = 16;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_bbox_bottom());
+    }
+
+    // optional int32 type = 17;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_type());
+    }
+
+    // optional int32 h_tile = 18 [(.buffers.gmx) = "HTile"];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_h_tile());
+    }
+
+  }
+  if (cached_has_bits & 0x001f0000u) {
+    // optional int32 v_tile = 19 [(.buffers.gmx) = "VTile"];
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_v_tile());
+    }
+
+    // optional int32 texture_group = 20 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_texture_group());
+    }
+
+    // optional bool for3D = 21 [(.buffers.gmx) = "For3D"];
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint32 width = 22;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_width());
+    }
+
+    // optional uint32 height = 23;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_height());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Sprite::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Sprite::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Sprite::GetClassData() const { return &_class_data_; }
+
+
+void Sprite::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Sprite*>(&to_msg);
+  auto& from = static_cast<const Sprite&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Sprite)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subimages_.MergeFrom(from._impl_.subimages_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.preload_ = from._impl_.preload_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.transparent_ = from._impl_.transparent_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.smooth_edges_ = from._impl_.smooth_edges_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.separate_mask_ = from._impl_.separate_mask_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.alpha_tolerance_ = from._impl_.alpha_tolerance_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.origin_x_ = from._impl_.origin_x_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.origin_y_ = from._impl_.origin_y_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.shape_ = from._impl_.shape_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.bbox_mode_ = from._impl_.bbox_mode_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.bbox_left_ = from._impl_.bbox_left_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.bbox_right_ = from._impl_.bbox_right_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.bbox_top_ = from._impl_.bbox_top_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.bbox_bottom_ = from._impl_.bbox_bottom_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.h_tile_ = from._impl_.h_tile_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x001f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.v_tile_ = from._impl_.v_tile_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.texture_group_ = from._impl_.texture_group_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.for3d_ = from._impl_.for3d_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Sprite::CopyFrom(const Sprite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Sprite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Sprite::IsInitialized() const {
+  return true;
+}
+
+void Sprite::InternalSwap(Sprite* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.subimages_.InternalSwap(&other->_impl_.subimages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Sprite, _impl_.height_)
+      + sizeof(Sprite::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(Sprite, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Sprite::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fSprite_2eproto_getter, &descriptor_table_resources_2fSprite_2eproto_once,
+      file_level_metadata_resources_2fSprite_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Sprite*
+Arena::CreateMaybeMessage< ::buffers::resources::Sprite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Sprite >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
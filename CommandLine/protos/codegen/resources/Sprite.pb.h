@@ -0,0 +1,1366 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Sprite.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fSprite_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fSprite_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fSprite_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fSprite_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fSprite_2eproto;
+namespace buffers {
+namespace resources {
+class Sprite;
+struct SpriteDefaultTypeInternal;
+extern SpriteDefaultTypeInternal _Sprite_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Sprite* Arena::CreateMaybeMessage<::buffers::resources::Sprite>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+enum Sprite_Shape : int {
+  Sprite_Shape_PRECISE = 0,
+  Sprite_Shape_RECTANGLE = 1,
+  Sprite_Shape_DISK = 2,
+  Sprite_Shape_DIAMOND = 3
+};
+bool Sprite_Shape_IsValid(int value);
+constexpr Sprite_Shape Sprite_Shape_Shape_MIN = Sprite_Shape_PRECISE;
+constexpr Sprite_Shape Sprite_Shape_Shape_MAX = Sprite_Shape_DIAMOND;
+constexpr int Sprite_Shape_Shape_ARRAYSIZE = Sprite_Shape_Shape_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sprite_Shape_descriptor();
+template<typename T>
+inline const std::string& Sprite_Shape_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Sprite_Shape>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Sprite_Shape_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Sprite_Shape_descriptor(), enum_t_value);
+}
+inline bool Sprite_Shape_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Sprite_Shape* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Sprite_Shape>(
+    Sprite_Shape_descriptor(), name, value);
+}
+enum Sprite_BoundingBox : int {
+  Sprite_BoundingBox_AUTOMATIC = 0,
+  Sprite_BoundingBox_FULL_IMAGE = 1,
+  Sprite_BoundingBox_MANUAL = 2
+};
+bool Sprite_BoundingBox_IsValid(int value);
+constexpr Sprite_BoundingBox Sprite_BoundingBox_BoundingBox_MIN = Sprite_BoundingBox_AUTOMATIC;
+constexpr Sprite_BoundingBox Sprite_BoundingBox_BoundingBox_MAX = Sprite_BoundingBox_MANUAL;
+constexpr int Sprite_BoundingBox_BoundingBox_ARRAYSIZE = Sprite_BoundingBox_BoundingBox_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Sprite_BoundingBox_descriptor();
+template<typename T>
+inline const std::string& Sprite_BoundingBox_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Sprite_BoundingBox>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Sprite_BoundingBox_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Sprite_BoundingBox_descriptor(), enum_t_value);
+}
+inline bool Sprite_BoundingBox_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Sprite_BoundingBox* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Sprite_BoundingBox>(
+    Sprite_BoundingBox_descriptor(), name, value);
+}
+// ===================================================================
+
+class Sprite final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Sprite) */ {
+ public:
+  inline Sprite() : Sprite(nullptr) {}
+  ~Sprite() override;
+  explicit PROTOBUF_CONSTEXPR Sprite(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Sprite(const Sprite& from);
+  Sprite(Sprite&& from) noexcept
+    : Sprite() {
+    *this = ::std::move(from);
+  }
+
+  inline Sprite& operator=(const Sprite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Sprite& operator=(Sprite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Sprite& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Sprite* internal_default_instance() {
+    return reinterpret_cast<const Sprite*>(
+               &_Sprite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Sprite& a, Sprite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Sprite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Sprite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Sprite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Sprite>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Sprite& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Sprite& from) {
+    Sprite::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Sprite* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Sprite";
+  }
+  protected:
+  explicit Sprite(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Sprite_Shape Shape;
+  static constexpr Shape PRECISE =
+    Sprite_Shape_PRECISE;
+  static constexpr Shape RECTANGLE =
+    Sprite_Shape_RECTANGLE;
+  static constexpr Shape DISK =
+    Sprite_Shape_DISK;
+  static constexpr Shape DIAMOND =
+    Sprite_Shape_DIAMOND;
+  static inline bool Shape_IsValid(int value) {
+    return Sprite_Shape_IsValid(value);
+  }
+  static constexpr Shape Shape_MIN =
+    Sprite_Shape_Shape_MIN;
+  static constexpr Shape Shape_MAX =
+    Sprite_Shape_Shape_MAX;
+  static constexpr int Shape_ARRAYSIZE =
+    Sprite_Shape_Shape_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Shape_descriptor() {
+    return Sprite_Shape_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Shape_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Shape>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Shape_Name.");
+    return Sprite_Shape_Name(enum_t_value);
+  }
+  static inline bool Shape_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Shape* value) {
+    return Sprite_Shape_Parse(name, value);
+  }
+
+  typedef Sprite_BoundingBox BoundingBox;
+  static constexpr BoundingBox AUTOMATIC =
+    Sprite_BoundingBox_AUTOMATIC;
+  static constexpr BoundingBox FULL_IMAGE =
+    Sprite_BoundingBox_FULL_IMAGE;
+  static constexpr BoundingBox MANUAL =
+    Sprite_BoundingBox_MANUAL;
+  static inline bool BoundingBox_IsValid(int value) {
+    return Sprite_BoundingBox_IsValid(value);
+  }
+  static constexpr BoundingBox BoundingBox_MIN =
+    Sprite_BoundingBox_BoundingBox_MIN;
+  static constexpr BoundingBox BoundingBox_MAX =
+    Sprite_BoundingBox_BoundingBox_MAX;
+  static constexpr int BoundingBox_ARRAYSIZE =
+    Sprite_BoundingBox_BoundingBox_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  BoundingBox_descriptor() {
+    return Sprite_BoundingBox_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& BoundingBox_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, BoundingBox>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function BoundingBox_Name.");
+    return Sprite_BoundingBox_Name(enum_t_value);
+  }
+  static inline bool BoundingBox_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      BoundingBox* value) {
+    return Sprite_BoundingBox_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubimagesFieldNumber = 3,
+    kIdFieldNumber = 2,
+    kPreloadFieldNumber = 4,
+    kTransparentFieldNumber = 5,
+    kSmoothEdgesFieldNumber = 6,
+    kSeparateMaskFieldNumber = 8,
+    kAlphaToleranceFieldNumber = 7,
+    kOriginXFieldNumber = 9,
+    kOriginYFieldNumber = 10,
+    kShapeFieldNumber = 11,
+    kBboxModeFieldNumber = 12,
+    kBboxLeftFieldNumber = 13,
+    kBboxRightFieldNumber = 14,
+    kBboxTopFieldNumber = 15,
+    kBboxBottomFieldNumber = 16,
+    kTypeFieldNumber = 17,
+    kHTileFieldNumber = 18,
+    kVTileFieldNumber = 19,
+    kTextureGroupFieldNumber = 20,
+    kFor3DFieldNumber = 21,
+    kWidthFieldNumber = 22,
+    kHeightFieldNumber = 23,
+  };
+  // repeated string subimages = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "frames/frame"];
+  int subimages_size() const;
+  private:
+  int _internal_subimages_size() const;
+  public:
+  void clear_subimages();
+  const std::string& subimages(int index) const;
+  std::string* mutable_subimages(int index);
+  void set_subimages(int index, const std::string& value);
+  void set_subimages(int index, std::string&& value);
+  void set_subimages(int index, const char* value);
+  void set_subimages(int index, const char* value, size_t size);
+  std::string* add_subimages();
+  void add_subimages(const std::string& value);
+  void add_subimages(std::string&& value);
+  void add_subimages(const char* value);
+  void add_subimages(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& subimages() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_subimages();
+  private:
+  const std::string& _internal_subimages(int index) const;
+  std::string* _internal_add_subimages();
+  public:
+
+  // optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_preload() const;
+  private:
+  bool _internal_has_preload() const;
+  public:
+  void clear_preload();
+  bool preload() const;
+  void set_preload(bool value);
+  private:
+  bool _internal_preload() const;
+  void _internal_set_preload(bool value);
+  public:
+
+  // optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_transparent() const;
+  private:
+  bool _internal_has_transparent() const;
+  public:
+  void clear_transparent();
+  bool transparent() const;
+  void set_transparent(bool value);
+  private:
+  bool _internal_transparent() const;
+  void _internal_set_transparent(bool value);
+  public:
+
+  // optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_smooth_edges() const;
+  private:
+  bool _internal_has_smooth_edges() const;
+  public:
+  void clear_smooth_edges();
+  bool smooth_edges() const;
+  void set_smooth_edges(bool value);
+  private:
+  bool _internal_smooth_edges() const;
+  void _internal_set_smooth_edges(bool value);
+  public:
+
+  // optional bool separate_mask = 8 [(.buffers.gmx) = "sepmasks"];
+  bool has_separate_mask() const;
+  private:
+  bool _internal_has_separate_mask() const;
+  public:
+  void clear_separate_mask();
+  bool separate_mask() const;
+  void set_separate_mask(bool value);
+  private:
+  bool _internal_separate_mask() const;
+  void _internal_set_separate_mask(bool value);
+  public:
+
+  // optional int32 alpha_tolerance = 7 [(.buffers.gmx) = "coltolerance"];
+  bool has_alpha_tolerance() const;
+  private:
+  bool _internal_has_alpha_tolerance() const;
+  public:
+  void clear_alpha_tolerance();
+  int32_t alpha_tolerance() const;
+  void set_alpha_tolerance(int32_t value);
+  private:
+  int32_t _internal_alpha_tolerance() const;
+  void _internal_set_alpha_tolerance(int32_t value);
+  public:
+
+  // optional int32 origin_x = 9 [(.buffers.gmx) = "xorig"];
+  bool has_origin_x() const;
+  private:
+  bool _internal_has_origin_x() const;
+  public:
+  void clear_origin_x();
+  int32_t origin_x() const;
+  void set_origin_x(int32_t value);
+  private:
+  int32_t _internal_origin_x() const;
+  void _internal_set_origin_x(int32_t value);
+  public:
+
+  // optional int32 origin_y = 10 [(.buffers.gmx) = "yorigin"];
+  bool has_origin_y() const;
+  private:
+  bool _internal_has_origin_y() const;
+  public:
+  void clear_origin_y();
+  int32_t origin_y() const;
+  void set_origin_y(int32_t value);
+  private:
+  int32_t _internal_origin_y() const;
+  void _internal_set_origin_y(int32_t value);
+  public:
+
+  // optional .buffers.resources.Sprite.Shape shape = 11 [(.buffers.gmx) = "colkind"];
+  bool has_shape() const;
+  private:
+  bool _internal_has_shape() const;
+  public:
+  void clear_shape();
+  ::buffers::resources::Sprite_Shape shape() const;
+  void set_shape(::buffers::resources::Sprite_Shape value);
+  private:
+  ::buffers::resources::Sprite_Shape _internal_shape() const;
+  void _internal_set_shape(::buffers::resources::Sprite_Shape value);
+  public:
+
+  // optional .buffers.resources.Sprite.BoundingBox bbox_mode = 12 [(.buffers.gmx) = "bboxmode"];
+  bool has_bbox_mode() const;
+  private:
+  bool _internal_has_bbox_mode() const;
+  public:
+  void clear_bbox_mode();
+  ::buffers::resources::Sprite_BoundingBox bbox_mode() const;
+  void set_bbox_mode(::buffers::resources::Sprite_BoundingBox value);
+  private:
+  ::buffers::resources::Sprite_BoundingBox _internal_bbox_mode() const;
+  void _internal_set_bbox_mode(::buffers::resources::Sprite_BoundingBox value);
+  public:
+
+  // optional int32 bbox_left = 13;
+  bool has_bbox_left() const;
+  private:
+  bool _internal_has_bbox_left() const;
+  public:
+  void clear_bbox_left();
+  int32_t bbox_left() const;
+  void set_bbox_left(int32_t value);
+  private:
+  int32_t _internal_bbox_left() const;
+  void _internal_set_bbox_left(int32_t value);
+  public:
+
+  // optional int32 bbox_right = 14;
+  bool has_bbox_right() const;
+  private:
+  bool _internal_has_bbox_right() const;
+  public:
+  void clear_bbox_right();
+  int32_t bbox_right() const;
+  void set_bbox_right(int32_t value);
+  private:
+  int32_t _internal_bbox_right() const;
+  void _internal_set_bbox_right(int32_t value);
+  public:
+
+  // optional int32 bbox_top = 15;
+  bool has_bbox_top() const;
+  private:
+  bool _internal_has_bbox_top() const;
+  public:
+  void clear_bbox_top();
+  int32_t bbox_top() const;
+  void set_bbox_top(int32_t value);
+  private:
+  int32_t _internal_bbox_top() const;
+  void _internal_set_bbox_top(int32_t value);
+  public:
+
+  // optional int32 bbox_bottom = 16;
+  bool has_bbox_bottom() const;
+  private:
+  bool _internal_has_bbox_bottom() const;
+  public:
+  void clear_bbox_bottom();
+  int32_t bbox_bottom() const;
+  void set_bbox_bottom(int32_t value);
+  private:
+  int32_t _internal_bbox_bottom() const;
+  void _internal_set_bbox_bottom(int32_t value);
+  public:
+
+  // optional int32 type = 17;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // optional int32 h_tile = 18 [(.buffers.gmx) = "HTile"];
+  bool has_h_tile() const;
+  private:
+  bool _internal_has_h_tile() const;
+  public:
+  void clear_h_tile();
+  int32_t h_tile() const;
+  void set_h_tile(int32_t value);
+  private:
+  int32_t _internal_h_tile() const;
+  void _internal_set_h_tile(int32_t value);
+  public:
+
+  // optional int32 v_tile = 19 [(.buffers.gmx) = "VTile"];
+  bool has_v_tile() const;
+  private:
+  bool _internal_has_v_tile() const;
+  public:
+  void clear_v_tile();
+  int32_t v_tile() const;
+  void set_v_tile(int32_t value);
+  private:
+  int32_t _internal_v_tile() const;
+  void _internal_set_v_tile(int32_t value);
+  public:
+
+  // optional int32 texture_group = 20 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+  bool has_texture_group() const;
+  private:
+  bool _internal_has_texture_group() const;
+  public:
+  void clear_texture_group();
+  int32_t texture_group() const;
+  void set_texture_group(int32_t value);
+  private:
+  int32_t _internal_texture_group() const;
+  void _internal_set_texture_group(int32_t value);
+  public:
+
+  // optional bool for3D = 21 [(.buffers.gmx) = "For3D"];
+  bool has_for3d() const;
+  private:
+  bool _internal_has_for3d() const;
+  public:
+  void clear_for3d();
+  bool for3d() const;
+  void set_for3d(bool value);
+  private:
+  bool _internal_for3d() const;
+  void _internal_set_for3d(bool value);
+  public:
+
+  // optional uint32 width = 22;
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
+  // optional uint32 height = 23;
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  uint32_t height() const;
+  void set_height(uint32_t value);
+  private:
+  uint32_t _internal_height() const;
+  void _internal_set_height(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Sprite)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> subimages_;
+    int32_t id_;
+    bool preload_;
+    bool transparent_;
+    bool smooth_edges_;
+    bool separate_mask_;
+    int32_t alpha_tolerance_;
+    int32_t origin_x_;
+    int32_t origin_y_;
+    int shape_;
+    int bbox_mode_;
+    int32_t bbox_left_;
+    int32_t bbox_right_;
+    int32_t bbox_top_;
+    int32_t bbox_bottom_;
+    int32_t type_;
+    int32_t h_tile_;
+    int32_t v_tile_;
+    int32_t texture_group_;
+    bool for3d_;
+    uint32_t width_;
+    uint32_t height_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fSprite_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Sprite
+
+// optional int32 id = 2 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Sprite::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Sprite::has_id() const {
+  return _internal_has_id();
+}
+inline void Sprite::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Sprite::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Sprite::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.id)
+  return _internal_id();
+}
+inline void Sprite::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void Sprite::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.id)
+}
+
+// optional bool preload = 4 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Sprite::_internal_has_preload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Sprite::has_preload() const {
+  return _internal_has_preload();
+}
+inline void Sprite::clear_preload() {
+  _impl_.preload_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Sprite::_internal_preload() const {
+  return _impl_.preload_;
+}
+inline bool Sprite::preload() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.preload)
+  return _internal_preload();
+}
+inline void Sprite::_internal_set_preload(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.preload_ = value;
+}
+inline void Sprite::set_preload(bool value) {
+  _internal_set_preload(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.preload)
+}
+
+// optional bool transparent = 5 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Sprite::_internal_has_transparent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Sprite::has_transparent() const {
+  return _internal_has_transparent();
+}
+inline void Sprite::clear_transparent() {
+  _impl_.transparent_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Sprite::_internal_transparent() const {
+  return _impl_.transparent_;
+}
+inline bool Sprite::transparent() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.transparent)
+  return _internal_transparent();
+}
+inline void Sprite::_internal_set_transparent(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.transparent_ = value;
+}
+inline void Sprite::set_transparent(bool value) {
+  _internal_set_transparent(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.transparent)
+}
+
+// optional bool smooth_edges = 6 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Sprite::_internal_has_smooth_edges() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Sprite::has_smooth_edges() const {
+  return _internal_has_smooth_edges();
+}
+inline void Sprite::clear_smooth_edges() {
+  _impl_.smooth_edges_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool Sprite::_internal_smooth_edges() const {
+  return _impl_.smooth_edges_;
+}
+inline bool Sprite::smooth_edges() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.smooth_edges)
+  return _internal_smooth_edges();
+}
+inline void Sprite::_internal_set_smooth_edges(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.smooth_edges_ = value;
+}
+inline void Sprite::set_smooth_edges(bool value) {
+  _internal_set_smooth_edges(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.smooth_edges)
+}
+
+// optional int32 alpha_tolerance = 7 [(.buffers.gmx) = "coltolerance"];
+inline bool Sprite::_internal_has_alpha_tolerance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Sprite::has_alpha_tolerance() const {
+  return _internal_has_alpha_tolerance();
+}
+inline void Sprite::clear_alpha_tolerance() {
+  _impl_.alpha_tolerance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t Sprite::_internal_alpha_tolerance() const {
+  return _impl_.alpha_tolerance_;
+}
+inline int32_t Sprite::alpha_tolerance() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.alpha_tolerance)
+  return _internal_alpha_tolerance();
+}
+inline void Sprite::_internal_set_alpha_tolerance(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.alpha_tolerance_ = value;
+}
+inline void Sprite::set_alpha_tolerance(int32_t value) {
+  _internal_set_alpha_tolerance(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.alpha_tolerance)
+}
+
+// optional bool separate_mask = 8 [(.buffers.gmx) = "sepmasks"];
+inline bool Sprite::_internal_has_separate_mask() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Sprite::has_separate_mask() const {
+  return _internal_has_separate_mask();
+}
+inline void Sprite::clear_separate_mask() {
+  _impl_.separate_mask_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Sprite::_internal_separate_mask() const {
+  return _impl_.separate_mask_;
+}
+inline bool Sprite::separate_mask() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.separate_mask)
+  return _internal_separate_mask();
+}
+inline void Sprite::_internal_set_separate_mask(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.separate_mask_ = value;
+}
+inline void Sprite::set_separate_mask(bool value) {
+  _internal_set_separate_mask(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.separate_mask)
+}
+
+// optional int32 origin_x = 9 [(.buffers.gmx) = "xorig"];
+inline bool Sprite::_internal_has_origin_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Sprite::has_origin_x() const {
+  return _internal_has_origin_x();
+}
+inline void Sprite::clear_origin_x() {
+  _impl_.origin_x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Sprite::_internal_origin_x() const {
+  return _impl_.origin_x_;
+}
+inline int32_t Sprite::origin_x() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.origin_x)
+  return _internal_origin_x();
+}
+inline void Sprite::_internal_set_origin_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.origin_x_ = value;
+}
+inline void Sprite::set_origin_x(int32_t value) {
+  _internal_set_origin_x(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.origin_x)
+}
+
+// optional int32 origin_y = 10 [(.buffers.gmx) = "yorigin"];
+inline bool Sprite::_internal_has_origin_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Sprite::has_origin_y() const {
+  return _internal_has_origin_y();
+}
+inline void Sprite::clear_origin_y() {
+  _impl_.origin_y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Sprite::_internal_origin_y() const {
+  return _impl_.origin_y_;
+}
+inline int32_t Sprite::origin_y() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.origin_y)
+  return _internal_origin_y();
+}
+inline void Sprite::_internal_set_origin_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.origin_y_ = value;
+}
+inline void Sprite::set_origin_y(int32_t value) {
+  _internal_set_origin_y(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.origin_y)
+}
+
+// optional .buffers.resources.Sprite.Shape shape = 11 [(.buffers.gmx) = "colkind"];
+inline bool Sprite::_internal_has_shape() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Sprite::has_shape() const {
+  return _internal_has_shape();
+}
+inline void Sprite::clear_shape() {
+  _impl_.shape_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::buffers::resources::Sprite_Shape Sprite::_internal_shape() const {
+  return static_cast< ::buffers::resources::Sprite_Shape >(_impl_.shape_);
+}
+inline ::buffers::resources::Sprite_Shape Sprite::shape() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.shape)
+  return _internal_shape();
+}
+inline void Sprite::_internal_set_shape(::buffers::resources::Sprite_Shape value) {
+  assert(::buffers::resources::Sprite_Shape_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.shape_ = value;
+}
+inline void Sprite::set_shape(::buffers::resources::Sprite_Shape value) {
+  _internal_set_shape(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.shape)
+}
+
+// optional .buffers.resources.Sprite.BoundingBox bbox_mode = 12 [(.buffers.gmx) = "bboxmode"];
+inline bool Sprite::_internal_has_bbox_mode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Sprite::has_bbox_mode() const {
+  return _internal_has_bbox_mode();
+}
+inline void Sprite::clear_bbox_mode() {
+  _impl_.bbox_mode_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::buffers::resources::Sprite_BoundingBox Sprite::_internal_bbox_mode() const {
+  return static_cast< ::buffers::resources::Sprite_BoundingBox >(_impl_.bbox_mode_);
+}
+inline ::buffers::resources::Sprite_BoundingBox Sprite::bbox_mode() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.bbox_mode)
+  return _internal_bbox_mode();
+}
+inline void Sprite::_internal_set_bbox_mode(::buffers::resources::Sprite_BoundingBox value) {
+  assert(::buffers::resources::Sprite_BoundingBox_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.bbox_mode_ = value;
+}
+inline void Sprite::set_bbox_mode(::buffers::resources::Sprite_BoundingBox value) {
+  _internal_set_bbox_mode(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.bbox_mode)
+}
+
+// optional int32 bbox_left = 13;
+inline bool Sprite::_internal_has_bbox_left() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Sprite::has_bbox_left() const {
+  return _internal_has_bbox_left();
+}
+inline void Sprite::clear_bbox_left() {
+  _impl_.bbox_left_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t Sprite::_internal_bbox_left() const {
+  return _impl_.bbox_left_;
+}
+inline int32_t Sprite::bbox_left() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.bbox_left)
+  return _internal_bbox_left();
+}
+inline void Sprite::_internal_set_bbox_left(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.bbox_left_ = value;
+}
+inline void Sprite::set_bbox_left(int32_t value) {
+  _internal_set_bbox_left(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.bbox_left)
+}
+
+// optional int32 bbox_right = 14;
+inline bool Sprite::_internal_has_bbox_right() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Sprite::has_bbox_right() const {
+  return _internal_has_bbox_right();
+}
+inline void Sprite::clear_bbox_right() {
+  _impl_.bbox_right_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t Sprite::_internal_bbox_right() const {
+  return _impl_.bbox_right_;
+}
+inline int32_t Sprite::bbox_right() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.bbox_right)
+  return _internal_bbox_right();
+}
+inline void Sprite::_internal_set_bbox_right(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.bbox_right_ = value;
+}
+inline void Sprite::set_bbox_right(int32_t value) {
+  _internal_set_bbox_right(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.bbox_right)
+}
+
+// optional int32 bbox_top = 15;
+inline bool Sprite::_internal_has_bbox_top() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Sprite::has_bbox_top() const {
+  return _internal_has_bbox_top();
+}
+inline void Sprite::clear_bbox_top() {
+  _impl_.bbox_top_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t Sprite::_internal_bbox_top() const {
+  return _impl_.bbox_top_;
+}
+inline int32_t Sprite::bbox_top() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.bbox_top)
+  return _internal_bbox_top();
+}
+inline void Sprite::_internal_set_bbox_top(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.bbox_top_ = value;
+}
+inline void Sprite::set_bbox_top(int32_t value) {
+  _internal_set_bbox_top(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.bbox_top)
+}
+
+// optional int32 bbox_bottom = 16;
+inline bool Sprite::_internal_has_bbox_bottom() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Sprite::has_bbox_bottom() const {
+  return _internal_has_bbox_bottom();
+}
+inline void Sprite::clear_bbox_bottom() {
+  _impl_.bbox_bottom_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t Sprite::_internal_bbox_bottom() const {
+  return _impl_.bbox_bottom_;
+}
+inline int32_t Sprite::bbox_bottom() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.bbox_bottom)
+  return _internal_bbox_bottom();
+}
+inline void Sprite::_internal_set_bbox_bottom(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.bbox_bottom_ = value;
+}
+inline void Sprite::set_bbox_bottom(int32_t value) {
+  _internal_set_bbox_bottom(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.bbox_bottom)
+}
+
+// optional int32 type = 17;
+inline bool Sprite::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Sprite::has_type() const {
+  return _internal_has_type();
+}
+inline void Sprite::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t Sprite::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t Sprite::type() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.type)
+  return _internal_type();
+}
+inline void Sprite::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.type_ = value;
+}
+inline void Sprite::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.type)
+}
+
+// optional int32 h_tile = 18 [(.buffers.gmx) = "HTile"];
+inline bool Sprite::_internal_has_h_tile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Sprite::has_h_tile() const {
+  return _internal_has_h_tile();
+}
+inline void Sprite::clear_h_tile() {
+  _impl_.h_tile_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t Sprite::_internal_h_tile() const {
+  return _impl_.h_tile_;
+}
+inline int32_t Sprite::h_tile() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.h_tile)
+  return _internal_h_tile();
+}
+inline void Sprite::_internal_set_h_tile(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.h_tile_ = value;
+}
+inline void Sprite::set_h_tile(int32_t value) {
+  _internal_set_h_tile(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.h_tile)
+}
+
+// optional int32 v_tile = 19 [(.buffers.gmx) = "VTile"];
+inline bool Sprite::_internal_has_v_tile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Sprite::has_v_tile() const {
+  return _internal_has_v_tile();
+}
+inline void Sprite::clear_v_tile() {
+  _impl_.v_tile_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t Sprite::_internal_v_tile() const {
+  return _impl_.v_tile_;
+}
+inline int32_t Sprite::v_tile() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.v_tile)
+  return _internal_v_tile();
+}
+inline void Sprite::_internal_set_v_tile(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.v_tile_ = value;
+}
+inline void Sprite::set_v_tile(int32_t value) {
+  _internal_set_v_tile(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.v_tile)
+}
+
+// optional int32 texture_group = 20 [(.buffers.gmx) = "TextureGroups/TextureGroup0"];
+inline bool Sprite::_internal_has_texture_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Sprite::has_texture_group() const {
+  return _internal_has_texture_group();
+}
+inline void Sprite::clear_texture_group() {
+  _impl_.texture_group_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline int32_t Sprite::_internal_texture_group() const {
+  return _impl_.texture_group_;
+}
+inline int32_t Sprite::texture_group() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.texture_group)
+  return _internal_texture_group();
+}
+inline void Sprite::_internal_set_texture_group(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.texture_group_ = value;
+}
+inline void Sprite::set_texture_group(int32_t value) {
+  _internal_set_texture_group(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.texture_group)
+}
+
+// optional bool for3D = 21 [(.buffers.gmx) = "For3D"];
+inline bool Sprite::_internal_has_for3d() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool Sprite::has_for3d() const {
+  return _internal_has_for3d();
+}
+inline void Sprite::clear_for3d() {
+  _impl_.for3d_ = false;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline bool Sprite::_internal_for3d() const {
+  return _impl_.for3d_;
+}
+inline bool Sprite::for3d() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.for3D)
+  return _internal_for3d();
+}
+inline void Sprite::_internal_set_for3d(bool value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.for3d_ = value;
+}
+inline void Sprite::set_for3d(bool value) {
+  _internal_set_for3d(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.for3D)
+}
+
+// optional uint32 width = 22;
+inline bool Sprite::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool Sprite::has_width() const {
+  return _internal_has_width();
+}
+inline void Sprite::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline uint32_t Sprite::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t Sprite::width() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.width)
+  return _internal_width();
+}
+inline void Sprite::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.width_ = value;
+}
+inline void Sprite::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.width)
+}
+
+// optional uint32 height = 23;
+inline bool Sprite::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool Sprite::has_height() const {
+  return _internal_has_height();
+}
+inline void Sprite::clear_height() {
+  _impl_.height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline uint32_t Sprite::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t Sprite::height() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.height)
+  return _internal_height();
+}
+inline void Sprite::_internal_set_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.height_ = value;
+}
+inline void Sprite::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.height)
+}
+
+// repeated string subimages = 3 [(.buffers.file_path) = true, (.buffers.gmx) = "frames/frame"];
+inline int Sprite::_internal_subimages_size() const {
+  return _impl_.subimages_.size();
+}
+inline int Sprite::subimages_size() const {
+  return _internal_subimages_size();
+}
+inline void Sprite::clear_subimages() {
+  _impl_.subimages_.Clear();
+}
+inline std::string* Sprite::add_subimages() {
+  std::string* _s = _internal_add_subimages();
+  // @@protoc_insertion_point(field_add_mutable:buffers.resources.Sprite.subimages)
+  return _s;
+}
+inline const std::string& Sprite::_internal_subimages(int index) const {
+  return _impl_.subimages_.Get(index);
+}
+inline const std::string& Sprite::subimages(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Sprite.subimages)
+  return _internal_subimages(index);
+}
+inline std::string* Sprite::mutable_subimages(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Sprite.subimages)
+  return _impl_.subimages_.Mutable(index);
+}
+inline void Sprite::set_subimages(int index, const std::string& value) {
+  _impl_.subimages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::set_subimages(int index, std::string&& value) {
+  _impl_.subimages_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::set_subimages(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.subimages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::set_subimages(int index, const char* value, size_t size) {
+  _impl_.subimages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:buffers.resources.Sprite.subimages)
+}
+inline std::string* Sprite::_internal_add_subimages() {
+  return _impl_.subimages_.Add();
+}
+inline void Sprite::add_subimages(const std::string& value) {
+  _impl_.subimages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::add_subimages(std::string&& value) {
+  _impl_.subimages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::add_subimages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.subimages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:buffers.resources.Sprite.subimages)
+}
+inline void Sprite::add_subimages(const char* value, size_t size) {
+  _impl_.subimages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:buffers.resources.Sprite.subimages)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Sprite::subimages() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Sprite.subimages)
+  return _impl_.subimages_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Sprite::mutable_subimages() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Sprite.subimages)
+  return &_impl_.subimages_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::resources::Sprite_Shape> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Sprite_Shape>() {
+  return ::buffers::resources::Sprite_Shape_descriptor();
+}
+template <> struct is_proto_enum< ::buffers::resources::Sprite_BoundingBox> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::resources::Sprite_BoundingBox>() {
+  return ::buffers::resources::Sprite_BoundingBox_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fSprite_2eproto
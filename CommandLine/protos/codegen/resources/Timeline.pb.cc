@@ -0,0 +1,615 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Timeline.proto
+
+#include "resources/Timeline.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+namespace resources {
+PROTOBUF_CONSTEXPR Timeline_Moment::Timeline_Moment(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.event_)*/nullptr
+  , /*decltype(_impl_.step_)*/0} {}
+struct Timeline_MomentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Timeline_MomentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Timeline_MomentDefaultTypeInternal() {}
+  union {
+    Timeline_Moment _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Timeline_MomentDefaultTypeInternal _Timeline_Moment_default_instance_;
+PROTOBUF_CONSTEXPR Timeline::Timeline(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.moments_)*/{}
+  , /*decltype(_impl_.id_)*/0} {}
+struct TimelineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimelineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimelineDefaultTypeInternal() {}
+  union {
+    Timeline _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimelineDefaultTypeInternal _Timeline_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_resources_2fTimeline_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resources_2fTimeline_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resources_2fTimeline_2eproto = nullptr;
+
+const uint32_t TableStruct_resources_2fTimeline_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline_Moment, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline_Moment, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline_Moment, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline_Moment, _impl_.event_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::buffers::resources::Timeline, _impl_.moments_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::buffers::resources::Timeline_Moment)},
+  { 10, 18, -1, sizeof(::buffers::resources::Timeline)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::resources::_Timeline_Moment_default_instance_._instance,
+  &::buffers::resources::_Timeline_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resources_2fTimeline_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030resources/Timeline.proto\022\021buffers.reso"
+  "urces\032\roptions.proto\032\025resources/Event.pr"
+  "oto\"\253\001\n\010Timeline\022\036\n\002id\030\001 \001(\005B\022\222\265\030\016GMX_DE"
+  "PRECATED\022>\n\007moments\030\002 \003(\0132\".buffers.reso"
+  "urces.Timeline.MomentB\t\222\265\030\005entry\032\?\n\006Mome"
+  "nt\022\014\n\004step\030\001 \001(\005\022\'\n\005event\030\002 \001(\0132\030.buffer"
+  "s.resources.Event"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_resources_2fTimeline_2eproto_deps[2] = {
+  &::descriptor_table_options_2eproto,
+  &::descriptor_table_resources_2fEvent_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_resources_2fTimeline_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resources_2fTimeline_2eproto = {
+    false, false, 257, descriptor_table_protodef_resources_2fTimeline_2eproto,
+    "resources/Timeline.proto",
+    &descriptor_table_resources_2fTimeline_2eproto_once, descriptor_table_resources_2fTimeline_2eproto_deps, 2, 2,
+    schemas, file_default_instances, TableStruct_resources_2fTimeline_2eproto::offsets,
+    file_level_metadata_resources_2fTimeline_2eproto, file_level_enum_descriptors_resources_2fTimeline_2eproto,
+    file_level_service_descriptors_resources_2fTimeline_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resources_2fTimeline_2eproto_getter() {
+  return &descriptor_table_resources_2fTimeline_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resources_2fTimeline_2eproto(&descriptor_table_resources_2fTimeline_2eproto);
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Timeline_Moment::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Timeline_Moment>()._impl_._has_bits_);
+  static void set_has_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::buffers::resources::Event& event(const Timeline_Moment* msg);
+  static void set_has_event(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::buffers::resources::Event&
+Timeline_Moment::_Internal::event(const Timeline_Moment* msg) {
+  return *msg->_impl_.event_;
+}
+void Timeline_Moment::clear_event() {
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+Timeline_Moment::Timeline_Moment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Timeline.Moment)
+}
+Timeline_Moment::Timeline_Moment(const Timeline_Moment& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Timeline_Moment* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_){nullptr}
+    , decltype(_impl_.step_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_event()) {
+    _this->_impl_.event_ = new ::buffers::resources::Event(*from._impl_.event_);
+  }
+  _this->_impl_.step_ = from._impl_.step_;
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Timeline.Moment)
+}
+
+inline void Timeline_Moment::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_){nullptr}
+    , decltype(_impl_.step_){0}
+  };
+}
+
+Timeline_Moment::~Timeline_Moment() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Timeline.Moment)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Timeline_Moment::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.event_;
+}
+
+void Timeline_Moment::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Timeline_Moment::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Timeline.Moment)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.event_ != nullptr);
+    _impl_.event_->Clear();
+  }
+  _impl_.step_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Timeline_Moment::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 step = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_step(&has_bits);
+          _impl_.step_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .buffers.resources.Event event = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_event(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Timeline_Moment::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Timeline.Moment)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 step = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_step(), target);
+  }
+
+  // optional .buffers.resources.Event event = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::event(this),
+        _Internal::event(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Timeline.Moment)
+  return target;
+}
+
+size_t Timeline_Moment::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Timeline.Moment)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .buffers.resources.Event event = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.event_);
+    }
+
+    // optional int32 step = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_step());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Timeline_Moment::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Timeline_Moment::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Timeline_Moment::GetClassData() const { return &_class_data_; }
+
+
+void Timeline_Moment::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Timeline_Moment*>(&to_msg);
+  auto& from = static_cast<const Timeline_Moment&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Timeline.Moment)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_event()->::buffers::resources::Event::MergeFrom(
+          from._internal_event());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.step_ = from._impl_.step_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Timeline_Moment::CopyFrom(const Timeline_Moment& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Timeline.Moment)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Timeline_Moment::IsInitialized() const {
+  return true;
+}
+
+void Timeline_Moment::InternalSwap(Timeline_Moment* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Timeline_Moment, _impl_.step_)
+      + sizeof(Timeline_Moment::_impl_.step_)
+      - PROTOBUF_FIELD_OFFSET(Timeline_Moment, _impl_.event_)>(
+          reinterpret_cast<char*>(&_impl_.event_),
+          reinterpret_cast<char*>(&other->_impl_.event_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Timeline_Moment::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fTimeline_2eproto_getter, &descriptor_table_resources_2fTimeline_2eproto_once,
+      file_level_metadata_resources_2fTimeline_2eproto[0]);
+}
+
+// ===================================================================
+
+class Timeline::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Timeline>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Timeline::Timeline(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.resources.Timeline)
+}
+Timeline::Timeline(const Timeline& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Timeline* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.moments_){from._impl_.moments_}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:buffers.resources.Timeline)
+}
+
+inline void Timeline::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.moments_){arena}
+    , decltype(_impl_.id_){0}
+  };
+}
+
+Timeline::~Timeline() {
+  // @@protoc_insertion_point(destructor:buffers.resources.Timeline)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Timeline::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.moments_.~RepeatedPtrField();
+}
+
+void Timeline::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Timeline::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.resources.Timeline)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.moments_.Clear();
+  _impl_.id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Timeline::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 id = 1 [(.buffers.gmx) = "GMX_DEPRECATED"];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.resources.Timeline.Moment moments = 2 [(.buffers.gmx) = "entry"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_moments(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Timeline::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.resources.Timeline)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 id = 1 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // repeated .buffers.resources.Timeline.Moment moments = 2 [(.buffers.gmx) = "entry"];
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_moments_size()); i < n; i++) {
+    const auto& repfield = this->_internal_moments(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.resources.Timeline)
+  return target;
+}
+
+size_t Timeline::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.resources.Timeline)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.resources.Timeline.Moment moments = 2 [(.buffers.gmx) = "entry"];
+  total_size += 1UL * this->_internal_moments_size();
+  for (const auto& msg : this->_impl_.moments_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional int32 id = 1 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Timeline::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Timeline::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Timeline::GetClassData() const { return &_class_data_; }
+
+
+void Timeline::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Timeline*>(&to_msg);
+  auto& from = static_cast<const Timeline&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.resources.Timeline)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.moments_.MergeFrom(from._impl_.moments_);
+  if (from._internal_has_id()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Timeline::CopyFrom(const Timeline& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.resources.Timeline)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Timeline::IsInitialized() const {
+  return true;
+}
+
+void Timeline::InternalSwap(Timeline* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.moments_.InternalSwap(&other->_impl_.moments_);
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Timeline::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resources_2fTimeline_2eproto_getter, &descriptor_table_resources_2fTimeline_2eproto_once,
+      file_level_metadata_resources_2fTimeline_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::resources::Timeline_Moment*
+Arena::CreateMaybeMessage< ::buffers::resources::Timeline_Moment >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Timeline_Moment >(arena);
+}
+template<> PROTOBUF_NOINLINE ::buffers::resources::Timeline*
+Arena::CreateMaybeMessage< ::buffers::resources::Timeline >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::resources::Timeline >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,640 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resources/Timeline.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resources_2fTimeline_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resources_2fTimeline_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "options.pb.h"
+#include "resources/Event.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resources_2fTimeline_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resources_2fTimeline_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resources_2fTimeline_2eproto;
+namespace buffers {
+namespace resources {
+class Timeline;
+struct TimelineDefaultTypeInternal;
+extern TimelineDefaultTypeInternal _Timeline_default_instance_;
+class Timeline_Moment;
+struct Timeline_MomentDefaultTypeInternal;
+extern Timeline_MomentDefaultTypeInternal _Timeline_Moment_default_instance_;
+}  // namespace resources
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::resources::Timeline* Arena::CreateMaybeMessage<::buffers::resources::Timeline>(Arena*);
+template<> ::buffers::resources::Timeline_Moment* Arena::CreateMaybeMessage<::buffers::resources::Timeline_Moment>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+namespace resources {
+
+// ===================================================================
+
+class Timeline_Moment final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Timeline.Moment) */ {
+ public:
+  inline Timeline_Moment() : Timeline_Moment(nullptr) {}
+  ~Timeline_Moment() override;
+  explicit PROTOBUF_CONSTEXPR Timeline_Moment(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Timeline_Moment(const Timeline_Moment& from);
+  Timeline_Moment(Timeline_Moment&& from) noexcept
+    : Timeline_Moment() {
+    *this = ::std::move(from);
+  }
+
+  inline Timeline_Moment& operator=(const Timeline_Moment& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Timeline_Moment& operator=(Timeline_Moment&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Timeline_Moment& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Timeline_Moment* internal_default_instance() {
+    return reinterpret_cast<const Timeline_Moment*>(
+               &_Timeline_Moment_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Timeline_Moment& a, Timeline_Moment& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Timeline_Moment* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Timeline_Moment* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Timeline_Moment* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Timeline_Moment>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Timeline_Moment& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Timeline_Moment& from) {
+    Timeline_Moment::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Timeline_Moment* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Timeline.Moment";
+  }
+  protected:
+  explicit Timeline_Moment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventFieldNumber = 2,
+    kStepFieldNumber = 1,
+  };
+  // optional .buffers.resources.Event event = 2;
+  bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
+  void clear_event();
+  const ::buffers::resources::Event& event() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Event* release_event();
+  ::buffers::resources::Event* mutable_event();
+  void set_allocated_event(::buffers::resources::Event* event);
+  private:
+  const ::buffers::resources::Event& _internal_event() const;
+  ::buffers::resources::Event* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::buffers::resources::Event* event);
+  ::buffers::resources::Event* unsafe_arena_release_event();
+
+  // optional int32 step = 1;
+  bool has_step() const;
+  private:
+  bool _internal_has_step() const;
+  public:
+  void clear_step();
+  int32_t step() const;
+  void set_step(int32_t value);
+  private:
+  int32_t _internal_step() const;
+  void _internal_set_step(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Timeline.Moment)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::buffers::resources::Event* event_;
+    int32_t step_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fTimeline_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Timeline final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.resources.Timeline) */ {
+ public:
+  inline Timeline() : Timeline(nullptr) {}
+  ~Timeline() override;
+  explicit PROTOBUF_CONSTEXPR Timeline(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Timeline(const Timeline& from);
+  Timeline(Timeline&& from) noexcept
+    : Timeline() {
+    *this = ::std::move(from);
+  }
+
+  inline Timeline& operator=(const Timeline& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Timeline& operator=(Timeline&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Timeline& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Timeline* internal_default_instance() {
+    return reinterpret_cast<const Timeline*>(
+               &_Timeline_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Timeline& a, Timeline& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Timeline* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Timeline* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Timeline* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Timeline>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Timeline& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Timeline& from) {
+    Timeline::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Timeline* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.resources.Timeline";
+  }
+  protected:
+  explicit Timeline(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Timeline_Moment Moment;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMomentsFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // repeated .buffers.resources.Timeline.Moment moments = 2 [(.buffers.gmx) = "entry"];
+  int moments_size() const;
+  private:
+  int _internal_moments_size() const;
+  public:
+  void clear_moments();
+  ::buffers::resources::Timeline_Moment* mutable_moments(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Timeline_Moment >*
+      mutable_moments();
+  private:
+  const ::buffers::resources::Timeline_Moment& _internal_moments(int index) const;
+  ::buffers::resources::Timeline_Moment* _internal_add_moments();
+  public:
+  const ::buffers::resources::Timeline_Moment& moments(int index) const;
+  ::buffers::resources::Timeline_Moment* add_moments();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Timeline_Moment >&
+      moments() const;
+
+  // optional int32 id = 1 [(.buffers.gmx) = "GMX_DEPRECATED"];
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.resources.Timeline)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Timeline_Moment > moments_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resources_2fTimeline_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Timeline_Moment
+
+// optional int32 step = 1;
+inline bool Timeline_Moment::_internal_has_step() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Timeline_Moment::has_step() const {
+  return _internal_has_step();
+}
+inline void Timeline_Moment::clear_step() {
+  _impl_.step_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Timeline_Moment::_internal_step() const {
+  return _impl_.step_;
+}
+inline int32_t Timeline_Moment::step() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Timeline.Moment.step)
+  return _internal_step();
+}
+inline void Timeline_Moment::_internal_set_step(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.step_ = value;
+}
+inline void Timeline_Moment::set_step(int32_t value) {
+  _internal_set_step(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Timeline.Moment.step)
+}
+
+// optional .buffers.resources.Event event = 2;
+inline bool Timeline_Moment::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
+inline bool Timeline_Moment::has_event() const {
+  return _internal_has_event();
+}
+inline const ::buffers::resources::Event& Timeline_Moment::_internal_event() const {
+  const ::buffers::resources::Event* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::resources::Event&>(
+      ::buffers::resources::_Event_default_instance_);
+}
+inline const ::buffers::resources::Event& Timeline_Moment::event() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Timeline.Moment.event)
+  return _internal_event();
+}
+inline void Timeline_Moment::unsafe_arena_set_allocated_event(
+    ::buffers::resources::Event* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.resources.Timeline.Moment.event)
+}
+inline ::buffers::resources::Event* Timeline_Moment::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::resources::Event* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::resources::Event* Timeline_Moment::unsafe_arena_release_event() {
+  // @@protoc_insertion_point(field_release:buffers.resources.Timeline.Moment.event)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::buffers::resources::Event* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+  return temp;
+}
+inline ::buffers::resources::Event* Timeline_Moment::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::resources::Event>(GetArenaForAllocation());
+    _impl_.event_ = p;
+  }
+  return _impl_.event_;
+}
+inline ::buffers::resources::Event* Timeline_Moment::mutable_event() {
+  ::buffers::resources::Event* _msg = _internal_mutable_event();
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Timeline.Moment.event)
+  return _msg;
+}
+inline void Timeline_Moment::set_allocated_event(::buffers::resources::Event* event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  if (event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(event));
+    if (message_arena != submessage_arena) {
+      event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, event, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_ = event;
+  // @@protoc_insertion_point(field_set_allocated:buffers.resources.Timeline.Moment.event)
+}
+
+// -------------------------------------------------------------------
+
+// Timeline
+
+// optional int32 id = 1 [(.buffers.gmx) = "GMX_DEPRECATED"];
+inline bool Timeline::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Timeline::has_id() const {
+  return _internal_has_id();
+}
+inline void Timeline::clear_id() {
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t Timeline::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t Timeline::id() const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Timeline.id)
+  return _internal_id();
+}
+inline void Timeline::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void Timeline::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:buffers.resources.Timeline.id)
+}
+
+// repeated .buffers.resources.Timeline.Moment moments = 2 [(.buffers.gmx) = "entry"];
+inline int Timeline::_internal_moments_size() const {
+  return _impl_.moments_.size();
+}
+inline int Timeline::moments_size() const {
+  return _internal_moments_size();
+}
+inline void Timeline::clear_moments() {
+  _impl_.moments_.Clear();
+}
+inline ::buffers::resources::Timeline_Moment* Timeline::mutable_moments(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.resources.Timeline.moments)
+  return _impl_.moments_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Timeline_Moment >*
+Timeline::mutable_moments() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.resources.Timeline.moments)
+  return &_impl_.moments_;
+}
+inline const ::buffers::resources::Timeline_Moment& Timeline::_internal_moments(int index) const {
+  return _impl_.moments_.Get(index);
+}
+inline const ::buffers::resources::Timeline_Moment& Timeline::moments(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.resources.Timeline.moments)
+  return _internal_moments(index);
+}
+inline ::buffers::resources::Timeline_Moment* Timeline::_internal_add_moments() {
+  return _impl_.moments_.Add();
+}
+inline ::buffers::resources::Timeline_Moment* Timeline::add_moments() {
+  ::buffers::resources::Timeline_Moment* _add = _internal_add_moments();
+  // @@protoc_insertion_point(field_add:buffers.resources.Timeline.moments)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::resources::Timeline_Moment >&
+Timeline::moments() const {
+  // @@protoc_insertion_point(field_list:buffers.resources.Timeline.moments)
+  return _impl_.moments_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resources
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resources_2fTimeline_2eproto
@@ -0,0 +1,2659 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: server.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_server_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_server_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "game.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_server_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_server_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_server_2eproto;
+namespace buffers {
+class CompileReply;
+struct CompileReplyDefaultTypeInternal;
+extern CompileReplyDefaultTypeInternal _CompileReply_default_instance_;
+class CompileRequest;
+struct CompileRequestDefaultTypeInternal;
+extern CompileRequestDefaultTypeInternal _CompileRequest_default_instance_;
+class Empty;
+struct EmptyDefaultTypeInternal;
+extern EmptyDefaultTypeInternal _Empty_default_instance_;
+class Resource;
+struct ResourceDefaultTypeInternal;
+extern ResourceDefaultTypeInternal _Resource_default_instance_;
+class SetDefinitionsRequest;
+struct SetDefinitionsRequestDefaultTypeInternal;
+extern SetDefinitionsRequestDefaultTypeInternal _SetDefinitionsRequest_default_instance_;
+class SyntaxCheckRequest;
+struct SyntaxCheckRequestDefaultTypeInternal;
+extern SyntaxCheckRequestDefaultTypeInternal _SyntaxCheckRequest_default_instance_;
+class SyntaxError;
+struct SyntaxErrorDefaultTypeInternal;
+extern SyntaxErrorDefaultTypeInternal _SyntaxError_default_instance_;
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::CompileReply* Arena::CreateMaybeMessage<::buffers::CompileReply>(Arena*);
+template<> ::buffers::CompileRequest* Arena::CreateMaybeMessage<::buffers::CompileRequest>(Arena*);
+template<> ::buffers::Empty* Arena::CreateMaybeMessage<::buffers::Empty>(Arena*);
+template<> ::buffers::Resource* Arena::CreateMaybeMessage<::buffers::Resource>(Arena*);
+template<> ::buffers::SetDefinitionsRequest* Arena::CreateMaybeMessage<::buffers::SetDefinitionsRequest>(Arena*);
+template<> ::buffers::SyntaxCheckRequest* Arena::CreateMaybeMessage<::buffers::SyntaxCheckRequest>(Arena*);
+template<> ::buffers::SyntaxError* Arena::CreateMaybeMessage<::buffers::SyntaxError>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+
+enum CompileMode : int {
+  RUN = 1,
+  DEBUG = 2,
+  DESIGN = 3,
+  COMPILE = 4,
+  REBUILD = 5,
+  INVALID = 6
+};
+bool CompileMode_IsValid(int value);
+constexpr CompileMode CompileMode_MIN = RUN;
+constexpr CompileMode CompileMode_MAX = INVALID;
+constexpr int CompileMode_ARRAYSIZE = CompileMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CompileMode_descriptor();
+template<typename T>
+inline const std::string& CompileMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CompileMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CompileMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CompileMode_descriptor(), enum_t_value);
+}
+inline bool CompileMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CompileMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CompileMode>(
+    CompileMode_descriptor(), name, value);
+}
+// ===================================================================
+
+class Empty final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:buffers.Empty) */ {
+ public:
+  inline Empty() : Empty(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR Empty(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Empty(const Empty& from);
+  Empty(Empty&& from) noexcept
+    : Empty() {
+    *this = ::std::move(from);
+  }
+
+  inline Empty& operator=(const Empty& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Empty& operator=(Empty&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Empty& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Empty* internal_default_instance() {
+    return reinterpret_cast<const Empty*>(
+               &_Empty_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Empty& a, Empty& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Empty* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Empty* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Empty* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Empty>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.Empty";
+  }
+  protected:
+  explicit Empty(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:buffers.Empty)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Resource final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.Resource) */ {
+ public:
+  inline Resource() : Resource(nullptr) {}
+  ~Resource() override;
+  explicit PROTOBUF_CONSTEXPR Resource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Resource(const Resource& from);
+  Resource(Resource&& from) noexcept
+    : Resource() {
+    *this = ::std::move(from);
+  }
+
+  inline Resource& operator=(const Resource& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Resource& operator=(Resource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Resource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Resource* internal_default_instance() {
+    return reinterpret_cast<const Resource*>(
+               &_Resource_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Resource& a, Resource& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Resource* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Resource* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Resource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Resource>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Resource& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Resource& from) {
+    Resource::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Resource* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.Resource";
+  }
+  protected:
+  explicit Resource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParametersFieldNumber = 9,
+    kNameFieldNumber = 1,
+    kArgCountMinFieldNumber = 3,
+    kArgCountMaxFieldNumber = 4,
+    kOverloadCountFieldNumber = 5,
+    kIsFunctionFieldNumber = 2,
+    kIsEndFieldNumber = 8,
+    kIsTypeNameFieldNumber = 6,
+    kIsGlobalFieldNumber = 7,
+  };
+  // repeated string parameters = 9;
+  int parameters_size() const;
+  private:
+  int _internal_parameters_size() const;
+  public:
+  void clear_parameters();
+  const std::string& parameters(int index) const;
+  std::string* mutable_parameters(int index);
+  void set_parameters(int index, const std::string& value);
+  void set_parameters(int index, std::string&& value);
+  void set_parameters(int index, const char* value);
+  void set_parameters(int index, const char* value, size_t size);
+  std::string* add_parameters();
+  void add_parameters(const std::string& value);
+  void add_parameters(std::string&& value);
+  void add_parameters(const char* value);
+  void add_parameters(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& parameters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_parameters();
+  private:
+  const std::string& _internal_parameters(int index) const;
+  std::string* _internal_add_parameters();
+  public:
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional int32 arg_count_min = 3;
+  bool has_arg_count_min() const;
+  private:
+  bool _internal_has_arg_count_min() const;
+  public:
+  void clear_arg_count_min();
+  int32_t arg_count_min() const;
+  void set_arg_count_min(int32_t value);
+  private:
+  int32_t _internal_arg_count_min() const;
+  void _internal_set_arg_count_min(int32_t value);
+  public:
+
+  // optional int32 arg_count_max = 4;
+  bool has_arg_count_max() const;
+  private:
+  bool _internal_has_arg_count_max() const;
+  public:
+  void clear_arg_count_max();
+  int32_t arg_count_max() const;
+  void set_arg_count_max(int32_t value);
+  private:
+  int32_t _internal_arg_count_max() const;
+  void _internal_set_arg_count_max(int32_t value);
+  public:
+
+  // optional int32 overload_count = 5;
+  bool has_overload_count() const;
+  private:
+  bool _internal_has_overload_count() const;
+  public:
+  void clear_overload_count();
+  int32_t overload_count() const;
+  void set_overload_count(int32_t value);
+  private:
+  int32_t _internal_overload_count() const;
+  void _internal_set_overload_count(int32_t value);
+  public:
+
+  // optional bool is_function = 2;
+  bool has_is_function() const;
+  private:
+  bool _internal_has_is_function() const;
+  public:
+  void clear_is_function();
+  bool is_function() const;
+  void set_is_function(bool value);
+  private:
+  bool _internal_is_function() const;
+  void _internal_set_is_function(bool value);
+  public:
+
+  // optional bool is_end = 8;
+  bool has_is_end() const;
+  private:
+  bool _internal_has_is_end() const;
+  public:
+  void clear_is_end();
+  bool is_end() const;
+  void set_is_end(bool value);
+  private:
+  bool _internal_is_end() const;
+  void _internal_set_is_end(bool value);
+  public:
+
+  // optional int32 is_type_name = 6;
+  bool has_is_type_name() const;
+  private:
+  bool _internal_has_is_type_name() const;
+  public:
+  void clear_is_type_name();
+  int32_t is_type_name() const;
+  void set_is_type_name(int32_t value);
+  private:
+  int32_t _internal_is_type_name() const;
+  void _internal_set_is_type_name(int32_t value);
+  public:
+
+  // optional int32 is_global = 7;
+  bool has_is_global() const;
+  private:
+  bool _internal_has_is_global() const;
+  public:
+  void clear_is_global();
+  int32_t is_global() const;
+  void set_is_global(int32_t value);
+  private:
+  int32_t _internal_is_global() const;
+  void _internal_set_is_global(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.Resource)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> parameters_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t arg_count_min_;
+    int32_t arg_count_max_;
+    int32_t overload_count_;
+    bool is_function_;
+    bool is_end_;
+    int32_t is_type_name_;
+    int32_t is_global_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompileRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.CompileRequest) */ {
+ public:
+  inline CompileRequest() : CompileRequest(nullptr) {}
+  ~CompileRequest() override;
+  explicit PROTOBUF_CONSTEXPR CompileRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompileRequest(const CompileRequest& from);
+  CompileRequest(CompileRequest&& from) noexcept
+    : CompileRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CompileRequest& operator=(const CompileRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompileRequest& operator=(CompileRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompileRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompileRequest* internal_default_instance() {
+    return reinterpret_cast<const CompileRequest*>(
+               &_CompileRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CompileRequest& a, CompileRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompileRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompileRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompileRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompileRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompileRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompileRequest& from) {
+    CompileRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompileRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.CompileRequest";
+  }
+  protected:
+  explicit CompileRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kGameFieldNumber = 1,
+    kModeFieldNumber = 3,
+  };
+  // optional string name = 2;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .buffers.Game game = 1;
+  bool has_game() const;
+  private:
+  bool _internal_has_game() const;
+  public:
+  void clear_game();
+  const ::buffers::Game& game() const;
+  PROTOBUF_NODISCARD ::buffers::Game* release_game();
+  ::buffers::Game* mutable_game();
+  void set_allocated_game(::buffers::Game* game);
+  private:
+  const ::buffers::Game& _internal_game() const;
+  ::buffers::Game* _internal_mutable_game();
+  public:
+  void unsafe_arena_set_allocated_game(
+      ::buffers::Game* game);
+  ::buffers::Game* unsafe_arena_release_game();
+
+  // optional .buffers.CompileMode mode = 3;
+  bool has_mode() const;
+  private:
+  bool _internal_has_mode() const;
+  public:
+  void clear_mode();
+  ::buffers::CompileMode mode() const;
+  void set_mode(::buffers::CompileMode value);
+  private:
+  ::buffers::CompileMode _internal_mode() const;
+  void _internal_set_mode(::buffers::CompileMode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.CompileRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::buffers::Game* game_;
+    int mode_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompileReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.CompileReply) */ {
+ public:
+  inline CompileReply() : CompileReply(nullptr) {}
+  ~CompileReply() override;
+  explicit PROTOBUF_CONSTEXPR CompileReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompileReply(const CompileReply& from);
+  CompileReply(CompileReply&& from) noexcept
+    : CompileReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CompileReply& operator=(const CompileReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompileReply& operator=(CompileReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompileReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompileReply* internal_default_instance() {
+    return reinterpret_cast<const CompileReply*>(
+               &_CompileReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CompileReply& a, CompileReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompileReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompileReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompileReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompileReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompileReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompileReply& from) {
+    CompileReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompileReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.CompileReply";
+  }
+  protected:
+  explicit CompileReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kProgressFieldNumber = 2,
+  };
+  // optional string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional int32 progress = 2;
+  bool has_progress() const;
+  private:
+  bool _internal_has_progress() const;
+  public:
+  void clear_progress();
+  int32_t progress() const;
+  void set_progress(int32_t value);
+  private:
+  int32_t _internal_progress() const;
+  void _internal_set_progress(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.CompileReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int32_t progress_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyntaxError final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.SyntaxError) */ {
+ public:
+  inline SyntaxError() : SyntaxError(nullptr) {}
+  ~SyntaxError() override;
+  explicit PROTOBUF_CONSTEXPR SyntaxError(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyntaxError(const SyntaxError& from);
+  SyntaxError(SyntaxError&& from) noexcept
+    : SyntaxError() {
+    *this = ::std::move(from);
+  }
+
+  inline SyntaxError& operator=(const SyntaxError& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyntaxError& operator=(SyntaxError&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyntaxError& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyntaxError* internal_default_instance() {
+    return reinterpret_cast<const SyntaxError*>(
+               &_SyntaxError_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SyntaxError& a, SyntaxError& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyntaxError* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyntaxError* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyntaxError* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyntaxError>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyntaxError& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyntaxError& from) {
+    SyntaxError::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyntaxError* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.SyntaxError";
+  }
+  protected:
+  explicit SyntaxError(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+    kLineFieldNumber = 2,
+    kPositionFieldNumber = 3,
+    kAbsoluteIndexFieldNumber = 4,
+  };
+  // optional string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional int32 line = 2;
+  bool has_line() const;
+  private:
+  bool _internal_has_line() const;
+  public:
+  void clear_line();
+  int32_t line() const;
+  void set_line(int32_t value);
+  private:
+  int32_t _internal_line() const;
+  void _internal_set_line(int32_t value);
+  public:
+
+  // optional int32 position = 3;
+  bool has_position() const;
+  private:
+  bool _internal_has_position() const;
+  public:
+  void clear_position();
+  int32_t position() const;
+  void set_position(int32_t value);
+  private:
+  int32_t _internal_position() const;
+  void _internal_set_position(int32_t value);
+  public:
+
+  // optional int32 absolute_index = 4;
+  bool has_absolute_index() const;
+  private:
+  bool _internal_has_absolute_index() const;
+  public:
+  void clear_absolute_index();
+  int32_t absolute_index() const;
+  void set_absolute_index(int32_t value);
+  private:
+  int32_t _internal_absolute_index() const;
+  void _internal_set_absolute_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.SyntaxError)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int32_t line_;
+    int32_t position_;
+    int32_t absolute_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetDefinitionsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.SetDefinitionsRequest) */ {
+ public:
+  inline SetDefinitionsRequest() : SetDefinitionsRequest(nullptr) {}
+  ~SetDefinitionsRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetDefinitionsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetDefinitionsRequest(const SetDefinitionsRequest& from);
+  SetDefinitionsRequest(SetDefinitionsRequest&& from) noexcept
+    : SetDefinitionsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetDefinitionsRequest& operator=(const SetDefinitionsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetDefinitionsRequest& operator=(SetDefinitionsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetDefinitionsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetDefinitionsRequest* internal_default_instance() {
+    return reinterpret_cast<const SetDefinitionsRequest*>(
+               &_SetDefinitionsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SetDefinitionsRequest& a, SetDefinitionsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetDefinitionsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetDefinitionsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetDefinitionsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetDefinitionsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetDefinitionsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetDefinitionsRequest& from) {
+    SetDefinitionsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetDefinitionsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.SetDefinitionsRequest";
+  }
+  protected:
+  explicit SetDefinitionsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCodeFieldNumber = 1,
+    kYamlFieldNumber = 2,
+  };
+  // optional string code = 1;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  const std::string& code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* code);
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
+  std::string* _internal_mutable_code();
+  public:
+
+  // optional string yaml = 2;
+  bool has_yaml() const;
+  private:
+  bool _internal_has_yaml() const;
+  public:
+  void clear_yaml();
+  const std::string& yaml() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_yaml(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_yaml();
+  PROTOBUF_NODISCARD std::string* release_yaml();
+  void set_allocated_yaml(std::string* yaml);
+  private:
+  const std::string& _internal_yaml() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_yaml(const std::string& value);
+  std::string* _internal_mutable_yaml();
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.SetDefinitionsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr yaml_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyntaxCheckRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.SyntaxCheckRequest) */ {
+ public:
+  inline SyntaxCheckRequest() : SyntaxCheckRequest(nullptr) {}
+  ~SyntaxCheckRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyntaxCheckRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyntaxCheckRequest(const SyntaxCheckRequest& from);
+  SyntaxCheckRequest(SyntaxCheckRequest&& from) noexcept
+    : SyntaxCheckRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyntaxCheckRequest& operator=(const SyntaxCheckRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyntaxCheckRequest& operator=(SyntaxCheckRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyntaxCheckRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyntaxCheckRequest* internal_default_instance() {
+    return reinterpret_cast<const SyntaxCheckRequest*>(
+               &_SyntaxCheckRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SyntaxCheckRequest& a, SyntaxCheckRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyntaxCheckRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyntaxCheckRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyntaxCheckRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyntaxCheckRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyntaxCheckRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyntaxCheckRequest& from) {
+    SyntaxCheckRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyntaxCheckRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.SyntaxCheckRequest";
+  }
+  protected:
+  explicit SyntaxCheckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScriptNamesFieldNumber = 3,
+    kCodeFieldNumber = 1,
+    kScriptCountFieldNumber = 2,
+  };
+  // repeated string script_names = 3;
+  int script_names_size() const;
+  private:
+  int _internal_script_names_size() const;
+  public:
+  void clear_script_names();
+  const std::string& script_names(int index) const;
+  std::string* mutable_script_names(int index);
+  void set_script_names(int index, const std::string& value);
+  void set_script_names(int index, std::string&& value);
+  void set_script_names(int index, const char* value);
+  void set_script_names(int index, const char* value, size_t size);
+  std::string* add_script_names();
+  void add_script_names(const std::string& value);
+  void add_script_names(std::string&& value);
+  void add_script_names(const char* value);
+  void add_script_names(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& script_names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_script_names();
+  private:
+  const std::string& _internal_script_names(int index) const;
+  std::string* _internal_add_script_names();
+  public:
+
+  // optional string code = 1;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  const std::string& code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_code();
+  PROTOBUF_NODISCARD std::string* release_code();
+  void set_allocated_code(std::string* code);
+  private:
+  const std::string& _internal_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
+  std::string* _internal_mutable_code();
+  public:
+
+  // optional int32 script_count = 2;
+  bool has_script_count() const;
+  private:
+  bool _internal_has_script_count() const;
+  public:
+  void clear_script_count();
+  int32_t script_count() const;
+  void set_script_count(int32_t value);
+  private:
+  int32_t _internal_script_count() const;
+  void _internal_set_script_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:buffers.SyntaxCheckRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> script_names_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    int32_t script_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_server_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Empty
+
+// -------------------------------------------------------------------
+
+// Resource
+
+// optional string name = 1;
+inline bool Resource::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Resource::has_name() const {
+  return _internal_has_name();
+}
+inline void Resource::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Resource::name() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Resource::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.Resource.name)
+}
+inline std::string* Resource::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.Resource.name)
+  return _s;
+}
+inline const std::string& Resource::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Resource::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Resource::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Resource::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.Resource.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Resource::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.Resource.name)
+}
+
+// optional bool is_function = 2;
+inline bool Resource::_internal_has_is_function() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Resource::has_is_function() const {
+  return _internal_has_is_function();
+}
+inline void Resource::clear_is_function() {
+  _impl_.is_function_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Resource::_internal_is_function() const {
+  return _impl_.is_function_;
+}
+inline bool Resource::is_function() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.is_function)
+  return _internal_is_function();
+}
+inline void Resource::_internal_set_is_function(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.is_function_ = value;
+}
+inline void Resource::set_is_function(bool value) {
+  _internal_set_is_function(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.is_function)
+}
+
+// optional int32 arg_count_min = 3;
+inline bool Resource::_internal_has_arg_count_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Resource::has_arg_count_min() const {
+  return _internal_has_arg_count_min();
+}
+inline void Resource::clear_arg_count_min() {
+  _impl_.arg_count_min_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Resource::_internal_arg_count_min() const {
+  return _impl_.arg_count_min_;
+}
+inline int32_t Resource::arg_count_min() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.arg_count_min)
+  return _internal_arg_count_min();
+}
+inline void Resource::_internal_set_arg_count_min(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.arg_count_min_ = value;
+}
+inline void Resource::set_arg_count_min(int32_t value) {
+  _internal_set_arg_count_min(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.arg_count_min)
+}
+
+// optional int32 arg_count_max = 4;
+inline bool Resource::_internal_has_arg_count_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Resource::has_arg_count_max() const {
+  return _internal_has_arg_count_max();
+}
+inline void Resource::clear_arg_count_max() {
+  _impl_.arg_count_max_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Resource::_internal_arg_count_max() const {
+  return _impl_.arg_count_max_;
+}
+inline int32_t Resource::arg_count_max() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.arg_count_max)
+  return _internal_arg_count_max();
+}
+inline void Resource::_internal_set_arg_count_max(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.arg_count_max_ = value;
+}
+inline void Resource::set_arg_count_max(int32_t value) {
+  _internal_set_arg_count_max(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.arg_count_max)
+}
+
+// optional int32 overload_count = 5;
+inline bool Resource::_internal_has_overload_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Resource::has_overload_count() const {
+  return _internal_has_overload_count();
+}
+inline void Resource::clear_overload_count() {
+  _impl_.overload_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t Resource::_internal_overload_count() const {
+  return _impl_.overload_count_;
+}
+inline int32_t Resource::overload_count() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.overload_count)
+  return _internal_overload_count();
+}
+inline void Resource::_internal_set_overload_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.overload_count_ = value;
+}
+inline void Resource::set_overload_count(int32_t value) {
+  _internal_set_overload_count(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.overload_count)
+}
+
+// optional int32 is_type_name = 6;
+inline bool Resource::_internal_has_is_type_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Resource::has_is_type_name() const {
+  return _internal_has_is_type_name();
+}
+inline void Resource::clear_is_type_name() {
+  _impl_.is_type_name_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Resource::_internal_is_type_name() const {
+  return _impl_.is_type_name_;
+}
+inline int32_t Resource::is_type_name() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.is_type_name)
+  return _internal_is_type_name();
+}
+inline void Resource::_internal_set_is_type_name(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.is_type_name_ = value;
+}
+inline void Resource::set_is_type_name(int32_t value) {
+  _internal_set_is_type_name(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.is_type_name)
+}
+
+// optional int32 is_global = 7;
+inline bool Resource::_internal_has_is_global() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Resource::has_is_global() const {
+  return _internal_has_is_global();
+}
+inline void Resource::clear_is_global() {
+  _impl_.is_global_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t Resource::_internal_is_global() const {
+  return _impl_.is_global_;
+}
+inline int32_t Resource::is_global() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.is_global)
+  return _internal_is_global();
+}
+inline void Resource::_internal_set_is_global(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.is_global_ = value;
+}
+inline void Resource::set_is_global(int32_t value) {
+  _internal_set_is_global(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.is_global)
+}
+
+// optional bool is_end = 8;
+inline bool Resource::_internal_has_is_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Resource::has_is_end() const {
+  return _internal_has_is_end();
+}
+inline void Resource::clear_is_end() {
+  _impl_.is_end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Resource::_internal_is_end() const {
+  return _impl_.is_end_;
+}
+inline bool Resource::is_end() const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.is_end)
+  return _internal_is_end();
+}
+inline void Resource::_internal_set_is_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.is_end_ = value;
+}
+inline void Resource::set_is_end(bool value) {
+  _internal_set_is_end(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.is_end)
+}
+
+// repeated string parameters = 9;
+inline int Resource::_internal_parameters_size() const {
+  return _impl_.parameters_.size();
+}
+inline int Resource::parameters_size() const {
+  return _internal_parameters_size();
+}
+inline void Resource::clear_parameters() {
+  _impl_.parameters_.Clear();
+}
+inline std::string* Resource::add_parameters() {
+  std::string* _s = _internal_add_parameters();
+  // @@protoc_insertion_point(field_add_mutable:buffers.Resource.parameters)
+  return _s;
+}
+inline const std::string& Resource::_internal_parameters(int index) const {
+  return _impl_.parameters_.Get(index);
+}
+inline const std::string& Resource::parameters(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.Resource.parameters)
+  return _internal_parameters(index);
+}
+inline std::string* Resource::mutable_parameters(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.Resource.parameters)
+  return _impl_.parameters_.Mutable(index);
+}
+inline void Resource::set_parameters(int index, const std::string& value) {
+  _impl_.parameters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:buffers.Resource.parameters)
+}
+inline void Resource::set_parameters(int index, std::string&& value) {
+  _impl_.parameters_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:buffers.Resource.parameters)
+}
+inline void Resource::set_parameters(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.parameters_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:buffers.Resource.parameters)
+}
+inline void Resource::set_parameters(int index, const char* value, size_t size) {
+  _impl_.parameters_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:buffers.Resource.parameters)
+}
+inline std::string* Resource::_internal_add_parameters() {
+  return _impl_.parameters_.Add();
+}
+inline void Resource::add_parameters(const std::string& value) {
+  _impl_.parameters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:buffers.Resource.parameters)
+}
+inline void Resource::add_parameters(std::string&& value) {
+  _impl_.parameters_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:buffers.Resource.parameters)
+}
+inline void Resource::add_parameters(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.parameters_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:buffers.Resource.parameters)
+}
+inline void Resource::add_parameters(const char* value, size_t size) {
+  _impl_.parameters_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:buffers.Resource.parameters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Resource::parameters() const {
+  // @@protoc_insertion_point(field_list:buffers.Resource.parameters)
+  return _impl_.parameters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Resource::mutable_parameters() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.Resource.parameters)
+  return &_impl_.parameters_;
+}
+
+// -------------------------------------------------------------------
+
+// CompileRequest
+
+// optional .buffers.Game game = 1;
+inline bool CompileRequest::_internal_has_game() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.game_ != nullptr);
+  return value;
+}
+inline bool CompileRequest::has_game() const {
+  return _internal_has_game();
+}
+inline const ::buffers::Game& CompileRequest::_internal_game() const {
+  const ::buffers::Game* p = _impl_.game_;
+  return p != nullptr ? *p : reinterpret_cast<const ::buffers::Game&>(
+      ::buffers::_Game_default_instance_);
+}
+inline const ::buffers::Game& CompileRequest::game() const {
+  // @@protoc_insertion_point(field_get:buffers.CompileRequest.game)
+  return _internal_game();
+}
+inline void CompileRequest::unsafe_arena_set_allocated_game(
+    ::buffers::Game* game) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_);
+  }
+  _impl_.game_ = game;
+  if (game) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.CompileRequest.game)
+}
+inline ::buffers::Game* CompileRequest::release_game() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::buffers::Game* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::buffers::Game* CompileRequest::unsafe_arena_release_game() {
+  // @@protoc_insertion_point(field_release:buffers.CompileRequest.game)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::buffers::Game* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+  return temp;
+}
+inline ::buffers::Game* CompileRequest::_internal_mutable_game() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.game_ == nullptr) {
+    auto* p = CreateMaybeMessage<::buffers::Game>(GetArenaForAllocation());
+    _impl_.game_ = p;
+  }
+  return _impl_.game_;
+}
+inline ::buffers::Game* CompileRequest::mutable_game() {
+  ::buffers::Game* _msg = _internal_mutable_game();
+  // @@protoc_insertion_point(field_mutable:buffers.CompileRequest.game)
+  return _msg;
+}
+inline void CompileRequest::set_allocated_game(::buffers::Game* game) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_);
+  }
+  if (game) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(game));
+    if (message_arena != submessage_arena) {
+      game = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.game_ = game;
+  // @@protoc_insertion_point(field_set_allocated:buffers.CompileRequest.game)
+}
+
+// optional string name = 2;
+inline bool CompileRequest::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CompileRequest::has_name() const {
+  return _internal_has_name();
+}
+inline void CompileRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CompileRequest::name() const {
+  // @@protoc_insertion_point(field_get:buffers.CompileRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompileRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.CompileRequest.name)
+}
+inline std::string* CompileRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.CompileRequest.name)
+  return _s;
+}
+inline const std::string& CompileRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CompileRequest::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompileRequest::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompileRequest::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.CompileRequest.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CompileRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.CompileRequest.name)
+}
+
+// optional .buffers.CompileMode mode = 3;
+inline bool CompileRequest::_internal_has_mode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CompileRequest::has_mode() const {
+  return _internal_has_mode();
+}
+inline void CompileRequest::clear_mode() {
+  _impl_.mode_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::buffers::CompileMode CompileRequest::_internal_mode() const {
+  return static_cast< ::buffers::CompileMode >(_impl_.mode_);
+}
+inline ::buffers::CompileMode CompileRequest::mode() const {
+  // @@protoc_insertion_point(field_get:buffers.CompileRequest.mode)
+  return _internal_mode();
+}
+inline void CompileRequest::_internal_set_mode(::buffers::CompileMode value) {
+  assert(::buffers::CompileMode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.mode_ = value;
+}
+inline void CompileRequest::set_mode(::buffers::CompileMode value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:buffers.CompileRequest.mode)
+}
+
+// -------------------------------------------------------------------
+
+// CompileReply
+
+// optional string message = 1;
+inline bool CompileReply::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CompileReply::has_message() const {
+  return _internal_has_message();
+}
+inline void CompileReply::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CompileReply::message() const {
+  // @@protoc_insertion_point(field_get:buffers.CompileReply.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompileReply::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.CompileReply.message)
+}
+inline std::string* CompileReply::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:buffers.CompileReply.message)
+  return _s;
+}
+inline const std::string& CompileReply::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void CompileReply::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompileReply::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompileReply::release_message() {
+  // @@protoc_insertion_point(field_release:buffers.CompileReply.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CompileReply::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.CompileReply.message)
+}
+
+// optional int32 progress = 2;
+inline bool CompileReply::_internal_has_progress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CompileReply::has_progress() const {
+  return _internal_has_progress();
+}
+inline void CompileReply::clear_progress() {
+  _impl_.progress_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CompileReply::_internal_progress() const {
+  return _impl_.progress_;
+}
+inline int32_t CompileReply::progress() const {
+  // @@protoc_insertion_point(field_get:buffers.CompileReply.progress)
+  return _internal_progress();
+}
+inline void CompileReply::_internal_set_progress(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.progress_ = value;
+}
+inline void CompileReply::set_progress(int32_t value) {
+  _internal_set_progress(value);
+  // @@protoc_insertion_point(field_set:buffers.CompileReply.progress)
+}
+
+// -------------------------------------------------------------------
+
+// SyntaxError
+
+// optional string message = 1;
+inline bool SyntaxError::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyntaxError::has_message() const {
+  return _internal_has_message();
+}
+inline void SyntaxError::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyntaxError::message() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxError.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyntaxError::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.SyntaxError.message)
+}
+inline std::string* SyntaxError::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:buffers.SyntaxError.message)
+  return _s;
+}
+inline const std::string& SyntaxError::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void SyntaxError::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyntaxError::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyntaxError::release_message() {
+  // @@protoc_insertion_point(field_release:buffers.SyntaxError.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyntaxError::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.SyntaxError.message)
+}
+
+// optional int32 line = 2;
+inline bool SyntaxError::_internal_has_line() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyntaxError::has_line() const {
+  return _internal_has_line();
+}
+inline void SyntaxError::clear_line() {
+  _impl_.line_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SyntaxError::_internal_line() const {
+  return _impl_.line_;
+}
+inline int32_t SyntaxError::line() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxError.line)
+  return _internal_line();
+}
+inline void SyntaxError::_internal_set_line(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.line_ = value;
+}
+inline void SyntaxError::set_line(int32_t value) {
+  _internal_set_line(value);
+  // @@protoc_insertion_point(field_set:buffers.SyntaxError.line)
+}
+
+// optional int32 position = 3;
+inline bool SyntaxError::_internal_has_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SyntaxError::has_position() const {
+  return _internal_has_position();
+}
+inline void SyntaxError::clear_position() {
+  _impl_.position_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t SyntaxError::_internal_position() const {
+  return _impl_.position_;
+}
+inline int32_t SyntaxError::position() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxError.position)
+  return _internal_position();
+}
+inline void SyntaxError::_internal_set_position(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.position_ = value;
+}
+inline void SyntaxError::set_position(int32_t value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:buffers.SyntaxError.position)
+}
+
+// optional int32 absolute_index = 4;
+inline bool SyntaxError::_internal_has_absolute_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SyntaxError::has_absolute_index() const {
+  return _internal_has_absolute_index();
+}
+inline void SyntaxError::clear_absolute_index() {
+  _impl_.absolute_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t SyntaxError::_internal_absolute_index() const {
+  return _impl_.absolute_index_;
+}
+inline int32_t SyntaxError::absolute_index() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxError.absolute_index)
+  return _internal_absolute_index();
+}
+inline void SyntaxError::_internal_set_absolute_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.absolute_index_ = value;
+}
+inline void SyntaxError::set_absolute_index(int32_t value) {
+  _internal_set_absolute_index(value);
+  // @@protoc_insertion_point(field_set:buffers.SyntaxError.absolute_index)
+}
+
+// -------------------------------------------------------------------
+
+// SetDefinitionsRequest
+
+// optional string code = 1;
+inline bool SetDefinitionsRequest::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SetDefinitionsRequest::has_code() const {
+  return _internal_has_code();
+}
+inline void SetDefinitionsRequest::clear_code() {
+  _impl_.code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SetDefinitionsRequest::code() const {
+  // @@protoc_insertion_point(field_get:buffers.SetDefinitionsRequest.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetDefinitionsRequest::set_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.SetDefinitionsRequest.code)
+}
+inline std::string* SetDefinitionsRequest::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:buffers.SetDefinitionsRequest.code)
+  return _s;
+}
+inline const std::string& SetDefinitionsRequest::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void SetDefinitionsRequest::_internal_set_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetDefinitionsRequest::_internal_mutable_code() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetDefinitionsRequest::release_code() {
+  // @@protoc_insertion_point(field_release:buffers.SetDefinitionsRequest.code)
+  if (!_internal_has_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SetDefinitionsRequest::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.SetDefinitionsRequest.code)
+}
+
+// optional string yaml = 2;
+inline bool SetDefinitionsRequest::_internal_has_yaml() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SetDefinitionsRequest::has_yaml() const {
+  return _internal_has_yaml();
+}
+inline void SetDefinitionsRequest::clear_yaml() {
+  _impl_.yaml_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SetDefinitionsRequest::yaml() const {
+  // @@protoc_insertion_point(field_get:buffers.SetDefinitionsRequest.yaml)
+  return _internal_yaml();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetDefinitionsRequest::set_yaml(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.yaml_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.SetDefinitionsRequest.yaml)
+}
+inline std::string* SetDefinitionsRequest::mutable_yaml() {
+  std::string* _s = _internal_mutable_yaml();
+  // @@protoc_insertion_point(field_mutable:buffers.SetDefinitionsRequest.yaml)
+  return _s;
+}
+inline const std::string& SetDefinitionsRequest::_internal_yaml() const {
+  return _impl_.yaml_.Get();
+}
+inline void SetDefinitionsRequest::_internal_set_yaml(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.yaml_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SetDefinitionsRequest::_internal_mutable_yaml() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.yaml_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SetDefinitionsRequest::release_yaml() {
+  // @@protoc_insertion_point(field_release:buffers.SetDefinitionsRequest.yaml)
+  if (!_internal_has_yaml()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.yaml_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.yaml_.IsDefault()) {
+    _impl_.yaml_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SetDefinitionsRequest::set_allocated_yaml(std::string* yaml) {
+  if (yaml != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.yaml_.SetAllocated(yaml, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.yaml_.IsDefault()) {
+    _impl_.yaml_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.SetDefinitionsRequest.yaml)
+}
+
+// -------------------------------------------------------------------
+
+// SyntaxCheckRequest
+
+// optional string code = 1;
+inline bool SyntaxCheckRequest::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyntaxCheckRequest::has_code() const {
+  return _internal_has_code();
+}
+inline void SyntaxCheckRequest::clear_code() {
+  _impl_.code_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyntaxCheckRequest::code() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxCheckRequest.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyntaxCheckRequest::set_code(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.SyntaxCheckRequest.code)
+}
+inline std::string* SyntaxCheckRequest::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:buffers.SyntaxCheckRequest.code)
+  return _s;
+}
+inline const std::string& SyntaxCheckRequest::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void SyntaxCheckRequest::_internal_set_code(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyntaxCheckRequest::_internal_mutable_code() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyntaxCheckRequest::release_code() {
+  // @@protoc_insertion_point(field_release:buffers.SyntaxCheckRequest.code)
+  if (!_internal_has_code()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.code_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyntaxCheckRequest::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.SyntaxCheckRequest.code)
+}
+
+// optional int32 script_count = 2;
+inline bool SyntaxCheckRequest::_internal_has_script_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SyntaxCheckRequest::has_script_count() const {
+  return _internal_has_script_count();
+}
+inline void SyntaxCheckRequest::clear_script_count() {
+  _impl_.script_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t SyntaxCheckRequest::_internal_script_count() const {
+  return _impl_.script_count_;
+}
+inline int32_t SyntaxCheckRequest::script_count() const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxCheckRequest.script_count)
+  return _internal_script_count();
+}
+inline void SyntaxCheckRequest::_internal_set_script_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.script_count_ = value;
+}
+inline void SyntaxCheckRequest::set_script_count(int32_t value) {
+  _internal_set_script_count(value);
+  // @@protoc_insertion_point(field_set:buffers.SyntaxCheckRequest.script_count)
+}
+
+// repeated string script_names = 3;
+inline int SyntaxCheckRequest::_internal_script_names_size() const {
+  return _impl_.script_names_.size();
+}
+inline int SyntaxCheckRequest::script_names_size() const {
+  return _internal_script_names_size();
+}
+inline void SyntaxCheckRequest::clear_script_names() {
+  _impl_.script_names_.Clear();
+}
+inline std::string* SyntaxCheckRequest::add_script_names() {
+  std::string* _s = _internal_add_script_names();
+  // @@protoc_insertion_point(field_add_mutable:buffers.SyntaxCheckRequest.script_names)
+  return _s;
+}
+inline const std::string& SyntaxCheckRequest::_internal_script_names(int index) const {
+  return _impl_.script_names_.Get(index);
+}
+inline const std::string& SyntaxCheckRequest::script_names(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.SyntaxCheckRequest.script_names)
+  return _internal_script_names(index);
+}
+inline std::string* SyntaxCheckRequest::mutable_script_names(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.SyntaxCheckRequest.script_names)
+  return _impl_.script_names_.Mutable(index);
+}
+inline void SyntaxCheckRequest::set_script_names(int index, const std::string& value) {
+  _impl_.script_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::set_script_names(int index, std::string&& value) {
+  _impl_.script_names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::set_script_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.script_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::set_script_names(int index, const char* value, size_t size) {
+  _impl_.script_names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:buffers.SyntaxCheckRequest.script_names)
+}
+inline std::string* SyntaxCheckRequest::_internal_add_script_names() {
+  return _impl_.script_names_.Add();
+}
+inline void SyntaxCheckRequest::add_script_names(const std::string& value) {
+  _impl_.script_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::add_script_names(std::string&& value) {
+  _impl_.script_names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::add_script_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.script_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:buffers.SyntaxCheckRequest.script_names)
+}
+inline void SyntaxCheckRequest::add_script_names(const char* value, size_t size) {
+  _impl_.script_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:buffers.SyntaxCheckRequest.script_names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SyntaxCheckRequest::script_names() const {
+  // @@protoc_insertion_point(field_list:buffers.SyntaxCheckRequest.script_names)
+  return _impl_.script_names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SyntaxCheckRequest::mutable_script_names() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.SyntaxCheckRequest.script_names)
+  return &_impl_.script_names_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace buffers
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::buffers::CompileMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::buffers::CompileMode>() {
+  return ::buffers::CompileMode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_server_2eproto
@@ -0,0 +1,1206 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: treenode.proto
+
+#include "treenode.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace buffers {
+PROTOBUF_CONSTEXPR TreeNode::TreeNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.child_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct TreeNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TreeNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TreeNodeDefaultTypeInternal() {}
+  union {
+    TreeNode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TreeNodeDefaultTypeInternal _TreeNode_default_instance_;
+}  // namespace buffers
+static ::_pb::Metadata file_level_metadata_treenode_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_treenode_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_treenode_2eproto = nullptr;
+
+const uint32_t TableStruct_treenode_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _impl_.child_),
+  PROTOBUF_FIELD_OFFSET(::buffers::TreeNode, _impl_.type_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 21, -1, sizeof(::buffers::TreeNode)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::buffers::_TreeNode_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_treenode_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016treenode.proto\022\007buffers\032\026resources/Spr"
+  "ite.proto\032\025resources/Sound.proto\032\032resour"
+  "ces/Background.proto\032\026resources/Object.p"
+  "roto\032\026resources/Script.proto\032\026resources/"
+  "Shader.proto\032\024resources/Path.proto\032\024reso"
+  "urces/Font.proto\032\030resources/Timeline.pro"
+  "to\032\024resources/Room.proto\032\027resources/Incl"
+  "ude.proto\"\303\004\n\010TreeNode\022\020\n\006folder\030\001 \001(\010H\000"
+  "\022+\n\006sprite\030\002 \001(\0132\031.buffers.resources.Spr"
+  "iteH\000\022)\n\005sound\030\003 \001(\0132\030.buffers.resources"
+  ".SoundH\000\0223\n\nbackground\030\004 \001(\0132\035.buffers.r"
+  "esources.BackgroundH\000\022\'\n\004path\030\005 \001(\0132\027.bu"
+  "ffers.resources.PathH\000\022+\n\006script\030\006 \001(\0132\031"
+  ".buffers.resources.ScriptH\000\022+\n\006shader\030\007 "
+  "\001(\0132\031.buffers.resources.ShaderH\000\022\'\n\004font"
+  "\030\010 \001(\0132\027.buffers.resources.FontH\000\022/\n\010tim"
+  "eline\030\t \001(\0132\033.buffers.resources.Timeline"
+  "H\000\022+\n\006object\030\n \001(\0132\031.buffers.resources.O"
+  "bjectH\000\022\'\n\004room\030\013 \001(\0132\027.buffers.resource"
+  "s.RoomH\000\022-\n\007include\030\014 \001(\0132\032.buffers.reso"
+  "urces.IncludeH\000\022\014\n\004name\030\020 \001(\t\022 \n\005child\030\021"
+  " \003(\0132\021.buffers.TreeNodeB\006\n\004type"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_treenode_2eproto_deps[11] = {
+  &::descriptor_table_resources_2fBackground_2eproto,
+  &::descriptor_table_resources_2fFont_2eproto,
+  &::descriptor_table_resources_2fInclude_2eproto,
+  &::descriptor_table_resources_2fObject_2eproto,
+  &::descriptor_table_resources_2fPath_2eproto,
+  &::descriptor_table_resources_2fRoom_2eproto,
+  &::descriptor_table_resources_2fScript_2eproto,
+  &::descriptor_table_resources_2fShader_2eproto,
+  &::descriptor_table_resources_2fSound_2eproto,
+  &::descriptor_table_resources_2fSprite_2eproto,
+  &::descriptor_table_resources_2fTimeline_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_treenode_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_treenode_2eproto = {
+    false, false, 871, descriptor_table_protodef_treenode_2eproto,
+    "treenode.proto",
+    &descriptor_table_treenode_2eproto_once, descriptor_table_treenode_2eproto_deps, 11, 1,
+    schemas, file_default_instances, TableStruct_treenode_2eproto::offsets,
+    file_level_metadata_treenode_2eproto, file_level_enum_descriptors_treenode_2eproto,
+    file_level_service_descriptors_treenode_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_treenode_2eproto_getter() {
+  return &descriptor_table_treenode_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_treenode_2eproto(&descriptor_table_treenode_2eproto);
+namespace buffers {
+
+// ===================================================================
+
+class TreeNode::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TreeNode>()._impl_._has_bits_);
+  static const ::buffers::resources::Sprite& sprite(const TreeNode* msg);
+  static const ::buffers::resources::Sound& sound(const TreeNode* msg);
+  static const ::buffers::resources::Background& background(const TreeNode* msg);
+  static const ::buffers::resources::Path& path(const TreeNode* msg);
+  static const ::buffers::resources::Script& script(const TreeNode* msg);
+  static const ::buffers::resources::Shader& shader(const TreeNode* msg);
+  static const ::buffers::resources::Font& font(const TreeNode* msg);
+  static const ::buffers::resources::Timeline& timeline(const TreeNode* msg);
+  static const ::buffers::resources::Object& object(const TreeNode* msg);
+  static const ::buffers::resources::Room& room(const TreeNode* msg);
+  static const ::buffers::resources::Include& include(const TreeNode* msg);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::buffers::resources::Sprite&
+TreeNode::_Internal::sprite(const TreeNode* msg) {
+  return *msg->_impl_.type_.sprite_;
+}
+const ::buffers::resources::Sound&
+TreeNode::_Internal::sound(const TreeNode* msg) {
+  return *msg->_impl_.type_.sound_;
+}
+const ::buffers::resources::Background&
+TreeNode::_Internal::background(const TreeNode* msg) {
+  return *msg->_impl_.type_.background_;
+}
+const ::buffers::resources::Path&
+TreeNode::_Internal::path(const TreeNode* msg) {
+  return *msg->_impl_.type_.path_;
+}
+const ::buffers::resources::Script&
+TreeNode::_Internal::script(const TreeNode* msg) {
+  return *msg->_impl_.type_.script_;
+}
+const ::buffers::resources::Shader&
+TreeNode::_Internal::shader(const TreeNode* msg) {
+  return *msg->_impl_.type_.shader_;
+}
+const ::buffers::resources::Font&
+TreeNode::_Internal::font(const TreeNode* msg) {
+  return *msg->_impl_.type_.font_;
+}
+const ::buffers::resources::Timeline&
+TreeNode::_Internal::timeline(const TreeNode* msg) {
+  return *msg->_impl_.type_.timeline_;
+}
+const ::buffers::resources::Object&
+TreeNode::_Internal::object(const TreeNode* msg) {
+  return *msg->_impl_.type_.object_;
+}
+const ::buffers::resources::Room&
+TreeNode::_Internal::room(const TreeNode* msg) {
+  return *msg->_impl_.type_.room_;
+}
+const ::buffers::resources::Include&
+TreeNode::_Internal::include(const TreeNode* msg) {
+  return *msg->_impl_.type_.include_;
+}
+void TreeNode::set_allocated_sprite(::buffers::resources::Sprite* sprite) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (sprite) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sprite));
+    if (message_arena != submessage_arena) {
+      sprite = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sprite, submessage_arena);
+    }
+    set_has_sprite();
+    _impl_.type_.sprite_ = sprite;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.sprite)
+}
+void TreeNode::clear_sprite() {
+  if (_internal_has_sprite()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.sprite_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_sound(::buffers::resources::Sound* sound) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (sound) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(sound));
+    if (message_arena != submessage_arena) {
+      sound = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, sound, submessage_arena);
+    }
+    set_has_sound();
+    _impl_.type_.sound_ = sound;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.sound)
+}
+void TreeNode::clear_sound() {
+  if (_internal_has_sound()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.sound_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_background(::buffers::resources::Background* background) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (background) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(background));
+    if (message_arena != submessage_arena) {
+      background = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, background, submessage_arena);
+    }
+    set_has_background();
+    _impl_.type_.background_ = background;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.background)
+}
+void TreeNode::clear_background() {
+  if (_internal_has_background()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.background_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_path(::buffers::resources::Path* path) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (path) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(path));
+    if (message_arena != submessage_arena) {
+      path = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, path, submessage_arena);
+    }
+    set_has_path();
+    _impl_.type_.path_ = path;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.path)
+}
+void TreeNode::clear_path() {
+  if (_internal_has_path()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.path_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_script(::buffers::resources::Script* script) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (script) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(script));
+    if (message_arena != submessage_arena) {
+      script = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, script, submessage_arena);
+    }
+    set_has_script();
+    _impl_.type_.script_ = script;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.script)
+}
+void TreeNode::clear_script() {
+  if (_internal_has_script()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.script_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_shader(::buffers::resources::Shader* shader) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (shader) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(shader));
+    if (message_arena != submessage_arena) {
+      shader = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shader, submessage_arena);
+    }
+    set_has_shader();
+    _impl_.type_.shader_ = shader;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.shader)
+}
+void TreeNode::clear_shader() {
+  if (_internal_has_shader()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.shader_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_font(::buffers::resources::Font* font) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (font) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(font));
+    if (message_arena != submessage_arena) {
+      font = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, font, submessage_arena);
+    }
+    set_has_font();
+    _impl_.type_.font_ = font;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.font)
+}
+void TreeNode::clear_font() {
+  if (_internal_has_font()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.font_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_timeline(::buffers::resources::Timeline* timeline) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (timeline) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timeline));
+    if (message_arena != submessage_arena) {
+      timeline = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timeline, submessage_arena);
+    }
+    set_has_timeline();
+    _impl_.type_.timeline_ = timeline;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.timeline)
+}
+void TreeNode::clear_timeline() {
+  if (_internal_has_timeline()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.timeline_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_object(::buffers::resources::Object* object) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (object) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(object));
+    if (message_arena != submessage_arena) {
+      object = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, object, submessage_arena);
+    }
+    set_has_object();
+    _impl_.type_.object_ = object;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.object)
+}
+void TreeNode::clear_object() {
+  if (_internal_has_object()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.object_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_room(::buffers::resources::Room* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(room));
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    set_has_room();
+    _impl_.type_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.room)
+}
+void TreeNode::clear_room() {
+  if (_internal_has_room()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.room_;
+    }
+    clear_has_type();
+  }
+}
+void TreeNode::set_allocated_include(::buffers::resources::Include* include) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (include) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(include));
+    if (message_arena != submessage_arena) {
+      include = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, include, submessage_arena);
+    }
+    set_has_include();
+    _impl_.type_.include_ = include;
+  }
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.include)
+}
+void TreeNode::clear_include() {
+  if (_internal_has_include()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.include_;
+    }
+    clear_has_type();
+  }
+}
+TreeNode::TreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:buffers.TreeNode)
+}
+TreeNode::TreeNode(const TreeNode& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TreeNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.child_){from._impl_.child_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  clear_has_type();
+  switch (from.type_case()) {
+    case kFolder: {
+      _this->_internal_set_folder(from._internal_folder());
+      break;
+    }
+    case kSprite: {
+      _this->_internal_mutable_sprite()->::buffers::resources::Sprite::MergeFrom(
+          from._internal_sprite());
+      break;
+    }
+    case kSound: {
+      _this->_internal_mutable_sound()->::buffers::resources::Sound::MergeFrom(
+          from._internal_sound());
+      break;
+    }
+    case kBackground: {
+      _this->_internal_mutable_background()->::buffers::resources::Background::MergeFrom(
+          from._internal_background());
+      break;
+    }
+    case kPath: {
+      _this->_internal_mutable_path()->::buffers::resources::Path::MergeFrom(
+          from._internal_path());
+      break;
+    }
+    case kScript: {
+      _this->_internal_mutable_script()->::buffers::resources::Script::MergeFrom(
+          from._internal_script());
+      break;
+    }
+    case kShader: {
+      _this->_internal_mutable_shader()->::buffers::resources::Shader::MergeFrom(
+          from._internal_shader());
+      break;
+    }
+    case kFont: {
+      _this->_internal_mutable_font()->::buffers::resources::Font::MergeFrom(
+          from._internal_font());
+      break;
+    }
+    case kTimeline: {
+      _this->_internal_mutable_timeline()->::buffers::resources::Timeline::MergeFrom(
+          from._internal_timeline());
+      break;
+    }
+    case kObject: {
+      _this->_internal_mutable_object()->::buffers::resources::Object::MergeFrom(
+          from._internal_object());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::buffers::resources::Room::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kInclude: {
+      _this->_internal_mutable_include()->::buffers::resources::Include::MergeFrom(
+          from._internal_include());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:buffers.TreeNode)
+}
+
+inline void TreeNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.child_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_type();
+}
+
+TreeNode::~TreeNode() {
+  // @@protoc_insertion_point(destructor:buffers.TreeNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TreeNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.child_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (has_type()) {
+    clear_type();
+  }
+}
+
+void TreeNode::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TreeNode::clear_type() {
+// @@protoc_insertion_point(one_of_clear_start:buffers.TreeNode)
+  switch (type_case()) {
+    case kFolder: {
+      // No need to clear
+      break;
+    }
+    case kSprite: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.sprite_;
+      }
+      break;
+    }
+    case kSound: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.sound_;
+      }
+      break;
+    }
+    case kBackground: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.background_;
+      }
+      break;
+    }
+    case kPath: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.path_;
+      }
+      break;
+    }
+    case kScript: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.script_;
+      }
+      break;
+    }
+    case kShader: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.shader_;
+      }
+      break;
+    }
+    case kFont: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.font_;
+      }
+      break;
+    }
+    case kTimeline: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.timeline_;
+      }
+      break;
+    }
+    case kObject: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.object_;
+      }
+      break;
+    }
+    case kRoom: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.room_;
+      }
+      break;
+    }
+    case kInclude: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.include_;
+      }
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+
+
+void TreeNode::Clear() {
+// @@protoc_insertion_point(message_clear_start:buffers.TreeNode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.child_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  clear_type();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TreeNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool folder = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _internal_set_folder(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Sprite sprite = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sprite(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Sound sound = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sound(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Background background = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_background(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Path path = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_path(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Script script = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_script(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Shader shader = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shader(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Font font = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_font(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Timeline timeline = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timeline(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Object object = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_object(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Room room = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .buffers.resources.Include include = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_include(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "buffers.TreeNode.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .buffers.TreeNode child = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_child(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TreeNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:buffers.TreeNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (type_case()) {
+    case kFolder: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_folder(), target);
+      break;
+    }
+    case kSprite: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::sprite(this),
+          _Internal::sprite(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kSound: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::sound(this),
+          _Internal::sound(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kBackground: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::background(this),
+          _Internal::background(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kPath: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::path(this),
+          _Internal::path(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kScript: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::script(this),
+          _Internal::script(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kShader: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, _Internal::shader(this),
+          _Internal::shader(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kFont: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, _Internal::font(this),
+          _Internal::font(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kTimeline: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, _Internal::timeline(this),
+          _Internal::timeline(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kObject: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, _Internal::object(this),
+          _Internal::object(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kRoom: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, _Internal::room(this),
+          _Internal::room(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kInclude: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, _Internal::include(this),
+          _Internal::include(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
+  }
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 16;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "buffers.TreeNode.name");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_name(), target);
+  }
+
+  // repeated .buffers.TreeNode child = 17;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_child_size()); i < n; i++) {
+    const auto& repfield = this->_internal_child(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:buffers.TreeNode)
+  return target;
+}
+
+size_t TreeNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:buffers.TreeNode)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .buffers.TreeNode child = 17;
+  total_size += 2UL * this->_internal_child_size();
+  for (const auto& msg : this->_impl_.child_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string name = 16;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  switch (type_case()) {
+    // bool folder = 1;
+    case kFolder: {
+      total_size += 1 + 1;
+      break;
+    }
+    // .buffers.resources.Sprite sprite = 2;
+    case kSprite: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.sprite_);
+      break;
+    }
+    // .buffers.resources.Sound sound = 3;
+    case kSound: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.sound_);
+      break;
+    }
+    // .buffers.resources.Background background = 4;
+    case kBackground: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.background_);
+      break;
+    }
+    // .buffers.resources.Path path = 5;
+    case kPath: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.path_);
+      break;
+    }
+    // .buffers.resources.Script script = 6;
+    case kScript: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.script_);
+      break;
+    }
+    // .buffers.resources.Shader shader = 7;
+    case kShader: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.shader_);
+      break;
+    }
+    // .buffers.resources.Font font = 8;
+    case kFont: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.font_);
+      break;
+    }
+    // .buffers.resources.Timeline timeline = 9;
+    case kTimeline: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.timeline_);
+      break;
+    }
+    // .buffers.resources.Object object = 10;
+    case kObject: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.object_);
+      break;
+    }
+    // .buffers.resources.Room room = 11;
+    case kRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.room_);
+      break;
+    }
+    // .buffers.resources.Include include = 12;
+    case kInclude: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.include_);
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TreeNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TreeNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TreeNode::GetClassData() const { return &_class_data_; }
+
+
+void TreeNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TreeNode*>(&to_msg);
+  auto& from = static_cast<const TreeNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:buffers.TreeNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.child_.MergeFrom(from._impl_.child_);
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  switch (from.type_case()) {
+    case kFolder: {
+      _this->_internal_set_folder(from._internal_folder());
+      break;
+    }
+    case kSprite: {
+      _this->_internal_mutable_sprite()->::buffers::resources::Sprite::MergeFrom(
+          from._internal_sprite());
+      break;
+    }
+    case kSound: {
+      _this->_internal_mutable_sound()->::buffers::resources::Sound::MergeFrom(
+          from._internal_sound());
+      break;
+    }
+    case kBackground: {
+      _this->_internal_mutable_background()->::buffers::resources::Background::MergeFrom(
+          from._internal_background());
+      break;
+    }
+    case kPath: {
+      _this->_internal_mutable_path()->::buffers::resources::Path::MergeFrom(
+          from._internal_path());
+      break;
+    }
+    case kScript: {
+      _this->_internal_mutable_script()->::buffers::resources::Script::MergeFrom(
+          from._internal_script());
+      break;
+    }
+    case kShader: {
+      _this->_internal_mutable_shader()->::buffers::resources::Shader::MergeFrom(
+          from._internal_shader());
+      break;
+    }
+    case kFont: {
+      _this->_internal_mutable_font()->::buffers::resources::Font::MergeFrom(
+          from._internal_font());
+      break;
+    }
+    case kTimeline: {
+      _this->_internal_mutable_timeline()->::buffers::resources::Timeline::MergeFrom(
+          from._internal_timeline());
+      break;
+    }
+    case kObject: {
+      _this->_internal_mutable_object()->::buffers::resources::Object::MergeFrom(
+          from._internal_object());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::buffers::resources::Room::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kInclude: {
+      _this->_internal_mutable_include()->::buffers::resources::Include::MergeFrom(
+          from._internal_include());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TreeNode::CopyFrom(const TreeNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:buffers.TreeNode)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TreeNode::IsInitialized() const {
+  return true;
+}
+
+void TreeNode::InternalSwap(TreeNode* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.child_.InternalSwap(&other->_impl_.child_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TreeNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_treenode_2eproto_getter, &descriptor_table_treenode_2eproto_once,
+      file_level_metadata_treenode_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::buffers::TreeNode*
+Arena::CreateMaybeMessage< ::buffers::TreeNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::buffers::TreeNode >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
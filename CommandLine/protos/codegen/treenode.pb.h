@@ -0,0 +1,1430 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: treenode.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_treenode_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_treenode_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "resources/Sprite.pb.h"
+#include "resources/Sound.pb.h"
+#include "resources/Background.pb.h"
+#include "resources/Object.pb.h"
+#include "resources/Script.pb.h"
+#include "resources/Shader.pb.h"
+#include "resources/Path.pb.h"
+#include "resources/Font.pb.h"
+#include "resources/Timeline.pb.h"
+#include "resources/Room.pb.h"
+#include "resources/Include.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_treenode_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_treenode_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_treenode_2eproto;
+namespace buffers {
+class TreeNode;
+struct TreeNodeDefaultTypeInternal;
+extern TreeNodeDefaultTypeInternal _TreeNode_default_instance_;
+}  // namespace buffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::buffers::TreeNode* Arena::CreateMaybeMessage<::buffers::TreeNode>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace buffers {
+
+// ===================================================================
+
+class TreeNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:buffers.TreeNode) */ {
+ public:
+  inline TreeNode() : TreeNode(nullptr) {}
+  ~TreeNode() override;
+  explicit PROTOBUF_CONSTEXPR TreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TreeNode(const TreeNode& from);
+  TreeNode(TreeNode&& from) noexcept
+    : TreeNode() {
+    *this = ::std::move(from);
+  }
+
+  inline TreeNode& operator=(const TreeNode& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TreeNode& operator=(TreeNode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TreeNode& default_instance() {
+    return *internal_default_instance();
+  }
+  enum TypeCase {
+    kFolder = 1,
+    kSprite = 2,
+    kSound = 3,
+    kBackground = 4,
+    kPath = 5,
+    kScript = 6,
+    kShader = 7,
+    kFont = 8,
+    kTimeline = 9,
+    kObject = 10,
+    kRoom = 11,
+    kInclude = 12,
+    TYPE_NOT_SET = 0,
+  };
+
+  static inline const TreeNode* internal_default_instance() {
+    return reinterpret_cast<const TreeNode*>(
+               &_TreeNode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TreeNode& a, TreeNode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TreeNode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TreeNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TreeNode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TreeNode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TreeNode& from) {
+    TreeNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TreeNode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "buffers.TreeNode";
+  }
+  protected:
+  explicit TreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChildFieldNumber = 17,
+    kNameFieldNumber = 16,
+    kFolderFieldNumber = 1,
+    kSpriteFieldNumber = 2,
+    kSoundFieldNumber = 3,
+    kBackgroundFieldNumber = 4,
+    kPathFieldNumber = 5,
+    kScriptFieldNumber = 6,
+    kShaderFieldNumber = 7,
+    kFontFieldNumber = 8,
+    kTimelineFieldNumber = 9,
+    kObjectFieldNumber = 10,
+    kRoomFieldNumber = 11,
+    kIncludeFieldNumber = 12,
+  };
+  // repeated .buffers.TreeNode child = 17;
+  int child_size() const;
+  private:
+  int _internal_child_size() const;
+  public:
+  void clear_child();
+  ::buffers::TreeNode* mutable_child(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::TreeNode >*
+      mutable_child();
+  private:
+  const ::buffers::TreeNode& _internal_child(int index) const;
+  ::buffers::TreeNode* _internal_add_child();
+  public:
+  const ::buffers::TreeNode& child(int index) const;
+  ::buffers::TreeNode* add_child();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::TreeNode >&
+      child() const;
+
+  // optional string name = 16;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // bool folder = 1;
+  bool has_folder() const;
+  private:
+  bool _internal_has_folder() const;
+  public:
+  void clear_folder();
+  bool folder() const;
+  void set_folder(bool value);
+  private:
+  bool _internal_folder() const;
+  void _internal_set_folder(bool value);
+  public:
+
+  // .buffers.resources.Sprite sprite = 2;
+  bool has_sprite() const;
+  private:
+  bool _internal_has_sprite() const;
+  public:
+  void clear_sprite();
+  const ::buffers::resources::Sprite& sprite() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Sprite* release_sprite();
+  ::buffers::resources::Sprite* mutable_sprite();
+  void set_allocated_sprite(::buffers::resources::Sprite* sprite);
+  private:
+  const ::buffers::resources::Sprite& _internal_sprite() const;
+  ::buffers::resources::Sprite* _internal_mutable_sprite();
+  public:
+  void unsafe_arena_set_allocated_sprite(
+      ::buffers::resources::Sprite* sprite);
+  ::buffers::resources::Sprite* unsafe_arena_release_sprite();
+
+  // .buffers.resources.Sound sound = 3;
+  bool has_sound() const;
+  private:
+  bool _internal_has_sound() const;
+  public:
+  void clear_sound();
+  const ::buffers::resources::Sound& sound() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Sound* release_sound();
+  ::buffers::resources::Sound* mutable_sound();
+  void set_allocated_sound(::buffers::resources::Sound* sound);
+  private:
+  const ::buffers::resources::Sound& _internal_sound() const;
+  ::buffers::resources::Sound* _internal_mutable_sound();
+  public:
+  void unsafe_arena_set_allocated_sound(
+      ::buffers::resources::Sound* sound);
+  ::buffers::resources::Sound* unsafe_arena_release_sound();
+
+  // .buffers.resources.Background background = 4;
+  bool has_background() const;
+  private:
+  bool _internal_has_background() const;
+  public:
+  void clear_background();
+  const ::buffers::resources::Background& background() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Background* release_background();
+  ::buffers::resources::Background* mutable_background();
+  void set_allocated_background(::buffers::resources::Background* background);
+  private:
+  const ::buffers::resources::Background& _internal_background() const;
+  ::buffers::resources::Background* _internal_mutable_background();
+  public:
+  void unsafe_arena_set_allocated_background(
+      ::buffers::resources::Background* background);
+  ::buffers::resources::Background* unsafe_arena_release_background();
+
+  // .buffers.resources.Path path = 5;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const ::buffers::resources::Path& path() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Path* release_path();
+  ::buffers::resources::Path* mutable_path();
+  void set_allocated_path(::buffers::resources::Path* path);
+  private:
+  const ::buffers::resources::Path& _internal_path() const;
+  ::buffers::resources::Path* _internal_mutable_path();
+  public:
+  void unsafe_arena_set_allocated_path(
+      ::buffers::resources::Path* path);
+  ::buffers::resources::Path* unsafe_arena_release_path();
+
+  // .buffers.resources.Script script = 6;
+  bool has_script() const;
+  private:
+  bool _internal_has_script() const;
+  public:
+  void clear_script();
+  const ::buffers::resources::Script& script() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Script* release_script();
+  ::buffers::resources::Script* mutable_script();
+  void set_allocated_script(::buffers::resources::Script* script);
+  private:
+  const ::buffers::resources::Script& _internal_script() const;
+  ::buffers::resources::Script* _internal_mutable_script();
+  public:
+  void unsafe_arena_set_allocated_script(
+      ::buffers::resources::Script* script);
+  ::buffers::resources::Script* unsafe_arena_release_script();
+
+  // .buffers.resources.Shader shader = 7;
+  bool has_shader() const;
+  private:
+  bool _internal_has_shader() const;
+  public:
+  void clear_shader();
+  const ::buffers::resources::Shader& shader() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Shader* release_shader();
+  ::buffers::resources::Shader* mutable_shader();
+  void set_allocated_shader(::buffers::resources::Shader* shader);
+  private:
+  const ::buffers::resources::Shader& _internal_shader() const;
+  ::buffers::resources::Shader* _internal_mutable_shader();
+  public:
+  void unsafe_arena_set_allocated_shader(
+      ::buffers::resources::Shader* shader);
+  ::buffers::resources::Shader* unsafe_arena_release_shader();
+
+  // .buffers.resources.Font font = 8;
+  bool has_font() const;
+  private:
+  bool _internal_has_font() const;
+  public:
+  void clear_font();
+  const ::buffers::resources::Font& font() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Font* release_font();
+  ::buffers::resources::Font* mutable_font();
+  void set_allocated_font(::buffers::resources::Font* font);
+  private:
+  const ::buffers::resources::Font& _internal_font() const;
+  ::buffers::resources::Font* _internal_mutable_font();
+  public:
+  void unsafe_arena_set_allocated_font(
+      ::buffers::resources::Font* font);
+  ::buffers::resources::Font* unsafe_arena_release_font();
+
+  // .buffers.resources.Timeline timeline = 9;
+  bool has_timeline() const;
+  private:
+  bool _internal_has_timeline() const;
+  public:
+  void clear_timeline();
+  const ::buffers::resources::Timeline& timeline() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Timeline* release_timeline();
+  ::buffers::resources::Timeline* mutable_timeline();
+  void set_allocated_timeline(::buffers::resources::Timeline* timeline);
+  private:
+  const ::buffers::resources::Timeline& _internal_timeline() const;
+  ::buffers::resources::Timeline* _internal_mutable_timeline();
+  public:
+  void unsafe_arena_set_allocated_timeline(
+      ::buffers::resources::Timeline* timeline);
+  ::buffers::resources::Timeline* unsafe_arena_release_timeline();
+
+  // .buffers.resources.Object object = 10;
+  bool has_object() const;
+  private:
+  bool _internal_has_object() const;
+  public:
+  void clear_object();
+  const ::buffers::resources::Object& object() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Object* release_object();
+  ::buffers::resources::Object* mutable_object();
+  void set_allocated_object(::buffers::resources::Object* object);
+  private:
+  const ::buffers::resources::Object& _internal_object() const;
+  ::buffers::resources::Object* _internal_mutable_object();
+  public:
+  void unsafe_arena_set_allocated_object(
+      ::buffers::resources::Object* object);
+  ::buffers::resources::Object* unsafe_arena_release_object();
+
+  // .buffers.resources.Room room = 11;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::buffers::resources::Room& room() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Room* release_room();
+  ::buffers::resources::Room* mutable_room();
+  void set_allocated_room(::buffers::resources::Room* room);
+  private:
+  const ::buffers::resources::Room& _internal_room() const;
+  ::buffers::resources::Room* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::buffers::resources::Room* room);
+  ::buffers::resources::Room* unsafe_arena_release_room();
+
+  // .buffers.resources.Include include = 12;
+  bool has_include() const;
+  private:
+  bool _internal_has_include() const;
+  public:
+  void clear_include();
+  const ::buffers::resources::Include& include() const;
+  PROTOBUF_NODISCARD ::buffers::resources::Include* release_include();
+  ::buffers::resources::Include* mutable_include();
+  void set_allocated_include(::buffers::resources::Include* include);
+  private:
+  const ::buffers::resources::Include& _internal_include() const;
+  ::buffers::resources::Include* _internal_mutable_include();
+  public:
+  void unsafe_arena_set_allocated_include(
+      ::buffers::resources::Include* include);
+  ::buffers::resources::Include* unsafe_arena_release_include();
+
+  void clear_type();
+  TypeCase type_case() const;
+  // @@protoc_insertion_point(class_scope:buffers.TreeNode)
+ private:
+  class _Internal;
+  void set_has_folder();
+  void set_has_sprite();
+  void set_has_sound();
+  void set_has_background();
+  void set_has_path();
+  void set_has_script();
+  void set_has_shader();
+  void set_has_font();
+  void set_has_timeline();
+  void set_has_object();
+  void set_has_room();
+  void set_has_include();
+
+  inline bool has_type() const;
+  inline void clear_has_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::TreeNode > child_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    union TypeUnion {
+      constexpr TypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      bool folder_;
+      ::buffers::resources::Sprite* sprite_;
+      ::buffers::resources::Sound* sound_;
+      ::buffers::resources::Background* background_;
+      ::buffers::resources::Path* path_;
+      ::buffers::resources::Script* script_;
+      ::buffers::resources::Shader* shader_;
+      ::buffers::resources::Font* font_;
+      ::buffers::resources::Timeline* timeline_;
+      ::buffers::resources::Object* object_;
+      ::buffers::resources::Room* room_;
+      ::buffers::resources::Include* include_;
+    } type_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_treenode_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TreeNode
+
+// bool folder = 1;
+inline bool TreeNode::_internal_has_folder() const {
+  return type_case() == kFolder;
+}
+inline bool TreeNode::has_folder() const {
+  return _internal_has_folder();
+}
+inline void TreeNode::set_has_folder() {
+  _impl_._oneof_case_[0] = kFolder;
+}
+inline void TreeNode::clear_folder() {
+  if (_internal_has_folder()) {
+    _impl_.type_.folder_ = false;
+    clear_has_type();
+  }
+}
+inline bool TreeNode::_internal_folder() const {
+  if (_internal_has_folder()) {
+    return _impl_.type_.folder_;
+  }
+  return false;
+}
+inline void TreeNode::_internal_set_folder(bool value) {
+  if (!_internal_has_folder()) {
+    clear_type();
+    set_has_folder();
+  }
+  _impl_.type_.folder_ = value;
+}
+inline bool TreeNode::folder() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.folder)
+  return _internal_folder();
+}
+inline void TreeNode::set_folder(bool value) {
+  _internal_set_folder(value);
+  // @@protoc_insertion_point(field_set:buffers.TreeNode.folder)
+}
+
+// .buffers.resources.Sprite sprite = 2;
+inline bool TreeNode::_internal_has_sprite() const {
+  return type_case() == kSprite;
+}
+inline bool TreeNode::has_sprite() const {
+  return _internal_has_sprite();
+}
+inline void TreeNode::set_has_sprite() {
+  _impl_._oneof_case_[0] = kSprite;
+}
+inline ::buffers::resources::Sprite* TreeNode::release_sprite() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.sprite)
+  if (_internal_has_sprite()) {
+    clear_has_type();
+    ::buffers::resources::Sprite* temp = _impl_.type_.sprite_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.sprite_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Sprite& TreeNode::_internal_sprite() const {
+  return _internal_has_sprite()
+      ? *_impl_.type_.sprite_
+      : reinterpret_cast< ::buffers::resources::Sprite&>(::buffers::resources::_Sprite_default_instance_);
+}
+inline const ::buffers::resources::Sprite& TreeNode::sprite() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.sprite)
+  return _internal_sprite();
+}
+inline ::buffers::resources::Sprite* TreeNode::unsafe_arena_release_sprite() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.sprite)
+  if (_internal_has_sprite()) {
+    clear_has_type();
+    ::buffers::resources::Sprite* temp = _impl_.type_.sprite_;
+    _impl_.type_.sprite_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_sprite(::buffers::resources::Sprite* sprite) {
+  clear_type();
+  if (sprite) {
+    set_has_sprite();
+    _impl_.type_.sprite_ = sprite;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.sprite)
+}
+inline ::buffers::resources::Sprite* TreeNode::_internal_mutable_sprite() {
+  if (!_internal_has_sprite()) {
+    clear_type();
+    set_has_sprite();
+    _impl_.type_.sprite_ = CreateMaybeMessage< ::buffers::resources::Sprite >(GetArenaForAllocation());
+  }
+  return _impl_.type_.sprite_;
+}
+inline ::buffers::resources::Sprite* TreeNode::mutable_sprite() {
+  ::buffers::resources::Sprite* _msg = _internal_mutable_sprite();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.sprite)
+  return _msg;
+}
+
+// .buffers.resources.Sound sound = 3;
+inline bool TreeNode::_internal_has_sound() const {
+  return type_case() == kSound;
+}
+inline bool TreeNode::has_sound() const {
+  return _internal_has_sound();
+}
+inline void TreeNode::set_has_sound() {
+  _impl_._oneof_case_[0] = kSound;
+}
+inline ::buffers::resources::Sound* TreeNode::release_sound() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.sound)
+  if (_internal_has_sound()) {
+    clear_has_type();
+    ::buffers::resources::Sound* temp = _impl_.type_.sound_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.sound_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Sound& TreeNode::_internal_sound() const {
+  return _internal_has_sound()
+      ? *_impl_.type_.sound_
+      : reinterpret_cast< ::buffers::resources::Sound&>(::buffers::resources::_Sound_default_instance_);
+}
+inline const ::buffers::resources::Sound& TreeNode::sound() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.sound)
+  return _internal_sound();
+}
+inline ::buffers::resources::Sound* TreeNode::unsafe_arena_release_sound() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.sound)
+  if (_internal_has_sound()) {
+    clear_has_type();
+    ::buffers::resources::Sound* temp = _impl_.type_.sound_;
+    _impl_.type_.sound_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_sound(::buffers::resources::Sound* sound) {
+  clear_type();
+  if (sound) {
+    set_has_sound();
+    _impl_.type_.sound_ = sound;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.sound)
+}
+inline ::buffers::resources::Sound* TreeNode::_internal_mutable_sound() {
+  if (!_internal_has_sound()) {
+    clear_type();
+    set_has_sound();
+    _impl_.type_.sound_ = CreateMaybeMessage< ::buffers::resources::Sound >(GetArenaForAllocation());
+  }
+  return _impl_.type_.sound_;
+}
+inline ::buffers::resources::Sound* TreeNode::mutable_sound() {
+  ::buffers::resources::Sound* _msg = _internal_mutable_sound();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.sound)
+  return _msg;
+}
+
+// .buffers.resources.Background background = 4;
+inline bool TreeNode::_internal_has_background() const {
+  return type_case() == kBackground;
+}
+inline bool TreeNode::has_background() const {
+  return _internal_has_background();
+}
+inline void TreeNode::set_has_background() {
+  _impl_._oneof_case_[0] = kBackground;
+}
+inline ::buffers::resources::Background* TreeNode::release_background() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.background)
+  if (_internal_has_background()) {
+    clear_has_type();
+    ::buffers::resources::Background* temp = _impl_.type_.background_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.background_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Background& TreeNode::_internal_background() const {
+  return _internal_has_background()
+      ? *_impl_.type_.background_
+      : reinterpret_cast< ::buffers::resources::Background&>(::buffers::resources::_Background_default_instance_);
+}
+inline const ::buffers::resources::Background& TreeNode::background() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.background)
+  return _internal_background();
+}
+inline ::buffers::resources::Background* TreeNode::unsafe_arena_release_background() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.background)
+  if (_internal_has_background()) {
+    clear_has_type();
+    ::buffers::resources::Background* temp = _impl_.type_.background_;
+    _impl_.type_.background_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_background(::buffers::resources::Background* background) {
+  clear_type();
+  if (background) {
+    set_has_background();
+    _impl_.type_.background_ = background;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.background)
+}
+inline ::buffers::resources::Background* TreeNode::_internal_mutable_background() {
+  if (!_internal_has_background()) {
+    clear_type();
+    set_has_background();
+    _impl_.type_.background_ = CreateMaybeMessage< ::buffers::resources::Background >(GetArenaForAllocation());
+  }
+  return _impl_.type_.background_;
+}
+inline ::buffers::resources::Background* TreeNode::mutable_background() {
+  ::buffers::resources::Background* _msg = _internal_mutable_background();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.background)
+  return _msg;
+}
+
+// .buffers.resources.Path path = 5;
+inline bool TreeNode::_internal_has_path() const {
+  return type_case() == kPath;
+}
+inline bool TreeNode::has_path() const {
+  return _internal_has_path();
+}
+inline void TreeNode::set_has_path() {
+  _impl_._oneof_case_[0] = kPath;
+}
+inline ::buffers::resources::Path* TreeNode::release_path() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.path)
+  if (_internal_has_path()) {
+    clear_has_type();
+    ::buffers::resources::Path* temp = _impl_.type_.path_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.path_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Path& TreeNode::_internal_path() const {
+  return _internal_has_path()
+      ? *_impl_.type_.path_
+      : reinterpret_cast< ::buffers::resources::Path&>(::buffers::resources::_Path_default_instance_);
+}
+inline const ::buffers::resources::Path& TreeNode::path() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.path)
+  return _internal_path();
+}
+inline ::buffers::resources::Path* TreeNode::unsafe_arena_release_path() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.path)
+  if (_internal_has_path()) {
+    clear_has_type();
+    ::buffers::resources::Path* temp = _impl_.type_.path_;
+    _impl_.type_.path_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_path(::buffers::resources::Path* path) {
+  clear_type();
+  if (path) {
+    set_has_path();
+    _impl_.type_.path_ = path;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.path)
+}
+inline ::buffers::resources::Path* TreeNode::_internal_mutable_path() {
+  if (!_internal_has_path()) {
+    clear_type();
+    set_has_path();
+    _impl_.type_.path_ = CreateMaybeMessage< ::buffers::resources::Path >(GetArenaForAllocation());
+  }
+  return _impl_.type_.path_;
+}
+inline ::buffers::resources::Path* TreeNode::mutable_path() {
+  ::buffers::resources::Path* _msg = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.path)
+  return _msg;
+}
+
+// .buffers.resources.Script script = 6;
+inline bool TreeNode::_internal_has_script() const {
+  return type_case() == kScript;
+}
+inline bool TreeNode::has_script() const {
+  return _internal_has_script();
+}
+inline void TreeNode::set_has_script() {
+  _impl_._oneof_case_[0] = kScript;
+}
+inline ::buffers::resources::Script* TreeNode::release_script() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.script)
+  if (_internal_has_script()) {
+    clear_has_type();
+    ::buffers::resources::Script* temp = _impl_.type_.script_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.script_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Script& TreeNode::_internal_script() const {
+  return _internal_has_script()
+      ? *_impl_.type_.script_
+      : reinterpret_cast< ::buffers::resources::Script&>(::buffers::resources::_Script_default_instance_);
+}
+inline const ::buffers::resources::Script& TreeNode::script() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.script)
+  return _internal_script();
+}
+inline ::buffers::resources::Script* TreeNode::unsafe_arena_release_script() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.script)
+  if (_internal_has_script()) {
+    clear_has_type();
+    ::buffers::resources::Script* temp = _impl_.type_.script_;
+    _impl_.type_.script_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_script(::buffers::resources::Script* script) {
+  clear_type();
+  if (script) {
+    set_has_script();
+    _impl_.type_.script_ = script;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.script)
+}
+inline ::buffers::resources::Script* TreeNode::_internal_mutable_script() {
+  if (!_internal_has_script()) {
+    clear_type();
+    set_has_script();
+    _impl_.type_.script_ = CreateMaybeMessage< ::buffers::resources::Script >(GetArenaForAllocation());
+  }
+  return _impl_.type_.script_;
+}
+inline ::buffers::resources::Script* TreeNode::mutable_script() {
+  ::buffers::resources::Script* _msg = _internal_mutable_script();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.script)
+  return _msg;
+}
+
+// .buffers.resources.Shader shader = 7;
+inline bool TreeNode::_internal_has_shader() const {
+  return type_case() == kShader;
+}
+inline bool TreeNode::has_shader() const {
+  return _internal_has_shader();
+}
+inline void TreeNode::set_has_shader() {
+  _impl_._oneof_case_[0] = kShader;
+}
+inline ::buffers::resources::Shader* TreeNode::release_shader() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.shader)
+  if (_internal_has_shader()) {
+    clear_has_type();
+    ::buffers::resources::Shader* temp = _impl_.type_.shader_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.shader_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Shader& TreeNode::_internal_shader() const {
+  return _internal_has_shader()
+      ? *_impl_.type_.shader_
+      : reinterpret_cast< ::buffers::resources::Shader&>(::buffers::resources::_Shader_default_instance_);
+}
+inline const ::buffers::resources::Shader& TreeNode::shader() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.shader)
+  return _internal_shader();
+}
+inline ::buffers::resources::Shader* TreeNode::unsafe_arena_release_shader() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.shader)
+  if (_internal_has_shader()) {
+    clear_has_type();
+    ::buffers::resources::Shader* temp = _impl_.type_.shader_;
+    _impl_.type_.shader_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_shader(::buffers::resources::Shader* shader) {
+  clear_type();
+  if (shader) {
+    set_has_shader();
+    _impl_.type_.shader_ = shader;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.shader)
+}
+inline ::buffers::resources::Shader* TreeNode::_internal_mutable_shader() {
+  if (!_internal_has_shader()) {
+    clear_type();
+    set_has_shader();
+    _impl_.type_.shader_ = CreateMaybeMessage< ::buffers::resources::Shader >(GetArenaForAllocation());
+  }
+  return _impl_.type_.shader_;
+}
+inline ::buffers::resources::Shader* TreeNode::mutable_shader() {
+  ::buffers::resources::Shader* _msg = _internal_mutable_shader();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.shader)
+  return _msg;
+}
+
+// .buffers.resources.Font font = 8;
+inline bool TreeNode::_internal_has_font() const {
+  return type_case() == kFont;
+}
+inline bool TreeNode::has_font() const {
+  return _internal_has_font();
+}
+inline void TreeNode::set_has_font() {
+  _impl_._oneof_case_[0] = kFont;
+}
+inline ::buffers::resources::Font* TreeNode::release_font() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.font)
+  if (_internal_has_font()) {
+    clear_has_type();
+    ::buffers::resources::Font* temp = _impl_.type_.font_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.font_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Font& TreeNode::_internal_font() const {
+  return _internal_has_font()
+      ? *_impl_.type_.font_
+      : reinterpret_cast< ::buffers::resources::Font&>(::buffers::resources::_Font_default_instance_);
+}
+inline const ::buffers::resources::Font& TreeNode::font() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.font)
+  return _internal_font();
+}
+inline ::buffers::resources::Font* TreeNode::unsafe_arena_release_font() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.font)
+  if (_internal_has_font()) {
+    clear_has_type();
+    ::buffers::resources::Font* temp = _impl_.type_.font_;
+    _impl_.type_.font_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_font(::buffers::resources::Font* font) {
+  clear_type();
+  if (font) {
+    set_has_font();
+    _impl_.type_.font_ = font;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.font)
+}
+inline ::buffers::resources::Font* TreeNode::_internal_mutable_font() {
+  if (!_internal_has_font()) {
+    clear_type();
+    set_has_font();
+    _impl_.type_.font_ = CreateMaybeMessage< ::buffers::resources::Font >(GetArenaForAllocation());
+  }
+  return _impl_.type_.font_;
+}
+inline ::buffers::resources::Font* TreeNode::mutable_font() {
+  ::buffers::resources::Font* _msg = _internal_mutable_font();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.font)
+  return _msg;
+}
+
+// .buffers.resources.Timeline timeline = 9;
+inline bool TreeNode::_internal_has_timeline() const {
+  return type_case() == kTimeline;
+}
+inline bool TreeNode::has_timeline() const {
+  return _internal_has_timeline();
+}
+inline void TreeNode::set_has_timeline() {
+  _impl_._oneof_case_[0] = kTimeline;
+}
+inline ::buffers::resources::Timeline* TreeNode::release_timeline() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.timeline)
+  if (_internal_has_timeline()) {
+    clear_has_type();
+    ::buffers::resources::Timeline* temp = _impl_.type_.timeline_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.timeline_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Timeline& TreeNode::_internal_timeline() const {
+  return _internal_has_timeline()
+      ? *_impl_.type_.timeline_
+      : reinterpret_cast< ::buffers::resources::Timeline&>(::buffers::resources::_Timeline_default_instance_);
+}
+inline const ::buffers::resources::Timeline& TreeNode::timeline() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.timeline)
+  return _internal_timeline();
+}
+inline ::buffers::resources::Timeline* TreeNode::unsafe_arena_release_timeline() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.timeline)
+  if (_internal_has_timeline()) {
+    clear_has_type();
+    ::buffers::resources::Timeline* temp = _impl_.type_.timeline_;
+    _impl_.type_.timeline_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_timeline(::buffers::resources::Timeline* timeline) {
+  clear_type();
+  if (timeline) {
+    set_has_timeline();
+    _impl_.type_.timeline_ = timeline;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.timeline)
+}
+inline ::buffers::resources::Timeline* TreeNode::_internal_mutable_timeline() {
+  if (!_internal_has_timeline()) {
+    clear_type();
+    set_has_timeline();
+    _impl_.type_.timeline_ = CreateMaybeMessage< ::buffers::resources::Timeline >(GetArenaForAllocation());
+  }
+  return _impl_.type_.timeline_;
+}
+inline ::buffers::resources::Timeline* TreeNode::mutable_timeline() {
+  ::buffers::resources::Timeline* _msg = _internal_mutable_timeline();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.timeline)
+  return _msg;
+}
+
+// .buffers.resources.Object object = 10;
+inline bool TreeNode::_internal_has_object() const {
+  return type_case() == kObject;
+}
+inline bool TreeNode::has_object() const {
+  return _internal_has_object();
+}
+inline void TreeNode::set_has_object() {
+  _impl_._oneof_case_[0] = kObject;
+}
+inline ::buffers::resources::Object* TreeNode::release_object() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.object)
+  if (_internal_has_object()) {
+    clear_has_type();
+    ::buffers::resources::Object* temp = _impl_.type_.object_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.object_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Object& TreeNode::_internal_object() const {
+  return _internal_has_object()
+      ? *_impl_.type_.object_
+      : reinterpret_cast< ::buffers::resources::Object&>(::buffers::resources::_Object_default_instance_);
+}
+inline const ::buffers::resources::Object& TreeNode::object() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.object)
+  return _internal_object();
+}
+inline ::buffers::resources::Object* TreeNode::unsafe_arena_release_object() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.object)
+  if (_internal_has_object()) {
+    clear_has_type();
+    ::buffers::resources::Object* temp = _impl_.type_.object_;
+    _impl_.type_.object_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_object(::buffers::resources::Object* object) {
+  clear_type();
+  if (object) {
+    set_has_object();
+    _impl_.type_.object_ = object;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.object)
+}
+inline ::buffers::resources::Object* TreeNode::_internal_mutable_object() {
+  if (!_internal_has_object()) {
+    clear_type();
+    set_has_object();
+    _impl_.type_.object_ = CreateMaybeMessage< ::buffers::resources::Object >(GetArenaForAllocation());
+  }
+  return _impl_.type_.object_;
+}
+inline ::buffers::resources::Object* TreeNode::mutable_object() {
+  ::buffers::resources::Object* _msg = _internal_mutable_object();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.object)
+  return _msg;
+}
+
+// .buffers.resources.Room room = 11;
+inline bool TreeNode::_internal_has_room() const {
+  return type_case() == kRoom;
+}
+inline bool TreeNode::has_room() const {
+  return _internal_has_room();
+}
+inline void TreeNode::set_has_room() {
+  _impl_._oneof_case_[0] = kRoom;
+}
+inline ::buffers::resources::Room* TreeNode::release_room() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.room)
+  if (_internal_has_room()) {
+    clear_has_type();
+    ::buffers::resources::Room* temp = _impl_.type_.room_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Room& TreeNode::_internal_room() const {
+  return _internal_has_room()
+      ? *_impl_.type_.room_
+      : reinterpret_cast< ::buffers::resources::Room&>(::buffers::resources::_Room_default_instance_);
+}
+inline const ::buffers::resources::Room& TreeNode::room() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.room)
+  return _internal_room();
+}
+inline ::buffers::resources::Room* TreeNode::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.room)
+  if (_internal_has_room()) {
+    clear_has_type();
+    ::buffers::resources::Room* temp = _impl_.type_.room_;
+    _impl_.type_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_room(::buffers::resources::Room* room) {
+  clear_type();
+  if (room) {
+    set_has_room();
+    _impl_.type_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.room)
+}
+inline ::buffers::resources::Room* TreeNode::_internal_mutable_room() {
+  if (!_internal_has_room()) {
+    clear_type();
+    set_has_room();
+    _impl_.type_.room_ = CreateMaybeMessage< ::buffers::resources::Room >(GetArenaForAllocation());
+  }
+  return _impl_.type_.room_;
+}
+inline ::buffers::resources::Room* TreeNode::mutable_room() {
+  ::buffers::resources::Room* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.room)
+  return _msg;
+}
+
+// .buffers.resources.Include include = 12;
+inline bool TreeNode::_internal_has_include() const {
+  return type_case() == kInclude;
+}
+inline bool TreeNode::has_include() const {
+  return _internal_has_include();
+}
+inline void TreeNode::set_has_include() {
+  _impl_._oneof_case_[0] = kInclude;
+}
+inline ::buffers::resources::Include* TreeNode::release_include() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.include)
+  if (_internal_has_include()) {
+    clear_has_type();
+    ::buffers::resources::Include* temp = _impl_.type_.include_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.include_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::buffers::resources::Include& TreeNode::_internal_include() const {
+  return _internal_has_include()
+      ? *_impl_.type_.include_
+      : reinterpret_cast< ::buffers::resources::Include&>(::buffers::resources::_Include_default_instance_);
+}
+inline const ::buffers::resources::Include& TreeNode::include() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.include)
+  return _internal_include();
+}
+inline ::buffers::resources::Include* TreeNode::unsafe_arena_release_include() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:buffers.TreeNode.include)
+  if (_internal_has_include()) {
+    clear_has_type();
+    ::buffers::resources::Include* temp = _impl_.type_.include_;
+    _impl_.type_.include_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_include(::buffers::resources::Include* include) {
+  clear_type();
+  if (include) {
+    set_has_include();
+    _impl_.type_.include_ = include;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:buffers.TreeNode.include)
+}
+inline ::buffers::resources::Include* TreeNode::_internal_mutable_include() {
+  if (!_internal_has_include()) {
+    clear_type();
+    set_has_include();
+    _impl_.type_.include_ = CreateMaybeMessage< ::buffers::resources::Include >(GetArenaForAllocation());
+  }
+  return _impl_.type_.include_;
+}
+inline ::buffers::resources::Include* TreeNode::mutable_include() {
+  ::buffers::resources::Include* _msg = _internal_mutable_include();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.include)
+  return _msg;
+}
+
+// optional string name = 16;
+inline bool TreeNode::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TreeNode::has_name() const {
+  return _internal_has_name();
+}
+inline void TreeNode::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TreeNode::name() const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeNode::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:buffers.TreeNode.name)
+}
+inline std::string* TreeNode::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.name)
+  return _s;
+}
+inline const std::string& TreeNode::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TreeNode::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeNode::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeNode::release_name() {
+  // @@protoc_insertion_point(field_release:buffers.TreeNode.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TreeNode::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:buffers.TreeNode.name)
+}
+
+// repeated .buffers.TreeNode child = 17;
+inline int TreeNode::_internal_child_size() const {
+  return _impl_.child_.size();
+}
+inline int TreeNode::child_size() const {
+  return _internal_child_size();
+}
+inline void TreeNode::clear_child() {
+  _impl_.child_.Clear();
+}
+inline ::buffers::TreeNode* TreeNode::mutable_child(int index) {
+  // @@protoc_insertion_point(field_mutable:buffers.TreeNode.child)
+  return _impl_.child_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::TreeNode >*
+TreeNode::mutable_child() {
+  // @@protoc_insertion_point(field_mutable_list:buffers.TreeNode.child)
+  return &_impl_.child_;
+}
+inline const ::buffers::TreeNode& TreeNode::_internal_child(int index) const {
+  return _impl_.child_.Get(index);
+}
+inline const ::buffers::TreeNode& TreeNode::child(int index) const {
+  // @@protoc_insertion_point(field_get:buffers.TreeNode.child)
+  return _internal_child(index);
+}
+inline ::buffers::TreeNode* TreeNode::_internal_add_child() {
+  return _impl_.child_.Add();
+}
+inline ::buffers::TreeNode* TreeNode::add_child() {
+  ::buffers::TreeNode* _add = _internal_add_child();
+  // @@protoc_insertion_point(field_add:buffers.TreeNode.child)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::buffers::TreeNode >&
+TreeNode::child() const {
+  // @@protoc_insertion_point(field_list:buffers.TreeNode.child)
+  return _impl_.child_;
+}
+
+inline bool TreeNode::has_type() const {
+  return type_case() != TYPE_NOT_SET;
+}
+inline void TreeNode::clear_has_type() {
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+inline TreeNode::TypeCase TreeNode::type_case() const {
+  return TreeNode::TypeCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace buffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_treenode_2eproto
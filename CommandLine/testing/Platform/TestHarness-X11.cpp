@@ -9,6 +9,7 @@
 #include <string>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <vector>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 
@@ -16,6 +17,7 @@ namespace {
 using std::string;
 using std::to_string;
 using std::unique_ptr;
+using std::vector;
 using std::getenv;
 
 void gather_coverage(const TestConfig&);
@@ -176,7 +178,7 @@ int build_game(const string &game, const TestConfig &tc, const string &out) {
   string extensions = "--extensions="
       + tc.get_or(&TC::extensions, kDefaultExtensions);
 
-  const char *const args[] = {
+  vector<const char*> args = {
     emake_cmd.c_str(),
     compiler.c_str(),
     mode.c_str(),
@@ -186,13 +188,11 @@ int build_game(const string &game, const TestConfig &tc, const string &out) {
     network.c_str(),
     collision.c_str(),
     extensions.c_str(),
-    game.c_str(),
-    "-o",
-    out.c_str(),
-    nullptr
   };
+  for (const string &flag : tc.emake_flags) args.push_back(flag.c_str());
+  args.insert(args.end(), { game.c_str(), "-o", out.c_str(), nullptr });
 
-  execvp(emake_cmd.c_str(), (char**) args);
+  execvp(emake_cmd.c_str(), (char**) args.data());
   abort();
 }
 
@@ -254,6 +254,11 @@ bool TestHarness::windowing_supported() {
   return true;
 }
 
+int TestHarness::build(const string &game, const TestConfig &tc,
+                       const string &out) {
+  return build_game(game, tc, out);
+}
+
 unique_ptr<TestHarness>
 TestHarness::launch_and_attach(const string &game, const TestConfig &tc) {
   string out = "/tmp/test-game";
@@ -1,7 +1,9 @@
 #include <boost/filesystem.hpp>
 #include <boost/foreach.hpp>
 #include <gtest/gtest.h>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <string>
 #include <vector>
@@ -131,5 +133,40 @@ TEST_P(SimpleTestHarness, SimpleTestRunner) {
 INSTANTIATE_TEST_CASE_P(SimpleTests, SimpleTestHarness,
                         testing::ValuesIn(enumerate_simple_games()));
 
+string read_file(const string &filename) {
+  std::ifstream f(filename, std::ios::binary);
+  return string(std::istreambuf_iterator<char>(f),
+                std::istreambuf_iterator<char>());
+}
+
+// Images taken from emake's resource cache must build the same game, byte for
+// byte, as converting them afresh.
+TEST(ResourceCache, HitReproducesMiss) {
+  const string game = string(kSimpleTestDirectory) + "/basicGMX.gmx";
+  const boost::filesystem::path cache =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("resource-cache-%%%%%%%%");
+  const string outs[] = {
+    "/tmp/test-game-uncached", "/tmp/test-game-miss", "/tmp/test-game-hit"
+  };
+
+  TestConfig tc;
+  tc.emake_flags = { "--no-resource-cache" };
+  ASSERT_EQ(TestHarness::build(game, tc, outs[0]), 0);
+  EXPECT_FALSE(boost::filesystem::exists(cache));
+
+  tc.emake_flags = { "--resource-cache=" + cache.string() };
+  ASSERT_EQ(TestHarness::build(game, tc, outs[1]), 0);
+  ASSERT_TRUE(boost::filesystem::exists(cache)) << "Nothing was cached";
+  ASSERT_EQ(TestHarness::build(game, tc, outs[2]), 0);
+
+  const string uncached = read_file(outs[0]);
+  EXPECT_FALSE(uncached.empty());
+  EXPECT_TRUE(read_file(outs[1]) == uncached) << "A cache miss changed the game";
+  EXPECT_TRUE(read_file(outs[2]) == uncached) << "A cache hit changed the game";
+
+  boost::filesystem::remove_all(cache);
+}
+
 
 }  // namespace
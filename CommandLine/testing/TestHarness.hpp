@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 const std::string kGamesDir = "CommandLine/testing/Tests/";
 
@@ -15,6 +16,7 @@ struct TestConfig {
   std::string network;
   std::string collision;
   std::string extensions;
+  std::vector<std::string> emake_flags;  ///< Passed to emake after the rest
 
   std::string get_or(std::string(TestConfig::*option), std::string alt) const {
     std::string mine = this->*option;
@@ -59,6 +61,11 @@ class TestHarness {
   static std::unique_ptr<TestHarness>
       launch_and_attach(const std::string &game, const TestConfig &tc);
 
+  /// Build a game's executable file without running it.
+  /// Return emake's exit code, or -1 if it could not be run.
+  static int build(const std::string &game, const TestConfig &tc,
+                   const std::string &out);
+
   /// Launch a game's executable file and let it run to completion.
   /// Return its exit code.
   static int run_to_completion(const std::string &game, const TestConfig &tc);
@@ -0,0 +1,77 @@
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include "TestHarness.hpp"
+
+namespace fs = boost::filesystem;
+using std::string;
+
+namespace {
+
+// Where make puts the objects of the game's own units in the harness's default mode.
+const string kUnitObjects = "/tmp/ENIGMA/.eobjs/Linux/Linux/TestHarness/Debug/"
+                            "Preprocessor_Environment_Editable/";
+
+void copy_tree(const fs::path &from, const fs::path &to) {
+  fs::create_directories(to);
+  for (fs::directory_iterator it(from), end; it != end; ++it) {
+    if (fs::is_directory(it->path())) {
+      copy_tree(it->path(), to / it->path().filename());
+    } else {
+      fs::copy_file(it->path(), to / it->path().filename());
+    }
+  }
+}
+
+void replace_in_file(const fs::path &file, const string &from, const string &to) {
+  std::ifstream in(file.string());
+  string text {
+    std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()
+  };
+  in.close();
+  const size_t at = text.find(from);
+  ASSERT_NE(at, string::npos) << from << " not found in " << file;
+  text.replace(at, from.length(), to);
+  std::ofstream(file.string()) << text;
+}
+
+}  // namespace
+
+// Each object is compiled on its own, so editing one object rebuilds only its
+// unit. Capitals in names are escaped, so names differing only in case can't
+// share a file where the filesystem ignores case.
+TEST(Game, incremental_build_test) {
+  const fs::path game = fs::temp_directory_path() / "incremental_build_test.gmx";
+  fs::remove_all(game);
+  copy_tree(kGamesDir + "incremental_build_test.gmx", game);
+
+  const string out = "/tmp/test-game";
+  ASSERT_EQ(TestHarness::build(game.string(), TestConfig(), out), 0);
+
+  const string units[] = {
+    kUnitObjects + "IDE_EDIT_object_obj_a.o",
+    kUnitObjects + "IDE_EDIT_object_obj_-big.o",
+    kUnitObjects + "IDE_EDIT_object_obj_b.o",
+  };
+  std::time_t built[3];
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(fs::exists(units[i])) << units[i] << " was not built";
+    built[i] = fs::last_write_time(units[i]);
+  }
+
+  // Object files only record whole seconds.
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  replace_in_file(game / "objects" / "obj_b.object.gmx", "x = 3;", "x = 4;");
+  ASSERT_EQ(TestHarness::build(game.string(), TestConfig(), out), 0);
+
+  EXPECT_EQ(fs::last_write_time(units[0]), built[0]) << "obj_a was rebuilt";
+  EXPECT_EQ(fs::last_write_time(units[1]), built[1]) << "obj_Big was rebuilt";
+  EXPECT_GT(fs::last_write_time(units[2]), built[2]) << "obj_b was not rebuilt";
+
+  fs::remove_all(game);
+}
@@ -0,0 +1,35 @@
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+
+#include "TestHarness.hpp"
+
+namespace fs = boost::filesystem;
+using std::string;
+
+// The game's step event runs on the thread pool and still steps every instance
+// once, with deferred creates and destroys. Once the event writes a global, the
+// compiler refuses to run it in parallel.
+TEST(Game, parallel_step_test) {
+  const string game = kGamesDir + "parallel_step_test.sog";
+  TestConfig tc;
+  tc.extensions = "GTest";
+  tc.emake_flags = { "--parallel-step=object0" };
+  ASSERT_EQ(TestHarness::run_to_completion(game, tc), 0);
+
+  const fs::path shared = fs::temp_directory_path() / "parallel_step_shared.sog";
+  fs::remove_all(shared);
+  fs::create_directories(shared);
+  for (const char *event : { "create.edl", "step.edl", "endstep.edl" })
+    fs::copy_file(fs::path(game) / event, shared / event);
+  std::ofstream(fs::path(shared / "step.edl").string(), std::ios::app)
+      << "global.steps_run += 1;\n";
+  EXPECT_NE(TestHarness::build(shared.string(), tc, "/tmp/test-game"), 0)
+      << "A parallel step event that writes a global was accepted";
+
+  tc.emake_flags.clear();
+  EXPECT_EQ(TestHarness::build(shared.string(), tc, "/tmp/test-game"), 0)
+      << "The same game failed to build without --parallel-step";
+  fs::remove_all(shared);
+}
@@ -151,6 +151,7 @@ void context::swap(context &ct) {
       ct.global = global; global = gs; }
     macros.swap(ct.macros);
     variadics.swap(ct.variadics);
+    included_files.swap(ct.included_files);
   }
   else cerr << "ERROR! Cannot swap context while parse is active" << endl;
 }
@@ -91,6 +91,9 @@ namespace jdi
   public:
     set<definition*> variadics; ///< Set of variadic types.
     
+    /// The files #included by the last call to parse_C_stream, for callers which cache its results.
+    set<string> included_files;
+    
     /// This is a map of structures which conflict with other declarations, which is allowed by the rules of C.
     map<string, definition*> c_structs;
     /** Function to insert into c_structs by the rules of definition_scope::declare.
@@ -177,6 +180,18 @@ namespace jdi
     **/
     int parse_C_stream(llreader& cfile, const char* fname = NULL, error_handler *errhandl = NULL);
     
+    /** Parse an input stream as above, also saving a snapshot of the parse.
+        Parsing the snapshot with \c parse_snapshot() later defines the same things without reading any files.
+        @param snapshot  Receives the snapshot, or is emptied if the parse could not be saved. [out]
+    **/
+    int parse_C_stream(llreader& cfile, const char* fname, error_handler *errhandl, string &snapshot);
+    
+    /** Parse a snapshot saved by \c parse_C_stream(), restoring the macros and included files it recorded.
+        The context should hold only built-ins, as it did when the snapshot was taken.
+        @return Returns -1 if the snapshot can't be read, leaving the context as it was, or else the result of the parse.
+    **/
+    int parse_snapshot(const string &snapshot, error_handler *errhandl = NULL);
+    
     /** Parse an input stream for definitions using the default C++ lexer.
         @param lang_lexer The lexer which will be polled for tokens. This lexer will already know its token source.
                           If this parameter is NULL, the previous lexer will be used. Or else a huge error will be thrown.
@@ -26,6 +26,8 @@
 #include <fstream>
 #include <API/context.h>
 #include <System/lex_cpp.h>
+#include <System/lex_snapshot.h>
+#include <System/macros.h>
 #include <System/token.h>
 #include <General/debug_macros.h>
 #include "parse_context.h"
@@ -38,7 +40,48 @@ using namespace jdip;
   new instance of the C++ lexer that ships with JDI, \c lex_cpp.
 **/
 int jdi::context::parse_C_stream(llreader &cfile, const char* fname, error_handler *errhandl) {
-  return parse_stream(fname? new lexer_cpp(cfile, macros, fname) : new lexer_cpp(cfile, macros), errhandl); // Invoke our common method with it
+  lexer_cpp *lcpp = fname? new lexer_cpp(cfile, macros, fname) : new lexer_cpp(cfile, macros);
+  int res = parse_stream(lcpp, errhandl); // Invoke our common method with it
+  if (lex == lcpp) // Otherwise the parse was refused and the lexer freed
+    included_files = lcpp->visited_files;
+  return res;
+}
+
+/** @section Implementation
+  The same as above, with the C++ lexer wrapped in one that keeps each token it
+  hands the parser. What the parse defined depends only on those tokens, so the
+  snapshot is them plus the macros and files the parse left behind.
+**/
+int jdi::context::parse_C_stream(llreader &cfile, const char* fname, error_handler *errhandl, string &snapshot) {
+  snapshot.clear();
+  lexer_recorder *rec = new lexer_recorder(fname? new lexer_cpp(cfile, macros, fname) : new lexer_cpp(cfile, macros));
+  int res = parse_stream(rec, errhandl);
+  if (lex == rec) {
+    included_files = rec->lcpp->visited_files;
+    rec->finish(included_files, macros, snapshot);
+  }
+  return res;
+}
+
+int jdi::context::parse_snapshot(const string &snapshot, error_handler *errhandl) {
+  if (parse_open) return -1;
+  lexer_replay *rep = new lexer_replay();
+  set<string> files;
+  vector<macro_type*> read_macros;
+  if (!rep->load(snapshot, files, read_macros)) {
+    delete rep;
+    return -1;
+  }
+  for (size_t i = 0; i < read_macros.size(); ++i) {
+    macro_iter it = macros.find(read_macros[i]->name);
+    if (it != macros.end()) {
+      macro_type::free(it->second);
+      it->second = read_macros[i];
+    }
+    else macros[read_macros[i]->name] = read_macros[i];
+  }
+  included_files.swap(files);
+  return parse_stream(rep, errhandl);
 }
 
 /** @section Implementation
@@ -0,0 +1,261 @@
+/**
+ * @file lex_snapshot.cpp
+ * @brief Source implementing lexers which save and replay the tokens of a parse.
+ *
+ * @section License
+ *
+ * Copyright (C) 2018 ENIGMA Development Team
+ * This file is part of JustDefineIt.
+ *
+ * JustDefineIt is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, version 3 of the License, or (at your option) any later version.
+ *
+ * JustDefineIt is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * JustDefineIt. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "lex_snapshot.h"
+#include <System/builtins.h>
+#include <System/macros.h>
+#include <cstring>
+#include <stdint.h>
+
+using namespace jdip;
+
+/** @section Format
+  A snapshot is a flat run of 32-bit words and length-prefixed strings, in the
+  byte order of the machine that wrote it: the magic below, then the included
+  files, the macros, the names of the files tokens came from, and the tokens.
+  Builtin declarators are saved by name, since their definitions only exist in
+  the running process.
+**/
+static const char snapshot_magic[] = "JDI token snapshot 1\n";
+
+namespace {
+  void put_u32(string &s, uint32_t v) { s.append((const char*) &v, sizeof v); }
+  void put_bytes(string &s, const char *data, size_t len) { put_u32(s, len); s.append(data, len); }
+  void put_str(string &s, const string &v) { put_bytes(s, v.data(), v.length()); }
+
+  struct snapshot_reader {
+    const string &data;
+    size_t pos;
+    bool ok;
+    snapshot_reader(const string &d): data(d), pos(0), ok(true) {}
+
+    uint32_t u32() {
+      uint32_t v = 0;
+      if (pos + sizeof v > data.length()) return ok = false, 0;
+      memcpy(&v, data.data() + pos, sizeof v);
+      pos += sizeof v;
+      return v;
+    }
+    // Points at the next len bytes, which stay in the snapshot.
+    const char *bytes(size_t &len) {
+      len = u32();
+      if (!ok || len > data.length() - pos) return ok = false, "";
+      const char *res = data.data() + pos;
+      pos += len;
+      return res;
+    }
+    string str() { size_t len; const char *b = bytes(len); return string(b, len); }
+  };
+
+  /// Whether lexer_cpp gives tokens of this type a content string.
+  bool has_content(TOKEN_TYPE t) {
+    switch (t) {
+      case TT_IDENTIFIER: case TT_OPERATOR: case TT_TILDE: case TT_COLON: case TT_SCOPE:
+      case TT_ELLIPSIS: case TT_LESSTHAN: case TT_GREATERTHAN: case TT_STRINGLITERAL:
+      case TT_CHARLITERAL: case TT_DECLITERAL: case TT_HEXLITERAL: case TT_OCTLITERAL:
+        return true;
+      default:
+        return false;
+    }
+  }
+}
+
+//======================================================================================================
+//=====: Recording :====================================================================================
+//======================================================================================================
+
+lexer_recorder::lexer_recorder(lexer_cpp *lex): lcpp(lex), token_count(0), failed(false) {
+  for (tf_iter it = builtin_declarators.begin(); it != builtin_declarators.end(); ++it) {
+    declarator_names[it->second] = it->first;
+    if (it->second->def) declarator_names[it->second->def] = it->first;
+  }
+}
+lexer_recorder::~lexer_recorder() { delete lcpp; }
+
+token_t lexer_recorder::get_token(error_handler *herr) {
+  token_t res = lcpp->get_token(herr);
+  if (failed) return res;
+
+  uint32_t file = 0;
+  int line = 0, pos = 0;
+  #ifndef NO_ERROR_REPORTING
+    const char *fn = res.file ? (const char*) res.file : "";
+    std::map<string, unsigned>::iterator fi = file_ids.find(fn);
+    if (fi == file_ids.end()) fi = file_ids.insert(std::make_pair(string(fn), unsigned(file_ids.size()))).first;
+    file = fi->second;
+    line = res.linenum;
+    #ifndef NO_ERROR_POSITION
+      pos = res.pos;
+    #endif
+  #endif
+
+  put_u32(tokens, res.type);
+  put_u32(tokens, file);
+  put_u32(tokens, line);
+  put_u32(tokens, pos);
+  if (has_content(res.type))
+    put_bytes(tokens, (const char*) res.content.str, res.content.len);
+  else if (res.type == TT_DECLARATOR || res.type == TT_DECFLAG) {
+    std::map<const void*, string>::const_iterator dn = declarator_names.find(res.def);
+    if (dn == declarator_names.end()) failed = true;
+    else put_str(tokens, dn->second);
+  }
+  ++token_count;
+  return res;
+}
+
+bool lexer_recorder::finish(const std::set<string> &files, const macro_map &macros, string &dest) const {
+  if (failed) return false;
+  string res(snapshot_magic);
+
+  put_u32(res, files.size());
+  for (std::set<string>::const_iterator it = files.begin(); it != files.end(); ++it)
+    put_str(res, *it);
+
+  put_u32(res, macros.size());
+  for (macro_iter_c it = macros.begin(); it != macros.end(); ++it) {
+    const macro_type *m = it->second;
+    put_str(res, it->first);
+    put_u32(res, m->argc);
+    if (m->argc < 0) {
+      put_str(res, ((const macro_scalar*) m)->value);
+      continue;
+    }
+    const macro_function *mf = (const macro_function*) m;
+    put_u32(res, mf->args.size());
+    for (size_t i = 0; i < mf->args.size(); ++i)
+      put_str(res, mf->args[i]);
+    put_u32(res, mf->value.size());
+    for (size_t i = 0; i < mf->value.size(); ++i) {
+      put_u32(res, mf->value[i].is_arg);
+      if (mf->value[i].is_arg) put_u32(res, mf->value[i].metric);
+      else put_bytes(res, mf->value[i].data, mf->value[i].metric);
+    }
+  }
+
+  // File names are kept with their terminators, so replayed tokens can point at them.
+  vector<const string*> names(file_ids.size());
+  for (std::map<string, unsigned>::const_iterator it = file_ids.begin(); it != file_ids.end(); ++it)
+    names[it->second] = &it->first;
+  put_u32(res, names.size());
+  for (size_t i = 0; i < names.size(); ++i)
+    put_bytes(res, names[i]->c_str(), names[i]->length() + 1);
+
+  put_u32(res, token_count);
+  res += tokens;
+  dest.swap(res);
+  return true;
+}
+
+//======================================================================================================
+//=====: Replaying :====================================================================================
+//======================================================================================================
+
+lexer_replay::lexer_replay(): next(0) {}
+
+token_t lexer_replay::get_token(error_handler *) {
+  if (next < tokens.size()) return tokens[next++];
+  return token_t(token_basics(TT_ENDOFCODE, "", 0, 0));
+}
+
+bool lexer_replay::load(const string &snapshot, std::set<string> &files, std::vector<macro_type*> &macros) {
+  data = snapshot;
+  tokens.clear();
+  next = 0;
+  snapshot_reader in(data);
+  if (data.compare(0, sizeof snapshot_magic - 1, snapshot_magic)) return false;
+  in.pos = sizeof snapshot_magic - 1;
+
+  std::set<string> read_files;
+  for (uint32_t n = in.u32(); in.ok && n; --n)
+    read_files.insert(in.str());
+
+  std::vector<macro_type*> read_macros;
+  for (uint32_t n = in.u32(); in.ok && n; --n) {
+    const string name = in.str();
+    const int argc = (int) in.u32();
+    if (argc < 0) {
+      const string value = in.str();
+      if (in.ok) read_macros.push_back(new macro_scalar(name, value));
+      continue;
+    }
+    vector<string> args;
+    for (uint32_t a = in.u32(); in.ok && a; --a)
+      args.push_back(in.str());
+    const int variadic = argc - (int) args.size();
+    if (variadic != 0 && variadic != 1) { in.ok = false; break; }
+    macro_function *mf = new macro_function(name, args, "", variadic);
+    read_macros.push_back(mf);
+    for (uint32_t c = in.u32(); in.ok && c; --c) {
+      if (in.u32()) {
+        const uint32_t arg = in.u32();
+        if (arg >= (uint32_t) argc) in.ok = false;
+        else mf->value.push_back(macro_function::mv_chunk(arg));
+        continue;
+      }
+      size_t len;
+      const char *b = in.bytes(len);
+      char *buf = new char[len];
+      memcpy(buf, b, len);
+      mf->value.push_back(macro_function::mv_chunk(buf, len));
+    }
+  }
+
+  vector<const char*> names;
+  for (uint32_t n = in.u32(); in.ok && n; --n) {
+    size_t len;
+    const char *b = in.bytes(len);
+    if (!len || b[len - 1]) in.ok = false;
+    names.push_back(b);
+  }
+
+  uint32_t count = in.u32();
+  if (in.ok) tokens.reserve(count);
+  for (; in.ok && count; --count) {
+    const TOKEN_TYPE type = (TOKEN_TYPE) in.u32();
+    const uint32_t file = in.u32();
+    const int line = in.u32(), pos = in.u32();
+    if (type > TT_INVALID || (file >= names.size() && !names.empty())) { in.ok = false; break; }
+    token_t t(token_basics(type, names.empty() ? "" : names[file], line, pos));
+    (void) line; (void) pos;
+    if (has_content(type)) {
+      size_t len;
+      t.content.str = in.bytes(len);
+      t.content.len = len;
+    }
+    else if (type == TT_DECLARATOR || type == TT_DECFLAG) {
+      tf_iter tf = builtin_declarators.find(in.str());
+      if (tf == builtin_declarators.end() || (type == TT_DECLARATOR && !tf->second->def)) { in.ok = false; break; }
+      t.def = type == TT_DECLARATOR ? tf->second->def : (definition*) tf->second;
+    }
+    tokens.push_back(t);
+  }
+
+  if (!in.ok || in.pos != data.length()) {
+    for (size_t i = 0; i < read_macros.size(); ++i)
+      macro_type::free(read_macros[i]);
+    tokens.clear();
+    return false;
+  }
+  files.swap(read_files);
+  macros.swap(read_macros);
+  return true;
+}
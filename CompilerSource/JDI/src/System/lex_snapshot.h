@@ -0,0 +1,83 @@
+/**
+ * @file lex_snapshot.h
+ * @brief Header declaring lexers which save and replay the tokens of a parse.
+ *
+ * A parse of C++ definitions is fully determined by the tokens the parser reads
+ * and the context it starts from. The recording lexer wraps \c lexer_cpp and
+ * keeps every token it hands out; together with the macros and files the parse
+ * left behind, that makes a snapshot. The replaying lexer reads a snapshot back
+ * and hands out the same tokens without opening a single file, so parsing it
+ * defines everything the original parse did.
+ *
+ * @section License
+ *
+ * Copyright (C) 2018 ENIGMA Development Team
+ * This file is part of JustDefineIt.
+ *
+ * JustDefineIt is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, version 3 of the License, or (at your option) any later version.
+ *
+ * JustDefineIt is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * JustDefineIt. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#ifndef _LEX_SNAPSHOT__H
+#define _LEX_SNAPSHOT__H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <System/lex_cpp.h>
+
+namespace jdip {
+  /**
+    A lexer which hands out the tokens of a \c lexer_cpp, keeping a copy of each.
+  **/
+  struct lexer_recorder: lexer {
+    lexer_cpp *lcpp; ///< The lexer doing the actual work; owned by this one.
+
+    token_t get_token(error_handler *herr = def_error_handler);
+    /** Write out the snapshot: the tokens read so far, and the given files and macros.
+        @return Returns false if some token could not be saved, in which case \p dest is left alone. **/
+    bool finish(const std::set<string> &files, const macro_map &macros, string &dest) const;
+
+    /// Construct around a C++ lexer, which this lexer will free.
+    lexer_recorder(lexer_cpp *lex);
+    ~lexer_recorder();
+
+  private:
+    string tokens; ///< Each token read, serialized.
+    size_t token_count; ///< The number of tokens in \c tokens.
+    bool failed; ///< Set when a token can't be saved.
+    std::map<string, unsigned> file_ids; ///< Index of each file name tokens came from.
+    std::map<const void*, string> declarator_names; ///< The name of each builtin declarator, by the pointers tokens carry.
+  };
+
+  /**
+    A lexer which hands out the tokens saved in a snapshot by \c lexer_recorder.
+  **/
+  struct lexer_replay: lexer {
+    token_t get_token(error_handler *herr = def_error_handler);
+
+    /** Read a snapshot, storing the files and macros it records in \p files and \p macros.
+        The macros are new, and belong to the caller.
+        @return Returns false if the snapshot is damaged or was made with other builtins, in which case
+                nothing is stored. **/
+    bool load(const string &snapshot, std::set<string> &files, std::vector<macro_type*> &macros);
+
+    lexer_replay();
+
+  private:
+    string data; ///< The snapshot; token contents and file names point into it.
+    std::vector<token_t> tokens; ///< The tokens to hand out.
+    size_t next; ///< The index of the next token to hand out.
+  };
+}
+
+#endif
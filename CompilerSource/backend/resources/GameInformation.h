@@ -27,7 +27,9 @@ struct GameInformation
   String gameInfoStr;
 
   // Default backgroundColor is the same as Game Maker
-  GameInformation(): backgroundColor(0xFFFFE100), embedGameWindow(false), formCaption("") {
+  GameInformation(): backgroundColor(0xFFFFE100), embedGameWindow(false), formCaption(""),
+      left(-1), top(-1), width(600), height(400), showBorder(true), allowResize(true),
+      stayOnTop(false), pauseGame(true) {
 
   }
 
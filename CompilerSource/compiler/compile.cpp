@@ -60,15 +60,18 @@ using namespace std;
 
 
 #include "settings-parse/crawler.h"
+#include "settings-parse/parse_ide_settings.h"
 
 #include "components/components.h"
 
 #include "general/bettersystem.h"
+#include "general/codegen_ofstream.h"
 #include "event_reader/event_parser.h"
 
 #include "languages/lang_CPP.h"
 
 #include "compiler/jdi_utility.h"
+#include "compiler/reshandlers/respack.h"
 
 #ifdef WRITE_UNIMPLEMENTED_TXT
 std::map <string, char> unimplemented_function_list;
@@ -118,7 +121,7 @@ inline void write_desktop_entry(const std::string fPath, const GameSettings& gam
 }
 
 inline void write_exe_info(const std::string codegen_directory, const EnigmaStruct *es) {
-  std::ofstream wto;
+  codegen_ofstream wto;
   GameSettings gameSet = es->gameSettings;
 
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/Resources.rc").c_str(),ios_base::out);
@@ -323,7 +326,7 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
 
   //Export resources to each file.
 
-  ofstream wto;
+  codegen_ofstream wto;
   idpr("Outputting Resources in Various Places...",10);
 
   // FIRST FILE
@@ -340,17 +343,7 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
     write_desktop_entry(gameFname, es->gameSettings);
 
   edbg << "Writing modes and settings" << flushl;
-  wto.open((codegen_directory + "Preprocessor_Environment_Editable/GAME_SETTINGS.h").c_str(),ios_base::out);
-  wto << license;
-  wto << "#define ASSUMEZERO 0\n";
-  wto << "#define PRIMBUFFER 0\n";
-  wto << "#define PRIMDEPTH2 6\n";
-  wto << "#define AUTOLOCALS 0\n";
-  wto << "#define MODE3DVARS 0\n";
-  wto << "#define GM_COMPATIBILITY_VERSION " << setting::compliance_mode << "\n";
-  wto << "void ABORT_ON_ALL_ERRORS() { " << (false?"game_end();":"") << " }\n";
-  wto << '\n';
-  wto.close();
+  write_game_settings();
 
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_modesenabled.h").c_str(),ios_base::out);
   wto << license;
@@ -386,7 +379,8 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
   wto << license;
 
 
-  stringstream ss;
+  // Only the enums are needed to compile objects and scripts (ENIGMA_GAME_UNIT) on their own.
+  stringstream ss, defs;
 
     max = 0;
     wto << "namespace enigma_user {\nenum //object names\n{\n";
@@ -394,10 +388,11 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
       if (i->first >= max) max = i->first + 1;
       wto << "  " << i->second->name << " = " << i->first << ",\n";
       ss << "    case " << i->first << ": return \"" << i->second->name << "\"; break;\n";
-    } wto << "};\n}\nnamespace enigma { size_t object_idmax = " << max << "; }\n\n";
+    } wto << "};\n}\n\n";
+    defs << "namespace enigma { size_t object_idmax = " << max << "; }\n\n";
 
-    wto << "namespace enigma_user {\nstring object_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+    defs << "namespace enigma_user {\nstring object_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -406,10 +401,11 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
       if (es->sprites[i].id >= max) max = es->sprites[i].id + 1;
       wto << "  " << es->sprites[i].name << " = " << es->sprites[i].id << ",\n";
       ss << "    case " << es->sprites[i].id << ": return \"" << es->sprites[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t sprite_idmax = " << max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t sprite_idmax = " << max << "; }\n\n";
 
-     wto << "namespace enigma_user {\nstring sprite_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+     defs << "namespace enigma_user {\nstring sprite_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -418,10 +414,11 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
       if (es->backgrounds[i].id >= max) max = es->backgrounds[i].id + 1;
       wto << "  " << es->backgrounds[i].name << " = " << es->backgrounds[i].id << ",\n";
       ss << "    case " << es->backgrounds[i].id << ": return \"" << es->backgrounds[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t background_idmax = " << max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t background_idmax = " << max << "; }\n\n";
 
-     wto << "namespace enigma_user {\nstring background_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+     defs << "namespace enigma_user {\nstring background_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -430,10 +427,11 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
       if (es->fonts[i].id >= max) max = es->fonts[i].id + 1;
       wto << "  " << es->fonts[i].name << " = " << es->fonts[i].id << ",\n";
       ss << "    case " << es->fonts[i].id << ": return \"" << es->fonts[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t font_idmax = " << max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t font_idmax = " << max << "; }\n\n";
 
-     wto << "namespace enigma_user {\nstring font_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+     defs << "namespace enigma_user {\nstring font_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -442,10 +440,11 @@ int lang_CPP::compile(EnigmaStruct *es, const char* exe_filename, int mode)
 	    if (es->timelines[i].id >= max) max = es->timelines[i].id + 1;
         wto << "  " << es->timelines[i].name << " = " << es->timelines[i].id << ",\n";
         ss << "    case " << es->timelines[i].id << ": return \"" << es->timelines[i].name << "\"; break;\n";
-	} wto << "};}\nnamespace enigma { size_t timeline_idmax = " << max << "; }\n\n";
+	} wto << "};}\n\n";
+    defs << "namespace enigma { size_t timeline_idmax = " << max << "; }\n\n";
 
-wto << "namespace enigma_user {\nstring timeline_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+defs << "namespace enigma_user {\nstring timeline_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -454,10 +453,11 @@ wto << "namespace enigma_user {\nstring timeline_get_name(int i) {\n switch (i)
 	    if (es->paths[i].id >= max) max = es->paths[i].id + 1;
         wto << "  " << es->paths[i].name << " = " << es->paths[i].id << ",\n";
         ss << "    case " << es->paths[i].id << ": return \"" << es->paths[i].name << "\"; break;\n";
-	} wto << "};}\nnamespace enigma { size_t path_idmax = " << max << "; }\n\n";
+	} wto << "};}\n\n";
+    defs << "namespace enigma { size_t path_idmax = " << max << "; }\n\n";
 
-wto << "namespace enigma_user {\nstring path_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+defs << "namespace enigma_user {\nstring path_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -466,10 +466,11 @@ wto << "namespace enigma_user {\nstring path_get_name(int i) {\n switch (i) {\n"
       if (es->sounds[i].id >= max) max = es->sounds[i].id + 1;
       wto << "  " << es->sounds[i].name << " = " << es->sounds[i].id << ",\n";
       ss << "    case " << es->sounds[i].id << ": return \"" << es->sounds[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t sound_idmax = " <<max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t sound_idmax = " << max << "; }\n\n";
 
-wto << "namespace enigma_user {\nstring sound_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+defs << "namespace enigma_user {\nstring sound_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -478,10 +479,11 @@ wto << "namespace enigma_user {\nstring sound_get_name(int i) {\n switch (i) {\n
       if (es->scripts[i].id >= max) max = es->scripts[i].id + 1;
       wto << "  " << es->scripts[i].name << " = " << es->scripts[i].id << ",\n";
       ss << "    case " << es->scripts[i].id << ": return \"" << es->scripts[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t script_idmax = " <<max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t script_idmax = " << max << "; }\n\n";
 
-wto << "namespace enigma_user {\nstring script_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+defs << "namespace enigma_user {\nstring script_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -490,10 +492,11 @@ wto << "namespace enigma_user {\nstring script_get_name(int i) {\n switch (i) {\
       if (es->shaders[i].id >= max) max = es->shaders[i].id + 1;
       wto << "  " << es->shaders[i].name << " = " << es->shaders[i].id << ",\n";
       ss << "    case " << es->shaders[i].id << ": return \"" << es->shaders[i].name << "\"; break;\n";
-    } wto << "};}\nnamespace enigma { size_t shader_idmax = " <<max << "; }\n\n";
+    } wto << "};}\n\n";
+    defs << "namespace enigma { size_t shader_idmax = " << max << "; }\n\n";
 
-wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\n";
-     wto << ss.str() << " default: return \"<undefined>\";}};}\n\n";
+defs << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\n";
+     defs << ss.str() << " default: return \"<undefined>\";}};}\n\n";
      ss.str( "" );
 
     max = 0;
@@ -502,7 +505,9 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
       if (es->rooms[i].id >= max) max = es->rooms[i].id + 1;
       wto << "  " << es->rooms[i].name << " = " << es->rooms[i].id << ",\n";
     }
-    wto << "};}\nnamespace enigma { size_t room_idmax = " <<max << "; }\n\n";
+    wto << "};}\n\n";
+    defs << "namespace enigma { size_t room_idmax = " << max << "; }\n\n";
+  wto << "#ifndef ENIGMA_GAME_UNIT\n" << defs.str() << "#endif\n";
   wto.close();
 
 
@@ -517,6 +522,7 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
     //Each timeline has a lookup structure (in this case, a map) which allows easy forward/backward lookup.
     //This is currently constructed rather manually; there are probably more efficient
     // construction techniques, but none come to mind.
+    wto <<"#ifndef ENIGMA_GAME_UNIT\n";
     wto <<"void timeline_system_initialize() {\n";
     wto <<"  std::vector< std::map<int, int> >& res = object_timelines::timeline_moments_maps;\n";
     wto <<"  res.reserve(" <<es->timelineCount <<");\n";
@@ -528,7 +534,8 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
       }
       wto <<"  res.push_back(curr);\n\n";
     }
-    wto <<"}\n\n";
+    wto <<"}\n";
+    wto <<"#endif\n\n";
 
     wto <<"}\n"; //namespace
   }
@@ -544,6 +551,10 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
   res = current_language->link_ambiguous(&EGMglobal,es,parsed_scripts, parsed_tlines);
   irrr();
 
+  edbg << "Checking parallel step events" << flushl;
+  res = current_language->compile_checkParallelEvents(&EGMglobal);
+  irrr();
+
   edbg << "Running Secondary Parse Passes" << flushl;
   res = current_language->compile_parseSecondary(parsed_objects,parsed_scripts,es->scriptCount, parsed_tlines, parsed_rooms,&EGMglobal, script_names);
 
@@ -685,7 +696,6 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
   #endif
 
   FILE *gameModule;
-  int resourceblock_start = 0;
   std::string resfile = compilerInfo.exe_vars["RESOURCES"];
   cout << "`" << resfile << "` == '$exe': " << (resfile == "$exe"?"true":"FALSE") << endl;
   if (resfile == "$exe")
@@ -697,9 +707,7 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
     }
 
     fseek(gameModule,0,SEEK_END); //necessary on Windows for no reason.
-    resourceblock_start = ftell(gameModule);
-
-    if (resourceblock_start < 128) {
+    if (ftell(gameModule) < 128) {
       user << "Compiled game is clearly not a working module; cannot continue" << flushl;
       idpr("Failed to add resources.",-1); return 13;
     }
@@ -716,33 +724,35 @@ wto << "namespace enigma_user {\nstring shader_get_name(int i) {\n switch (i) {\
     }
   }
 
-  // Start by setting off our location with a DWord of NULLs
-  fwrite("\0\0\0",1,4,gameModule);
+  // Resources go in an indexed pack so the game can map it and only unpack what it uses
+  enigma::resource_pack_writer pack(gameModule);
 
   idpr("Adding Sprites",90);
 
-  res = current_language->module_write_sprites(es, gameModule);
+  res = current_language->module_write_sprites(es, pack);
   irrr();
 
   edbg << "Finalized sprites." << flushl;
   idpr("Adding Sounds",93);
 
-  current_language->module_write_sounds(es,gameModule);
+  current_language->module_write_sounds(es,pack);
 
-  current_language->module_write_backgrounds(es,gameModule);
+  current_language->module_write_backgrounds(es,pack);
 
-  current_language->module_write_fonts(es,gameModule);
+  current_language->module_write_fonts(es,pack);
 
-  current_language->module_write_paths(es,gameModule);
+  current_language->module_write_paths(es,pack);
 
-  // Tell where the resources start
-  fwrite("\0\0\0\0res0",8,1,gameModule);
-  fwrite(&resourceblock_start,4,1,gameModule);
+  // Write the table of contents, which also tells where the resources start
+  const bool packed = pack.finish();
 
   // Close the game module; we're done adding resources
   idpr("Closing game module and running if requested.",99);
   edbg << "Closing game module and running if requested." << flushl;
-  fclose(gameModule);
+  if (fclose(gameModule) || !packed) {
+    user << "Failed to write resources to the game module. Out of disk space?" << flushl;
+    idpr("Failed to add resources.",-1); return 12;
+  }
 
   // Run the game if requested
   if (run_game && (mode == emode_run or mode == emode_debug or mode == emode_design))
@@ -30,6 +30,7 @@
 #define ENIGMA_COMPILE_COMMON_H
 
 #include <map>
+#include <set>
 #include <vector>
 #include "compile_organization.h"
 #include "parser/object_storage.h"
@@ -51,6 +52,9 @@ namespace used_funcs
 extern std::map<string,parsed_script*> scr_lookup;
 extern std::map<string, std::vector<parsed_script*> > tline_lookup;
 
+// The objects the game lets run their step events on the thread pool.
+std::set<string> parallel_step_object_names(); // Implemented in components/check_parallel_events.cpp
+
 
 extern const char* license;
 
@@ -0,0 +1,197 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+using namespace std;
+
+#include "backend/ideprint.h"
+#include "parser/object_storage.h"
+#include "compiler/compile_common.h"
+#include "languages/lang_CPP.h"
+#include "settings.h"
+
+// Step events run on the thread pool may change their own instance and nothing
+// else, since nothing else is deferred to the barrier. This pass reads the code
+// of each flagged object's step events, and of the scripts they call, after
+// collect_variables has marked it up, and refuses any write another instance
+// could see: a global, a variable reached through a dot other than self's, any
+// variable inside a with, or a call to a function that changes shared state.
+
+set<string> parallel_step_object_names() {
+  set<string> names;
+  const string &list = setting::parallel_step_objects;
+  for (size_t pos = 0; pos < list.size(); ) {
+    size_t comma = list.find(',', pos);
+    if (comma == string::npos) comma = list.size();
+    string name = list.substr(pos, comma - pos);
+    name.erase(0, name.find_first_not_of(" \t"));
+    name.erase(name.find_last_not_of(" \t") + 1);
+    if (!name.empty()) names.insert(name);
+    pos = comma + 1;
+  }
+  return names;
+}
+
+namespace {
+  // Functions of these families change the state they're given, unless their
+  // name past the family is one of the listed reads; a trailing * matches any
+  // ending.
+  struct function_family { const char *prefix; const char *const *reads; };
+  const char *const ds_reads[] = { "exists", "size", "empty", "find_*", "get*", "value_*", "width", "height", "head", "tail", "top", "write", NULL };
+  const char *const buffer_reads[] = { "exists", "peek", "tell", "get_*", "md5", "sha1", "base64_encode", NULL };
+  const char *const no_reads[] = { NULL };
+  const function_family shared_families[] = {
+    { "ds_list_", ds_reads }, { "ds_map_", ds_reads }, { "ds_grid_", ds_reads }, { "ds_queue_", ds_reads },
+    { "ds_stack_", ds_reads }, { "ds_priority_", ds_reads }, { "buffer_", buffer_reads },
+    { "room_goto", no_reads }, { "room_restart", no_reads }, { "game_end", no_reads }, { "game_restart", no_reads },
+    { "instance_activate_", no_reads }, { "instance_deactivate_", no_reads },
+  };
+
+  bool changes_shared_state(const string &func) {
+    for (size_t i = 0; i < sizeof shared_families / sizeof *shared_families; i++) {
+      const string prefix = shared_families[i].prefix;
+      if (func.compare(0, prefix.size(), prefix)) continue;
+      const string rest = func.substr(prefix.size());
+      for (const char *const *r = shared_families[i].reads; *r; r++) {
+        const string read = *r;
+        if (read[read.size() - 1] == '*' ? !rest.compare(0, read.size() - 1, read, 0, read.size() - 1) : rest == read)
+          return false;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  pt skip_brackets(const string &synt, pt pos) {
+    while (pos < synt.size() && synt[pos] == '[')
+      for (int lvl = 0; pos < synt.size(); )
+        if (synt[pos] == '[') lvl++, pos++;
+        else if (synt[pos++] == ']' && !--lvl) break;
+    return pos;
+  }
+
+  // Whether the operator at pos stores into the operand before it.
+  bool assigns(const string &synt, pt pos) {
+    const char c = pos < synt.size() ? synt[pos] : 0, d = pos + 1 < synt.size() ? synt[pos + 1] : 0;
+    if (c == '=') return d != '=';
+    if ((c == '+' || c == '-') && d == c) return true;
+    if (d == '=' && (c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '|' || c == '&' || c == '^')) return true;
+    return (c == '<' || c == '>') && d == c && pos + 2 < synt.size() && synt[pos + 2] == '=';
+  }
+
+  struct shared_write_finder {
+    language_adapter *lang;
+    const parsed_object *global;
+    set<string> scripts_seen;
+
+    // Describes the first write in the code another instance could see, or
+    // returns an empty string if there is none.
+    string find(const parsed_event &pev) {
+      const string &code = pev.code, &synt = pev.synt;
+      vector<bool> with_scopes(1, false);
+      int with_parens = 0;
+      bool with_statement = false;
+      for (pt pos = 0; pos < synt.size(); pos++) {
+        const char c = synt[pos];
+        if (c == '{') { with_scopes.push_back(with_scopes.back() || with_statement); with_statement = false; continue; }
+        if (c == '}') { if (with_scopes.size() > 1) with_scopes.pop_back(); continue; }
+        if (c == '(' && with_parens) with_parens++;
+        if (c == ')' && with_parens && --with_parens == 1) with_statement = true, with_parens = 0;
+        if (c == ';') with_statement = false;
+        if (c == 's') {
+          const pt sp = pos;
+          while (pos + 1 < synt.size() && synt[pos + 1] == 's') pos++;
+          if (code.compare(sp, pos + 1 - sp, "with") == 0) with_parens = 1;
+          continue;
+        }
+        const bool chain_on_expression = c == '.' && pos && (synt[pos - 1] == ')' || synt[pos - 1] == ']');
+        const bool name = c == 'n' || c == 'a'; // collect_variables marks the ambi. it adds with a
+        if (!name && !chain_on_expression) continue;
+        if (name && pos && (synt[pos - 1] == '.' || synt[pos - 1] == c)) continue;
+
+        // Read a whole chain, a.b[i].c, and what is done with it.
+        const pt start = pos;
+        vector<string> parts;
+        if (chain_on_expression) parts.push_back("");
+        for (;;) {
+          if (synt[pos] == '.') pos++;
+          const pt np = pos;
+          while (pos < synt.size() && (synt[pos] == 'n' || synt[pos] == 'a')) pos++;
+          parts.push_back(code.substr(np, pos - np));
+          pos = skip_brackets(synt, pos);
+          if (pos + 1 < synt.size() && synt[pos] == '.' && synt[pos + 1] == 'n') continue;
+          break;
+        }
+        const bool in_with = with_scopes.back() || with_statement;
+
+        if (parts.size() == 1 && pos < synt.size() && synt[pos] == '(') {
+          const string &func = parts[0];
+          if (changes_shared_state(func)) return "calls `" + func + "'";
+          map<string, parsed_script*>::const_iterator scr = scr_lookup.find(func);
+          if (scr != scr_lookup.end() && scripts_seen.insert(func).second) {
+            const string why = find(scr->second->pev);
+            if (!why.empty()) return why + " in script `" + func + "'";
+          }
+          pos--;
+          continue;
+        }
+
+        const bool written = assigns(synt, pos) || (start >= 2 && synt[start - 1] == synt[start - 2]
+                             && (synt[start - 1] == '+' || synt[start - 1] == '-'));
+        pos--;
+        if (!written) continue;
+        string target = parts[0].empty() ? "(...)" : parts[0];
+        for (size_t i = 1; i < parts.size(); i++) target += "." + parts[i];
+        if (parts.size() == 1) {
+          if (lang->global_exists(parts[0]) || global->globals.count(parts[0]))
+            return "writes global `" + target + "'";
+        } else if (in_with) {
+          // Names inside a with were given the self. or ambi. they belong to
+          const bool marked = parts[0] == "self" || parts[0] == "ambi";
+          return "writes `" + (marked ? target.substr(5) : target) + "' inside a with";
+        } else if (parts.size() > 2 || parts[0] != "self") {
+          return "writes `" + target + "'";
+        }
+      }
+      return "";
+    }
+  };
+}
+
+int lang_CPP::compile_checkParallelEvents(parsed_object *EGMglobal)
+{
+  const set<string> parallel = parallel_step_object_names();
+  for (po_i it = parsed_objects.begin(); it != parsed_objects.end(); it++) {
+    if (!parallel.count(it->second->name)) continue;
+    // Inherited step events run as part of the object's own.
+    for (parsed_object *obj = it->second; obj; obj = obj->parent)
+      for (unsigned i = 0; i < obj->events.size; i++) {
+        if (obj->events[i].mainId != 3 || obj->events[i].id != 0) continue;
+        shared_write_finder finder = { this, EGMglobal, set<string>() };
+        const string why = finder.find(obj->events[i]);
+        if (why.empty()) continue;
+        user << "Object `" << it->second->name << "' can't run its step event in parallel: the step event"
+             << (obj == it->second ? "" : " it inherits from `" + obj->name + "'") << " " << why
+             << ", and parallel step events may only change their own instance" << flushl;
+        return E_ERROR_SYNTAX;
+      }
+  }
+  return 0;
+}
@@ -39,50 +39,28 @@ using namespace std;
 #include "compiler/compile_common.h"
 
 #include "backend/ideprint.h"
+#include "compiler/reshandlers/respack.h"
 #include "languages/lang_CPP.h"
 
-inline void writei(int x, FILE *f) {
-  fwrite(&x,4,1,f);
-}
+using namespace enigma::resource_pack;
 
-int lang_CPP::module_write_backgrounds(EnigmaStruct *es, FILE *gameModule)
+int lang_CPP::module_write_backgrounds(EnigmaStruct *es, enigma::resource_pack_writer &pack)
 {
   // Now we're going to add backgrounds
   edbg << es->backgroundCount << " Adding Backgrounds to Game Module: " << flushl;
 
-  //Magic Number
-  fwrite("BKG ",4,1,gameModule);
-
-  //Indicate how many
   int back_count = es->backgroundCount;
-  fwrite(&back_count,4,1,gameModule);
-
-  int back_maxid = 0;
-  for (int i = 0; i < back_count; i++)
-    if (es->backgrounds[i].id > back_maxid)
-      back_maxid = es->backgrounds[i].id;
-  fwrite(&back_maxid,4,1,gameModule);
-
   for (int i = 0; i < back_count; i++)
   {
-    writei(es->backgrounds[i].id,gameModule); //id
-    writei(es->backgrounds[i].backgroundImage.width, gameModule); // width
-    writei(es->backgrounds[i].backgroundImage.height, gameModule); // height
-
-    writei(es->backgrounds[i].transparent,gameModule);
-    writei(es->backgrounds[i].smoothEdges,gameModule);
-    writei(es->backgrounds[i].preload,gameModule);
-    writei(es->backgrounds[i].useAsTileset,gameModule);
-    writei(es->backgrounds[i].tileWidth,gameModule);
-    writei(es->backgrounds[i].tileHeight,gameModule);
-    writei(es->backgrounds[i].hOffset,gameModule);
-    writei(es->backgrounds[i].vOffset,gameModule);
-    writei(es->backgrounds[i].hSep,gameModule);
-    writei(es->backgrounds[i].vSep,gameModule);
+    const Background &back = es->backgrounds[i];
+    pack.add(kind_background, back.id, 0, {
+      back.backgroundImage.width, back.backgroundImage.height,
+      back.transparent, back.smoothEdges, back.preload, back.useAsTileset,
+      back.tileWidth, back.tileHeight, back.hOffset, back.vOffset, back.hSep, back.vSep
+    });
 
-    const int sz = es->backgrounds[i].backgroundImage.dataSize;
-    writei(sz, gameModule); // size
-    fwrite(es->backgrounds[i].backgroundImage.data, 1, sz, gameModule); // data
+    const int w = back.backgroundImage.width, h = back.backgroundImage.height;
+    pack.add_zlib(kind_background_image, back.id, 0, back.backgroundImage.data, back.backgroundImage.dataSize, w * h * 4);
   }
 
   edbg << "Done writing backgrounds." << flushl;
@@ -34,13 +34,14 @@ using namespace std;
 #include "backend/ideprint.h"
 
 #include "compiler/reshandlers/rectpack.h"
+#include "compiler/reshandlers/respack.h"
 #include "languages/lang_CPP.h"
 
-inline void writei(int x, FILE *f) {
-  fwrite(&x,4,1,f);
+inline void writei(int x, string &blob) {
+  blob.append((const char*) &x, 4);
 }
-inline void writef(float x, FILE *f) {
-  fwrite(&x,4,1,f);
+inline void writef(float x, string &blob) {
+  blob.append((const char*) &x, 4);
 }
 
 using namespace enigma::rect_packer;
@@ -83,17 +84,12 @@ static inline void populate_texture(const Font& font, pvrect* boxes, GlyphTextur
   fclose(sex);*/
 }
 
-int lang_CPP::module_write_fonts(EnigmaStruct *es, FILE *gameModule)
+int lang_CPP::module_write_fonts(EnigmaStruct *es, enigma::resource_pack_writer &pack)
 {
   // Now we're going to add backgrounds
   edbg << es->fontCount << " Adding Fonts to Game Module: " << flushl;
 
-  //Magic Number
-  fwrite("FNT ",4,1,gameModule);
-
-  //Indicate how many
   int font_count = es->fontCount;
-  writei(font_count,gameModule);
 
   // For each included font
   for (int i = 0; i < font_count; i++)
@@ -158,6 +154,7 @@ int lang_CPP::module_write_fonts(EnigmaStruct *es, FILE *gameModule)
     cout << "Finished packing font stuff." << endl;
 
     GlyphTextureRect *glyphtexc = new GlyphTextureRect[gc];
+    string blob;
 
     cout << "Generating font map and metrics..." << endl; {
       unsigned char *bigtex = new unsigned char[w * h];
@@ -165,10 +162,8 @@ int lang_CPP::module_write_fonts(EnigmaStruct *es, FILE *gameModule)
       cout << "Allocated a big texture. Moving font into it..." << endl;
       populate_texture(es->fonts[i], boxes, glyphtexc, bigtex, w, h);
 
-      writei(es->fonts[i].id,gameModule);
-      writei(w,gameModule), writei(h,gameModule);
-      fwrite(bigtex,1,w*h,gameModule);
-      fwrite("done",1,4,gameModule);
+      writei(w,blob), writei(h,blob);
+      blob.append((const char*) bigtex, w*h);
 
       delete[] bigtex;
     }
@@ -176,27 +171,27 @@ int lang_CPP::module_write_fonts(EnigmaStruct *es, FILE *gameModule)
     size_t igt = 0;
     for (int ii = 0; ii < es->fonts[i].glyphRangeCount; ii++) {
       GlyphRange &glyphRange = es->fonts[i].glyphRanges[ii];
-      writei(glyphRange.rangeMin, gameModule);
+      writei(glyphRange.rangeMin, blob);
       unsigned rangeSize = glyphRange.rangeMax - glyphRange.rangeMin + 1;
-      writei(rangeSize, gameModule);
+      writei(rangeSize, blob);
       for (unsigned ig = 0; ig < rangeSize; ig++) {
         Glyph &glyph = glyphRange.glyphs[ig];
-        writef(glyph.advance, gameModule);
-        writef(glyph.baseline,gameModule);
-        writef(glyph.origin, gameModule);
-        writei(glyph.width,  gameModule);
-        writei(glyph.height, gameModule);
-
-        writef(glyphtexc[igt].x,  gameModule),
-        writef(glyphtexc[igt].y,  gameModule),
-        writef(glyphtexc[igt].x2, gameModule),
-        writef(glyphtexc[igt].y2, gameModule);
+        writef(glyph.advance, blob);
+        writef(glyph.baseline,blob);
+        writef(glyph.origin, blob);
+        writei(glyph.width,  blob);
+        writei(glyph.height, blob);
+
+        writef(glyphtexc[igt].x,  blob),
+        writef(glyphtexc[igt].y,  blob),
+        writef(glyphtexc[igt].x2, blob),
+        writef(glyphtexc[igt].y2, blob);
         igt++;
       }
     }
 
 
-    fwrite("endf",1,4,gameModule);
+    pack.add(enigma::resource_pack::kind_font, es->fonts[i].id, 0, blob.data(), blob.size());
     cout << "Wrote all data for font " << i << endl;
     delete[] glyphtexc;
     delete[] boxes;
@@ -42,49 +42,34 @@ using namespace std;
 
 #include "backend/ideprint.h"
 
+#include "compiler/reshandlers/respack.h"
 #include "languages/lang_CPP.h"
 
-inline void writei(int x, FILE *f) {
-  fwrite(&x,4,1,f);
-}
-
-int lang_CPP::module_write_paths(EnigmaStruct *es, FILE *gameModule)
+int lang_CPP::module_write_paths(EnigmaStruct *es, enigma::resource_pack_writer &pack)
 {
   // Now we're going to add paths
   edbg << es->pathCount << " Adding Paths to Game Module: " << flushl;
 
-  //Magic Number
-  fwrite("PTH ",4,1,gameModule);
-
-  //Indicate how many
   int path_count = es->pathCount;
-  fwrite(&path_count,4,1,gameModule);
-
-  int path_maxid = 0;
-  for (int i = 0; i < path_count; i++)
-    if (es->paths[i].id > path_maxid)
-      path_maxid = es->paths[i].id;
-  fwrite(&path_maxid,4,1,gameModule);
-
   for (int i = 0; i < path_count; i++)
   {
-    writei(es->paths[i].id,gameModule); //id
-
-    writei(es->paths[i].smooth,gameModule);
-    writei(es->paths[i].closed,gameModule);
-    writei(es->paths[i].precision,gameModule);
+    vector<int32_t> data;
+    data.push_back(es->paths[i].smooth);
+    data.push_back(es->paths[i].closed);
+    data.push_back(es->paths[i].precision);
     // possibly snapX/Y?
 
     // Track how many path points we're copying
     int pointCount = es->paths[i].pointCount;
-    writei(pointCount,gameModule);
+    data.push_back(pointCount);
 
     for (int ii = 0; ii < pointCount; ii++)
     {
-      writei(es->paths[i].points[ii].x,gameModule);
-      writei(es->paths[i].points[ii].y,gameModule);
-      writei(es->paths[i].points[ii].speed,gameModule);
+      data.push_back(es->paths[i].points[ii].x);
+      data.push_back(es->paths[i].points[ii].y);
+      data.push_back(es->paths[i].points[ii].speed);
     }
+    pack.add(enigma::resource_pack::kind_path, es->paths[i].id, 0, data);
   }
 
   edbg << "Done writing paths." << flushl;
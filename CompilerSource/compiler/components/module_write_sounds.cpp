@@ -39,13 +39,10 @@ using namespace std;
 #include "compiler/compile_common.h"
 
 #include "backend/ideprint.h"
+#include "compiler/reshandlers/respack.h"
 #include "languages/lang_CPP.h"
 
-inline void writei(int x, FILE *f) {
-  fwrite(&x,4,1,f);
-}
-
-int lang_CPP::module_write_sounds(EnigmaStruct *es, FILE *gameModule)
+int lang_CPP::module_write_sounds(EnigmaStruct *es, enigma::resource_pack_writer &pack)
 {
   // Now we're going to add sounds
   edbg << es->soundCount << " Sounds:" << flushl;
@@ -54,19 +51,7 @@ int lang_CPP::module_write_sounds(EnigmaStruct *es, FILE *gameModule)
     fflush(stdout);
   }
 
-  //Magic number
-  fwrite("SND ",4,1,gameModule);
-
-  //Indicate how many
   int sound_count = es->soundCount;
-  fwrite(&sound_count,4,1,gameModule);
-
-  int sound_maxid = 0;
-  for (int i = 0; i < sound_count; i++)
-    if (es->sounds[i].id > sound_maxid)
-      sound_maxid = es->sounds[i].id;
-  fwrite(&sound_maxid,4,1,gameModule);
-
   for (int i = 0; i < sound_count; i++)
   {
     unsigned sndsz = es->sounds[i].size;
@@ -75,9 +60,7 @@ int lang_CPP::module_write_sounds(EnigmaStruct *es, FILE *gameModule)
       continue;
     }
 
-    writei(es->sounds[i].id, gameModule); // id
-    writei(sndsz, gameModule); // Size
-    fwrite(es->sounds[i].data, 1, sndsz, gameModule); // Sound data
+    pack.add(enigma::resource_pack::kind_sound, es->sounds[i].id, 0, es->sounds[i].data, sndsz); // Sound data
   }
 
   edbg << "Done writing sounds." << flushl;
@@ -41,32 +41,20 @@ using namespace std;
 
 #include "backend/ideprint.h"
 
-inline void writei(int x, FILE *f) {
-  fwrite(&x,4,1,f);
-}
-
+#include "compiler/reshandlers/respack.h"
 #include "languages/lang_CPP.h"
-int lang_CPP::module_write_sprites(EnigmaStruct *es, FILE *gameModule)
+
+using namespace enigma::resource_pack;
+
+int lang_CPP::module_write_sprites(EnigmaStruct *es, enigma::resource_pack_writer &pack)
 {
   // Now we're going to add sprites
   edbg << es->spriteCount << " Adding Sprites to Game Module: " << flushl;
 
-  //Magic Number
-  fwrite("SPR ",4,1,gameModule);
-
-  //Indicate how many
   int sprite_count = es->spriteCount;
-  fwrite(&sprite_count,4,1,gameModule);
-
-  int sprite_maxid = 0;
-  for (int i = 0; i < sprite_count; i++)
-    if (es->sprites[i].id > sprite_maxid)
-      sprite_maxid = es->sprites[i].id;
-  fwrite(&sprite_maxid,4,1,gameModule);
-
   for (int i = 0; i < sprite_count; i++)
   {
-    writei(es->sprites[i].id,gameModule); //id
+    const int id = es->sprites[i].id;
 
     // Track how many subImages we're copying
     int subCount = es->sprites[i].subImageCount;
@@ -88,26 +76,20 @@ int lang_CPP::module_write_sprites(EnigmaStruct *es, FILE *gameModule)
       return 14;
     }
 
-    writei(swidth, gameModule); //width
-    writei(sheight,gameModule); //height
-    writei(es->sprites[i].originX,gameModule); //xorig
-    writei(es->sprites[i].originY,gameModule); //yorig
-    writei(es->sprites[i].bbTop,gameModule);    //BBox Top
-    writei(es->sprites[i].bbBottom,gameModule); //BBox Bottom
-    writei(es->sprites[i].bbLeft,gameModule);   //BBox Left
-    writei(es->sprites[i].bbRight,gameModule);  //BBox Right
-    writei(es->sprites[i].bbMode,gameModule);  //BBox Mode
-    writei(es->sprites[i].shape,gameModule);  //Mask shape
+    pack.add(kind_sprite, id, 0, {
+      swidth, sheight,                                   // width, height
+      es->sprites[i].originX, es->sprites[i].originY,    // xorig, yorig
+      es->sprites[i].bbTop, es->sprites[i].bbBottom,     // BBox Top, Bottom
+      es->sprites[i].bbLeft, es->sprites[i].bbRight,     // BBox Left, Right
+      es->sprites[i].bbMode,                             // BBox Mode
+      es->sprites[i].shape,                              // Mask shape
+      subCount                                           // subimages
+    });
 
-    writei(subCount,gameModule); //subimages
-
-    for (int ii = 0;ii < subCount; ii++)
+    for (int ii = 0; ii < subCount; ii++)
     {
-      //strans = es->sprites[i].subImages[ii].transColor, fwrite(&idttrans,4,1,exe); //Transparent color
-      writei(swidth * sheight * 4,gameModule); //size when unpacked
-      writei(es->sprites[i].subImages[ii].image.dataSize,gameModule); //size when unpacked
-      fwrite(es->sprites[i].subImages[ii].image.data, 1, es->sprites[i].subImages[ii].image.dataSize, gameModule); //sprite data
-      writei(0,gameModule);
+      const Image &image = es->sprites[i].subImages[ii].image;
+      pack.add_zlib(kind_sprite_image, id, ii, image.data, image.dataSize, swidth * sheight * 4);
     }
   }
 
@@ -46,66 +46,114 @@ using namespace std;
 #include <languages/lang_CPP.h>
 
 #include "compiler/compile_includes.h"
+#include "general/parallel_for.h"
 #include "settings.h"
+#include "OS_Switchboard.h"
 
 extern string tostring(int);
 
+#ifdef WRITE_UNIMPLEMENTED_TXT
+extern std::map <string, char> unimplemented_function_list;
+#endif
+
+// Where, if anywhere, syncheck::syntaxcheck found an error in a piece of code parsed off the main thread
+struct code_check {
+  int error_at;
+  string error;
+  std::map<string, char> unimplemented; // What syncheck::unimplemented held afterward
+  code_check(): error_at(-1) {}
+};
+
+// Adds what syntax checks found unimplemented to a list, later entries winning as they would
+// had they been written one after another
+static void note_unimplemented(std::map<string, char> &list, const std::map<string, char> &found) {
+  for (std::map<string, char>::const_iterator it = found.begin(); it != found.end(); ++it)
+    list[it->first] = it->second;
+}
+#ifdef WRITE_UNIMPLEMENTED_TXT
+static void note_unimplemented(const std::map<string, char> &found) { note_unimplemented(unimplemented_function_list, found); }
+#else
+static void note_unimplemented(const std::map<string, char> &) {}
+#endif
+
+// Parses a script or timeline moment which passed the syntax check
+static void parse_script(parsed_script *script, const string &newcode, const std::set<std::string>& script_names)
+{
+  parser_main(newcode,&script->pev, script_names);
+
+  // If the script accesses variables from outside its scope implicitly
+  if (script->obj.locals.size() or script->obj.globallocals.size() or script->obj.ambiguous.size()) {
+    parsed_object temporary_object = *script->pev.myObj;
+    script->pev_global = new parsed_event(&temporary_object);
+    parser_main(string("with (self) {\n") + newcode + "\n/* */}",script->pev_global, script_names);
+    script->pev_global->myObj = NULL;
+  }
+}
+
 int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], vector<parsed_script*>& tlines, const std::set<std::string>& script_names)
 {
+  // Scripts, moments and objects don't touch each other until they're linked, so each kind is
+  // checked and parsed in parallel. The results are then gone over in order, so errors and
+  // lookups come out exactly as they would parsing one at a time.
+
   //First we just parse the scripts to add semicolons and collect variable names
+  vector<code_check> script_checks(es->scriptCount);
+  parallel_for(es->scriptCount, [&](size_t i) {
+    std::string newcode;
+    code_check &check = script_checks[i];
+    check.error_at = syncheck::syntaxcheck(es->scripts[i].code, newcode);
+    check.unimplemented.swap(syncheck::unimplemented);
+    if (check.error_at != -1) {
+      check.error = syncheck::syerr;
+      return;
+    }
+    parse_script(scripts[i] = new parsed_script, newcode, script_names);
+  });
   for (int i = 0; i < es->scriptCount; i++)
   {
-    std::string newcode;
-    int a = syncheck::syntaxcheck(es->scripts[i].code, newcode);
-    if (a != -1) {
-      user << "Syntax error in script `" << es->scripts[i].name << "'\n" << format_error(es->scripts[i].code,syncheck::syerr,a) << flushl;
+    note_unimplemented(script_checks[i].unimplemented);
+    if (script_checks[i].error_at != -1) {
+      user << "Syntax error in script `" << es->scripts[i].name << "'\n" << format_error(es->scripts[i].code,script_checks[i].error,script_checks[i].error_at) << flushl;
       return E_ERROR_SYNTAX;
     }
     // Keep a parsed record of this script
-    scr_lookup[es->scripts[i].name] = scripts[i] = new parsed_script;
-    parser_main(newcode,&scripts[i]->pev, script_names);
+    scr_lookup[es->scripts[i].name] = scripts[i];
     edbg << "Parsed `" << es->scripts[i].name << "': " << scripts[i]->obj.locals.size() << " locals, " << scripts[i]->obj.globals.size() << " globals" << flushl;
-
-    // If the script accesses variables from outside its scope implicitly
-    if (scripts[i]->obj.locals.size() or scripts[i]->obj.globallocals.size() or scripts[i]->obj.ambiguous.size()) {
-      parsed_object temporary_object = *scripts[i]->pev.myObj;
-      scripts[i]->pev_global = new parsed_event(&temporary_object);
-      parser_main(string("with (self) {\n") + newcode + "\n/* */}",scripts[i]->pev_global, script_names);
-      scripts[i]->pev_global->myObj = NULL;
-    }
-    fflush(stdout);
   }
 
   //Next we just parse the timeline scripts to add semicolons and collect variable names
+  //Add a parsed_script record for each. We can retrieve these later; their order is well-defined (timeline i, moment j) and can be calculated with a global counter.
   tline_lookup.clear();
+  vector<pair<int,int> > moments;
   for (int i=0; i<es->timelineCount; i++)
-  {
     for (int j=0; j<es->timelines[i].momentCount; j++)
-    {
-      std::string newcode;
-      int a = syncheck::syntaxcheck(es->timelines[i].moments[j].code, newcode);
-      if (a != -1) {
-        user << "Syntax error in timeline `" << es->timelines[i].name <<", moment: " <<es->timelines[i].moments[j].stepNo << "'\n" << format_error(es->timelines[i].moments[j].code,syncheck::syerr,a) << flushl;
-        return E_ERROR_SYNTAX;
-      }
+      moments.push_back(pair<int,int>(i, j)), tlines.push_back(new parsed_script());
 
-      //Add a parsed_script record. We can retrieve this later; its order is well-defined (timeline i, moment j) and can be calculated with a global counter.
-      tlines.push_back(new parsed_script());
-
-      // Keep a parsed record of this timeline
-      tline_lookup[es->timelines[i].name].push_back(tlines.back());
-      parser_main(newcode, &tlines.back()->pev, script_names);
-      edbg << "Parsed `" << es->timelines[i].name <<", moment: " <<es->timelines[i].moments[j].stepNo << "': " << tlines.back()->obj.locals.size() << " locals, " << tlines.back()->obj.globals.size() << " globals" << flushl;
-
-      // If the timeline accesses variables from outside its scope implicitly
-      if (tlines.back()->obj.locals.size() or tlines.back()->obj.globallocals.size() or tlines.back()->obj.ambiguous.size()) {
-        parsed_object temporary_object = *tlines.back()->pev.myObj;
-        tlines.back()->pev_global = new parsed_event(&temporary_object);
-        parser_main(string("with (self) {\n") + newcode + "\n/* */}",tlines.back()->pev_global, script_names);
-        tlines.back()->pev_global->myObj = NULL;
-      }
-      fflush(stdout);
+  vector<code_check> moment_checks(moments.size());
+  parallel_for(moments.size(), [&](size_t k) {
+    std::string newcode;
+    code_check &check = moment_checks[k];
+    check.error_at = syncheck::syntaxcheck(es->timelines[moments[k].first].moments[moments[k].second].code, newcode);
+    check.unimplemented.swap(syncheck::unimplemented);
+    if (check.error_at != -1) {
+      check.error = syncheck::syerr;
+      return;
     }
+    parse_script(tlines[k], newcode, script_names);
+  });
+  for (size_t k = 0; k < moments.size(); k++)
+  {
+    const int i = moments[k].first, j = moments[k].second;
+    note_unimplemented(moment_checks[k].unimplemented);
+    if (moment_checks[k].error_at != -1) {
+      user << "Syntax error in timeline `" << es->timelines[i].name <<", moment: " <<es->timelines[i].moments[j].stepNo << "'\n" << format_error(es->timelines[i].moments[j].code,moment_checks[k].error,moment_checks[k].error_at) << flushl;
+      return E_ERROR_SYNTAX;
+    }
+
+    // Keep a parsed record of this timeline
+    parsed_script *moment = tlines[k];
+    tline_lookup[es->timelines[i].name].push_back(moment);
+    edbg << "Parsed `" << es->timelines[i].name <<", moment: " <<es->timelines[i].moments[j].stepNo << "': " << moment->obj.locals.size() << " locals, " << moment->obj.globals.size() << " globals" << flushl;
   }
 
   edbg << "\"Linking\" scripts" << flushl;
@@ -226,25 +274,27 @@ int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], ve
   for (int i = 0; i < es->gmObjectCount; i++)
   {
     //For every object in Ism's struct, make our own
-    unsigned ev_count = 0;
-    parsed_object* pob = parsed_objects[es->gmObjects[i].id] =
+    parsed_objects[es->gmObjects[i].id] =
       new parsed_object(
         es->gmObjects[i].name, es->gmObjects[i].id, es->gmObjects[i].spriteId, es->gmObjects[i].maskId,
         es->gmObjects[i].parentId,
         es->gmObjects[i].visible, es->gmObjects[i].solid,
         es->gmObjects[i].depth, es->gmObjects[i].persistent
       );
+  }
 
-    edbg << " " << es->gmObjects[i].name << ": " << es->gmObjects[i].mainEventCount << " events: " << flushl;
+  // An object's events all add to that object, so each object's events are parsed together
+  struct event_check: code_check { int mainEvent, event; };
+  vector<event_check> object_checks(es->gmObjectCount);
+  parallel_for(es->gmObjectCount, [&](size_t i) {
+    unsigned ev_count = 0;
+    parsed_object* pob = parsed_objects[es->gmObjects[i].id];
 
     for (int ii = 0; ii < es->gmObjects[i].mainEventCount; ii++)
     if (es->gmObjects[i].mainEvents[ii].eventCount) //For every MainEvent that contains event code
     {
       //For each main event in that object, make a copy
       const int mev_id = es->gmObjects[i].mainEvents[ii].id;
-      edbg << "  Event[" << es->gmObjects[i].mainEvents[ii].id << "]: ";
-
-      edbg << "  Parsing " << es->gmObjects[i].mainEvents[ii].eventCount << " sub-events:" << flushl;
       for (int iii = 0; iii < es->gmObjects[i].mainEvents[ii].eventCount; iii++)
       {
         //For each individual event (like begin_step) in the main event (Step), parse the code
@@ -252,33 +302,38 @@ int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], ve
         parsed_event &pev = pob->events[ev_count++]; //Make sure each sub event knows its main event's event ID.
         pev.mainId = mev_id, pev.id = sev_id;
 
-        //Copy the code into a string, and its attributes elsewhere
-        string newcode = es->gmObjects[i].mainEvents[ii].events[iii].code;
-
         //Syntax check the code
-
-        // Print debug info
-          edbg << "Check `" << es->gmObjects[i].name << "::" << event_get_function_name(es->gmObjects[i].mainEvents[ii].id,es->gmObjects[i].mainEvents[ii].events[iii].id) << "...";
-
-        // Check the code
-        int sc = syncheck::syntaxcheck(es->gmObjects[i].mainEvents[ii].events[iii].code, newcode);
-        if (sc != -1)
-        {
-          // Error. Report it.
-          user << "Syntax error in object `" << es->gmObjects[i].name << "', " << event_get_human_name(es->gmObjects[i].mainEvents[ii].id,es->gmObjects[i].mainEvents[ii].events[iii].id) << " event:"
-               << es->gmObjects[i].mainEvents[ii].events[iii].id << ":\n" << format_error(es->gmObjects[i].mainEvents[ii].events[iii].code,syncheck::syerr,sc) << flushl;
-          return E_ERROR_SYNTAX;
+        string newcode;
+        event_check &check = object_checks[i];
+        check.error_at = syncheck::syntaxcheck(es->gmObjects[i].mainEvents[ii].events[iii].code, newcode);
+        note_unimplemented(check.unimplemented, syncheck::unimplemented);
+        if (check.error_at != -1) {
+          check.error = syncheck::syerr, check.mainEvent = ii, check.event = iii;
+          return;
         }
 
-        edbg << " Done. Parse...";
-
         //Add this to our objects map
         pev.myObj = pob; //Link to its calling object.
         parser_main(newcode,&pev,script_names, setting::compliance_mode!=setting::COMPL_STANDARD); //Format it to C++
-
-        edbg << " Done." << flushl;
       }
     }
+  });
+  for (int i = 0; i < es->gmObjectCount; i++)
+  {
+    note_unimplemented(object_checks[i].unimplemented);
+    if (object_checks[i].error_at != -1)
+    {
+      // Error. Report it.
+      const int ii = object_checks[i].mainEvent, iii = object_checks[i].event;
+      user << "Syntax error in object `" << es->gmObjects[i].name << "', " << event_get_human_name(es->gmObjects[i].mainEvents[ii].id,es->gmObjects[i].mainEvents[ii].events[iii].id) << " event:"
+           << es->gmObjects[i].mainEvents[ii].events[iii].id << ":\n" << format_error(es->gmObjects[i].mainEvents[ii].events[iii].code,object_checks[i].error,object_checks[i].error_at) << flushl;
+      return E_ERROR_SYNTAX;
+    }
+
+    edbg << " " << es->gmObjects[i].name << ": " << es->gmObjects[i].mainEventCount << " events: " << flushl;
+    for (int ii = 0; ii < es->gmObjects[i].mainEventCount; ii++)
+      for (int iii = 0; iii < es->gmObjects[i].mainEvents[ii].eventCount; iii++)
+        edbg << "  Parsed `" << es->gmObjects[i].name << "::" << event_get_function_name(es->gmObjects[i].mainEvents[ii].id,es->gmObjects[i].mainEvents[ii].events[iii].id) << "'" << flushl;
   }
 
   //Now we parse the rooms
@@ -291,6 +346,7 @@ int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], ve
 
     std::string newcode;
     int sc = syncheck::syntaxcheck(es->rooms[i].creationCode, newcode);
+    note_unimplemented(syncheck::unimplemented);
     if (sc != -1) {
       user << "Syntax error in room creation code for room " << es->rooms[i].id << " (`" << es->rooms[i].name << "'):\n" << format_error(es->rooms[i].creationCode,syncheck::syerr,sc) << flushl;
       return E_ERROR_SYNTAX;
@@ -303,6 +359,7 @@ int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], ve
       {
         newcode = "";
         int a = syncheck::syntaxcheck(es->rooms[i].instances[ii].creationCode, newcode);
+        note_unimplemented(syncheck::unimplemented);
         if (a != -1) {
           user << "Syntax error in instance creation code for instance " << es->rooms[i].instances[ii].id <<" in room " << es->rooms[i].id << " (`" << es->rooms[i].name << "'):\n" << format_error(es->rooms[i].instances[ii].creationCode,syncheck::syerr,a) << flushl;
           return E_ERROR_SYNTAX;
@@ -321,6 +378,7 @@ int lang_CPP::compile_parseAndLink(EnigmaStruct *es,parsed_script *scripts[], ve
       {
         std::string newcode;
         int a = syncheck::syntaxcheck(es->rooms[i].instances[ii].preCreationCode, newcode);
+        note_unimplemented(syncheck::unimplemented);
         if (a != -1) {
           cout << "Syntax error in instance preCreation code for instance " << es->rooms[i].instances[ii].id <<" in room " << es->rooms[i].id << " (`" << es->rooms[i].name << "'):" << endl << syncheck::syerr << flushl;
           return E_ERROR_SYNTAX;
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <string>
 #include <map>
+#include <set>
 
 #include "backend/ideprint.h"
 
@@ -30,9 +31,11 @@ using namespace std;
 
 #include "syntax/syncheck.h"
 #include "parser/parser.h"
+#include "general/codegen_ofstream.h"
 
 #include "backend/EnigmaStruct.h" //LateralGM interface structures
 #include "compiler/compile_common.h"
+#include "settings.h"
 
 #include "event_reader/event_parser.h"
 #include "languages/lang_CPP.h"
@@ -40,6 +43,67 @@ using namespace std;
 struct foundevent { int mid, id, count; foundevent(): mid(0),id(0),count(0) {} void f2(int m,int i) { id = i, mid = m; } void inc(int m,int i) { mid=m,id=i,count++; } void operator++(int) { count++; } };
 typedef map<string,foundevent>::iterator evfit;
 
+// Whether instances of this object can be on the list for the given event,
+// through its own events or those it inherits.
+static bool object_uses_event(parsed_object *obj, int mid, int id) {
+  const bool stacked = event_is_instance(mid,id);
+  for (; obj; obj = obj->parent)
+    for (unsigned i = 0; i < obj->events.size; i++)
+      if (obj->events[i].mainId == mid and (stacked or obj->events[i].id == id))
+        return true;
+  return false;
+}
+
+// Writes a loop over the event's list that, for each run of instances of the same
+// object, calls that object's handler directly instead of through the vtable.
+// Instances are still visited in list order. Returns false on a room switch.
+// Runs of instances of objects in the parallel set are handed to the thread pool.
+static void write_event_dispatcher(std::ostream &wto, int mid, int id, string name, const set<string> &parallel) {
+  const bool subcheck = event_has_sub_check(mid,id) and !event_is_instance(mid,id);
+  for (po_i it = parsed_objects.begin(); it != parsed_objects.end(); it++) {
+    if (!parallel.count(it->second->name) || !object_uses_event(it->second, mid, id)) continue;
+    const string cls = "OBJ_" + it->second->name;
+    wto << "  static void parallel_" << name << "_" << it->second->name << "(object_basic* inst) {" << endl;
+    wto << "    ((" << cls << "*)inst)->" << cls << "::myevent_" << name << "();" << endl;
+    wto << "  }" << endl;
+  }
+  wto << "  bool dispatch_event_" << name << "()" << endl << "  {" << endl;
+  wto << "    for (instance_event_iterator = event_" << name << "->next; instance_event_iterator != NULL; ) {" << endl;
+  wto << "      switch (instance_event_iterator->inst->object_index) {" << endl;
+  for (po_i it = parsed_objects.begin(); it != parsed_objects.end(); it++) {
+    if (!object_uses_event(it->second, mid, id)) continue;
+    const string cls = "OBJ_" + it->second->name;
+    wto << "        case " << it->first << ": {" << endl;
+    wto << "          enigma::profile_scope ENIGMA_PROFILE_SCOPE(enigma::object_profile(" << it->first << "));" << endl;
+    if (parallel.count(it->second->name)) {
+      wto << "          instance_event_iterator = enigma::parallel_event_run(instance_event_iterator, " << it->first << ", parallel_" << name << "_" << it->second->name << ");" << endl;
+      wto << "          if (enigma::room_switching_id != -1) return false;" << endl;
+      wto << "        } break;" << endl;
+      continue;
+    }
+    wto << "          do {" << endl;
+    if (subcheck)
+      wto << "            if (((" << cls << "*)(instance_event_iterator->inst))->" << cls << "::myevent_" << name << "_subcheck())" << endl << "  ";
+    wto << "            ((" << cls << "*)(instance_event_iterator->inst))->" << cls << "::myevent_" << name << "();" << endl;
+    wto << "            if (enigma::room_switching_id != -1) return false;" << endl;
+    wto << "            instance_event_iterator = instance_event_iterator->next;" << endl;
+    wto << "          } while (instance_event_iterator != NULL && instance_event_iterator->inst->object_index == " << it->first << ");" << endl;
+    wto << "        } break;" << endl;
+  }
+  wto << "        default: {" << endl;
+  wto << "          enigma::profile_scope ENIGMA_PROFILE_SCOPE(enigma::object_profile(instance_event_iterator->inst->object_index));" << endl;
+  if (subcheck)
+    wto << "          if (((enigma::event_parent*)(instance_event_iterator->inst))->myevent_" << name << "_subcheck())" << endl << "  ";
+  wto << "          ((enigma::event_parent*)(instance_event_iterator->inst))->myevent_" << name << "();" << endl;
+  wto << "          if (enigma::room_switching_id != -1) return false;" << endl;
+  wto << "          instance_event_iterator = instance_event_iterator->next;" << endl;
+  wto << "        }" << endl;
+  wto << "      }" << endl;
+  wto << "    }" << endl;
+  wto << "    return true;" << endl;
+  wto << "  }" << endl << endl;
+}
+
 int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
 {
   /* Generate a new list of events used by the objects in
@@ -62,7 +126,7 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
     }
   }
 
-  ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_evparent.h").c_str());
+  codegen_ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_evparent.h").c_str());
   wto << license;
 
   //Write timeline/moment names. Timelines are like scripts, but we don't have to worry about arguments or return types.
@@ -149,6 +213,15 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
   wto << license;
   wto << "namespace enigma" << endl << "{" << endl;
 
+  // The object classes link into these lists in every unit, but only SHELLmain (where
+  // ENIGMA_GAME_UNIT is not defined) owns them and runs the sequence.
+  for (evfit it = used_events.begin(); it != used_events.end(); it++)
+    wto << "  extern event_iter *event_" << it->first << ";" << endl;
+  wto << "}" << endl << endl;
+
+  wto << "#ifndef ENIGMA_GAME_UNIT" << endl;
+  wto << "namespace enigma" << endl << "{" << endl;
+
   // Start by defining storage locations for our event lists to iterate.
   for (evfit it = used_events.begin(); it != used_events.end(); it++)
     wto << "  event_iter *event_" << it->first << "; // Defined in " << it->second.count << " objects" << endl;
@@ -183,6 +256,38 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
   for (evfit it = used_events.begin(); it != used_events.end(); it++)
     wto << event_get_super_check_function(it->second.mid, it->second.id);
 
+  /* Events run by the default loop can be dispatched per object instead. Those
+  ** dispatchers need the object classes, so they are written to their own file. */
+  set<string> dispatched_events;
+
+  // Objects whose step events the game allows to run on the thread pool.
+  const set<string> parallel_step = parallel_step_object_names();
+  for (set<string>::iterator it = parallel_step.begin(); it != parallel_step.end(); it++) {
+    po_i obj = parsed_objects.begin();
+    while (obj != parsed_objects.end() && obj->second->name != *it) obj++;
+    if (obj == parsed_objects.end())
+      user << "Warning: parallel step object `" << *it << "` does not exist" << flushl;
+  }
+
+  codegen_ofstream wtd((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_eventdispatch.h").c_str());
+  wtd << license;
+  wtd << "namespace enigma" << endl << "{" << endl;
+  if (setting::batch_events) {
+    for (size_t i=0; i<event_sequence.size(); i++)
+    {
+      const int mid = event_sequence[i].first, id = event_sequence[i].second;
+      evfit it = used_events.find(event_is_instance(mid,id) ? event_stacked_get_root_name(mid) : event_get_function_name(mid,id));
+      if (it == used_events.end() || dispatched_events.count(it->first)) continue;
+      if ((mid == 7 && (id >= 10 && id <= 25)) || (mid == 8 && id == 64)) continue; // Not run in the sequence; see below.
+      if (!event_execution_uses_default(mid,id) || event_has_instead(mid,id)) continue;
+      dispatched_events.insert(it->first);
+      write_event_dispatcher(wtd, mid, id, it->first, mid == 3 && id == 0 ? parallel_step : set<string>());
+      wto << "  bool dispatch_event_" << it->first << "();" << endl;
+    }
+  }
+  wtd << "} // namespace enigma" << endl;
+  wtd.close();
+
   /* Now the event sequence */
   bool using_gui = false;
   wto << "  int ENIGMA_events()" << endl << "  {" << endl;
@@ -202,10 +307,24 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
       continue;       // Don't want gui loop to be added
     }
 
+    if (seqcode != "" && dispatched_events.count(it->first)) {
+      if (event_has_super_check(mid,id) and !event_is_instance(mid,id))
+        seqcode = "    if (" + event_get_super_check_condition(mid,id) + ")\n  ";
+      else
+        seqcode = "";
+      seqcode += "    if (!dispatch_event_" + it->first + "()) goto after_events;\n";
+    }
+
+    // Each step of the sequence is timed on its own; the braces keep the
+    // goto above from jumping over the counters' initialization.
     if (seqcode != "")
+      wto << "    {" << endl,
+      wto << "    static enigma::profile_counter ENIGMA_PROFILE = { \"" << event_get_human_name(mid,id) << "\", 0, 0, NULL, false };" << endl,
+      wto << "    enigma::profile_scope ENIGMA_PROFILE_SCOPE(ENIGMA_PROFILE);" << endl,
       wto << seqcode,
       wto << "    " << endl,
       wto << "    enigma::update_globals();" << endl,
+      wto << "    }" << endl,
       wto << "    " << endl;
   }
   wto << "    after_events:" << endl;
@@ -225,6 +344,7 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
   // Handle room switching/game restart.
   wto << "    enigma::dispose_destroyed_instances();" << endl;
   wto << "    enigma::rooms_switch();" << endl;
+  wto << "    enigma::residency_trim();" << endl;
   wto << "    enigma::set_room_speed(room_speed);" << endl;
   wto << "    " << endl;
   wto << "    return 0;" << endl;
@@ -233,6 +353,7 @@ int lang_CPP::compile_writeDefraggedEvents(EnigmaStruct* es)
   wto << "  bool gui_used = " << using_gui << ";" << endl;
   // Done, end the namespace
   wto << "} // namespace enigma" << endl;
+  wto << "#endif" << endl;
   wto.close();
 
   return 0;
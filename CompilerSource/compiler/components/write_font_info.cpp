@@ -33,12 +33,13 @@
 #include <string>
 using namespace std;
 #include "compiler/compile_common.h"
+#include "general/codegen_ofstream.h"
 
 
 #include "languages/lang_CPP.h"
 int lang_CPP::compile_writeFontInfo(EnigmaStruct* es)
 {
-  ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_fontinfo.h").c_str(),ios_base::out);
+  codegen_ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_fontinfo.h").c_str(),ios_base::out);
   wto << license << "#include \"Universal_System/fonts_internal.h\"" << endl
       << endl;
 
@@ -30,11 +30,13 @@
 #include <stdio.h>
 #include <iostream>
 #include <fstream>
+#include <atomic>
 
 using namespace std;
 
 #include "syntax/syncheck.h"
 #include "general/estring.h"
+#include "general/codegen_ofstream.h"
 #include "parser/parser.h"
 
 #include "backend/EnigmaStruct.h" //LateralGM interface structures
@@ -42,7 +44,7 @@ using namespace std;
 
 #include "languages/lang_CPP.h"
 
-int global_script_argument_count = 0;
+std::atomic<int> global_script_argument_count(0);
 
 static string esc(string str) {
   string res;
@@ -60,22 +62,24 @@ static string esc(string str) {
 
 int lang_CPP::compile_writeGlobals(EnigmaStruct* es, parsed_object* global)
 {
-  ofstream wto;
+  codegen_ofstream wto;
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_globals.h").c_str(),ios_base::out);
   wto << license;
 
+  // Objects and scripts are compiled separately (ENIGMA_GAME_UNIT), and only see the
+  // declarations at the top; SHELLmain also sees the definitions that follow them.
   global_script_argument_count=16; //write all 16 arguments
   if (global_script_argument_count) {
     wto << "// Script arguments\n";
-    wto << "variant argument0 = 0";
+    wto << "extern variant argument0";
     for (int i = 1; i < global_script_argument_count; i++)
-      wto << ", argument" << i << " = 0";
+      wto << ", argument" << i;
     wto << ";\n\n";
   }
 
   wto << "namespace enigma_user { " << endl;
   //wto << "  string working_directory = \"\";" << endl; // moved over to PFmain.h
-  wto << "  unsigned int game_id = " << es->gameSettings.gameId << ";" << endl;
+  wto << "  extern unsigned int game_id;" << endl;
   wto << "}" << endl <<endl;
 
   wto << "namespace enigma_user {" << endl;
@@ -85,6 +89,32 @@ int lang_CPP::compile_writeGlobals(EnigmaStruct* es, parsed_object* global)
   }
   wto << "}" << endl;
 
+  for (parsed_object::globit i = global->globals.begin(); i != global->globals.end(); i++)
+    wto << "extern " << i->second.type << " " << i->second.prefix << i->first << i->second.suffix << ";" << endl;
+  //This part needs written into a global object_parent class instance elsewhere.
+  //for (globit i = global->dots.begin(); i != global->globals.end(); i++)
+  //  wto << i->second->type << " " << i->second->prefixes << i->second->name << i->second->suffixes << ";" << endl;
+  wto << endl;
+
+  wto << "namespace enigma" << endl << "{" << endl << "  struct ENIGMA_global_structure: object_locals" << endl << "  {" << endl;
+  for (deciter i = dot_accessed_locals.begin(); i != dot_accessed_locals.end(); i++) // Dots are vars that are accessed as something.varname.
+    wto << "    " << i->second.type << " " << i->second.prefix << i->first << i->second.suffix << ";" << endl;
+
+  wto << "    ENIGMA_global_structure(const int _x, const int _y): object_locals(_x,_y) {}" << endl << "  };" << endl;
+  wto << "  extern object_basic *ENIGMA_global_instance;" << endl << "}" << endl << endl;
+
+  wto << "#ifndef ENIGMA_GAME_UNIT" << endl;
+  if (global_script_argument_count) {
+    wto << "variant argument0 = 0";
+    for (int i = 1; i < global_script_argument_count; i++)
+      wto << ", argument" << i << " = 0";
+    wto << ";\n\n";
+  }
+
+  wto << "namespace enigma_user { " << endl;
+  wto << "  unsigned int game_id = " << es->gameSettings.gameId << ";" << endl;
+  wto << "}" << endl <<endl;
+
   wto << "//Default variable type: \"undefined\" or \"real\"" <<endl;
   wto << "const int variant::default_type = " <<(es->gameSettings.treatUninitializedAs0 ? "ty_real" : "ty_undefined") <<";" <<endl <<endl;
 
@@ -99,6 +129,8 @@ int lang_CPP::compile_writeGlobals(EnigmaStruct* es, parsed_object* global)
   wto << "  bool isFullScreen = " << es->gameSettings.startFullscreen << ";" << endl;
   wto << "  int viewScale = " << es->gameSettings.scaling << ";" << endl;
   wto << "  int windowColor = " << javaColor(es->gameSettings.colorOutsideRoom) << ";" << endl;
+  wto << "  unsigned long long residency_budget = " << ((unsigned long long) max(setting::residency_budget_mb, 0) << 20) << "ull;" << endl;
+  wto << "  bool preload_resources = " << setting::preload_resources << ";" << endl;
 
   wto << "  string gameInfoText = \"" << esc(es->gameInfo.gameInfoStr) << "\";" << endl;
   wto << "  string gameInfoCaption = \"" << es->gameInfo.formCaption << "\";" << endl;
@@ -116,17 +148,11 @@ int lang_CPP::compile_writeGlobals(EnigmaStruct* es, parsed_object* global)
 
   for (parsed_object::globit i = global->globals.begin(); i != global->globals.end(); i++)
     wto << i->second.type << " " << i->second.prefix << i->first << i->second.suffix << ";" << endl;
-  //This part needs written into a global object_parent class instance elsewhere.
-  //for (globit i = global->dots.begin(); i != global->globals.end(); i++)
-  //  wto << i->second->type << " " << i->second->prefixes << i->second->name << i->second->suffixes << ";" << endl;
   wto << endl;
 
-  wto << "namespace enigma" << endl << "{" << endl << "  struct ENIGMA_global_structure: object_locals" << endl << "  {" << endl;
-  for (deciter i = dot_accessed_locals.begin(); i != dot_accessed_locals.end(); i++) // Dots are vars that are accessed as something.varname.
-    wto << "    " << i->second.type << " " << i->second.prefix << i->first << i->second.suffix << ";" << endl;
-
-  wto << "    ENIGMA_global_structure(const int _x, const int _y): object_locals(_x,_y) {}" << endl << "  };" << endl << "  object_basic *ENIGMA_global_instance = new ENIGMA_global_structure(global,global);" << endl << "}";
-  wto << endl;
+  wto << "namespace enigma" << endl << "{" << endl;
+  wto << "  object_basic *ENIGMA_global_instance = new ENIGMA_global_structure(global,global);" << endl << "}" << endl;
+  wto << "#endif" << endl;
   wto.close();
   return 0;
 }
@@ -35,6 +35,7 @@ using namespace std;
 
 
 #include "parser/parser.h"
+#include "general/codegen_ofstream.h"
 
 #include "backend/EnigmaStruct.h" //LateralGM interface structures
 #include "compiler/compile_common.h"
@@ -68,17 +69,28 @@ string REFERENCE_POSTFIX(string ref) {
 struct usedtype { int uc; dectrip original; usedtype(): uc(0) {} }; // uc is the use count, then after polling, the dummy number.
 int lang_CPP::compile_writeObjAccess(map<int,parsed_object*> &parsed_objects, parsed_object* global, bool treatUninitAs0)
 {
-  ofstream wto;
+  codegen_ofstream wto;
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_objectaccess.h").c_str(),ios_base::out);
   wto << license;
   wto << "// Depending on how many times your game accesses variables via OBJECT.varname, this file may be empty." << endl << endl;
   wto << "namespace enigma" << endl << "{" << endl;
 
+  // Separately compiled objects and scripts (ENIGMA_GAME_UNIT) get the accessors' declarations;
+  // SHELLmain defines them.
   wto <<
-  "  object_locals ldummy;" << endl <<
-  "  object_locals *glaccess(int x)" << endl <<
+  "  extern object_locals ldummy;" << endl <<
+  "  inline object_locals *glaccess(int x)" << endl <<
   "  {" << endl << "    object_locals* ri = (object_locals*)fetch_instance_by_int(x);" << endl << "    return ri ? ri : &ldummy;" << endl << "  }" << endl << endl;
 
+  wto << "  var &map_var(std::map<string, var> **vmap, string str);" << endl;
+  for (map<string,dectrip>::iterator dait = dot_accessed_locals.begin(); dait != dot_accessed_locals.end(); dait++)
+    wto << "  " << dait->second.type << " " << dait->second.prefix << REFERENCE_POSTFIX(dait->second.suffix) << " &varaccess_" << dait->first << "(int x);" << endl;
+  wto << "} // namespace enigma" << endl << endl;
+
+  wto << "#ifndef ENIGMA_GAME_UNIT" << endl;
+  wto << "namespace enigma" << endl << "{" << endl;
+  wto << "  object_locals ldummy;" << endl << endl;
+
   wto <<
   "  var &map_var(std::map<string, var> **vmap, string str)" << endl <<
   "  {" << endl <<
@@ -145,6 +157,7 @@ int lang_CPP::compile_writeObjAccess(map<int,parsed_object*> &parsed_objects, pa
     wto << "  }" << endl;
   }
   wto << "} // namespace enigma" << endl;
+  wto << "#endif" << endl;
   wto.close();
   return 0;
 }
@@ -32,6 +32,8 @@ using namespace std;
 #include "compiler/compile_common.h"
 #include "event_reader/event_parser.h"
 #include "general/parse_basics_old.h"
+#include "general/codegen_ofstream.h"
+#include "filesystem/file_find.h"
 #include "settings.h"
 
 #include "languages/lang_CPP.h"
@@ -80,6 +82,8 @@ static inline void declare_scripts(std::ostream &wto, EnigmaStruct* es) {
 
 static inline void declare_extension_casts(std::ostream &wto) {
   // Write extension cast methods; these are a temporary fix until the new instance system is in place.
+  // The extensions declare these themselves, so only SHELLmain needs to define them.
+  wto << "#ifndef ENIGMA_GAME_UNIT\n";
   wto << "  namespace extension_cast {\n";
   for (unsigned i = 0; i < parsed_extensions.size(); i++) {
     if (!parsed_extensions[i].implements.empty()) {
@@ -89,6 +93,7 @@ static inline void declare_extension_casts(std::ostream &wto) {
     }
   }
   wto << "  }\n";
+  wto << "#endif\n";
 }
 
 static inline void declare_object_locals_class(std::ostream &wto) {
@@ -637,6 +642,24 @@ static inline void write_object_class_bodies(lang_CPP *lcpp, std::ostream &wto,
   }
 }
 
+// Sub checks are inline, and are called both by the dispatchers in SHELLmain
+// and through the vtable emitted with each object's events, so they are
+// declared here, where both can see them.
+static inline void write_object_subchecks(std::ostream &wto) {
+  for (po_i it = parsed_objects.begin(); it != parsed_objects.end(); it++) {
+    const parsed_object *const object = it->second;
+    for (unsigned ii = 0; ii < object->events.size; ii++) {
+      const parsed_event &event = object->events[ii];
+      const int mid = event.mainId, id = event.id;
+      if ((event.code.size() || event_has_default_code(mid, id)) && event_has_sub_check(mid, id)) {
+        wto << "inline bool enigma::OBJ_" << object->name << "::myevent_" << event_get_function_name(mid, id) << "_subcheck()\n{\n  ";
+        wto << event_get_sub_check_condition(mid, id) << endl;
+        wto << "\n}\n\n";
+      }
+    }
+  }
+}
+
 static inline void write_object_data_structs(std::ostream &wto) {
   wto << "  objectstruct objs[] = {\n" <<std::fixed;
   int objcount = 0, obmx = 0;
@@ -659,7 +682,7 @@ static inline void write_object_data_structs(std::ostream &wto) {
 static inline void write_object_declarations(lang_CPP* lcpp, EnigmaStruct* es, parsed_object* global, robertmap &parent_undefinitions, map<string, int>& revTlineLookup) {
   //NEXT FILE ----------------------------------------
   //Object declarations: object classes/names and locals.
-  ofstream wto;
+  codegen_ofstream wto;
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_objectdeclarations.h").c_str(),ios_base::out);
   wto << license;
   wto << "#include \"Universal_System/collisions_object.h\"\n";
@@ -679,119 +702,164 @@ static inline void write_object_declarations(lang_CPP* lcpp, EnigmaStruct* es, p
   write_object_class_bodies(lcpp, wto, es, global, parent_undefinitions, revTlineLookup);
   wto << "}\n\n";
 
+  write_object_subchecks(wto);
+
+  wto << "#ifndef ENIGMA_GAME_UNIT\n";
   wto << "namespace enigma {\n";
   write_object_data_structs(wto);
   wto << "}\n";
+  wto << "#endif\n";
   wto.close();
 }
 
-static inline void write_script_implementations(ofstream& wto, EnigmaStruct *es, int mode);
-static inline void write_timeline_implementations(ofstream& wto, EnigmaStruct *es);
-static inline void write_event_bodies(ofstream& wto, EnigmaStruct *es, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup);
-static inline void write_global_script_array(ofstream &wto, EnigmaStruct *es);
-static inline void write_basic_constructor(ofstream &wto);
+static inline void write_script_implementation(std::ostream &wto, EnigmaStruct *es, int i, int mode);
+static inline void write_timeline_implementation(std::ostream &wto, EnigmaStruct *es, int i);
+static inline void write_event_bodies(std::ostream &wto, EnigmaStruct *es, const parsed_object *const object, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup);
+static inline void write_global_script_array(std::ostream &wto, EnigmaStruct *es);
+static inline void write_basic_constructor(std::ostream &wto);
 
-static inline void write_object_functionality(EnigmaStruct *es, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup) {
-  vector<unsigned> parent_undefined;
-  ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_objectfunctionality.h").c_str(),ios_base::out);
-
-  wto << license;
+static inline void write_log_xor(std::ostream &wto) {
   wto << endl << "#define log_xor || log_xor_helper() ||" << endl;
   wto << "struct log_xor_helper { bool value; };" << endl;
   wto << "template<typename LEFT> log_xor_helper operator ||(const LEFT &left, const log_xor_helper &xorh) { log_xor_helper nxor; nxor.value = (bool)left; return nxor; }" << endl;
   wto << "template<typename RIGHT> bool operator ||(const log_xor_helper &xorh, const RIGHT &right) { return xorh.value ^ (bool)right; }" << endl << endl;
+}
+
+// Scripts, timelines and objects are each written to a translation unit of their own, so
+// that make only recompiles the ones whose code changed. See SHELLmain.cpp for the other half.
+// Resource names may differ only in case, which case-insensitive filesystems can't tell apart,
+// so capitals are written as '-' and the lowercase letter; no identifier contains a '-'.
+static inline void open_game_unit(codegen_ofstream &wto, const string &kind, const string &name, set<string> &units) {
+  string filename = "IDE_EDIT_" + kind + "_";
+  for (size_t i = 0; i < name.length(); i++) {
+    if (name[i] >= 'A' && name[i] <= 'Z') filename += '-', filename += char(name[i] - 'A' + 'a');
+    else filename += name[i];
+  }
+  filename += ".cpp";
+  units.insert(filename);
+  wto.open(codegen_directory + "Preprocessor_Environment_Editable/" + filename);
+  wto << license;
+  wto << "#define ENIGMA_GAME_UNIT\n";
+  wto << "#include \"SHELLmain.cpp\"\n";
+  write_log_xor(wto);
+}
 
-  write_script_implementations(wto, es, mode);
-  write_timeline_implementations(wto, es);
-  write_event_bodies(wto, es, mode, parent_undefinitions, revTlineLookup);
+// Units of resources which have since been deleted or renamed would otherwise still be built.
+static inline void remove_stale_game_units(const set<string> &units) {
+  const string directory = codegen_directory + "Preprocessor_Environment_Editable/";
+  vector<string> stale;
+  for (string f = file_find_first(directory + "IDE_EDIT_*.cpp", fa_readonly | fa_sysfile); f != ""; f = file_find_next()) {
+    if (f.compare(0, 9, "IDE_EDIT_") == 0 && f.length() > 4 && f.compare(f.length() - 4, 4, ".cpp") == 0 && !units.count(f))
+      stale.push_back(f);
+  }
+  file_find_close();
+  for (size_t i = 0; i < stale.size(); i++)
+    remove((directory + stale[i]).c_str());
+}
+
+static inline void write_object_functionality(EnigmaStruct *es, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup) {
+  set<string> units;
+  codegen_ofstream wto;
+
+  for (int i = 0; i < es->scriptCount; i++) {
+    open_game_unit(wto, "script", es->scripts[i].name, units);
+    write_script_implementation(wto, es, i, mode);
+  }
+  for (int i = 0; i < es->timelineCount; i++) {
+    open_game_unit(wto, "timeline", es->timelines[i].name, units);
+    write_timeline_implementation(wto, es, i);
+  }
+  for (po_i i = parsed_objects.begin(); i != parsed_objects.end(); i++) {
+    open_game_unit(wto, "object", i->second->name, units);
+    write_event_bodies(wto, es, i->second, mode, parent_undefinitions, revTlineLookup);
+  }
+  wto.close();
+  remove_stale_game_units(units);
+
+  wto.open(codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_objectfunctionality.h");
+  wto << license;
+  write_log_xor(wto);
   write_global_script_array(wto, es);
   write_basic_constructor(wto);
-
   wto.close();
 }
 
-static inline void write_script_implementations(ofstream& wto, EnigmaStruct *es, int mode) {
+static inline void write_script_implementation(std::ostream &wto, EnigmaStruct *es, int i, int mode) {
   // Export globalized scripts
-  for (int i = 0; i < es->scriptCount; i++) {
-    parsed_script* scr = scr_lookup[es->scripts[i].name];
-    const char* comma = "";
-    wto << "variant _SCR_" << es->scripts[i].name << "(";
-    for (int argn = 0; argn < scr->globargs; argn++) { //it->second gives max argument count used
-      wto << comma << "variant argument" << argn;
-      comma = ", ";
-    }
-    wto << ")\n{\n";
-    if (mode == emode_debug) {
-      wto << "  enigma::debug_scope $current_scope(\"script '" << es->scripts[i].name << "'\");\n";
-    }
-    wto << "  ";
+  parsed_script* scr = scr_lookup[es->scripts[i].name];
+  const char* comma = "";
+  wto << "variant _SCR_" << es->scripts[i].name << "(";
+  for (int argn = 0; argn < scr->globargs; argn++) { //it->second gives max argument count used
+    wto << comma << "variant argument" << argn;
+    comma = ", ";
+  }
+  wto << ")\n{\n";
+  if (mode == emode_debug) {
+    wto << "  enigma::debug_scope $current_scope(\"script '" << es->scripts[i].name << "'\");\n";
+  }
+  wto << "  ";
+  parsed_event& upev = scr->pev_global?*scr->pev_global:scr->pev;
+
+  // TODO(JoshDreamland): Super-hacky
+  string override_code, override_synt;
+  if (upev.code.compare(0, 12, "with((self))") == 0) {
+    override_code = upev.code.substr(12);
+    override_synt = upev.synt.substr(12);
+  }
+  print_to_file(
+    override_code.empty() ? upev.code : override_code,
+    override_synt.empty() ? upev.synt : override_synt,
+    upev.strc,
+    upev.strs,
+    2,wto
+  );
+  wto << "\n  return 0;\n}\n\n";
+}
+
+static inline void write_timeline_implementation(std::ostream &wto, EnigmaStruct *es, int i) {
+  // Export globalized timelines.event_has_default_code
+  // TODO: Is there such a thing as a localized timeline?
+  for (int j=0; j<es->timelines[i].momentCount; j++) {
+    parsed_script* scr = tline_lookup[es->timelines[i].name][j];
+    wto << "void TLINE_" <<es->timelines[i].name <<"_MOMENT_" <<es->timelines[i].moments[j].stepNo <<"()\n{\n";
     parsed_event& upev = scr->pev_global?*scr->pev_global:scr->pev;
 
-    // TODO(JoshDreamland): Super-hacky
     string override_code, override_synt;
     if (upev.code.compare(0, 12, "with((self))") == 0) {
       override_code = upev.code.substr(12);
       override_synt = upev.synt.substr(12);
     }
     print_to_file(
-      override_code.empty() ? upev.code : override_code,
-      override_synt.empty() ? upev.synt : override_synt,
-      upev.strc,
-      upev.strs,
-      2,wto
-    );
-    wto << "\n  return 0;\n}\n\n";
+        override_code.empty() ? upev.code : override_code,
+        override_synt.empty() ? upev.synt : override_synt,
+        upev.strc,
+        upev.strs,
+        2, wto);
+    wto << "\n}\n\n";
   }
 }
 
-static inline void write_timeline_implementations(ofstream& wto, EnigmaStruct *es) {
-  // Export globalized timelines.event_has_default_code
-  // TODO: Is there such a thing as a localized timeline?
-  for (int i=0; i<es->timelineCount; i++) {
-    for (int j=0; j<es->timelines[i].momentCount; j++) {
-      parsed_script* scr = tline_lookup[es->timelines[i].name][j];
-      wto << "void TLINE_" <<es->timelines[i].name <<"_MOMENT_" <<es->timelines[i].moments[j].stepNo <<"()\n{\n";
-      parsed_event& upev = scr->pev_global?*scr->pev_global:scr->pev;
-
-      string override_code, override_synt;
-      if (upev.code.compare(0, 12, "with((self))") == 0) {
-        override_code = upev.code.substr(12);
-        override_synt = upev.synt.substr(12);
-      }
-      print_to_file(
-          override_code.empty() ? upev.code : override_code,
-          override_synt.empty() ? upev.synt : override_synt,
-          upev.strc,
-          upev.strs,
-          2, wto);
-      wto << "\n}\n\n";
-    }
-  }
-}
-
-static inline void write_object_script_funcs(ofstream& wto, const parsed_object *const t);
-static inline void write_object_timeline_funcs(ofstream& wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup);
-static inline void write_object_event_funcs(ofstream& wto, const parsed_object *const object, int mode, const robertmap &parent_undefinitions);
-static inline void write_can_cast_func(ofstream& wto, const parsed_object *const pobj);
+static inline void write_object_script_funcs(std::ostream &wto, const parsed_object *const t);
+static inline void write_object_timeline_funcs(std::ostream &wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup);
+static inline void write_object_event_funcs(std::ostream &wto, const parsed_object *const object, int mode, const robertmap &parent_undefinitions);
+static inline void write_can_cast_func(std::ostream &wto, const parsed_object *const pobj);
 
-static inline void write_event_bodies(ofstream& wto, EnigmaStruct *es, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup) {
+static inline void write_event_bodies(std::ostream &wto, EnigmaStruct *es, const parsed_object *const object, int mode, robertmap &parent_undefinitions, const map<string, int>& revTlineLookup) {
   // Export everything else
-  for (po_i i = parsed_objects.begin(); i != parsed_objects.end(); i++) {
-    write_object_event_funcs(wto, i->second, mode, parent_undefinitions);
+  write_object_event_funcs(wto, object, mode, parent_undefinitions);
 
-    //Write local object copies of scripts
-    write_object_script_funcs(wto, i->second);
+  //Write local object copies of scripts
+  write_object_script_funcs(wto, object);
 
-    // Write local object copies of timelines
-    write_object_timeline_funcs(wto, es, i->second, revTlineLookup);
+  // Write local object copies of timelines
+  write_object_timeline_funcs(wto, es, object, revTlineLookup);
 
-    //Write the required "can_cast()" function.
-    write_can_cast_func(wto, i->second);
-  }
+  //Write the required "can_cast()" function.
+  write_can_cast_func(wto, object);
 }
 
-static inline void write_event_func(ofstream& wto, const parsed_event &event, string objname, string evname, int mode);
-static inline void write_object_event_funcs(ofstream& wto, const parsed_object *const object, int mode, const robertmap &parent_undefinitions) {
+static inline void write_event_func(std::ostream &wto, const parsed_event &event, string objname, string evname, int mode);
+static inline void write_object_event_funcs(std::ostream &wto, const parsed_object *const object, int mode, const robertmap &parent_undefinitions) {
   const vector<unsigned> &parent_undefined = parent_undefinitions.find(object->id)->second;
   for (unsigned ii = 0; ii < object->events.size; ii++) {
     const parsed_event &event = object->events[ii];
@@ -813,26 +881,16 @@ static inline void write_object_event_funcs(ofstream& wto, const parsed_object *
         wto << "#undef event_inherited\n";
       }
     }
-
-    if  (event.code.size() || event_has_default_code(mid, id)) {
-      // Write event sub check code
-      if (event_has_sub_check(mid, id)) {
-        wto << "inline bool enigma::OBJ_" << object->name << "::myevent_" << evname << "_subcheck()\n{\n  ";
-        cout << "DBGMSG 4-3" << endl;
-        wto << event_get_sub_check_condition(mid, id) << endl;
-        wto << "\n}\n\n";
-      }
-    }
   }
 }
 
-static inline void write_event_func(ofstream& wto, const parsed_event &event, string objname, string evname, int mode) {
+static inline void write_event_func(std::ostream &wto, const parsed_event &event, string objname, string evname, int mode) {
   const int mid = event.mainId, id = event.id;
   wto << "variant enigma::OBJ_" << objname << "::myevent_" << evname << "()\n{\n";
   if (mode == emode_debug) {
     wto << "  enigma::debug_scope $current_scope(\"event '" << evname << "' for object '" << objname << "'\");\n";
   }
-  wto << "  ";
+  wto << "  enigma::collision_event_scope ENIGMA_TOUCH_COLLISION_GRID(this);\n  ";
   if (!event_execution_uses_default(event.mainId,event.id))
     wto << "enigma::temp_event_scope ENIGMA_PUSH_ITERATOR_AND_VALIDATE(this);\n  ";
   if (event_has_const_code(mid, id))
@@ -847,7 +905,7 @@ static inline void write_event_func(ofstream& wto, const parsed_event &event, st
   wto << "\n  return 0;\n}\n\n";
 }
 
-static inline void write_object_script_funcs(ofstream& wto, const parsed_object *const t) {
+static inline void write_object_script_funcs(std::ostream &wto, const parsed_object *const t) {
   for (parsed_object::const_funcit it = t->funcs.begin(); it != t->funcs.end(); ++it) { // For each function called by this object
     map<string, parsed_script*>::iterator subscr = scr_lookup.find(it->first); // Check if it's a script
     if (subscr != scr_lookup.end() // If we've got ourselves a script
@@ -867,8 +925,8 @@ static inline void write_object_script_funcs(ofstream& wto, const parsed_object
   }
 }
 
-static inline void write_known_timelines(ofstream& wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup);
-static inline void write_object_timeline_funcs(ofstream& wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup) {
+static inline void write_known_timelines(std::ostream &wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup);
+static inline void write_object_timeline_funcs(std::ostream &wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup) {
   bool hasKnownTlines = false;
   for (parsed_object::const_tlineit it = t->tlines.begin(); it != t->tlines.end(); ++it) { //For each timeline potentially set by this object
     map<string, int>::const_iterator timit = revTlineLookup.find(it->first); // Check if it's a timeline
@@ -893,7 +951,7 @@ static inline void write_object_timeline_funcs(ofstream& wto, EnigmaStruct *es,
   }
 }
 
-static inline void write_known_timelines(ofstream& wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup) {
+static inline void write_known_timelines(std::ostream &wto, EnigmaStruct *es, const parsed_object *const t, const map<string, int>& revTlineLookup) {
   wto <<"void enigma::OBJ_" << t->name <<"::timeline_call_moment_script(int timeline_index, int moment_index) {\n";
   wto <<"  switch (timeline_index) {\n";
   for (parsed_object::const_tlineit it = t->tlines.begin(); it != t->tlines.end(); it++) {
@@ -918,7 +976,7 @@ static inline void write_known_timelines(ofstream& wto, EnigmaStruct *es, const
   wto <<"}\n\n";
 }
 
-static inline void write_can_cast_func(ofstream& wto, const parsed_object *const pobj) {
+static inline void write_can_cast_func(std::ostream &wto, const parsed_object *const pobj) {
   wto <<"bool enigma::OBJ_" << pobj->name <<"::can_cast(int obj) const {\n";
   wto <<"  return false";
   for (parsed_object* curr=pobj->parent; curr; curr=curr->parent) {
@@ -927,7 +985,7 @@ static inline void write_can_cast_func(ofstream& wto, const parsed_object *const
   wto << ";\n" <<"}\n\n";
 }
 
-static inline void write_global_script_array(ofstream &wto, EnigmaStruct *es) {
+static inline void write_global_script_array(std::ostream &wto, EnigmaStruct *es) {
   wto << "namespace enigma\n{\n"
   "  callable_script callable_scripts[] = {\n";
   int scr_count = 0;
@@ -944,7 +1002,7 @@ static inline void write_global_script_array(ofstream &wto, EnigmaStruct *es) {
   wto << "  };\n  \n";
 }
 
-static inline void write_basic_constructor(ofstream &wto) {
+static inline void write_basic_constructor(std::ostream &wto) {
   wto <<
       "  void constructor(object_basic* instance_b) {\n"
       "    //This is the universal create event code\n"
@@ -0,0 +1,77 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "respack.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace enigma {
+
+using namespace resource_pack;
+
+static const char zeros[8] = {};
+
+resource_pack_writer::resource_pack_writer(FILE *module): module(module), position(0), ok(true) {
+  fseek(module, 0, SEEK_END);
+  long end = ftell(module);
+  ok = end >= 0;
+  // Everything in the pack is 8-aligned relative to its start, so start it on
+  // an aligned offset, too; the engine reads the table in place once mapped.
+  size_t pad = end > 0 ? (8 - end % 8) % 8 : 0;
+  ok = ok && fwrite(zeros, 1, pad, module) == pad;
+  pack_start = uint64_t(end > 0 ? end : 0) + pad;
+}
+
+void resource_pack_writer::append(toc_entry entry, const void *data) {
+  entry.offset = position;
+  entries.push_back(entry);
+
+  const size_t pad = (8 - entry.size % 8) % 8;
+  ok = ok && fwrite(data, 1, entry.size, module) == entry.size;
+  ok = ok && fwrite(zeros, 1, pad, module) == pad;
+  position += entry.size + pad;
+}
+
+void resource_pack_writer::add(uint32_t kind, int id, uint32_t index, const void *data, size_t size) {
+  append(toc_entry { kind, id, index, codec_raw, 0, size, size }, data);
+}
+
+void resource_pack_writer::add_zlib(uint32_t kind, int id, uint32_t index, const void *data, size_t size,
+                                    size_t unpacked_size) {
+  append(toc_entry { kind, id, index, codec_zlib, 0, size, unpacked_size }, data);
+}
+
+bool resource_pack_writer::finish() {
+  std::sort(entries.begin(), entries.end(), [](const toc_entry &a, const toc_entry &b) {
+    return entry_less(a, b.kind, b.id, b.index);
+  });
+
+  footer foot;
+  foot.pack_start = pack_start;
+  foot.toc_offset = position;
+  foot.entry_count = entries.size();
+  foot.version = version;
+  memcpy(foot.magic, magic, sizeof(foot.magic));
+
+  if (!entries.empty())
+    ok = ok && fwrite(entries.data(), sizeof(toc_entry), entries.size(), module) == entries.size();
+  ok = ok && fwrite(&foot, sizeof(foot), 1, module) == 1;
+  return ok;
+}
+
+}  // namespace enigma
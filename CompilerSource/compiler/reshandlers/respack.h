@@ -0,0 +1,61 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_RESPACK_H
+#define ENIGMA_RESPACK_H
+
+#include "resource_pack/resource_pack.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <vector>
+
+namespace enigma {
+
+/// Streams resource data onto the end of the game module, remembering where
+/// each entry went, and finishes with the table of contents the engine looks
+/// entries up by. See shared/resource_pack/resource_pack.h for the layout.
+class resource_pack_writer {
+ public:
+  /// Starts a pack at the current end of the given file.
+  explicit resource_pack_writer(FILE *module);
+
+  /// Appends an entry holding the given bytes as they are.
+  void add(uint32_t kind, int id, uint32_t index, const void *data, size_t size);
+  /// Appends an array of int32 metadata.
+  void add(uint32_t kind, int id, uint32_t index, const std::vector<int32_t> &values) {
+    add(kind, id, index, values.data(), values.size() * sizeof(int32_t));
+  }
+  /// Appends an entry holding zlib data that inflates to unpacked_size bytes.
+  void add_zlib(uint32_t kind, int id, uint32_t index, const void *data, size_t size, size_t unpacked_size);
+
+  /// Writes the table of contents and footer. Returns false if any of the
+  /// pack failed to write.
+  bool finish();
+
+ private:
+  void append(resource_pack::toc_entry entry, const void *data);
+
+  FILE *module;
+  uint64_t pack_start, position;
+  std::vector<resource_pack::toc_entry> entries;
+  bool ok;
+};
+
+}  // namespace enigma
+
+#endif  // ENIGMA_RESPACK_H
@@ -0,0 +1,55 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "codegen_ofstream.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+
+void codegen_ofstream::open(const string &filename, ios_base::openmode) {
+  close();
+  path = filename;
+  str("");
+  clear();
+}
+
+bool codegen_ofstream::close() {
+  if (path.empty()) return false;
+  const string contents = str();
+  str("");
+
+  // Both sides are compared as raw bytes, so write them that way, too.
+  bool changed = true;
+  if (FILE *f = fopen(path.c_str(), "rb")) {
+    string old;
+    char buf[4096];
+    for (size_t n; (n = fread(buf, 1, sizeof buf, f)) > 0; ) {
+      old.append(buf, n);
+      if (old.length() > contents.length()) break;
+    }
+    fclose(f);
+    changed = old != contents;
+  }
+  if (changed) {
+    ofstream out(path.c_str(), ios_base::out | ios_base::binary);
+    out << contents;
+  }
+  path.clear();
+  return changed;
+}
@@ -0,0 +1,46 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_CODEGEN_OFSTREAM_H
+#define ENIGMA_CODEGEN_OFSTREAM_H
+
+#include <ios>
+#include <sstream>
+#include <string>
+
+/// Drop-in replacement for std::ofstream for files the engine build depends on.
+/// Output is collected in memory, and close() only touches the file on disk when
+/// its contents differ, so make doesn't rebuild anything for a file we merely
+/// rewrote with the same code.
+class codegen_ofstream: public std::ostringstream {
+ public:
+  codegen_ofstream() {}
+  explicit codegen_ofstream(const std::string &filename, std::ios_base::openmode = std::ios_base::out) {
+    open(filename);
+  }
+  ~codegen_ofstream() { close(); }
+
+  void open(const std::string &filename, std::ios_base::openmode = std::ios_base::out);
+  bool is_open() const { return !path.empty(); }
+  /// Writes the file if it changed; returns whether it did.
+  bool close();
+
+ private:
+  std::string path;
+};
+
+#endif
@@ -0,0 +1,50 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_PARALLEL_FOR_H
+#define ENIGMA_PARALLEL_FOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// Calls task(i) for every i in [0, count) across the machine's cores and returns once all of
+/// them have finished. Indices are handed out in order but may finish in any order, so tasks
+/// should leave their results in a slot per index for the caller to go over afterward; that
+/// keeps output independent of scheduling. At most `threads` threads are used, or one per
+/// core if that is zero.
+template<typename Task> void parallel_for(size_t count, Task task, size_t threads = 0) {
+  if (!threads) threads = std::thread::hardware_concurrency();
+  if (threads > count) threads = count;
+  if (threads <= 1) {
+    for (size_t i = 0; i < count; ++i) task(i);
+    return;
+  }
+
+  std::atomic<size_t> next(0);
+  auto work = [&]() {
+    for (size_t i; (i = next++) < count; ) task(i);
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+  work();
+  for (size_t t = 0; t < pool.size(); ++t) pool[t].join();
+}
+
+#endif
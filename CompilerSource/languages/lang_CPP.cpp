@@ -21,6 +21,10 @@
 #include "../makedir.h"
 #include <ctime>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sys/stat.h>
 #include "languages/lang_CPP.h"
 
 string lang_CPP::get_name() { return "C++"; }
@@ -78,12 +82,111 @@ const char* heaping_pile_of_dog_shit = "ERROR: Unknown";
 
 #include "settings-parse/parse_ide_settings.h"
 #include "settings-parse/crawler.h"
+#include "general/codegen_ofstream.h"
 
 #include <System/builtins.h>
 
 extern jdi::definition *enigma_type__var, *enigma_type__variant, *enigma_type__varargs;
 void parser_init();
 
+// FNV-1a; only needs to notice change, not resist anyone.
+static void hash_bytes(unsigned long long &h, const char* data, size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    h = (h ^ (unsigned char) data[i]) * 1099511628211ULL;
+}
+
+/// Hashes everything the parse of the engine depends on: the settings, and each header it
+/// included. Headers the settings parse regenerates each time are hashed by contents, since
+/// their timestamps always change; the rest of the engine is hashed by size and mtime.
+static unsigned long long engine_definitions_key(const char* targetYaml, const set<string> &files) {
+  unsigned long long h = 14695981039346656037ULL;
+  hash_bytes(h, targetYaml, strlen(targetYaml) + 1);
+  for (set<string>::const_iterator it = files.begin(); it != files.end(); ++it) {
+    hash_bytes(h, it->c_str(), it->length() + 1);
+    if (it->compare(0, codegen_directory.length(), codegen_directory) == 0) {
+      llreader gen(it->c_str());
+      if (gen.is_open()) hash_bytes(h, gen.data, gen.length);
+      continue;
+    }
+    struct stat st;
+    if (stat(it->c_str(), &st)) return 0; // Deleted; that's a change
+    long long attr[2] = { (long long) st.st_mtime, (long long) st.st_size };
+    hash_bytes(h, (const char*) attr, sizeof(attr));
+  }
+  return h;
+}
+
+// The key of the definitions currently held in main_context, or 0 if they don't match any.
+// This only lives as long as the process, so it helps the IDE, which keeps the compiler loaded
+// between builds; emake, which parses the engine once per run, relies on the snapshot below.
+static unsigned long long engine_definitions_loaded = 0;
+
+/// The last parse of the engine is also saved to disk: the key it was made under and the
+/// files that went into it, then the tokens JDI read and the macros it ended with. Loading it
+/// replays those tokens, which skips reading, preprocessing and lexing every engine header.
+static const char engine_snapshot_magic[] = "ENIGMA engine definitions 1\n";
+static string engine_snapshot_path() { return codegen_directory + "engine_definitions.snapshot"; }
+
+static void snapshot_put(string &s, const void *data, size_t size) { s.append((const char*) data, size); }
+static bool snapshot_get(const string &s, size_t &pos, void *data, size_t size) {
+  if (size > s.length() - pos) return false;
+  memcpy(data, s.data() + pos, size);
+  pos += size;
+  return true;
+}
+
+/// Reads the snapshot into jdi_snapshot if it was made under the key the engine has now.
+static bool load_engine_snapshot(const char* targetYaml, string &jdi_snapshot) {
+  std::ifstream in(engine_snapshot_path().c_str(), std::ios::binary);
+  if (!in) return false;
+  const string blob((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  const size_t magic_len = sizeof engine_snapshot_magic - 1;
+  if (blob.compare(0, magic_len, engine_snapshot_magic)) return false;
+  size_t pos = magic_len;
+  unsigned long long key;
+  unsigned count;
+  if (!snapshot_get(blob, pos, &key, sizeof key) || !snapshot_get(blob, pos, &count, sizeof count))
+    return false;
+  set<string> files;
+  for (; count; --count) {
+    unsigned len;
+    if (!snapshot_get(blob, pos, &len, sizeof len) || len > blob.length() - pos) return false;
+    files.insert(blob.substr(pos, len));
+    pos += len;
+  }
+  if (!key || engine_definitions_key(targetYaml, files) != key) return false;
+  jdi_snapshot = blob.substr(pos);
+  return true;
+}
+
+/// Saves jdi_snapshot under the key of the files main_context has just read. The file is
+/// written under another name and renamed into place, so a reader never sees half of it.
+static void save_engine_snapshot(const char* targetYaml, const string &jdi_snapshot) {
+  const set<string> &files = main_context->included_files;
+  const unsigned long long key = engine_definitions_key(targetYaml, files);
+  if (jdi_snapshot.empty() || !key) return;
+  string blob(engine_snapshot_magic);
+  snapshot_put(blob, &key, sizeof key);
+  const unsigned count = files.size();
+  snapshot_put(blob, &count, sizeof count);
+  for (set<string>::const_iterator it = files.begin(); it != files.end(); ++it) {
+    const unsigned len = it->length();
+    snapshot_put(blob, &len, sizeof len);
+    blob += *it;
+  }
+  blob += jdi_snapshot;
+
+  const string path = engine_snapshot_path(), temp = path + ".tmp";
+  {
+    std::ofstream out(temp.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out.write(blob.data(), blob.length())) return;
+  }
+  if (rename(temp.c_str(), path.c_str()))
+    remove(temp.c_str());
+}
+// What parsing those definitions reported, handed back again whenever they are reused.
+static struct { int line, position, absolute_index; string error; } engine_definitions_result;
+
 syntax_error *lang_CPP::definitionsModified(const char* wscode, const char* targetYaml)
 {
   cout << "Parsing settings..." << endl;
@@ -91,24 +194,63 @@ syntax_error *lang_CPP::definitionsModified(const char* wscode, const char* targ
   
   cout << targetYaml << endl;
   
+  cout << "Dumping whiteSpace definitions..." << endl;
+  if (wscode) {
+    codegen_ofstream of(codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_whitespace.h");
+    of << wscode;
+  }
+  
+  // The IDE calls this on every settings change, and most changes (or non-changes) don't
+  // touch anything the engine headers depend on; keep the definitions we have when so.
+  if (engine_definitions_loaded && main_context
+      && engine_definitions_key(targetYaml, main_context->included_files) == engine_definitions_loaded) {
+    cout << "Engine headers and settings unchanged; reusing parsed definitions." << endl;
+    cout << "Grabbing locals...\n";
+    shared_locals_load(requested_extensions);
+    cout << "Determining build target...\n";
+    extensions::determine_target();
+    cout << " Done.\n";
+    ide_passback_error.set(engine_definitions_result.line, engine_definitions_result.position,
+                           engine_definitions_result.absolute_index, engine_definitions_result.error);
+    return &ide_passback_error;
+  }
+  engine_definitions_loaded = 0;
+  
   cout << "Creating swap." << endl;
   delete main_context;
   main_context = new jdi::context();
   
-  cout << "Dumping whiteSpace definitions..." << endl;
-  FILE *of = wscode ? fopen((codegen_directory + "Preprocessor_Environment_Editable/IDE_EDIT_whitespace.h").c_str(),"wb") : NULL;
-  if (of) fputs(wscode,of), fclose(of);
-  
-  cout << "Opening ENIGMA for parse..." << endl;
-  
-  llreader f("ENIGMAsystem/SHELL/SHELLmain.cpp");
   int res = 1;
+  bool parsed = false;
   DECLARE_TIME_TYPE ts, te;
-  if (f.is_open()) {
+  string snapshot;
+  if (load_engine_snapshot(targetYaml, snapshot)) {
+    cout << "Engine headers and settings unchanged since the last snapshot; replaying it..." << endl;
     CURRENT_TIME(ts);
-    res = main_context->parse_C_stream(f, "SHELLmain.cpp");
+    res = main_context->parse_snapshot(snapshot);
     CURRENT_TIME(te);
+    parsed = res != -1;
+    if (!parsed) {
+      cout << "The snapshot could not be replayed; parsing the engine instead." << endl;
+      delete main_context;
+      main_context = new jdi::context();
+    }
+  }
+  
+  if (!parsed) {
+    cout << "Opening ENIGMA for parse..." << endl;
+    
+    llreader f("ENIGMAsystem/SHELL/SHELLmain.cpp");
+    parsed = f.is_open(); // The lexer takes the file's contents
+    if (parsed) {
+      CURRENT_TIME(ts);
+      res = main_context->parse_C_stream(f, "SHELLmain.cpp", NULL, snapshot);
+      CURRENT_TIME(te);
+      main_context->included_files.insert("ENIGMAsystem/SHELL/SHELLmain.cpp");
+      save_engine_snapshot(targetYaml, snapshot);
+    }
   }
+  else main_context->included_files.insert("ENIGMAsystem/SHELL/SHELLmain.cpp");
   
   jdi::definition *d;
   if ((d = main_context->get_global()->look_up("variant"))) {
@@ -149,6 +291,14 @@ syntax_error *lang_CPP::definitionsModified(const char* wscode, const char* targ
     << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
     //cout << "Namespace std contains " << global_scope.members["std"]->members.size() << " items.\n";
   }
+  // A failed parse is kept too; parsing the same files again would fail the same way.
+  if (parsed) {
+    engine_definitions_loaded = engine_definitions_key(targetYaml, main_context->included_files);
+    engine_definitions_result.line = ide_passback_error.line;
+    engine_definitions_result.position = ide_passback_error.position;
+    engine_definitions_result.absolute_index = ide_passback_error.absolute_index;
+    engine_definitions_result.error = ide_passback_error.err_str ? ide_passback_error.err_str : "";
+  }
   
   cout << "Creating dummy primitives for old ENIGMA" << endl;
   for (jdip::tf_iter it = jdip::builtin_declarators.begin(); it != jdip::builtin_declarators.end(); ++it) {
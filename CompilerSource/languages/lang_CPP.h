@@ -51,15 +51,16 @@ struct lang_CPP: language_adapter {
   int compile_writeFontInfo(EnigmaStruct* es);
   int compile_writeRoomData(EnigmaStruct* es, parsed_object *EGMglobal,int mode);
   int compile_writeShaderData(EnigmaStruct* es, parsed_object *EGMglobal);
+  int compile_checkParallelEvents(parsed_object* EGMglobal);
   int compile_writeDefraggedEvents(EnigmaStruct* es);
   int compile_handle_templates(EnigmaStruct* es);
 
   // Resources added to module
-  int module_write_sprites(EnigmaStruct *es, FILE *gameModule);
-  int module_write_sounds(EnigmaStruct *es, FILE *gameModule);
-  int module_write_backgrounds(EnigmaStruct *es, FILE *gameModule);
-  int module_write_paths(EnigmaStruct *es, FILE *gameModule);
-  int module_write_fonts(EnigmaStruct *es, FILE *gameModule);
+  int module_write_sprites(EnigmaStruct *es, enigma::resource_pack_writer &pack);
+  int module_write_sounds(EnigmaStruct *es, enigma::resource_pack_writer &pack);
+  int module_write_backgrounds(EnigmaStruct *es, enigma::resource_pack_writer &pack);
+  int module_write_paths(EnigmaStruct *es, enigma::resource_pack_writer &pack);
+  int module_write_fonts(EnigmaStruct *es, enigma::resource_pack_writer &pack);
 
   int  load_shared_locals();
   void load_extension_locals();
@@ -31,6 +31,8 @@ using namespace std;
 #include "backend/EnigmaStruct.h"
 #include "frontend.h"
 
+namespace enigma { class resource_pack_writer; }
+
 struct language_adapter {
   virtual string get_name() = 0;
 
@@ -47,15 +49,16 @@ struct language_adapter {
   virtual int compile_writeFontInfo(EnigmaStruct* es) = 0;
   virtual int compile_writeRoomData(EnigmaStruct* es,parsed_object *EGMglobal,int mode) = 0;
   virtual int compile_writeShaderData(EnigmaStruct* es,parsed_object *EGMglobal) = 0;
+  virtual int compile_checkParallelEvents(parsed_object* EGMglobal) = 0;
   virtual int compile_writeDefraggedEvents(EnigmaStruct* es) = 0;
   virtual int compile_handle_templates(EnigmaStruct* es) = 0;
 
   // Resources added to module
-  virtual int module_write_sprites(EnigmaStruct *es, FILE *gameModule) = 0;
-  virtual int module_write_sounds(EnigmaStruct *es, FILE *gameModule) = 0;
-  virtual int module_write_backgrounds(EnigmaStruct *es, FILE *gameModule) = 0;
-  virtual int module_write_paths(EnigmaStruct *es, FILE *gameModule) = 0;
-  virtual int module_write_fonts(EnigmaStruct *es, FILE *gameModule) = 0;
+  virtual int module_write_sprites(EnigmaStruct *es, enigma::resource_pack_writer &pack) = 0;
+  virtual int module_write_sounds(EnigmaStruct *es, enigma::resource_pack_writer &pack) = 0;
+  virtual int module_write_backgrounds(EnigmaStruct *es, enigma::resource_pack_writer &pack) = 0;
+  virtual int module_write_paths(EnigmaStruct *es, enigma::resource_pack_writer &pack) = 0;
+  virtual int module_write_fonts(EnigmaStruct *es, enigma::resource_pack_writer &pack) = 0;
 
   // Globals and locals
   virtual int  load_shared_locals() = 0;
@@ -39,7 +39,8 @@ using namespace std;
 #include "config.h"
 #include "event_reader/event_parser.h"
 
-extern int global_script_argument_count;
+#include <atomic>
+extern std::atomic<int> global_script_argument_count;
 
 struct scope_ignore {
   map<string,int> ignore;
@@ -341,8 +342,9 @@ void collect_variables(language_adapter *lang, string &code, string &synt, parse
         iscr = sscanf(nname.c_str(),"argument%d",&argnum);
         if (iscr == 1)
         { //  not in a script or are but have exceeded arg number
-          if (global_script_argument_count < argnum + 1)
-            global_script_argument_count = argnum + 1;
+          // Scripts are collected on several threads at once
+          int known = global_script_argument_count;
+          while (known < argnum + 1 and !global_script_argument_count.compare_exchange_weak(known, argnum + 1));
           continue;
         }
         
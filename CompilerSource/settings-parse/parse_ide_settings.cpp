@@ -44,12 +44,11 @@ using namespace std;
 #include "parse_ide_settings.h"
 #include "compiler/compile_common.h"
 #include "makedir.h"
+#include "general/codegen_ofstream.h"
 
-inline string fc(const char* fn);
 static void clear_ide_editables()
 {
-  ofstream wto;
-  string f2comp = fc((codegen_directory + "API_Switchboard.h").c_str());
+  codegen_ofstream wto;
   string f2write = license;
     string inc = "/include.h\"\n";
     f2write += "#include \"Platforms/" + (extensions::targetAPI.windowSys)            + "/include.h\"\n"
@@ -70,12 +69,9 @@ static void clear_ide_editables()
         f2write += incg + parsed_extensions[i].pathname + impl;
     }
 
-  if (f2comp != f2write)
-  {
-    wto.open((codegen_directory + "API_Switchboard.h").c_str(),ios_base::out);
-      wto << f2write << endl;
-    wto.close();
-  }
+  wto.open((codegen_directory + "API_Switchboard.h").c_str(),ios_base::out);
+    wto << f2write << endl;
+  wto.close();
 
   wto.open((codegen_directory + "Preprocessor_Environment_Editable/LIBINCLUDE.h").c_str());
     wto << license;
@@ -85,14 +81,24 @@ static void clear_ide_editables()
     wto << "/***************\nEnd optional libs\n ***************/\n";
   wto.close();
 
-  wto.open((codegen_directory + "Preprocessor_Environment_Editable/GAME_SETTINGS.h").c_str(),ios_base::out);
+  write_game_settings();
+}
+
+void write_game_settings()
+{
+  // Written here for the definitions parse and again by compile(); both come through
+  // here, so the file only changes (and SHELLmain only rebuilds) when the settings do.
+  codegen_ofstream wto((codegen_directory + "Preprocessor_Environment_Editable/GAME_SETTINGS.h").c_str(),ios_base::out);
     wto << license;
     wto << "#define ASSUMEZERO 0\n";
     wto << "#define PRIMBUFFER 0\n";
     wto << "#define PRIMDEPTH2 6\n";
     wto << "#define AUTOLOCALS 0\n";
     wto << "#define MODE3DVARS 0\n";
+    wto << "#define GM_COMPATIBILITY_VERSION " << setting::compliance_mode << "\n";
+    wto << "#ifndef ENIGMA_GAME_UNIT\n";
     wto << "void ABORT_ON_ALL_ERRORS() { }\n";
+    wto << "#endif\n";
     wto << '\n';
   wto.close();
 }
@@ -134,7 +140,11 @@ void parse_ide_settings(const char* eyaml)
       setting::compliance_mode = setting::COMPL_STANDARD;
   }
   setting::automatic_semicolons   = settree.get("automatic-semicolons").toBool();
+  setting::batch_events   = settree.get("batch-events").toBool();
   setting::keyword_blacklist = settree.get("keyword-blacklist").toString();
+  setting::parallel_step_objects = settree.get("parallel-step-objects").toString();
+  setting::residency_budget_mb = settree.get("residency-budget").toInt();
+  setting::preload_resources = settree.get("preload-resources").toBool();
 
   // Use a platform-specific make directory.
   eobjs_directory = settree.get("eobjs-directory").toString();
@@ -5,5 +5,7 @@
 #include "general/parse_basics_old.h"
 
 void parse_ide_settings(const char* eyaml);
+/// Writes GAME_SETTINGS.h for the current settings.
+void write_game_settings();
 
 #endif
\ No newline at end of file
@@ -50,8 +50,12 @@ namespace setting
   bool literal_autocast = 0; // Determines how literals are treated.                 0 = enigma::variant,   1 = C++ scalars
   bool inherit_objects = 0;  // Determines whether objects should automatically inherit locals and events from their parents
   bool automatic_semicolons = 0; // Determines whether semicolons should automatically be added or if the user wants strict syntax
+  bool batch_events = 0;     // Determines whether event loops call each object's handlers directly, a run of same-object instances at a time
   COMPLIANCE_LVL compliance_mode = COMPL_STANDARD;
   std::string keyword_blacklist = "";
+  std::string parallel_step_objects = "";
+  int residency_budget_mb = 0;
+  bool preload_resources = 0;
 }
 
 CompilerInfo compilerInfo;
@@ -69,8 +69,12 @@ namespace setting
   extern bool literal_autocast; // Determines how literals are treated.                 0 = enigma::variant,   1 = C++ scalars
   extern bool inherit_objects;  // Determines whether objects should automatically inherit locals and events from their parents
   extern bool automatic_semicolons; // Determines whether semicolons should automatically be added or if the user wants strict syntax
+  extern bool batch_events;     // Determines whether event loops call each object's handlers directly, a run of same-object instances at a time
   extern COMPLIANCE_LVL compliance_mode; // How to resolve differences between GM versions.
   extern std::string keyword_blacklist; //Words to blacklist from user scripts, separated by commas.
+  extern std::string parallel_step_objects; //Objects whose step events may run on the thread pool, separated by commas.
+  extern int residency_budget_mb; //Megabytes of sprite and background textures a game may hold before evicting unused ones; 0 for no limit.
+  extern bool preload_resources; //Whether games unpack every sprite and background at startup rather than on first use.
 }
 
 struct CompilerInfo {
@@ -28,9 +28,14 @@
 #ifndef ENIGMA_SYNCHECK_H
 #define ENIGMA_SYNCHECK_H
 
+#include <map>
+
 namespace syncheck
 {
-  extern string syerr;
+  extern thread_local string syerr; // The error from the last syntaxcheck on this thread
+  // Functions the last syntaxcheck on this thread found unknown or misused, and how;
+  // only filled when building with WRITE_UNIMPLEMENTED_TXT
+  extern thread_local std::map<string, char> unimplemented;
   int syntaxcheck(string code, string& newcode);
   void addscr(string name);
 }
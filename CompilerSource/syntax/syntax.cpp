@@ -39,9 +39,6 @@
 #include "parser/object_storage.h"
 
 #include "../OS_Switchboard.h"
-#ifdef WRITE_UNIMPLEMENTED_TXT
-extern std::map <string, char> unimplemented_function_list;
-#endif
 
 #include <API/context.h>
 #include <System/macros.h>
@@ -55,7 +52,8 @@ using namespace std;
 extern string tostring(int);
 
 namespace {
-  std::set<std::string> blacklist;
+  // Per thread, like the rest of the checker's state, so scripts can be checked in parallel.
+  thread_local std::set<std::string> blacklist;
 }
 
 namespace syncheck
@@ -171,8 +169,9 @@ namespace syncheck
     }
   };
 
-  string syerr;
-  vector<token> lex;
+  thread_local string syerr;
+  thread_local std::map<string, char> unimplemented;
+  thread_local vector<token> lex;
 
   struct open_parenth_info {
     unsigned ind;
@@ -210,6 +209,7 @@ namespace syncheck
   int syntaxcheck(string code, string& newcode)
   {
     syerr = "No error";
+    unimplemented.clear();
     if (code.empty()) {
       newcode = code;
       return -1;
@@ -607,7 +607,6 @@ namespace syncheck
     }
 
     for (size_t i = 1; i < lex.size()-1; i++) {
-      cout << lex[i].content << " ";
       switch (lex[i].type)
       {
         case TT_VARNAME:
@@ -619,7 +618,7 @@ namespace syncheck
               syerr += ": use semicolon to separate object ID and variable name.";
             return lex[i].pos;
             #else
-             unimplemented_function_list[lex[i].content] = 'U';
+             unimplemented[lex[i].content] = 'U';
             #endif
           }
           break;
@@ -664,9 +663,9 @@ namespace syncheck
 
             #else
                  if (!lex[i].ext->refstack.is_varargs() && (exceeded_at || params > maxarg))
-                          unimplemented_function_list[lex[i].content] = 'M'; //M for too many arguments
+                          unimplemented[lex[i].content] = 'M'; //M for too many arguments
                  if (params < minarg)
-                          unimplemented_function_list[lex[i].content] = 'F'; //F for too few arguments
+                          unimplemented[lex[i].content] = 'F'; //F for too few arguments
             #endif
           }
           break;
@@ -23,6 +23,7 @@
 #include "Universal_System/collisions_object.h"
 #include "Universal_System/instance_system.h" //iter
 #include "Universal_System/instance.h"
+#include "Collision_Systems/General/collision_grid.h"
 
 #include "BBOXutil.h"
 #include "BBOXimpl.h"
@@ -79,9 +80,10 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
 
     get_border(&left1, &right1, &top1, &bottom1, box.left, box.top, box.right, box.bottom, x, y, xscale1, yscale1, ia1);
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, left1, top1, right1, bottom1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst2 = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst2 = candidates[i];
         if (notme && inst2->id == inst1->id)
             continue;
         if (solid_only && !inst2->solid)
@@ -115,9 +117,10 @@ enigma::object_collisions* const collide_inst_rect(int object, bool solid_only,
         y1 = y3;
     }
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, x1, y1, x2, y2);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -144,9 +147,10 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
     if (x1 == x2 && y1 == y2)
         return collide_inst_point(object, solid_only, notme, x1, y1);
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2));
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -202,9 +206,10 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
 
 enigma::object_collisions* const collide_inst_point(int object, bool solid_only, bool notme, int x1, int y1)
 {
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, x1, y1, x1, y1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -249,9 +254,10 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
     if (fzero(rx) || fzero(ry))
         return 0;
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, int(x1 - fabs(rx)) - 1, int(y1 - fabs(ry)) - 1, int(x1 + fabs(rx)) + 1, int(y1 + fabs(ry)) + 1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -281,9 +287,13 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
 
 void destroy_inst_point(int object, bool solid_only, int x1, int y1)
 {
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    // Destroy events may run queries of their own, so walk a copy.
+    const std::vector<enigma::object_collisions*> candidates = enigma::collision_grid_query(object, x1, y1, x1, y1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
+        if (enigma::fetch_instance_by_id(inst->id) != inst) // Destroyed or deactivated by an earlier event
+            continue;
         if (solid_only && !inst->solid)
             continue;
         if (inst->sprite_index == -1 && inst->mask_index == -1) //no sprite/mask then no collision
@@ -0,0 +1,304 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "collision_grid.h"
+#include "Collision_Systems/collision_mandatory.h"
+#include "Universal_System/instance_system.h" //iter
+#include "Universal_System/parallel_events.h"
+
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <floatcomp.h>
+
+namespace {
+
+using enigma::object_collisions;
+using enigma::collision_grid_node;
+
+// Cells are 64x64 pixels; most sprites span one to four of them.
+const int cell_shift = 6;
+// Instances spanning more cells than this are checked by every query instead.
+const int large_cell_count = 64;
+// Lists this short are cheaper to walk than to look up in the grid.
+const size_t linear_threshold = 16;
+// Keeps cell coordinates within the range of the packed key.
+const double coord_limit = 1e9;
+
+enum {
+  node_unlinked = 0, // Not in the instance list
+  node_unbinned,     // Linked, but without a sprite or mask to collide with
+  node_binned,       // Stored in every cell from left..right, top..bottom
+  node_large         // Stored in large_list
+};
+
+typedef std::vector<object_collisions*> inst_list;
+std::unordered_map<unsigned long long, inst_list> cells;
+inst_list large_list;
+inst_list dirty_list;
+std::vector<enigma::object_basic*> event_stack;
+inst_list results;
+
+bool all_dirty = false;
+unsigned long link_seq = 0;
+unsigned query_stamp = 0;
+
+inline unsigned long long cell_key(int cx, int cy) {
+  return ((unsigned long long)(unsigned)cx << 32) | (unsigned)cy;
+}
+
+inline int cell_of(double v) {
+  if (v < -coord_limit) v = -coord_limit;
+  else if (v > coord_limit) v = coord_limit;
+  return int(std::floor(v)) >> cell_shift;
+}
+
+inline collision_grid_node &node_of(enigma::object_basic* inst) {
+  return ((object_collisions*) inst)->$grid;
+}
+
+void remove_from(inst_list &list, object_collisions* inst) {
+  for (size_t i = 0; i < list.size(); ++i) {
+    if (list[i] == inst) {
+      list[i] = list.back();
+      list.pop_back();
+      return;
+    }
+  }
+}
+
+void unbin(object_collisions* inst) {
+  collision_grid_node &node = inst->$grid;
+  if (node.state == node_binned) {
+    for (int cy = node.top; cy <= node.bottom; ++cy) {
+      for (int cx = node.left; cx <= node.right; ++cx) {
+        std::unordered_map<unsigned long long, inst_list>::iterator c = cells.find(cell_key(cx, cy));
+        if (c == cells.end()) continue;
+        remove_from(c->second, inst);
+        if (c->second.empty()) cells.erase(c);
+      }
+    }
+  } else if (node.state == node_large) {
+    remove_from(large_list, inst);
+  }
+  node.state = node_unbinned;
+}
+
+// Bins an instance by a box that contains its collision border at any rotation
+// the collision systems compute, padded to absorb their rounding.
+void rebin(object_collisions* inst) {
+  if (inst->sprite_index == -1 && inst->mask_index == -1) {
+    unbin(inst);
+    return;
+  }
+
+  const enigma::bbox_rect_t &box = inst->$bbox_relative();
+  const double xs = inst->image_xscale, ys = inst->image_yscale;
+  const double l = box.left*xs, r = (box.right + 1)*xs - 1,
+               t = box.top*ys,  b = (box.bottom + 1)*ys - 1;
+  double x1, y1, x2, y2;
+  if (fzero(inst->image_angle)) {
+    x1 = std::min(l, r), x2 = std::max(l, r);
+    y1 = std::min(t, b), y2 = std::max(t, b);
+  } else {
+    const double rad = std::sqrt(std::max(std::max(l*l, r*r) + std::max(t*t, b*b), 0.0));
+    x1 = y1 = -rad, x2 = y2 = rad;
+  }
+
+  const int left   = cell_of(inst->x + x1 - 2), right  = cell_of(inst->x + x2 + 2),
+            top    = cell_of(inst->y + y1 - 2), bottom = cell_of(inst->y + y2 + 2);
+
+  collision_grid_node &node = inst->$grid;
+  if (double(right - left + 1) * double(bottom - top + 1) > large_cell_count) {
+    if (node.state == node_large) return;
+    unbin(inst);
+    large_list.push_back(inst);
+    node.state = node_large;
+    return;
+  }
+
+  if (node.state == node_binned && node.left == left && node.right == right
+      && node.top == top && node.bottom == bottom) {
+    return;
+  }
+
+  unbin(inst);
+  for (int cy = top; cy <= bottom; ++cy) {
+    for (int cx = left; cx <= right; ++cx) {
+      cells[cell_key(cx, cy)].push_back(inst);
+    }
+  }
+  node.left = left, node.right = right, node.top = top, node.bottom = bottom;
+  node.state = node_binned;
+}
+
+// Rebins everything that may have moved since the last query.
+void sync() {
+  if (all_dirty) {
+    all_dirty = false;
+    for (enigma::iterator it = enigma::instance_list_first(); it; ++it) {
+      enigma::collision_grid_touch(*it);
+    }
+  }
+  for (size_t i = 0; i < event_stack.size(); ++i) {
+    enigma::collision_grid_touch(event_stack[i]);
+  }
+  if (enigma::instance_event_iterator && enigma::instance_event_iterator->inst) {
+    enigma::collision_grid_touch(enigma::instance_event_iterator->inst);
+  }
+
+  for (size_t i = 0; i < dirty_list.size(); ++i) {
+    object_collisions* const inst = dirty_list[i];
+    inst->$grid.dirty = false;
+    if (inst->$grid.state != node_unlinked) {
+      rebin(inst);
+    }
+  }
+  dirty_list.clear();
+}
+
+void collect_linear(int object) {
+  for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it) {
+    results.push_back((object_collisions*) *it);
+  }
+}
+
+inline void consider(object_collisions* inst, int object) {
+  collision_grid_node &node = inst->$grid;
+  if (node.stamp == query_stamp) return;
+  node.stamp = query_stamp;
+  if (object == enigma_user::all || inst->object_index == object || inst->can_cast(object)) {
+    results.push_back(inst);
+  }
+}
+
+bool by_id(const object_collisions* a, const object_collisions* b) {
+  return a->id < b->id;
+}
+bool by_link_order(const object_collisions* a, const object_collisions* b) {
+  return a->$grid.seq < b->$grid.seq;
+}
+
+}  // namespace
+
+namespace enigma
+{
+  extern size_t object_idmax;
+
+  void collision_grid_link(object_basic* inst) {
+    collision_grid_node &node = node_of(inst);
+    node.state = node_unbinned;
+    node.seq = ++link_seq;
+    collision_grid_touch(inst);
+  }
+
+  void collision_grid_unlink(object_basic* inst) {
+    object_collisions* const oc = (object_collisions*) inst;
+    unbin(oc);
+    oc->$grid.state = node_unlinked;
+  }
+
+  void collision_grid_touch(object_basic* inst) {
+    // Parallel events touch their instances once the phase is over.
+    if (parallel_phase) return;
+    collision_grid_node &node = node_of(inst);
+    if (node.dirty || node.state == node_unlinked) return;
+    node.dirty = true;
+    dirty_list.push_back((object_collisions*) inst);
+  }
+
+  void collision_grid_invalidate() {
+    all_dirty = true;
+  }
+
+  void collision_grid_purge() {
+    size_t kept = 0;
+    for (size_t i = 0; i < dirty_list.size(); ++i) {
+      if (dirty_list[i]->$grid.state == node_unlinked) {
+        dirty_list[i]->$grid.dirty = false;
+      } else {
+        dirty_list[kept++] = dirty_list[i];
+      }
+    }
+    dirty_list.resize(kept);
+  }
+
+  void collision_grid_push(object_basic* inst) {
+    if (parallel_phase) return;
+    event_stack.push_back(inst);
+  }
+
+  void collision_grid_pop(object_basic* inst) {
+    if (parallel_phase) return;
+    event_stack.pop_back();
+    collision_grid_touch(inst);
+  }
+
+  const std::vector<object_collisions*>& collision_grid_query(int object, int left, int top, int right, int bottom)
+  {
+    results.clear();
+
+    // Keywords and instance ids name at most one instance; short lists are
+    // cheaper to walk than to look up.
+    size_t listed;
+    if (object == enigma_user::all) {
+      listed = enigma_user::instance_count;
+    } else if (object >= 0 && size_t(object) < object_idmax) {
+      listed = objects[object].count;
+    } else {
+      collect_linear(object);
+      return results;
+    }
+    if (listed <= linear_threshold) {
+      collect_linear(object);
+      return results;
+    }
+
+    const int cl = cell_of(left - 1), cr = cell_of(right + 1),
+              ct = cell_of(top - 1),  cb = cell_of(bottom + 1);
+    if (double(cr - cl + 1) * double(cb - ct + 1) > double(listed)) {
+      collect_linear(object);
+      return results;
+    }
+
+    sync();
+    if (++query_stamp == 0) {
+      // The stamp wrapped; clear it everywhere so stale stamps can't match.
+      for (enigma::iterator it = enigma::instance_list_first(); it; ++it) {
+        node_of(*it).stamp = 0;
+      }
+      query_stamp = 1;
+    }
+
+    for (int cy = ct; cy <= cb; ++cy) {
+      for (int cx = cl; cx <= cr; ++cx) {
+        std::unordered_map<unsigned long long, inst_list>::const_iterator c = cells.find(cell_key(cx, cy));
+        if (c == cells.end()) continue;
+        for (size_t i = 0; i < c->second.size(); ++i) {
+          consider(c->second[i], object);
+        }
+      }
+    }
+    for (size_t i = 0; i < large_list.size(); ++i) {
+      consider(large_list[i], object);
+    }
+
+    // The instance list is ordered by id; object lists by the order instances joined them.
+    std::sort(results.begin(), results.end(), object == enigma_user::all ? by_id : by_link_order);
+    return results;
+  }
+}
@@ -0,0 +1,44 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+////////////////////////////////////
+// Broad phase shared by the collision systems: a uniform spatial hash over the
+// bounding boxes of all linked instances. Instances are rebinned lazily; the
+// hooks declared in collision_mandatory.h tell the grid who may have moved.
+////////////////////////////////////
+
+#ifndef ENIGMA_COLLISION_GRID_H
+#define ENIGMA_COLLISION_GRID_H
+
+#include "Universal_System/collisions_object.h"
+
+#include <vector>
+
+namespace enigma
+{
+  // Returns every instance matching `object` whose bounding box may touch the
+  // given rectangle (inclusive, in room pixels), in the same order in which
+  // fetch_inst_iter_by_int(object) would visit them. Instances without a sprite
+  // or mask may be omitted. The result is only a candidate list; callers still
+  // run their narrow phase on each instance.
+  //
+  // The returned vector is reused by the next query. Callers that may run
+  // events while walking it (and so may query again) must copy it first.
+  const std::vector<object_collisions*>& collision_grid_query(int object, int left, int top, int right, int bottom);
+}
+
+#endif //ENIGMA_COLLISION_GRID_H
@@ -27,4 +27,13 @@ namespace enigma
   void free_collision_mask(void* mask)
   {
   }
+
+  // There is no broad phase to maintain without a collision system.
+  void collision_grid_link(object_basic* inst) {}
+  void collision_grid_unlink(object_basic* inst) {}
+  void collision_grid_touch(object_basic* inst) {}
+  void collision_grid_invalidate() {}
+  void collision_grid_purge() {}
+  void collision_grid_push(object_basic* inst) {}
+  void collision_grid_pop(object_basic* inst) {}
 };
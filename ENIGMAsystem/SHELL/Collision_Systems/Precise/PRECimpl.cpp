@@ -24,9 +24,11 @@
 #include "Universal_System/collisions_object.h"
 #include "Universal_System/instance_system.h" //iter
 #include "Universal_System/instance.h"
+#include "Collision_Systems/General/collision_grid.h"
 #include "Universal_System/math_consts.h"
 
 #include "PRECimpl.h"
+#include "PRECmask.h"
 #include <cmath>
 #include <utility>
 
@@ -64,25 +66,106 @@ static inline double min(double x, double y) { return x<y? x : y; }
 static inline int max(int x, int y) { return x>y? x : y; }
 static inline double max(double x, double y) { return x>y? x : y; }
 
+// An untransformed instance (unrotated, unit scale) maps room pixels to mask
+// pixels by a plain offset, so whole rows can be tested 64 pixels at a time.
+// The per-pixel code truncates the distance from the instance toward zero, so
+// at a fractional position the offset differs on either side of the instance;
+// this keeps both, so the row test samples exactly the pixels it would.
+struct mask_axis
+{
+    int split;         // First room pixel at or past the instance position
+    int before, after; // Room pixel minus mask pixel, before and from split
+
+    mask_axis(double pos, int offset):
+        split((int)ceil(pos)), before((int)floor(pos) - offset), after((int)ceil(pos) - offset) {}
+
+    int origin(int p) const { return p < split ? before : after; }
+    // The last pixel, no further than `last`, with the same origin as `p`.
+    int run_end(int p, int last) const { return (p < split && split - 1 < last) ? split - 1 : last; }
+};
+
+// A sprite first used during a parallel phase has no masks yet; it is tested
+// by its bounding box until the next phase loads it.
+static inline const enigma::precise_mask* get_mask(const enigma::sprite* spr, int usi) {
+  return size_t(usi) < spr->colldata.size() ? (const enigma::precise_mask*) spr->colldata[usi] : 0;
+}
+
+static inline bool untransformed(double xscale, double yscale, double angle) {
+    return xscale == 1.0 && yscale == 1.0 && angle == 0.0;
+}
+
+static inline uint64_t low_bits(int n) {
+    return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+static bool precise_collision_single_aligned(int intersection_left, int intersection_right, int intersection_top, int intersection_bottom,
+                                const mask_axis &ax1, const mask_axis &ay1,
+                                const enigma::precise_mask* mask1)
+{
+    for (int rowindex = intersection_top; rowindex <= intersection_bottom; rowindex++)
+    {
+        const int my1 = rowindex - ay1.origin(rowindex);
+        if (my1 < 0 || my1 >= mask1->height)
+            continue;
+
+        for (int colindex = intersection_left; colindex <= intersection_right; )
+        {
+            const int end = min(ax1.run_end(colindex, intersection_right), colindex + 63);
+            const uint64_t row1 = mask1->row_bits(my1, colindex - ax1.origin(colindex));
+            if (row1 & low_bits(end - colindex + 1)) {
+                return true;
+            }
+            colindex = end + 1;
+        }
+    }
+    return false;
+}
+
+static bool precise_collision_pair_aligned(int intersection_left, int intersection_right, int intersection_top, int intersection_bottom,
+                                const mask_axis &ax1, const mask_axis &ay1, const mask_axis &ax2, const mask_axis &ay2,
+                                const enigma::precise_mask* mask1, const enigma::precise_mask* mask2)
+{
+    for (int rowindex = intersection_top; rowindex <= intersection_bottom; rowindex++)
+    {
+        const int my1 = rowindex - ay1.origin(rowindex), my2 = rowindex - ay2.origin(rowindex);
+        if (my1 < 0 || my1 >= mask1->height || my2 < 0 || my2 >= mask2->height)
+            continue;
+
+        for (int colindex = intersection_left; colindex <= intersection_right; )
+        {
+            const int end = min(min(ax1.run_end(colindex, intersection_right), ax2.run_end(colindex, intersection_right)), colindex + 63);
+            const uint64_t row1 = mask1->row_bits(my1, colindex - ax1.origin(colindex));
+            const uint64_t row2 = mask2->row_bits(my2, colindex - ax2.origin(colindex));
+            if (row1 & row2 & low_bits(end - colindex + 1)) {
+                return true;
+            }
+            colindex = end + 1;
+        }
+    }
+    return false;
+}
+
 static bool precise_collision_single(int intersection_left, int intersection_right, int intersection_top, int intersection_bottom,
                                 double x1, double y1,
                                 double xscale1, double yscale1,
                                 double ia1,
-                                unsigned char* pixels1,
+                                const enigma::precise_mask* mask1,
                                 int w1, int h1,
                                 int xoffset1, int yoffset1)
 {
+    if (untransformed(xscale1, yscale1, ia1)) {
+        return precise_collision_single_aligned(intersection_left, intersection_right, intersection_top, intersection_bottom,
+                                                mask_axis(x1, xoffset1), mask_axis(y1, yoffset1), mask1);
+    }
 
     if (xscale1 != 0.0 && yscale1 != 0.0) {
 
-        const double pi_half = M_PI/2.0;
-
         const double arad1 = ia1*M_PI/180.0;
 
         const double cosa1 = cos(-arad1);
         const double sina1 = sin(-arad1);
-        const double cosa90_1 = cos(-arad1 + pi_half);
-        const double sina90_1 = sin(-arad1 + pi_half);
+        const double cosa90_1 = -sina1; // cos(-arad1 + pi/2), exact at 0
+        const double sina90_1 = cosa1;  // sin(-arad1 + pi/2)
 
         for (int rowindex = intersection_top; rowindex <= intersection_bottom; rowindex++)
         {
@@ -94,7 +177,7 @@ static bool precise_collision_single(int intersection_left, int intersection_rig
                 const int by1 = (rowindex - y1);
                 const int px1 = (int)((bx1*cosa1 + by1*sina1)/xscale1 + xoffset1);
                 const int py1 = (int)((bx1*cosa90_1 + by1*sina90_1)/yscale1 + yoffset1);
-                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && pixels1[py1*w1 + px1] != 0;
+                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && mask1->get(px1, py1);
 
                 if (p1) {
                     return true;
@@ -109,27 +192,31 @@ static bool precise_collision_pair(int intersection_left, int intersection_right
                                 double x1, double y1, double x2, double y2,
                                 double xscale1, double yscale1, double xscale2, double yscale2,
                                 double ia1, double ia2,
-                                unsigned char* pixels1, unsigned char* pixels2,
+                                const enigma::precise_mask* mask1, const enigma::precise_mask* mask2,
                                 int w1, int h1, int w2, int h2,
                                 int xoffset1, int yoffset1, int xoffset2, int yoffset2)
 {
+    if (untransformed(xscale1, yscale1, ia1) && untransformed(xscale2, yscale2, ia2)) {
+        return precise_collision_pair_aligned(intersection_left, intersection_right, intersection_top, intersection_bottom,
+                                              mask_axis(x1, xoffset1), mask_axis(y1, yoffset1),
+                                              mask_axis(x2, xoffset2), mask_axis(y2, yoffset2),
+                                              mask1, mask2);
+    }
 
     if (xscale1 != 0.0 && yscale1 != 0.0 && xscale2 != 0.0 && yscale2 != 0.0) {
 
-        const double pi_half = M_PI/2.0;
-
         const double arad1 = ia1*M_PI/180.0;
         const double arad2 = ia2*M_PI/180.0;
 
         const double cosa1 = cos(-arad1);
         const double sina1 = sin(-arad1);
-        const double cosa90_1 = cos(-arad1 + pi_half);
-        const double sina90_1 = sin(-arad1 + pi_half);
+        const double cosa90_1 = -sina1; // cos(-arad1 + pi/2), exact at 0
+        const double sina90_1 = cosa1;  // sin(-arad1 + pi/2)
 
         const double cosa2 = cos(-arad2);
         const double sina2 = sin(-arad2);
-        const double cosa90_2 = cos(-arad2 + pi_half);
-        const double sina90_2 = sin(-arad2 + pi_half);
+        const double cosa90_2 = -sina2; // cos(-arad2 + pi/2), exact at 0
+        const double sina90_2 = cosa2;  // sin(-arad2 + pi/2)
 
         for (int rowindex = intersection_top; rowindex <= intersection_bottom; rowindex++)
         {
@@ -141,14 +228,14 @@ static bool precise_collision_pair(int intersection_left, int intersection_right
                 const int by1 = (rowindex - y1);
                 const int px1 = (int)((bx1*cosa1 + by1*sina1)/xscale1 + xoffset1);
                 const int py1 = (int)((bx1*cosa90_1 + by1*sina90_1)/yscale1 + yoffset1);
-                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && pixels1[py1*w1 + px1] != 0;
+                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && mask1->get(px1, py1);
 
                 //Test for second image.
                 const int bx2 = (colindex - x2);
                 const int by2 = (rowindex - y2);
                 const int px2 = (int)((bx2*cosa2 + by2*sina2)/xscale2 + xoffset2);
                 const int py2 = (int)((bx2*cosa90_2 + by2*sina90_2)/yscale2 + yoffset2);
-                const bool p2 = px2 >= 0 && py2 >= 0 && px2 < w2 && py2 < h2 && pixels2[py2*w2 + px2] != 0;
+                const bool p2 = px2 >= 0 && py2 >= 0 && px2 < w2 && py2 < h2 && mask2->get(px2, py2);
 
                 //Final test.
                 if (p1 && p2) {
@@ -165,21 +252,19 @@ static bool precise_collision_line(int intersection_left, int intersection_right
                                 double x1, double y1,
                                 double xscale1, double yscale1,
                                 double ia1,
-                                unsigned char* pixels1,
+                                const enigma::precise_mask* mask1,
                                 int w1, int h1,
                                 int xoffset1, int yoffset1,
                                 int lx1, int ly1, int lx2, int ly2)
 {
     if (xscale1 != 0.0 && yscale1 != 0.0) {
 
-        const double pi_half = M_PI/2.0;
-
         const double arad1 = ia1*M_PI/180.0;
 
         const double cosa1 = cos(-arad1);
         const double sina1 = sin(-arad1);
-        const double cosa90_1 = cos(-arad1 + pi_half);
-        const double sina90_1 = sin(-arad1 + pi_half);
+        const double cosa90_1 = -sina1; // cos(-arad1 + pi/2), exact at 0
+        const double sina90_1 = cosa1;  // sin(-arad1 + pi/2)
 
         if (lx1 != lx2 && abs(lx1-lx2) >= abs(ly1-ly2)) { // The slope is defined and in [-1;1].
             const int minX = max(min(lx1, lx2), intersection_left),
@@ -197,7 +282,7 @@ static bool precise_collision_line(int intersection_left, int intersection_right
                 const int by1 = (gy - y1);
                 const int px1 = (int)((bx1*cosa1 + by1*sina1)/xscale1 + xoffset1);
                 const int py1 = (int)((bx1*cosa90_1 + by1*sina90_1)/yscale1 + yoffset1);
-                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && pixels1[py1*w1 + px1] != 0;
+                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && mask1->get(px1, py1);
 
                 if (p1) {
                     return true;
@@ -220,7 +305,7 @@ static bool precise_collision_line(int intersection_left, int intersection_right
                 const int by1 = (gy - y1);
                 const int px1 = (int)((bx1*cosa1 + by1*sina1)/xscale1 + xoffset1);
                 const int py1 = (int)((bx1*cosa90_1 + by1*sina90_1)/yscale1 + yoffset1);
-                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && pixels1[py1*w1 + px1] != 0;
+                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && mask1->get(px1, py1);
 
                 if (p1) {
                     return true;
@@ -236,7 +321,7 @@ static bool precise_collision_ellipse(int intersection_left, int intersection_ri
                                 double x1, double y1,
                                 double xscale1, double yscale1,
                                 double ia1,
-                                unsigned char* pixels1,
+                                const enigma::precise_mask* mask1,
                                 int w1, int h1,
                                 int xoffset1, int yoffset1,
                                 int ex, int ey, int rx, int ry)
@@ -244,14 +329,12 @@ static bool precise_collision_ellipse(int intersection_left, int intersection_ri
 
     if (xscale1 != 0.0 && yscale1 != 0.0) {
 
-        const double pi_half = M_PI/2.0;
-
         const double arad1 = ia1*M_PI/180.0;
 
         const double cosa1 = cos(-arad1);
         const double sina1 = sin(-arad1);
-        const double cosa90_1 = cos(-arad1 + pi_half);
-        const double sina90_1 = sin(-arad1 + pi_half);
+        const double cosa90_1 = -sina1; // cos(-arad1 + pi/2), exact at 0
+        const double sina90_1 = cosa1;  // sin(-arad1 + pi/2)
 
         const double rx_2 = rx*rx, ry_2 = ry*ry;
 
@@ -268,7 +351,7 @@ static bool precise_collision_ellipse(int intersection_left, int intersection_ri
                 const int by1 = (rowindex - y1);
                 const int px1 = (int)((bx1*cosa1 + by1*sina1)/xscale1 + xoffset1);
                 const int py1 = (int)((bx1*cosa90_1 + by1*sina90_1)/yscale1 + yoffset1);
-                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && pixels1[py1*w1 + px1] != 0;
+                const bool p1 = px1 >= 0 && py1 >= 0 && px1 < w1 && py1 < h1 && mask1->get(px1, py1);
 
                 if (p1) {
                     return true;
@@ -295,9 +378,10 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
 
     get_border(&left1, &right1, &top1, &bottom1, box.left, box.top, box.right, box.bottom, x, y, xscale1, yscale1, ia1);
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, left1, top1, right1, bottom1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst2 = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst2 = candidates[i];
         if (notme && inst2->id == inst1->id)
             continue;
         if (solid_only && !inst2->solid)
@@ -318,16 +402,16 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
             const int collsprite_index1 = inst1->mask_index != -1 ? inst1->mask_index : inst1->sprite_index;
             const int collsprite_index2 = inst2->mask_index != -1 ? inst2->mask_index : inst2->sprite_index;
 
-            enigma::sprite* sprite1 = enigma::spritestructarray[collsprite_index1];
-            enigma::sprite* sprite2 = enigma::spritestructarray[collsprite_index2];
+            enigma::sprite* sprite1 = enigma::sprite_get_resident(collsprite_index1);
+            enigma::sprite* sprite2 = enigma::sprite_get_resident(collsprite_index2);
 
             const int usi1 = ((int) inst1->image_index) % sprite1->subcount;
             const int usi2 = ((int) inst2->image_index) % sprite2->subcount;
 
-            unsigned char* pixels1 = (unsigned char*) (sprite1->colldata[usi1]);
-            unsigned char* pixels2 = (unsigned char*) (sprite2->colldata[usi2]);
+            const enigma::precise_mask* mask1 = get_mask(sprite1, usi1);
+            const enigma::precise_mask* mask2 = get_mask(sprite2, usi2);
 
-            if (pixels1 == 0 && pixels2 == 0) { //bbox vs. bbox.
+            if (mask1 == 0 && mask2 == 0) { //bbox vs. bbox.
                 return inst2;
             }
             else {
@@ -347,13 +431,13 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
                 const double xoffset2 = sprite2->xoffset;
                 const double yoffset2 = sprite2->yoffset;
 
-                if (pixels1 != 0 && pixels2 == 0) { //precise vs. bbox.
+                if (mask1 != 0 && mask2 == 0) { //precise vs. bbox.
                     const bool coll_result = precise_collision_single(
                         ins_left, ins_right, ins_top, ins_bottom,
                         x, y,
                         xscale1, yscale1,
                         ia1,
-                        pixels1,
+                        mask1,
                         w1, h1,
                         xoffset1, yoffset1
                       );
@@ -362,13 +446,13 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
                         return inst2;
                     }
                 }
-                else if (pixels1 == 0 && pixels2 != 0) { //bbox vs. precise.
+                else if (mask1 == 0 && mask2 != 0) { //bbox vs. precise.
                     const bool coll_result = precise_collision_single(
                         ins_left, ins_right, ins_top, ins_bottom,
                         x2, y2,
                         xscale2, yscale2,
                         ia2,
-                        pixels2,
+                        mask2,
                         w2, h2,
                         xoffset2, yoffset2
                     );
@@ -383,7 +467,7 @@ enigma::object_collisions* const collide_inst_inst(int object, bool solid_only,
                         x, y, x2, y2,
                         xscale1, yscale1, xscale2, yscale2,
                         ia1, ia2,
-                        pixels1, pixels2,
+                        mask1, mask2,
                         w1, h1, w2, h2,
                         xoffset1, yoffset1, xoffset2, yoffset2
                     );
@@ -406,9 +490,10 @@ enigma::object_collisions* const collide_inst_rect(int object, bool solid_only,
     if (y1 > y2)
         std::swap(y1, y2);
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, x1, y1, x2, y2);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -432,13 +517,13 @@ enigma::object_collisions* const collide_inst_rect(int object, bool solid_only,
 
             const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-            enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+            enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
             const int usi = ((int) inst->image_index) % sprite->subcount;
 
-            unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+            const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-            if (pixels == 0) { //bbox.
+            if (mask == 0) { //bbox.
                 return inst;
             }
             else { //precise.
@@ -461,7 +546,7 @@ enigma::object_collisions* const collide_inst_rect(int object, bool solid_only,
                     x, y,
                     xscale, yscale,
                     ia,
-                    pixels,
+                    mask,
                     w, h,
                     xoffset, yoffset
                 );
@@ -481,9 +566,10 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
     if (x1 == x2 && y1 == y2)
         return collide_inst_point(object, solid_only, prec, notme, x1, y1);
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2));
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -538,13 +624,13 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
             else {
                 const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-                enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+                enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
                 const int usi = ((int) inst->image_index) % sprite->subcount;
 
-                unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+                const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-                if (pixels == NULL) { // Bounding box.
+                if (mask == NULL) { // Bounding box.
                     return inst;
                 }
                 else { // Precise.
@@ -568,7 +654,7 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
                         x, y,
                         xscale, yscale,
                         ia,
-                        pixels,
+                        mask,
                         w, h,
                         xoffset, yoffset,
                         x1, y1, x2, y2
@@ -586,9 +672,10 @@ enigma::object_collisions* const collide_inst_line(int object, bool solid_only,
 
 enigma::object_collisions* const collide_inst_point(int object, bool solid_only, bool prec, bool notme, int x1, int y1)
 {
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, x1, y1, x1, y1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -612,13 +699,13 @@ enigma::object_collisions* const collide_inst_point(int object, bool solid_only,
 
             const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-            enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+            enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
             const int usi = ((int) inst->image_index) % sprite->subcount;
 
-            unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+            const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-            if (pixels == 0) { //bbox.
+            if (mask == 0) { //bbox.
                 return inst;
             }
             else { //precise.
@@ -641,7 +728,7 @@ enigma::object_collisions* const collide_inst_point(int object, bool solid_only,
                     x, y,
                     xscale, yscale,
                     ia,
-                    pixels,
+                    mask,
                     w, h,
                     xoffset, yoffset
                 );
@@ -679,9 +766,10 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
     if (rx == 0 || ry == 0)
         return 0;
 
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    const std::vector<enigma::object_collisions*> &candidates = enigma::collision_grid_query(object, int(x1 - fabs(rx)) - 1, int(y1 - fabs(ry)) - 1, int(x1 + fabs(rx)) + 1, int(y1 + fabs(ry)) + 1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
         if (notme && inst->id == enigma::instance_event_iterator->inst->id)
             continue;
         if (solid_only && !inst->solid)
@@ -710,13 +798,13 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
 
             const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-            enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+            enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
             const int usi = ((int) inst->image_index) % sprite->subcount;
 
-            unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+            const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-            if (pixels == 0) { // Bounding Box.
+            if (mask == 0) { // Bounding Box.
                 return inst;
             }
             else { // Precise.
@@ -739,7 +827,7 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
                     x, y,
                     xscale, yscale,
                     ia,
-                    pixels,
+                    mask,
                     w, h,
                     xoffset, yoffset,
                     x1, y1, rx, ry
@@ -756,9 +844,13 @@ enigma::object_collisions* const collide_inst_ellipse(int object, bool solid_onl
 
 void destroy_inst_point(int object, bool solid_only, int x1, int y1)
 {
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(object); it; ++it)
+    // Destroy events may run queries of their own, so walk a copy.
+    const std::vector<enigma::object_collisions*> candidates = enigma::collision_grid_query(object, x1, y1, x1, y1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
+        if (enigma::fetch_instance_by_id(inst->id) != inst) // Destroyed or deactivated by an earlier event
+            continue;
         if (solid_only && !inst->solid)
             continue;
         if (inst->sprite_index == -1 && inst->mask_index == -1) //no sprite/mask then no collision
@@ -775,13 +867,13 @@ void destroy_inst_point(int object, bool solid_only, int x1, int y1)
 
             const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-            enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+            enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
             const int usi = ((int) inst->image_index) % sprite->subcount;
 
-            unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+            const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-            if (pixels == 0) { //bbox.
+            if (mask == 0) { //bbox.
                 enigma_user::instance_destroy(inst->id);
             }
             else { //precise.
@@ -804,7 +896,7 @@ void destroy_inst_point(int object, bool solid_only, int x1, int y1)
                     x, y,
                     xscale, yscale,
                     ia,
-                    pixels,
+                    mask,
                     w, h,
                     xoffset, yoffset
                 );
@@ -819,9 +911,13 @@ void destroy_inst_point(int object, bool solid_only, int x1, int y1)
 
 void change_inst_point(int obj, bool perf, int x1, int y1)
 {
-    for (enigma::iterator it = enigma::fetch_inst_iter_by_int(enigma_user::all); it; ++it)
+    // Create and destroy events may run queries of their own, so walk a copy.
+    const std::vector<enigma::object_collisions*> candidates = enigma::collision_grid_query(enigma_user::all, x1, y1, x1, y1);
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        enigma::object_collisions* const inst = (enigma::object_collisions*)*it;
+        enigma::object_collisions* const inst = candidates[i];
+        if (enigma::fetch_instance_by_id(inst->id) != inst) // Destroyed or deactivated by an earlier event
+            continue;
         if (inst->sprite_index == -1 && inst->mask_index == -1) //no sprite/mask then no collision
             continue;
 
@@ -836,13 +932,13 @@ void change_inst_point(int obj, bool perf, int x1, int y1)
 
             const int collsprite_index = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
 
-            enigma::sprite* sprite = enigma::spritestructarray[collsprite_index];
+            enigma::sprite* sprite = enigma::sprite_get_resident(collsprite_index);
 
             const int usi = ((int) inst->image_index) % sprite->subcount;
 
-            unsigned char* pixels = (unsigned char*) (sprite->colldata[usi]);
+            const enigma::precise_mask* mask = get_mask(sprite, usi);
 
-            if (pixels == 0) { //bbox.
+            if (mask == 0) { //bbox.
                 enigma::instance_change_inst(obj, perf, inst);
             }
             else { //precise.
@@ -865,7 +961,7 @@ void change_inst_point(int obj, bool perf, int x1, int y1)
                     x, y,
                     xscale, yscale,
                     ia,
-                    pixels,
+                    mask,
                     w, h,
                     xoffset, yoffset
                 );
@@ -0,0 +1,66 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_PRECMASK_H
+#define ENIGMA_PRECMASK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace enigma
+{
+  // A precise collision mask: one bit per pixel, least significant bit first,
+  // each row padded with zeros to a whole number of 64-bit words.
+  struct precise_mask
+  {
+    int width, height;
+    int row_words;
+    uint64_t* bits;
+
+    // The size is worked out in size_t, so no product of the dimensions can
+    // wrap around into a bogus allocation.
+    precise_mask(unsigned w, unsigned h): width(w), height(h), row_words((w + 63) / 64),
+        bits(new uint64_t[(size_t(w) + 63) / 64 * size_t(h)]()) {}
+    ~precise_mask() { delete[] bits; }
+
+    bool get(int x, int y) const {
+      return (bits[y*row_words + (x >> 6)] >> (x & 63)) & 1;
+    }
+    void set(int x, int y) {
+      bits[y*row_words + (x >> 6)] |= uint64_t(1) << (x & 63);
+    }
+
+    // Returns the 64 pixels of row y starting at column x, column x in the
+    // lowest bit. Columns outside the mask read as empty; y must be in range.
+    uint64_t row_bits(int y, int x) const {
+      const uint64_t* const row = bits + y*row_words;
+      const int word = x >> 6, shift = x & 63;
+      uint64_t result = 0;
+      if (word >= 0 && word < row_words)
+        result = row[word] >> shift;
+      if (shift && word + 1 >= 0 && word + 1 < row_words)
+        result |= row[word + 1] << (64 - shift);
+      return result;
+    }
+
+   private:
+    precise_mask(const precise_mask&);
+    precise_mask& operator=(const precise_mask&);
+  };
+}
+
+#endif //ENIGMA_PRECMASK_H
@@ -17,6 +17,7 @@
 
 #include "Collision_Systems/collision_mandatory.h"
 #include "Universal_System/nlpo2.h"
+#include "PRECmask.h"
 
 #include <iostream>
 
@@ -27,7 +28,19 @@ static inline int max(int x, int y) { return x>y? x : y; }
 
 namespace enigma
 {
-  // A non-NULL pointer is a sprite mask, a NULL pointer means bbox should be used.
+  // Packs a mask of one byte per pixel into a precise_mask and frees the bytes.
+  static precise_mask* pack_mask(unsigned w, unsigned h, unsigned char* colldata)
+  {
+    precise_mask* mask = new precise_mask(w, h);
+    for (unsigned y = 0; y < h; y++)
+      for (unsigned x = 0; x < w; x++)
+        if (colldata[y*w + x])
+          mask->set(x, y);
+    delete[] colldata;
+    return mask;
+  }
+
+  // A non-NULL pointer is a precise_mask, a NULL pointer means bbox should be used.
   void *get_collision_mask(sprite* spr, unsigned char* input_data, collision_type ct) // It is called for every subimage of every sprite loaded.
   {
     switch (ct)
@@ -45,7 +58,7 @@ namespace enigma
             }
           }
 
-          return colldata;
+          return pack_mask(w, h, colldata);
         }
       case ct_bbox: return 0;
       case ct_ellipse:
@@ -76,7 +89,7 @@ namespace enigma
             }
           }
 
-          return colldata;
+          return pack_mask(w, h, colldata);
         }
       case ct_diamond:
         {
@@ -114,7 +127,7 @@ namespace enigma
             }
           }
 
-          return colldata;
+          return pack_mask(w, h, colldata);
         }
       case ct_polygon: return 0;
       case ct_circle: //NOTE: Not tested.
@@ -144,7 +157,7 @@ namespace enigma
             }
           }
 
-          return colldata;
+          return pack_mask(w, h, colldata);
         }
       default: return 0;
     };
@@ -152,9 +165,7 @@ namespace enigma
 
   void free_collision_mask(void* mask)
   {
-    if (mask != 0) {
-      delete[] (unsigned char*)mask;
-    }
+    delete (precise_mask*)mask;
   }
 };
 
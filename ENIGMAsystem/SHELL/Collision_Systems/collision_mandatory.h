@@ -15,12 +15,16 @@
 *** with this code. If not, see <http://www.gnu.org/licenses/>
 **/
 
+#ifndef ENIGMA_COLLISION_MANDATORY_H
+#define ENIGMA_COLLISION_MANDATORY_H
+
 #include "Universal_System/scalar.h"
 #include "Universal_System/sprites_internal.h"
 #include "Collision_Systems/collision_types.h"
 
 namespace enigma
 {
+  struct object_basic;
 
   // This function fetches a collision mask from the collision system for a single subimage.
   // Examples of possible collision masks include bitmasks and polygon meshes.
@@ -41,4 +45,36 @@ namespace enigma
     // an object_basic* pointing to the first instance found.
     object_basic *place_meeting_inst(cs_scalar x, cs_scalar y, int object);
   #endif
+
+  // The following functions feed the collision system's broad phase. Instance
+  // positions are plain members, so the instance system reports when an
+  // instance may have moved instead of the collision system polling for it.
+  // Systems without a broad phase implement them as no-ops.
+
+  // Called when an instance is linked into or unlinked from the instance list.
+  void collision_grid_link(object_basic* inst);
+  void collision_grid_unlink(object_basic* inst);
+
+  // Marks an instance whose position, sprite, mask or transform may have changed.
+  void collision_grid_touch(object_basic* inst);
+
+  // Marks every instance; used when sprite or mask bounds change.
+  void collision_grid_invalidate();
+
+  // Forgets unlinked instances just before they are deleted.
+  void collision_grid_purge();
+
+  // Tracks instances whose events are running, which may move them at any time.
+  void collision_grid_push(object_basic* inst);
+  void collision_grid_pop(object_basic* inst);
+
+  // Emitted at the top of each event; keeps the running instance current in the
+  // broad phase for the duration of the event and touches it on the way out.
+  struct collision_event_scope {
+    object_basic* const inst;
+    collision_event_scope(object_basic* i): inst(i) { collision_grid_push(i); }
+    ~collision_event_scope() { collision_grid_pop(inst); }
+  };
 }
+
+#endif //ENIGMA_COLLISION_MANDATORY_H
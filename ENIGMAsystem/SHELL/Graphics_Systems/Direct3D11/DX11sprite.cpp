@@ -45,24 +45,24 @@ using std::string;
     if (id < -1 or size_t(id) > enigma::sprite_idmax or !enigma::spritestructarray[id]) { \
       show_error("Cannot access sprite with id " + toString(id), false); \
       return r; \
-    } const enigma::sprite *const spr = enigma::spritestructarray[id];
+    } const enigma::sprite *const spr = enigma::sprite_get_resident(id);
   #define get_spritev(spr,id) \
     if (id < -1 or size_t(id) > enigma::sprite_idmax or !enigma::spritestructarray[id]) { \
       show_error("Cannot access sprite with id " + toString(id), false); \
       return; \
-    } const enigma::sprite *const spr = enigma::spritestructarray[id];
+    } const enigma::sprite *const spr = enigma::sprite_get_resident(id);
   #define get_sprite_null(spr,id,r) \
     if (id < -1 or size_t(id) > enigma::sprite_idmax) { \
       show_error("Cannot access sprite with id " + toString(id), false); \
       return r; \
-    } const enigma::sprite *const spr = enigma::spritestructarray[id];
+    } const enigma::sprite *const spr = enigma::sprite_get_resident(id);
 #else
   #define get_sprite(spr,id,r) \
-    const enigma::sprite *const spr = enigma::spritestructarray[id];
+    const enigma::sprite *const spr = enigma::sprite_get_resident(id);
   #define get_spritev(spr,id) \
-    const enigma::sprite *const spr = enigma::spritestructarray[id];
+    const enigma::sprite *const spr = enigma::sprite_get_resident(id);
   #define get_sprite_null(spr,id,r) \
-    const enigma::sprite *const spr = enigma::spritestructarray[id];
+    const enigma::sprite *const spr = enigma::sprite_get_resident(id);
 #endif
 
 namespace enigma_user
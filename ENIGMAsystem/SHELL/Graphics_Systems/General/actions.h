@@ -147,8 +147,7 @@ inline void action_draw_sprite(const int sprite, const gs_scalar x, const gs_sca
         draw_sprite(sprite,subimage,x,y);
 }
 
-void action_draw_health(const gs_scalar x1, const gs_scalar y1, const gs_scalar x2, const gs_scalar y2, const double backColor, const int barColor);
-void action_draw_health(const gs_scalar x1, const gs_scalar y1, const gs_scalar x2, const gs_scalar y2, const double backColor, const int barColor) {
+inline void action_draw_health(const gs_scalar x1, const gs_scalar y1, const gs_scalar x2, const gs_scalar y2, const double backColor, const int barColor) {
   double realbar1, realbar2;
   switch (barColor)
   {
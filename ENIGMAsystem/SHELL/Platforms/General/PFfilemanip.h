@@ -57,3 +57,21 @@ extern std::string program_directory;
 extern std::string temp_directory;
 
 } //namespace enigma_user
+
+namespace enigma {
+
+// A read-only view of a whole file, mapped rather than read so that large
+// files cost nothing until their pages are touched.
+struct file_mapping {
+  const unsigned char* data;
+  unsigned long long size;
+  void* handle;
+  file_mapping(): data(NULL), size(0), handle(NULL) {}
+};
+
+// Maps fname into memory; returns false, leaving map empty, if the file
+// cannot be opened. An empty file maps successfully with a NULL data pointer.
+bool file_map(std::string fname, file_mapping& map);
+void file_unmap(file_mapping& map);
+
+} //namespace enigma
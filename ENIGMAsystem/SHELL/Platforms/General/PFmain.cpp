@@ -1,7 +1,9 @@
 #include "PFmain.h"
 
 #include "Platforms/platforms_mandatory.h"
+#include "Universal_System/profiler.h"
 
+#include <cstdlib>   //getenv, atoi
 #include <unistd.h>  //getcwd, usleep
 
 namespace enigma {
@@ -14,6 +16,8 @@ std::string *parameters;
 int parameterc;
 int frames_count = 0;
 unsigned long current_time_mcs = 0;
+int headless_steps = 0;
+int headless_seed = 0;
 
 long clamp(long value, long min, long max) {
   if (value < min) return min;
@@ -38,6 +42,20 @@ int gameWait() {
 
 void set_room_speed(int rs) { current_room_speed = rs; }
 
+int updateFixedTimer() {
+  const int speed = current_room_speed > 0 ? current_room_speed : 60;
+  enigma_user::fps = speed;
+  enigma_user::delta_time = 1000000 / speed;
+  current_time_mcs += enigma_user::delta_time;
+  enigma_user::current_time += enigma_user::delta_time / 1000;
+  return 0;
+}
+
+static void read_headless_settings() {
+  if (const char* steps = getenv("ENIGMA_HEADLESS_STEPS")) headless_steps = atoi(steps);
+  if (const char* seed = getenv("ENIGMA_SEED")) headless_seed = atoi(seed);
+}
+
 unsigned long get_timer() {  // microseconds since the start of the game
   return current_time_mcs;
 }
@@ -54,6 +72,7 @@ int main(int argc, char** argv, void* windowHandle) {
 
   // Copy our parameters
   set_program_args(argc, argv);
+  read_headless_settings();
 
   initInput();
 
@@ -65,20 +84,28 @@ int main(int argc, char** argv, void* windowHandle) {
   EnableDrawing(windowHandle);
 
   // Call ENIGMA system initializers; sprites, audio, and what have you
+  profiler_initialize();
   initialize_everything();
   initTimer();
   showWindow();
 
+  int steps = 0;
   while (!game_isending) {
-    if (updateTimer() != 0) continue;
+    if (headless_steps > 0) {
+      if (steps++ == headless_steps) break;
+      updateFixedTimer();
+    } else if (updateTimer() != 0) continue;
     if (handleEvents() != 0) break;
     if (gameWait() != 0) continue;
 
+    profiler_frame_begin();
     ENIGMA_events();
     handleInput();
+    profiler_frame_end();
   }
 
   game_ending();
+  profiler_report();
   DisableDrawing(windowHandle);
   destroyWindow();
   return game_return;
@@ -30,6 +30,10 @@ namespace enigma {
   extern int current_room_speed;
   extern int frames_count;
   extern unsigned long current_time_mcs;
+  // Set from ENIGMA_HEADLESS_STEPS: run this many steps unpaced, at a fixed
+  // delta_time and with a fixed random seed (ENIGMA_SEED), then end the game.
+  extern int headless_steps;
+  extern int headless_seed;
 
   int main(int argc, char** argv, void* windowHandle = nullptr);
   int game_ending();
@@ -40,6 +44,7 @@ namespace enigma {
   void set_program_args(int argc, char** argv);
   void initTimer();
   int updateTimer();
+  int updateFixedTimer();
   int gameWait();
   void set_room_speed(int rs);
   unsigned long get_timer();
@@ -0,0 +1,240 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64) || defined(__WIN64__)
+#  define ENIGMA_POOL_WINDOWS
+#  ifndef _WIN32_WINNT
+#    define _WIN32_WINNT 0x0600 // Condition variables
+#  endif
+#else
+#  include <unistd.h> // sysconf
+#endif
+
+#include "Platforms/General/PFthreads.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+// The little the pool needs from the platform: a lock, two condition variables
+// and a way to start threads.
+#ifdef ENIGMA_POOL_WINDOWS
+  CRITICAL_SECTION pool_lock;
+  CONDITION_VARIABLE pool_wake, pool_done;
+  bool pool_sync_ready = false;
+
+  void pool_sync_init() {
+    if (pool_sync_ready) return;
+    InitializeCriticalSection(&pool_lock);
+    InitializeConditionVariable(&pool_wake);
+    InitializeConditionVariable(&pool_done);
+    pool_sync_ready = true;
+  }
+  inline void lock() { EnterCriticalSection(&pool_lock); }
+  inline void unlock() { LeaveCriticalSection(&pool_lock); }
+  inline void wait(CONDITION_VARIABLE &cond) { SleepConditionVariableCS(&cond, &pool_lock, INFINITE); }
+  inline void broadcast(CONDITION_VARIABLE &cond) { WakeAllConditionVariable(&cond); }
+
+  typedef HANDLE worker_handle;
+  DWORD WINAPI worker_main(LPVOID arg);
+  bool start_worker(worker_handle &handle, void* arg) {
+    handle = CreateThread(NULL, 0, worker_main, arg, 0, NULL);
+    return handle != NULL;
+  }
+  void join_worker(worker_handle handle) {
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+  }
+
+  unsigned processor_count() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+  }
+#else
+  pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+  pthread_cond_t pool_wake = PTHREAD_COND_INITIALIZER, pool_done = PTHREAD_COND_INITIALIZER;
+
+  void pool_sync_init() {}
+  inline void lock() { pthread_mutex_lock(&pool_lock); }
+  inline void unlock() { pthread_mutex_unlock(&pool_lock); }
+  inline void wait(pthread_cond_t &cond) { pthread_cond_wait(&cond, &pool_lock); }
+  inline void broadcast(pthread_cond_t &cond) { pthread_cond_broadcast(&cond); }
+
+  typedef pthread_t worker_handle;
+  void* worker_main(void* arg);
+  bool start_worker(worker_handle &handle, void* arg) {
+    return !pthread_create(&handle, NULL, worker_main, arg);
+  }
+  void join_worker(worker_handle handle) {
+    pthread_join(handle, NULL);
+  }
+
+  unsigned processor_count() {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+  }
+#endif
+
+// Each worker starts on its own slice of the job and takes it a grain at a
+// time; once that runs dry it takes grains from the other slices in turn.
+struct slice {
+  std::atomic<size_t> next;
+  size_t end;
+  char pad[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)]; // One cache line each
+};
+
+unsigned requested_size = 0; // Zero picks one thread per processor
+unsigned started_size = 0; // What was asked for when the workers were started
+unsigned pool_size = 1;
+std::vector<worker_handle> workers;
+slice* slices = NULL;
+
+// The current job; guarded by pool_lock when handed over.
+enigma::thread_pool_task job_task;
+void* job_data;
+size_t job_grain;
+unsigned long job_generation = 0;
+unsigned long started_generation = 0; // The last job before the workers started
+unsigned job_running = 0;
+bool pool_quitting = false;
+// Set from when a job is handed out until it finishes. The pool holds one job
+// at a time, so a call made while it's set, from a task or from another
+// thread, is run serially by its caller instead.
+std::atomic<bool> job_active(false);
+
+void work(unsigned me) {
+  for (unsigned k = 0; k < pool_size; ++k) {
+    slice &s = slices[(me + k) % pool_size];
+    for (;;) {
+      const size_t begin = s.next.fetch_add(job_grain, std::memory_order_relaxed);
+      if (begin >= s.end) break;
+      const size_t end = begin + job_grain < s.end ? begin + job_grain : s.end;
+      job_task(job_data, begin, end, me);
+    }
+  }
+}
+
+void worker_loop(unsigned me) {
+  unsigned long seen = started_generation;
+  lock();
+  for (;;) {
+    while (job_generation == seen && !pool_quitting) wait(pool_wake);
+    if (pool_quitting) break;
+    seen = job_generation;
+    unlock();
+    work(me);
+    lock();
+    if (!--job_running) broadcast(pool_done);
+  }
+  unlock();
+}
+
+#ifdef ENIGMA_POOL_WINDOWS
+  DWORD WINAPI worker_main(LPVOID arg) { worker_loop((unsigned)(size_t)arg); return 0; }
+#else
+  void* worker_main(void* arg) { worker_loop((unsigned)(size_t)arg); return NULL; }
+#endif
+
+void stop_workers() {
+  lock();
+  pool_quitting = true;
+  broadcast(pool_wake);
+  unlock();
+  for (size_t i = 0; i < workers.size(); ++i)
+    join_worker(workers[i]);
+  workers.clear();
+  pool_quitting = false;
+}
+
+// Brings the number of running workers in line with the requested size.
+void start_workers() {
+  pool_sync_init();
+  const unsigned size = requested_size ? requested_size : processor_count();
+  if (size == started_size) return;
+
+  stop_workers();
+  delete[] slices;
+  slices = new slice[size];
+  started_size = pool_size = size;
+  started_generation = job_generation;
+  for (unsigned i = 1; i < size; ++i) {
+    worker_handle handle;
+    if (!start_worker(handle, (void*)(size_t)i)) {
+      printf("Thread pool: could only start %u of %u threads\n", i, size);
+      pool_size = i;
+      break;
+    }
+    workers.push_back(handle);
+  }
+}
+
+} // namespace
+
+namespace enigma {
+
+void thread_pool_run(size_t count, thread_pool_task task, void* data) {
+  if (!count) return;
+  if (job_active.exchange(true, std::memory_order_acquire)) {
+    task(data, 0, count, 0);
+    return;
+  }
+  start_workers();
+  if (pool_size == 1 || count == 1) {
+    task(data, 0, count, 0);
+    job_active.store(false, std::memory_order_release);
+    return;
+  }
+
+  for (unsigned i = 0; i < pool_size; ++i) {
+    slices[i].next.store(count * i / pool_size, std::memory_order_relaxed);
+    slices[i].end = count * (i + 1) / pool_size;
+  }
+  job_task = task;
+  job_data = data;
+  job_grain = count / (pool_size * 8) + 1;
+
+  lock();
+  job_running = pool_size - 1;
+  ++job_generation;
+  broadcast(pool_wake);
+  unlock();
+
+  work(0);
+
+  lock();
+  while (job_running) wait(pool_done);
+  unlock();
+  job_active.store(false, std::memory_order_release);
+}
+
+} // namespace enigma
+
+namespace enigma_user {
+
+void thread_pool_set_size(int size) {
+  requested_size = size > 0 ? size : 0;
+}
+
+int thread_pool_get_size() {
+  // Workers can't be restarted under a running job.
+  if (!job_active.load(std::memory_order_acquire)) start_workers();
+  return pool_size;
+}
+
+}
@@ -58,6 +58,17 @@ struct ethread
 
 extern std::deque<ethread*> threads;
 
+namespace enigma {
+  // A unit of pooled work: handles items [begin, end) of a job on the given worker.
+  typedef void (*thread_pool_task)(void* data, size_t begin, size_t end, unsigned worker);
+
+  // Splits [0, count) among the pool's workers, the calling thread being worker 0,
+  // and returns once every item is done. Idle workers steal ranges from busy ones.
+  // A call made while another job is running, such as from inside a task, runs
+  // the whole range serially on the calling thread, as worker 0.
+  void thread_pool_run(size_t count, thread_pool_task task, void* data);
+}
+
 namespace enigma_user {
   int script_thread(int scr, variant arg0 = 0, variant arg1 = 0, variant arg2 = 0, variant arg3 = 0, variant arg4 = 0, variant arg5 = 0, variant arg6 = 0, variant arg7 = 0);
   
@@ -68,6 +79,11 @@ namespace enigma_user {
   bool thread_exists(int thread);
   bool thread_get_finished(int thread);
   variant thread_get_return(int thread);
+
+  // Sets how many threads, the main one included, run pooled work such as
+  // parallel step events. Zero restores the default of one per processor.
+  void thread_pool_set_size(int size);
+  int thread_pool_get_size();
 }
 
 #endif //ENIGMA_PLATFORM_THREADS_H
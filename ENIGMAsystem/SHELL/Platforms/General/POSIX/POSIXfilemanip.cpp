@@ -21,7 +21,9 @@
 #include <cstdlib>
 #include <string>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
 
@@ -119,3 +121,33 @@ extern string temp_directory;
 
 }  // namespace enigma_user
 
+namespace enigma {
+
+bool file_map(string fname, file_mapping& map) {
+  map = file_mapping();
+  int fd = open(fname.c_str(), O_RDONLY);
+  if (fd == -1) return false;
+  struct stat st;
+  if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+    close(fd);
+    return false;
+  }
+  if (st.st_size) {
+    void* addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      close(fd);
+      return false;
+    }
+    map.data = static_cast<const unsigned char*>(addr);
+    map.size = st.st_size;
+  }
+  close(fd);  // The mapping keeps the file referenced.
+  return true;
+}
+
+void file_unmap(file_mapping& map) {
+  if (map.data) munmap(const_cast<unsigned char*>(map.data), map.size);
+  map = file_mapping();
+}
+
+}  // namespace enigma
@@ -299,3 +299,43 @@ time_t file_modified_time(std::string fname)
 
 }
 
+namespace enigma
+{
+
+bool file_map(std::string fname, file_mapping& map)
+{
+    map = file_mapping();
+    HANDLE file = CreateFile(fname.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart) {
+        HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+        if (!view) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        map.data = static_cast<const unsigned char*>(view);
+        map.size = size.QuadPart;
+        map.handle = mapping;
+    }
+    // The mapping object keeps the file open on its own.
+    CloseHandle(file);
+    return true;
+}
+
+void file_unmap(file_mapping& map)
+{
+    if (map.data) UnmapViewOfFile(map.data);
+    if (map.handle) CloseHandle(map.handle);
+    map = file_mapping();
+}
+
+}
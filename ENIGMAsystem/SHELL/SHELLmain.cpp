@@ -76,6 +76,9 @@ extern int amain();
 #include "Universal_System/globalupdate.h"
 
 #include "Universal_System/instance_system_frontend.h"
+#include "Universal_System/parallel_events.h"
+#include "Universal_System/profiler.h"
+#include "Universal_System/resource_residency.h"
 
 #include "Universal_System/resource_data.h"
 #include "Universal_System/highscore_functions.h"
@@ -102,7 +105,15 @@ using namespace enigma_user;
   #include "Preprocessor_Environment_Editable/IDE_EDIT_timelines.h"
   #include "Preprocessor_Environment_Editable/IDE_EDIT_globals.h"
   #include "Preprocessor_Environment_Editable/IDE_EDIT_objectaccess.h"
+#endif
+
+// Each object, script and timeline is compiled from a file of its own, which defines
+// ENIGMA_GAME_UNIT and includes this one for everything above. The rest of this file,
+// like the definitions the headers above keep behind that macro, is compiled here only.
+#ifndef ENIGMA_GAME_UNIT
+#ifndef JUST_DEFINE_IT_RUN
   #include "Preprocessor_Environment_Editable/IDE_EDIT_objectfunctionality.h"
+  #include "Preprocessor_Environment_Editable/IDE_EDIT_eventdispatch.h"
   #include "Preprocessor_Environment_Editable/IDE_EDIT_roomcreates.h"
   #include "Preprocessor_Environment_Editable/IDE_EDIT_roomarrays.h"
   #include "Preprocessor_Environment_Editable/IDE_EDIT_shaderarrays.h"
@@ -126,6 +137,7 @@ namespace enigma
       it->myevent_roomend();
       it->myevent_gameend();
     }
+    perform_callbacks_game_end();
     
     // Now clean up instances and free them from memory.
     for (enigma::iterator it = instance_list_first(); it; ++it)
@@ -135,3 +147,5 @@ namespace enigma
     return 0;
   }
 }
+
+#endif // ENIGMA_GAME_UNIT
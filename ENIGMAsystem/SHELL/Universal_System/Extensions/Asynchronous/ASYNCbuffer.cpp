@@ -0,0 +1,146 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+#include "ASYNCbuffer.h"
+#include "ASYNCdialog.h"
+#include "Platforms/General/PFthreads.h"
+#include "Universal_System/buffers.h"
+#include "Universal_System/buffers_internal.h"
+#include "Universal_System/callbacks_events.h"
+#include "Universal_System/Extensions/DataStructures/include.h"
+#include "Universal_System/instance_system.h"
+#include "Universal_System/instance.h"
+
+// include after variant
+#include "implement.h"
+
+namespace enigma {
+  namespace extension_cast {
+    extension_async *as_extension_async(object_basic*);
+  }
+}
+
+using namespace enigma_user;
+
+// The worker only ever touches its own job. It sets done last, and the game
+// thread reaps finished jobs and raises their events, so the events run
+// between steps like any other.
+struct SaveJob {
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64) || defined(__WIN64__)
+  HANDLE handle;
+#else
+  pthread_t handle;
+#endif
+  int id;
+  string filename;
+  std::vector<unsigned char> bytes;
+  bool status;
+  std::atomic<bool> done;
+  SaveJob(int i, string fn): id(i), filename(fn), status(false), done(false) { }
+};
+
+static std::vector<SaveJob*> pending_saves;
+static int next_save_id = 0;
+
+static void fireAsyncSaveLoadEvent() {
+  enigma::instance_event_iterator = new enigma::inst_iter(NULL,NULL,NULL);
+  for (enigma::iterator it = enigma::instance_list_first(); it; ++it)
+  {
+    enigma::object_basic* const inst = ((enigma::object_basic*)*it);
+    enigma::extension_async* const inst_async = enigma::extension_cast::as_extension_async(inst);
+    inst_async->myevent_asyncsaveload();
+  }
+}
+
+static void* saveBufferAsync(void* data) {
+  SaveJob* const job = (SaveJob*)data;
+  if (FILE* file = fopen(job->filename.c_str(), "wb")) {
+    job->status = fwrite(job->bytes.data(), 1, job->bytes.size(), file) == job->bytes.size();
+    job->status = !fclose(file) && job->status;
+  }
+  job->done.store(true, std::memory_order_release);
+  return NULL;
+}
+
+static void joinSave(SaveJob* job) {
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64) || defined(__WIN64__)
+  WaitForSingleObject(job->handle, INFINITE);
+  CloseHandle(job->handle);
+#else
+  pthread_join(job->handle, NULL);
+#endif
+}
+
+static void dispatchSaves() {
+  for (size_t i = 0; i < pending_saves.size(); ) {
+    SaveJob* const job = pending_saves[i];
+    if (!job->done.load(std::memory_order_acquire)) {
+      ++i;
+      continue;
+    }
+    joinSave(job);
+    pending_saves.erase(pending_saves.begin() + i);
+    if (!ds_map_exists(async_load)) async_load = ds_map_create();
+    ds_map_replaceanyway(async_load, "id", job->id);
+    ds_map_replaceanyway(async_load, "status", job->status);
+    delete job;
+    fireAsyncSaveLoadEvent();
+  }
+}
+
+// Saves still running when the game ends are waited for, so none is cut off;
+// their events are not raised, as there is nothing left to receive them.
+static void finishSaves() {
+  for (SaveJob* job : pending_saves) {
+    joinSave(job);
+    delete job;
+  }
+  pending_saves.clear();
+}
+
+namespace enigma_user {
+  int buffer_save_async(int buffer, string filename, unsigned offset, unsigned size) {
+    get_bufferr(binbuff, buffer, -1);
+    static bool registered = false;
+    if (!registered) {
+      enigma::register_callback_async_dispatch(dispatchSaves);
+      enigma::register_callback_game_end(finishSaves);
+      registered = true;
+    }
+
+    // Only the copy happens here; the buffer is free to change as soon as
+    // this returns.
+    SaveJob* job = new SaveJob(next_save_id++, filename);
+    binbuff->Snapshot(offset, size, job->bytes);
+    enigma::buffers_release_file(filename);
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64) || defined(__WIN64__)
+    job->handle = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)saveBufferAsync, (LPVOID)job, 0, NULL);
+    if (job->handle == NULL) {
+#else
+    if (pthread_create(&job->handle, NULL, saveBufferAsync, job)) {
+#endif
+      delete job;
+      return -1;
+    }
+    pending_saves.push_back(job);
+    return job->id;
+  }
+}
@@ -0,0 +1,31 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_ASYNCBUFFER_H
+#define ENIGMA_ASYNCBUFFER_H
+
+#include <string>
+using std::string;
+
+namespace enigma_user {
+  // Copies size bytes of the buffer from offset and writes them to filename on
+  // a background thread. Returns an id; when the write finishes, the Save/Load
+  // asynchronous event fires with async_load holding "id" and "status".
+  int buffer_save_async(int buffer, string filename, unsigned offset, unsigned size);
+}
+
+#endif // ENIGMA_ASYNCBUFFER_H
@@ -33,6 +33,7 @@ namespace enigma {
     virtual variant myevent_asyncsteam() { return 0; }
     virtual variant myevent_asyncsocial() { return 0; }
     virtual variant myevent_asyncpushnotification() { return 0; }
+    virtual variant myevent_asyncsaveload() { return 0; }
   };
 }
 
@@ -16,3 +16,4 @@
 **/
 
 #include "ASYNCdialog.h"
+#include "ASYNCbuffer.h"
@@ -35,11 +35,13 @@
 #include <sstream>
 #include <string>
 
-#include <floatcomp.h>
-
 using namespace std;
 
 #include "include.h"
+#include "grid_kernels.h"
+#include "variant_map.h"
+#include "Universal_System/buffers_internal.h"
+#include "libEGMstd.h"
 
 static inline double maxv(double a, double b) { return (a > b) ? a : b; }
 static inline double minv(double a, double b) { return (a < b) ? a : b; }
@@ -48,18 +50,18 @@ static inline unsigned minv(unsigned a, unsigned b) { return (a < b) ? a : b; }
 static inline int maxv(int a, int b) { return (a > b) ? a : b; }
 static inline int minv(int a, int b) { return (a < b) ? a : b; }
 
-template<typename t> bool tequal(t v1, t v2) { return v1 == v2; }
-template<> bool tequal(float v1, float v2)   { return fequal(v1, v2); }
-template<> bool tequal(double v1, double v2) { return fequal(v1, v2); }
-
 template <typename t>
 class grid
 {
+    template <typename> friend class grid;
     unsigned int xgrid, ygrid;
     t *grid_array;
 
+    t *row(int y) { return grid_array + y * xgrid; }
+    const t *row(int y) const { return grid_array + y * xgrid; }
+
     public:
-    grid() {}
+    grid(): xgrid(0), ygrid(0), grid_array(NULL) {}
     grid(const unsigned int w, const unsigned int h) {
       ygrid = h; xgrid = w; grid_array = new t[w*h];
     }
@@ -68,41 +70,43 @@ class grid
     void destroy()
     {
         delete[] grid_array;
+        grid_array = NULL;
+        xgrid = ygrid = 0;
     }
     void clear(const t val)
     {
-        for (unsigned i = 0; i < ygrid; i++)
-            for (unsigned ii = 0; ii < xgrid; ii++)
-                grid_array[i * xgrid + ii] = val;
+        enigma::fill_row(grid_array, xgrid * ygrid, val);
     }
     void resize(unsigned w, unsigned h)
     {
-        grid<variant> temp(w, h);
+        grid<t> temp(w, h);
+        temp.clear(t());
         const unsigned int wm = minv(xgrid, w), hm = minv(ygrid, h);
         for (unsigned i = 0; i < hm; i++)
-            for (unsigned ii = 0; ii < wm; ii++)
-                temp.grid_array[i * w + ii] = grid_array[i * xgrid + ii];
+            enigma::copy_row(temp.row(i), row(i), wm);
         delete[] grid_array;
         (*this) = temp;
     }
-    void copy(const grid& copy_id)
+    template <typename u> void copy(const grid<u>& copy_id)
     {
         delete[] grid_array;
         grid_array = new t[copy_id.ygrid*copy_id.xgrid];
         xgrid = copy_id.xgrid;
         ygrid = copy_id.ygrid;
-        for (unsigned i = 0; i < ygrid; i++)
-            for (unsigned ii = 0; ii < xgrid; ii++)
-                grid_array[i * xgrid + ii] = copy_id.grid_array[i * copy_id.xgrid + ii];
+        enigma::copy_row(grid_array, copy_id.grid_array, xgrid * ygrid);
     }
-    unsigned int width()
+    unsigned int width() const
     {
         return xgrid;
     }
-    unsigned int height()
+    unsigned int height() const
     {
         return ygrid;
     }
+    const t *data() const
+    {
+        return grid_array;
+    }
     void insert(const unsigned int x, const unsigned int y, const t val)
     {
         if (x < xgrid && y < ygrid)
@@ -118,79 +122,37 @@ class grid
         if (x < xgrid && y < ygrid)
             grid_array[y * xgrid + x] *= val;
     }
-    void insert_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const t val)
+    void insert_region(const enigma::grid_rect &r, const t val)
     {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   grid_array[i * xgrid + ii] = val;
-       }
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::fill_row(row(i) + r.x1, r.x2 - r.x1, val);
     }
-    void add_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const t val)
+    void add_region(const enigma::grid_rect &r, const t val)
     {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   grid_array[i * xgrid + ii] += val;
-       }
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::add_row(row(i) + r.x1, r.x2 - r.x1, val);
     }
-    void multiply_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const double val)
+    void multiply_region(const enigma::grid_rect &r, const double val)
     {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   grid_array[i * xgrid + ii] *= val;
-       }
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::multiply_row(row(i) + r.x1, r.x2 - r.x1, val);
     }
-    void insert_disk(const double x, const double y, const double r, const t val)
+    void insert_disk(const enigma::disk_rows &d, const t val)
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
-        {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        grid_array[i * xgrid + ii] = val;
-        }
+        for (int i = d.y1; i < d.y2; i++)
+            enigma::fill_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), val);
     }
-    void add_disk(const double x, const double y, const double r, const t val)
+    void add_disk(const enigma::disk_rows &d, const t val)
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
-        {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        grid_array[i * xgrid + ii] += val;
-        }
+        for (int i = d.y1; i < d.y2; i++)
+            enigma::add_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), val);
     }
-    void multiply_disk(const double x, const double y, const double r, const double val)
+    void multiply_disk(const enigma::disk_rows &d, const double val)
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
-        {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        grid_array[i * xgrid + ii] *= val;
-        }
+        for (int i = d.y1; i < d.y2; i++)
+            enigma::multiply_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), val);
     }
-    void insert_grid_region(const grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    template <typename u> void insert_grid_region(const grid<u>& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
     {
         if (x < xgrid && y < ygrid)
         {
@@ -199,12 +161,11 @@ class grid
             {
                 const int upx = minv(tx2 - tx1 + 1, minv(int(xgrid - x), xd)), upy = minv(ty2 - ty1 + 1, minv(int(ygrid - y), yd));
                 for (int i = 0; i < upy; i++)
-                    for (int ii = 0; ii < upx; ii++)
-                        grid_array[(y + i)*xgrid + (x + ii)] = source_id.grid_array[(ty1 + i)*source_id.xgrid + (tx1 + ii)];
+                    enigma::copy_row(row(y + i) + x, source_id.row(ty1 + i) + tx1, upx);
             }
         }
     }
-    void add_grid_region(const grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    template <typename u> void add_grid_region(const grid<u>& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
     {
         if (x < xgrid && y < ygrid)
         {
@@ -213,12 +174,11 @@ class grid
             {
                 const int upx = minv(tx2 - tx1 + 1, minv(int(xgrid - x), xd)), upy = minv(ty2 - ty1 + 1, minv(int(ygrid - y), yd));
                 for (int i = 0; i < upy; i++)
-                    for (int ii = 0; ii < upx; ii++)
-                        grid_array[(y + i)*xgrid + (x + ii)] += source_id.grid_array[(ty1 + i)*source_id.xgrid + (tx1 + ii)];
+                    enigma::add_row(row(y + i) + x, source_id.row(ty1 + i) + tx1, upx);
             }
         }
     }
-    void multiply_grid_region(const grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    template <typename u> void multiply_grid_region(const grid<u>& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
     {
         if (x < xgrid && y < ygrid)
         {
@@ -227,252 +187,416 @@ class grid
             {
                 const int upx = minv(tx2 - tx1 + 1, minv(int(xgrid - x), xd)), upy = minv(ty2 - ty1 + 1, minv(int(ygrid - y), yd));
                 for (int i = 0; i < upy; i++)
-                    for (int ii = 0; ii < upx; ii++)
-                        grid_array[(y + i)*xgrid + (x + ii)] *= source_id.grid_array[(ty1 + i)*source_id.xgrid + (tx1 + ii)];
+                    enigma::multiply_row(row(y + i) + x, source_id.row(ty1 + i) + tx1, upx);
             }
         }
     }
 
-    t find(unsigned int x, unsigned int y)
+    t find(unsigned int x, unsigned int y) const
     {
         return (grid_array[y * xgrid + x]);
     }
-    t find_region_sum(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           variant sum = 0;
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   sum += grid_array[i * xgrid + ii];
-           return sum;
-       }
-       return t();
-    }
-    t find_region_max(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       t val_check;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           t max_check = grid_array[py1 * xgrid + px1];
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-               {
-                   val_check = grid_array[i * xgrid + ii];
-                   if (val_check > max_check)
-                       max_check = val_check;
-               }
-           return max_check;
-       }
-       return t();
-    }
-    t find_region_min(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       t val_check;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           t min_check = grid_array[py1 * xgrid + px1];
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-               {
-                   val_check = grid_array[i * xgrid + ii];
-                   if (val_check < min_check)
-                       min_check = val_check;
-               }
-           return min_check;
-       }
-       return t();
-    }
-    t find_region_mean(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           t sum = 0;
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   sum += grid_array[i * xgrid + ii];
-           const double region_size = (py2 - py1)*(px2 - px1);
-           return sum/region_size;
-       }
-       return t();
-    }
-    t find_disk_sum(const double x, const double y, const double r)
-    {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
-        {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            t sum = t();
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        sum += grid_array[i * xgrid + ii];
-            return sum;
-        }
-        return t();
+    t find_region_sum(const enigma::grid_rect &r) const
+    {
+        t sum = 0;
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::sum_row(row(i) + r.x1, r.x2 - r.x1, sum);
+        return sum;
+    }
+    t find_region_max(const enigma::grid_rect &r) const
+    {
+        t max_check = row(r.y1)[r.x1];
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::max_row(row(i) + r.x1, r.x2 - r.x1, max_check);
+        return max_check;
     }
-    t find_disk_max(const double x, const double y, const double r)
+    t find_region_min(const enigma::grid_rect &r) const
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
+        t min_check = row(r.y1)[r.x1];
+        for (int i = r.y1; i < r.y2; i++)
+            enigma::min_row(row(i) + r.x1, r.x2 - r.x1, min_check);
+        return min_check;
+    }
+    t find_region_mean(const enigma::grid_rect &r) const
+    {
+        const double region_size = (r.y2 - r.y1)*(r.x2 - r.x1);
+        return find_region_sum(r)/region_size;
+    }
+    t find_disk_sum(const enigma::disk_rows &d) const
+    {
+        t sum = t();
+        for (int i = d.y1; i < d.y2; i++)
+            enigma::sum_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), sum);
+        return sum;
+    }
+    // The disk must hold at least one cell.
+    t find_disk_max(const enigma::disk_rows &d) const
+    {
+        int i = d.y1;
+        while (d.lo(i) == d.hi(i)) i++;
+        t max_check = row(i)[d.lo(i)];
+        for (; i < d.y2; i++)
+            enigma::max_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), max_check);
+        return max_check;
+    }
+    t find_disk_min(const enigma::disk_rows &d) const
+    {
+        int i = d.y1;
+        while (d.lo(i) == d.hi(i)) i++;
+        t min_check = row(i)[d.lo(i)];
+        for (; i < d.y2; i++)
+            enigma::min_row(row(i) + d.lo(i), d.hi(i) - d.lo(i), min_check);
+        return min_check;
+    }
+    t find_disk_mean(const enigma::disk_rows &d) const
+    {
+        return find_disk_sum(d)/double(d.cells());
+    }
+    // Finds the first cell holding val in row-major order.
+    bool value_region_find(const enigma::grid_rect &r, const t &val, int &vx, int &vy) const
+    {
+        for (int i = r.y1; i < r.y2; i++)
         {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            t max_check = grid_array[py1 * xgrid + px1];
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                    {
-                        const double val_check = grid_array[i * xgrid + ii];
-                        if (val_check > max_check)
-                            max_check = val_check;
-                    }
-            return max_check;
+            const int n = r.x2 - r.x1, at = enigma::find_row(row(i) + r.x1, n, val);
+            if (at < n)
+            {
+                vx = r.x1 + at; vy = i;
+                return true;
+            }
         }
-        return t();
+        return false;
     }
-    t find_disk_min(const double x, const double y, const double r)
+    bool value_disk_find(const enigma::disk_rows &d, const t &val, int &vx, int &vy) const
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
+        for (int i = d.y1; i < d.y2; i++)
         {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            t min_check = grid_array[lrint(y) * xgrid + lrint(x)];
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                    {
-                        const double val_check = grid_array[i * xgrid + ii];
-                        if (val_check < min_check)
-                            min_check = val_check;
-                    }
-            return min_check;
+            const int n = d.hi(i) - d.lo(i), at = enigma::find_row(row(i) + d.lo(i), n, val);
+            if (at < n)
+            {
+                vx = d.lo(i) + at; vy = i;
+                return true;
+            }
         }
-        return t();
+        return false;
     }
-    t find_disk_mean(const double x, const double y, const double r)
+    void shuffle()
+    {
+        random_shuffle(grid_array, grid_array + (xgrid*ygrid - 1));
+    }
+};
+
+// The storage behind a ds_grid. Cells are kept as plain doubles for as long as
+// every cell holds a real, which halves the memory and lets the row kernels
+// vectorize; the first non-real stored moves the grid over to variants, and
+// clearing it to a real moves it back. Sums over a numeric grid come from a
+// summed-area table once enough cells have been summed directly since the
+// last change to pay for building one.
+class variant_grid
+{
+    grid<double> reals;
+    grid<variant> cells;
+    bool numeric;
+    enigma::summed_area_table sums;
+    bool sums_valid;
+    double sums_debt;
+
+    static bool is_real(const variant &val) { return val.type == enigma_user::ty_real; }
+
+    void changed()
+    {
+        sums_valid = false;
+        sums_debt = 0;
+    }
+    void to_variants()
+    {
+        if (!numeric) return;
+        cells.copy(reals);
+        reals.destroy();
+        sums.clear();
+        numeric = false;
+    }
+    void to_reals(unsigned w, unsigned h)
+    {
+        if (numeric) return;
+        cells.destroy();
+        reals = grid<double>(w, h);
+        numeric = true;
+    }
+    // Whether the summed-area table should answer a query that would
+    // otherwise scan the given number of cells.
+    bool use_sums(double scanned)
+    {
+        if (sums_valid) return true;
+        sums_debt += scanned;
+        if (sums_debt < double(reals.width()) * reals.height()) return false;
+        sums_debt = 0;
+        return sums_valid = sums.build(reals.data(), reals.width(), reals.height());
+    }
+    double disk_sum(const enigma::disk_rows &d)
+    {
+        if (!use_sums(d.cells())) return reals.find_disk_sum(d);
+        double sum = 0;
+        for (int i = d.y1; i < d.y2; i++)
+            sum += sums.sum(d.lo(i), i, d.hi(i), i + 1);
+        return sum;
+    }
+    enigma::grid_rect rect(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2) const
+    {
+        return enigma::grid_rect(x1, y1, x2, y2, width(), height());
+    }
+    enigma::disk_rows disk(const double x, const double y, const double r) const
+    {
+        return enigma::disk_rows(x, y, r, width(), height());
+    }
+    // Finds the first cell holding val in row-major order; a string is never
+    // found in a numeric grid.
+    bool value_region_find(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const variant &val, int &vx, int &vy) const
+    {
+        const enigma::grid_rect r = rect(x1, y1, x2, y2);
+        if (!numeric) return cells.value_region_find(r, val, vx, vy);
+        return is_real(val) && reals.value_region_find(r, val.rval.d, vx, vy);
+    }
+    bool value_disk_find(const double x, const double y, const double r, const variant &val, int &vx, int &vy) const
+    {
+        const enigma::disk_rows d = disk(x, y, r);
+        if (!numeric) return cells.value_disk_find(d, val, vx, vy);
+        return is_real(val) && reals.value_disk_find(d, val.rval.d, vx, vy);
+    }
+
+    public:
+    variant_grid(): numeric(true), sums_valid(false), sums_debt(0) {}
+    variant_grid(const unsigned int w, const unsigned int h): reals(w, h), numeric(true), sums_valid(false), sums_debt(0) {}
+
+    void destroy()
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
+        reals.destroy();
+        cells.destroy();
+        sums.clear();
+    }
+    void clear(const variant &val)
+    {
+        if (is_real(val))
         {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            t sum = t();
-            double region_size = 0;
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                    {
-                        sum += grid_array[i * xgrid + ii];
-                        ++region_size;
-                    }
-           return sum/region_size;
+            to_reals(width(), height());
+            reals.clear(val.rval.d);
         }
-        return t();
-    }
-    bool value_region_exists(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const t val)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   if (tequal(grid_array[i * xgrid + ii], val))
-                       return true;
-       }
-       return false;
-    }
-    int value_region_x(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const t val)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   if (tequal(grid_array[i * xgrid + ii], val))
-                      return ii;
-       }
-       return 0;
-    }
-    int value_region_y(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const t val)
-    {
-       const int tx1 = minv(x1, x2),  ty1 = minv(y1, y2), tx2 = maxv(x1, x2), ty2 = maxv(y1, y2), xd = xgrid - tx1, yd = ygrid - ty1;
-       if (xd > 0 && yd > 0)
-       {
-           const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2 + 1, (int)xgrid), py2 = minv(ty2 + 1, (int)ygrid);
-           for (int i = py1; i < py2; i++)
-               for (int ii = px1; ii < px2; ii++)
-                   if (tequal(grid_array[i * xgrid + ii], val))
-                       return i;
-       }
-       return 0;
-    }
-    bool value_disk_exists(const double x, const double y, const double r, const t val)
-    {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
+        else
         {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        if (tequal(grid_array[i * xgrid + ii], val))
-                            return true;
+            to_variants();
+            cells.clear(val);
         }
-        return false;
+        changed();
     }
-    int value_disk_x(const double x, const double y, const double r, const t val)
+    void resize(unsigned w, unsigned h)
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
-        {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        if (tequal(grid_array[i * xgrid + ii], val))
-                            return i;
-        }
-        return 0;
+        if (numeric) reals.resize(w, h);
+        else cells.resize(w, h);
+        sums.clear();
+        changed();
     }
-    int value_disk_y(const double x, const double y, const double r, const t val)
+    void copy(const variant_grid& copy_id)
     {
-        const double rr = r*r;
-        const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
-        if (tx2 >= 0 && ty2 >=0 && tx1 < int(xgrid) && ty1 < int(ygrid))
+        if (&copy_id == this) return;
+        if (copy_id.numeric)
+        {
+            to_reals(0, 0);
+            reals.copy(copy_id.reals);
+        }
+        else
         {
-            const int px1 = maxv(tx1, 0), py1 = maxv(ty1, 0), px2 = minv(tx2, (int)xgrid), py2 = minv(ty2, (int)ygrid);
-            for (int i = py1; i < py2; i++)
-                for (int ii = px1; ii < px2; ii++)
-                    if ((x - ii)*(x - ii) + (y - i)*(y - i) <= rr)
-                        if (tequal(grid_array[i * xgrid + ii], val))
-                            return ii;
+            to_variants();
+            cells.copy(copy_id.cells);
         }
-        return 0;
+        sums.clear();
+        changed();
+    }
+    unsigned int width() const
+    {
+        return numeric ? reals.width() : cells.width();
+    }
+    unsigned int height() const
+    {
+        return numeric ? reals.height() : cells.height();
+    }
+    void insert(const unsigned int x, const unsigned int y, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.insert(x, y, val.rval.d);
+        else to_variants(), cells.insert(x, y, val);
+        changed();
+    }
+    void add(const unsigned int x, const unsigned int y, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.add(x, y, val.rval.d);
+        else to_variants(), cells.add(x, y, val);
+        changed();
+    }
+    void multiply(const unsigned int x, const unsigned int y, const double val)
+    {
+        if (numeric) reals.multiply(x, y, val);
+        else cells.multiply(x, y, val);
+        changed();
+    }
+    void insert_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.insert_region(rect(x1, y1, x2, y2), val.rval.d);
+        else to_variants(), cells.insert_region(rect(x1, y1, x2, y2), val);
+        changed();
+    }
+    void add_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.add_region(rect(x1, y1, x2, y2), val.rval.d);
+        else to_variants(), cells.add_region(rect(x1, y1, x2, y2), val);
+        changed();
+    }
+    void multiply_region(const unsigned int x1, const unsigned int y1, unsigned int x2, const unsigned int y2, const double val)
+    {
+        if (numeric) reals.multiply_region(rect(x1, y1, x2, y2), val);
+        else cells.multiply_region(rect(x1, y1, x2, y2), val);
+        changed();
+    }
+    void insert_disk(const double x, const double y, const double r, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.insert_disk(disk(x, y, r), val.rval.d);
+        else to_variants(), cells.insert_disk(disk(x, y, r), val);
+        changed();
+    }
+    void add_disk(const double x, const double y, const double r, const variant &val)
+    {
+        if (numeric && is_real(val)) reals.add_disk(disk(x, y, r), val.rval.d);
+        else to_variants(), cells.add_disk(disk(x, y, r), val);
+        changed();
+    }
+    void multiply_disk(const double x, const double y, const double r, const double val)
+    {
+        if (numeric) reals.multiply_disk(disk(x, y, r), val);
+        else cells.multiply_disk(disk(x, y, r), val);
+        changed();
+    }
+    void insert_grid_region(const variant_grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    {
+        if (numeric && source_id.numeric) reals.insert_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else if (to_variants(), source_id.numeric) cells.insert_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else cells.insert_grid_region(source_id.cells, sx1, sy1, sx2, sy2, x, y);
+        changed();
+    }
+    void add_grid_region(const variant_grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    {
+        if (numeric && source_id.numeric) reals.add_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else if (to_variants(), source_id.numeric) cells.add_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else cells.add_grid_region(source_id.cells, sx1, sy1, sx2, sy2, x, y);
+        changed();
+    }
+    void multiply_grid_region(const variant_grid& source_id, const unsigned int sx1, const unsigned int sy1, const unsigned int sx2, const unsigned int sy2, const unsigned int x, const unsigned int y)
+    {
+        if (numeric && source_id.numeric) reals.multiply_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else if (to_variants(), source_id.numeric) cells.multiply_grid_region(source_id.reals, sx1, sy1, sx2, sy2, x, y);
+        else cells.multiply_grid_region(source_id.cells, sx1, sy1, sx2, sy2, x, y);
+        changed();
+    }
+
+    variant find(unsigned int x, unsigned int y) const
+    {
+        return numeric ? variant(reals.find(x, y)) : cells.find(x, y);
+    }
+    variant find_region_sum(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
+    {
+        const enigma::grid_rect r = rect(x1, y1, x2, y2);
+        if (r.empty()) return variant();
+        if (!numeric) return cells.find_region_sum(r);
+        if (use_sums(double(r.x2 - r.x1) * (r.y2 - r.y1))) return sums.sum(r.x1, r.y1, r.x2, r.y2);
+        return reals.find_region_sum(r);
+    }
+    variant find_region_max(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2) const
+    {
+        const enigma::grid_rect r = rect(x1, y1, x2, y2);
+        if (r.empty()) return variant();
+        return numeric ? variant(reals.find_region_max(r)) : cells.find_region_max(r);
+    }
+    variant find_region_min(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2) const
+    {
+        const enigma::grid_rect r = rect(x1, y1, x2, y2);
+        if (r.empty()) return variant();
+        return numeric ? variant(reals.find_region_min(r)) : cells.find_region_min(r);
+    }
+    variant find_region_mean(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
+    {
+        const enigma::grid_rect r = rect(x1, y1, x2, y2);
+        if (r.empty()) return variant();
+        if (!numeric) return cells.find_region_mean(r);
+        const double region_size = double(r.x2 - r.x1) * (r.y2 - r.y1);
+        if (use_sums(region_size)) return sums.sum(r.x1, r.y1, r.x2, r.y2)/region_size;
+        return reals.find_region_mean(r);
+    }
+    variant find_disk_sum(const double x, const double y, const double r)
+    {
+        const enigma::disk_rows d = disk(x, y, r);
+        if (!d.overlaps()) return variant();
+        return numeric ? variant(disk_sum(d)) : cells.find_disk_sum(d);
+    }
+    variant find_disk_max(const double x, const double y, const double r) const
+    {
+        const enigma::disk_rows d = disk(x, y, r);
+        if (!d.cells()) return variant();
+        return numeric ? variant(reals.find_disk_max(d)) : cells.find_disk_max(d);
+    }
+    variant find_disk_min(const double x, const double y, const double r) const
+    {
+        const enigma::disk_rows d = disk(x, y, r);
+        if (!d.cells()) return variant();
+        return numeric ? variant(reals.find_disk_min(d)) : cells.find_disk_min(d);
+    }
+    variant find_disk_mean(const double x, const double y, const double r)
+    {
+        const enigma::disk_rows d = disk(x, y, r);
+        if (!d.cells()) return variant();
+        return numeric ? variant(disk_sum(d)/double(d.cells())) : cells.find_disk_mean(d);
+    }
+    bool value_region_exists(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const variant &val) const
+    {
+        int vx, vy;
+        return value_region_find(x1, y1, x2, y2, val, vx, vy);
+    }
+    int value_region_x(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const variant &val) const
+    {
+        int vx = 0, vy = 0;
+        value_region_find(x1, y1, x2, y2, val, vx, vy);
+        return vx;
+    }
+    int value_region_y(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const variant &val) const
+    {
+        int vx = 0, vy = 0;
+        value_region_find(x1, y1, x2, y2, val, vx, vy);
+        return vy;
+    }
+    bool value_disk_exists(const double x, const double y, const double r, const variant &val) const
+    {
+        int vx, vy;
+        return value_disk_find(x, y, r, val, vx, vy);
+    }
+    int value_disk_x(const double x, const double y, const double r, const variant &val) const
+    {
+        int vx = 0, vy = 0;
+        value_disk_find(x, y, r, val, vx, vy);
+        return vx;
+    }
+    int value_disk_y(const double x, const double y, const double r, const variant &val) const
+    {
+        int vx = 0, vy = 0;
+        value_disk_find(x, y, r, val, vx, vy);
+        return vy;
     }
     void shuffle()
     {
-        random_shuffle(grid_array, grid_array + (xgrid*ygrid - 1));
+        if (numeric) reals.shuffle();
+        else cells.shuffle();
+        changed();
     }
+
 };
 
 /* ds_grids */
 
-static map<unsigned int, grid<variant> > ds_grids;
+static map<unsigned int, variant_grid> ds_grids;
 static unsigned int ds_grids_maxid = 0;
 
 namespace enigma_user
@@ -481,7 +605,7 @@ namespace enigma_user
 unsigned int ds_grid_create(const unsigned int w, const unsigned int h)
 {
   //Creates a new grid. The function returns an integer as an id that must be used in all other functions to access the particular grid.
-  pair<map<unsigned int, grid<variant> >::iterator, bool> ins = ds_grids.insert(pair<unsigned int, grid<variant> >(ds_grids_maxid++, grid<variant>(w, h)));
+  pair<map<unsigned int, variant_grid>::iterator, bool> ins = ds_grids.insert(pair<unsigned int, variant_grid>(ds_grids_maxid++, variant_grid(w, h)));
   ins.first->second.clear(0);
   return ds_grids_maxid-1;
 }
@@ -699,7 +823,7 @@ bool ds_grid_exists(const unsigned int id)
 unsigned int ds_grid_duplicate(const unsigned int source)
 {
   //creates and returns a new grid containing a copy of the source grid
-  ds_grids.insert(pair<unsigned int, grid<variant> >(ds_grids_maxid++, grid<variant>(0, 0)));
+  ds_grids.insert(pair<unsigned int, variant_grid>(ds_grids_maxid++, variant_grid(0, 0)));
   ds_grids[ds_grids_maxid-1].copy(ds_grids[source]);
   return ds_grids_maxid-1;
 }
@@ -711,7 +835,7 @@ std::string ds_grid_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  grid<variant> dsGrid = ds_grids[id];
+  variant_grid &dsGrid = ds_grids[id];
 
   // Write size
   ss << std::hex << dsGrid.width();
@@ -743,10 +867,10 @@ std::string ds_grid_write(const unsigned int id)
       }
       else
       {
-        ss.width(4); ss << vari.sval.length();
+        ss.width(4); ss << vari.sval().length();
         ss.width(1);
-        for (size_t j = 0; j < vari.sval.length(); ++j)
-          ss << vari.sval[j];
+        for (size_t j = 0; j < vari.sval().length(); ++j)
+          ss << vari.sval()[j];
       }
     }
   }
@@ -809,7 +933,6 @@ void ds_grid_read(const unsigned int id, std::string value)
       else
       {
         variant vari;
-        vari.type = ty_string;
         int len;
 
         // Read length
@@ -818,7 +941,7 @@ void ds_grid_read(const unsigned int id, std::string value)
         ss.clear();
         i += 4;
 
-        vari.sval = value.substr(i, len);
+        vari = value.substr(i, len);
         i += len;
 
         ds_grids[id].add(xx, yy, vari);
@@ -831,7 +954,7 @@ void ds_grid_read(const unsigned int id, std::string value)
 
 /* ds_maps */
 
-static map<unsigned int, multimap<variant, variant> > ds_maps;
+static map<unsigned int, enigma::variant_map> ds_maps;
 static unsigned int ds_maps_maxid = 0;
 
 namespace enigma_user
@@ -840,14 +963,24 @@ namespace enigma_user
 unsigned int ds_map_create()
 {
   //Creates a new map. The function returns an integer as an id that must be used in all other functions to access the particular map.
-  ds_maps.insert(pair<unsigned int, multimap<variant, variant> >(ds_maps_maxid++, multimap<variant, variant>()));
+  ds_maps.insert(pair<unsigned int, enigma::variant_map>(ds_maps_maxid++, enigma::variant_map()));
   return ds_maps_maxid-1;
 }
 
 void ds_map_destroy(const unsigned int id)
 {
-  //Destroys the map
-  ds_maps.erase(ds_maps.find(id));
+  //Destroys the map, along with any maps and lists added to it with ds_map_add_map or ds_map_add_list
+  map<unsigned int, enigma::variant_map>::iterator it = ds_maps.find(id);
+  vector<pair<unsigned int, unsigned char> > nested;
+  for (enigma::variant_map::const_iterator e = it->second.begin(); e != it->second.end(); ++e)
+    if (e->nested != enigma::variant_map::PLAIN)
+      nested.push_back(make_pair((unsigned int)e->value, e->nested));
+  ds_maps.erase(it);
+  for (size_t i = 0; i < nested.size(); ++i)
+    if (nested[i].second == enigma::variant_map::NESTED_MAP) {
+      if (ds_map_exists(nested[i].first)) ds_map_destroy(nested[i].first);
+    }
+    else if (ds_list_exists(nested[i].first)) ds_list_destroy(nested[i].first);
 }
 
 void ds_map_clear(const unsigned int id)
@@ -862,6 +995,12 @@ void ds_map_copy(const unsigned int id, const unsigned int source)
   ds_maps[id] = ds_maps[source];
 }
 
+void ds_map_reserve(const unsigned int id, const unsigned int n)
+{
+  //Makes room for n keys in the map, so filling it up to that size never rehashes
+  ds_maps[id].reserve(n);
+}
+
 unsigned int ds_map_size(const unsigned int id)
 {
   //Returns the size of the map
@@ -876,8 +1015,20 @@ bool ds_map_empty(const unsigned int id)
 
 void ds_map_add(const unsigned int id, const variant key, const variant val)
 {
-  //Adds the value and corresponding key to the map.
-  ds_maps[id].insert(pair<variant, variant>(key, val));
+  //Adds the value and corresponding key to the map. Keys are unique; adding an existing key leaves its value alone.
+  ds_maps[id].insert(key, val);
+}
+
+void ds_map_add_map(const unsigned int id, const variant key, const unsigned int value)
+{
+  //Adds a map as the value of the key. The map is then owned by this one: it is saved and destroyed along with it.
+  ds_maps[id].insert(key, value, enigma::variant_map::NESTED_MAP);
+}
+
+void ds_map_add_list(const unsigned int id, const variant key, const unsigned int value)
+{
+  //Adds a list as the value of the key. The list is then owned by this map: it is saved and destroyed along with it.
+  ds_maps[id].insert(key, value, enigma::variant_map::NESTED_LIST);
 }
 
 void ds_map_replace(const unsigned int id, const variant key, const variant val)
@@ -891,101 +1042,95 @@ void ds_map_replace(const unsigned int id, const variant key, const variant val)
   //extension which had to create a special function to replace a value adding it if it does
   //not exist in the global async_load map.
   //Replaces the value corresponding with the key with a new value
-  multimap<variant, variant>::iterator it = ds_maps[id].find(key);
-  if (it != ds_maps[id].end())
-  {
-    ds_maps[id].erase(it);
-    ds_maps[id].insert(pair<variant, variant>(key, val));
-  }
+  enigma::variant_map &dsMap = ds_maps[id];
+  if (dsMap.find(key))
+    dsMap.assign(key, val);
 }
 
 //NOTE: Special function, see todo comment above.
 void ds_map_replaceanyway(const unsigned int id, const variant key, const variant val)
 {
   //Replaces the value corresponding with the key with a new value, adding it if it was not found in the map.
-  multimap<variant, variant>::iterator it = ds_maps[id].find(key);
-  if (it != ds_maps[id].end())
-  {
-    ds_maps[id].erase(it);
-  }
-  ds_maps[id].insert(pair<variant, variant>(key, val));
+  ds_maps[id].assign(key, val);
 }
 
 void ds_map_delete(const unsigned int id, const variant key)
 {
   //Deletes the key and the corresponding value from the map
-  multimap<variant, variant>::iterator it = ds_maps[id].find(key);
-  if (it != ds_maps[id].end())
-  {
-    ds_maps[id].erase(it);
-  }
+  ds_maps[id].erase(key);
 }
 
 void ds_map_delete(const unsigned int id, const variant first, const variant last)
 {
   //Deletes the keys and corresponding values in the range between first and last
-  multimap<variant, variant>::iterator itf = ds_maps[id].find(first), itl = ds_maps[id].find(last);
-  if (itf != ds_maps[id].end() && itl != ds_maps[id].end())
-  {
-    ds_maps[id].erase(itf, itl);
-  }
+  enigma::variant_map &dsMap = ds_maps[id];
+  if (!dsMap.find(first) || !dsMap.find(last))
+    return;
+  vector<variant> doomed;
+  for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    if (it->key >= first && it->key < last)
+      doomed.push_back(it->key);
+  for (size_t i = 0; i < doomed.size(); ++i)
+    dsMap.erase(doomed[i]);
 }
 
 bool ds_map_exists(const unsigned int id, const variant key)
 {
   //returns whether the key exists in the map
-  return (ds_maps[id].find(key) != ds_maps[id].end());
+  return ds_maps[id].find(key) != NULL;
 }
 
 variant ds_map_find_value(const unsigned int id, const variant key)
 {
   //Returns the value corresponding to the key in the map
-  multimap<variant, variant>::iterator it = ds_maps[id].find(key);
-  return ((it == ds_maps[id].end()) ? variant() : (*it).second);
+  const variant *val = ds_maps[id].find(key);
+  return val ? *val : variant();
 }
 
+// The map is unordered, so the order-based lookups below scan it once.
+
 variant ds_map_find_previous(const unsigned int id, const variant key)
 {
   //Returns the largest key in the map smaller than the indicated key
-  multimap<variant, variant>::reverse_iterator rit;
-  variant key_check;
-  for (rit = ds_maps[id].rbegin(); rit != ds_maps[id].rend(); rit++)
-  {
-    if ((key_check = (*rit).first) < key)
-    {
-      return key_check;
-    }
-  }
-  return 0;
+  const enigma::variant_map &dsMap = ds_maps[id];
+  const variant *best = NULL;
+  for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    if (it->key < key && (!best || it->key > *best))
+      best = &it->key;
+  return best ? *best : variant(0);
 }
 
 variant ds_map_find_next(const unsigned int id, const variant key)
 {
   //Returns the smallest key in the map larger than the indicated key
-  multimap<variant, variant>::iterator it;
-  variant key_check;
-  for (it = ds_maps[id].begin(); it != ds_maps[id].end(); it++)
-  {
-    if ((key_check = (*it).first) > key)
-    {
-      return key_check;
-    }
-  }
-  return 0;
+  const enigma::variant_map &dsMap = ds_maps[id];
+  const variant *best = NULL;
+  for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    if (it->key > key && (!best || it->key < *best))
+      best = &it->key;
+  return best ? *best : variant(0);
 }
 
 variant ds_map_find_first(const unsigned int id)
 {
   //Returns the smallest key in the map
-  multimap<variant, variant>::iterator it = ds_maps[id].begin();
-  return (it == ds_maps[id].end()) ? variant() : (*it).first;
+  const enigma::variant_map &dsMap = ds_maps[id];
+  const variant *best = NULL;
+  for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    if (!best || it->key < *best)
+      best = &it->key;
+  return best ? *best : variant();
 }
 
 variant ds_map_find_last(const unsigned int id)
 {
   //Returns the largest key in the map
-  multimap<variant, variant>::reverse_iterator rit = ds_maps[id].rbegin();
-  return ((rit == ds_maps[id].rend()) ? variant() : (*rit).first);
+  const enigma::variant_map &dsMap = ds_maps[id];
+  const variant *best = NULL;
+  for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    if (!best || it->key > *best)
+      best = &it->key;
+  return best ? *best : variant();
 }
 
 bool ds_map_exists(const unsigned int id)
@@ -997,7 +1142,7 @@ bool ds_map_exists(const unsigned int id)
 unsigned int ds_map_duplicate(const unsigned int source)
 {
   //creates and returns a new map containing a copy of the source map
-  ds_maps.insert(pair<unsigned int, multimap<variant, variant> >(++ds_maps_maxid, multimap<variant, variant>()));
+  ds_maps.insert(pair<unsigned int, enigma::variant_map>(++ds_maps_maxid, enigma::variant_map()));
   ds_maps[ds_maps_maxid-1] = ds_maps[source];
   return ds_maps_maxid-1;
 }
@@ -1009,51 +1154,51 @@ std::string ds_map_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  std::multimap<variant, variant> dsMap = ds_maps[id];
+  const enigma::variant_map &dsMap = ds_maps[id];
 
   // Write size
   ss << std::hex << dsMap.size();
 
-  std::multimap<variant, variant>::iterator it = dsMap.begin();
+  enigma::variant_map::const_iterator it = dsMap.begin();
   while (it != dsMap.end())
   {
     // Write type
     ss.width(2);
-    ss << (unsigned int)(((*it).first.type == ty_real) ? 0x00 : 0x01);
+    ss << (unsigned int)(((*it).key.type == ty_real) ? 0x00 : 0x01);
 
     // Write data
-    if ((*it).first.type == ty_real)
+    if ((*it).key.type == ty_real)
     {
       ss.width(16);
-            char* b = (char*)&(*it).first.rval.d;
+            char* b = (char*)&(*it).key.rval.d;
             for (unsigned i = 0; i < sizeof(double); ++i)
             ss << b[i];
     }
     else
     {
-      ss.width(4); ss << (*it).first.sval.length();
+      ss.width(4); ss << (*it).key.sval().length();
       ss.width(1);
-      for (size_t j = 0; j < (*it).first.sval.length(); ++j)
-        ss << (*it).first.sval[j];
+      for (size_t j = 0; j < (*it).key.sval().length(); ++j)
+        ss << (*it).key.sval()[j];
     }
 
     // Write type
     ss.width(2);
-    ss << (unsigned int)(((*it).second.type == ty_real) ? 0x00 : 0x01);
+    ss << (unsigned int)(((*it).value.type == ty_real) ? 0x00 : 0x01);
 
     // Write data
-    if ((*it).second.type == ty_real)
+    if ((*it).value.type == ty_real)
     {
       ss.width(16);
-      char* b = (char*)&(*it).second.rval.d;
+      char* b = (char*)&(*it).value.rval.d;
       for (unsigned i = 0; i < sizeof(double); ++i)
         ss << b[i];    }
     else
     {
-      ss.width(4); ss << (*it).second.sval.length();
+      ss.width(4); ss << (*it).value.sval().length();
       ss.width(1);
-      for (size_t j = 0; j < (*it).second.sval.length(); ++j)
-        ss << (*it).second.sval[j];
+      for (size_t j = 0; j < (*it).value.sval().length(); ++j)
+        ss << (*it).value.sval()[j];
     }
 
     ++it;
@@ -1094,8 +1239,7 @@ void ds_map_read(const unsigned int id, std::string value)
       ss.clear();
       i += 16;
 
-      variKey.rval.d = d;
-      variKey.type = ty_real;
+      variKey = d;
     }
     else
     {
@@ -1106,9 +1250,7 @@ void ds_map_read(const unsigned int id, std::string value)
       ss >> len;
       ss.clear();
       i += 4;
-
-      variKey.type = ty_string;
-      variKey.sval = value.substr(i, len);
+      variKey = value.substr(i, len);
       i += len;
     }
 
@@ -1128,8 +1270,7 @@ void ds_map_read(const unsigned int id, std::string value)
       ss.clear();
       i += 16;
 
-      variValue.rval.d = d;
-      variValue.type = ty_real;
+      variValue = d;
     }
     else
     {
@@ -1140,14 +1281,12 @@ void ds_map_read(const unsigned int id, std::string value)
       ss >> len;
       ss.clear();
       i += 4;
-
-      variValue.type = ty_string;
-      variValue.sval = value.substr(i, len);
+      variValue = value.substr(i, len);
       i += len;
     }
 
     // Push value
-    ds_maps[id].insert(std::pair<variant, variant>(variKey, variValue));
+    ds_maps[id].insert(variKey, variValue);
   }
 }
 
@@ -1301,7 +1440,7 @@ std::string ds_list_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  std::vector<variant> dsList = ds_lists[id];
+  const std::vector<variant> &dsList = ds_lists[id];
 
   // Write count
   ss << dsList.size();
@@ -1321,10 +1460,10 @@ std::string ds_list_write(const unsigned int id)
     }
     else
     {
-      ss.width(4); ss << dsList[i].sval.length();
+      ss.width(4); ss << dsList[i].sval().length();
       ss.width(1);
-      for (size_t j = 0; j < dsList[i].sval.length(); ++j)
-        ss << dsList[i].sval[j];
+      for (size_t j = 0; j < dsList[i].sval().length(); ++j)
+        ss << dsList[i].sval()[j];
     }
   }
 
@@ -1371,7 +1510,6 @@ void ds_list_read(const unsigned int id, std::string value)
     else
     {
       variant vari;
-      vari.type = ty_string;
       int len;
 
       // Read length
@@ -1380,7 +1518,7 @@ void ds_list_read(const unsigned int id, std::string value)
       ss.clear();
       i += 4;
 
-      vari.sval = value.substr(i, len);
+      vari = value.substr(i, len);
       i += len;
 
       ds_lists[id].push_back(vari);
@@ -1556,12 +1694,12 @@ std::string ds_priority_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  std::multimap<variant, variant> dsPriority = ds_prioritys[id];
+  const std::multimap<variant, variant> &dsPriority = ds_prioritys[id];
 
   // Write size
   ss << std::hex << dsPriority.size();
 
-  std::multimap<variant, variant>::iterator it = dsPriority.begin();
+  std::multimap<variant, variant>::const_iterator it = dsPriority.begin();
   while (it != dsPriority.end())
   {
     // Write type
@@ -1582,10 +1720,10 @@ std::string ds_priority_write(const unsigned int id)
     }
     else
     {
-      ss.width(4); ss << (*it).first.sval.length();
+      ss.width(4); ss << (*it).first.sval().length();
       ss.width(1);
-      for (size_t j = 0; j < (*it).first.sval.length(); ++j)
-        ss << (*it).first.sval[j];
+      for (size_t j = 0; j < (*it).first.sval().length(); ++j)
+        ss << (*it).first.sval()[j];
     }
 
     ++it;
@@ -1638,8 +1776,7 @@ void ds_priority_read(const unsigned int id, std::string value)
       ss.clear();
       i += 16;
 
-      vari.rval.d = d;
-      vari.type = ty_real;
+      vari = d;
     }
     else
     {
@@ -1650,9 +1787,7 @@ void ds_priority_read(const unsigned int id, std::string value)
       ss >> len;
       ss.clear();
       i += 4;
-
-      vari.type = ty_string;
-      vari.sval = value.substr(i, len);
+      vari = value.substr(i, len);
       i += len;
     }
 
@@ -1760,7 +1895,7 @@ std::string ds_queue_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  std::deque<variant> dsQueue = ds_queues[id];
+  const std::deque<variant> &dsQueue = ds_queues[id];
 
   // Write size
   ss << std::hex << dsQueue.size();
@@ -1781,10 +1916,10 @@ std::string ds_queue_write(const unsigned int id)
     }
     else
     {
-      ss.width(4); ss << dsQueue[i].sval.length();
+      ss.width(4); ss << dsQueue[i].sval().length();
       ss.width(1);
-      for (size_t j = 0; j < dsQueue[i].sval.length(); ++j)
-        ss << dsQueue[i].sval[j];
+      for (size_t j = 0; j < dsQueue[i].sval().length(); ++j)
+        ss << dsQueue[i].sval()[j];
     }
   }
 
@@ -1823,8 +1958,7 @@ void ds_queue_read(const unsigned int id, std::string value)
       ss.clear();
       i += 16;
 
-      vari.rval.d = d;
-      vari.type = ty_real;
+      vari = d;
     }
     else
     {
@@ -1835,9 +1969,7 @@ void ds_queue_read(const unsigned int id, std::string value)
       ss >> len;
       ss.clear();
       i += 4;
-
-      vari.type = ty_string;
-      vari.sval = value.substr(i, len);
+      vari = value.substr(i, len);
       i += len;
     }
 
@@ -1938,7 +2070,7 @@ std::string ds_stack_write(const unsigned int id)
   ss.width(4);
   ss.fill('0');
 
-  std::deque<variant> dsStack = ds_stacks[id];
+  const std::deque<variant> &dsStack = ds_stacks[id];
 
   // Write size
   ss << std::hex << dsStack.size();
@@ -1959,10 +2091,10 @@ std::string ds_stack_write(const unsigned int id)
     }
     else
     {
-      ss.width(4); ss << dsStack[i].sval.length();
+      ss.width(4); ss << dsStack[i].sval().length();
       ss.width(1);
-      for (size_t j = 0; j < dsStack[i].sval.length(); ++j)
-        ss << dsStack[i].sval[j];
+      for (size_t j = 0; j < dsStack[i].sval().length(); ++j)
+        ss << dsStack[i].sval()[j];
     }
   }
 
@@ -2001,8 +2133,7 @@ void ds_stack_read(const unsigned int id, std::string value)
       ss.clear();
       i += 16;
 
-      vari.rval.d = d;
-      vari.type = ty_real;
+      vari = d;
     }
     else
     {
@@ -2013,9 +2144,7 @@ void ds_stack_read(const unsigned int id, std::string value)
       ss >> len;
       ss.clear();
       i += 4;
-
-      vari.type = ty_string;
-      vari.sval = value.substr(i, len);
+      vari = value.substr(i, len);
       i += len;
     }
 
@@ -2025,3 +2154,320 @@ void ds_stack_read(const unsigned int id, std::string value)
 }
 
 }
+
+/* Binary serialization */
+
+// Each structure is written as a self-delimiting record: the bytes 'D' 'S',
+// its kind, the format version, then its contents. A value is a tag byte
+// followed by a little-endian double, or a u32 length and the string's bytes.
+// Maps and lists added to a map with ds_map_add_map/ds_map_add_list are
+// written in place as records of their own. Records can be written back to
+// back into one buffer and read one at a time as the data becomes available.
+
+namespace {
+
+using namespace enigma_user;
+
+enum { ds_kind_grid = 1, ds_kind_list, ds_kind_map, ds_kind_priority, ds_kind_queue, ds_kind_stack };
+enum { ds_tag_real, ds_tag_string, ds_tag_undefined, ds_tag_map, ds_tag_list };
+const unsigned char ds_format_version = 1;
+const unsigned ds_max_depth = 256;
+
+struct ds_writer
+{
+  enigma::BinaryBuffer *buf;
+  vector<unsigned int> open_maps; // Maps being written, so reference cycles are cut
+
+  ds_writer(enigma::BinaryBuffer *b): buf(b) {}
+
+  void u8(unsigned char v) { buf->Write(&v, 1); }
+  void u32(uint32_t v) { buf->Write(&v, sizeof(v)); }
+  void header(unsigned char kind)
+  {
+    const unsigned char h[4] = { 'D', 'S', kind, ds_format_version };
+    buf->Write(h, sizeof(h));
+  }
+
+  void value(const variant &v)
+  {
+    if (v.type == ty_string) {
+      const string &s = v.sval();
+      u8(ds_tag_string);
+      u32(s.length());
+      buf->Write(s.data(), s.length());
+    }
+    else if (v.type == ty_real) {
+      u8(ds_tag_real);
+      buf->Write(&v.rval.d, sizeof(double));
+    }
+    else u8(ds_tag_undefined);
+  }
+
+  template<typename container> void values(unsigned char kind, const container &c)
+  {
+    header(kind);
+    u32(c.size());
+    for (typename container::const_iterator it = c.begin(); it != c.end(); ++it)
+      value(*it);
+  }
+
+  void map(unsigned int id)
+  {
+    const enigma::variant_map &dsMap = ds_maps[id];
+    header(ds_kind_map);
+    u32(dsMap.size());
+    open_maps.push_back(id);
+    for (enigma::variant_map::const_iterator it = dsMap.begin(); it != dsMap.end(); ++it)
+    {
+      value(it->key);
+      const unsigned int nid = (unsigned int) it->value;
+      if (it->nested == enigma::variant_map::NESTED_MAP && ds_maps.count(nid) && open_maps.size() < ds_max_depth
+          && std::find(open_maps.begin(), open_maps.end(), nid) == open_maps.end())
+        u8(ds_tag_map), map(nid);
+      else if (it->nested == enigma::variant_map::NESTED_LIST && ds_lists.count(nid))
+        u8(ds_tag_list), values(ds_kind_list, ds_lists[nid]);
+      else
+        value(it->value);
+    }
+    open_maps.pop_back();
+  }
+};
+
+struct ds_reader
+{
+  enigma::BinaryBuffer *buf;
+  bool ok;
+  unsigned depth;
+  vector<pair<unsigned int, unsigned char> > created; // Nested structures made so far, freed if the record is bad
+
+  ds_reader(enigma::BinaryBuffer *b): buf(b), ok(true), depth(0) {}
+
+  unsigned remaining() const { return buf->position < buf->GetSize() ? buf->GetSize() - buf->position : 0; }
+  void read(void *dst, unsigned n) { if (ok && !buf->Read(dst, n)) ok = false; }
+  unsigned char u8() { unsigned char v = 0; read(&v, sizeof(v)); return v; }
+  uint32_t u32() { uint32_t v = 0; read(&v, sizeof(v)); return v; }
+  // Reads a count of items that each take at least one byte, rejecting
+  // counts the remaining data can't hold before anything is allocated.
+  uint32_t count() { uint32_t n = u32(); if (n > remaining()) ok = false; return ok ? n : 0; }
+  bool header(unsigned char kind)
+  {
+    unsigned char h[4] = {};
+    read(h, sizeof(h));
+    if (h[0] != 'D' || h[1] != 'S' || h[2] != kind || h[3] != ds_format_version) ok = false;
+    return ok;
+  }
+
+  // Reads a value; nested maps and lists are only accepted where the caller
+  // can own them, which is as the value of a map entry.
+  variant value(unsigned char *nested = NULL)
+  {
+    if (nested) *nested = enigma::variant_map::PLAIN;
+    switch (u8())
+    {
+      case ds_tag_real: {
+        double d = 0;
+        read(&d, sizeof(d));
+        return d;
+      }
+      case ds_tag_string: {
+        const uint32_t n = count();
+        string s(n, '\0');
+        if (n) read(&s[0], n);
+        return s;
+      }
+      case ds_tag_undefined:
+        return variant();
+      case ds_tag_map: {
+        if (!nested || ++depth > ds_max_depth) break;
+        const unsigned int id = ds_map_create();
+        created.push_back(make_pair(id, enigma::variant_map::NESTED_MAP));
+        map(ds_maps[id]);
+        --depth;
+        *nested = enigma::variant_map::NESTED_MAP;
+        return id;
+      }
+      case ds_tag_list: {
+        if (!nested) break;
+        vector<variant> items;
+        if (header(ds_kind_list)) values(items);
+        if (!ok) return variant();
+        const unsigned int id = ds_list_create();
+        created.push_back(make_pair(id, enigma::variant_map::NESTED_LIST));
+        ds_lists[id].swap(items);
+        *nested = enigma::variant_map::NESTED_LIST;
+        return id;
+      }
+    }
+    ok = false;
+    return variant();
+  }
+
+  template<typename container> void values(container &c)
+  {
+    for (uint32_t n = count(); n && ok; --n)
+    {
+      const variant v = value();
+      if (ok) c.push_back(v);
+    }
+  }
+
+  // Fills dsMap only once every entry has been read
+  void map(enigma::variant_map &dsMap)
+  {
+    if (!header(ds_kind_map)) return;
+    struct entry { variant key, value; unsigned char nested; };
+    vector<entry> entries;
+    for (uint32_t n = count(); n && ok; --n)
+    {
+      entry e;
+      e.key = value();
+      e.value = value(&e.nested);
+      if (ok) entries.push_back(e);
+    }
+    if (!ok) return;
+    dsMap.reserve(dsMap.size() + entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+      dsMap.insert(entries[i].key, entries[i].value, entries[i].nested);
+  }
+
+  // Frees what a bad record created, innermost first so no map frees a structure twice
+  void discard()
+  {
+    for (size_t i = created.size(); i--; )
+      if (created[i].second == enigma::variant_map::NESTED_MAP) {
+        if (ds_map_exists(created[i].first)) ds_map_destroy(created[i].first);
+      }
+      else if (ds_list_exists(created[i].first)) ds_list_destroy(created[i].first);
+    created.clear();
+  }
+};
+
+// Reads one record. The body decodes into temporaries and only touches the
+// structure once the whole record has been read, so on bad or truncated data
+// the structure is left as it was and the buffer is rewound to where it started.
+template<typename body> bool ds_read_record(enigma::BinaryBuffer *buf, body read)
+{
+  ds_reader r(buf);
+  const unsigned start = buf->position;
+  read(r);
+  if (!r.ok) buf->position = start, r.discard();
+  return r.ok;
+}
+
+// Appends a list, queue or stack record to c
+template<typename container> void ds_read_values(ds_reader &r, unsigned char kind, container &c)
+{
+  container items;
+  if (r.header(kind)) r.values(items);
+  if (r.ok) c.insert(c.end(), items.begin(), items.end());
+}
+
+}
+
+namespace enigma_user
+{
+
+void ds_grid_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer w(binbuff);
+  variant_grid &dsGrid = ds_grids[id];
+  w.header(ds_kind_grid);
+  w.u32(dsGrid.width());
+  w.u32(dsGrid.height());
+  for (unsigned y = 0; y < dsGrid.height(); ++y)
+    for (unsigned x = 0; x < dsGrid.width(); ++x)
+      w.value(dsGrid.find(x, y));
+}
+
+bool ds_grid_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) {
+    if (!r.header(ds_kind_grid)) return;
+    const uint32_t w = r.u32(), h = r.u32();
+    if (!r.ok || (uint64_t) w * h > r.remaining()) { r.ok = false; return; }
+    variant_grid cells(w, h);
+    for (unsigned y = 0; y < h && r.ok; ++y)
+      for (unsigned x = 0; x < w && r.ok; ++x)
+        cells.insert(x, y, r.value());
+    if (r.ok) std::swap(cells, ds_grids[id]);
+    cells.destroy();
+  });
+}
+
+void ds_map_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer(binbuff).map(id);
+}
+
+bool ds_map_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) { r.map(ds_maps[id]); });
+}
+
+void ds_list_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer(binbuff).values(ds_kind_list, ds_lists[id]);
+}
+
+bool ds_list_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) { ds_read_values(r, ds_kind_list, ds_lists[id]); });
+}
+
+void ds_priority_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer w(binbuff);
+  const multimap<variant, variant> &dsPriority = ds_prioritys[id];
+  w.header(ds_kind_priority);
+  w.u32(dsPriority.size());
+  for (multimap<variant, variant>::const_iterator it = dsPriority.begin(); it != dsPriority.end(); ++it)
+    w.value(it->first), w.value(it->second);
+}
+
+bool ds_priority_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) {
+    if (!r.header(ds_kind_priority)) return;
+    vector<pair<variant, variant> > items;
+    for (uint32_t n = r.count(); n && r.ok; --n)
+    {
+      const variant val = r.value(), prio = r.value();
+      if (r.ok) items.push_back(pair<variant, variant>(val, prio));
+    }
+    if (r.ok) ds_prioritys[id].insert(items.begin(), items.end());
+  });
+}
+
+void ds_queue_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer(binbuff).values(ds_kind_queue, ds_queues[id]);
+}
+
+bool ds_queue_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) { ds_read_values(r, ds_kind_queue, ds_queues[id]); });
+}
+
+void ds_stack_write_buffer(const unsigned int id, const int buffer)
+{
+  get_buffer(binbuff, buffer);
+  ds_writer(binbuff).values(ds_kind_stack, ds_stacks[id]);
+}
+
+bool ds_stack_read_buffer(const unsigned int id, const int buffer)
+{
+  get_bufferr(binbuff, buffer, false);
+  return ds_read_record(binbuff, [id](ds_reader &r) { ds_read_values(r, ds_kind_stack, ds_stacks[id]); });
+}
+
+}
@@ -0,0 +1,242 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_DATASTRUCTURES_GRID_KERNELS_H
+#define ENIGMA_DATASTRUCTURES_GRID_KERNELS_H
+
+#include "Universal_System/var4.h"
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Row-at-a-time building blocks for ds_grid. Every region and disk operation
+// is reduced to runs of adjacent cells in one row, so the loops below see
+// plain arrays; the double versions are written so the compiler can keep
+// several lanes in flight and vectorize them.
+namespace enigma
+{
+  // The cells [x1, x2) by [y1, y2) that a region call touches once its
+  // corners are put in order and clipped to a w by h grid.
+  struct grid_rect {
+    int x1, y1, x2, y2;
+    grid_rect(unsigned ax1, unsigned ay1, unsigned ax2, unsigned ay2, unsigned w, unsigned h) {
+      const int tx1 = std::min(ax1, ax2), ty1 = std::min(ay1, ay2), tx2 = std::max(ax1, ax2), ty2 = std::max(ay1, ay2);
+      const int xd = w - tx1, yd = h - ty1;
+      if (xd > 0 && yd > 0) {
+        x1 = std::max(tx1, 0); y1 = std::max(ty1, 0);
+        x2 = std::min(tx2 + 1, int(w)); y2 = std::min(ty2 + 1, int(h));
+      }
+      else x1 = y1 = x2 = y2 = 0;
+    }
+    bool empty() const { return x1 >= x2 || y1 >= y2; }
+  };
+
+  // The cells of a disk as one span of columns [lo, hi) per row, clipped to a
+  // w by h grid. A span is estimated with a square root and then nudged until
+  // it holds exactly the cells that pass the distance test, so the result
+  // matches testing every cell in the bounding box.
+  class disk_rows
+  {
+    public:
+    int y1, y2;
+
+    disk_rows(double x, double y, double r, unsigned w, unsigned h): y1(0), y2(0), count(0) {
+      const int tx1 = int(x - r), ty1 = int(y - r), tx2 = int(x + r + 1), ty2 = int(y + r + 1);
+      in_grid = tx2 >= 0 && ty2 >= 0 && tx1 < int(w) && ty1 < int(h);
+      if (!in_grid) return;
+      const int px1 = std::max(tx1, 0), px2 = std::min(tx2, int(w));
+      y1 = std::max(ty1, 0); y2 = std::max(std::min(ty2, int(h)), y1);
+      spans.resize(y2 - y1);
+      const double rr = r*r;
+      for (int i = y1; i < y2; i++) {
+        const double dy2 = (y - i)*(y - i);
+        int lo = px1, hi = px1;
+        if (px1 < px2 && rr - dy2 >= 0) {
+          const double s = sqrt(rr - dy2);
+          lo = clamp(ceil(x - s), px1, px2);
+          hi = std::max(clamp(floor(x + s) + 1, px1, px2), lo);
+          while (lo > px1 && inside(x, dy2, rr, lo - 1)) --lo;
+          while (lo < hi && !inside(x, dy2, rr, lo)) ++lo;
+          while (hi < px2 && inside(x, dy2, rr, hi)) ++hi;
+          while (hi > lo && !inside(x, dy2, rr, hi - 1)) --hi;
+        }
+        spans[i - y1] = std::make_pair(lo, hi);
+        count += hi - lo;
+      }
+    }
+
+    // Whether the disk's bounding box overlaps the grid at all.
+    bool overlaps() const { return in_grid; }
+    // Number of cells inside the disk.
+    unsigned cells() const { return count; }
+    int lo(int row) const { return spans[row - y1].first; }
+    int hi(int row) const { return spans[row - y1].second; }
+
+    private:
+    std::vector<std::pair<int, int> > spans;
+    unsigned count;
+    bool in_grid;
+
+    static bool inside(double x, double dy2, double rr, int col) {
+      return (x - col)*(x - col) + dy2 <= rr;
+    }
+    static int clamp(double v, int lo, int hi) {
+      return v <= lo ? lo : v >= hi ? hi : int(v);
+    }
+  };
+
+  // Cell equality for searches. Reals compare with the same tolerance as
+  // variant's operator==, so a search gives the same answer in either mode.
+  inline bool cell_equal(double a, double b) { return fabs(a - b) < 1e-12; }
+  inline bool cell_equal(const variant &a, const variant &b) { return a == b; }
+
+  template<typename t, typename v> inline void fill_row(t *row, int n, const v &val) {
+    for (int i = 0; i < n; ++i) row[i] = val;
+  }
+  template<typename t, typename v> inline void add_row(t *row, int n, const v &val) {
+    for (int i = 0; i < n; ++i) row[i] += val;
+  }
+  template<typename t> inline void multiply_row(t *row, int n, double val) {
+    for (int i = 0; i < n; ++i) row[i] *= val;
+  }
+
+  // Row-by-row combination with a source row; rows may overlap when a grid
+  // is combined with itself, so these run strictly front to back.
+  template<typename t, typename s> inline void copy_row(t *row, const s *src, int n) {
+    for (int i = 0; i < n; ++i) row[i] = src[i];
+  }
+  template<typename t, typename s> inline void add_row(t *row, const s *src, int n) {
+    for (int i = 0; i < n; ++i) row[i] += src[i];
+  }
+  template<typename t, typename s> inline void multiply_row(t *row, const s *src, int n) {
+    for (int i = 0; i < n; ++i) row[i] *= src[i];
+  }
+
+  template<typename t, typename a> inline void sum_row(const t *row, int n, a &sum) {
+    for (int i = 0; i < n; ++i) sum += row[i];
+  }
+  inline void sum_row(const double *row, int n, double &sum) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+      s0 += row[i], s1 += row[i + 1], s2 += row[i + 2], s3 += row[i + 3];
+    for (; i < n; ++i) s0 += row[i];
+    sum += (s0 + s1) + (s2 + s3);
+  }
+
+  template<typename t> inline void max_row(const t *row, int n, t &m) {
+    for (int i = 0; i < n; ++i) if (row[i] > m) m = row[i];
+  }
+  template<typename t> inline void min_row(const t *row, int n, t &m) {
+    for (int i = 0; i < n; ++i) if (row[i] < m) m = row[i];
+  }
+  inline void max_row(const double *row, int n, double &m) {
+    double m0 = m, m1 = m, m2 = m, m3 = m;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+      m0 = row[i] > m0 ? row[i] : m0;         m1 = row[i + 1] > m1 ? row[i + 1] : m1;
+      m2 = row[i + 2] > m2 ? row[i + 2] : m2; m3 = row[i + 3] > m3 ? row[i + 3] : m3;
+    }
+    for (; i < n; ++i) m0 = row[i] > m0 ? row[i] : m0;
+    m0 = m1 > m0 ? m1 : m0; m2 = m3 > m2 ? m3 : m2;
+    m = m2 > m0 ? m2 : m0;
+  }
+  inline void min_row(const double *row, int n, double &m) {
+    double m0 = m, m1 = m, m2 = m, m3 = m;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+      m0 = row[i] < m0 ? row[i] : m0;         m1 = row[i + 1] < m1 ? row[i + 1] : m1;
+      m2 = row[i + 2] < m2 ? row[i + 2] : m2; m3 = row[i + 3] < m3 ? row[i + 3] : m3;
+    }
+    for (; i < n; ++i) m0 = row[i] < m0 ? row[i] : m0;
+    m0 = m1 < m0 ? m1 : m0; m2 = m3 < m2 ? m3 : m2;
+    m = m2 < m0 ? m2 : m0;
+  }
+
+  // Index of the first cell equal to val, or n.
+  template<typename t> inline int find_row(const t *row, int n, const t &val) {
+    for (int i = 0; i < n; ++i) if (cell_equal(row[i], val)) return i;
+    return n;
+  }
+  inline int find_row(const double *row, int n, const double &val) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+      if (cell_equal(row[i], val) | cell_equal(row[i + 1], val) | cell_equal(row[i + 2], val) | cell_equal(row[i + 3], val))
+        break;
+    for (; i < n; ++i) if (cell_equal(row[i], val)) return i;
+    return n;
+  }
+
+  // a + b as the rounded sum s plus the exact rounding error e.
+  inline void two_sum(double a, double b, double &s, double &e) {
+    s = a + b;
+    const double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+  }
+
+  // Prefix sums over a grid of doubles, so that the sum of any rectangle is
+  // four lookups. Entry (x, y) holds the sum of every cell left of column x
+  // and above row y, kept as a rounded sum plus its rounding error so that
+  // a small region beside huge values doesn't cancel away to nothing.
+  class summed_area_table
+  {
+    struct entry { double hi, lo; };
+    std::vector<entry> sums;
+    unsigned stride;
+
+    public:
+    summed_area_table(): stride(0) {}
+
+    // Returns false, leaving the table unusable, if any partial sum is not
+    // finite; differences of infinities would not give the region's sum.
+    bool build(const double *cells, unsigned w, unsigned h) {
+      stride = w + 1;
+      const entry zero = { 0.0, 0.0 };
+      sums.assign(size_t(stride) * (h + 1), zero);
+      for (unsigned y = 0; y < h; ++y) {
+        const double *row = cells + size_t(y) * w;
+        const entry *above = &sums[size_t(y) * stride];
+        entry *out = &sums[size_t(y + 1) * stride];
+        double run = 0, run_lo = 0, e;
+        for (unsigned x = 0; x < w; ++x) {
+          two_sum(run, row[x], run, e);
+          run_lo += e;
+          entry &o = out[x + 1];
+          two_sum(above[x + 1].hi, run, o.hi, e);
+          two_sum(o.hi, above[x + 1].lo + run_lo + e, o.hi, o.lo);
+        }
+      }
+      // Infinities and NaNs are absorbing, so they all reach the last entry.
+      return std::isfinite(sums.back().hi);
+    }
+
+    void clear() { sums.clear(); }
+
+    double sum(int x1, int y1, int x2, int y2) const {
+      const entry *top = &sums[size_t(y1) * stride], *bottom = &sums[size_t(y2) * stride];
+      double s, e, err;
+      two_sum(bottom[x2].hi, -bottom[x1].hi, s, err);
+      two_sum(s, -top[x2].hi, s, e); err += e;
+      two_sum(s, top[x1].hi, s, e); err += e;
+      return s + (err + ((bottom[x2].lo - bottom[x1].lo) - (top[x2].lo - top[x1].lo)));
+    }
+  };
+}
+
+#endif
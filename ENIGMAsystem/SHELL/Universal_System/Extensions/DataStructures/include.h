@@ -73,14 +73,19 @@ bool ds_grid_exists(const unsigned int id);
 unsigned int ds_grid_duplicate(const unsigned int source);
 std::string ds_grid_write(const unsigned int id);
 void ds_grid_read(const unsigned int id, std::string value);
+void ds_grid_write_buffer(const unsigned int id, const int buffer);
+bool ds_grid_read_buffer(const unsigned int id, const int buffer);
 
 unsigned int ds_map_create();
 void ds_map_destroy(const unsigned int id);
 void ds_map_clear(const unsigned int id);
 void ds_map_copy(const unsigned int id, const unsigned int source);
+void ds_map_reserve(const unsigned int id, const unsigned int n);
 unsigned int ds_map_size(const unsigned int id);
 bool ds_map_empty(const unsigned int id);
 void ds_map_add(const unsigned int id, const variant key, const variant val);
+void ds_map_add_map(const unsigned int id, const variant key, const unsigned int value);
+void ds_map_add_list(const unsigned int id, const variant key, const unsigned int value);
 void ds_map_replace(const unsigned int id, const variant key, const variant val);
 void ds_map_replaceanyway(const unsigned int id, const variant key, const variant val);
 void ds_map_delete(const unsigned int id, const variant key);
@@ -95,6 +100,8 @@ bool ds_map_exists(const unsigned int id);
 unsigned int ds_map_duplicate(const unsigned int source);
 std::string ds_map_write(const unsigned int source);
 void ds_map_read(const unsigned int id, std::string value);
+void ds_map_write_buffer(const unsigned int id, const int buffer);
+bool ds_map_read_buffer(const unsigned int id, const int buffer);
 
 unsigned int ds_list_create();
 void ds_list_destroy(const unsigned int id);
@@ -115,6 +122,8 @@ bool ds_list_exists(const unsigned int id);
 unsigned int ds_list_duplicate(const unsigned int source);
 std::string ds_list_write(const unsigned int id);
 void ds_list_read(const unsigned int id, std::string value);
+void ds_list_write_buffer(const unsigned int id, const int buffer);
+bool ds_list_read_buffer(const unsigned int id, const int buffer);
 
 unsigned int ds_priority_create();
 void ds_priority_destroy(const unsigned int id);
@@ -135,6 +144,8 @@ bool ds_priority_exists(const unsigned int id);
 unsigned int ds_priority_duplicate(const unsigned int source);
 std::string ds_priority_write(const unsigned int id);
 void ds_priority_read(const unsigned int id, std::string value);
+void ds_priority_write_buffer(const unsigned int id, const int buffer);
+bool ds_priority_read_buffer(const unsigned int id, const int buffer);
 
 unsigned int ds_queue_create();
 void ds_queue_destroy(const unsigned int id);
@@ -150,6 +161,8 @@ bool ds_queue_exists(const unsigned int id);
 unsigned int ds_queue_duplicate(const unsigned int source);
 std::string ds_queue_write(const unsigned int id);
 void ds_queue_read(const unsigned int id, std::string value);
+void ds_queue_write_buffer(const unsigned int id, const int buffer);
+bool ds_queue_read_buffer(const unsigned int id, const int buffer);
 
 unsigned int ds_stack_create();
 void ds_stack_destroy(const unsigned int id);
@@ -164,6 +177,8 @@ bool ds_stack_exists(const unsigned int id);
 unsigned int ds_stack_duplicate(const unsigned int source);
 std::string ds_stack_write(const unsigned int id);
 void ds_stack_read(const unsigned int id, std::string value);
+void ds_stack_write_buffer(const unsigned int id, const int buffer);
+bool ds_stack_read_buffer(const unsigned int id, const int buffer);
 
 }
 
@@ -0,0 +1,212 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_DATASTRUCTURES_VARIANT_MAP_H
+#define ENIGMA_DATASTRUCTURES_VARIANT_MAP_H
+
+#include "Universal_System/var4.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace enigma
+{
+  // Keys match exactly, as they did under the old ordered map. The map interns
+  // string keys on the way in, so two are equal exactly when their bodies are.
+  inline bool variant_key_equal(const variant &a, const variant &b) {
+    if (a.type != b.type) return false;
+    if (a.type == enigma_user::ty_string || a.type == enigma_user::ty_pointer)
+      return a.rval.p == b.rval.p;
+    return a.rval.d == b.rval.d;
+  }
+
+  inline uint32_t variant_key_hash(const variant &v) {
+    uint64_t bits;
+    if (v.type == enigma_user::ty_string || v.type == enigma_user::ty_pointer)
+      bits = (uintptr_t) v.rval.p;
+    else {
+      double d = v.rval.d == 0 ? 0.0 : v.rval.d; // -0 and 0 are the same key
+      memcpy(&bits, &d, sizeof(bits));
+    }
+    bits = (bits ^ uint64_t(v.type)) * 0x9E3779B97F4A7C15ull;
+    return uint32_t(bits >> 32);
+  }
+
+  // Open-addressing hash map from variant to variant. Entries are stored
+  // densely in insertion order with their hashes cached; a linearly probed
+  // index table maps hashes to entries. Erased entries are left as holes
+  // until the next rebuild, so iteration order is stable across erases.
+  class variant_map
+  {
+    public:
+    // What an entry's value refers to, for maps that own nested structures.
+    enum { PLAIN, NESTED_MAP, NESTED_LIST };
+
+    struct entry {
+      variant key, value;
+      uint32_t hash;
+      bool live;
+      unsigned char nested;
+    };
+
+    class const_iterator {
+      const entry *it, *end;
+      void skip() { while (it != end && !it->live) ++it; }
+      public:
+      const_iterator(const entry *b, const entry *e): it(b), end(e) { skip(); }
+      const entry &operator*() const { return *it; }
+      const entry *operator->() const { return it; }
+      const_iterator &operator++() { ++it; skip(); return *this; }
+      bool operator!=(const const_iterator &o) const { return it != o.it; }
+      bool operator==(const const_iterator &o) const { return it == o.it; }
+    };
+
+    variant_map(): live_count(0), used_slots(0) {}
+
+    size_t size() const { return live_count; }
+    bool empty() const { return !live_count; }
+
+    const_iterator begin() const { return const_iterator(entries.data(), entries.data() + entries.size()); }
+    const_iterator end() const { return const_iterator(entries.data() + entries.size(), entries.data() + entries.size()); }
+
+    void clear() {
+      entries.clear();
+      slots.clear();
+      live_count = used_slots = 0;
+    }
+
+    // Makes room for n entries without rehashing along the way.
+    void reserve(size_t n) {
+      entries.reserve(n);
+      if (n * 2 > slots.size()) rebuild(n);
+    }
+
+    // The entry stored under key, or NULL.
+    const entry *find_entry(const variant &k) const {
+      if (slots.empty()) return NULL;
+      const variant key = intern(k);
+      const uint32_t h = variant_key_hash(key);
+      for (size_t s = h & (slots.size() - 1); ; s = (s + 1) & (slots.size() - 1)) {
+        const int32_t e = slots[s];
+        if (e == EMPTY) return NULL;
+        if (e != REMOVED && entries[e].hash == h && variant_key_equal(entries[e].key, key))
+          return &entries[e];
+      }
+    }
+
+    // The value stored under key, or NULL.
+    const variant *find(const variant &key) const {
+      const entry *e = find_entry(key);
+      return e ? &e->value : NULL;
+    }
+
+    // Adds key if it is not already present; returns whether it was added.
+    bool insert(const variant &key, const variant &value, unsigned char nested = PLAIN) {
+      return add(key, value, nested, false);
+    }
+
+    // Adds key, or overwrites its value if it is already present.
+    void assign(const variant &key, const variant &value, unsigned char nested = PLAIN) {
+      add(key, value, nested, true);
+    }
+
+    bool erase(const variant &k) {
+      if (slots.empty()) return false;
+      const variant key = intern(k);
+      const uint32_t h = variant_key_hash(key);
+      for (size_t s = h & (slots.size() - 1); ; s = (s + 1) & (slots.size() - 1)) {
+        const int32_t e = slots[s];
+        if (e == EMPTY) return false;
+        if (e != REMOVED && entries[e].hash == h && variant_key_equal(entries[e].key, key)) {
+          slots[s] = REMOVED;
+          entry &ent = entries[e];
+          ent.live = false;
+          ent.key = ent.value = 0; // Drop any string references now
+          --live_count;
+          return true;
+        }
+      }
+    }
+
+    private:
+    enum : int32_t { EMPTY = -1, REMOVED = -2 };
+
+    std::vector<entry> entries;
+    std::vector<int32_t> slots;
+    size_t live_count, used_slots; // used_slots counts REMOVED markers too
+
+    bool add(const variant &k, const variant &value, unsigned char nested, bool overwrite) {
+      const variant key = intern(k);
+      // Also rebuild once holes outnumber live entries, or churn on a few
+      // keys would keep growing the entry list.
+      if ((used_slots + 1) * 2 > slots.size() || entries.size() >= slots.size())
+        rebuild(live_count + 1);
+      const uint32_t h = variant_key_hash(key);
+      size_t s = h & (slots.size() - 1), hole = slots.size();
+      for (;; s = (s + 1) & (slots.size() - 1)) {
+        const int32_t e = slots[s];
+        if (e == EMPTY) break;
+        if (e == REMOVED) {
+          if (hole == slots.size()) hole = s;
+        }
+        else if (entries[e].hash == h && variant_key_equal(entries[e].key, key)) {
+          if (overwrite) entries[e].value = value, entries[e].nested = nested;
+          return false;
+        }
+      }
+      if (hole != slots.size()) s = hole;
+      else ++used_slots;
+      slots[s] = int32_t(entries.size());
+      entries.push_back(entry());
+      entry &ent = entries.back();
+      ent.key = key;
+      ent.value = value;
+      ent.hash = h;
+      ent.live = true;
+      ent.nested = nested;
+      ++live_count;
+      return true;
+    }
+
+    // Compacts out erased entries and sizes the index for at least n live
+    // entries at a load factor of one half. The index never shrinks, so a
+    // reserve() holds until the map is cleared.
+    void rebuild(size_t n) {
+      if (live_count != entries.size()) {
+        size_t w = 0;
+        for (size_t r = 0; r < entries.size(); ++r)
+          if (entries[r].live) {
+            if (w != r) entries[w] = entries[r];
+            ++w;
+          }
+        entries.resize(w);
+      }
+      size_t cap = slots.empty() ? 16 : slots.size();
+      while (cap < n * 2) cap *= 2;
+      slots.assign(cap, EMPTY);
+      for (size_t i = 0; i < entries.size(); ++i) {
+        size_t s = entries[i].hash & (cap - 1);
+        while (slots[s] != EMPTY) s = (s + 1) & (cap - 1);
+        slots[s] = int32_t(i);
+      }
+      used_slots = entries.size();
+    }
+  };
+}
+
+#endif
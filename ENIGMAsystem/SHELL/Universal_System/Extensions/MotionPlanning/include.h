@@ -1,3 +1,4 @@
 #include "motion_planning.h"
 #include "mp_movement.h"
+#include "mp_flowfield.h"
 #include "actions.h"
@@ -81,35 +81,10 @@ void mp_grid_copy(unsigned id, unsigned srcid)
     grid->threshold = sgrid->threshold;
     grid->left = sgrid->left;
     grid->top = sgrid->top;
+    grid->jump_search = sgrid->jump_search;
+    enigma::grid_changed(grid);
     for (unsigned int i = 0; i < sgrid->hcells*sgrid->vcells; i++)
-    {
-        enigma::node node(floor(i / sgrid->vcells),i % sgrid->vcells,0,0,0,sgrid->nodearray[i].cost);
-        grid->nodearray.push_back(node);
-    }
-
-    for (unsigned int i = 0; i < grid->hcells; i++){
-        for (unsigned int c = 0; c < grid->vcells; c++){
-        if (i>0){
-            grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i-1)*grid->vcells+c]); //left
-            if (c>0)
-                grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i-1)*grid->vcells+c-1]); //top-left
-            if (c<grid->vcells-1)
-                grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i-1)*grid->vcells+c+1]); //bottom-left
-        }
-        if (c>0)
-            grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[i*grid->vcells+c-1]); //top
-        if (i<grid->hcells-1){
-            grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i+1)*grid->vcells+c]); //right
-            if (c>0)
-                grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i+1)*grid->vcells+c-1]); //top-right
-            if (c<grid->vcells-1)
-                grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[(i+1)*grid->vcells+c+1]); //bottom-bottom
-        }
-        if (c<grid->vcells-1)
-            grid->nodearray[i*grid->vcells+c].neighbor_nodes.push_back(&grid->nodearray[i*grid->vcells+c+1]); //bottom
-
-        }
-    }
+        grid->nodearray.push_back(enigma::node(i / sgrid->vcells, i % sgrid->vcells, sgrid->nodearray[i].cost));
 }
 
 void mp_grid_clear_all(unsigned id, unsigned cost)
@@ -117,12 +92,15 @@ void mp_grid_clear_all(unsigned id, unsigned cost)
     for (vector<enigma::node>::iterator it = enigma::gridstructarray[id]->nodearray.begin(); it!=enigma::gridstructarray[id]->nodearray.end(); ++it)
         (*it).cost = cost;
     enigma::gridstructarray[id]->threshold = cost;
+    enigma::grid_changed(enigma::gridstructarray[id]);
 }
 
 void mp_grid_clear_cell(unsigned id,int h,int v, unsigned cost)
 {
-    enigma::gridstructarray[id]->nodearray[h*enigma::gridstructarray[id]->vcells+v].cost = cost;
-    if (enigma::gridstructarray[id]->threshold<cost){enigma::gridstructarray[id]->threshold=cost;}
+    enigma::grid *grid = enigma::gridstructarray[id];
+    grid->nodearray[h*grid->vcells+v].cost = cost;
+    if (grid->threshold<cost){grid->threshold=cost; enigma::grid_changed(grid);}
+    else enigma::grid_cell_changed(grid, h*grid->vcells+v);
 }
 
 void mp_grid_add_rectangle(unsigned id,double x1,double y1,double x2,double y2, unsigned cost)
@@ -141,6 +119,7 @@ void mp_grid_add_rectangle(unsigned id,double x1,double y1,double x2,double y2,
     }
     if (cost>max_cost){max_cost=cost;}
     if (grid->threshold<max_cost){grid->threshold=max_cost;}
+    enigma::grid_changed(grid);
     //std::cout << "mp_grid_add_rectangle(grid," << floor(x1/grid->cellwidth)*grid->cellwidth << "," << floor(y1/grid->cellheight)*grid->cellheight << "," << ceil(x2/grid->cellwidth)*grid->cellwidth << "," << ceil(y2/grid->cellheight)*grid->cellheight<< ");" << std::endl;
 }
 
@@ -160,6 +139,7 @@ void mp_grid_add_instances(unsigned id,int obj,bool prec,unsigned cost)
     }
     if (cost>max_cost){max_cost=cost;}
     if (grid->threshold<max_cost){grid->threshold=max_cost;}
+    enigma::grid_changed(grid);
 }
 
 void mp_grid_reset_threshold(unsigned id)
@@ -169,6 +149,7 @@ void mp_grid_reset_threshold(unsigned id)
     for (vector<enigma::node>::iterator it = grid->nodearray.begin(); it!=grid->nodearray.end(); ++it)
         if ((*it).cost>max_cost){max_cost=(*it).cost;}
     grid->threshold=max_cost;
+    enigma::grid_changed(grid);
 }
 
 void mp_grid_clear_rectangle(unsigned id,double x1,double y1,double x2,double y2, unsigned cost)
@@ -178,10 +159,12 @@ void mp_grid_clear_rectangle(unsigned id,double x1,double y1,double x2,double y2
 
 void mp_grid_add_cell(unsigned id,int h,int v, unsigned cost)
 {
-    unsigned max_cost=enigma::gridstructarray[id]->nodearray[h*enigma::gridstructarray[id]->vcells+v].cost;
-    enigma::gridstructarray[id]->nodearray[h*enigma::gridstructarray[id]->vcells+v].cost = cost;
+    enigma::grid *grid = enigma::gridstructarray[id];
+    unsigned max_cost=grid->nodearray[h*grid->vcells+v].cost;
+    grid->nodearray[h*grid->vcells+v].cost = cost;
     if (cost>max_cost){max_cost=cost;}
-    if (enigma::gridstructarray[id]->threshold<max_cost){enigma::gridstructarray[id]->threshold=max_cost;}
+    if (grid->threshold<max_cost){grid->threshold=max_cost; enigma::grid_changed(grid);}
+    else enigma::grid_cell_changed(grid, h*grid->vcells+v);
 }
 
 unsigned mp_grid_get_cell(unsigned id,int h,int v)
@@ -197,6 +180,7 @@ unsigned mp_grid_get_threshold(unsigned id)
 void mp_grid_set_threshold(unsigned id, unsigned value)
 {
     enigma::gridstructarray[id]->threshold = value;
+    enigma::grid_changed(enigma::gridstructarray[id]);
 }
 
 double mp_grid_get_speed_modifier(unsigned id)
@@ -209,6 +193,16 @@ void mp_grid_set_speed_modifier(unsigned id, double value)
     enigma::gridstructarray[id]->speed_modifier = value;
 }
 
+bool mp_grid_get_jump_search(unsigned id)
+{
+    return enigma::gridstructarray[id]->jump_search;
+}
+
+void mp_grid_set_jump_search(unsigned id, bool enable)
+{
+    enigma::gridstructarray[id]->jump_search = enable;
+}
+
 bool mp_grid_path(unsigned id,unsigned pathid,double xstart,double ystart,double xgoal,double ygoal,bool allowdiag)
 {
     enigma::grid *gr = enigma::gridstructarray[id];
@@ -221,18 +215,18 @@ bool mp_grid_path(unsigned id,unsigned pathid,double xstart,double ystart,double
     if (ys>int(gr->vcells)-1 or yg>int(gr->vcells)-1) return false;
     //if (xstart==xgoal && ystart==ygoal) return;
 
-    bool status = true; //status to check if we can reach the destination
-    multimap<unsigned,enigma::node*> nodelist = enigma::find_path(id, &gr->nodearray[xs*vc+ys], &gr->nodearray[xg*vc+yg], allowdiag, status);
+    vector<unsigned> cells;
+    bool status = enigma::find_path(id, xs*vc+ys, xg*vc+yg, allowdiag, cells); //status to check if we can reach the destination
     enigma::path *path = enigma::pathstructarray[pathid];
     path->pointarray.clear();
 
     //push the very first point
     enigma::path_point point(xstart,ystart,gr->speed_modifier/double(gr->nodearray[xs*vc+ys].cost));
     path->pointarray.push_back(point);
-    multimap<unsigned,enigma::node*>::reverse_iterator it;
-    for (it=nodelist.rbegin(); it != nodelist.rend(); it++)
+    for (vector<unsigned>::iterator it = cells.begin(); it != cells.end(); it++)
     {
-            point = enigma::path_point(gr->left+((*it).second->x+0.5)*gr->cellwidth,gr->top+((*it).second->y+0.5)*gr->cellheight,gr->speed_modifier/double((*it).second->cost));
+            const enigma::node &n = gr->nodearray[*it];
+            point = enigma::path_point(gr->left+(n.x+0.5)*gr->cellwidth,gr->top+(n.y+0.5)*gr->cellheight,gr->speed_modifier/double(n.cost));
             path->pointarray.push_back(point);
     }
 
@@ -273,19 +267,26 @@ void mp_grid_draw_neighbours(unsigned int id, unsigned int h, unsigned int v, un
     if (h>grid->hcells-1) return;
     if (v>grid->vcells-1) return;
     draw_primitive_begin(8);
-    unsigned int vc = enigma::gridstructarray[id]->vcells;
-    for (vector<enigma::node*>::iterator it = enigma::gridstructarray[id]->nodearray[h*vc+v].neighbor_nodes.begin(); it!=enigma::gridstructarray[id]->nodearray[h*vc+v].neighbor_nodes.end(); ++it){
-        draw_vertex_color(grid->left+(*it)->x*grid->cellwidth,grid->top+(*it)->y*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
-        draw_vertex_color(grid->left+((*it)->x+1)*grid->cellwidth,grid->top+(*it)->y*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
-        draw_vertex_color(grid->left+((*it)->x+1)*grid->cellwidth,grid->top+((*it)->y+1)*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
-        draw_vertex_color(grid->left+(*it)->x*grid->cellwidth,grid->top+((*it)->y+1)*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
+    for (int dx = -1; dx <= 1; dx++){
+        for (int dy = -1; dy <= 1; dy++){
+            const int x = h+dx, y = v+dy;
+            if ((!dx && !dy) || x<0 || y<0 || x>int(grid->hcells)-1 || y>int(grid->vcells)-1) continue;
+            draw_vertex_color(grid->left+x*grid->cellwidth,grid->top+y*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
+            draw_vertex_color(grid->left+(x+1)*grid->cellwidth,grid->top+y*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
+            draw_vertex_color(grid->left+(x+1)*grid->cellwidth,grid->top+(y+1)*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
+            draw_vertex_color(grid->left+x*grid->cellwidth,grid->top+(y+1)*grid->cellheight,0x0000FF,(mode==0?0.5:1.0));
+        }
     }
     draw_primitive_end();
     if (mode==1){
         int tc = draw_get_color();
         draw_set_color_rgba(255,255,255,1);
-        for (vector<enigma::node*>::iterator it = enigma::gridstructarray[id]->nodearray[h*vc+v].neighbor_nodes.begin(); it!=enigma::gridstructarray[id]->nodearray[h*vc+v].neighbor_nodes.end(); ++it){
-            draw_text(((*it)->x+0.5)*grid->cellwidth,((*it)->y+0.5)*grid->cellheight,(*it)->x*grid->vcells+(*it)->y);
+        for (int dx = -1; dx <= 1; dx++){
+            for (int dy = -1; dy <= 1; dy++){
+                const int x = h+dx, y = v+dy;
+                if ((!dx && !dy) || x<0 || y<0 || x>int(grid->hcells)-1 || y>int(grid->vcells)-1) continue;
+                draw_text((x+0.5)*grid->cellwidth,(y+0.5)*grid->cellheight,x*grid->vcells+y);
+            }
         }
         draw_set_color(tc);
     }
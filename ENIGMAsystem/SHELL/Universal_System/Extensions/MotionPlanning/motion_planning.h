@@ -45,5 +45,10 @@ void mp_grid_set_threshold(unsigned id, unsigned threshold = 1);
 void mp_grid_reset_threshold(unsigned id);
 double mp_grid_get_speed_modifier(unsigned id);
 void mp_grid_set_speed_modifier(unsigned id, double value);
+// Jump point search finds the same length of path as A* with far fewer steps on
+// open grids. It applies to diagonal paths on grids whose passable cells all
+// have the same cost; other searches on the grid fall back to A*.
+bool mp_grid_get_jump_search(unsigned id);
+void mp_grid_set_jump_search(unsigned id, bool enable);
 }
 
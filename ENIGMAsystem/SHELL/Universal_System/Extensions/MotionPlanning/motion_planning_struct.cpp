@@ -27,16 +27,11 @@
 \********************************************************************************/
 
 #include <vector>
-#include <map>
-#include <list>
 #include "motion_planning_struct.h"
 #include <cmath>
+#include <climits>
 #include <algorithm>
 #include <cstdlib>
-//#include <iostream>
-using std::multimap;
-using std::pair;
-using std::list;
 
 namespace enigma
 {
@@ -47,41 +42,13 @@ namespace enigma
 namespace enigma
 {
     grid::grid(unsigned int idp,int leftp,int topp,unsigned int hcellsp,unsigned int vcellsp,unsigned int cellwidthp,unsigned int cellheightp,unsigned thresholdp,double speed_modifierp):
-        id(idp), left(leftp), top(topp), hcells(hcellsp), vcells(vcellsp), cellwidth(cellwidthp), cellheight(cellheightp), threshold(thresholdp), speed_modifier(speed_modifierp), nodearray()
+        id(idp), left(leftp), top(topp), hcells(hcellsp), vcells(vcellsp), cellwidth(cellwidthp), cellheight(cellheightp), threshold(thresholdp), speed_modifier(speed_modifierp), nodearray(),
+        jump_search(false), costs_changed(true), revision(0), min_cost(0), uniform(false), search_stamp(0)
     {
         gridstructarray[id] = this;
-        gridstructarray[id]->nodearray.reserve(hcells*vcells);
+        nodearray.reserve(hcells*vcells);
         for (unsigned int i = 0; i < hcells*vcells; i++)
-        {
-            node nnode(floor(i / vcells),i % vcells,0,0,0,1);
-            gridstructarray[id]->nodearray.push_back(nnode);
-        }
-
-        grid *gr = gridstructarray[id];
-
-        for (unsigned int i = 0; i < hcells; i++){
-            for (unsigned int c = 0; c < vcells; c++){
-            if (i>0){
-                gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i-1)*vcells+c]); //left
-                if (c>0)
-                    gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i-1)*vcells+c-1]); //top-left
-                if (c<vcells-1)
-                    gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i-1)*vcells+c+1]); //bottom-left
-            }
-            if (c>0)
-                gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[i*vcells+c-1]); //top
-            if (i<hcells-1){
-                gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i+1)*vcells+c]); //right
-                if (c>0)
-                    gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i+1)*vcells+c-1]); //top-right
-                if (c<vcells-1)
-                    gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[(i+1)*vcells+c+1]); //bottom-bottom
-            }
-            if (c<vcells-1)
-                gr->nodearray[i*vcells+c].neighbor_nodes.push_back(&gr->nodearray[i*vcells+c+1]); //bottom
-
-            }
-        }
+            nodearray.push_back(node(i / vcells, i % vcells, 1));
 
         if (enigma::grid_idmax < id+1)
           enigma::grid_idmax = id+1;
@@ -95,155 +62,331 @@ namespace enigma
         for (size_t i = 0; i < enigma::grid_idmax; i++) gridstructarray[i] = gridold[i]; delete[] gridold;
     }
 
+    void grid_changed(grid* gr)
+    {
+        gr->costs_changed = true;
+        gr->revision++;
+        gr->changed_cells.clear();
+    }
+
+    void grid_cell_changed(grid* gr, unsigned cell)
+    {
+        gr->costs_changed = true;
+        if (gr->changed_cells.size() >= gr->nodearray.size() / 16)
+            return grid_changed(gr); //past this, redoing everything is cheaper
+        gr->changed_cells.push_back(cell);
+    }
+
     //Helper functions
-    static inline unsigned find_heuristic(const node* n0, const node* n1, bool allow_diag) //Distance from n0 to n1
-    {
-        if (!allow_diag){
-            //std::cout << "Straight " << " H = " << fabs((int)n0->x-(int)n1->x) + fabs((int)n0->y-(int)n1->y) << std::endl;
-            return fabs((int)n0->x-(int)n1->x) + fabs((int)n0->y-(int)n1->y);
-        } else {
-            //std::cout << "Diagn " << " H = " << fmax(fabs((int)n0->x-(int)n1->x) , fabs((int)n0->y-(int)n1->y)) << std::endl;
-            return fmax(fabs((int)n0->x-(int)n1->x) , fabs((int)n0->y-(int)n1->y));
+    static const unsigned no_cell = UINT_MAX;
+
+    static inline bool passable(const grid* gr, int x, int y)
+    {
+        return x >= 0 && y >= 0 && unsigned(x) < gr->hcells && unsigned(y) < gr->vcells
+            && gr->nodearray[x*gr->vcells+y].cost < gr->threshold;
+    }
+
+    // The extra cost of crossing a cell diagonally: ceil(cost/2.5)
+    static inline unsigned diagonal_extra(unsigned cost) { return (2*cost + 4) / 5; }
+
+    //Brings min_cost and uniform up to date with the grid's costs
+    static void update_cost_range(grid* gr)
+    {
+        if (!gr->costs_changed) return;
+        gr->costs_changed = false;
+        gr->min_cost = UINT_MAX;
+        gr->uniform = true;
+        for (size_t i = 0; i < gr->nodearray.size(); i++) {
+            const unsigned c = gr->nodearray[i].cost;
+            if (c >= gr->threshold) continue;
+            if (gr->min_cost != UINT_MAX && c != gr->min_cost) gr->uniform = false;
+            if (c < gr->min_cost) gr->min_cost = c;
         }
+        if (gr->min_cost == UINT_MAX) gr->min_cost = 0;
     }
 
-    static inline int find_priority(multimap<unsigned,node*> &m, node* value){
-        multimap<unsigned,node*>::iterator it;
-        for (it = m.begin(); it != m.end(); it++)
-            if (it->second == value) return (int)it->first;
-        return -1;
+    //Distance from n0 to n1 in moves
+    static inline unsigned find_distance(const grid* gr, unsigned n0, unsigned n1, bool allow_diag)
+    {
+        const unsigned dx = std::abs(int(n0 / gr->vcells) - int(n1 / gr->vcells)),
+                       dy = std::abs(int(n0 % gr->vcells) - int(n1 % gr->vcells));
+        return allow_diag ? std::max(dx, dy) : dx + dy;
+    }
+
+    //Cost from n0 to n1 were every cell as cheap as the cheapest; never more than the real cost
+    static inline unsigned find_heuristic(const grid* gr, unsigned n0, unsigned n1, bool allow_diag)
+    {
+        const unsigned dx = std::abs(int(n0 / gr->vcells) - int(n1 / gr->vcells)),
+                       dy = std::abs(int(n0 % gr->vcells) - int(n1 % gr->vcells));
+        if (!allow_diag)
+            return (dx + dy) * gr->min_cost;
+        const unsigned diagonals = std::min(dx, dy);
+        return (std::max(dx, dy) - diagonals) * gr->min_cost + diagonals * (gr->min_cost + diagonal_extra(gr->min_cost));
+    }
+
+    // Resets the search state; cells are cleared as the search first reaches them.
+    static void begin_search(grid* gr)
+    {
+        gr->search.resize(gr->hcells*gr->vcells);
+        gr->open.clear();
+        if (++gr->search_stamp == 0) {
+            for (size_t i = 0; i < gr->search.size(); i++) gr->search[i].stamp = 0;
+            gr->search_stamp = 1;
+        }
+    }
+
+    static inline search_cell& reach(grid* gr, unsigned i)
+    {
+        search_cell &c = gr->search[i];
+        if (c.stamp != gr->search_stamp) {
+            c.stamp = gr->search_stamp;
+            c.G = UINT_MAX;
+            c.came_from = i;
+            c.heap_pos = 0;
+        }
+        return c;
+    }
+
+    //The open list is a binary heap of cell indices, ordered by F, then by H
+    static inline bool open_before(const grid* gr, unsigned a, unsigned b)
+    {
+        const search_cell &ca = gr->search[a], &cb = gr->search[b];
+        return ca.F < cb.F || (ca.F == cb.F && ca.H < cb.H);
     }
 
-    static inline bool check_corners(unsigned id, node* n0, node* n1) //There must be a better way to do this
+    static void open_sift_up(grid* gr, size_t pos)
     {
-        //std::cout << "Searching..." << std::endl;
-        for (vector<enigma::node*>::iterator it0 = n0->neighbor_nodes.begin(); it0!=n0->neighbor_nodes.end(); ++it0)
+        const unsigned cell = gr->open[pos];
+        while (pos > 0) {
+            const size_t parent = (pos - 1) / 2;
+            if (!open_before(gr, cell, gr->open[parent])) break;
+            gr->open[pos] = gr->open[parent];
+            gr->search[gr->open[pos]].heap_pos = pos + 1;
+            pos = parent;
+        }
+        gr->open[pos] = cell;
+        gr->search[cell].heap_pos = pos + 1;
+    }
+
+    static void open_sift_down(grid* gr, size_t pos)
+    {
+        const unsigned cell = gr->open[pos];
+        const size_t size = gr->open.size();
+        for (;;) {
+            size_t child = 2*pos + 1;
+            if (child >= size) break;
+            if (child + 1 < size && open_before(gr, gr->open[child+1], gr->open[child])) child++;
+            if (!open_before(gr, gr->open[child], cell)) break;
+            gr->open[pos] = gr->open[child];
+            gr->search[gr->open[pos]].heap_pos = pos + 1;
+            pos = child;
+        }
+        gr->open[pos] = cell;
+        gr->search[cell].heap_pos = pos + 1;
+    }
+
+    //Adds the cell to the open list, or moves it up if its F dropped
+    static inline void open_push(grid* gr, unsigned cell)
+    {
+        search_cell &c = gr->search[cell];
+        if (c.heap_pos) return open_sift_up(gr, c.heap_pos - 1);
+        gr->open.push_back(cell);
+        open_sift_up(gr, gr->open.size() - 1);
+    }
+
+    static inline unsigned open_pop(grid* gr)
+    {
+        const unsigned top = gr->open[0];
+        gr->search[top].heap_pos = 0;
+        const unsigned last = gr->open.back();
+        gr->open.pop_back();
+        if (!gr->open.empty()) {
+            gr->open[0] = last;
+            open_sift_down(gr, 0);
+        }
+        return top;
+    }
+
+    //Relaxes the edge from cell to n; returns whether that improved n
+    static inline bool relax(grid* gr, unsigned cell, unsigned n, unsigned cost, unsigned H)
+    {
+        search_cell &nc = reach(gr, n);
+        const unsigned G = gr->search[cell].G + cost;
+        if (G >= nc.G) return false;
+        nc.G = G;
+        nc.H = H;
+        nc.F = G + H;
+        nc.came_from = cell;
+        open_push(gr, n);
+        return true;
+    }
+
+    // Plain A* over the eight (or four) neighbours of each cell. Stores the goal
+    // in reached if it got there, or else the closed cell nearest to it.
+    static bool astar(grid* gr, unsigned start, unsigned goal, bool allow_diag, unsigned &reached)
+    {
+        const int vc = gr->vcells;
+        begin_search(gr);
+        search_cell &s = reach(gr, start);
+        s.G = 0;
+        s.H = s.F = find_heuristic(gr, start, goal, allow_diag);
+        open_push(gr, start);
+
+        reached = start;
+        unsigned nearest = find_distance(gr, start, goal, allow_diag);
+        while (!gr->open.empty())
         {
-            for (vector<enigma::node*>::iterator it1 = n1->neighbor_nodes.begin(); it1!=n1->neighbor_nodes.end(); ++it1)
-            {
-               // std::cout << (*it0) << " == " << (*it1) << " && it0.cost=" << (*it0)->cost << std::endl;
-                if ((*it0)==(*it1) && (*it0)->cost >= gridstructarray[id]->threshold)
+            const unsigned current = open_pop(gr);
+            if (current == goal) {
+                reached = goal;
                 return true;
             }
+            const unsigned distance = find_distance(gr, current, goal, allow_diag);
+            if (distance < nearest)
+                reached = current, nearest = distance;
+
+            const int x = current / vc, y = current % vc;
+            for (int dx = -1; dx <= 1; dx++)
+                for (int dy = -1; dy <= 1; dy++)
+                {
+                    if (!dx && !dy) continue;
+                    if (dx && dy && (!allow_diag || !passable(gr, x+dx, y) || !passable(gr, x, y+dy)))
+                        continue; //don't cut corners
+                    if (!passable(gr, x+dx, y+dy)) continue;
+                    const unsigned n = (x+dx)*vc + y+dy, cost = gr->nodearray[n].cost;
+                    relax(gr, current, n, dx && dy ? cost + diagonal_extra(cost) : cost, find_heuristic(gr, n, goal, allow_diag));
+                }
         }
         return false;
     }
 
-    multimap<unsigned,node*> find_path(unsigned id, node* n0, node* n1, bool allow_diag, bool &status)
+    // Jump point search, for grids where every passable cell costs the same. It
+    // skips over runs of open cells that any shortest path would cross the same
+    // way, opening only the cells where a path may need to turn. Diagonal moves
+    // never cut corners, as in astar.
+    static unsigned jump_straight(const grid* gr, int x, int y, int dx, int dy, unsigned goal)
     {
-        node* current;
-        for (unsigned int i = 0; i < gridstructarray[id]->hcells*gridstructarray[id]->vcells; i++)
+        for (;; x += dx, y += dy)
         {
-            gridstructarray[id]->nodearray[i].F=0;
-            gridstructarray[id]->nodearray[i].G=0;
-            gridstructarray[id]->nodearray[i].H=0;
-            gridstructarray[id]->nodearray[i].came_from=NULL;
+            if (!passable(gr, x, y)) return no_cell;
+            const unsigned cell = x*gr->vcells + y;
+            if (cell == goal) return cell;
+            if (dx) {
+                if ((passable(gr, x, y-1) && !passable(gr, x-dx, y-1)) || (passable(gr, x, y+1) && !passable(gr, x-dx, y+1)))
+                    return cell;
+            } else {
+                if ((passable(gr, x-1, y) && !passable(gr, x-1, y-dy)) || (passable(gr, x+1, y) && !passable(gr, x+1, y-dy)))
+                    return cell;
+            }
         }
+    }
 
-        node* start = n0;
-        node* destination = n1;
-        multimap<unsigned,node*> OPEN;
-        list<node*> CLOSED;
-        multimap<unsigned,node*> mm_ret;
+    static unsigned jump(const grid* gr, int x, int y, int dx, int dy, unsigned goal)
+    {
+        if (!dx || !dy) return jump_straight(gr, x, y, dx, dy, goal);
+        for (;; x += dx, y += dy)
+        {
+            if (!passable(gr, x, y)) return no_cell;
+            const unsigned cell = x*gr->vcells + y;
+            if (cell == goal) return cell;
+            if (jump_straight(gr, x+dx, y, dx, 0, goal) != no_cell || jump_straight(gr, x, y+dy, 0, dy, goal) != no_cell)
+                return cell;
+            if (!passable(gr, x+dx, y) || !passable(gr, x, y+dy))
+                return no_cell;
+        }
+    }
 
-        if (start == destination)
-            return mm_ret;
-        start->H = find_heuristic(start,destination,allow_diag);
-        start->F = start->H;
-        OPEN.insert(pair<unsigned,node*>(start->F,start));
+    static bool jump_point_search(grid* gr, unsigned start, unsigned goal)
+    {
+        const int vc = gr->vcells;
+        const unsigned straight = gr->min_cost, diagonal = straight + diagonal_extra(straight);
+        begin_search(gr);
+        search_cell &s = reach(gr, start);
+        s.G = 0;
+        s.H = s.F = 0;
+        open_push(gr, start);
 
-        while (find(CLOSED.begin(), CLOSED.end(), destination) == CLOSED.end() && !OPEN.empty())
-        //loop until destination is in the closed list or the open multimap is empty
+        while (!gr->open.empty())
         {
-            //if (OPEN.empty()){break;}
-            //multimap<unsigned,node*>::iterator tit;
-            /*std::cout << "Begin" << std::endl;
-            for ( tit=OPEN.begin() ; tit != OPEN.end(); tit++ )
-                std::cout << (*tit).first << " => " << (*tit).second << std::endl;*/
-
-            //this is basically ds_priority_delete_min
-            {
-              multimap<unsigned,node*>::iterator it = OPEN.begin(), it_check;
-              it_check = it++;
-              while (it != OPEN.end())
-              {
-                  if ((*it).first < (*it_check).first) {it_check = it;}
-                  it++;
-              }
-              current = (*it_check).second;
-              OPEN.erase(it_check);
-            }
-            //std::cout << OPEN.size() << std::endl;
-            //std::cout << "End" << std::endl;
-            //multimap<unsigned,node*>::iterator tit;
-            /*for ( tit=OPEN.begin() ; tit != OPEN.end(); tit++ )
-                std::cout << (*tit).first << " => " << (*tit).second << std::endl;*/
-            //std::cout << "Ended" << std::endl;
-
-            CLOSED.push_front(current);
-            for (vector<enigma::node*>::iterator it = current->neighbor_nodes.begin(); it!=current->neighbor_nodes.end(); ++it)
-            { //go trough all the neighbors (should be faster then 8 if cycles like in the init)
-                if (!allow_diag && (*it)->x != current->x && (*it)->y != current->y)
-                    continue;
+            const unsigned current = open_pop(gr);
+            if (current == goal) return true;
 
-                bool cutting = false;
-                if (allow_diag == true  && (*it)->x != current->x && (*it)->y != current->y)
-                        cutting = check_corners(id, current, (*it));
-
-                if (find(CLOSED.begin(), CLOSED.end(), (*it)) == CLOSED.end() && (*it)->cost<gridstructarray[id]->threshold && cutting == false){
-                    if (find_priority(OPEN,(*it)) == -1){ //if the node isn't on the open list
-                        (*it)->came_from = current;
-                        (*it)->G = current->G + (*it)->cost;
-                        if ((*it)->x != current->x && (*it)->y != current->y)
-                            (*it)->G += ceil((*it)->cost/2.5); //if it is diagonal increase the move cost
-                        (*it)->H = find_heuristic(*it,destination,allow_diag);
-                        (*it)->F = (*it)->G + (*it)->H;
-                        //std::cout << "Node: " << (*it)->x*gridstructarray[id]->vcells+(*it)->y << " F = " << (*it)->F << " H = " << (*it)->H << " G = " << (*it)->G << std::endl;
-                        OPEN.insert(pair<unsigned,node*>((*it)->F,(*it)));
-
-                    }else{ //if the node is already on the open list we just have to see if it is a better path
-                        unsigned temp_G = current->G + (*it)->cost;
-                        if (temp_G < (*it)->G) {
-                            (*it)->came_from = current;
-                            (*it)->G = current->G + (*it)->cost;
-                            if ((*it)->x != current->x && (*it)->y != current->y)
-                                (*it)->G += ceil((*it)->cost/2.5);
-                            (*it)->H = find_heuristic(*it,destination,allow_diag);
-                            (*it)->F = (*it)->G + (*it)->H;
+            const int x = current / vc, y = current % vc;
+            const unsigned from = gr->search[current].came_from;
+            int dirs[8][2], ndirs = 0;
+            if (from == current) { //the start: every direction
+                for (int dx = -1; dx <= 1; dx++)
+                    for (int dy = -1; dy <= 1; dy++)
+                        if (dx || dy) dirs[ndirs][0] = dx, dirs[ndirs++][1] = dy;
+            } else {
+                const int dx = (x > int(from / vc)) - (x < int(from / vc)), dy = (y > int(from % vc)) - (y < int(from % vc));
+                if (dx && dy) {
+                    dirs[ndirs][0] = dx, dirs[ndirs++][1] = 0;
+                    dirs[ndirs][0] = 0, dirs[ndirs++][1] = dy;
+                    dirs[ndirs][0] = dx, dirs[ndirs++][1] = dy;
+                } else if (dx) {
+                    dirs[ndirs][0] = dx, dirs[ndirs++][1] = 0;
+                    for (int side = -1; side <= 1; side += 2)
+                        if (passable(gr, x, y+side)) {
+                            dirs[ndirs][0] = 0, dirs[ndirs++][1] = side;
+                            dirs[ndirs][0] = dx, dirs[ndirs++][1] = side;
+                        }
+                } else {
+                    dirs[ndirs][0] = 0, dirs[ndirs++][1] = dy;
+                    for (int side = -1; side <= 1; side += 2)
+                        if (passable(gr, x+side, y)) {
+                            dirs[ndirs][0] = side, dirs[ndirs++][1] = 0;
+                            dirs[ndirs][0] = side, dirs[ndirs++][1] = dy;
                         }
-                    }
                 }
             }
-        }
-        node *last, *nearest;
-        unsigned i = 0;
-        status = true;
-        if (find(CLOSED.begin(), CLOSED.end(), destination) == CLOSED.end())
-        {   //this is for if the destionation can't be found if
-            status = false;
-            nearest = start;
-
-            list<node*>::iterator it;
-            for (it=CLOSED.begin(); it != CLOSED.end(); it++){
-                (*it)->H = find_heuristic(*it,destination,allow_diag);
-                if ((*it)->H < nearest->H)
-                    nearest = *it;
+
+            for (int d = 0; d < ndirs; d++)
+            {
+                const int dx = dirs[d][0], dy = dirs[d][1];
+                if (dx && dy && (!passable(gr, x+dx, y) || !passable(gr, x, y+dy)))
+                    continue;
+                const unsigned n = jump(gr, x+dx, y+dy, dx, dy, goal);
+                if (n == no_cell) continue;
+                const int nx = n / vc, ny = n % vc;
+                const unsigned steps = std::max(std::abs(nx - x), std::abs(ny - y));
+                relax(gr, current, n, steps * (dx && dy ? diagonal : straight), find_heuristic(gr, n, goal, true));
             }
-            destination = nearest;
-            if (start == destination)
-                return mm_ret;
         }
+        return false;
+    }
 
-        //mm_ret.insert(pair<unsigned,node*>(i,destination));
-        last = destination;
-        while (last->came_from != start){
-            i += 1;
-            mm_ret.insert(pair<unsigned,node*>(i,last->came_from));
-            last = last->came_from;
-        }
+    bool find_path(unsigned id, unsigned start, unsigned goal, bool allow_diag, vector<unsigned> &path)
+    {
+        grid* gr = gridstructarray[id];
+        path.clear();
+        if (start == goal)
+            return true;
+
+        update_cost_range(gr);
+        bool status;
+        unsigned destination = goal;
+        if (gr->jump_search && allow_diag && gr->uniform && passable(gr, goal / gr->vcells, goal % gr->vcells)
+            && jump_point_search(gr, start, goal))
+            status = true;
+        else //also finds the nearest reachable cell when the goal isn't reachable
+            status = astar(gr, start, goal, allow_diag, destination);
+        if (destination == start)
+            return status;
 
-        //delete CLOSED;
-        //delete OPEN;
-        return mm_ret; //return the multimap containing a list of all the nodes that are in the path.
+        //walk back from the destination, filling in the cells jump points skipped
+        const int vc = gr->vcells;
+        for (unsigned last = destination; last != start; ) {
+            const unsigned from = gr->search[last].came_from;
+            const int dx = (int(from / vc) > int(last / vc)) - (int(from / vc) < int(last / vc)),
+                      dy = (int(from % vc) > int(last % vc)) - (int(from % vc) < int(last % vc));
+            for (unsigned cell = last; cell != from; ) {
+                cell = (cell / vc + dx) * vc + cell % vc + dy;
+                if (cell != start) path.push_back(cell);
+            }
+            last = from;
+        }
+        std::reverse(path.begin(), path.end());
+        return status;
     }
 }
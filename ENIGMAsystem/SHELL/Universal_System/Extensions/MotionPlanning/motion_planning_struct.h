@@ -27,9 +27,7 @@
 \********************************************************************************/
 #include <vector>
 #include <cstdlib>
-#include <map>
 using std::vector;
-using std::multimap;
 
 #ifdef INCLUDED_FROM_SHELLMAIN
 #  error This file includes non-ENIGMA STL headers and should not be included from SHELLmain.
@@ -47,12 +45,19 @@ namespace enigma
 {
   struct node
   {
-    unsigned x, y, F, H, G, cost;
-    node* came_from;
-    vector<node*> neighbor_nodes;
-    node(unsigned X = 0, unsigned Y = 0, unsigned f = 0, unsigned h = 0, unsigned g = 0, unsigned Cost = 0, node* CameFrom = NULL):
-      x(X), y(Y), F(f), H(h), G(g), cost(Cost), came_from(CameFrom) {}
+    unsigned x, y, cost;
+    node(unsigned X = 0, unsigned Y = 0, unsigned Cost = 0): x(X), y(Y), cost(Cost) {}
   };
+
+  // What a path search knows about one cell. Each grid keeps one per cell and
+  // reuses them from search to search; a cell whose stamp is not the current
+  // search's has not been reached yet.
+  struct search_cell
+  {
+    unsigned stamp, G, H, F, came_from;
+    unsigned heap_pos; // One past the cell's place in the open heap, or 0
+  };
+
   struct grid
   {
     unsigned int id;
@@ -61,10 +66,32 @@ namespace enigma
     unsigned threshold;
     double speed_modifier;
     vector<node> nodearray;
+
+    bool jump_search; // Use jump point search where the grid allows it
+    bool costs_changed; // Set by anything that changes costs or the threshold
+    unsigned long revision; // Bumped when many cells change at once
+    vector<unsigned> changed_cells; // Cells changed one at a time since then
+    unsigned min_cost; // The cheapest passable cell; valid unless costs_changed
+    bool uniform; // Every passable cell costs the same; likewise
+
+    vector<search_cell> search;
+    vector<unsigned> open;
+    unsigned search_stamp;
+
     grid(unsigned int id,int left,int top,unsigned int hcells,unsigned int vcells,unsigned int cellwidth,unsigned int cellheight, unsigned int threshold, double speed_modifier);
     ~grid();
   };
   extern grid** gridstructarray;
   void gridstructarray_reallocate();
-  multimap<unsigned,node*> find_path(unsigned id, node* n0, node* n1, bool allow_diag, bool &status);
+
+  // Every change to a grid's costs or threshold is reported through one of
+  // these, so that searches and flow fields over it know to catch up.
+  void grid_changed(grid* gr);
+  void grid_cell_changed(grid* gr, unsigned cell);
+
+  // Finds a path between two cells of the grid, given as indices into its node
+  // array. Fills path with the cells strictly between the start and the end,
+  // in order. If the goal can't be reached, the path ends next to the reachable
+  // cell nearest to it, and false is returned.
+  bool find_path(unsigned id, unsigned start, unsigned goal, bool allow_diag, vector<unsigned> &path);
 }
@@ -0,0 +1,308 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include <vector>
+#include <queue>
+#include <functional>
+#include <climits>
+#include <cmath>
+#include "motion_planning_struct.h"
+#include "mp_flowfield.h"
+
+#include "Universal_System/instance_system.h"
+#include "Universal_System/planar_object.h"
+#include "Universal_System/math_consts.h"
+
+#ifdef DEBUG_MODE
+  #include <string>
+  #include "libEGMstd.h"
+  #include "Widget_Systems/widgets_mandatory.h"
+#endif
+
+namespace enigma
+{
+    struct flowfield
+    {
+        unsigned grid;
+        bool allow_diag;
+        double xgoal, ygoal;
+        unsigned goal; // The goal's cell, or no_cell if it is off the grid
+
+        bool built;
+        unsigned long revision; // The grid revision the field was built for
+        size_t changes_seen; // How much of the grid's changed_cells it has repaired
+        vector<unsigned> dist, next; // Per cell: cost to the goal, and the cell to move to
+    };
+
+    static vector<flowfield*> flowfields;
+    extern size_t grid_idmax;
+}
+
+namespace
+{
+    using enigma::grid;
+    using enigma::flowfield;
+
+    const unsigned no_cell = UINT_MAX, unreachable = UINT_MAX;
+    typedef std::pair<unsigned, unsigned> queued_cell; // dist, cell
+    typedef std::priority_queue<queued_cell, std::vector<queued_cell>, std::greater<queued_cell> > cell_queue;
+
+    inline bool grid_exists(unsigned id) { return id < enigma::grid_idmax && enigma::gridstructarray[id]; }
+
+    // The field with the given id, or NULL if there is none.
+    flowfield* get_flowfield(unsigned id)
+    {
+        if (id < enigma::flowfields.size() && enigma::flowfields[id]) return enigma::flowfields[id];
+        #ifdef DEBUG_MODE
+        show_error("Attempting to use nonexistent flow field " + toString(id), false);
+        #endif
+        return NULL;
+    }
+
+    inline bool passable(const grid* gr, unsigned cell) { return gr->nodearray[cell].cost < gr->threshold; }
+
+    unsigned cell_at(const grid* gr, double x, double y)
+    {
+        const double h = floor((x - gr->left) / gr->cellwidth), v = floor((y - gr->top) / gr->cellheight);
+        if (h < 0 || v < 0 || h >= gr->hcells || v >= gr->vcells) return no_cell;
+        return unsigned(h) * gr->vcells + unsigned(v);
+    }
+
+    // Calls f with each cell next to the given one.
+    template<typename F> inline void for_neighbours(const grid* gr, unsigned cell, bool allow_diag, F f)
+    {
+        const int vc = gr->vcells, x = cell / vc, y = cell % vc;
+        for (int dx = -1; dx <= 1; dx++)
+            for (int dy = -1; dy <= 1; dy++) {
+                if ((!dx && !dy) || (dx && dy && !allow_diag)) continue;
+                if (x+dx < 0 || y+dy < 0 || x+dx >= int(gr->hcells) || y+dy >= vc) continue;
+                f(unsigned((x+dx)*vc + y+dy));
+            }
+    }
+
+    // The cost of the move from one cell to the next, as mp_grid_path counts it,
+    // or unreachable if the move would cut a corner. Whether the cell moved to
+    // is open is up to the caller; the goal's cell always is.
+    inline unsigned move_cost(const grid* gr, unsigned from, unsigned to)
+    {
+        const unsigned vc = gr->vcells, cost = gr->nodearray[to].cost;
+        if (from / vc == to / vc || from % vc == to % vc) return cost;
+        if (!passable(gr, (from / vc) * vc + to % vc) || !passable(gr, (to / vc) * vc + from % vc))
+            return unreachable;
+        return cost + (2*cost + 4) / 5;
+    }
+
+    // Runs Dijkstra's algorithm outward from the queued cells until nothing
+    // else improves.
+    void settle(flowfield* ff, const grid* gr, cell_queue &queue)
+    {
+        while (!queue.empty())
+        {
+            const queued_cell top = queue.top();
+            queue.pop();
+            const unsigned u = top.second;
+            if (top.first != ff->dist[u]) continue; // Superseded
+            if (u != ff->goal && !passable(gr, u)) continue; // Can be left, but not crossed
+            for_neighbours(gr, u, ff->allow_diag, [&](unsigned v) {
+                const unsigned step = move_cost(gr, v, u);
+                if (step == unreachable || top.first + step >= ff->dist[v]) return;
+                ff->dist[v] = top.first + step;
+                ff->next[v] = u;
+                queue.push(queued_cell(ff->dist[v], v));
+            });
+        }
+    }
+
+    void build(flowfield* ff, const grid* gr)
+    {
+        const size_t cells = gr->hcells * gr->vcells;
+        ff->dist.assign(cells, unreachable);
+        ff->next.assign(cells, no_cell);
+        ff->goal = cell_at(gr, ff->xgoal, ff->ygoal);
+        if (ff->goal == no_cell) return;
+
+        cell_queue queue;
+        ff->dist[ff->goal] = 0;
+        queue.push(queued_cell(0, ff->goal));
+        settle(ff, gr, queue);
+    }
+
+    // Brings the field up to date with cells whose cost changed. Cells whose
+    // route went into or around a changed cell are cleared, along with every
+    // cell routed through them; those and the cells around the changes are
+    // then settled again from what remains.
+    void repair(flowfield* ff, const grid* gr, const unsigned* changed, size_t count)
+    {
+        std::vector<unsigned> cleared;
+        for (size_t i = 0; i < count; i++)
+            for_neighbours(gr, changed[i], true, [&](unsigned v) {
+                const unsigned w = ff->next[v];
+                if (w == no_cell) return;
+                if (w == changed[i] || move_cost(gr, v, w) == unreachable)
+                    cleared.push_back(v);
+            });
+        for (size_t i = 0; i < cleared.size(); i++) {
+            const unsigned u = cleared[i];
+            if (ff->next[u] == no_cell) continue; // Already cleared
+            ff->dist[u] = unreachable;
+            ff->next[u] = no_cell;
+            for_neighbours(gr, u, ff->allow_diag, [&](unsigned w) {
+                if (ff->next[w] == u) cleared.push_back(w);
+            });
+        }
+
+        std::vector<unsigned> seeds(cleared);
+        for (size_t i = 0; i < count; i++) {
+            seeds.push_back(changed[i]);
+            for_neighbours(gr, changed[i], true, [&](unsigned v) { seeds.push_back(v); });
+        }
+        cell_queue queue;
+        for (size_t i = 0; i < seeds.size(); i++) {
+            const unsigned s = seeds[i];
+            if (ff->dist[s] == unreachable) {
+                for_neighbours(gr, s, ff->allow_diag, [&](unsigned u) {
+                    if (ff->dist[u] == unreachable || !(u == ff->goal || passable(gr, u))) return;
+                    const unsigned step = move_cost(gr, s, u);
+                    if (step != unreachable && ff->dist[u] + step < ff->dist[s])
+                        ff->dist[s] = ff->dist[u] + step, ff->next[s] = u;
+                });
+            }
+            if (ff->dist[s] != unreachable)
+                queue.push(queued_cell(ff->dist[s], s));
+        }
+        settle(ff, gr, queue);
+    }
+
+    // Returns the field's grid once the field has caught up with it, or NULL if
+    // the grid is gone.
+    const grid* update(flowfield* ff)
+    {
+        if (!grid_exists(ff->grid)) return NULL;
+        const grid* gr = enigma::gridstructarray[ff->grid];
+        if (!ff->built || ff->revision != gr->revision || ff->dist.size() != gr->nodearray.size()) {
+            build(ff, gr);
+            ff->built = true;
+            ff->revision = gr->revision;
+        } else if (ff->changes_seen < gr->changed_cells.size() && ff->goal != no_cell) {
+            repair(ff, gr, &gr->changed_cells[ff->changes_seen], gr->changed_cells.size() - ff->changes_seen);
+        }
+        ff->changes_seen = gr->changed_cells.size();
+        return gr;
+    }
+
+    // Where to head for from the given point; false if there is nowhere to go.
+    bool find_target(flowfield* ff, double x, double y, double &tx, double &ty)
+    {
+        const grid* gr = update(ff);
+        if (!gr) return false;
+        const unsigned cell = cell_at(gr, x, y);
+        if (cell == no_cell || ff->dist[cell] == unreachable) return false;
+        if (cell == ff->goal) {
+            tx = ff->xgoal, ty = ff->ygoal;
+        } else {
+            const unsigned n = ff->next[cell];
+            tx = gr->left + (n / gr->vcells + 0.5) * gr->cellwidth;
+            ty = gr->top + (n % gr->vcells + 0.5) * gr->cellheight;
+        }
+        return true;
+    }
+}
+
+namespace enigma_user
+{
+
+int mp_grid_flowfield_create(unsigned grid, double xgoal, double ygoal, bool allowdiag)
+{
+    if (!grid_exists(grid)) {
+        #ifdef DEBUG_MODE
+        show_error("Attempting to create a flow field on nonexistent grid " + toString(grid), false);
+        #endif
+        return -1;
+    }
+    enigma::flowfield* ff = new enigma::flowfield();
+    ff->grid = grid;
+    ff->allow_diag = allowdiag;
+    ff->xgoal = xgoal, ff->ygoal = ygoal;
+    ff->goal = no_cell;
+    ff->built = false;
+    enigma::flowfields.push_back(ff);
+    return enigma::flowfields.size() - 1;
+}
+
+void mp_grid_flowfield_destroy(unsigned id)
+{
+    if (!get_flowfield(id)) return;
+    delete enigma::flowfields[id];
+    enigma::flowfields[id] = NULL;
+}
+
+void mp_grid_flowfield_set_goal(unsigned id, double xgoal, double ygoal)
+{
+    enigma::flowfield* ff = get_flowfield(id);
+    if (!ff) return;
+    ff->xgoal = xgoal, ff->ygoal = ygoal;
+    ff->built = false;
+}
+
+double mp_grid_flowfield_direction(unsigned id, double x, double y)
+{
+    enigma::flowfield* ff = get_flowfield(id);
+    double tx, ty;
+    if (!ff || !find_target(ff, x, y, tx, ty) || (tx == x && ty == y))
+        return -1;
+    const double dir = atan2(y - ty, tx - x) * (180 / M_PI);
+    return dir < 0 ? dir + 360 : dir;
+}
+
+double mp_grid_flowfield_distance(unsigned id, double x, double y)
+{
+    enigma::flowfield* ff = get_flowfield(id);
+    if (!ff) return -1;
+    const grid* gr = update(ff);
+    if (!gr) return -1;
+    const unsigned cell = cell_at(gr, x, y);
+    if (cell == no_cell || ff->dist[cell] == unreachable) return -1;
+    return ff->dist[cell];
+}
+
+bool mp_grid_flowfield_step(unsigned id, double stepsize)
+{
+    enigma::flowfield* ff = get_flowfield(id);
+    if (!ff) return false;
+    // Outside of an instance's events (room creation code, say) there is no one to move
+    enigma::object_planar* const inst = (enigma::object_planar*)enigma::instance_event_iterator->inst;
+    if (!inst) {
+        #ifdef DEBUG_MODE
+        show_error("mp_grid_flowfield_step called with no current instance", false);
+        #endif
+        return false;
+    }
+    double tx, ty;
+    if (!find_target(ff, inst->x, inst->y, tx, ty))
+        return false;
+    const double dist = hypot(tx - inst->x, ty - inst->y);
+    const bool at_goal = tx == ff->xgoal && ty == ff->ygoal;
+    if (at_goal && dist <= stepsize) {
+        inst->x = tx, inst->y = ty;
+        return true;
+    }
+    inst->x += (tx - inst->x) / dist * stepsize;
+    inst->y += (ty - inst->y) / dist * stepsize;
+    return false;
+}
+
+}
@@ -0,0 +1,48 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_MP_FLOWFIELD_H
+#define ENIGMA_MP_FLOWFIELD_H
+
+// A flow field holds the cost from every cell of a grid to one goal, so any
+// number of instances can find their way there without a search each. It uses
+// the same costs, threshold and corner rules as mp_grid_path, and catches up
+// with changes to the grid the next time it is read; changes made a cell at a
+// time with mp_grid_add_cell and mp_grid_clear_cell are repaired locally.
+
+namespace enigma_user
+{
+
+// Returns the new field's id, or -1 if the grid doesn't exist. The other
+// functions do nothing, or return -1 or false, given an id that doesn't exist.
+int mp_grid_flowfield_create(unsigned grid, double xgoal, double ygoal, bool allowdiag = true);
+void mp_grid_flowfield_destroy(unsigned id);
+void mp_grid_flowfield_set_goal(unsigned id, double xgoal, double ygoal);
+
+// The direction to move from the given point, or -1 if the goal can't be
+// reached from there or the point is on the goal already.
+double mp_grid_flowfield_direction(unsigned id, double x, double y);
+// The cost of the path from the point's cell to the goal, or -1 if there is none.
+double mp_grid_flowfield_distance(unsigned id, double x, double y);
+// Moves the current instance stepsize along the field. Returns true once the
+// instance is at the goal, and false while it is on its way or stuck, or if
+// there is no current instance.
+bool mp_grid_flowfield_step(unsigned id, double stepsize);
+
+}
+
+#endif //ENIGMA_MP_FLOWFIELD_H
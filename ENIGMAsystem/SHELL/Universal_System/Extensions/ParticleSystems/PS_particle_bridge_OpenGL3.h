@@ -136,7 +136,7 @@ namespace enigma {
     double x_offset;
     double y_offset;
 
-  void draw_particles(std::vector<particle_instance>& pi_list, bool oldtonew, double a_wiggle, int a_subimage_index,
+  void draw_particles(particle_storage& pi_list, bool oldtonew, double a_wiggle, int a_subimage_index,
       double a_x_offset, double a_y_offset) {
       using namespace enigma::particle_bridge;
       wiggle = a_wiggle;
@@ -146,13 +146,13 @@ namespace enigma {
 
       glPushAttrib(GL_CURRENT_BIT | GL_COLOR_BUFFER_BIT); // Attrib push 1.
 
-      if (pi_list.size() > 0) {
+      if (pi_list.count() > 0) {
         glBindVertexArray(vao); // Bind vertex array.
         glUseProgram(shader_program); // Bind shader program.
 
         // Transfer data to shaders.
 
-        const unsigned int pi_list_size = pi_list.size();
+        const unsigned int pi_list_size = pi_list.count();
 
         std::vector<GLfloat> points;
         points.reserve(pi_list_size*2);
@@ -171,7 +171,7 @@ namespace enigma {
 
         for (unsigned int i = 0; i < pi_list_size; i++) {
 
-          particle_instance& pi = pi_list[i];
+          const particle_instance pi = pi_list.get(i);
           double x, y;
           int color = pi.color;
           int alpha = pi.alpha;
@@ -201,7 +201,7 @@ namespace enigma {
                 subimg = pi.sprite_subimageindex_initial;
               }
               else {
-                const sprite *const spr = spritestructarray[pt->sprite_id];
+                const sprite *const spr = sprite_get_resident(pt->sprite_id);
                 const int subimage_count = spr->subcount;
                 if (pt->sprite_stretched) {
                   subimg = int(subimage_count*(1.0 - 1.0*pi.life_current/pi.life_start));
@@ -212,7 +212,7 @@ namespace enigma {
                   subimg = (subimage_index + pi.sprite_subimageindex_initial) % subimage_count;
                 }
               }
-              const enigma::sprite *const spr2d = enigma::spritestructarray[sprite_id];
+              const enigma::sprite *const spr2d = enigma::sprite_get_resident(sprite_id);
               const int usi = subimg % spr2d->subcount;
               width = spr2d->width;
               height = spr2d->height;
@@ -341,7 +341,7 @@ namespace enigma {
           bool curr_blend_add = false;
           int switch_offset = 0;
           int switch_count = 0;
-          for (unsigned int loop_i = 0; loop_i  < pi_list.size(); loop_i ++) {
+          for (unsigned int loop_i = 0; loop_i  < pi_list.count(); loop_i ++) {
             unsigned int i = loop_i;
             if (!oldtonew) {
               i = pi_list_size - 1 - loop_i;
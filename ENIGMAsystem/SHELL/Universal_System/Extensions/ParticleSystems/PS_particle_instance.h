@@ -29,6 +29,8 @@
 #define ENIGMA_PS_PARTICLEINSTANCE
 
 #include "PS_particle_type.h"
+#include <vector>
+#include <cstddef>
 
 namespace enigma
 {
@@ -49,6 +51,32 @@ namespace enigma
     double speed_wiggle_offset; // [-1;1].
     double dir_wiggle_offset; // [-1;1].
   };
+
+  // The particles of a system, one column per attribute, so the update loops
+  // only stream through what they touch and can be vectorized. Motion is kept
+  // as a speed and a unit heading in screen space (y down) instead of a
+  // direction in degrees; the heading survives a particle coming to a halt,
+  // which speed increments and relative angles need. Positions are doubles,
+  // the attributes that change a little every step are floats.
+  struct particle_storage
+  {
+    std::vector<particle_type*> pt; // NULL once the particle has died, until remove_dead.
+    std::vector<double> x, y;
+    std::vector<float> speed, head_x, head_y;
+    std::vector<float> size, angle;
+    std::vector<int> color, alpha;
+    std::vector<int> life_current, life_start;
+    std::vector<int> sprite_subimageindex_initial;
+    std::vector<float> size_wiggle_offset, ang_wiggle_offset, speed_wiggle_offset, dir_wiggle_offset; // [0;1].
+
+    size_t count() const { return pt.size(); }
+    void clear();
+    void push_back(const particle_instance& pi);
+    // Gathers one particle, with its heading as a direction in degrees.
+    particle_instance get(size_t i) const;
+    // Drops the particles marked dead, keeping the rest in order.
+    void remove_dead();
+  };
 }
 
 #endif // ENIGMA_PS_PARTICLEINSTANCE
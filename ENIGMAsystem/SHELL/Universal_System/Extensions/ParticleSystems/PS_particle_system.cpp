@@ -79,7 +79,7 @@ namespace enigma
     oldtonew = true;
     auto_update = true, auto_draw = true;
     depth = 0.0;
-    pi_list = std::vector<particle_instance>();
+    pi_list.clear();
     id_to_emitter = std::map<int,particle_emitter*>();
     emitter_max_id = 0;
     id_to_attractor = std::map<int,particle_attractor*>();
@@ -93,8 +93,125 @@ namespace enigma
     hidden = false;
   }
 
-  static inline bool is_dead_from_old_age(particle_instance& pi) {
-    return pi.life_current <= 0;
+  void particle_storage::clear()
+  {
+    pt.clear();
+    x.clear(), y.clear();
+    speed.clear(), head_x.clear(), head_y.clear();
+    size.clear(), angle.clear();
+    color.clear(), alpha.clear();
+    life_current.clear(), life_start.clear();
+    sprite_subimageindex_initial.clear();
+    size_wiggle_offset.clear(), ang_wiggle_offset.clear(), speed_wiggle_offset.clear(), dir_wiggle_offset.clear();
+  }
+
+  void particle_storage::push_back(const particle_instance& pi)
+  {
+    const double direction_radians = pi.direction*M_PI/180.0;
+    pt.push_back(pi.pt);
+    x.push_back(pi.x), y.push_back(pi.y);
+    speed.push_back(pi.speed), head_x.push_back(cos(direction_radians)), head_y.push_back(-sin(direction_radians));
+    size.push_back(pi.size), angle.push_back(pi.angle);
+    color.push_back(pi.color), alpha.push_back(pi.alpha);
+    life_current.push_back(pi.life_current), life_start.push_back(pi.life_start);
+    sprite_subimageindex_initial.push_back(pi.sprite_subimageindex_initial);
+    size_wiggle_offset.push_back(pi.size_wiggle_offset), ang_wiggle_offset.push_back(pi.ang_wiggle_offset);
+    speed_wiggle_offset.push_back(pi.speed_wiggle_offset), dir_wiggle_offset.push_back(pi.dir_wiggle_offset);
+  }
+
+  particle_instance particle_storage::get(size_t i) const
+  {
+    particle_instance pi;
+    pi.pt = pt[i];
+    pi.x = x[i], pi.y = y[i];
+    pi.speed = speed[i], pi.direction = -atan2(head_y[i], head_x[i])*180.0/M_PI;
+    pi.size = size[i], pi.angle = angle[i];
+    pi.color = color[i], pi.alpha = alpha[i];
+    pi.life_current = life_current[i], pi.life_start = life_start[i];
+    pi.sprite_subimageindex_initial = sprite_subimageindex_initial[i];
+    pi.size_wiggle_offset = size_wiggle_offset[i], pi.ang_wiggle_offset = ang_wiggle_offset[i];
+    pi.speed_wiggle_offset = speed_wiggle_offset[i], pi.dir_wiggle_offset = dir_wiggle_offset[i];
+    return pi;
+  }
+
+  template<typename T> static void remove_dead_entries(std::vector<T>& column, const std::vector<particle_type*>& pt, size_t first_dead)
+  {
+    size_t kept = first_dead;
+    for (size_t i = first_dead; i < pt.size(); i++) {
+      if (pt[i]) column[kept++] = column[i];
+    }
+    column.resize(kept);
+  }
+
+  void particle_storage::remove_dead()
+  {
+    const size_t first_dead = std::find(pt.begin(), pt.end(), (particle_type*) NULL) - pt.begin();
+    if (first_dead == pt.size()) return;
+    remove_dead_entries(x, pt, first_dead), remove_dead_entries(y, pt, first_dead);
+    remove_dead_entries(speed, pt, first_dead);
+    remove_dead_entries(head_x, pt, first_dead), remove_dead_entries(head_y, pt, first_dead);
+    remove_dead_entries(size, pt, first_dead), remove_dead_entries(angle, pt, first_dead);
+    remove_dead_entries(color, pt, first_dead), remove_dead_entries(alpha, pt, first_dead);
+    remove_dead_entries(life_current, pt, first_dead), remove_dead_entries(life_start, pt, first_dead);
+    remove_dead_entries(sprite_subimageindex_initial, pt, first_dead);
+    remove_dead_entries(size_wiggle_offset, pt, first_dead), remove_dead_entries(ang_wiggle_offset, pt, first_dead);
+    remove_dead_entries(speed_wiggle_offset, pt, first_dead), remove_dead_entries(dir_wiggle_offset, pt, first_dead);
+    remove_dead_entries(pt, pt, first_dead); // Last, as it says which entries to keep.
+  }
+
+  // make_color_rgb of the mix of two colors, written out so that the color
+  // loops can be vectorized.
+  static inline int mix_rgb(int r1, int g1, int b1, int r2, int g2, int b2, float part)
+  {
+    const unsigned char r = int((1-part)*r1 + part*r2), g = int((1-part)*g1 + part*g2), b = int((1-part)*b1 + part*b2);
+    return r | (g << 8) | (b << 16);
+  }
+
+  // A stretch of living particles of the same type. The type's settings are
+  // constant in the loops over a run, which lets them be vectorized.
+  struct particle_run
+  {
+    particle_type* pt;
+    size_t begin, end;
+  };
+
+  static void find_runs(const std::vector<particle_type*>& pts, std::vector<particle_run>& runs)
+  {
+    const size_t count = pts.size();
+    for (size_t begin = 0; begin < count; ) {
+      particle_run run;
+      run.pt = pts[begin];
+      run.begin = begin;
+      run.end = std::find_if(pts.begin() + begin, pts.end(), [&](particle_type* pt) { return pt != run.pt; }) - pts.begin();
+      if (run.pt != NULL) runs.push_back(run);
+      begin = run.end;
+    }
+  }
+
+  // Calls f(pt, begin, end) for each run.
+  template<typename F> static void for_each_run(const std::vector<particle_run>& runs, F f)
+  {
+    for (std::vector<particle_run>::const_iterator it = runs.begin(); it != runs.end(); it++) {
+      f(it->pt, it->begin, it->end);
+    }
+  }
+
+  // Marks a particle as dead; it is removed from the storage at the end of the
+  // step. Returns true if this deleted its particle type, which happens when the
+  // type has been destroyed and this was its last particle.
+  static bool kill_particle(particle_storage& ps, size_t i)
+  {
+    particle_type* const pt = ps.pt[i];
+    ps.pt[i] = NULL;
+    pt->particle_count--;
+    if (pt->particle_count <= 0 && !pt->alive) {
+      // Particle type is no longer used, delete it.
+      int pid = pt->id;
+      delete pt;
+      enigma::pt_manager.id_to_particletype.erase(pid);
+      return true;
+    }
+    return false;
   }
 
   void particle_system::update_particlesystem()
@@ -110,189 +227,229 @@ namespace enigma
     std::vector<generation_info> particles_to_generate;
     // Handle life and death.
     {
-      for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != pi_list.end(); it++)
+      const size_t count = pi_list.count();
+      int* const life_current = pi_list.life_current.data();
+      for (size_t i = 0; i < count; i++) {
+        life_current[i]--;
+      }
+      for (size_t i = 0; i < count; i++)
       {
-        // Decrease life.
-        it->life_current--;
-        if (it->life_current <= 0) { // Death.
-          particle_type* pt = it->pt;
-
-          // Generated upon end of life.
-          if (pt->alive && pt->death_on) {
-            std::map<int,particle_type*>::iterator death_pt_it = pt_manager.id_to_particletype.find(pt->death_particle_id);
-            if (death_pt_it != pt_manager.id_to_particletype.end()) {
-              generation_info gen_info;
-              gen_info.x = it->x;
-              gen_info.y = it->y;
-              gen_info.number = pt->death_number;
-              gen_info.pt = (*death_pt_it).second;
-              particles_to_generate.push_back(gen_info);
-            }
-          }
+        if (life_current[i] > 0) continue;
+        particle_type* pt = pi_list.pt[i];
 
-          // Death handling.
-          // Only the clean-up is made here.
-          pt->particle_count--;
-          if (pt->particle_count <= 0 && !pt->alive) {
-            // Particle type is no longer used, delete it.
-            int pid = pt->id;
-            delete pt;
-            enigma::pt_manager.id_to_particletype.erase(pid);
+        // Generated upon end of life.
+        if (pt->alive && pt->death_on) {
+          std::map<int,particle_type*>::iterator death_pt_it = pt_manager.id_to_particletype.find(pt->death_particle_id);
+          if (death_pt_it != pt_manager.id_to_particletype.end()) {
+            generation_info gen_info;
+            gen_info.x = pi_list.x[i];
+            gen_info.y = pi_list.y[i];
+            gen_info.number = pt->death_number;
+            gen_info.pt = (*death_pt_it).second;
+            particles_to_generate.push_back(gen_info);
           }
         }
+
+        // Death handling.
+        kill_particle(pi_list, i);
       }
-      pi_list.erase(std::remove_if(pi_list.begin(), pi_list.end(), is_dead_from_old_age), pi_list.end());
     }
+    // No particle dies again before the changers, so the runs of particles of
+    // the same type stay the same until then.
+    std::vector<particle_run> runs;
+    find_runs(pi_list.pt, runs);
     // Shape.
-    {
-      std::vector<particle_instance>::iterator end = pi_list.end();
-      for (std::vector<particle_instance>::iterator it = pi_list.begin(); it !=end; it++)
-      {
-        particle_type* pt = it->pt;
-        if (pt->alive) {
-          it->size = std::max(it->size + pt->size_incr, 0.0);
-          it->angle = fmod(it->angle + pt->ang_incr, 360.0);
+    for_each_run(runs, [&](particle_type* pt, size_t begin, size_t end) {
+      if (!pt->alive) return;
+      const float size_incr = pt->size_incr, ang_incr = pt->ang_incr;
+      float* const size = pi_list.size.data();
+      float* const angle = pi_list.angle.data();
+      if (size_incr != 0) {
+        for (size_t i = begin; i < end; i++) {
+          const float new_size = size[i] + size_incr;
+          size[i] = new_size > 0.0f ? new_size : 0.0f;
         }
       }
-    }
-    // Color and blending.
-    {
-      std::vector<particle_instance>::iterator end = pi_list.end();
-      for (std::vector<particle_instance>::iterator it = pi_list.begin(); it !=end; it++)
-      {
-        particle_type* pt = it->pt;
-        // Color.
-        switch(pt->c_mode) {
-        default:
-        case one_color : {break;}
-        case two_color : {
-          if (pt->alive) {
-            const int r1 = color_get_red(pt->color1),
-                g1 = color_get_green(pt->color1),
-                b1 = color_get_blue(pt->color1);
-            const int r2 = color_get_red(pt->color2),
-                g2 = color_get_green(pt->color2),
-                b2 = color_get_blue(pt->color2);
-            const double part = 1.0 - 1.0*it->life_current/it->life_start;
-            it->color = make_color_rgb(int((1-part)*r1 + part*r2),int((1-part)*g1 + part*g2),int((1-part)*b1 + part*b2));
-          }
-          break;
+      if (fabs(ang_incr) < 360.0) {
+        // Then the new angle is within a turn of (-360;360), and taking off
+        // that turn is what fmod would do.
+        for (size_t i = begin; i < end; i++) {
+          const float new_angle = angle[i] + ang_incr;
+          const float turn = (new_angle >= 360.0f ? 360.0f : 0.0f) - (new_angle <= -360.0f ? 360.0f : 0.0f);
+          angle[i] = new_angle - turn;
         }
-        case three_color : {
-          if (pt->alive) {
-            double part = 1.0 - 1.0*it->life_current/it->life_start;
-            int first_color, second_color;
-            if (part <= 0.5) {
-              part = 2.0*part;
-              first_color = pt->color1;
-              second_color = pt->color2;
-            }
-            else {
-              part = 2.0*(part - 0.5);
-              first_color = pt->color2;
-              second_color = pt->color3;
-            }
-            const int r1 = color_get_red(first_color),
-                g1 = color_get_green(first_color),
-                b1 = color_get_blue(first_color);
-            const int r2 = color_get_red(second_color),
-                g2 = color_get_green(second_color),
-                b2 = color_get_blue(second_color);
-            it->color = make_color_rgb(int((1-part)*r1 + part*r2),int((1-part)*g1 + part*g2),int((1-part)*b1 + part*b2));
-          }
-          break;
+      }
+      else {
+        for (size_t i = begin; i < end; i++) {
+          angle[i] = fmod(angle[i] + ang_incr, 360.0);
         }
-        case mix_color : {break;}
-        case rgb_color : {break;}
-        case hsv_color : {break;}
+      }
+    });
+    // Color and blending.
+    for_each_run(runs, [&](particle_type* pt, size_t begin, size_t end) {
+      if (!pt->alive) return;
+      const int* const life_current = pi_list.life_current.data();
+      const int* const life_start = pi_list.life_start.data();
+      // Color.
+      int* const color = pi_list.color.data();
+      switch(pt->c_mode) {
+      default:
+      case one_color : {break;}
+      case two_color : {
+        const int r1 = color_get_red(pt->color1),
+            g1 = color_get_green(pt->color1),
+            b1 = color_get_blue(pt->color1);
+        const int r2 = color_get_red(pt->color2),
+            g2 = color_get_green(pt->color2),
+            b2 = color_get_blue(pt->color2);
+        for (size_t i = begin; i < end; i++) {
+          const float part = 1.0f - float(life_current[i])/life_start[i];
+          color[i] = mix_rgb(r1, g1, b1, r2, g2, b2, part);
         }
-        // Alpha.
-        switch(pt->a_mode) {
-        default:
-        case one_alpha : {break;}
-        case two_alpha : {
-          if (pt->alive) {
-            const int alpha1 = pt->alpha1;
-            const int alpha2 = pt->alpha2;
-            const double part = 1.0 - 1.0*it->life_current/it->life_start;
-            it->alpha = bounds(int((1-part)*alpha1 + part*alpha2), 0, 255);
-          }
-          break;
+        break;
+      }
+      case three_color : {
+        const int r1 = color_get_red(pt->color1),
+            g1 = color_get_green(pt->color1),
+            b1 = color_get_blue(pt->color1);
+        const int r2 = color_get_red(pt->color2),
+            g2 = color_get_green(pt->color2),
+            b2 = color_get_blue(pt->color2);
+        const int r3 = color_get_red(pt->color3),
+            g3 = color_get_green(pt->color3),
+            b3 = color_get_blue(pt->color3);
+        for (size_t i = begin; i < end; i++) {
+          const float part = 1.0f - float(life_current[i])/life_start[i];
+          const bool first_half = part <= 0.5f;
+          color[i] = first_half ? mix_rgb(r1, g1, b1, r2, g2, b2, 2.0f*part)
+                                : mix_rgb(r2, g2, b2, r3, g3, b3, 2.0f*(part - 0.5f));
         }
-        case three_alpha : {
-          if (pt->alive) {
-            const int alpha1 = pt->alpha1;
-            const int alpha2 = pt->alpha2;
-            const int alpha3 = pt->alpha3;
-            double part = 1.0 - 1.0*it->life_current/it->life_start;
-            int first_alpha, second_alpha;
-            if (part <= 0.5) {
-              part = 2.0*part;
-              first_alpha = alpha1;
-              second_alpha = alpha2;
-            }
-            else {
-              part = 2.0*(part - 0.5);
-              first_alpha = alpha2;
-              second_alpha = alpha3;
-            }
-            it->alpha = bounds(int((1-part)*first_alpha + part*second_alpha), 0, 255);
-          }
-          break;
+        break;
+      }
+      case mix_color : {break;}
+      case rgb_color : {break;}
+      case hsv_color : {break;}
+      }
+      // Alpha.
+      int* const alpha = pi_list.alpha.data();
+      switch(pt->a_mode) {
+      default:
+      case one_alpha : {break;}
+      case two_alpha : {
+        const int alpha1 = pt->alpha1;
+        const int alpha2 = pt->alpha2;
+        for (size_t i = begin; i < end; i++) {
+          const float part = 1.0f - float(life_current[i])/life_start[i];
+          alpha[i] = bounds(int((1-part)*alpha1 + part*alpha2), 0, 255);
         }
+        break;
+      }
+      case three_alpha : {
+        const int alpha1 = pt->alpha1;
+        const int alpha2 = pt->alpha2;
+        const int alpha3 = pt->alpha3;
+        for (size_t i = begin; i < end; i++) {
+          const float part = 1.0f - float(life_current[i])/life_start[i];
+          const bool first_half = part <= 0.5f;
+          const float half_part = first_half ? 2.0f*part : 2.0f*(part - 0.5f);
+          const int first_alpha = first_half ? alpha1 : alpha2;
+          const int second_alpha = first_half ? alpha2 : alpha3;
+          alpha[i] = bounds(int((1-half_part)*first_alpha + half_part*second_alpha), 0, 255);
         }
+        break;
       }
-    }
+      }
+    });
     // Step.
-    {
-      for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != pi_list.end(); it++)
-      {
-        particle_type* pt = it->pt;
-
-        // Generated each step.
-        if (pt->alive && pt->step_on) {
-          std::map<int,particle_type*>::iterator step_pt_it = pt_manager.id_to_particletype.find(pt->step_particle_id);
-          if (step_pt_it != pt_manager.id_to_particletype.end()) {
-            generation_info gen_info;
-            gen_info.x = it->x;
-            gen_info.y = it->y;
-            gen_info.number = pt->step_number;
-            gen_info.pt = (*step_pt_it).second;
-            particles_to_generate.push_back(gen_info);
-          }
-        }
+    for_each_run(runs, [&](particle_type* pt, size_t begin, size_t end) {
+      // Generated each step.
+      if (!pt->alive || !pt->step_on) return;
+      std::map<int,particle_type*>::iterator step_pt_it = pt_manager.id_to_particletype.find(pt->step_particle_id);
+      if (step_pt_it == pt_manager.id_to_particletype.end()) return;
+      for (size_t i = begin; i < end; i++) {
+        generation_info gen_info;
+        gen_info.x = pi_list.x[i];
+        gen_info.y = pi_list.y[i];
+        gen_info.number = pt->step_number;
+        gen_info.pt = (*step_pt_it).second;
+        particles_to_generate.push_back(gen_info);
       }
-    }
+    });
     // Move particles.
-    {
-      std::vector<particle_instance>::iterator end = pi_list.end();
-      for (std::vector<particle_instance>::iterator it = pi_list.begin(); it !=end; it++)
-      {
-        particle_type* pt = it->pt;
-        if (pt->alive) {
-          it->speed += pt->speed_incr;
-          it->direction += pt->dir_incr;
-          if (it->speed < 0) {
-            it->speed = -it->speed;
-            it->direction += 180.0;
+    for_each_run(runs, [&](particle_type* pt, size_t begin, size_t end) {
+      double* const x = pi_list.x.data();
+      double* const y = pi_list.y.data();
+      float* const speed = pi_list.speed.data();
+      float* const head_x = pi_list.head_x.data();
+      float* const head_y = pi_list.head_y.data();
+      if (pt->alive) {
+        // Turning by dir_incr is a rotation of the heading, and gravity a
+        // constant added to the velocity.
+        const float speed_incr = pt->speed_incr;
+        const double turn_radians = pt->dir_incr*M_PI/180.0;
+        const float turn_cos = cos(turn_radians), turn_sin = sin(turn_radians);
+        const double grav_radians = pt->grav_dir*M_PI/180.0;
+        const float grav_x = pt->grav_amount*cos(grav_radians), grav_y = -pt->grav_amount*sin(grav_radians);
+        if (grav_x == 0 && grav_y == 0) {
+          for (size_t i = begin; i < end; i++) {
+            const float new_speed = speed[i] + speed_incr;
+            const float flip = new_speed < 0 ? -1.0f : 1.0f;
+            const float hx = head_x[i], hy = head_y[i];
+            speed[i] = flip*new_speed;
+            head_x[i] = flip*(hx*turn_cos + hy*turn_sin);
+            head_y[i] = flip*(hy*turn_cos - hx*turn_sin);
+          }
+        }
+        else {
+          // The velocity is left in the heading and its square in speed, so
+          // that the loops around the square root can be vectorized.
+          for (size_t i = begin; i < end; i++) {
+            const float new_speed = speed[i] + speed_incr;
+            const float flip = new_speed < 0 ? -1.0f : 1.0f;
+            const float hx = flip*(head_x[i]*turn_cos + head_y[i]*turn_sin);
+            const float hy = flip*(head_y[i]*turn_cos - head_x[i]*turn_sin);
+            const float vx = flip*new_speed*hx + grav_x, vy = flip*new_speed*hy + grav_y;
+            const float v2 = vx*vx + vy*vy;
+            const bool still = v2 < 1e-16f; // Keep the heading of a particle brought to a halt.
+            speed[i] = still ? 0.0f : v2;
+            head_x[i] = still ? hx : vx;
+            head_y[i] = still ? hy : vy;
+          }
+          for (size_t i = begin; i < end; i++) {
+            speed[i] = std::sqrt(speed[i]);
+          }
+          for (size_t i = begin; i < end; i++) {
+            const float v = speed[i] > 0.0f ? speed[i] : 1.0f;
+            head_x[i] /= v;
+            head_y[i] /= v;
           }
-          it->direction = fmod(it->direction, 360.0);
-          const double speed = it->speed, direction = it->direction;
-          const double grav_amount = pt->grav_amount, grav_dir = pt->grav_dir;
-          const double vx = speed*cos(direction*M_PI/180.0) + grav_amount*cos(grav_dir*M_PI/180.0);
-          const double vy = -(speed*sin(direction*M_PI/180.0) + grav_amount*sin(grav_dir*M_PI/180.0));
-          it->speed = sqrt(vx*vx + vy*vy);
-          it->direction = fzero(vx) && fzero(vy) ? direction : -atan2(vy,vx)*180.0/M_PI;
         }
-        double speed = it->speed, direction = it->direction;
-        if (pt->alive) {
-          speed += pt->speed_wiggle*get_wiggle_result(it->speed_wiggle_offset);
-          direction += pt->dir_wiggle*get_wiggle_result(it->dir_wiggle_offset);
+      }
+      const double speed_wiggle = pt->alive ? pt->speed_wiggle : 0.0;
+      const double dir_wiggle = pt->alive ? pt->dir_wiggle : 0.0;
+      if (speed_wiggle == 0 && dir_wiggle == 0) {
+        for (size_t i = begin; i < end; i++) {
+          x[i] += speed[i]*head_x[i];
+          y[i] += speed[i]*head_y[i];
         }
-        it->x += speed*cos(direction*M_PI/180.0);
-        it->y += -speed*sin(direction*M_PI/180.0);
       }
-    }
+      else {
+        const float* const speed_wiggle_offset = pi_list.speed_wiggle_offset.data();
+        const float* const dir_wiggle_offset = pi_list.dir_wiggle_offset.data();
+        for (size_t i = begin; i < end; i++) {
+          const double wiggled_speed = speed[i] + speed_wiggle*get_wiggle_result(speed_wiggle_offset[i]);
+          double hx = head_x[i], hy = head_y[i];
+          if (dir_wiggle != 0) {
+            const double wiggle_radians = dir_wiggle*get_wiggle_result(dir_wiggle_offset[i])*M_PI/180.0;
+            const double wiggle_cos = cos(wiggle_radians), wiggle_sin = sin(wiggle_radians);
+            hx = head_x[i]*wiggle_cos + head_y[i]*wiggle_sin;
+            hy = head_y[i]*wiggle_cos - head_x[i]*wiggle_sin;
+          }
+          x[i] += wiggled_speed*hx;
+          y[i] += wiggled_speed*hy;
+        }
+      }
+    });
     // Changers.
     {
       std::map<int,particle_changer*>::iterator end1 = id_to_changer.end();
@@ -312,35 +469,21 @@ namespace enigma
         pt1 = (*pt_it1).second;
         pt2 = (*pt_it2).second;
 
-        std::vector<particle_instance>::iterator end2 = pi_list.end();
-        for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != end2; it++)
+        const size_t count = pi_list.count();
+        for (size_t i = 0; i < count; i++)
         {
-          if (p_ch->is_inside(it->x, it->y) && it->pt->id == pt1->id && it->life_current > 0) { // Skip particles with life_current <= 0.
-            // Store position of old particle.
-            const double x = it->x, y = it->y;
-            // Destroy the old particle.
-            // Only the clean-up is made here. The actual removal is handle after the loops by remove_if and erase.
-            pt1->particle_count--;
-            if (pt1->particle_count <= 0 && !pt1->alive) {
-              // Particle type is no longer used, delete it.
-              int pid = pt1->id;
-              delete pt1;
-              enigma::pt_manager.id_to_particletype.erase(pid);
-            }
-            // Internally when handling changers, setting life_current to 0 indicates that the particle has been removed.
-            it->life_current = 0;
-            // Create a new particle at its position.
-            generation_info gen_info;
-            gen_info.x = x;
-            gen_info.y = y;
-            gen_info.number = 1;
-            gen_info.pt = pt2;
-            particles_to_generate.push_back(gen_info);
-          }
+          if (pi_list.pt[i] != pt1 || !p_ch->is_inside(pi_list.x[i], pi_list.y[i])) continue;
+          // Create a new particle at its position.
+          generation_info gen_info;
+          gen_info.x = pi_list.x[i];
+          gen_info.y = pi_list.y[i];
+          gen_info.number = 1;
+          gen_info.pt = pt2;
+          particles_to_generate.push_back(gen_info);
+          // Destroy the old particle.
+          if (kill_particle(pi_list, i)) break; // That was the last particle of its type.
         }
       }
-      // Erase all particles with life_current <= 0.
-      pi_list.erase(std::remove_if(pi_list.begin(), pi_list.end(), is_dead_from_old_age), pi_list.end());
     }
     // Generate particles.
     for (std::vector<generation_info>::iterator it = particles_to_generate.begin(); it != particles_to_generate.end(); it++)
@@ -377,19 +520,22 @@ namespace enigma
       for (std::map<int,particle_attractor*>::iterator at_it = id_to_attractor.begin(); at_it != end; at_it++)
       {
         particle_attractor* p_a = (*at_it).second;
-        std::vector<particle_instance>::iterator end1 = pi_list.end();
-        for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != end1; it++)
+        const size_t count = pi_list.count();
+        for (size_t i = 0; i < count; i++)
         {
+          if (pi_list.pt[i] == NULL) continue;
           // If the particle is not inside the attractor range of influence,
           // or is at the attractor's exact position,
           // skip to next attractor.
-          const double dx = it->x - p_a->x;
-          const double dy = it->y - p_a->y;
-          const double relative_distance = sqrt(dx*dx + dy*dy)/std::max(1.0, p_a->dist_effect);
+          const double dx = pi_list.x[i] - p_a->x;
+          const double dy = pi_list.y[i] - p_a->y;
+          const double distance = sqrt(dx*dx + dy*dy);
+          const double relative_distance = distance/std::max(1.0, p_a->dist_effect);
           if (relative_distance > 1.0 || (fzero(dx) && fzero(dy))) {
             continue;
           }
-          const double direction_radians = atan2(-(p_a->y - it->y), p_a->x - it->x);
+          // Unit vector towards the attractor.
+          const double toward_x = -dx/distance, toward_y = -dy/distance;
           // Determine force.
           double force_effective_strength;
           switch (p_a->force_kind)  {
@@ -400,15 +546,18 @@ namespace enigma
           }
           // Apply force.
           if (p_a->additive) {
-            const double vx = it->speed*cos(it->direction*M_PI/180.0) + force_effective_strength*cos(direction_radians);
-            const double vy = -it->speed*sin(it->direction*M_PI/180.0) - force_effective_strength*sin(direction_radians);
-            it->speed = sqrt(vx*vx + vy*vy);
-            const double direction = it->direction;
-            it->direction = fzero(vx) && fzero(vy) ? direction : -atan2(vy,vx)*180.0/M_PI;
+            const double vx = pi_list.speed[i]*pi_list.head_x[i] + force_effective_strength*toward_x;
+            const double vy = pi_list.speed[i]*pi_list.head_y[i] + force_effective_strength*toward_y;
+            const double v = sqrt(vx*vx + vy*vy);
+            pi_list.speed[i] = v;
+            if (!(fzero(vx) && fzero(vy))) {
+              pi_list.head_x[i] = vx/v;
+              pi_list.head_y[i] = vy/v;
+            }
           }
           else {
-            it->x += force_effective_strength*cos(direction_radians);
-            it->y += -force_effective_strength*sin(direction_radians);
+            pi_list.x[i] += force_effective_strength*toward_x;
+            pi_list.y[i] += force_effective_strength*toward_y;
           }
         }
       }
@@ -419,28 +568,14 @@ namespace enigma
       for (std::map<int,particle_destroyer*>::iterator ds_it = id_to_destroyer.begin(); ds_it != end1; ds_it++)
       {
         particle_destroyer* p_ds = (*ds_it).second;
-        std::vector<particle_instance>::iterator end2 = pi_list.end();
-        for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != end2; it++)
+        const size_t count = pi_list.count();
+        for (size_t i = 0; i < count; i++)
         {
-          if (p_ds->is_inside(it->x, it->y) && it->life_current > 0) { // Skip particles with life_current <= 0.
-            particle_type* pt = it->pt;
-
-            // Death handling.
-            // Only the clean-up is made here. The actual removal is handle after the loops by remove_if and erase.
-            pt->particle_count--;
-            if (pt->particle_count <= 0 && !pt->alive) {
-              // Particle type is no longer used, delete it.
-              int pid = pt->id;
-              delete pt;
-              enigma::pt_manager.id_to_particletype.erase(pid);
-            }
-            // Internally when handling destroyers, setting life_current to 0 indicates that the particle has been removed.
-            it->life_current = 0;
+          if (pi_list.pt[i] != NULL && p_ds->is_inside(pi_list.x[i], pi_list.y[i])) {
+            kill_particle(pi_list, i);
           }
         }
       }
-      // Erase all particles with life_current <= 0.
-      pi_list.erase(std::remove_if(pi_list.begin(), pi_list.end(), is_dead_from_old_age), pi_list.end());
     }
     // Deflectors.
     {
@@ -448,36 +583,36 @@ namespace enigma
       for (std::map<int,particle_deflector*>::iterator df_it = id_to_deflector.begin(); df_it != end; df_it++)
       {
         particle_deflector* p_df = (*df_it).second;
-        std::vector<particle_instance>::iterator end2 = pi_list.end();
-        for (std::vector<particle_instance>::iterator it = pi_list.begin(); it != end2; it++)
+        const size_t count = pi_list.count();
+        for (size_t i = 0; i < count; i++)
         {
-          if (p_df->is_inside(it->x, it->y)) {
-            // Direction changing.
-            it->direction = fmod(it->direction + 360.0, 360.0);
-            switch (p_df->deflection_kind) {
-            case ps_de_horizontal : {
-              it->direction = it->direction <= 180.0 ? 180.0 - it->direction : 540.0 - it->direction;
-              break;
-            }
-            case ps_de_vertical : {
-              it->direction = 360.0 - it->direction;
-              break;
-            }
-            default : {
-              break;
-            }
-            }
-            // Friction handling.
-            const double new_speed = std::max(0.0, it->speed - p_df->friction);
-            const double friction_effect = it->speed - new_speed;
-            it->speed = new_speed;
-            // Move one step.
-            it->x += friction_effect*cos(it->direction*M_PI/180.0);
-            it->y += -friction_effect*sin(it->direction*M_PI/180.0);
+          if (pi_list.pt[i] == NULL || !p_df->is_inside(pi_list.x[i], pi_list.y[i])) continue;
+          // Direction changing.
+          switch (p_df->deflection_kind) {
+          case ps_de_horizontal : {
+            pi_list.head_x[i] = -pi_list.head_x[i];
+            break;
+          }
+          case ps_de_vertical : {
+            pi_list.head_y[i] = -pi_list.head_y[i];
+            break;
+          }
+          default : {
+            break;
+          }
           }
+          // Friction handling.
+          const double new_speed = std::max(0.0, pi_list.speed[i] - p_df->friction);
+          const double friction_effect = pi_list.speed[i] - new_speed;
+          pi_list.speed[i] = new_speed;
+          // Move one step.
+          pi_list.x[i] += friction_effect*pi_list.head_x[i];
+          pi_list.y[i] += friction_effect*pi_list.head_y[i];
         }
       }
     }
+    // Drop the particles that died during the step.
+    pi_list.remove_dead();
   }
   void particle_system::draw_particlesystem()
   {
@@ -494,7 +629,7 @@ namespace enigma
       pi.pt = pt;
       // Shape.
       if (!pt->is_particle_sprite) {
-        const enigma::sprite *const spr = enigma::spritestructarray[pt->sprite_id];
+        const enigma::sprite *const spr = enigma::sprite_get_resident(pt->sprite_id);
         const int subimage_count = spr->subcount;
         int subimageindex_initial;
         if (pt->sprite_random) {
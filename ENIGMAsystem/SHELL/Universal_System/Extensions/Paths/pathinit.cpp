@@ -27,49 +27,29 @@
 
 #include "pathstruct.h"
 #include "Universal_System/resinit.h"
-
-#include <cstring>
-#include <cstdio>
+#include "Universal_System/resource_pack.h"
 
 namespace enigma
 {
-  void exe_loadpaths(FILE *exe)
+  void exe_loadpaths()
   {
-    unsigned pathid, pointcount;
-    bool smooth, closed;
-    int x, y, speed, nullhere, precision;
-
-    if (!fread(&nullhere,4,1,exe)) return;
-    if (memcmp(&nullhere, "PTH ", sizeof(int)) != 0)
-      return;
-
-    // Determine how many paths we have
-    int pathcount;
-    if (!fread(&pathcount,4,1,exe)) return;
-
-    // Fetch the highest ID we will be using
-    int path_highid, buf;
-    if (!fread(&path_highid,4,1,exe)) return;
+    size_t pathcount;
+    const resource_pack::toc_entry *paths = resource_pack::entries(resource_pack::kind_path, &pathcount);
     paths_init();
 
-    for (int i = 0; i < pathcount; i++)
+    for (size_t i = 0; i < pathcount; i++)
     {
-      if (!fread(&pathid, 4,1,exe)) return;
-      if (!fread(&buf, 4,1,exe)) return;
-      smooth = buf; //to fix int to bool issues
-      if (!fread(&buf, 4,1,exe)) return;
-      closed = buf;
-      if (!fread(&precision, 4,1,exe)) return;
-
-      if (!fread(&pointcount,4,1,exe)) return;
+      // smooth, closed, precision, point count, then x, y and speed of each point
+      const int32_t *data = resource_pack::metadata(paths + i, 4);
+      if (!data) return;
+      const unsigned pathid = paths[i].id, pointcount = data[3];
+      if ((paths[i].size / sizeof(int32_t) - 4) / 3 < pointcount) return;
 
-      new path(pathid, smooth, closed, precision, pointcount);
+      new path(pathid, data[0], data[1], data[2], pointcount);
       for (unsigned ii=0;ii<pointcount;ii++)
       {
-        if (!fread(&x, 4,1,exe)) return;
-        if (!fread(&y, 4,1,exe)) return;
-        if (!fread(&speed, 4,1,exe)) return;
-        path_add_point(pathid, x, y, speed/100);
+        const int32_t *point = data + 4 + ii * 3;
+        path_add_point(pathid, point[0], point[1], point[2]/100);
       }
       path_recalculate(pathid);
     }
@@ -33,15 +33,41 @@ GM Global variables
 #define ENIGMA_GAME_GLOBALS_H
 
 #include <string>
+#ifndef JUST_DEFINE_IT_RUN
+#include <deque>
+#endif
 
+namespace enigma_user {
+extern std::string caption_score, caption_lives, caption_health;
+extern bool argument_relative;
+extern double health;
+
+// TODO: MOVEME: Who put this here?
+#ifndef JUST_DEFINE_IT_RUN
+extern std::deque<int> instance_id;
+#else
+extern int *instance_id;
+#endif
+
+extern double score;
+extern bool secure_mode;
+extern bool show_score, show_lives, show_health;
+extern int transition_kind;
+extern int transition_steps;
+extern bool automatic_redraw;
+extern int gamemaker_version;
+extern int cursor_sprite;
+extern int room_first, room_last;
+}  // namespace enigma_user
+
+// Objects and scripts compiled on their own only get the declarations; see SHELLmain.cpp.
+#ifndef ENIGMA_GAME_UNIT
 namespace enigma_user {
 std::string caption_score = "Score:", caption_lives = "Lives:", caption_health = "Health:";
 bool argument_relative = false;
 double health = 100;
 
-// TODO: MOVEME: Who put this here?
 #ifndef JUST_DEFINE_IT_RUN
-#include <deque>
 std::deque<int> instance_id;
 #else
 int *instance_id;
@@ -55,8 +81,8 @@ int transition_steps = 80;
 bool automatic_redraw = true;
 int gamemaker_version = 0;
 int cursor_sprite = -1;
-extern int room_first, room_last;
 }  // namespace enigma_user
+#endif
 
 /*********************
 End GM global variables
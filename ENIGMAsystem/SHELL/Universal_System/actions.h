@@ -297,8 +297,7 @@ inline void action_create_object(const int object, const double x, const double
         instance_create(x, y, object);
 }
 
-void action_create_object_random(const int object1, const int object2, const int object3, const int object4, const double x, const double y);
-void action_create_object_random(const int object1, const int object2, const int object3, const int object4, const double x, const double y)
+inline void action_create_object_random(const int object1, const int object2, const int object3, const int object4, const double x, const double y)
 {
     int obj_ar[4], obj_num = 0;
     if (object1 != -1)
@@ -10,6 +10,9 @@ void background_delete(int back, bool free_texture = true);
 int background_duplicate(int back);
 void background_assign(int back, int copy_background, bool free_texture = true);
 bool background_exists(int back);
+int background_prefetch(int back);  // Loads the image now rather than on first use; 0, or -1 if there's no such background
+int background_prefetch_multi(const var& backs);  // Loads an array of backgrounds, inflating them in parallel; -1 in a parallel step
+int background_flush(int back);     // Frees the image until next use; -1 unless it can be reloaded from the game, or in a parallel step
 void background_set_alpha_from_background(int back, int copy_background, bool free_texture = true);
 int background_get_texture(int backId);
 int background_get_width(int backId);
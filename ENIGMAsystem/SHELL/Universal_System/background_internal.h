@@ -25,6 +25,8 @@
 #define ENIGMA_BACKGROUND_INTERNAL_H
 
 #include <string>
+#include "parallel_events.h"
+#include "resource_residency.h"
 #include "var4.h"
 
 namespace enigma
@@ -42,6 +44,9 @@ namespace enigma
     double texturew, textureh;
 
     bool tileset;
+    bool resident = true; // False until the image is unpacked from the game module; see background_get_resident.
+    bool evictable = false; // Whether the image may be dropped and unpacked again later; see resource_residency.h.
+    unsigned long last_used = 0; // The residency_frame it was last fetched in.
 
     background();
     background(bool);
@@ -68,6 +73,28 @@ namespace enigma
   void background_add_copy(background *bak, background *bck_copy);
   void backgrounds_init();
   void backgroundstructarray_reallocate();
+  // Pads the pixels out to a power of two and makes them the background's texture.
+  void background_set_texture(background *bak, unsigned w, unsigned h, unsigned char* chunk);
+
+  // Unpacks the image of a background that was loaded from the game module without it.
+  void background_load_texture(int bkgid);
+  // Does the same for many backgrounds at once, inflating them on the thread pool.
+  // Backgrounds that are already loaded are skipped.
+  void backgrounds_load_textures(const int *bkgids, size_t count);
+  // Frees the texture of an evictable background until it's next fetched.
+  void background_unload_texture(int bkgid);
+  // Keeps a background's texture for good; call before changing it.
+  void background_pin(background *bak);
+  // Fetches a background, first unpacking its image if it isn't loaded. As with
+  // sprites, nothing is loaded during a parallel phase.
+  inline background *background_get_resident(int bkgid) {
+    background *bak = backgroundstructarray[bkgid];
+    if (bak && !parallel_phase) {
+      if (!bak->resident) background_load_texture(bkgid);
+      bak->last_used = residency_frame;
+    }
+    return bak;
+  }
 } //namespace enigma
 
 #ifdef DEBUG_MODE
@@ -78,18 +105,18 @@ namespace enigma
       show_error("Attempting to draw non-existing background " + toString(back), false);\
       return;\
     }\
-    enigma::background *bck2d = enigma::backgroundstructarray[back];
+    enigma::background *bck2d = enigma::background_get_resident(back);
   #define get_backgroundnv(bck2d,back,r)\
     if (back < 0 or size_t(back) >= enigma::background_idmax or !enigma::backgroundstructarray[back]) {\
       show_error("Attempting to draw non-existing background " + toString(back), false);\
       return r;\
     }\
-    enigma::background *bck2d = enigma::backgroundstructarray[back];
+    enigma::background *bck2d = enigma::background_get_resident(back);
 #else
   #define get_background(bck2d,back)\
-    enigma::background *bck2d = enigma::backgroundstructarray[back];
+    enigma::background *bck2d = enigma::background_get_resident(back);
   #define get_backgroundnv(bck2d,back,r)\
-    enigma::background *bck2d = enigma::backgroundstructarray[back];
+    enigma::background *bck2d = enigma::background_get_resident(back);
 #endif
 
 #define __GETR(x) ((x & 0x0000FF))
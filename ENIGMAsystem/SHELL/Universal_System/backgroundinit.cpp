@@ -18,8 +18,9 @@
 
 #include "background_internal.h"
 #include "libEGMstd.h"
-#include "zlib.h"
+#include "nlpo2.h"
 #include "resinit.h"
+#include "resource_pack.h"
 
 #include "Graphics_Systems/graphics_mandatory.h"
 #include "Widget_Systems/widgets_mandatory.h"
@@ -27,90 +28,126 @@
 
 #include <cstring>
 #include <cstdio>
+#include <vector>
 
 namespace enigma
 {
-  void exe_loadbackgrounds(FILE *exe)
-  {
-    int nullhere;
-    unsigned bkgid, width, height,transparent,smoothEdges,preload,useAsTileset,tileWidth,tileHeight,hOffset,vOffset,hSep,vSep;
- 
-    if (!fread(&nullhere, 4, 1, exe)) return;
-    if (memcmp(&nullhere, "BKG ", sizeof(int)) != 0) return;
-
-    // Determine how many backgrounds we have
-    int bkgcount;
-    if (!fread(&bkgcount,4,1,exe))
-      return;
-
+  namespace {
+    // Layout of a background's metadata entry.
+    enum { m_width, m_height, m_transparent, m_smooth, m_preload, m_tileset, m_tile_width, m_tile_height,
+           m_hoffset, m_voffset, m_hsep, m_vsep, m_count };
+
+    // Raw pixels decoded per batch of backgrounds, so preloading a large game
+    // never holds all of them at once. A background bigger than this is its own batch.
+    const unsigned long long batch_bytes = 64ull << 20;
+
+    // The background's texture, padded out as background_set_texture does.
+    unsigned long long resident_size(const background *bak) {
+      return 4ull * (nlpo2dc(bak->width) + 1) * (nlpo2dc(bak->height) + 1);
+    }
+  }
 
-    // Fetch the highest ID we will be using
-    int bkg_highid;
-    if (!fread(&bkg_highid,4,1,exe))
-      return;
+  // Only the metadata is read here; unless the game preloads its resources, the
+  // image stays packed in the mapped module until something draws the background.
+  void exe_loadbackgrounds()
+  {
+    size_t bkgcount;
+    const resource_pack::toc_entry *bkgs = resource_pack::entries(resource_pack::kind_background, &bkgcount);
+    std::vector<int> loaded;
 
-    for (int i = 0; i < bkgcount; i++)
+    for (size_t i = 0; i < bkgcount; i++)
     {
-      int unpacked;
-      if (!fread(&bkgid, 4,1,exe)) return;
-      if (!fread(&width, 4,1,exe)) return;
-      printf("width: %d", width);
-      if (!fread(&height,4,1,exe)) return;
-      printf("height: %d", height);
-
-      if (!fread(&transparent,4,1,exe)) return;
-      printf("transparent: %d", transparent);
-      if (!fread(&smoothEdges,4,1,exe)) return;
-      printf("smoothEdges: %d", smoothEdges);
-      if (!fread(&preload,4,1,exe)) return;
-      printf("preload: %d", preload);
-      if (!fread(&useAsTileset,4,1,exe)) return;
-      printf("useAsTileset: %d", useAsTileset);
-      if (!fread(&tileWidth,4,1,exe)) return;
-      printf("tileWidth: %d", tileWidth);
-      if (!fread(&tileHeight,4,1,exe)) return;
-      printf("tileHeight: %d", tileHeight);
-      if (!fread(&hOffset,4,1,exe)) return;
-      printf("hOffset: %d", hOffset);
-      if (!fread(&vOffset,4,1,exe)) return;
-      printf("vOffset: %d", vOffset);
-      if (!fread(&hSep,4,1,exe)) return;
-      printf("hSep: %d", hSep);
-      if (!fread(&vSep,4,1,exe)) return;
-      printf("vSep: %d", vSep);
-
+      const int32_t *m = resource_pack::metadata(bkgs + i, m_count);
+      if (!m) {
+        show_error("Background load error: Metadata for background " + enigma_user::toString(bkgs[i].id) + " is truncated", 0);
+        continue;
+      }
 
       //need to add: transparent, smooth, preload, tileset, tileWidth, tileHeight, hOffset, vOffset, hSep, vSep
+      background *bak = new background_tileset(m[m_width], m[m_height], -1, false, false, true, 32, 32, 0, 0, 1, 1);
+      bak->texturew = bak->textureh = 1;
+      bak->resident = false;
+      bak->evictable = true;
+      backgroundstructarray[bkgs[i].id] = bak;
+      loaded.push_back(bkgs[i].id);
+    }
 
-      unpacked = width*height*4;
+    if (preload_resources)
+      backgrounds_load_textures(loaded.data(), loaded.size());
+  }
 
-      unsigned int size;
-      if (!fread(&size,4,1,exe)){};
-      printf("Alloc size: %d", size);
+  // Images are inflated on the thread pool a batch at a time; only creating the
+  // textures happens here, on the main thread.
+  void backgrounds_load_textures(const int *bkgids, size_t count)
+  {
+    std::vector<const resource_pack::toc_entry*> entries;
+    std::vector<std::vector<unsigned char> > pixels;
+    std::vector<char> unpacked;
 
-      unsigned char* cpixels=new unsigned char[size+1];
-      if (!cpixels)
+    for (size_t first = 0, last; first < count; first = last)
+    {
+      entries.clear();
+      unsigned long long bytes = 0;
+      for (last = first; last < count && (last == first || bytes < batch_bytes); last++)
       {
-        show_error("Failed to load background: Cannot allocate enough memory "+enigma_user::toString(unpacked),0);
-        break;
+        background *bak = backgroundstructarray[bkgids[last]];
+        const resource_pack::toc_entry *e = NULL;
+        if (!bak->resident) {
+          e = resource_pack::find(resource_pack::kind_background_image, bkgids[last]);
+          if (!e || e->unpacked_size != unsigned(bak->width) * unsigned(bak->height) * 4)
+          {
+            show_error("Background load error: Background does not match expected size",0);
+            e = NULL;
+          }
+        }
+        entries.push_back(e);
+        if (e) bytes += e->unpacked_size;
       }
-      unsigned int sz2=fread(cpixels,1,size,exe);
-      if (size!=sz2) {
-        show_error("Failed to load background: Data is truncated before exe end. Read "+enigma_user::toString(sz2)+" out of expected "+enigma_user::toString(size),0);
-        return;
-      }
-      unsigned char* pixels=new unsigned char[unpacked+1];
-      if (zlib_decompress(cpixels,size,unpacked,pixels) != unpacked)
+
+      pixels.resize(entries.size());
+      unpacked.resize(entries.size());
+      resource_pack::unpack_all(entries.data(), entries.size(), pixels.data(), unpacked.data());
+
+      for (size_t i = first; i < last; i++)
       {
-        show_error("Background load error: Background does not match expected size",0);
-        continue;
+        // A damaged background gets a blank image and counts as loaded, so it's
+        // reported once rather than every frame. One listed twice loads once.
+        background *bak = backgroundstructarray[bkgids[i]];
+        if (bak->resident) continue;
+        bak->resident = true;
+
+        std::vector<unsigned char> &image = pixels[i - first];
+        if (!unpacked[i - first])
+        {
+          if (entries[i - first])
+            show_error("Background load error: Background data is damaged",0);
+          image.assign(bak->width * bak->height * 4, 0);
+        }
+        background_set_texture(bak, bak->width, bak->height, image.data());
+        std::vector<unsigned char>().swap(image);
+        if (bak->evictable) resident_bytes += resident_size(bak);
       }
-      delete[] cpixels;
+    }
+  }
 
-      printf("Adding background: %d\n\n", i);
-      background_new(bkgid, width, height, pixels, false, false, true, false, 32, 32, 0, 0, 1,1);
+  void background_load_texture(int bkgid)
+  {
+    backgrounds_load_textures(&bkgid, 1);
+  }
 
-      delete[] pixels;
-    }
+  void background_unload_texture(int bkgid)
+  {
+    background *bak = backgroundstructarray[bkgid];
+    if (!bak->evictable || !bak->resident) return;
+    resident_bytes -= resident_size(bak);
+    graphics_delete_texture(bak->texture);
+    bak->texture = -1;
+    bak->resident = false;
+  }
+
+  void background_pin(background *bak)
+  {
+    if (bak->evictable && bak->resident) resident_bytes -= resident_size(bak);
+    bak->evictable = false;
   }
 } //namespace enigma
@@ -26,6 +26,7 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 
 namespace enigma {
 background **backgroundstructarray;
@@ -68,10 +69,7 @@ void backgrounds_init() {
   for (unsigned i = 0; i < background_idmax; i++) backgroundstructarray[i] = NULL;
 }
 
-//Adds a subimage to an existing sprite from the exe
-void background_new(int bkgid, unsigned w, unsigned h, unsigned char *chunk, bool transparent, bool smoothEdges,
-                    bool preload, bool useAsTileset, int tileWidth, int tileHeight, int hOffset, int vOffset, int hSep,
-                    int vSep) {
+void background_set_texture(background *bak, unsigned w, unsigned h, unsigned char *chunk) {
   unsigned int fullwidth = enigma::nlpo2dc(w) + 1, fullheight = enigma::nlpo2dc(h) + 1;
   char *imgpxdata = new char[4 * fullwidth * fullheight + 1], *imgpxptr = imgpxdata;
   unsigned int rowindex, colindex;
@@ -87,16 +85,21 @@ void background_new(int bkgid, unsigned w, unsigned h, unsigned char *chunk, boo
   }
   memset(imgpxptr, 0, (fullheight - h) * fullwidth);
 
-  int texture = graphics_create_texture(w, h, fullwidth, fullheight, imgpxdata, false);
+  bak->texture = graphics_create_texture(w, h, fullwidth, fullheight, imgpxdata, false);
+  bak->texturew = (double)w / fullwidth;
+  bak->textureh = (double)h / fullheight;
   delete[] imgpxdata;
+}
 
+//Adds a subimage to an existing sprite from the exe
+void background_new(int bkgid, unsigned w, unsigned h, unsigned char *chunk, bool transparent, bool smoothEdges,
+                    bool preload, bool useAsTileset, int tileWidth, int tileHeight, int hOffset, int vOffset, int hSep,
+                    int vSep) {
   backgroundstructarray[bkgid] = useAsTileset
-                                     ? new background(w, h, texture, transparent, smoothEdges, preload)
-                                     : new background_tileset(w, h, texture, transparent, smoothEdges, preload,
+                                     ? new background(w, h, -1, transparent, smoothEdges, preload)
+                                     : new background_tileset(w, h, -1, transparent, smoothEdges, preload,
                                                               tileWidth, tileHeight, hOffset, vOffset, hSep, vSep);
-  background *bak = backgroundstructarray[bkgid];
-  bak->texturew = (double)w / fullwidth;
-  bak->textureh = (double)h / fullheight;
+  background_set_texture(backgroundstructarray[bkgid], w, h, chunk);
 }
 
 void background_add_to_index(background *bak, std::string filename, bool transparent, bool smoothEdges, bool preload,
@@ -198,6 +201,7 @@ int background_create_color(unsigned w, unsigned h, int col, bool preload) {
 bool background_replace(int back, std::string filename, bool transparent, bool smooth, bool preload, bool free_texture,
                         bool mipmap) {
   get_backgroundnv(bck, back, false);
+  enigma::background_pin(bck);
   if (free_texture) enigma::graphics_delete_texture(bck->texture);
 
   enigma::background_add_to_index(bck, filename, transparent, smooth, preload, mipmap);
@@ -218,6 +222,7 @@ void background_save(int back, std::string fname) {
 
 void background_delete(int back, bool free_texture) {
   get_background(bck, back);
+  enigma::background_pin(bck);
   if (free_texture) enigma::graphics_delete_texture(bck->texture);
 
   delete enigma::backgroundstructarray[back];
@@ -234,6 +239,7 @@ int background_duplicate(int back) {
 void background_assign(int back, int copy_background, bool free_texture) {
   get_background(bck, back);
   get_background(bck_copy, copy_background);
+  enigma::background_pin(bck);
   if (free_texture) enigma::graphics_delete_texture(bck->texture);
 
   enigma::background_add_copy(bck, bck_copy);
@@ -244,9 +250,37 @@ bool background_exists(int back) {
          bool(enigma::backgroundstructarray[back]);
 }
 
+int background_prefetch(int back) {
+  if (!background_exists(back)) return -1;
+  enigma::background_get_resident(back);
+  return 0;
+}
+
+int background_prefetch_multi(const var& backs) {
+  // Loading would race with the phase's own readers; background_get_resident
+  // refuses it there too.
+  if (enigma::parallel_phase) return -1;
+  std::vector<int> ids;
+  for (int i = 0; i < backs.array_len(); i++) {
+    if (!background_exists(backs[i])) return -1;
+    ids.push_back(backs[i]);
+  }
+  enigma::backgrounds_load_textures(ids.data(), ids.size());
+  for (size_t i = 0; i < ids.size(); i++) enigma::backgroundstructarray[ids[i]]->last_used = enigma::residency_frame;
+  return 0;
+}
+
+int background_flush(int back) {
+  // Other instances of a parallel step may be drawing it.
+  if (enigma::parallel_phase || !background_exists(back) || !enigma::backgroundstructarray[back]->evictable) return -1;
+  enigma::background_unload_texture(back);
+  return 0;
+}
+
 void background_set_alpha_from_background(int back, int copy_background, bool free_texture) {
   get_background(bck, back);
   get_background(bck_copy, copy_background);
+  enigma::background_pin(bck);
   enigma::graphics_replace_texture_alpha_from_texture(bck->texture, bck_copy->texture);
 }
 
@@ -84,6 +84,10 @@ variant buffer_read(int buffer, int type);
 void buffer_fill(int buffer, unsigned offset, int type, variant value, unsigned size);
 void buffer_poke(int buffer, unsigned offset, int type, variant value);
 void buffer_write(int buffer, int type, variant value);
+// Writes or reads count values of one type in a single call, starting at the
+// buffer's aligned position; much cheaper than a buffer_write per element.
+void buffer_write_array(int buffer, int type, const var& values, unsigned count);
+var buffer_read_array(int buffer, int type, unsigned count);
 
 void game_save_buffer(int buffer);
 void game_load_buffer(int buffer);
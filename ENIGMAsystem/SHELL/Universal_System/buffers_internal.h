@@ -22,6 +22,9 @@
 #ifndef ENIGMA_BUFFERS_INTERNAL_H
 #define ENIGMA_BUFFERS_INTERNAL_H
 
+#include "Platforms/General/PFfilemanip.h"
+
+#include <string>
 #include <vector>
 
 namespace enigma
@@ -32,17 +35,40 @@ namespace enigma
     unsigned position;
     unsigned alignment;
     int type;
+    // Set while the contents are a read-only view of a file from buffer_load;
+    // data stays empty until the first change copies the file into it.
+    file_mapping mapped;
+    // The path the mapping was made from, so a save over it can copy first.
+    std::string mapped_file;
     
     BinaryBuffer(unsigned size);
-    ~BinaryBuffer() = default;
+    BinaryBuffer(const BinaryBuffer&) = delete;
+    BinaryBuffer& operator=(const BinaryBuffer&) = delete;
+    ~BinaryBuffer();
     unsigned GetSize();
+    // The contents for reading, mapped or not.
+    const unsigned char *Bytes();
+    // The contents for changing; a mapped buffer is copied into data first.
+    std::vector<unsigned char> &Data();
+    // Copies size bytes starting at offset, wrapping around a wrap buffer and
+    // stopping at the end of any other.
+    void Snapshot(unsigned offset, unsigned size, std::vector<unsigned char> &out);
     void Resize(unsigned size);
     void Seek(unsigned offset);  
     unsigned char ReadByte();
     void WriteByte(unsigned char byte);
+    // Bulk versions of the above. Write follows the same grow/wrap rules as
+    // WriteByte; Read fails without moving if fewer than count bytes remain.
+    void Write(const void *src, unsigned count);
+    bool Read(void *dst, unsigned count);
   };
   
   extern std::vector<BinaryBuffer*> buffers;
+
+  // Copies every buffer still mapped from filename into its own memory, so
+  // the file can be truncated or replaced without pulling the bytes out from
+  // under it. Call before opening filename for writing.
+  void buffers_release_file(const std::string &filename);
 }
 
 #ifdef DEBUG_MODE
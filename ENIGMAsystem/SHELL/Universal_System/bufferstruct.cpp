@@ -17,11 +17,14 @@
 
 #include "buffers.h"
 #include "buffers_internal.h"
+#include "checksum.h"
 #include "libEGMstd.h"
 
 #include "Graphics_Systems/graphics_mandatory.h"
 
+#include <algorithm>
 #include <cstring>
+#include <stdint.h>
 #include <fstream>
 #include <iostream>
 
@@ -37,9 +40,54 @@ BinaryBuffer::BinaryBuffer(unsigned size) {
   type = 0;
 }
 
-unsigned BinaryBuffer::GetSize() { return data.size(); }
+BinaryBuffer::~BinaryBuffer() { file_unmap(mapped); }
 
-void BinaryBuffer::Resize(unsigned size) { data.resize(size, 0); }
+unsigned BinaryBuffer::GetSize() { return mapped.data ? mapped.size : data.size(); }
+
+const unsigned char *BinaryBuffer::Bytes() { return mapped.data ? mapped.data : data.data(); }
+
+std::vector<unsigned char> &BinaryBuffer::Data() {
+  if (mapped.data) {
+    data.assign(mapped.data, mapped.data + mapped.size);
+    file_unmap(mapped);
+    mapped_file.clear();
+  }
+  return data;
+}
+
+void buffers_release_file(const std::string &filename) {
+  for (BinaryBuffer *b : buffers)
+    if (b && b->mapped.data && b->mapped_file == filename) b->Data();
+}
+
+// Calls visit on the bytes [offset, offset + size) in as few contiguous runs
+// as there are: a wrap buffer wraps around as often as it takes, any other
+// buffer stops at its end.
+template<typename visitor> static void visit_range(BinaryBuffer *b, unsigned offset, unsigned size, visitor visit) {
+  const unsigned total = b->GetSize();
+  if (!total) return;
+  const unsigned char *bytes = b->Bytes();
+  if (b->type == enigma_user::buffer_wrap) {
+    offset %= total;
+    while (size) {
+      const unsigned run = std::min(size, total - offset);
+      visit(bytes + offset, run);
+      size -= run;
+      offset = 0;
+    }
+  } else if (offset < total) {
+    visit(bytes + offset, std::min(size, total - offset));
+  }
+}
+
+void BinaryBuffer::Snapshot(unsigned offset, unsigned size, std::vector<unsigned char> &out) {
+  out.clear();
+  visit_range(this, offset, size, [&out](const unsigned char *run, unsigned count) {
+    out.insert(out.end(), run, run + count);
+  });
+}
+
+void BinaryBuffer::Resize(unsigned size) { Data().resize(size, 0); }
 
 void BinaryBuffer::Seek(unsigned offset) {
   position = offset;
@@ -60,32 +108,183 @@ void BinaryBuffer::Seek(unsigned offset) {
 
 unsigned char BinaryBuffer::ReadByte() {
   Seek(position);
-  unsigned char byte = data[position];
+  unsigned char byte = Bytes()[position];
   Seek(position + 1);
   return byte;
 }
 
 void BinaryBuffer::WriteByte(unsigned char byte) {
   Seek(position);
-  data[position] = byte;
+  Data()[position] = byte;
   Seek(position + 1);
 }
 
+void BinaryBuffer::Write(const void *src, unsigned count) {
+  if (!count) return;
+  if (type == enigma_user::buffer_grow && position + count > GetSize()) {
+    Resize(position + count);
+  }
+  if (position + count > GetSize()) {
+    for (unsigned i = 0; i < count; i++) {
+      WriteByte(static_cast<const unsigned char*>(src)[i]);
+    }
+    return;
+  }
+  memcpy(&Data()[position], src, count);
+  Seek(position + count);
+}
+
+bool BinaryBuffer::Read(void *dst, unsigned count) {
+  if (position + count > GetSize()) return false;
+  if (count) memcpy(dst, Bytes() + position, count);
+  position += count;
+  return true;
+}
+
 int get_free_buffer() {
   for (unsigned i = 0; i < buffers.size(); i++) {
     if (!buffers[i]) {
       return i;
     }
   }
-  return buffers.size();
+  buffers.push_back(NULL);
+  return buffers.size() - 1;
+}
+
+// IEEE 754 half precision for buffer_f16, rounding to nearest even.
+static uint16_t float_to_half(float value) {
+  uint32_t f;
+  memcpy(&f, &value, sizeof(f));
+  const uint16_t sign = (f >> 16) & 0x8000;
+  f &= 0x7FFFFFFF;
+  if (f >= 0x7F800000) return sign | 0x7C00 | (f > 0x7F800000 ? 0x200 : 0);  // inf and nan
+  if (f >= 0x477FF000) return sign | 0x7C00;  // rounds past the largest half
+  if (f < 0x38800000) {
+    // Subnormal: adding one half lines the float's last bit up with the
+    // half's, so the FPU does the rounding.
+    float magic = 0.5f, sum;
+    memcpy(&sum, &f, sizeof(sum));
+    sum += magic;
+    uint32_t bits, magic_bits;
+    memcpy(&bits, &sum, sizeof(bits));
+    memcpy(&magic_bits, &magic, sizeof(magic_bits));
+    return sign | (bits - magic_bits);
+  }
+  // Rebias the exponent and round the dropped 13 bits to nearest even.
+  f += 0xC8000FFF + ((f >> 13) & 1);
+  return sign | (f >> 13);
 }
 
-std::vector<unsigned char> valToBytes(variant value, unsigned count) {
-  std::vector<unsigned char> result(0);
-  for (unsigned i = 0; i < count; i++) {
-    result.push_back(value >> ((i)*8));
+static float half_to_float(uint16_t h) {
+  const uint32_t sign = uint32_t(h & 0x8000) << 16, exp = (h >> 10) & 0x1F, mant = h & 0x3FF;
+  if (!exp) {
+    const float f = mant * (1.0f / 16777216.0f);
+    return sign ? -f : f;
+  }
+  const uint32_t bits = sign | (exp == 0x1F ? 0x7F800000 | (mant << 13) : ((exp + 112) << 23) | (mant << 13));
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Integer types keep the low bits of the value truncated toward zero.
+static int64_t to_integer(double d) { return d > -9.2e18 && d < 9.2e18 ? int64_t(d) : 0; }
+
+template<typename T> static unsigned store(unsigned char *out, T value) {
+  memcpy(out, &value, sizeof(value));
+  return sizeof(value);
+}
+template<typename T> static T load(const unsigned char *in) {
+  T value;
+  memcpy(&value, in, sizeof(value));
+  return value;
+}
+
+// Writes value to out as a fixed-size buffer type, in host byte order, and
+// returns the number of bytes written; strings and unknown types write none.
+static unsigned encode_value(int type, const variant &value, unsigned char *out) {
+  using namespace enigma_user;
+  switch (type) {
+    case buffer_u8:   return store<uint8_t>(out, to_integer(value));
+    case buffer_s8:   return store<int8_t>(out, to_integer(value));
+    case buffer_u16:  return store<uint16_t>(out, to_integer(value));
+    case buffer_s16:  return store<int16_t>(out, to_integer(value));
+    case buffer_u32:  return store<uint32_t>(out, to_integer(value));
+    case buffer_s32:  return store<int32_t>(out, to_integer(value));
+    case buffer_f16:  return store<uint16_t>(out, float_to_half(double(value)));
+    case buffer_f32:  return store<float>(out, double(value));
+    case buffer_f64:  return store<double>(out, value);
+    case buffer_bool: return store<uint8_t>(out, bool(value));
+    default:          return 0;
+  }
+}
+
+static variant decode_value(int type, const unsigned char *in) {
+  using namespace enigma_user;
+  switch (type) {
+    case buffer_u8:   return load<uint8_t>(in);
+    case buffer_s8:   return load<int8_t>(in);
+    case buffer_u16:  return load<uint16_t>(in);
+    case buffer_s16:  return load<int16_t>(in);
+    case buffer_u32:  return load<uint32_t>(in);
+    case buffer_s32:  return load<int32_t>(in);
+    case buffer_f16:  return half_to_float(load<uint16_t>(in));
+    case buffer_f32:  return load<float>(in);
+    case buffer_f64:  return load<double>(in);
+    case buffer_bool: return load<uint8_t>(in) != 0;
+    default:          return 0;
+  }
+}
+
+// Sequential reads and writes start on a multiple of the buffer's alignment.
+static void align(BinaryBuffer *b) {
+  if (b->alignment > 1 && b->position % b->alignment)
+    b->Seek(b->position + b->alignment - b->position % b->alignment);
+}
+
+// Values that fit before the end of the buffer are copied straight in and out
+// of data; the byte-wise paths only handle wrapping and running off the end.
+static variant read_value(BinaryBuffer *b, int type) {
+  if (type == enigma_user::buffer_string) {
+    if (b->position < b->GetSize()) {
+      const char *start = reinterpret_cast<const char*>(b->Bytes() + b->position);
+      if (const void *nul = memchr(start, 0, b->GetSize() - b->position)) {
+        const unsigned len = static_cast<const char*>(nul) - start;
+        const string str(start, len);
+        b->Seek(b->position + len + 1);
+        return str;
+      }
+    }
+    string str;
+    for (unsigned i = 0; i < b->GetSize(); i++) {
+      const char byte = b->ReadByte();
+      if (!byte) break;
+      str += byte;
+    }
+    return str;
+  }
+  unsigned char bytes[8];
+  const unsigned size = enigma_user::buffer_sizeof(type);
+  if (!b->Read(bytes, size)) {
+    for (unsigned i = 0; i < size; i++) bytes[i] = b->ReadByte();
+  }
+  return decode_value(type, bytes);
+}
+
+static void write_value(BinaryBuffer *b, int type, const variant &value) {
+  if (type == enigma_user::buffer_string) {
+    const string str = value.type == enigma_user::ty_string ? value.sval() : toString(value);
+    b->Write(str.c_str(), str.length() + 1);
+    return;
   }
-  return result;
+  unsigned char bytes[8];
+  b->Write(bytes, encode_value(type, value, bytes));
+}
+
+// Whether a run of values of this type can be copied as one block, with no
+// alignment padding between them.
+static bool packs(BinaryBuffer *b, unsigned size) {
+  return size && (b->alignment <= 1 || size % b->alignment == 0);
 }
 }  // namespace enigma
 
@@ -96,135 +295,116 @@ int buffer_create(unsigned size, int type, unsigned alignment) {
   buffer->type = type;
   buffer->alignment = alignment;
   int id = enigma::get_free_buffer();
-  enigma::buffers.insert(enigma::buffers.begin() + id, buffer);
+  enigma::buffers[id] = buffer;
   return id;
 }
 
 void buffer_delete(int buffer) {
   get_buffer(binbuff, buffer);
   delete binbuff;
+  enigma::buffers[buffer] = NULL;
 }
 
 void buffer_copy(int src_buffer, unsigned src_offset, unsigned size, int dest_buffer, unsigned dest_offset) {
   get_buffer(srcbuff, src_buffer);
   get_buffer(dstbuff, dest_buffer);
 
+  std::vector<unsigned char> &dst = dstbuff->Data();
+  const unsigned char *src = srcbuff->Bytes();
   unsigned over = size - srcbuff->GetSize();
   switch (dstbuff->type) {
     case buffer_wrap:
-      dstbuff->data.insert(dstbuff->data.begin() + dest_offset, srcbuff->data.begin() + src_offset,
-                           srcbuff->data.begin() + src_offset + size - over);
-      dstbuff->data.insert(dstbuff->data.begin() + dest_offset, srcbuff->data.begin(), srcbuff->data.begin() + over);
+      dst.insert(dst.begin() + dest_offset, src + src_offset,
+                           src + src_offset + size - over);
+      dst.insert(dst.begin() + dest_offset, src, src + over);
       break;
     case buffer_grow:
-      dstbuff->data.insert(dstbuff->data.begin() + dest_offset, srcbuff->data.begin() + src_offset,
-                           srcbuff->data.begin() + src_offset + size);
+      dst.insert(dst.begin() + dest_offset, src + src_offset,
+                           src + src_offset + size);
       break;
     default:
-      dstbuff->data.insert(dstbuff->data.begin() + dest_offset, srcbuff->data.begin() + src_offset,
-                           srcbuff->data.begin() + src_offset + size - over);
+      dst.insert(dst.begin() + dest_offset, src + src_offset,
+                           src + src_offset + size - over);
       break;
   }
 }
 
 void buffer_save(int buffer, string filename) {
   get_buffer(binbuff, buffer);
-  std::ofstream myfile(filename.c_str());
-  if (!myfile.is_open()) {
-    std::cout << "Unable to open file " << filename;
-    return;
-  }
-  myfile.write(reinterpret_cast<const char*>(&binbuff->data[0]), binbuff->data.size());
-  myfile.close();
+  buffer_save_ext(buffer, filename, 0, binbuff->GetSize());
 }
 
 void buffer_save_ext(int buffer, string filename, unsigned offset, unsigned size) {
   get_buffer(binbuff, buffer);
-  std::ofstream myfile(filename.c_str());
+  // Opening the file truncates it, which would take the bytes of any buffer
+  // mapped from it, this one included, along with it.
+  enigma::buffers_release_file(filename);
+  std::ofstream myfile(filename.c_str(), std::ios::binary);
   if (!myfile.is_open()) {
     std::cout << "Unable to open file " << filename;
     return;
   }
-
-  unsigned over = size - binbuff->GetSize();
-  switch (binbuff->type) {
-    case buffer_wrap:
-      myfile.write(reinterpret_cast<const char*>(&binbuff->data[offset]), size - over);
-      myfile.write(reinterpret_cast<const char*>(&binbuff->data[0]), over);
-      break;
-    case buffer_grow:
-      //TODO: Might need to use min(size, binbuff->GetSize()); for the last parameter.
-      //Depends on whether Stupido will write 0's to fill in the entire size you gave it even though the data isn't that big.
-      myfile.write(reinterpret_cast<const char*>(&binbuff->data[offset]), size);
-      break;
-    default:
-      myfile.write(reinterpret_cast<const char*>(&binbuff->data[offset]), binbuff->GetSize());
-      break;
-  }
-
+  enigma::visit_range(binbuff, offset, size, [&myfile](const unsigned char *run, unsigned count) {
+    myfile.write(reinterpret_cast<const char*>(run), count);
+  });
   myfile.close();
 }
 
+// Large files are mapped rather than read, so loading is cheap however large
+// they are; pages are read in as they are touched, and the first change to the
+// buffer, or a save over the file, copies it into memory. Small files are
+// copied straight away, where a mapping buys nothing. A mapped file truncated
+// by another program while loaded will still fault on the next read.
+static const unsigned long long buffer_map_threshold = 1 << 20;
+
 int buffer_load(string filename) {
+  enigma::file_mapping mapped;
+  if (!enigma::file_map(filename, mapped)) {
+    std::cout << "Unable to open file " << filename;
+    return -1;
+  }
   enigma::BinaryBuffer* buffer = new enigma::BinaryBuffer(0);
   buffer->type = buffer_grow;
   buffer->alignment = 1;
+  buffer->mapped = mapped;
+  buffer->mapped_file = filename;
+  if (mapped.size < buffer_map_threshold) buffer->Data();
   int id = enigma::get_free_buffer();
-  enigma::buffers.insert(enigma::buffers.begin() + id, buffer);
-
-  std::ifstream myfile(filename.c_str());
-  if (!myfile.is_open()) {
-    std::cout << "Unable to open file " << filename;
-    return -1;
-  }
-  myfile.read(reinterpret_cast<char*>(&buffer->data[0]), myfile.tellg());
-  myfile.close();
-
+  enigma::buffers[id] = buffer;
   return id;
 }
 
 void buffer_load_ext(int buffer, string filename, unsigned offset) {
   get_buffer(binbuff, buffer);
-
-  std::ifstream myfile(filename.c_str());
-  if (!myfile.is_open()) {
+  enigma::file_mapping mapped;
+  if (!enigma::file_map(filename, mapped)) {
     std::cout << "Unable to open file " << filename;
     return;
   }
-  std::vector<char> data;
-  myfile.read(reinterpret_cast<char*>(&data[0]), myfile.tellg());
-  unsigned over = data.size() - binbuff->GetSize();
-  switch (binbuff->type) {
-    case buffer_wrap:
-      binbuff->data.insert(binbuff->data.begin() + offset, data.begin(), data.end() - over);
-      binbuff->data.insert(binbuff->data.begin(), data.begin(), data.begin() + over);
-      break;
-    case buffer_grow:
-      binbuff->data.insert(binbuff->data.begin() + offset, data.begin(), data.end());
-      break;
-    default:
-      binbuff->data.insert(binbuff->data.begin() + offset, data.begin(), data.end() - over);
-      break;
+  unsigned size = mapped.size;
+  if (binbuff->type != buffer_grow && binbuff->type != buffer_wrap) {
+    size = offset < binbuff->GetSize() ? std::min(size, binbuff->GetSize() - offset) : 0;
   }
-
-  myfile.close();
+  const unsigned position = binbuff->position;
+  binbuff->Seek(offset);
+  binbuff->Write(mapped.data, size);
+  binbuff->position = position;
+  enigma::file_unmap(mapped);
 }
 
 void buffer_fill(int buffer, unsigned offset, int type, variant value, unsigned size) {
   get_buffer(binbuff, buffer);
   unsigned nsize = offset + size;
   if (binbuff->GetSize() < nsize && binbuff->type == buffer_grow) {
-    binbuff->data.resize(nsize);
+    binbuff->Resize(nsize);
   }
-  unsigned pos = offset;
-  for (unsigned i = 0; i < buffer_sizeof(type); i++) {
-    binbuff[pos] = value[i];
-    if (i > binbuff->GetSize()) {
-      if (binbuff->type != buffer_wrap) {
-        break;
-      }
-      pos = 0;
-    }
+  unsigned char bytes[8];
+  const unsigned vsize = enigma::encode_value(type, value, bytes);
+  if (!vsize) return;
+  const unsigned stride = enigma::packs(binbuff, vsize) ? vsize : (vsize + binbuff->alignment - 1) / binbuff->alignment * binbuff->alignment;
+  const unsigned end = nsize < binbuff->GetSize() ? nsize : binbuff->GetSize();
+  for (unsigned pos = offset; pos < end && end - pos >= vsize; pos += stride) {
+    memcpy(&binbuff->Data()[pos], bytes, vsize);
   }
 }
 
@@ -305,97 +485,129 @@ int buffer_tell(int buffer) {
 
 variant buffer_peek(int buffer, unsigned offset, int type) {
   get_bufferr(binbuff, buffer, -1);
+  const unsigned position = binbuff->position;
   binbuff->Seek(offset);
-  if (type != buffer_string) {
-    //unsigned dsize = buffer_sizeof(type) + binbuff->alignment - 1;
-    unsigned char data[buffer_sizeof(type)];
-    //NOTE: These buffers most likely need a little more code added to take care of endianess on different architectures.
-    //TODO: Fix floating point precision.
-    long res = 0;
-    for (unsigned i = 0; i < buffer_sizeof(type); i++) {
-      data[i] = binbuff->ReadByte();
-      res += data[i] << i * 8;
-    }
-    return res;
-  } else {
-    char byte = '1';
-    std::vector<char> data;
-    while (byte != 0x00) {
-      byte = binbuff->ReadByte();
-      data.push_back(byte);
-    }
-    return variant(&data[0]);
-  }
+  variant value = enigma::read_value(binbuff, type);
+  binbuff->position = position;
+  return value;
 }
 
 variant buffer_read(int buffer, int type) {
   get_bufferr(binbuff, buffer, -1);
-  return buffer_peek(buffer, binbuff->position, type);
+  enigma::align(binbuff);
+  return enigma::read_value(binbuff, type);
 }
 
 void buffer_poke(int buffer, unsigned offset, int type, variant value) {
   get_buffer(binbuff, buffer);
+  const unsigned position = binbuff->position;
   binbuff->Seek(offset);
-  if (type != buffer_string) {
-    //TODO: Implement buffer alignment.
-    //unsigned dsize = buffer_sizeof(type); //+ binbuff->alignment - 1;
-    std::vector<unsigned char> data = enigma::valToBytes(value, buffer_sizeof(type));
-    for (unsigned i = 0; i < data.size(); i++) {
-      binbuff->WriteByte(data[i]);
-    }
-  } else {
-    char byte = '1';
-    unsigned pos = 0;
-    while (byte != 0x00) {
-      byte = value[pos];
-      pos += 1;
-      binbuff->WriteByte(byte);
+  enigma::write_value(binbuff, type, value);
+  binbuff->position = position;
+}
+
+void buffer_write(int buffer, int type, variant value) {
+  get_buffer(binbuff, buffer);
+  enigma::align(binbuff);
+  enigma::write_value(binbuff, type, value);
+}
+
+void buffer_write_array(int buffer, int type, const var& values, unsigned count) {
+  get_buffer(binbuff, buffer);
+  const unsigned size = buffer_sizeof(type);
+  enigma::align(binbuff);
+  if (enigma::packs(binbuff, size)) {
+    const unsigned total = size * count;
+    if (binbuff->type == buffer_grow && binbuff->position + total > binbuff->GetSize()) {
+      binbuff->Resize(binbuff->position + total);
     }
-    if (binbuff->alignment > pos) {
-      for (unsigned i = 0; i < binbuff->alignment - pos; i++) {
-        binbuff->WriteByte(0);
+    if (binbuff->position + total <= binbuff->GetSize()) {
+      unsigned char *out = binbuff->Data().data() + binbuff->position;
+      for (unsigned i = 0; i < count; i++, out += size) {
+        enigma::encode_value(type, values[i], out);
       }
+      binbuff->Seek(binbuff->position + total);
+      return;
     }
   }
+  for (unsigned i = 0; i < count; i++) {
+    if (i) enigma::align(binbuff);
+    enigma::write_value(binbuff, type, values[i]);
+  }
 }
 
-void buffer_write(int buffer, int type, variant value) {
-  get_buffer(binbuff, buffer);
-  buffer_poke(buffer, binbuff->position, type, value);
+var buffer_read_array(int buffer, int type, unsigned count) {
+  var values;
+  get_bufferr(binbuff, buffer, values);
+  if (!count) return values;
+  values[count - 1] = 0;
+  const unsigned size = buffer_sizeof(type);
+  enigma::align(binbuff);
+  if (enigma::packs(binbuff, size) && binbuff->position + size * count <= binbuff->GetSize()) {
+    const unsigned char *in = binbuff->Bytes() + binbuff->position;
+    for (unsigned i = 0; i < count; i++, in += size) {
+      values[i] = enigma::decode_value(type, in);
+    }
+    binbuff->position += size * count;
+    return values;
+  }
+  for (unsigned i = 0; i < count; i++) {
+    if (i) enigma::align(binbuff);
+    values[i] = enigma::read_value(binbuff, type);
+  }
+  return values;
 }
 
 string buffer_md5(int buffer, unsigned offset, unsigned size) {
-  //get_bufferr(binbuff, buffer, 0);
-  //TODO: Write this function
-  return NULL;
+  get_bufferr(binbuff, buffer, "");
+  enigma::md5_context md5;
+  enigma::visit_range(binbuff, offset, size, [&md5](const unsigned char *run, unsigned count) { md5.update(run, count); });
+  return md5.hex_digest();
 }
 
 string buffer_sha1(int buffer, unsigned offset, unsigned size) {
-  //get_bufferr(binbuff, buffer, 0);
-  //TODO: Write this function
-  return NULL;
+  get_bufferr(binbuff, buffer, "");
+  enigma::sha1_context sha1;
+  enigma::visit_range(binbuff, offset, size, [&sha1](const unsigned char *run, unsigned count) { sha1.update(run, count); });
+  return sha1.hex_digest();
 }
 
 int buffer_base64_decode(string str) {
-  enigma::BinaryBuffer* buffer = new enigma::BinaryBuffer(0);
+  enigma::BinaryBuffer* buffer = new enigma::BinaryBuffer(enigma::base64_decoded_max(str.size()));
   buffer->type = buffer_grow;
   buffer->alignment = 1;
+  buffer->data.resize(enigma::base64_decode(str.data(), str.size(), buffer->data.data()));
   int id = enigma::get_free_buffer();
-  enigma::buffers.insert(enigma::buffers.begin() + id, buffer);
-  //TODO: Write this function
+  enigma::buffers[id] = buffer;
   return id;
 }
 
 int buffer_base64_decode_ext(int buffer, string str, unsigned offset) {
-  //get_bufferr(binbuff, buffer, -1);
-  //TODO: Write this function
-  return 0;
+  get_bufferr(binbuff, buffer, -1);
+  std::vector<unsigned char> bytes(enigma::base64_decoded_max(str.size()));
+  const unsigned size = enigma::base64_decode(str.data(), str.size(), bytes.data());
+  const unsigned position = binbuff->position;
+  binbuff->Seek(offset);
+  binbuff->Write(bytes.data(), size);
+  binbuff->position = position;
+  return size;
 }
 
 string buffer_base64_encode(int buffer, unsigned offset, unsigned size) {
-  //get_bufferr(binbuff, buffer, 0);
-  //TODO: Write this function
-  return NULL;
+  get_bufferr(binbuff, buffer, "");
+  // Only a range that wraps needs stitching together first.
+  const unsigned char *bytes;
+  std::vector<unsigned char> stitched;
+  if (offset < binbuff->GetSize() && size <= binbuff->GetSize() - offset) {
+    bytes = binbuff->Bytes() + offset;
+  } else {
+    binbuff->Snapshot(offset, size, stitched);
+    bytes = stitched.data();
+    size = stitched.size();
+  }
+  string str(enigma::base64_encoded_size(size), '=');
+  if (size) enigma::base64_encode(bytes, size, &str[0]);
+  return str;
 }
 
 void game_save_buffer(int buffer) {
@@ -47,6 +47,18 @@ namespace enigma {
     particle_updating_callbacks.push_back(callback);
   }
 
+  // Asynchronous dispatch, once per step on the game thread.
+  list<callback_t> async_dispatch_callbacks;
+  void perform_callbacks_async_dispatch() {
+    list<callback_t>::iterator it_end = async_dispatch_callbacks.end();
+    for (list<callback_t>::iterator it = async_dispatch_callbacks.begin(); it != it_end; it++) {
+      (*it)();
+    }
+  }
+  void register_callback_async_dispatch(callback_t callback) {
+    async_dispatch_callbacks.push_back(callback);
+  }
+
   // Clean up room-end.
   list<callback_t> clean_up_roomend_callbacks;
   void perform_callbacks_clean_up_roomend() {
@@ -58,5 +70,17 @@ namespace enigma {
   void register_callback_clean_up_roomend(callback_t callback) {
     clean_up_roomend_callbacks.push_back(callback);
   }
+
+  // Game end.
+  list<callback_t> game_end_callbacks;
+  void perform_callbacks_game_end() {
+    list<callback_t>::iterator it_end = game_end_callbacks.end();
+    for (list<callback_t>::iterator it = game_end_callbacks.begin(); it != it_end; it++) {
+      (*it)();
+    }
+  }
+  void register_callback_game_end(callback_t callback) {
+    game_end_callbacks.push_back(callback);
+  }
 }
 
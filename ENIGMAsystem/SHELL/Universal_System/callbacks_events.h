@@ -27,9 +27,17 @@ namespace enigma {
   void perform_callbacks_particle_updating();
   void register_callback_particle_updating(void (*callback)());
 
+  // Asynchronous dispatch, where finished background work raises its events.
+  void perform_callbacks_async_dispatch();
+  void register_callback_async_dispatch(void (*callback)());
+
   // Clean up room-end.
   void perform_callbacks_clean_up_roomend();
   void register_callback_clean_up_roomend(void (*callback)());
+
+  // Game end, after the game end events; background work must finish here.
+  void perform_callbacks_game_end();
+  void register_callback_game_end(void (*callback)());
 }
 
 #endif // ENIGMA_CALLBACKS_EVENTS_H
@@ -0,0 +1,287 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "checksum.h"
+
+#include <string.h>
+
+namespace {
+
+// Byte-order independent loads and stores; compilers turn these into single
+// (byte-swapped where needed) moves.
+inline uint32_t load_le32(const unsigned char* p) {
+  return uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24;
+}
+inline uint32_t load_be32(const unsigned char* p) {
+  return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | uint32_t(p[3]);
+}
+inline void store_le32(unsigned char* p, uint32_t v) {
+  p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+inline void store_be32(unsigned char* p, uint32_t v) {
+  p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+inline uint32_t rotl(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+std::string to_hex(const unsigned char* digest, unsigned size) {
+  static const char digits[] = "0123456789abcdef";
+  std::string hex(size * 2, '0');
+  for (unsigned i = 0; i < size; i++) {
+    hex[2 * i] = digits[digest[i] >> 4];
+    hex[2 * i + 1] = digits[digest[i] & 15];
+  }
+  return hex;
+}
+
+// The shared tail of both hashes: buffer what is left of a partial block,
+// run every whole block straight from the caller's memory, keep the rest.
+template<typename blocks>
+void stream(blocks ctx, unsigned char* block, size_t& used, const unsigned char* in, size_t size) {
+  if (used) {
+    const size_t take = size < 64 - used ? size : 64 - used;
+    memcpy(block + used, in, take);
+    used += take, in += take, size -= take;
+    if (used < 64) return;
+    ctx(block, 1);
+    used = 0;
+  }
+  if (size >= 64) {
+    ctx(in, size / 64);
+    in += size / 64 * 64;
+    size %= 64;
+  }
+  memcpy(block, in, size);
+  used = size;
+}
+
+// The closing padding: a one bit, zeros, and the length in bits.
+template<typename blocks>
+void pad(blocks ctx, unsigned char* block, size_t used, uint64_t length, bool big_endian) {
+  block[used++] = 0x80;
+  if (used > 56) {
+    memset(block + used, 0, 64 - used);
+    ctx(block, 1);
+    used = 0;
+  }
+  memset(block + used, 0, 56 - used);
+  const uint64_t bits = length * 8;
+  for (int i = 0; i < 8; i++) block[56 + i] = big_endian ? bits >> (56 - 8 * i) : bits >> (8 * i);
+  ctx(block, 1);
+}
+
+}  // namespace
+
+namespace enigma {
+
+md5_context::md5_context(): length(0), used(0) {
+  state[0] = 0x67452301; state[1] = 0xefcdab89; state[2] = 0x98badcfe; state[3] = 0x10325476;
+}
+
+#define MD5_STEP(f, a, b, c, d, k, s, t) \
+  a += f(b, c, d) + x[k] + t; a = b + rotl(a, s);
+#define MD5_F(b, c, d) (d ^ (b & (c ^ d)))
+#define MD5_G(b, c, d) (c ^ (d & (b ^ c)))
+#define MD5_H(b, c, d) (b ^ c ^ d)
+#define MD5_I(b, c, d) (c ^ (b | ~d))
+
+void md5_context::process(const unsigned char* blocks, size_t count) {
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+  for (; count; --count, blocks += 64) {
+    uint32_t x[16];
+    for (int i = 0; i < 16; i++) x[i] = load_le32(blocks + 4 * i);
+    const uint32_t a0 = a, b0 = b, c0 = c, d0 = d;
+    MD5_STEP(MD5_F, a, b, c, d,  0,  7, 0xd76aa478) MD5_STEP(MD5_F, d, a, b, c,  1, 12, 0xe8c7b756)
+    MD5_STEP(MD5_F, c, d, a, b,  2, 17, 0x242070db) MD5_STEP(MD5_F, b, c, d, a,  3, 22, 0xc1bdceee)
+    MD5_STEP(MD5_F, a, b, c, d,  4,  7, 0xf57c0faf) MD5_STEP(MD5_F, d, a, b, c,  5, 12, 0x4787c62a)
+    MD5_STEP(MD5_F, c, d, a, b,  6, 17, 0xa8304613) MD5_STEP(MD5_F, b, c, d, a,  7, 22, 0xfd469501)
+    MD5_STEP(MD5_F, a, b, c, d,  8,  7, 0x698098d8) MD5_STEP(MD5_F, d, a, b, c,  9, 12, 0x8b44f7af)
+    MD5_STEP(MD5_F, c, d, a, b, 10, 17, 0xffff5bb1) MD5_STEP(MD5_F, b, c, d, a, 11, 22, 0x895cd7be)
+    MD5_STEP(MD5_F, a, b, c, d, 12,  7, 0x6b901122) MD5_STEP(MD5_F, d, a, b, c, 13, 12, 0xfd987193)
+    MD5_STEP(MD5_F, c, d, a, b, 14, 17, 0xa679438e) MD5_STEP(MD5_F, b, c, d, a, 15, 22, 0x49b40821)
+    MD5_STEP(MD5_G, a, b, c, d,  1,  5, 0xf61e2562) MD5_STEP(MD5_G, d, a, b, c,  6,  9, 0xc040b340)
+    MD5_STEP(MD5_G, c, d, a, b, 11, 14, 0x265e5a51) MD5_STEP(MD5_G, b, c, d, a,  0, 20, 0xe9b6c7aa)
+    MD5_STEP(MD5_G, a, b, c, d,  5,  5, 0xd62f105d) MD5_STEP(MD5_G, d, a, b, c, 10,  9, 0x02441453)
+    MD5_STEP(MD5_G, c, d, a, b, 15, 14, 0xd8a1e681) MD5_STEP(MD5_G, b, c, d, a,  4, 20, 0xe7d3fbc8)
+    MD5_STEP(MD5_G, a, b, c, d,  9,  5, 0x21e1cde6) MD5_STEP(MD5_G, d, a, b, c, 14,  9, 0xc33707d6)
+    MD5_STEP(MD5_G, c, d, a, b,  3, 14, 0xf4d50d87) MD5_STEP(MD5_G, b, c, d, a,  8, 20, 0x455a14ed)
+    MD5_STEP(MD5_G, a, b, c, d, 13,  5, 0xa9e3e905) MD5_STEP(MD5_G, d, a, b, c,  2,  9, 0xfcefa3f8)
+    MD5_STEP(MD5_G, c, d, a, b,  7, 14, 0x676f02d9) MD5_STEP(MD5_G, b, c, d, a, 12, 20, 0x8d2a4c8a)
+    MD5_STEP(MD5_H, a, b, c, d,  5,  4, 0xfffa3942) MD5_STEP(MD5_H, d, a, b, c,  8, 11, 0x8771f681)
+    MD5_STEP(MD5_H, c, d, a, b, 11, 16, 0x6d9d6122) MD5_STEP(MD5_H, b, c, d, a, 14, 23, 0xfde5380c)
+    MD5_STEP(MD5_H, a, b, c, d,  1,  4, 0xa4beea44) MD5_STEP(MD5_H, d, a, b, c,  4, 11, 0x4bdecfa9)
+    MD5_STEP(MD5_H, c, d, a, b,  7, 16, 0xf6bb4b60) MD5_STEP(MD5_H, b, c, d, a, 10, 23, 0xbebfbc70)
+    MD5_STEP(MD5_H, a, b, c, d, 13,  4, 0x289b7ec6) MD5_STEP(MD5_H, d, a, b, c,  0, 11, 0xeaa127fa)
+    MD5_STEP(MD5_H, c, d, a, b,  3, 16, 0xd4ef3085) MD5_STEP(MD5_H, b, c, d, a,  6, 23, 0x04881d05)
+    MD5_STEP(MD5_H, a, b, c, d,  9,  4, 0xd9d4d039) MD5_STEP(MD5_H, d, a, b, c, 12, 11, 0xe6db99e5)
+    MD5_STEP(MD5_H, c, d, a, b, 15, 16, 0x1fa27cf8) MD5_STEP(MD5_H, b, c, d, a,  2, 23, 0xc4ac5665)
+    MD5_STEP(MD5_I, a, b, c, d,  0,  6, 0xf4292244) MD5_STEP(MD5_I, d, a, b, c,  7, 10, 0x432aff97)
+    MD5_STEP(MD5_I, c, d, a, b, 14, 15, 0xab9423a7) MD5_STEP(MD5_I, b, c, d, a,  5, 21, 0xfc93a039)
+    MD5_STEP(MD5_I, a, b, c, d, 12,  6, 0x655b59c3) MD5_STEP(MD5_I, d, a, b, c,  3, 10, 0x8f0ccc92)
+    MD5_STEP(MD5_I, c, d, a, b, 10, 15, 0xffeff47d) MD5_STEP(MD5_I, b, c, d, a,  1, 21, 0x85845dd1)
+    MD5_STEP(MD5_I, a, b, c, d,  8,  6, 0x6fa87e4f) MD5_STEP(MD5_I, d, a, b, c, 15, 10, 0xfe2ce6e0)
+    MD5_STEP(MD5_I, c, d, a, b,  6, 15, 0xa3014314) MD5_STEP(MD5_I, b, c, d, a, 13, 21, 0x4e0811a1)
+    MD5_STEP(MD5_I, a, b, c, d,  4,  6, 0xf7537e82) MD5_STEP(MD5_I, d, a, b, c, 11, 10, 0xbd3af235)
+    MD5_STEP(MD5_I, c, d, a, b,  2, 15, 0x2ad7d2bb) MD5_STEP(MD5_I, b, c, d, a,  9, 21, 0xeb86d391)
+    a += a0, b += b0, c += c0, d += d0;
+  }
+  state[0] = a, state[1] = b, state[2] = c, state[3] = d;
+}
+
+#undef MD5_STEP
+#undef MD5_F
+#undef MD5_G
+#undef MD5_H
+#undef MD5_I
+
+void md5_context::update(const void* data, size_t size) {
+  length += size;
+  stream([this](const unsigned char* p, size_t n) { process(p, n); }, block, used, static_cast<const unsigned char*>(data), size);
+}
+
+void md5_context::finish(unsigned char digest[digest_size]) {
+  pad([this](const unsigned char* p, size_t n) { process(p, n); }, block, used, length, false);
+  for (int i = 0; i < 4; i++) store_le32(digest + 4 * i, state[i]);
+}
+
+std::string md5_context::hex_digest() {
+  unsigned char digest[digest_size];
+  finish(digest);
+  return to_hex(digest, digest_size);
+}
+
+sha1_context::sha1_context(): length(0), used(0) {
+  state[0] = 0x67452301; state[1] = 0xefcdab89; state[2] = 0x98badcfe; state[3] = 0x10325476; state[4] = 0xc3d2e1f0;
+}
+
+void sha1_context::process(const unsigned char* blocks, size_t count) {
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+  for (; count; --count, blocks += 64) {
+    // The schedule is kept as a rolling window of sixteen words.
+    uint32_t w[16];
+    for (int i = 0; i < 16; i++) w[i] = load_be32(blocks + 4 * i);
+    const uint32_t a0 = a, b0 = b, c0 = c, d0 = d, e0 = e;
+    // One loop per round function, five steps at a time so the registers
+    // rotate by renaming instead of by moves.
+#define SHA1_W(i) (i < 16 ? w[i] : (w[(i) & 15] = rotl(w[((i) + 13) & 15] ^ w[((i) + 8) & 15] ^ w[((i) + 2) & 15] ^ w[(i) & 15], 1)))
+#define SHA1_STEP(f, k, a, b, c, d, e, i) e += rotl(a, 5) + f(b, c, d) + k + SHA1_W(i); b = rotl(b, 30);
+#define SHA1_FIVE(f, k, i) \
+      SHA1_STEP(f, k, a, b, c, d, e, i) SHA1_STEP(f, k, e, a, b, c, d, i + 1) SHA1_STEP(f, k, d, e, a, b, c, i + 2) \
+      SHA1_STEP(f, k, c, d, e, a, b, i + 3) SHA1_STEP(f, k, b, c, d, e, a, i + 4)
+#define SHA1_CH(b, c, d) (d ^ (b & (c ^ d)))
+#define SHA1_PARITY(b, c, d) (b ^ c ^ d)
+#define SHA1_MAJ(b, c, d) ((b & c) | (d & (b | c)))
+    for (int i = 0; i < 20; i += 5) { SHA1_FIVE(SHA1_CH, 0x5a827999, i) }
+    for (int i = 20; i < 40; i += 5) { SHA1_FIVE(SHA1_PARITY, 0x6ed9eba1, i) }
+    for (int i = 40; i < 60; i += 5) { SHA1_FIVE(SHA1_MAJ, 0x8f1bbcdc, i) }
+    for (int i = 60; i < 80; i += 5) { SHA1_FIVE(SHA1_PARITY, 0xca62c1d6, i) }
+#undef SHA1_W
+#undef SHA1_STEP
+#undef SHA1_FIVE
+#undef SHA1_CH
+#undef SHA1_PARITY
+#undef SHA1_MAJ
+    a += a0, b += b0, c += c0, d += d0, e += e0;
+  }
+  state[0] = a, state[1] = b, state[2] = c, state[3] = d, state[4] = e;
+}
+
+void sha1_context::update(const void* data, size_t size) {
+  length += size;
+  stream([this](const unsigned char* p, size_t n) { process(p, n); }, block, used, static_cast<const unsigned char*>(data), size);
+}
+
+void sha1_context::finish(unsigned char digest[digest_size]) {
+  pad([this](const unsigned char* p, size_t n) { process(p, n); }, block, used, length, true);
+  for (int i = 0; i < 5; i++) store_be32(digest + 4 * i, state[i]);
+}
+
+std::string sha1_context::hex_digest() {
+  unsigned char digest[digest_size];
+  finish(digest);
+  return to_hex(digest, digest_size);
+}
+
+namespace {
+
+const char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Encoding looks up twelve bits, two characters, at a time. Decoding looks up
+// each character's six bits already shifted into place for its position in
+// the group, so a group is four loads and three ORs; anything outside the
+// alphabet sets bit 24, which survives the ORs and sends the group down the
+// careful path.
+struct base64_tables {
+  char pairs[4096][2];
+  uint32_t decode[4][256];
+  base64_tables() {
+    for (int i = 0; i < 4096; i++) pairs[i][0] = base64_alphabet[i >> 6], pairs[i][1] = base64_alphabet[i & 63];
+    for (int p = 0; p < 4; p++) {
+      for (int c = 0; c < 256; c++) decode[p][c] = 1u << 24;
+      for (int v = 0; v < 64; v++) decode[p][(unsigned char) base64_alphabet[v]] = uint32_t(v) << (18 - 6 * p);
+    }
+  }
+};
+
+const base64_tables& tables() {
+  static const base64_tables t;
+  return t;
+}
+
+}  // namespace
+
+void base64_encode(const unsigned char* data, size_t size, char* out) {
+  const base64_tables& t = tables();
+  size_t i = 0;
+  for (; i + 3 <= size; i += 3, out += 4) {
+    const uint32_t v = uint32_t(data[i]) << 16 | uint32_t(data[i + 1]) << 8 | data[i + 2];
+    memcpy(out, t.pairs[v >> 12], 2);
+    memcpy(out + 2, t.pairs[v & 4095], 2);
+  }
+  if (i < size) {
+    const uint32_t v = uint32_t(data[i]) << 16 | (i + 1 < size ? uint32_t(data[i + 1]) << 8 : 0);
+    memcpy(out, t.pairs[v >> 12], 2);
+    out[2] = i + 1 < size ? t.pairs[v & 4095][0] : '=';
+    out[3] = '=';
+  }
+}
+
+size_t base64_decode(const char* str, size_t size, unsigned char* out) {
+  const base64_tables& t = tables();
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(str);
+  unsigned char* const start = out;
+  size_t i = 0;
+  // Whole groups while they are clean; padding or a stray character drops
+  // through to the careful loop with the group it is in.
+  for (; i + 4 <= size; i += 4, out += 3) {
+    const uint32_t v = t.decode[0][in[i]] | t.decode[1][in[i + 1]] | t.decode[2][in[i + 2]] | t.decode[3][in[i + 3]];
+    if (v >> 24) break;
+    out[0] = v >> 16; out[1] = v >> 8; out[2] = v;
+  }
+  // The last, partial group: stop at its first non-alphabet character and
+  // keep every whole byte its characters spell.
+  uint32_t v = 0;
+  int n = 0;
+  for (; i < size && n < 4; i++, n++) {
+    const uint32_t d = t.decode[n][in[i]];
+    if (d >> 24) break;
+    v |= d;
+  }
+  for (int b = 0; b < n - 1; b++) *out++ = v >> (16 - 8 * b);
+  return out - start;
+}
+
+}  //namespace enigma
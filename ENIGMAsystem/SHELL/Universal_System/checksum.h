@@ -0,0 +1,77 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_CHECKSUM_H
+#define ENIGMA_CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace enigma {
+
+// Streaming MD5 and SHA-1. Feed the data in as many update() calls as is
+// convenient, straight from wherever it lives, then call finish() once.
+// Whole blocks are hashed in place; only a partial block is ever copied.
+class md5_context {
+ public:
+  static const unsigned digest_size = 16;
+  md5_context();
+  void update(const void* data, size_t size);
+  void finish(unsigned char digest[digest_size]);
+  // Lowercase hexadecimal, as GameMaker returns it.
+  std::string hex_digest();
+
+ private:
+  uint32_t state[4];
+  uint64_t length;
+  unsigned char block[64];
+  size_t used;
+  void process(const unsigned char* blocks, size_t count);
+};
+
+class sha1_context {
+ public:
+  static const unsigned digest_size = 20;
+  sha1_context();
+  void update(const void* data, size_t size);
+  void finish(unsigned char digest[digest_size]);
+  std::string hex_digest();
+
+ private:
+  uint32_t state[5];
+  uint64_t length;
+  unsigned char block[64];
+  size_t used;
+  void process(const unsigned char* blocks, size_t count);
+};
+
+// Base64 with the standard alphabet and '=' padding, shared by the string
+// and buffer functions.
+inline size_t base64_encoded_size(size_t size) { return (size + 2) / 3 * 4; }
+// Room needed to decode size characters, however they end.
+inline size_t base64_decoded_max(size_t size) { return size / 4 * 3 + 2; }
+
+// Writes base64_encoded_size(size) characters to out.
+void base64_encode(const unsigned char* data, size_t size, char* out);
+// Decodes str up to its end, its padding or the first character outside the
+// alphabet, whichever comes first, and returns the number of bytes written.
+size_t base64_decode(const char* str, size_t size, unsigned char* out);
+
+}  //namespace enigma
+
+#endif  //ENIGMA_CHECKSUM_H
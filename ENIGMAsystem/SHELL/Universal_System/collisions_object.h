@@ -38,6 +38,17 @@
 
 namespace enigma
 {
+  // Broad-phase bookkeeping kept on each instance by the collision system.
+  struct collision_grid_node
+  {
+    int left, top, right, bottom; // Range of cells this instance is binned in, inclusive
+    unsigned long seq;            // Order in which this instance was linked
+    unsigned stamp;               // Last query to visit this instance
+    unsigned char state;          // Unlinked, linked without a mask, binned in cells, or too large for cells
+    bool dirty;                   // Whether this instance is waiting to be rebinned
+    collision_grid_node(): left(0), top(0), right(-1), bottom(-1), seq(0), stamp(0), state(0), dirty(false) {}
+  };
+
   struct object_collisions: object_transform
   {
     //Bit Mask
@@ -58,6 +69,8 @@ namespace enigma
         #define bbox_right  $bbox_right()
         #define bbox_top    $bbox_top()
         #define bbox_bottom $bbox_bottom()
+
+        collision_grid_node $grid;
       #endif
     
     //Constructors
@@ -23,7 +23,7 @@
 
 namespace enigma {
 
-  static std::vector<std::string> scope_stack;
+  static thread_local std::vector<std::string> scope_stack; // Per thread, for parallel events
   
   debug_scope::debug_scope(std::string x) 
   { 
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include "var4.h"
 #include "estring.h"
+#include "checksum.h"
 
 #ifdef DEBUG_MODE
 #include "libEGMstd.h"
@@ -63,11 +64,6 @@ static const char ldgrs[256] = {
   1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0
 };
 
-static const std::string base64_chars = 
-             "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-             "abcdefghijklmnopqrstuvwxyz"
-             "0123456789+/";
-
 namespace enigma_user {
 
 bool is_base64(unsigned char c) {
@@ -75,88 +71,15 @@ bool is_base64(unsigned char c) {
 }
 
 string base64_encode(string const& str) {
-  size_t in_len = str.size();
-  string ret;
-  int i = 0;
-  int j = 0;
-  int in_ = 0;
-  unsigned char char_array_3[3];
-  unsigned char char_array_4[4];
-  
-  while (in_len--) {
-    char_array_3[i++] = str[in_]; in_++;
-    if (i == 3) {
-      char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-      char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-      char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-      char_array_4[3] = char_array_3[2] & 0x3f;
-
-      for(i = 0; (i <4) ; i++)
-        ret += base64_chars[char_array_4[i]];
-
-      i = 0;
-    }
-  }
-
-  if (i) {
-    for(j = i; j < 3; j++)
-      char_array_3[j] = '\0';
-
-    char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-    char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-    char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-    char_array_4[3] = char_array_3[2] & 0x3f;
-
-    for (j = 0; (j < i + 1); j++)
-      ret += base64_chars[char_array_4[j]];
-
-    while (i++ < 3)
-      ret += '=';
-  }
-
+  string ret(enigma::base64_encoded_size(str.size()), '=');
+  if (!str.empty())
+    enigma::base64_encode(reinterpret_cast<const unsigned char*>(str.data()), str.size(), &ret[0]);
   return ret;
-
 }
 
 string base64_decode(string const& str) {
-  size_t in_len = str.size();
-  int i = 0;
-  int j = 0;
-  int in_ = 0;
-  unsigned char char_array_4[4], char_array_3[3];
-  string ret;
-
-  while (in_len-- && ( str[in_] != '=') && is_base64(str[in_])) {
-    char_array_4[i++] = str[in_]; in_++;
-    if (i ==4) {
-      for (i = 0; i <4; i++)
-        char_array_4[i] = base64_chars.find(char_array_4[i]);
-
-      char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-      char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-      char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-      for (i = 0; (i < 3); i++)
-        ret += char_array_3[i];
-
-      i = 0;
-    }
-  }
-
-  if (i) {
-    for (j = i; j <4; j++)
-      char_array_4[j] = 0;
-
-    for (j = 0; j <4; j++)
-      char_array_4[j] = base64_chars.find(char_array_4[j]);
-
-    char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-    char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-    char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-    for (j = 0; (j < i - 1); j++) ret += char_array_3[j];
-  }
-
+  string ret(enigma::base64_decoded_max(str.size()), '\0');
+  ret.resize(enigma::base64_decode(str.data(), str.size(), reinterpret_cast<unsigned char*>(&ret[0])));
   return ret;
 }
 
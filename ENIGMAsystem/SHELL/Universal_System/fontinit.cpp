@@ -21,7 +21,7 @@
 #include "fonts_internal.h"
 #include "libEGMstd.h"
 #include "resinit.h"
-#include "zlib.h"
+#include "resource_pack.h"
 
 #include "Graphics_Systems/graphics_mandatory.h"
 #include "Platforms/platforms_mandatory.h"
@@ -32,15 +32,25 @@
 #include <string>
 
 namespace enigma {
-void exe_loadfonts(FILE* exe) {
-  int nullhere;
-  unsigned fontcount, fntid, twid, thgt, gwid, ghgt;
-  float advance, baseline, origin, gtx, gty, gtx2, gty2;
+namespace {
+// Reads fonts out of their pack entry, failing once it runs out of bytes.
+struct font_reader {
+  const unsigned char *pos, *end;
+  template<typename T> bool read(T &x) {
+    if (size_t(end - pos) < sizeof(T)) return false;
+    memcpy(&x, pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+  }
+};
+}  // namespace
 
-  if (!fread(&nullhere, 4, 1, exe)) return;
-  if (memcmp(&nullhere, "FNT ", sizeof(int)) != 0) return;
+void exe_loadfonts() {
+  unsigned twid, thgt, gwid, ghgt;
+  float advance, baseline, origin, gtx, gty, gtx2, gty2;
 
-  if (!fread(&fontcount, 4, 1, exe)) return;
+  size_t fontcount;
+  resource_pack::entries(resource_pack::kind_font, &fontcount);
   if ((int)fontcount != rawfontcount) {
     show_error("Resource data does not match up with game metrics. Unable to improvise.", 0);
     return;
@@ -49,11 +59,15 @@ void exe_loadfonts(FILE* exe) {
   fontstructarray = (new font*[rawfontmaxid + 2]) + 1;
 
   for (int rf = 0; rf < rawfontcount; rf++) {
-    // int unpacked;
-    if (!fread(&fntid, 4, 1, exe)) return;
-    if (!fread(&twid, 4, 1, exe)) return;
-    if (!fread(&thgt, 4, 1, exe)) return;
-    const int i = fntid;
+    const int i = rawfontdata[rf].id;
+    const resource_pack::toc_entry *e = resource_pack::find(resource_pack::kind_font, i);
+    if (!e) {
+      show_error("Resource data does not match up with game metrics. Unable to improvise.", 0);
+      return;
+    }
+    font_reader in = { resource_pack::data(*e), resource_pack::data(*e) + e->size };
+    if (!in.read(twid)) return;
+    if (!in.read(thgt)) return;
 
     fontstructarray[i] = new font;
 
@@ -68,57 +82,40 @@ void exe_loadfonts(FILE* exe) {
     fontstructarray[i]->glyphRangeCount = rawfontdata[rf].glyphRangeCount;
 
     const unsigned int size = twid * thgt;
-
-    int* pixels =
-        new int[size + 1];  //FYI: This variable was once called "cpixels." When you do compress them, change it back.
-
-    unsigned int sz2;
-    for (sz2 = 0; !feof(exe) and sz2 < size; sz2++) {
-      pixels[sz2] = 0x00FFFFFF | ((unsigned char)fgetc(exe) << 24);
-      if (pixels[sz2] == 0x00FFFFFF) pixels[sz2] = 0;
-    }
-
-    if (size != sz2) {
-      show_error("Failed to load font: Data is truncated before exe end. Read " + enigma_user::toString(sz2) +
+    if (size_t(in.end - in.pos) < size) {
+      show_error("Failed to load font: Data is truncated before exe end. Read " + enigma_user::toString(in.end - in.pos) +
                      " out of expected " + enigma_user::toString(size),
                  0);
       return;
     }
-    if (!fread(&nullhere, 4, 1, exe)) return;
-    if (memcmp(&nullhere, "done", sizeof(int)) != 0) {
-      printf("Unexpected end; eof:%s\n", feof(exe) ? "true" : "false");
-      return;
-    }
-    //unpacked = width*height*4;
-    /*unsigned char* pixels=new unsigned char[unpacked+1];
-    if (zlib_decompress(cpixels,size,unpacked,pixels) != unpacked)
-    {
-      show_error("Background load error: Background does not match expected size",0);
-      continue;
+
+    int* pixels = new int[size + 1];
+    for (unsigned int p = 0; p < size; p++) {
+      pixels[p] = 0x00FFFFFF | (*in.pos++ << 24);
+      if (pixels[p] == 0x00FFFFFF) pixels[p] = 0;
     }
-    delete[] cpixels;*/
+
     int ymin = 100, ymax = -100;
     for (size_t gri = 0; gri < enigma::fontstructarray[i]->glyphRangeCount; gri++) {
       fontglyphrange fgr;
 
-
       unsigned strt, cnt;
-      if (!fread(&strt, 4, 1, exe)) return;
-      if (!fread(&cnt, 4, 1, exe)) return;
+      if (!in.read(strt)) return;
+      if (!in.read(cnt)) return;
 
       fgr.glyphstart = strt;
       fgr.glyphcount = cnt;
 
       for (unsigned gi = 0; gi < fgr.glyphcount; gi++) {
-        if (!fread(&advance, 4, 1, exe)) return;
-        if (!fread(&baseline, 4, 1, exe)) return;
-        if (!fread(&origin, 4, 1, exe)) return;
-        if (!fread(&gwid, 4, 1, exe)) return;
-        if (!fread(&ghgt, 4, 1, exe)) return;
-        if (!fread(&gtx, 4, 1, exe)) return;
-        if (!fread(&gty, 4, 1, exe)) return;
-        if (!fread(&gtx2, 4, 1, exe)) return;
-        if (!fread(&gty2, 4, 1, exe)) return;
+        if (!in.read(advance)) return;
+        if (!in.read(baseline)) return;
+        if (!in.read(origin)) return;
+        if (!in.read(gwid)) return;
+        if (!in.read(ghgt)) return;
+        if (!in.read(gtx)) return;
+        if (!in.read(gty)) return;
+        if (!in.read(gtx2)) return;
+        if (!in.read(gty2)) return;
         fontglyph fg;
 
         fg.x = int(origin + .5);
@@ -135,8 +132,6 @@ void exe_loadfonts(FILE* exe) {
         if (fg.y2 > ymax) ymax = fg.y2;
 
         fgr.glyphs.push_back(fg);
-
-        //printf("fntid%d, twid%d, thgt%d, advance%f, baseline%f, origin%f, gwid%d, ghgt%d, gtx%f, gty%f, gtx2%f, gty2%f\n", fntid, twid, thgt, advance, baseline, origin, gwid, ghgt, gtx, gty, gtx2, gty2);
       }
 
       fontstructarray[i]->glyphRanges.push_back(std::move(fgr));
@@ -150,9 +145,6 @@ void exe_loadfonts(FILE* exe) {
     fontstructarray[i]->thgt = thgt;
 
     delete[] pixels;
-
-    if (!fread(&nullhere, 4, 1, exe)) return;
-    if (memcmp(&nullhere, "endf", sizeof(int)) != 0) return;
   }
 }
 }  //namespace enigma
@@ -73,7 +73,7 @@ namespace enigma
       // This algorithm will try to fit as many glyphs as possible into
       // a square space based on the max height of the font.
 
-      sprite *sspr = spritestructarray[spr];
+      sprite *sspr = sprite_get_resident(spr);
       unsigned char* glyphdata[gcount]; // Raw font image data
       std::vector<rect_packer::pvrect> glyphmetrics(gcount);
       int glyphx[gcount], glyphy[gcount];
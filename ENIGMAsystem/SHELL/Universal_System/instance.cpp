@@ -35,12 +35,14 @@
 
 #include "instance_system.h"
 #include "instance.h"
+#include "parallel_events.h"
 
 #include <stdio.h>
 
 namespace enigma
 {
   int destroycalls = 0, createcalls = 0;
+  extern size_t object_idmax;
 }
 
 typedef std::pair<int,enigma::object_basic*> inode_pair;
@@ -89,6 +91,10 @@ void instance_activate_object(int obj) {
 
 void instance_destroy(int id, bool dest_ev)
 {
+  if (enigma::parallel_phase) {
+    enigma::parallel_defer_destroy(id, dest_ev);
+    return;
+  }
   enigma::object_basic* who = enigma::fetch_instance_by_id(id);
   if (who and enigma::cleanups.find(who) == enigma::cleanups.end()) {
     if (dest_ev)
@@ -100,6 +106,10 @@ void instance_destroy(int id, bool dest_ev)
 
 void instance_destroy()
 {
+  if (enigma::parallel_phase) {
+    enigma::parallel_defer_destroy(enigma::instance_event_iterator->inst->id, true);
+    return;
+  }
   enigma::object_basic* const a = enigma::instance_event_iterator->inst;
   if (enigma::cleanups.find(a) == enigma::cleanups.end()) {
     enigma::instance_event_iterator->inst->myevent_destroy();
@@ -119,6 +129,30 @@ bool instance_exists(int obj)
 
 enigma::instance_t instance_find(int obj, int num)
 {
+  if (obj == all || (obj >= 0 && obj < 100000)) {
+    // Loops over instance_find(obj, 0), instance_find(obj, 1), ... are common,
+    // so carry on from where the last call stopped while the lists are unchanged.
+    static thread_local int cached_obj = noone, cached_num = 0;
+    static thread_local enigma::inst_iter* cached_node = NULL;
+    static thread_local unsigned long cached_epoch = 0;
+
+    enigma::inst_iter* node;
+    int nth;
+    if (cached_node && obj == cached_obj && num >= cached_num && cached_epoch == enigma::instance_list_epoch) {
+      node = cached_node, nth = cached_num;
+    } else {
+      if (obj != all && size_t(obj) >= enigma::object_idmax) return noone;
+      node = obj == all ? enigma::instance_list.first() : enigma::objects[obj].next, nth = 0;
+    }
+    for (; node && nth < num; ++nth)
+      node = node->next;
+    if (!node) return noone;
+
+    cached_obj = obj, cached_num = nth, cached_node = node;
+    cached_epoch = enigma::instance_list_epoch;
+    return (int) node->inst->id;
+  }
+
   int nth=0;
   for (enigma::iterator it = enigma::fetch_inst_iter_by_int(obj); it; ++it)
   {
@@ -18,6 +18,8 @@
 #ifndef ENIGMA_INSTANCE_CREATE_H
 #define ENIGMA_INSTANCE_CREATE_H
 
+#include "Universal_System/parallel_events.h"
+
 namespace enigma
 {
   void instance_change_inst(int obj, bool perf, object_graphics* inst)
@@ -90,7 +92,9 @@ namespace enigma_user
 {
   enigma::instance_t instance_create(int x,int y,int object)
   {
-      int idn = enigma::maxid++;
+    if (enigma::parallel_phase)
+      return enigma::parallel_defer_create(x, y, object);
+    int idn = enigma::maxid++;
     enigma::object_basic* ob;
       switch((int)object)
       {
@@ -109,12 +113,24 @@ namespace enigma_user
   inline void action_change_object(int obj, bool perf) {instance_change(obj,perf);}
 
   void instance_change(int obj, bool perf) {
+      if (enigma::parallel_phase) { // Can't be deferred; see parallel_events.h
+        #ifdef DEBUG_MODE
+        show_error("instance_change can't be called from a parallel step event", false);
+        #endif
+        return;
+      }
       enigma::object_graphics* inst = (enigma::object_graphics*) enigma::instance_event_iterator->inst;
       enigma::instance_change_inst(obj, perf, inst);
   }
   
   void instance_copy(bool perf)
   {
+    if (enigma::parallel_phase) { // Can't be deferred; see parallel_events.h
+      #ifdef DEBUG_MODE
+      show_error("instance_copy can't be called from a parallel step event", false);
+      #endif
+      return;
+    }
     enigma::object_graphics* inst = (enigma::object_graphics*) enigma::instance_event_iterator->inst;
     int idn = enigma::maxid++;
 
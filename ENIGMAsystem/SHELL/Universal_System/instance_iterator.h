@@ -28,8 +28,15 @@ class iterator {
   enigma::inst_iter temp_iter;
   enigma::inst_iter* it;
 
+  // Every live iterator is on an intrusive list, so that unlinking an
+  // instance can fix up iterators pointing at it without any allocation.
+  iterator* reg_prev;
+  iterator* reg_next;
+
   void addme();
+  void delme();
   void copy(const iterator& other);
+  friend void update_iterators_for_destroy(const inst_iter*);
 
  public:
   operator bool();
@@ -60,6 +67,10 @@ class iterator {
 class iterator::with : iterator, iterator_level {
  public:
   with(const iterator& push) : iterator(push), iterator_level(it) {}
+  // Steps to the next instance of the loop. The instance left behind, like the
+  // one current when the loop is left, is reported as possibly moved.
+  inst_iter* advance();
+  ~with();
 };
 
 void update_iterators_for_destroy(const inst_iter*);
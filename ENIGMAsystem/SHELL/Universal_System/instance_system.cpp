@@ -29,6 +29,7 @@
 
 #include "instance_system.h"
 #include "instance_system_frontend.h"
+#include "Collision_Systems/collision_mandatory.h"
 
 using namespace std;
 
@@ -42,6 +43,39 @@ namespace enigma
   inst_iter::inst_iter(object_basic* i,inst_iter *n = NULL,inst_iter *p = NULL):
       inst(i), next(n), prev(p) {}
   inst_iter::inst_iter() {}
+
+  // Nodes are handed out from blocks of this many, and freed nodes are kept on
+  // a free list for reuse. Blocks are never returned to the system.
+  static const size_t inst_iter_block_size = 1024;
+  union pooled_inst_iter {
+    pooled_inst_iter* next_free;
+    char storage[sizeof(inst_iter)];
+  };
+  static pooled_inst_iter* free_inst_iters = NULL;
+
+  void* inst_iter::operator new(size_t size) {
+    if (size != sizeof(inst_iter))
+      return ::operator new(size);
+    if (!free_inst_iters) {
+      pooled_inst_iter* const block = (pooled_inst_iter*) ::operator new(sizeof(pooled_inst_iter) * inst_iter_block_size);
+      for (size_t i = 0; i < inst_iter_block_size - 1; ++i)
+        block[i].next_free = block + i + 1;
+      block[inst_iter_block_size - 1].next_free = NULL;
+      free_inst_iters = block;
+    }
+    pooled_inst_iter* const node = free_inst_iters;
+    free_inst_iters = node->next_free;
+    return node;
+  }
+  void inst_iter::operator delete(void* node, size_t size) {
+    if (!node) return;
+    if (size != sizeof(inst_iter)) {
+      ::operator delete(node);
+      return;
+    }
+    ((pooled_inst_iter*) node)->next_free = free_inst_iters;
+    free_inst_iters = (pooled_inst_iter*) node;
+  }
   
   objectid_base::objectid_base(): inst_iter(NULL,NULL,this), count(0) {}
   event_iter::event_iter(string n): inst_iter(NULL,NULL,this), name(n) {}
@@ -51,14 +85,25 @@ namespace enigma
   /*------ New iterator system -----------------------------------------------*\
   \*--------------------------------------------------------------------------*/
 
-  set<iterator*> central_iterator_cache;
-  typedef set<iterator*>::iterator central_iterator_cache_iterator;
+  // Head of the intrusive list of live iterators. Iterators mostly live on
+  // the stack and die in reverse order, so they are pushed at the front.
+  // Each thread has its own; instances are only destroyed on the main one.
+  static thread_local iterator* central_iterator_list = NULL;
 
   object_basic* iterator::operator*()  const { return it->inst; }
   object_basic* iterator::operator->() const { return it->inst; }
 
   void iterator::addme() {
-    central_iterator_cache.insert(this);
+    reg_prev = NULL;
+    reg_next = central_iterator_list;
+    if (reg_next) reg_next->reg_prev = this;
+    central_iterator_list = this;
+  }
+
+  void iterator::delme() {
+    if (reg_prev) reg_prev->reg_next = reg_next;
+    else central_iterator_list = reg_next;
+    if (reg_next) reg_next->reg_prev = reg_prev;
   }
   
   void iterator::copy(const iterator& other) {
@@ -120,7 +165,7 @@ namespace enigma
     return *this;
   }
   
-  // Always add ourself to the central iterator cache, because future
+  // Always add ourself to the central iterator list, because future
   // assignment could cause us to point to something deleteable
   iterator::iterator(): it(NULL) {
     addme();
@@ -138,14 +183,22 @@ namespace enigma
   }
 
   iterator:: ~iterator() {
-    central_iterator_cache.erase(this);
+    delme();
+  }
+
+  inst_iter* iterator::with::advance() {
+    collision_grid_touch(instance_event_iterator->inst);
+    return instance_event_iterator->next;
+  }
+  iterator::with::~with() {
+    if (instance_event_iterator && instance_event_iterator->inst)
+      collision_grid_touch(instance_event_iterator->inst);
   }
 
   void update_iterators_for_destroy(const inst_iter* dd)
   {
-    for (central_iterator_cache_iterator it = central_iterator_cache.begin();
-         it != central_iterator_cache.end(); ++it) {
-      (*it)->handle_unlink(dd);
+    for (iterator* it = central_iterator_list; it; it = it->reg_next) {
+      it->handle_unlink(dd);
     }
   }
 
@@ -185,6 +238,7 @@ namespace enigma
     objectid_base *a = objects + oid;
     if (a->prev == which) a->prev = which->prev;
     a->count--;
+    ++instance_list_epoch;
     update_iterators_for_destroy(which);
   }
 
@@ -196,10 +250,75 @@ namespace enigma
   objectid_base *objects;
 
   // This is the all-inclusive, centralized list of instances.
-  map<int,inst_iter*> instance_list;
+  instance_registry instance_list;
   map<int,object_basic*> instance_deactivated_list;
-  typedef map<int,inst_iter*>::iterator iliter;
-  typedef pair<int,inst_iter*> inode_pair;
+  unsigned long instance_list_epoch = 0;
+
+  instance_registry::~instance_registry() {
+    for (size_t i = 0; i < pages.size(); ++i)
+      delete pages[i];
+  }
+
+  // Finds the node with the greatest id below the given one.
+  inst_iter* instance_registry::find_before(unsigned id) const {
+    // Ids are mostly handed out in increasing order, so this is usually the tail.
+    if (!tail || tail->inst->id < id)
+      return tail;
+    unsigned p = id >> page_shift;
+    int s = int(id & page_mask) - 1;
+    for (;;) {
+      if (p < pages.size() && pages[p]) {
+        for (; s >= 0; --s)
+          if (pages[p]->slots[s]) return pages[p]->slots[s];
+      }
+      if (p == 0) return NULL;
+      --p, s = page_mask;
+    }
+  }
+
+  bool instance_registry::insert(inst_iter* node) {
+    const unsigned id = node->inst->id;
+    const unsigned p = id >> page_shift;
+    if (p >= pages.size())
+      pages.resize(p + 1, NULL);
+    if (!pages[p])
+      pages[p] = new page();
+    inst_iter* &slot = pages[p]->slots[id & page_mask];
+    if (slot)
+      return false;
+
+    inst_iter* const before = find_before(id);
+    slot = node;
+    pages[p]->used++;
+    count++;
+
+    node->prev = before;
+    node->next = before ? before->next : head;
+    if (node->next) node->next->prev = node;
+    else tail = node;
+    if (before) before->next = node;
+    else head = node;
+    return true;
+  }
+
+  void instance_registry::erase(inst_iter* node) {
+    const unsigned id = node->inst->id;
+    const unsigned p = id >> page_shift;
+    if (p >= pages.size() || !pages[p] || pages[p]->slots[id & page_mask] != node)
+      return; // Never made it in; its id was taken.
+    pages[p]->slots[id & page_mask] = NULL;
+    if (--pages[p]->used == 0) {
+      delete pages[p];
+      pages[p] = NULL;
+    }
+    count--;
+
+    // The node keeps its own links, so iterators standing on it can move on.
+    if (node->prev) node->prev->next = node->next;
+    else head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else tail = node->prev;
+  }
 
 
 
@@ -213,8 +332,8 @@ namespace enigma
 
   // It's a good idea to centralize an event iterator so error reporting can tell where it is.
   static inst_iter dummy_event_iterator(NULL,NULL,NULL); // For create events and such
-  inst_iter *instance_event_iterator = &dummy_event_iterator; // Not bad for efficiency, either.
-  object_basic *instance_other = NULL;
+  thread_local inst_iter *instance_event_iterator = &dummy_event_iterator; // Not bad for efficiency, either.
+  thread_local object_basic *instance_other = NULL;
 
   temp_event_scope::temp_event_scope(object_basic* ninst)
       : oiter(instance_event_iterator),
@@ -232,12 +351,11 @@ namespace enigma
   // Retrieve the first instance on the complete list.
   iterator instance_list_first()
   {
-    iliter a = instance_list.begin();
-    return a != instance_list.end() ? a->second : NULL;
+    return instance_list.first();
   }
 
   extern size_t object_idmax;
-  object_basic* fetch_instance_by_int(int x)
+  static object_basic* lookup_instance_by_int(int x)
   {
     using namespace enigma_user;
 
@@ -256,13 +374,20 @@ namespace enigma
     if (x < 100000)
       return x < object_idmax ? objects[x].next ? objects[x].next->inst : NULL : NULL;
 
-    iliter a = instance_list.find(x);
-    return a != instance_list.end() ? a->second->inst : NULL;
+    inst_iter* a = instance_list.find(x);
+    return a ? a->inst : NULL;
+  }
+  object_basic* fetch_instance_by_int(int x)
+  {
+    object_basic* inst = lookup_instance_by_int(x);
+    // Whoever asked for this instance may be about to move it.
+    if (inst) collision_grid_touch(inst);
+    return inst;
   }
   object_basic* fetch_instance_by_id(int x)
   {
-    iliter a = instance_list.find(x);
-    return a != instance_list.end() ? a->second->inst : NULL;
+    inst_iter* a = instance_list.find(x);
+    return a ? a->inst : NULL;
   }
 
   iterator fetch_inst_iter_by_int(int x)
@@ -284,16 +409,16 @@ namespace enigma
       return objects[x].next;
 
     // ID-based lookup
-    iliter a = instance_list.find(x);
-    return a != instance_list.end() ? iterator(a->second->inst) : iterator();
+    inst_iter* a = instance_list.find(x);
+    return a ? iterator(a->inst) : iterator();
   }
   iterator fetch_inst_iter_by_id(int x)
   {
     if (x < 100000)
       return iterator();
 
-    iliter a = instance_list.find(x);
-    return a != instance_list.end() ? iterator(a->second->inst) : iterator();
+    inst_iter* a = instance_list.find(x);
+    return a ? iterator(a->inst) : iterator();
   }
 
   iterator fetch_roominst_iter_by_id(int x)
@@ -312,11 +437,6 @@ namespace enigma
   }
 
   // Implementation for frontend
-  // (Wrapper struct to lower compile time)
-  typedef struct winstance_list_iterator {
-    instance_list_iterator w;
-    winstance_list_iterator(instance_list_iterator n): w(n) {}
-  } *pinstance_list_iterator;
   void winstance_list_iterator_delete(pinstance_list_iterator whop) {
     delete whop;
   }
@@ -326,31 +446,16 @@ namespace enigma
   {
     inst_iter *ins = new inst_iter(who);
     enigma_user::instance_id.push_back(who->id);
-    pair<iliter,bool> it = instance_list.insert(inode_pair(who->id,ins));
-    if (!it.second) {
-      delete ins;
-      return new winstance_list_iterator(it.first);
-    }
-    if (it.first != instance_list.begin())
-    {
-      iliter ib = it.first; ib--; // Find the previous iterator
-      ins->prev = ib->second; // Link this to previous instance
-      ib->second->next = ins; // Link previous instance to this
-    }
-    else ins->prev = NULL; // Found nothing.
-
-    iliter in = it.first; in++; // Find next iterator
-    if (in != instance_list.end())
-    {
-      ins->next = in->second, // Link this to next instance
-      in->second->prev = ins; // Link next to this
-    }
-    else ins->next = NULL;
-    return new winstance_list_iterator(it.first);
+    // If the id is taken, the node is left out of the list; unlinking it is a no-op.
+    if (instance_list.insert(ins))
+      collision_grid_link(who);
+    ++instance_list_epoch;
+    return ins;
   }
   inst_iter *link_obj_instance(object_basic* who, int oid)
   {
     objects[oid].count++;
+    ++instance_list_epoch;
     return objects[oid].add_inst(who);
   }
 
@@ -362,24 +467,16 @@ namespace enigma
   }
   void dispose_destroyed_instances()
   {
+    collision_grid_purge();
     for (set<object_basic*>::iterator i = cleanups.begin(); i != cleanups.end(); i++)
       delete (*i);
     cleanups.clear();
   }
-  void unlink_main(instance_list_iterator who)
-  {
-    inst_iter *a = who->second;
-    if (a->prev) a->prev->next = a->next;
-    if (a->next) a->next->prev = a->prev;
-    instance_list.erase(who);
-    update_iterators_for_destroy(a);
-  }
-  void unlink_main(pinstance_list_iterator whop)
+  void unlink_main(pinstance_list_iterator a)
   {
-    inst_iter *a = whop->w->second;
-    if (a->prev) a->prev->next = a->next;
-    if (a->next) a->next->prev = a->prev;
-    instance_list.erase(whop->w);
+    instance_list.erase(a);
+    ++instance_list_epoch;
     update_iterators_for_destroy(a);
+    collision_grid_unlink(a->inst);
   }
 }
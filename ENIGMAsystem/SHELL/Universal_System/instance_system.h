@@ -29,14 +29,53 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace enigma {
 
-typedef std::map<int, inst_iter*>::iterator instance_list_iterator;
-extern std::map<int, inst_iter*> instance_list;
+// The list of all active instances, indexed directly by id. Ids are handed
+// out in increasing order and never reused, so the id itself tells a live
+// instance from a stale reference; no generation count is needed.
+// The nodes are also chained in order of id for walking the whole list.
+class instance_registry {
+ public:
+  inst_iter* find(int id) const {
+    const unsigned p = unsigned(id) >> page_shift;
+    return p < pages.size() && pages[p] ? pages[p]->slots[unsigned(id) & page_mask] : NULL;
+  }
+  inst_iter* first() const { return head; }
+  size_t size() const { return count; }
+
+  // Links the node into the chain by its instance's id. Returns false, leaving
+  // the node alone, if that id is already taken.
+  bool insert(inst_iter* node);
+  // Unlinks the node from the chain and frees its slot.
+  void erase(inst_iter* node);
+
+  instance_registry(): head(NULL), tail(NULL), count(0) {}
+  ~instance_registry();
+
+ private:
+  enum { page_shift = 10, page_size = 1 << page_shift, page_mask = page_size - 1 };
+  struct page {
+    inst_iter* slots[page_size];
+    unsigned used;
+  };
+
+  std::vector<page*> pages;
+  inst_iter *head, *tail;
+  size_t count;
+
+  inst_iter* find_before(unsigned id) const;
+};
+
+extern instance_registry instance_list;
 extern std::map<int, object_basic*> instance_deactivated_list;
 extern std::set<object_basic*> cleanups;
-void unlink_main(instance_list_iterator who);
+
+// Bumped whenever any instance joins or leaves a list, so that cached
+// positions within the lists can tell they have gone stale.
+extern unsigned long instance_list_epoch;
 
 }  //namespace enigma
 
@@ -34,6 +34,11 @@ namespace enigma
     //std::deque<inst_iter*>::iterator instance_id_index;
     inst_iter(object_basic* i,inst_iter *n,inst_iter *p);
     inst_iter();
+
+    // Nodes are carved from a shared pool, since one is made for every list
+    // an instance joins. Derived types fall back to the global allocator.
+    static void* operator new(size_t size);
+    static void operator delete(void* node, size_t size);
   };
 
   class temp_event_scope
@@ -75,8 +80,9 @@ namespace enigma
   extern event_iter *events;
   extern objectid_base *objects;
   extern object_basic *ENIGMA_global_instance;
-  extern inst_iter *instance_event_iterator;
-  extern object_basic *instance_other;
+  // Per thread, so that events run on the thread pool each see their own.
+  extern thread_local inst_iter *instance_event_iterator;
+  extern thread_local object_basic *instance_other;
 
   // Stack pusher for iterators in use by with() statements and the like.
   struct iterator_level {
@@ -33,8 +33,8 @@
 namespace enigma
 {
   
-// This is an iterator typedef for use with the red-black backbone of the instance list.
-typedef struct winstance_list_iterator *pinstance_list_iterator;
+// Each instance's node in the id-indexed list of all instances.
+typedef inst_iter *pinstance_list_iterator;
 void winstance_list_iterator_delete(pinstance_list_iterator);
 
 // Linking
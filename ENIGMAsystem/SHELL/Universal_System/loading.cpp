@@ -17,6 +17,7 @@
 **/
 
 #include "resinit.h"
+#include "resource_pack.h"
 #include "sprites_internal.h"
 #include "background_internal.h"
 #include "roomsystem.h"
@@ -25,6 +26,7 @@
 //#include "mathnc.h"
 
 #include "Platforms/platforms_mandatory.h"
+#include "Platforms/General/PFmain.h"
 #include "Audio_Systems/audio_mandatory.h"
 #include "Widget_Systems/widgets_mandatory.h"
 #include "Graphics_Systems/graphics_mandatory.h"
@@ -48,7 +50,7 @@ namespace enigma
   //This is like main(), only cross-api
   int initialize_everything()
   {
-    time_t ss = time(0);
+    time_t ss = headless_steps > 0 ? headless_seed : time(0);
     enigma_user::random_set_seed(ss);
     enigma_user::mtrandom_seed(ss);
 
@@ -69,43 +71,19 @@ namespace enigma
     backgrounds_init();
     widget_system_initialize();
 
-    // Open the exe for resource load
+    // Map the exe for resource load
     char exename[1025];
     windowsystem_write_exename(exename);
-    FILE* exe = fopen(exename,"rb");
-    if (!exe)
-      show_error("Resource load fail: exe unopenable",0);
-    else do
+    if (resource_pack::open(exename))
     {
-      int nullhere;
-      // Read the magic number so we know we're looking at our own data
-      fseek(exe,-8,SEEK_END);
-      char str_quad[4];
-      if (!fread(str_quad,4,1,exe) or str_quad[0] != 'r' or str_quad[1] != 'e' or str_quad[2] != 's' or str_quad[3] != '0') {
-        printf("No resource data in exe\n");
-        break;
-      }
-
-      // Get where our resources are located in the module
-      int pos;
-      if (!fread(&pos,4,1,exe)) break;
-
-      // Go to the start of the resource data
-      fseek(exe,pos,SEEK_SET);
-      if (!fread(&nullhere,4,1,exe)) break;
-      if(nullhere) break;
-
-      enigma::exe_loadsprs(exe);
-      enigma::exe_loadsounds(exe);
-      enigma::exe_loadbackgrounds(exe);
-      enigma::exe_loadfonts(exe);
+      enigma::exe_loadsprs();
+      enigma::exe_loadsounds();
+      enigma::exe_loadbackgrounds();
+      enigma::exe_loadfonts();
     #ifdef PATH_EXT_SET
-    enigma::exe_loadpaths(exe);
+    enigma::exe_loadpaths();
     #endif
-
-      fclose(exe);
     }
-    while (false);
 
     //Load object struct
     enigma::objectdata_load();
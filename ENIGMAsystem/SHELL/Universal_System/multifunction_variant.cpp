@@ -84,16 +84,18 @@ template<>           inline bool varzero(double x) { return codebloxt(x >= 0 &&
 
 namespace enigma
 {
-  multifunction_variant& multifunction_variant::operator=(multifunction_variant& x) { variant oldvalue = *this; if ((type = x.type) == 1) sval = x.sval; else rval.d = x.rval.d; function(oldvalue); return *this; }
+  // These back numeric built-ins whose hooks work on rval.d directly, so they
+  // never take on a string: string assignments leave the value as it was.
+  multifunction_variant& multifunction_variant::operator=(multifunction_variant& x) { variant oldvalue = *this; rval = x.rval; type = x.type; function(oldvalue); return *this; }
   types_extrapolate_real_p  (multifunction_variant& multifunction_variant::operator=, { variant oldvalue = *this; rval.d = x; type = real; function(oldvalue); return *this; } )\
-  types_extrapolate_string_p(multifunction_variant& multifunction_variant::operator=, { variant oldvalue = *this; sval = x;   type = real; function(oldvalue); return *this; } )\
-  multifunction_variant& multifunction_variant::operator= (const variant &x)          { variant oldvalue = *this; if ((type = x.type) == 1) sval = x.sval; else rval.d = x.rval.d; function(oldvalue); return *this; }\
-  multifunction_variant& multifunction_variant::operator= (const var &x)              { variant oldvalue = *this; if ((type = (*x).type) == 1) sval = (*x).sval; else rval.d = (*x).rval.d; function(oldvalue); return *this; }
+  types_extrapolate_string_p(multifunction_variant& multifunction_variant::operator=, { variant oldvalue = *this; terrortrue(); function(oldvalue); return *this; } )\
+  multifunction_variant& multifunction_variant::operator= (const variant &x)          { variant oldvalue = *this; if (x.type != tstr) rval = x.rval, type = x.type; function(oldvalue); return *this; }\
+  multifunction_variant& multifunction_variant::operator= (const var &x)              { variant oldvalue = *this; if ((*x).type != tstr) rval = (*x).rval, type = (*x).type; function(oldvalue); return *this; }
   
   types_extrapolate_real_p  (multifunction_variant& multifunction_variant::operator+=, { variant oldvalue = *this; terror(real); rval.d += x;  function(oldvalue); return *this; } )\
-  types_extrapolate_string_p(multifunction_variant& multifunction_variant::operator+=, { variant oldvalue = *this; terror(tstr); sval += x;    function(oldvalue); return *this; } )\
-  multifunction_variant& multifunction_variant::operator+= (const variant &x)          { variant oldvalue = *this; terror(1); if (type == 1) sval += x.sval; else rval.d += x.rval.d; function(oldvalue); return *this; }\
-  multifunction_variant& multifunction_variant::operator+= (const var &x)              { variant oldvalue = *this; if (type == 1) sval += (*x).sval; else rval.d += (*x).rval.d;  function(oldvalue); return *this; }
+  types_extrapolate_string_p(multifunction_variant& multifunction_variant::operator+=, { variant oldvalue = *this; terrortrue(); function(oldvalue); return *this; } )\
+  multifunction_variant& multifunction_variant::operator+= (const variant &x)          { variant oldvalue = *this; terror(x.type); if (x.type != tstr) rval.d += x.rval.d; function(oldvalue); return *this; }\
+  multifunction_variant& multifunction_variant::operator+= (const var &x)              { variant oldvalue = *this; if ((*x).type != tstr) rval.d += (*x).rval.d;  function(oldvalue); return *this; }
   
   types_extrapolate_alldec_i(-=, variant oldvalue = *this, function(oldvalue); )
   types_extrapolate_alldec_i(*=, variant oldvalue = *this, function(oldvalue); )
@@ -119,7 +121,7 @@ namespace enigma
   
   multifunction_variant::multifunction_variant(): variant(0) {}
   types_extrapolate_real_p  (multifunction_variant::multifunction_variant,: variant(x) {})
-  types_extrapolate_string_p(multifunction_variant::multifunction_variant,: variant(x) {})
+  types_extrapolate_string_p(multifunction_variant::multifunction_variant,: variant(0) {})
   multifunction_variant::multifunction_variant(const variant &x): variant(x) {}
   multifunction_variant::multifunction_variant(const var &x): variant(x) {}
   
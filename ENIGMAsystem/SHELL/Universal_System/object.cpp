@@ -41,9 +41,9 @@ namespace enigma
 
     #ifdef DEBUG_MODE
       static inline int DEBUG_ID_CHECK(int id, int objind) {
-        std::map<int, inst_iter*>::iterator it = instance_list.find(id);
-        if (it != instance_list.end()) {
-          show_error("Two instances were given the same ID! Object `" + enigma_user::object_get_name(it->second->inst->object_index)
+        inst_iter* it = instance_list.find(id);
+        if (it) {
+          show_error("Two instances were given the same ID! Object `" + enigma_user::object_get_name(it->inst->object_index)
                      + "' and new object `" + enigma_user::object_get_name(objind)
                      + "' both have ID " + toString(id)
                      + "': A new ID has been assigned so the game can continue, but references by this ID may fail."
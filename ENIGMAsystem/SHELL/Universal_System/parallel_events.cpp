@@ -0,0 +1,131 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "parallel_events.h"
+#include "collisions_object.h"
+#include "instance.h"
+#include "resource_residency.h"
+#include "roomsystem.h"
+#include "sprites_internal.h"
+
+#include "Collision_Systems/collision_mandatory.h"
+#include "Platforms/General/PFthreads.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace enigma
+{
+  bool parallel_phase = false;
+
+  namespace {
+    // Work an instance queued, tagged with the instance's place in the phase.
+    struct deferred_op {
+      size_t order;
+      bool create, dest_ev;
+      int x, y, object, id;
+      bool operator<(const deferred_op& other) const { return order < other.order; }
+    };
+
+    struct parallel_job {
+      std::vector<inst_iter*> nodes;
+      parallel_handler handler;
+      std::vector<std::vector<deferred_op> > queues; // One per worker
+    };
+
+    parallel_job job;
+    thread_local std::vector<deferred_op>* worker_queue = NULL;
+    thread_local size_t worker_order = 0;
+
+    void run_slice(void* data, size_t begin, size_t end, unsigned worker) {
+      parallel_job* const pj = (parallel_job*) data;
+      worker_queue = &pj->queues[worker];
+      for (size_t i = begin; i < end; ++i) {
+        worker_order = i;
+        instance_event_iterator = pj->nodes[i];
+        pj->handler(pj->nodes[i]->inst);
+      }
+    }
+
+    // Sprites are only unpacked on the main thread, where their textures can
+    // be made, so every mask an event might test against is loaded here and
+    // marked used for this frame.
+    void load_collision_sprites() {
+      std::vector<sprite*> sprs;
+      for (iterator it = instance_list_first(); it; ++it) {
+        const object_collisions* const inst = (object_collisions*) *it;
+        const int id = inst->mask_index != -1 ? inst->mask_index : inst->sprite_index;
+        if (id < 0 || size_t(id) >= sprite_idmax || !spritestructarray[id]) continue;
+        sprite* const spr = spritestructarray[id];
+        if (!spr->resident) sprs.push_back(spr);
+        spr->last_used = residency_frame;
+      }
+      sprites_load_subimages(sprs.data(), sprs.size());
+    }
+  }
+
+  inst_iter* parallel_event_run(inst_iter* first, int object, parallel_handler handler)
+  {
+    job.nodes.clear();
+    for (inst_iter* it = first; it && it->inst->object_index == object; it = it->next)
+      job.nodes.push_back(it);
+
+    load_collision_sprites();
+    job.handler = handler;
+    job.queues.resize(enigma_user::thread_pool_get_size());
+    parallel_phase = true;
+    thread_pool_run(job.nodes.size(), run_slice, &job);
+    parallel_phase = false;
+
+    // Any of them may have moved.
+    for (size_t i = 0; i < job.nodes.size(); ++i)
+      collision_grid_touch(job.nodes[i]->inst);
+
+    // Each instance ran on exactly one worker, so merging the queues by
+    // instance keeps every instance's own requests in the order it made them.
+    std::vector<deferred_op> ops;
+    for (size_t w = 0; w < job.queues.size(); ++w) {
+      ops.insert(ops.end(), job.queues[w].begin(), job.queues[w].end());
+      job.queues[w].clear();
+    }
+    std::stable_sort(ops.begin(), ops.end());
+    for (size_t i = 0; i < ops.size(); ++i) {
+      const deferred_op &op = ops[i];
+      instance_event_iterator = job.nodes[op.order];
+      if (op.create) {
+        enigma_user::instance_create(op.x, op.y, op.object);
+      } else {
+        enigma_user::instance_destroy(op.id, op.dest_ev);
+      }
+      if (room_switching_id != -1) break;
+    }
+    return job.nodes.back()->next;
+  }
+
+  int parallel_defer_create(int x, int y, int object)
+  {
+    deferred_op op = { worker_order, true, false, x, y, object, 0 };
+    worker_queue->push_back(op);
+    return enigma_user::noone;
+  }
+
+  void parallel_defer_destroy(int id, bool dest_ev)
+  {
+    deferred_op op = { worker_order, false, dest_ev, 0, 0, 0, id };
+    worker_queue->push_back(op);
+  }
+}
@@ -0,0 +1,53 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_PARALLEL_EVENTS_H
+#define ENIGMA_PARALLEL_EVENTS_H
+
+#include "Universal_System/instance_system_base.h"
+
+// Objects the game lists as parallel have their step events run on the thread
+// pool, at the object's usual place among the step events. Such events may
+// write only their own instance's variables; the compiler refuses any that
+// write globals, other instances or data structures. Instance creation and
+// destruction, and the collision system's bookkeeping, are queued while the
+// pool runs and applied in instance order once every worker is done.
+// instance_create returns noone during the phase, since the new instance has
+// no id yet. instance_change and instance_copy can't be queued; they do
+// nothing, and say so in debug mode.
+
+namespace enigma
+{
+  // Set while a parallel phase is running; shared engine state is left alone.
+  extern bool parallel_phase;
+
+  typedef void (*parallel_handler)(object_basic* inst);
+
+  // Runs the handler for the run of the object's instances that starts at first,
+  // then applies what they queued, stopping if that switches rooms. Returns the
+  // node after the run.
+  inst_iter* parallel_event_run(inst_iter* first, int object, parallel_handler handler);
+
+  // Stand-ins for instance_create and instance_destroy during a parallel phase.
+  // The new instance's id is only given out when it is created, in instance
+  // order, so the same ids come out whatever the thread count; until then it
+  // has none, and the create returns noone.
+  int parallel_defer_create(int x, int y, int object);
+  void parallel_defer_destroy(int id, bool dest_ev);
+}
+
+#endif //ENIGMA_PARALLEL_EVENTS_H
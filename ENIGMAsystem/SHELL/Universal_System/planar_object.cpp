@@ -32,6 +32,7 @@
 #include "reflexive_types.h"
 
 #include "planar_object.h"
+#include "Collision_Systems/collision_mandatory.h"
 
 #ifdef PATH_EXT_SET
 #  include "Universal_System/Extensions/Paths/path_functions.h"
@@ -73,7 +74,19 @@ namespace enigma
   //This just needs implemented virtually so instance_destroy works.
   object_planar::~object_planar() {}
 
+  static void propagate_motion(object_planar* instance);
+
+  // Motion here moves instances outside any event, so the collision grid is
+  // told about it here too.
   void propagate_locals(object_planar* instance)
+  {
+    const cs_scalar x_before = instance->x, y_before = instance->y;
+    propagate_motion(instance);
+    if (instance->x != x_before || instance->y != y_before)
+      collision_grid_touch(instance);
+  }
+
+  static void propagate_motion(object_planar* instance)
   {
     #ifdef PATH_EXT_SET // TODO(#997): this does not belong here...
       if (enigma_user::path_update()) {
@@ -0,0 +1,212 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "profiler.h"
+#include "object.h"
+#include "resource_data.h"
+#include "instance_system_base.h"
+#include "Platforms/General/PFmain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+  std::atomic<unsigned long long> allocations(0);
+}
+
+#ifdef ENIGMA_PROFILE_ALLOCATIONS
+// Counting allocations needs the global operator new; everything else,
+// including new[], goes through this one. Only built when asked for with
+// PROFILE_ALLOCATIONS=1, so other games keep the library's own.
+void* operator new(std::size_t size) {
+  if (enigma::profiling) allocations.fetch_add(1, std::memory_order_relaxed);
+  if (!size) size = 1;
+  for (;;) {
+    if (void* p = std::malloc(size)) return p;
+    std::new_handler handler = std::get_new_handler();
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+    if (!handler) throw std::bad_alloc();
+#else
+    if (!handler) std::abort(); // Without exceptions, a throw would end here anyway
+#endif
+    handler();
+  }
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+#endif
+
+namespace enigma
+{
+  bool profiling = false;
+
+  namespace {
+    std::string report_path;
+    profile_counter* event_counters = NULL;
+    std::vector<profile_counter> object_counters;
+    profile_counter unused_counter = { "", 0, 0, NULL, true };
+
+    std::vector<unsigned long long> frame_times;
+    std::vector<unsigned long long> frame_allocations;
+    unsigned long long frame_start, frame_start_allocations, run_start;
+    int last_instances = 0, max_instances = 0;
+
+    bool by_time(const profile_counter* a, const profile_counter* b) {
+      return a->nanoseconds > b->nanoseconds;
+    }
+
+    double ms(unsigned long long ns) { return ns / 1e6; }
+
+    // Nearest-rank percentile of a sorted list.
+    unsigned long long percentile(const std::vector<unsigned long long> &sorted, double p) {
+      if (sorted.empty()) return 0;
+      size_t rank = (size_t)(p * sorted.size());
+      return sorted[rank < sorted.size() ? rank : sorted.size() - 1];
+    }
+
+    void write_string(FILE* f, const std::string &s) {
+      fputc('"', f);
+      for (size_t i = 0; i < s.length(); ++i) {
+        const unsigned char c = s[i];
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+      }
+      fputc('"', f);
+    }
+
+    void write_counters(FILE* f, std::vector<profile_counter*> &list, const char* count_name) {
+      std::stable_sort(list.begin(), list.end(), by_time);
+      for (size_t i = 0; i < list.size(); ++i) {
+        fputs(i ? ",\n    {\"name\": " : "\n    {\"name\": ", f);
+        write_string(f, list[i]->name);
+        fprintf(f, ", \"ms\": %.3f, \"%s\": %llu}", ms(list[i]->nanoseconds), count_name, list[i]->calls);
+      }
+      fputs(list.empty() ? "]" : "\n  ]", f);
+    }
+  }
+
+  unsigned long long profile_clock() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  void profile_list(profile_counter* counter) {
+    counter->listed = true;
+    counter->next = event_counters;
+    event_counters = counter;
+  }
+
+  profile_counter& object_profile(int object) {
+    if (!profiling || object < 0 || size_t(object) >= object_counters.size())
+      return unused_counter;
+    return object_counters[object];
+  }
+
+  void profiler_initialize() {
+    const char* path = getenv("ENIGMA_PROFILE");
+    if (!path || !*path) return;
+    report_path = path;
+    profile_counter blank = { NULL, 0, 0, NULL, true };
+    object_counters.assign(objectcount, blank);
+    if (headless_steps > 0) {
+      frame_times.reserve(headless_steps);
+      frame_allocations.reserve(headless_steps);
+    }
+    profiling = true;
+    run_start = profile_clock();
+  }
+
+  void profiler_frame_begin() {
+    if (!profiling) return;
+    frame_start_allocations = allocations.load(std::memory_order_relaxed);
+    frame_start = profile_clock();
+  }
+
+  void profiler_frame_end() {
+    if (!profiling) return;
+    const unsigned long long now = profile_clock();
+    const unsigned long long allocated = allocations.load(std::memory_order_relaxed) - frame_start_allocations;
+    frame_times.push_back(now - frame_start);
+    frame_allocations.push_back(allocated);
+    last_instances = enigma_user::instance_count;
+    if (last_instances > max_instances) max_instances = last_instances;
+  }
+
+  void profiler_report() {
+    if (!profiling) return;
+    profiling = false;
+    const double wall = (profile_clock() - run_start) / 1e9;
+
+    FILE* f = report_path == "-" ? stdout : fopen(report_path.c_str(), "w");
+    if (!f) {
+      fprintf(stderr, "Profiler: could not write %s\n", report_path.c_str());
+      return;
+    }
+
+    const size_t frames = frame_times.size();
+    unsigned long long frame_total = 0, allocation_total = 0, allocation_max = 0;
+    for (size_t i = 0; i < frames; ++i) {
+      frame_total += frame_times[i];
+      allocation_total += frame_allocations[i];
+      allocation_max = std::max(allocation_max, frame_allocations[i]);
+    }
+    std::vector<unsigned long long> sorted(frame_times);
+    std::sort(sorted.begin(), sorted.end());
+
+    fprintf(f, "{\n  \"steps\": %lu,\n", (unsigned long) frames);
+    fprintf(f, "  \"delta_time_us\": %.0f,\n", (double) enigma_user::delta_time);
+    fprintf(f, "  \"wall_seconds\": %.3f,\n", wall);
+    fprintf(f, "  \"frame_ms\": {\"mean\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"max\": %.3f},\n",
+            frames ? ms(frame_total) / frames : 0., ms(percentile(sorted, .5)),
+            ms(percentile(sorted, .95)), ms(sorted.empty() ? 0 : sorted.back()));
+#ifdef ENIGMA_PROFILE_ALLOCATIONS
+    fprintf(f, "  \"allocations_per_frame\": {\"mean\": %.2f, \"max\": %llu, \"total\": %llu},\n",
+            frames ? double(allocation_total) / frames : 0., allocation_max, allocation_total);
+#endif
+    fprintf(f, "  \"instances\": {\"final\": %d, \"max\": %d},\n", last_instances, max_instances);
+
+    std::vector<profile_counter*> list;
+    for (profile_counter* c = event_counters; c; c = c->next)
+      list.push_back(c);
+    fputs("  \"events\": [", f);
+    write_counters(f, list, "calls");
+
+    std::vector<std::string> names(object_counters.size());
+    list.clear();
+    for (size_t i = 0; i < object_counters.size(); ++i) {
+      if (!object_counters[i].calls) continue;
+      names[i] = enigma_user::object_get_name(i);
+      object_counters[i].name = names[i].c_str();
+      list.push_back(&object_counters[i]);
+    }
+    fputs(",\n  \"objects\": [", f);
+    write_counters(f, list, "runs");
+    fputs("\n}\n", f);
+
+    if (f == stdout) fflush(f);
+    else fclose(f);
+  }
+}
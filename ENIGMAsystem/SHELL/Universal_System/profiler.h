@@ -0,0 +1,67 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_PROFILER_H
+#define ENIGMA_PROFILER_H
+
+// A frame profiler for automated runs. Starting the game with ENIGMA_PROFILE
+// set to a file name (or "-" for standard output) records the time spent in
+// each event and in each object's handlers and the instance count in every
+// frame, and writes a JSON report when the game ends. Games built with
+// PROFILE_ALLOCATIONS=1 also count allocations, by replacing the global
+// operator new. When the variable is unset the scopes below cost a branch each.
+
+namespace enigma
+{
+  extern bool profiling;
+
+  // Time spent in one kind of work. Counters for events are static in the
+  // generated code; they join the report the first time they are used.
+  struct profile_counter {
+    const char* name;
+    unsigned long long nanoseconds, calls;
+    profile_counter* next;
+    bool listed;
+  };
+
+  // The counter for the handlers of the given object.
+  profile_counter& object_profile(int object);
+
+  unsigned long long profile_clock(); // Nanoseconds, monotonic
+  void profile_list(profile_counter* counter);
+
+  // Charges the lifetime of the scope to a counter.
+  struct profile_scope {
+    profile_counter* const counter;
+    const unsigned long long start;
+    profile_scope(profile_counter& c): counter(profiling ? &c : 0), start(counter ? profile_clock() : 0) {}
+    ~profile_scope() {
+      if (!counter) return;
+      counter->nanoseconds += profile_clock() - start;
+      counter->calls++;
+      if (!counter->listed) profile_list(counter);
+    }
+  };
+
+  // Called by the platform's main loop.
+  void profiler_initialize();
+  void profiler_frame_begin();
+  void profiler_frame_end();
+  void profiler_report();
+}
+
+#endif //ENIGMA_PROFILER_H
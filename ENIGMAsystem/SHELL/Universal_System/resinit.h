@@ -32,16 +32,15 @@
 #ifndef ENIGMA_RESINIT_H
 #define ENIGMA_RESINIT_H
 
-#include <stdio.h>
-
 namespace enigma 
 {
 
-void exe_loadsprs(FILE* exe);
-void exe_loadsounds(FILE* exe);
-void exe_loadbackgrounds(FILE* exe);
-void exe_loadfonts(FILE* exe);
-void exe_loadpaths(FILE* exe);
+// Each of these reads its resources out of the pack resource_pack::open mapped.
+void exe_loadsprs();
+void exe_loadsounds();
+void exe_loadbackgrounds();
+void exe_loadfonts();
+void exe_loadpaths();
 
 } //namespace enigma
 
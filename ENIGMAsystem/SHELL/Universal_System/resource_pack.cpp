@@ -0,0 +1,144 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "resource_pack.h"
+
+#include "Platforms/General/PFfilemanip.h"
+#include "Platforms/General/PFthreads.h"
+#include "Widget_Systems/widgets_mandatory.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <zlib.h>
+
+namespace enigma {
+namespace resource_pack {
+
+namespace {
+  file_mapping module;
+  const unsigned char *pack = NULL;
+  const toc_entry *toc = NULL, *toc_end = NULL;
+
+  const toc_entry *lower_bound(uint32_t kind, int id, uint32_t index) {
+    return std::lower_bound(toc, toc_end, 0, [&](const toc_entry &e, int) {
+      return entry_less(e, kind, id, index);
+    });
+  }
+
+  struct unpack_job {
+    const toc_entry *const *entries;
+    std::vector<unsigned char> *out;
+    char *ok;
+  };
+
+  void unpack_range(void *data, size_t begin, size_t end, unsigned) {
+    const unpack_job *job = (const unpack_job*) data;
+    for (size_t i = begin; i < end; i++)
+      job->ok[i] = job->entries[i] && unpack(*job->entries[i], job->out[i]);
+  }
+}
+
+bool open(const std::string &fname) {
+  if (!file_map(fname, module)) {
+    show_error("Resource load fail: exe unopenable", 0);
+    return false;
+  }
+
+  footer foot;
+  if (module.size < sizeof(foot)) {
+    printf("No resource data in exe\n");
+    file_unmap(module);
+    return false;
+  }
+  memcpy(&foot, module.data + module.size - sizeof(foot), sizeof(foot));
+  if (memcmp(foot.magic, magic, sizeof(magic))) {
+    printf("No resource data in exe\n");
+    file_unmap(module);
+    return false;
+  }
+
+  // Everything past this point was written by the compiler, so anything off is
+  // damage or a mismatched engine, and loading any of it would be unsafe.
+  const uint64_t pack_size = module.size - sizeof(foot) - foot.pack_start;
+  if (foot.version != version || foot.pack_start > module.size - sizeof(foot) || foot.pack_start % 8 ||
+      foot.toc_offset > pack_size ||
+      pack_size - foot.toc_offset != uint64_t(foot.entry_count) * sizeof(toc_entry)) {
+    show_error("Resource load fail: resource data is damaged or from a different version of ENIGMA", 0);
+    file_unmap(module);
+    return false;
+  }
+  pack = module.data + foot.pack_start;
+  toc = (const toc_entry*) (pack + foot.toc_offset);
+  toc_end = toc + foot.entry_count;
+
+  for (const toc_entry *e = toc; e != toc_end; ++e) {
+    if (e->offset > foot.toc_offset || e->size > foot.toc_offset - e->offset ||
+        (e->codec == codec_raw && e->size != e->unpacked_size) || e->codec > codec_zlib ||
+        (e != toc && !entry_less(e[-1], e->kind, e->id, e->index))) {
+      show_error("Resource load fail: resource data is damaged", 0);
+      toc = toc_end = NULL;
+      pack = NULL;
+      file_unmap(module);
+      return false;
+    }
+  }
+  return true;
+}
+
+const toc_entry *find(uint32_t kind, int id, uint32_t index) {
+  const toc_entry *e = lower_bound(kind, id, index);
+  if (e == toc_end || e->kind != kind || e->id != id || e->index != index) return NULL;
+  return e;
+}
+
+const toc_entry *entries(uint32_t kind, size_t *count) {
+  const toc_entry *first = lower_bound(kind, INT_MIN, 0), *last = first;
+  while (last != toc_end && last->kind == kind) ++last;
+  *count = last - first;
+  return first;
+}
+
+const unsigned char *data(const toc_entry &entry) {
+  return pack ? pack + entry.offset : NULL;
+}
+
+const int32_t *metadata(const toc_entry *entry, size_t count) {
+  if (!entry || entry->codec != codec_raw || entry->size < count * sizeof(int32_t)) return NULL;
+  return (const int32_t*) data(*entry);
+}
+
+bool unpack(const toc_entry &entry, std::vector<unsigned char> &out) {
+  out.resize(entry.unpacked_size);
+  if (entry.codec == codec_raw) {
+    if (entry.size) memcpy(out.data(), data(entry), entry.size);
+    return true;
+  }
+  // zlib directly rather than zlib_decompress, which may report errors; this
+  // runs on pool threads, and the callers report damage themselves.
+  uLongf size = entry.unpacked_size;
+  return uncompress(out.data(), &size, data(entry), entry.size) == Z_OK && size == entry.unpacked_size;
+}
+
+void unpack_all(const toc_entry *const *entries, size_t count, std::vector<unsigned char> *out, char *ok) {
+  unpack_job job = { entries, out, ok };
+  thread_pool_run(count, unpack_range, &job);
+}
+
+}  // namespace resource_pack
+}  // namespace enigma
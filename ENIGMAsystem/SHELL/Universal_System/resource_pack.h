@@ -0,0 +1,59 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifdef INCLUDED_FROM_SHELLMAIN
+#  error This file includes non-ENIGMA STL headers and should not be included from SHELLmain.
+#endif
+
+#ifndef ENIGMA_RESOURCE_PACK_READER_H
+#define ENIGMA_RESOURCE_PACK_READER_H
+
+#include "resource_pack/resource_pack.h"
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace enigma {
+namespace resource_pack {
+
+/// Maps the given file and finds the resource pack at its end. The pack stays
+/// mapped for the rest of the game, so resources can be unpacked on first use.
+/// Returns false, with nothing mapped, if the file has no usable pack.
+bool open(const std::string &fname);
+
+/// Finds an entry; NULL if the pack doesn't have it.
+const toc_entry *find(uint32_t kind, int id, uint32_t index = 0);
+/// Gives the run of entries of one kind, ordered by id and index.
+const toc_entry *entries(uint32_t kind, size_t *count);
+
+/// Points at an entry's bytes as stored; NULL if no pack is open.
+const unsigned char *data(const toc_entry &entry);
+/// Gives the int32 values of a raw metadata entry, or NULL if the entry is
+/// missing or holds fewer than count of them.
+const int32_t *metadata(const toc_entry *entry, size_t count);
+/// Decodes an entry into out, sized to its unpacked size. Returns false if the
+/// entry is damaged. Safe to call from any thread.
+bool unpack(const toc_entry &entry, std::vector<unsigned char> &out);
+/// Decodes entries[i] into out[i] for each i on the thread pool, setting ok[i]
+/// to whether it worked. Null entries are skipped and marked as failed.
+void unpack_all(const toc_entry *const *entries, size_t count, std::vector<unsigned char> *out, char *ok);
+
+}  // namespace resource_pack
+}  // namespace enigma
+
+#endif  // ENIGMA_RESOURCE_PACK_READER_H
@@ -0,0 +1,77 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#include "resource_residency.h"
+#include "background_internal.h"
+#include "depth_draw.h"
+#include "sprites_internal.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace enigma
+{
+  unsigned long residency_frame = 1;
+  unsigned long long resident_bytes = 0;
+
+  namespace {
+    struct eviction_candidate {
+      unsigned long last_used;
+      bool is_sprite;
+      int id;
+      bool operator<(const eviction_candidate &other) const { return last_used < other.last_used; }
+    };
+  }
+
+  void residency_trim()
+  {
+    // Anything fetched from here on belongs to the next frame.
+    const unsigned long frame = residency_frame++;
+    if (!residency_budget || resident_bytes <= residency_budget) return;
+
+    // Tile layers hold on to their backgrounds' textures from when they were
+    // built, without fetching them again, so those count as used every frame.
+    for (std::map<double,depth_layer>::iterator it = drawing_depths.begin(); it != drawing_depths.end(); ++it) {
+      const std::vector<tile> &tiles = it->second.tiles;
+      for (size_t i = 0; i < tiles.size(); i++) {
+        const int bkgid = tiles[i].bckid;
+        if (bkgid >= 0 && size_t(bkgid) < background_idmax && backgroundstructarray[bkgid])
+          backgroundstructarray[bkgid]->last_used = frame;
+      }
+    }
+
+    std::vector<eviction_candidate> candidates;
+    for (size_t i = 0; i < sprite_idmax; i++) {
+      const sprite *spr = spritestructarray[i];
+      if (spr && spr->evictable && spr->resident && spr->last_used < frame)
+        candidates.push_back(eviction_candidate { spr->last_used, true, int(i) });
+    }
+    for (size_t i = 0; i < background_idmax; i++) {
+      const background *bak = backgroundstructarray[i];
+      if (bak && bak->evictable && bak->resident && bak->last_used < frame)
+        candidates.push_back(eviction_candidate { bak->last_used, false, int(i) });
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (size_t i = 0; i < candidates.size() && resident_bytes > residency_budget; i++) {
+      if (candidates[i].is_sprite)
+        sprite_unload_subimages(spritestructarray[candidates[i].id]);
+      else
+        background_unload_texture(candidates[i].id);
+    }
+  }
+}
@@ -0,0 +1,46 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+#ifndef ENIGMA_RESOURCE_RESIDENCY_H
+#define ENIGMA_RESOURCE_RESIDENCY_H
+
+// Sprites and backgrounds from the game module only hold textures and masks
+// while they're in use. Each records the frame it was last fetched in; once
+// those held resources add up to more than the game's budget, the ones unused
+// for longest are dropped at the end of a frame and unpacked again on their
+// next use. Anything changed at runtime is pinned, since the module can no
+// longer restore it. Texture ids of evicted resources go stale, so code that
+// keeps one across frames should prefetch the resource every frame it's used.
+
+namespace enigma
+{
+  // Frame count stamped on resources as they're fetched.
+  extern unsigned long residency_frame;
+  // Bytes held by resources that could be evicted.
+  extern unsigned long long resident_bytes;
+  // From the game's settings; 0 keeps everything once loaded.
+  extern unsigned long long residency_budget;
+  // From the game's settings; loads everything at startup, rather than on first use.
+  extern bool preload_resources;
+
+  // Called after each frame's events. Evicts resources that weren't used this
+  // frame, least recently used first, until the game is within its budget.
+  // Backgrounds the room's tiles use are never evicted.
+  void residency_trim();
+}
+
+#endif //ENIGMA_RESOURCE_RESIDENCY_H
@@ -19,7 +19,7 @@
 #include "Platforms/platforms_mandatory.h"
 #include "libEGMstd.h"
 #include "resinit.h"
-#include "zlib.h"
+#include "resource_pack.h"
 
 #include <cstring>
 #include <cstdio>
@@ -35,36 +35,16 @@ namespace enigma
     
   }
   
-  void exe_loadsounds(FILE *exe)
-  { 
-    int nullhere;
-    
-    if (!fread(&nullhere,4,1,exe)) return;
-    if (memcmp(&nullhere, "SND ", sizeof(int)) != 0)
-      return;
-    
-    // Determine how many sprites we have
-    int sndcount;
-    if (!fread(&sndcount,4,1,exe)) return;
-    
-    // Fetch the highest ID we will be using
-    int snd_highid;
-    if (!fread(&snd_highid,4,1,exe)) return;
-    
-    for (int i = 0; i < sndcount; i++)
+  void exe_loadsounds()
+  {
+    size_t sndcount;
+    const resource_pack::toc_entry *snds = resource_pack::entries(resource_pack::kind_sound, &sndcount);
+
+    for (size_t i = 0; i < sndcount; i++)
     {
-      int id;
-      if (!fread(&id,1,4,exe)) return;
-      
-      unsigned size;
-      if (!fread(&size,1,4,exe)) return;
-      
-      char* fdata = new char[size];
-      if (!fread(fdata,1,size,exe)) return;
-      
-      int e = sound_add_from_buffer(id,fdata,size);
-      if (e) printf("Failed to load sound %d; error %d\n",i,e);
-      delete[] fdata;
+      // Audio systems copy or decode what they're given, so hand them the mapped bytes directly.
+      int e = sound_add_from_buffer(snds[i].id, (void*) resource_pack::data(snds[i]), snds[i].size);
+      if (e) printf("Failed to load sound %d; error %d\n",int(i),e);
     }
   }
 }
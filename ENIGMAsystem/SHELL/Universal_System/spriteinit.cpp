@@ -16,10 +16,12 @@
 **/
 
 #include "libEGMstd.h"
+#include "nlpo2.h"
 #include "resinit.h"
+#include "resource_pack.h"
 #include "sprites_internal.h"
-#include "zlib.h"
 
+#include "Collision_Systems/collision_mandatory.h"
 #include "Graphics_Systems/graphics_mandatory.h"
 #include "Platforms/platforms_mandatory.h"
 #include "Widget_Systems/widgets_mandatory.h"
@@ -27,108 +29,172 @@
 #include <cstring>
 #include <cstdio>
 #include <string>
+#include <vector>
 
 using enigma_user::toString;
 
 namespace enigma
 {
-  void exe_loadsprs(FILE *exe)
-  {
-    int nullhere;
-    unsigned sprid, width, height, bbt, bbb, bbl, bbr, bbm, shape;
-    int xorig, yorig;
-    
-    if (!fread(&nullhere,4,1,exe)) return;
-    if (memcmp(&nullhere, "SPR ", sizeof(int)) != 0)
-      return;
-    
-    // Determine how many sprites we have
-    int sprcount;
-    if (!fread(&sprcount,4,1,exe)) return;
-    
-    // Fetch the highest ID we will be using
-    int spr_highid;
-    if (!fread(&spr_highid,4,1,exe)) return;
-    sprites_init();
-    
-    for (int i = 0; i < sprcount; i++)
+  namespace {
+    // Layout of a sprite's metadata entry.
+    enum { m_width, m_height, m_xorig, m_yorig, m_bbt, m_bbb, m_bbl, m_bbr, m_bbm, m_shape, m_subimages, m_count };
+
+    // What the sprite's subimages hold: padded textures, and a bit per pixel for masks.
+    unsigned long long resident_size(const sprite *spr) {
+      unsigned long long bytes = 0;
+      const unsigned long long texture = 4ull * (nlpo2dc(spr->width) + 1) * (nlpo2dc(spr->height) + 1);
+      for (size_t i = 0; i < spr->texturearray.size(); i++)
+        bytes += texture + (i < spr->colldata.size() && spr->colldata[i] ? spr->width * spr->height / 8 : 0);
+      return bytes;
+    }
+
+    // Raw pixels decoded per batch of sprites, so preloading a large game never
+    // holds all of them at once. A sprite bigger than this is its own batch.
+    const unsigned long long batch_bytes = 64ull << 20;
+
+    collision_type sprite_collision_type(int shape)
     {
-      if (!fread(&sprid, 4,1,exe)) return;
-      if (!fread(&width, 4,1,exe)) return;
-      if (!fread(&height,4,1,exe)) return;
-      if (!fread(&xorig, 4,1,exe)) return;
-      if (!fread(&yorig, 4,1,exe)) return;
-      if (!fread(&bbt, 4,1,exe)) return;
-      if (!fread(&bbb, 4,1,exe)) return;
-      if (!fread(&bbl, 4,1,exe)) return;
-      if (!fread(&bbr, 4,1,exe)) return;
-      if (!fread(&bbm, 4,1,exe)) return;
-      if (!fread(&shape, 4,1,exe)) return;
-
-      collision_type coll_type;
       switch (shape)
       {
-        case ct_precise: coll_type = ct_precise; break;
-        case ct_bbox: coll_type = ct_bbox; break;
-        case ct_ellipse: coll_type = ct_ellipse; break;
-        case ct_diamond: coll_type = ct_diamond; break;
-        case ct_polygon: coll_type = ct_bbox; break; //FIXME: Change to ct_polygon once polygons are supported.
-        case ct_circle: coll_type = ct_circle; break;
-        default: coll_type = ct_bbox; break;
+        case ct_precise: return ct_precise;
+        case ct_bbox: return ct_bbox;
+        case ct_ellipse: return ct_ellipse;
+        case ct_diamond: return ct_diamond;
+        case ct_polygon: return ct_bbox; //FIXME: Change to ct_polygon once polygons are supported.
+        case ct_circle: return ct_circle;
+        default: return ct_bbox;
       };
-      
-      int subimages;
-      if (!fread(&subimages,4,1,exe)) return; //co//ut << "Subimages: " << subimages << endl;
-      
-      sprite_new_empty(sprid, subimages, width, height, xorig, yorig, bbt, bbb, bbl, bbr, 1,0);
-      for (int ii=0;ii<subimages;ii++) 
+    }
+  }
+
+  // Only the metadata is read here; unless the game preloads its resources, the
+  // subimages stay packed in the mapped module until something draws or collides
+  // with the sprite.
+  void exe_loadsprs()
+  {
+    size_t sprcount;
+    const resource_pack::toc_entry *sprs = resource_pack::entries(resource_pack::kind_sprite, &sprcount);
+    std::vector<sprite*> loaded;
+
+    for (size_t i = 0; i < sprcount; i++)
+    {
+      const int32_t *m = resource_pack::metadata(sprs + i, m_count);
+      if (!m) {
+        show_error("Sprite load error: Metadata for sprite " + toString(sprs[i].id) + " is truncated", 0);
+        continue;
+      }
+
+      sprite_new_empty(sprs[i].id, m[m_subimages], m[m_width], m[m_height], m[m_xorig], m[m_yorig],
+                       m[m_bbt], m[m_bbb], m[m_bbl], m[m_bbr], 1, 0);
+      sprite *spr = spritestructarray[sprs[i].id];
+      spr->resident = false;
+      spr->evictable = true;
+      loaded.push_back(spr);
+    }
+
+    if (preload_resources)
+      sprites_load_subimages(loaded.data(), loaded.size());
+  }
+
+  // Subimages are inflated on the thread pool a batch at a time; only creating
+  // the textures and masks happens here, on the main thread.
+  void sprites_load_subimages(sprite *const *sprs, size_t count)
+  {
+    std::vector<const int32_t*> metadata;
+    std::vector<const resource_pack::toc_entry*> entries;
+    std::vector<std::vector<unsigned char> > pixels;
+    std::vector<char> unpacked;
+
+    for (size_t first = 0, last; first < count; first = last)
+    {
+      metadata.clear();
+      entries.clear();
+      unsigned long long bytes = 0;
+      for (last = first; last < count && (last == first || bytes < batch_bytes); last++)
       {
-        int unpacked;
-        if (!fread(&unpacked,4,1,exe)) return;
-        unsigned int size;
-        if (!fread(&size,4,1,exe)) return; //co//ut << "Alloc size: " << size << endl;
-        unsigned char* cpixels=new unsigned char[size+1];
-        if (!cpixels)
-        {  //FIXME: Uncomment these when tostring is available
-          show_error("Failed to load sprite: Cannot allocate enough memory "+toString(unpacked),0);
-          break;
-        }
-        unsigned int sz2=fread(cpixels,1,size,exe);
-        if (size!=sz2) {
-          show_error("Failed to load sprite: Data is truncated before exe end. Read "+toString(sz2)+" out of expected "+toString(size),0);
-          return;
-        }
-        unsigned char* pixels=new unsigned char[unpacked+1];
-        if (zlib_decompress(cpixels,size,unpacked,pixels) != unpacked)
+        // Mark it first, so a damaged sprite is reported once rather than every
+        // frame, and a sprite listed twice is only loaded once.
+        sprite *spr = sprs[last];
+        const int32_t *m = spr->resident ? NULL :
+            resource_pack::metadata(resource_pack::find(resource_pack::kind_sprite, spr->id), m_count);
+        spr->resident = true;
+        metadata.push_back(m);
+        if (!m) continue;
+        for (int ii = 0; ii < m[m_subimages]; ii++)
         {
-          show_error("Sprite load error: Sprite does not match expected size",0);
-          continue;
+          const resource_pack::toc_entry *e = resource_pack::find(resource_pack::kind_sprite_image, spr->id, ii);
+          if (e && e->unpacked_size != unsigned(m[m_width]) * unsigned(m[m_height]) * 4) e = NULL;
+          entries.push_back(e);
+          if (e) bytes += e->unpacked_size;
         }
-        delete[] cpixels;
-        
-        unsigned char* collision_data = 0;
-        switch (coll_type)
-        {
-          case ct_precise: collision_data = pixels; break;
-          case ct_circle:
-          case ct_ellipse:
-          case ct_diamond:
-          case ct_bbox: collision_data = 0; break;
-          case ct_polygon: collision_data = 0; break; //FIXME: Support vertex data.
-          default: collision_data = 0; break;
-        };
-        
-        sprite_set_subimage(sprid, ii, width, height, pixels, collision_data, coll_type);
-        
-        delete[] pixels;
-        if (!fread(&nullhere,4,1,exe)) return;
-        
-        if (nullhere)
+      }
+
+      pixels.resize(entries.size());
+      unpacked.resize(entries.size());
+      resource_pack::unpack_all(entries.data(), entries.size(), pixels.data(), unpacked.data());
+
+      for (size_t i = first, k = 0; i < last; i++)
+      {
+        const int32_t *m = metadata[i - first];
+        if (!m) continue;
+        sprite *spr = sprs[i];
+        const unsigned width = m[m_width], height = m[m_height];
+        const collision_type coll_type = sprite_collision_type(m[m_shape]);
+
+        for (int ii = 0; ii < m[m_subimages]; ii++, k++)
         {
-          show_error("Sprite load error: Null terminator expected",0);
-          break;
+          if (!unpacked[k])
+          {
+            // Keep the subimage count honest with a blank image; code indexes by it.
+            show_error("Sprite load error: Sprite does not match expected size",0);
+            pixels[k].assign(width * height * 4, 0);
+          }
+
+          unsigned char* collision_data = 0;
+          switch (coll_type)
+          {
+            case ct_precise: collision_data = pixels[k].data(); break;
+            case ct_circle:
+            case ct_ellipse:
+            case ct_diamond:
+            case ct_bbox: collision_data = 0; break;
+            case ct_polygon: collision_data = 0; break; //FIXME: Support vertex data.
+            default: collision_data = 0; break;
+          };
+
+          sprite_set_subimage(spr->id, ii, width, height, pixels[k].data(), collision_data, coll_type);
+          std::vector<unsigned char>().swap(pixels[k]);
         }
+        if (spr->evictable) resident_bytes += resident_size(spr);
       }
     }
   }
+
+  void sprite_load_subimages(sprite *spr)
+  {
+    sprites_load_subimages(&spr, 1);
+  }
+
+  void sprite_unload_subimages(sprite *spr)
+  {
+    if (!spr->evictable || !spr->resident) return;
+    resident_bytes -= resident_size(spr);
+    for (size_t i = 0; i < spr->texturearray.size(); i++)
+      graphics_delete_texture(spr->texturearray[i]);
+    for (size_t i = 0; i < spr->colldata.size(); i++)
+      free_collision_mask(spr->colldata[i]);
+    spr->texturearray.clear();
+    spr->texturexarray.clear();
+    spr->textureyarray.clear();
+    spr->texturewarray.clear();
+    spr->textureharray.clear();
+    spr->colldata.clear();
+    spr->resident = false;
+  }
+
+  void sprite_pin(sprite *spr)
+  {
+    if (spr->evictable && spr->resident) resident_bytes -= resident_size(spr);
+    spr->evictable = false;
+  }
 }
@@ -53,6 +53,9 @@ bool sprite_replace(int ind, std::string fname, int imgnumb, bool precise, bool
 bool sprite_replace(int ind, std::string fname, int imgnumb, bool transparent, bool smooth, int x_offset, int y_offset,
                     bool free_texture = true, bool mipmap = false);  //GM7+ compatible
 bool sprite_exists(int spr);
+int sprite_prefetch(int ind);  // Loads the subimages now rather than on first use; 0, or -1 if there's no such sprite
+int sprite_prefetch_multi(const var& inds);  // Loads an array of sprites, inflating them in parallel; -1 in a parallel step
+int sprite_flush(int ind);     // Frees the subimages until next use; -1 unless they can be reloaded from the game, or in a parallel step
 void sprite_save(int ind, unsigned subimg, std::string fname);
 //void sprite_save_strip(int ind, std::string fname); //FIXME: We don't support this yet
 void sprite_delete(int ind, bool free_texture = true);
@@ -26,6 +26,8 @@
 #define ENIGMA_SPRITESTRUCT
 
 #include "Collision_Systems/collision_types.h"
+#include "parallel_events.h"
+#include "resource_residency.h"
 #include "var4.h"
 
 #include <stdlib.h>
@@ -51,6 +53,9 @@ struct sprite {
   bbox_rect_t bbox, bbox_relative;
   int bbox_mode = 0;  //Default is automatic
   bool where, smooth = false;
+  bool resident = true;  // False until the subimages are unpacked from the game module; see sprite_get_resident.
+  bool evictable = false;  // Whether the subimages may be dropped and unpacked again later; see resource_residency.h.
+  unsigned long last_used = 0;  // The residency_frame it was last fetched in.
 
   sprite();
   sprite(int);
@@ -75,6 +80,30 @@ void sprite_add_subimage(int sprid, unsigned int w, unsigned int h, unsigned cha
                          collision_type ct);
 void spritestructarray_reallocate();
 
+/// Unpacks the subimages of a sprite that was loaded from the game module without them.
+void sprite_load_subimages(sprite *spr);
+/// Does the same for many sprites at once, inflating their subimages on the thread pool.
+/// Sprites that are already loaded are skipped.
+void sprites_load_subimages(sprite *const *sprs, size_t count);
+/// Frees the textures and masks of an evictable sprite until it's next fetched.
+void sprite_unload_subimages(sprite *spr);
+/// Keeps a sprite's subimages for good. Call this before changing them, since the
+/// game module could no longer restore them.
+void sprite_pin(sprite *spr);
+/// Fetches a sprite, first unpacking its subimages if they aren't loaded. Anything
+/// reading textures or collision data must get its sprite through here.
+/// During a parallel phase nothing is loaded or stamped; the phase loads the
+/// sprites of live instances before it starts, and any other sprite comes back
+/// without its subimages.
+inline sprite *sprite_get_resident(int id) {
+  sprite *spr = spritestructarray[id];
+  if (spr && !parallel_phase) {
+    if (!spr->resident) sprite_load_subimages(spr);
+    spr->last_used = residency_frame;
+  }
+  return spr;
+}
+
 extern const bbox_rect_t &sprite_get_bbox(int sprid);
 extern const bbox_rect_t &sprite_get_bbox_relative(int sprid);
 }  //namespace enigma
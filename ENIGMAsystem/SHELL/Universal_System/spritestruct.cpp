@@ -30,6 +30,7 @@
 
 #include <cstring>
 #include <string>
+#include <vector>
 
 #define get_current_instance() \
     ((enigma::object_graphics*) enigma::instance_event_iterator->inst)
@@ -46,11 +47,22 @@ bool get_sprite(enigma::sprite* &spr, int id)
     return true;
 }
 
+// For anything that reads or replaces the sprite's textures or collision data.
+bool get_sprite_resident(enigma::sprite* &spr, int id)
+{
+    if (!get_sprite(spr, id))
+        return false;
+    spr = enigma::sprite_get_resident(id);
+    return true;
+}
+
 bool get_sprite_mtx(enigma::sprite* &spr, int id)
 {
-    bool rtn = get_sprite(spr, id);
+    bool rtn = get_sprite_resident(spr, id);
     if (rtn) {
         // TODO: Lock a lock by reference and allow it to be timely destructed and released
+        // The caller may change this sprite's bounds, so instances using it must be rebinned.
+        enigma::collision_grid_invalidate();
     }
     return rtn;
 }
@@ -83,6 +95,7 @@ bool sprite_replace(int ind, string filename, int imgnumb, bool precise, bool tr
     enigma::sprite *spr;
     if (!get_sprite_mtx(spr, ind))
         return false;
+    enigma::sprite_pin(spr);
 
   if (free_texture) {
     for (int ii = 0; ii < spr->subcount; ii++) {
@@ -110,6 +123,38 @@ bool sprite_exists(int spr) {
     return (unsigned(spr) < enigma::sprite_idmax) and bool(enigma::spritestructarray[spr]);
 }
 
+int sprite_prefetch(int ind) {
+    if (!sprite_exists(ind))
+        return -1;
+    enigma::sprite_get_resident(ind);
+    return 0;
+}
+
+int sprite_prefetch_multi(const var& inds) {
+    // Loading would race with the phase's own readers; sprite_get_resident
+    // refuses it there too.
+    if (enigma::parallel_phase)
+        return -1;
+    std::vector<enigma::sprite*> sprs;
+    for (int i = 0; i < inds.array_len(); i++) {
+        if (!sprite_exists(inds[i]))
+            return -1;
+        sprs.push_back(enigma::spritestructarray[int(inds[i])]);
+    }
+    enigma::sprites_load_subimages(sprs.data(), sprs.size());
+    for (size_t i = 0; i < sprs.size(); i++)
+        sprs[i]->last_used = enigma::residency_frame;
+    return 0;
+}
+
+int sprite_flush(int ind) {
+    // Other instances of a parallel step may be reading the subimages.
+    if (enigma::parallel_phase || !sprite_exists(ind) || !enigma::spritestructarray[ind]->evictable)
+        return -1;
+    enigma::sprite_unload_subimages(enigma::spritestructarray[ind]);
+    return 0;
+}
+
 void sprite_save(int ind, unsigned subimg, string fname) {
     enigma::sprite *spr;
     if (!get_sprite_mtx(spr, ind))
@@ -133,6 +178,7 @@ void sprite_delete(int ind, bool free_texture)
     enigma::sprite* spr;
     if (!get_sprite_mtx(spr, ind))
         return;
+    enigma::sprite_pin(spr);
 
     if (free_texture)
         for (int ii = 0; ii < spr->subcount; ii++)
@@ -162,6 +208,7 @@ void sprite_assign(int ind, int copy_sprite, bool free_texture)
         return;
     if (!get_sprite_mtx(spr_copy, copy_sprite))
         return;
+    enigma::sprite_pin(spr);
 
     if (free_texture)
         for (int ii = 0; ii < spr->subcount; ii++)
@@ -182,6 +229,7 @@ void sprite_set_alpha_from_sprite(int ind, int copy_sprite, bool free_texture)
         return;
     if (!get_sprite_mtx(spr_copy, copy_sprite))
         return;
+    enigma::sprite_pin(spr);
 
     for (int i = 0; i < spr->subcount; i++)
         enigma::graphics_replace_texture_alpha_from_texture(spr->texturearray[i], spr_copy->texturearray[i % spr_copy->subcount]);
@@ -194,6 +242,7 @@ void sprite_merge(int ind, int copy_sprite)
         return;
     if (!get_sprite_mtx(spr_copy, copy_sprite))
         return;
+    enigma::sprite_pin(spr);
 
     int i = 0, j = 0, t_subcount = spr->subcount + spr_copy->subcount;
     while (j < spr_copy->subcount)
@@ -453,7 +502,8 @@ namespace enigma
   unsigned texture =
       graphics_create_texture(w, h, fullwidth,fullheight,imgpxdata,false);
 
-    sprite* sprstr = spritestructarray[sprid];
+    sprite* sprstr = sprite_get_resident(sprid);
+    sprite_pin(sprstr);
 
     sprstr->texturearray.push_back(texture);
     sprstr->texturexarray.push_back(0.0);
@@ -512,7 +562,7 @@ int sprite_get_height(int sprid)
 double sprite_get_texture_width_factor(int sprid, int subimg)
 {
   enigma::sprite *spr;
-  if (!get_sprite(spr,sprid))
+  if (!get_sprite_resident(spr,sprid))
     return 32;
 
   return spr->texturewarray[subimg];
@@ -521,7 +571,7 @@ double sprite_get_texture_width_factor(int sprid, int subimg)
 double sprite_get_texture_height_factor(int sprid, int subimg)
 {
   enigma::sprite *spr;
-  if (!get_sprite(spr,sprid))
+  if (!get_sprite_resident(spr,sprid))
     return 32;
 
   return spr->textureharray[subimg];
@@ -608,7 +658,7 @@ int sprite_get_number(int sprid)
 int sprite_get_texture(int sprid,int subimage)
 {
   enigma::sprite *spr;
-  if (!get_sprite(spr,sprid))
+  if (!get_sprite_resident(spr,sprid))
     return 0;
 
   const int usi = subimage >= 0
@@ -689,7 +739,7 @@ var sprite_get_uvs(int ind, int subimg){
   uvs[4] = 0; 
 
   enigma::sprite *spr;
-  if (!get_sprite(spr,ind))
+  if (!get_sprite_resident(spr,ind))
     return uvs;
 
   uvs[0] = spr->texturexarray[subimg];
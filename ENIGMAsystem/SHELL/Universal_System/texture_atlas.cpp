@@ -35,10 +35,10 @@
     if (id < -1 or size_t(id) > enigma::sprite_idmax or !enigma::spritestructarray[id]) { \
       show_error("Cannot access sprite with id " + toString(id), false); \
       return; \
-    } enigma::sprite *const spr = enigma::spritestructarray[id];
+    } enigma::sprite *const spr = enigma::sprite_get_resident(id);
 #else
   #define get_sprite(spr,id) \
-    enigma::sprite *const spr = enigma::spritestructarray[id];
+    enigma::sprite *const spr = enigma::sprite_get_resident(id);
 #endif
 
 using std::unordered_map;
@@ -64,7 +64,7 @@ namespace enigma {
     for (unsigned int i = 0; i < textures.size(); i++){ //This adds the rest of the images
       switch (textures[i].type){
         case 0: { //Add all sprite subimages
-          enigma::sprite *sspr = enigma::spritestructarray[textures[i].id];
+          enigma::sprite *sspr = enigma::sprite_get_resident(textures[i].id);
           for (int s = 0; s < sspr->subcount; s++){
             metrics.emplace_back();
           }
@@ -89,14 +89,14 @@ namespace enigma {
       // TODO: This should maybe crop the images so it's totally fit (this can be done on compile time by LGM or compiler even, but it's possible the user has loaded the image at runtime)
       switch (textures[i].type){
         case 0: { //Metrics all sprite subimages
-          enigma::sprite *sspr = enigma::spritestructarray[textures[i].id];
+          enigma::sprite *sspr = enigma::sprite_get_resident(textures[i].id);
           for (int s = 0; s < sspr->subcount; s++){
             metrics[counter].w = sspr->width, metrics[counter].h = sspr->height;
             counter++;
           }
         } break;
         case 1: { //Metrics for backgrounds
-          enigma::background *bkg = enigma::backgroundstructarray[textures[i].id];
+          enigma::background *bkg = enigma::background_get_resident(textures[i].id);
           metrics[counter].w = bkg->width, metrics[counter].h = bkg->height;
           counter++;
         } break;
@@ -157,7 +157,8 @@ namespace enigma {
     for (unsigned int i = 0; i < textures.size(); i++){
       switch (textures[i].type){
         case 0: { //Copy textures for all sprite subimages
-          enigma::sprite *sspr = enigma::spritestructarray[textures[i].id];
+          enigma::sprite *sspr = enigma::sprite_get_resident(textures[i].id);
+          enigma::sprite_pin(sspr);
           for (int s = 0; s < sspr->subcount; s++){
             enigma::graphics_copy_texture(sspr->texturearray[s], enigma::texture_atlas_array[ta].texture, metrics[counter].x, metrics[counter].y);
             if (free_textures == true){
@@ -175,7 +176,8 @@ namespace enigma {
           }
         } break;
         case 1: { //Copy textures for all the backgrounds
-          enigma::background *bkg = enigma::backgroundstructarray[textures[i].id];
+          enigma::background *bkg = enigma::background_get_resident(textures[i].id);
+          enigma::background_pin(bkg);
           enigma::graphics_copy_texture(bkg->texture, enigma::texture_atlas_array[ta].texture, metrics[counter].x, metrics[counter].y);
           if (free_textures == true){
             enigma::graphics_delete_texture(bkg->texture);
@@ -267,6 +269,7 @@ namespace enigma_user {
   void texture_atlas_add_sprite_position(int tp, int sprid, int subimg, int x, int y, bool free_texture){
     ///TODO: NEEDS ERROR CHECKING
     get_sprite(spr, sprid);
+    enigma::sprite_pin(spr);
     enigma::graphics_copy_texture(spr->texturearray[subimg], enigma::texture_atlas_array[tp].texture, x, y);
     if (free_texture == true){
       enigma::graphics_delete_texture(spr->texturearray[subimg]);
@@ -22,9 +22,134 @@
 #include "var_te.h"
 
 #include <math.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
 
 using std::string;
 
+/*
+ * String bodies
+ */
+
+namespace enigma {
+  struct var_string {
+    string str;
+    size_t hash;
+    mutable std::atomic<unsigned> refs;
+    var_string *next; // Next body in the same intern table bucket
+    bool interned;    // Whether the body is in the intern table at all
+    var_string(string &&s, size_t h, var_string *n): str(std::move(s)), hash(h), refs(1), next(n), interned(true) {}
+    // A body built by concatenation, kept out of the table so building a
+    // string piece by piece neither rehashes it nor takes the table's lock.
+    explicit var_string(string &&s): str(std::move(s)), hash(0), refs(1), next(NULL), interned(false) {}
+  };
+}
+
+namespace {
+  using enigma::var_string;
+
+  // Every live string body, chained by hash. Step events may run on worker
+  // threads, so the table is guarded. Lookups never revive a body whose count
+  // already hit zero, which lets releases stay lock-free until the last one.
+  struct intern_table {
+    std::vector<var_string*> buckets;
+    size_t count;
+    std::mutex lock;
+    intern_table(): buckets(64, NULL), count(0) {}
+  };
+  // Never destroyed: global variants may release strings during exit.
+  intern_table &interned() { static intern_table *t = new intern_table(); return *t; }
+  const string empty_string;
+
+  const var_string *str_intern(string s) {
+    const size_t h = std::hash<string>()(s);
+    intern_table &t = interned();
+    std::lock_guard<std::mutex> guard(t.lock);
+    var_string *&head = t.buckets[h & (t.buckets.size() - 1)];
+    for (var_string *b = head; b; b = b->next)
+      if (b->hash == h and b->str == s) {
+        unsigned n = b->refs.load(std::memory_order_relaxed);
+        while (n and !b->refs.compare_exchange_weak(n, n + 1, std::memory_order_relaxed)) {}
+        if (n) return b;
+      }
+    var_string *res = head = new var_string(std::move(s), h, head);
+    if (++t.count > t.buckets.size()) {
+      std::vector<var_string*> nb(t.buckets.size() * 2, NULL);
+      for (var_string *b : t.buckets)
+        while (b) {
+          var_string *next = b->next;
+          var_string *&nh = nb[b->hash & (nb.size() - 1)];
+          b->next = nh, nh = b, b = next;
+        }
+      t.buckets.swap(nb);
+    }
+    return res;
+  }
+
+  inline void str_retain(const void *p) {
+    ((const var_string*)p)->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  void str_release(const void *p) {
+    var_string *b = (var_string*)p;
+    if (b->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+      return;
+    if (!b->interned) { delete b; return; }
+    intern_table &t = interned();
+    std::lock_guard<std::mutex> guard(t.lock);
+    var_string **it = &t.buckets[b->hash & (t.buckets.size() - 1)];
+    while (*it != b) it = &(*it)->next;
+    *it = b->next;
+    --t.count;
+    delete b;
+  }
+}
+
+const string& variant::sval() const {
+  return type == enigma_user::ty_string ? ((const var_string*)rval.p)->str : empty_string;
+}
+
+namespace {
+  // Two interned bodies are equal only if they are the same body; a body made
+  // by concatenation has to be compared by its contents.
+  bool str_equal(const void *a, const void *b) {
+    const var_string *x = (const var_string*)a, *y = (const var_string*)b;
+    return x == y or ((!x->interned or !y->interned) and x->str == y->str);
+  }
+
+  variant str_loose(string &&s) {
+    variant res;
+    res.rval.p = new var_string(std::move(s));
+    res.type = enigma_user::ty_string;
+    return res;
+  }
+
+  // Appends x to v's string. A body only v refers to and that isn't interned
+  // is grown in place, so a loop of += stays linear.
+  void str_append(variant &v, const string &x) {
+    var_string *b = (var_string*)v.rval.p;
+    if (!b->interned and b->refs.load(std::memory_order_acquire) == 1) {
+      b->str += x;
+      return;
+    }
+    string s;
+    s.reserve(b->str.size() + x.size());
+    s.append(b->str).append(x);
+    v.rval.p = new var_string(std::move(s));
+    str_release(b);
+  }
+}
+
+variant enigma::intern(const variant &v) {
+  if (v.type != enigma_user::ty_string or ((const var_string*)v.rval.p)->interned)
+    return v;
+  variant res;
+  res.rval.p = str_intern(v.sval());
+  res.type = enigma_user::ty_string;
+  return res;
+}
+
 #ifdef DEBUG_MODE
 #include "Widget_Systems/widgets_mandatory.h"
   #define ccast(tpc) { if (type != tpc) \
@@ -71,7 +196,7 @@ variant::operator long long() { ccast(0); return (long long)(rval.d); }
 variant::operator double()    { ccast(0); return double     (rval.d); }
 variant::operator float()     { ccast(0); return float      (rval.d); }
 
-variant::operator string() { ccast(1); return sval; }
+variant::operator string() { ccast(1); return sval(); }
 
 variant::operator int()       const { ccast(0); return int  (rval.d); }
 variant::operator bool()      const { ccast(0); return lrint(rval.d) > 0; }
@@ -87,74 +212,77 @@ variant::operator long long() const { ccast(0); return (long long)(rval.d); }
 variant::operator double()    const { ccast(0); return double     (rval.d); }
 variant::operator float()     const { ccast(0); return float      (rval.d); }
 
-variant::operator string() const { ccast(1); return sval; }
+variant::operator string() const { ccast(1); return sval(); }
 
 #define real enigma_user::ty_real
 #define tstr enigma_user::ty_string
 
-types_extrapolate_real_p  (variant::variant,: rval(x), sval( ), type(real) {})
-types_extrapolate_string_p(variant::variant,: rval(0.0), sval(x), type(tstr) {})
+// Compound operators on a string leave it untouched rather than scribbling over its body pointer.
+#define strguard() if (type == tstr) return *this
+
+types_extrapolate_real_p  (variant::variant,: rval(x), type(real) {})
+types_extrapolate_string_p(variant::variant,: rval(str_intern(x)), type(tstr) {})
 //variant::variant(var x): rval(x[0].rval), sval(x[0].sval) { }
 variant::variant(const void *p): rval(p), type(enigma_user::ty_pointer) {}
-variant::variant(const variant& x): rval(x.rval.d), sval(x.sval), type(x.type) { }
-variant::variant(const var& x): rval((*x).rval.d), sval((*x).sval), type((*x).type) { }
-variant::variant(): rval(0.0), sval( ), type(default_type) { }
+variant::variant(const variant& x): rval(x.rval), type(x.type) { if (type == tstr) str_retain(rval.p); }
+variant::variant(const var& x): rval((*x).rval), type((*x).type) { if (type == tstr) str_retain(rval.p); }
+variant::variant(): rval(0.0), type(default_type) { }
 
-types_extrapolate_real_p  (variant& variant::operator=, { rval.d = x; type = real; return *this; })
-types_extrapolate_string_p(variant& variant::operator=, { sval   = x; type = tstr; return *this; })
-variant& variant::operator=(const variant x)            { rval.d = x.rval.d; if ((type = x.type) == tstr) sval = x.sval; return *this; }
+types_extrapolate_real_p  (variant& variant::operator=, { if (type == tstr) str_release(rval.p); rval.d = x; type = real; return *this; })
+types_extrapolate_string_p(variant& variant::operator=, { const void *s = str_intern(x); if (type == tstr) str_release(rval.p); rval.p = s; type = tstr; return *this; })
+variant& variant::operator=(const variant x)            { if (x.type == tstr) str_retain(x.rval.p); if (type == tstr) str_release(rval.p); rval = x.rval; type = x.type; return *this; }
 variant& variant::operator=(const var &x)               { return *this = *x; }
-variant& variant::operator=(const void* p)              { type = enigma_user::ty_pointer; rval.p = p; return *this; }
+variant& variant::operator=(const void* p)              { if (type == tstr) str_release(rval.p); type = enigma_user::ty_pointer; rval.p = p; return *this; }
 
-types_extrapolate_real_p  (variant& variant::operator+=, { terror(real); rval.d += x; return *this; })
-types_extrapolate_string_p(variant& variant::operator+=, { terror(tstr); sval   += x; return *this; })
-variant& variant::operator+=(const variant x)            { terror(x.type); if (x.type == real) rval.d += x.rval.d; else sval += x.sval; return *this; }
+types_extrapolate_real_p  (variant& variant::operator+=, { terror(real); strguard(); rval.d += x; return *this; })
+types_extrapolate_string_p(variant& variant::operator+=, { terror(tstr); if (type == tstr) str_append(*this, x); return *this; })
+variant& variant::operator+=(const variant x)            { terror(x.type); if (x.type == real) { strguard(); rval.d += x.rval.d; } else if (type == tstr) str_append(*this, x.sval()); return *this; }
 variant& variant::operator+=(const var &x)               { return *this += *x; }
 
-types_extrapolate_real_p  (variant& variant::operator-=, { terror(real); rval.d -= x; return *this; })
+types_extrapolate_real_p  (variant& variant::operator-=, { terror(real); strguard(); rval.d -= x; return *this; })
 types_extrapolate_string_p(variant& variant::operator-=, { terrortrue(); return *this; })
-variant& variant::operator-=(const variant x)            { terror2(real); rval.d -= x.rval.d; return *this; }
+variant& variant::operator-=(const variant x)            { terror2(real); strguard(); rval.d -= x.rval.d; return *this; }
 variant& variant::operator-=(const var &x)               { return *this -= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator*=, { terror(real); rval.d *= x; return *this; })
+types_extrapolate_real_p  (variant& variant::operator*=, { terror(real); strguard(); rval.d *= x; return *this; })
 types_extrapolate_string_p(variant& variant::operator*=, { terrortrue(); return *this; })
-variant& variant::operator*=(const variant x)            { terror2(real); rval.d *= x.rval.d; return *this; }
+variant& variant::operator*=(const variant x)            { terror2(real); strguard(); rval.d *= x.rval.d; return *this; }
 variant& variant::operator*=(const var &x)               { return *this *= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator/=, { terror(real); rval.d /= x; return *this; })
+types_extrapolate_real_p  (variant& variant::operator/=, { terror(real); strguard(); rval.d /= x; return *this; })
 types_extrapolate_string_p(variant& variant::operator/=, { terrortrue(); return *this; })
-variant& variant::operator/=(const variant x)            { terror2(real); rval.d /= x.rval.d; return *this; }
+variant& variant::operator/=(const variant x)            { terror2(real); strguard(); rval.d /= x.rval.d; return *this; }
 variant& variant::operator/=(const var &x)               { return *this /= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator%=, { terror(real); rval.d = fmod(rval.d, x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator%=, { terror(real); strguard(); rval.d = fmod(rval.d, x); return *this; })
 types_extrapolate_string_p(variant& variant::operator%=, { terrortrue(); return *this; })
-variant& variant::operator%=(const variant x)            { terror2(real); rval.d = fmod(rval.d, x.rval.d); return *this; }
-variant& variant::operator%=(const var &x)               { div0c((*x).rval.d) rval.d = fmod(rval.d, (*x).rval.d); return *this; }
+variant& variant::operator%=(const variant x)            { terror2(real); strguard(); rval.d = fmod(rval.d, x.rval.d); return *this; }
+variant& variant::operator%=(const var &x)               { div0c((*x).rval.d) strguard(); rval.d = fmod(rval.d, (*x).rval.d); return *this; }
 
 
-types_extrapolate_real_p  (variant& variant::operator<<=, { terror(real); rval.d = long(rval.d) << int(x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator<<=, { terror(real); strguard(); rval.d = long(rval.d) << int(x); return *this; })
 types_extrapolate_string_p(variant& variant::operator<<=, { terrortrue(); return *this; })
-variant& variant::operator<<=(const variant x)            { terror2(real); rval.d = long(rval.d) << long(x.rval.d); return *this; }
+variant& variant::operator<<=(const variant x)            { terror2(real); strguard(); rval.d = long(rval.d) << long(x.rval.d); return *this; }
 variant& variant::operator<<=(const var &x)               { return *this <<= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator>>=, { terror(real); rval.d = long(rval.d) >> int(x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator>>=, { terror(real); strguard(); rval.d = long(rval.d) >> int(x); return *this; })
 types_extrapolate_string_p(variant& variant::operator>>=, { terrortrue(); return *this; })
-variant& variant::operator>>=(const variant x)            { terror2(real); rval.d = long(rval.d) >> long(x.rval.d); return *this; }
+variant& variant::operator>>=(const variant x)            { terror2(real); strguard(); rval.d = long(rval.d) >> long(x.rval.d); return *this; }
 variant& variant::operator>>=(const var &x)               { return *this >>= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator&=,  { terror(real); rval.d = long(rval.d) & long(x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator&=,  { terror(real); strguard(); rval.d = long(rval.d) & long(x); return *this; })
 types_extrapolate_string_p(variant& variant::operator&=,  { terrortrue(); return *this; })
-variant& variant::operator&=(const variant x)             { terror2(real); rval.d = long(rval.d) & long(x.rval.d); return *this; }
+variant& variant::operator&=(const variant x)             { terror2(real); strguard(); rval.d = long(rval.d) & long(x.rval.d); return *this; }
 variant& variant::operator&=(const var &x)                { return *this &= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator|=,  { terror(real); rval.d = long(rval.d) | long(x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator|=,  { terror(real); strguard(); rval.d = long(rval.d) | long(x); return *this; })
 types_extrapolate_string_p(variant& variant::operator|=,  { terrortrue(); return *this; })
-variant& variant::operator|=(const variant x)             { terror2(real); rval.d = long(rval.d) | long(x.rval.d); return *this; }
+variant& variant::operator|=(const variant x)             { terror2(real); strguard(); rval.d = long(rval.d) | long(x.rval.d); return *this; }
 variant& variant::operator|=(const var &x)                { return *this |= *x; }
 
-types_extrapolate_real_p  (variant& variant::operator^=,  { terror(real); rval.d = long(rval.d) ^ long(x); return *this; })
+types_extrapolate_real_p  (variant& variant::operator^=,  { terror(real); strguard(); rval.d = long(rval.d) ^ long(x); return *this; })
 types_extrapolate_string_p(variant& variant::operator^=,  { terrortrue(); return *this; })
-variant& variant::operator^=(const variant x)             { terror2(real); rval.d = long(rval.d) ^ long(x.rval.d); return *this; }
+variant& variant::operator^=(const variant x)             { terror2(real); strguard(); rval.d = long(rval.d) ^ long(x.rval.d); return *this; }
 variant& variant::operator^=(const var &x)                { return *this ^= *x; }
 
 
@@ -162,8 +290,8 @@ variant& variant::operator^=(const var &x)                { return *this ^= *x;
 #undef EVCONST
 #define EVCONST const
 types_extrapolate_real_p  (variant variant::operator+, { terror(real); return rval.d + x; })
-types_extrapolate_string_p(variant variant::operator+, { terror(tstr); return sval   + x; })
-variant variant::operator+(const variant x) EVCONST    { terror(x.type); if (x.type == real) return rval.d + x.rval.d; return sval + x.sval; }
+types_extrapolate_string_p(variant variant::operator+, { terror(tstr); return str_loose(sval() + x); })
+variant variant::operator+(const variant x) EVCONST    { terror(x.type); if (x.type == real) return rval.d + x.rval.d; return str_loose(sval() + x.sval()); }
 variant variant::operator+(const var &x)    EVCONST    { return *this + *x; }
 
 types_extrapolate_real_p  (double  variant::operator-, { terror(real); return rval.d - x; })
@@ -216,42 +344,42 @@ long variant::operator^(const var &x)    EVCONST    { return *this ^ *x; }
 // STANDARD:  In all cases, string > real
 
 types_extrapolate_real_p  (bool variant::operator==, { return type == real and vareq(rval.d, x); })
-types_extrapolate_string_p(bool variant::operator==, { return type == tstr and sval == x; })
-bool variant::operator==(const variant &x)   EVCONST { return type == x.type and ((x.type == real) ? vareq(rval.d, x.rval.d) : sval == x.sval); }
+types_extrapolate_string_p(bool variant::operator==, { return type == tstr and sval() == x; })
+bool variant::operator==(const variant &x)   EVCONST { return type == x.type and ((x.type == real) ? vareq(rval.d, x.rval.d) : x.type == tstr ? str_equal(rval.p, x.rval.p) : rval.p == x.rval.p); }
 //bool variant::operator==(const variant x)            { return type == x.type and ((x.type == real) ? rval.d == x.rval.d : sval == x.sval); }
 bool variant::operator==(const var &x)       EVCONST { return *this == *x; }
 
 types_extrapolate_real_p  (bool variant::operator!=, { return type != real or varneq(rval.d, x); })
-types_extrapolate_string_p(bool variant::operator!=, { return type != tstr or sval != x; })
-bool variant::operator!=(const variant &x)   EVCONST { return type != x.type or ((x.type == real) ? varneq(rval.d, x.rval.d) : sval != x.sval); }
+types_extrapolate_string_p(bool variant::operator!=, { return type != tstr or sval() != x; })
+bool variant::operator!=(const variant &x)   EVCONST { return type != x.type or ((x.type == real) ? varneq(rval.d, x.rval.d) : x.type == tstr ? !str_equal(rval.p, x.rval.p) : rval.p != x.rval.p); }
 //bool variant::operator!=(const variant x)            { return type != x.type or ((x.type == real) ? rval.d != x.rval.d : sval != x.sval); }
 bool variant::operator!=(const var &x)       EVCONST { return *this != *x; }
 
 types_extrapolate_real_p  (bool variant::operator>=, { return type != real or  rval.d >= x - var_e; }) //type != real, then we're string and a priori greater.
-types_extrapolate_string_p(bool variant::operator>=, { return type == tstr and sval   >= x; }) //To be more, we must be string anyway.
-bool variant::operator>=(const variant &x)   EVCONST { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d >= x.rval.d : sval >= x.sval)); }
-//bool variant::operator>=(const variant x)            { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d >= x.rval.d : sval >= x.sval)); }
+types_extrapolate_string_p(bool variant::operator>=, { return type == tstr and sval() >= x; }) //To be more, we must be string anyway.
+bool variant::operator>=(const variant &x)   EVCONST { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d >= x.rval.d : sval() >= x.sval())); }
+//bool variant::operator>=(const variant x)            { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d >= x.rval.d : sval() >= x.sval())); }
 bool variant::operator>=(const var &x)       EVCONST { return *this >= *x; }
 
 types_extrapolate_real_p  (bool variant::operator<=, { return type == real and rval.d <= x + var_e; }) //To be less, we must be real anyway.
-types_extrapolate_string_p(bool variant::operator<=, { return type != tstr or  sval   <= x; }) //type != tstr, then we're real and a priori less.
-bool variant::operator<=(const variant &x)   EVCONST { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d <= x.rval.d : sval <= x.sval)); }
-//bool variant::operator<=(const variant x)            { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d <= x.rval.d : sval <= x.sval)); }
+types_extrapolate_string_p(bool variant::operator<=, { return type != tstr or  sval() <= x; }) //type != tstr, then we're real and a priori less.
+bool variant::operator<=(const variant &x)   EVCONST { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d <= x.rval.d : sval() <= x.sval())); }
+//bool variant::operator<=(const variant x)            { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d <= x.rval.d : sval() <= x.sval())); }
 bool variant::operator<=(const var &x)       EVCONST { return *this <= *x; }
 
 types_extrapolate_real_p  (bool variant::operator>,  { return type != real or  rval.d > x + var_e; }) //type != real, then we're string and a priori greater.
-types_extrapolate_string_p(bool variant::operator>,  { return type == tstr and sval   > x; }) //To be more, we must be string anyway.
-bool variant::operator>(const variant &x)   EVCONST { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d > x.rval.d : sval > x.sval)); }
-//bool variant::operator>(const variant x)             { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d > x.rval.d : sval > x.sval)); }
+types_extrapolate_string_p(bool variant::operator>,  { return type == tstr and sval() > x; }) //To be more, we must be string anyway.
+bool variant::operator>(const variant &x)   EVCONST { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d > x.rval.d : sval() > x.sval())); }
+//bool variant::operator>(const variant x)             { return !(type < x.type) and (type > x.type or ((x.type == real) ? rval.d > x.rval.d : sval() > x.sval())); }
 bool variant::operator>(const var &x)       EVCONST  { return *this > *x; }
 
 types_extrapolate_real_p  (bool variant::operator<,  { return type == real and rval.d < x - var_e; }) //To be less, we must be real anyway.
-types_extrapolate_string_p(bool variant::operator<,  { return type != tstr or  sval   < x; }) //type != tstr, then we're real and a priori less.
-bool variant::operator<(const variant &x)   EVCONST { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d < x.rval.d : sval < x.sval)); }
-//bool variant::operator<(const variant x)             { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d < x.rval.d : sval < x.sval)); }
+types_extrapolate_string_p(bool variant::operator<,  { return type != tstr or  sval() < x; }) //type != tstr, then we're real and a priori less.
+bool variant::operator<(const variant &x)   EVCONST { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d < x.rval.d : sval() < x.sval())); }
+//bool variant::operator<(const variant x)             { return !(type > x.type) and (type < x.type or ((x.type == real) ? rval.d < x.rval.d : sval() < x.sval())); }
 bool variant::operator<(const var &x)       EVCONST  { return *this < *x; }
 
-variant::~variant() { }
+variant::~variant() { if (type == tstr) str_release(rval.p); }
 
 #undef EVCONST
 #define EVCONST
@@ -397,7 +525,7 @@ types_binary_bitwise_assign_extrapolate_implement(|,  const variant&, terror(rea
 types_binary_bitwise_assign_extrapolate_implement(^,  const variant&, terror(real);)
 
 types_binary_extrapolate_real_p  (double operator+, const variant&, { terror(real); return x + y.rval.d; })
-types_binary_extrapolate_string_p(string operator+, const variant&, { terror(tstr); return x + y.sval; })
+types_binary_extrapolate_string_p(string operator+, const variant&, { terror(tstr); return x + y.sval(); })
 types_binary_extrapolate_real_p  (double operator-, const variant&, { terror(real); return x - y.rval.d; })
 types_binary_extrapolate_string_p(string operator-, const variant&, { terrortrue(); return 0; })
 types_binary_extrapolate_real_p  (double operator*, const variant&, { terror(real); return x * y.rval.d; })
@@ -447,7 +575,7 @@ types_binary_bitwise_assign_extrapolate_implement(|,  const var&, )
 types_binary_bitwise_assign_extrapolate_implement(^,  const var&, )
 
 types_binary_extrapolate_real_p  (double operator+, const var&, {  return x + (*y).rval.d; })
-types_binary_extrapolate_string_p(string operator+, const var&, { terror(tstr); return x + (*y).sval; })
+types_binary_extrapolate_string_p(string operator+, const var&, { terror(tstr); return x + (*y).sval(); })
 types_binary_extrapolate_real_p  (double operator-, const var&, {  return x - (*y).rval.d; })
 types_binary_extrapolate_string_p(string operator-, const var&, { terrortrue(); return 0; })
 types_binary_extrapolate_real_p  (double operator*, const var&, {  return x * (*y).rval.d; })
@@ -487,11 +615,11 @@ types_binary_extrapolate_string_p(bool operator<,  const var&, { return y > x;
    Unary nonsense for either party
 */
 
-char&     variant::operator[] (int x)    { return sval[x]; }
-variant&  variant::operator++ ()         { return ++rval.d, *this; }
-double    variant::operator++ (int)      { return rval.d++; }
-variant&  variant::operator-- ()         { return --rval.d, *this; }
-double    variant::operator-- (int)      { return rval.d--; }
+char      variant::operator[] (int x) const { return sval()[x]; }
+variant&  variant::operator++ ()         { strguard(); return ++rval.d, *this; }
+double    variant::operator++ (int)      { return type == tstr ? 0 : rval.d++; }
+variant&  variant::operator-- ()         { strguard(); return --rval.d, *this; }
+double    variant::operator-- (int)      { return type == tstr ? 0 : rval.d--; }
 variant&  variant::operator*  ()         { return *this; }
 
 #undef EVCONST
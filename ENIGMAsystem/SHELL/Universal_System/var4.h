@@ -42,6 +42,11 @@ namespace enigma {
     rvt(const void * x): p(x) {}
     #define var_e 1e-12
   };
+  
+  // Reference-counted string body. Equal strings made from text share one
+  // interned body and compare by identity; a string built by concatenation
+  // keeps a body of its own until something needs it interned.
+  struct var_string;
 }
 
 struct var;
@@ -52,10 +57,14 @@ struct variant
   //This variable is defined in a compiler-generated class.
   static const int default_type;
 
+  // Holds the real value, or for ty_string a pointer to an enigma::var_string.
+  // Keeping strings out of line keeps the whole variant at 16 bytes.
   enigma::rvt rval;
-  std::string sval;
   int type;
   
+  // The string contents; empty for variants that are not strings.
+  const std::string& sval() const;
+  
   operator int();
   operator bool();
   operator char();
@@ -136,7 +145,7 @@ struct variant
   #undef EVCONST
   #define EVCONST
   
-  char&     operator[] (int);
+  char      operator[] (int) const;
   variant&  operator++();
   double    operator++(int);
   variant&  operator--();
@@ -155,6 +164,11 @@ struct variant
   ~variant();
 };
 
+namespace enigma {
+  // v, with a string body that is interned, for use as a key that is hashed
+  // and compared by identity.
+  variant intern(const variant &v);
+}
 
 
 #undef types_extrapolate_alldec
@@ -65,6 +65,11 @@ asyncsocial: 7		# This event is executed from within code when an asynchronous s
 	Name: Social
 	Mode: Spec-sys
 	Case: 70
+	
+asyncsaveload: 7		# This event is executed from within code when an asynchronous buffer save or load finishes
+	Name: Save/Load
+	Mode: Spec-sys
+	Case: 72
 
 roomstart: 7		# This event is executed from within the code that loads a new room
 	Name: Room Start
@@ -82,6 +87,12 @@ destroy: 1			# This event is performed as a dtor: immediately as the instance is
 
 # Here marks the start of events that are actually executed in place
 
+asyncdispatch: 100000	# Hands finished background work to the asynchronous events above
+	Name: Asynchronous Dispatch
+	Mode: None
+	Default: ;
+	Instead: enigma::perform_callbacks_async_dispatch();
+
 beginstep: 3
 	Group: Step
 	Name: Begin Step
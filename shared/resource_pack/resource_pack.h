@@ -0,0 +1,96 @@
+/** Copyright (C) 2018 ENIGMA Development Team
+***
+*** This file is a part of the ENIGMA Development Environment.
+***
+*** ENIGMA is free software: you can redistribute it and/or modify it under the
+*** terms of the GNU General Public License as published by the Free Software
+*** Foundation, version 3 of the license or any later version.
+***
+*** This application and its source code is distributed AS-IS, WITHOUT ANY
+*** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+*** FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+*** details.
+***
+*** You should have received a copy of the GNU General Public License along
+*** with this code. If not, see <http://www.gnu.org/licenses/>
+**/
+
+// Layout of the resource pack the compiler appends to the game module, shared by
+// the writer (CompilerSource) and the reader (the engine's Universal_System).
+//
+//   [entry data ...]            blobs, each aligned to 8 bytes
+//   [toc_entry x entry_count]   sorted by (kind, id, index)
+//   [footer]                    always the last 32 bytes of the file
+//
+// Offsets are relative to the start of the pack, so the pack can be appended to
+// an executable of any size or written out as a file of its own. The engine maps
+// the whole thing and only decompresses an entry when something asks for it.
+
+#ifndef ENIGMA_RESOURCE_PACK_H
+#define ENIGMA_RESOURCE_PACK_H
+
+#include <stdint.h>
+
+namespace enigma {
+namespace resource_pack {
+
+static const uint32_t version = 1;
+static const char magic[8] = { 'E', 'N', 'I', 'G', 'M', 'A', 'P', 'K' };
+
+constexpr uint32_t fourcc(const char (&s)[5]) {
+  return uint32_t((unsigned char) s[0]) | uint32_t((unsigned char) s[1]) << 8 |
+         uint32_t((unsigned char) s[2]) << 16 | uint32_t((unsigned char) s[3]) << 24;
+}
+
+// What an entry holds. Metadata entries are arrays of int32 in the order given;
+// the rest hold the resource's data. Entries of a kind are numbered by index
+// where a resource has more than one of them, and index 0 otherwise.
+enum kind: uint32_t {
+  // width, height, xorig, yorig, bbox top, bottom, left, right, bbox mode, mask shape, subimages
+  kind_sprite = fourcc("SPR "),
+  kind_sprite_image = fourcc("SPRI"),      // BGRA, width * height * 4 bytes unpacked
+  kind_sound = fourcc("SND "),             // the sound file as the IDE gave it
+  // width, height, transparent, smooth, preload, tileset, tile width, tile height,
+  // h offset, v offset, h sep, v sep
+  kind_background = fourcc("BKG "),
+  kind_background_image = fourcc("BKGI"),  // BGRA, width * height * 4 bytes unpacked
+  kind_font = fourcc("FNT "),              // see module_write_fonts
+  kind_path = fourcc("PTH "),              // smooth, closed, precision, point count, then x, y, speed per point
+};
+
+enum codec: uint32_t {
+  codec_raw = 0,
+  codec_zlib = 1,
+};
+
+struct toc_entry {
+  uint32_t kind;
+  int32_t id;
+  uint32_t index;
+  uint32_t codec;
+  uint64_t offset;         // from the start of the pack
+  uint64_t size;           // as stored
+  uint64_t unpacked_size;  // once decoded; equal to size for codec_raw
+};
+
+struct footer {
+  uint64_t pack_start;     // from the start of the file
+  uint64_t toc_offset;     // from the start of the pack
+  uint32_t entry_count;
+  uint32_t version;
+  char magic[8];
+};
+
+static_assert(sizeof(toc_entry) == 40, "resource pack entries must have the same layout everywhere");
+static_assert(sizeof(footer) == 32, "the resource pack footer must have the same layout everywhere");
+
+inline bool entry_less(const toc_entry &a, uint32_t kind, int32_t id, uint32_t index) {
+  if (a.kind != kind) return a.kind < kind;
+  if (a.id != id) return a.id < id;
+  return a.index < index;
+}
+
+}  // namespace resource_pack
+}  // namespace enigma
+
+#endif  // ENIGMA_RESOURCE_PACK_H